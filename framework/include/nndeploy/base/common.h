@@ -193,6 +193,7 @@ enum MemoryPoolType : int {
   kMemoryPoolTypeEmbed = 0x0000,
   kMemoryPoolTypeUnity,
   kMemoryPoolTypeChunkIndepend,
+  kMemoryPoolTypeBlock,
 };
 
 enum TensorType : int {
@@ -212,6 +213,21 @@ enum ForwardOpType : int {
   kForwardOpTypeNotSupport,
 };
 
+/**
+ * @brief CPU指令集级别，x86的级别由低到高，高级别包含低级别
+ */
+enum CpuIsa : int {
+  kCpuIsaScalar = 0x0000,
+  kCpuIsaSse4,
+  kCpuIsaAvx2,
+  kCpuIsaAvx512,
+  kCpuIsaAvx512Vnni,
+  kCpuIsaNeon,
+
+  // not sopport
+  kCpuIsaNotSupport,
+};
+
 enum InferenceOptLevel : int {
   kInferenceOptLevel0 = 0x0000,
   kInferenceOptLevel1,
@@ -381,6 +397,9 @@ extern NNDEPLOY_CC_API CodecFlag stringToCodecFlag(const std::string &src);
 extern NNDEPLOY_CC_API ParallelType
 stringToParallelType(const std::string &src);
 
+extern NNDEPLOY_CC_API std::string cpuIsaToString(CpuIsa src);
+extern NNDEPLOY_CC_API CpuIsa stringToCpuIsa(const std::string &src);
+
 extern NNDEPLOY_CC_API PrecisionType getPrecisionType(DataType data_type);
 
 }  // namespace base
@@ -0,0 +1,53 @@
+
+#ifndef _NNDEPLOY_BASE_CPU_ISA_H_
+#define _NNDEPLOY_BASE_CPU_ISA_H_
+
+#include "nndeploy/base/common.h"
+#include "nndeploy/base/glic_stl_include.h"
+#include "nndeploy/base/macro.h"
+#include "nndeploy/base/status.h"
+
+namespace nndeploy {
+namespace base {
+
+/**
+ * @brief 通过CPUID检测硬件支持的最高指令集级别，只检测一次
+ * # x86: kCpuIsaSse4要求SSE4.1/4.2，kCpuIsaAvx2要求AVX2+FMA，
+ *   kCpuIsaAvx512要求AVX512F，kCpuIsaAvx512Vnni还要求AVX512BW/VL/VNNI，
+ *   AVX与AVX512还要求操作系统保存对应的寄存器状态
+ * # aarch64总是kCpuIsaNeon
+ */
+extern NNDEPLOY_CC_API CpuIsa getHardwareCpuIsa();
+
+/**
+ * @brief 当前生效的指令集级别，默认等于getHardwareCpuIsa()
+ */
+extern NNDEPLOY_CC_API CpuIsa getCpuIsa();
+
+/**
+ * @brief 限制生效的指令集级别，用于在同一台机器上验证低级别的kernel
+ * # 不能高于硬件支持的级别，只影响之后选择的kernel
+ */
+extern NNDEPLOY_CC_API Status setCpuIsa(CpuIsa isa);
+
+/**
+ * @brief isa的kernel能否在当前生效的级别上运行
+ */
+extern NNDEPLOY_CC_API bool isCpuIsaSupported(CpuIsa isa);
+
+/**
+ * @brief 能否使用F16C指令做float与fp16的转换
+ * # 要求硬件支持F16C，且当前生效的级别不低于kCpuIsaAvx2
+ */
+extern NNDEPLOY_CC_API bool isCpuF16cSupported();
+
+/**
+ * @brief 能否使用AVX512-BF16指令做float到bf16的转换
+ * # 要求硬件支持AVX512_BF16，且当前生效的级别为kCpuIsaAvx512
+ */
+extern NNDEPLOY_CC_API bool isCpuAvx512Bf16Supported();
+
+}  // namespace base
+}  // namespace nndeploy
+
+#endif
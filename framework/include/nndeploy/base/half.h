@@ -19,10 +19,16 @@ typedef struct bfp16_struct {
 
   bfp16_struct() : w(0) {}
 
+  // 舍入到最近的偶数，NaN保持为quiet NaN，非规格化数按同样的规则舍入
+  // @note 早期版本直接截断低16位，现在结果的绝对值可能比早期版本大1ulp
   bfp16_struct(float vf) {
     cvt_32b c;
     c.f = vf;
-    w = c.u >> 16;
+    if ((c.u & 0x7fffffff) > 0x7f800000) {
+      w = (c.u >> 16) | 0x40;
+    } else {
+      w = (c.u + 0x7fff + ((c.u >> 16) & 1)) >> 16;
+    }
   }
 
   operator const float() const {
@@ -32,17 +38,24 @@ typedef struct bfp16_struct {
   }
 } bfp16_t;
 
-extern NNDEPLOY_CC_API bool convertFromFloatToBfp16(float *fp32, void *bfp16,
-                                                    int count);
+/**
+ * @brief float与bf16/fp16的批量转换，成功时返回true
+ * # x86上按运行时检测的指令集选择实现：fp16走F16C，float到bf16优先走
+ *   AVX512-BF16，其余走AVX2的整数运算，都不支持时逐元素转换
+ * # 各实现的结果除NaN的payload外逐位一致：舍入到最近的偶数，
+ *   非规格化数不清零，NaN保持为NaN；超出fp16范围的值(包括±inf)截断到±65504
+ */
+extern NNDEPLOY_CC_API bool convertFromFloatToBfp16(const float *fp32,
+                                                    void *bfp16, int count);
 
-extern NNDEPLOY_CC_API bool convertFromBfp16ToFloat(void *bfp16, float *fp32,
-                                                    int count);
+extern NNDEPLOY_CC_API bool convertFromBfp16ToFloat(const void *bfp16,
+                                                    float *fp32, int count);
 
-extern NNDEPLOY_CC_API bool convertFromFloatToFp16(float *fp32, void *fp16,
-                                                   int count);
+extern NNDEPLOY_CC_API bool convertFromFloatToFp16(const float *fp32,
+                                                   void *fp16, int count);
 
-extern NNDEPLOY_CC_API bool convertFromFp16ToFloat(void *fp16, float *fp32,
-                                                   int count);
+extern NNDEPLOY_CC_API bool convertFromFp16ToFloat(const void *fp16,
+                                                   float *fp32, int count);
 
 }  // namespace base
 }  // namespace nndeploy
@@ -33,6 +33,24 @@ extern NNDEPLOY_CC_API IntVector shapeNhwc2Nchw(const IntVector &dims);
 
 extern NNDEPLOY_CC_API bool isDynamicShape(const IntVector &dims);
 
+/**
+ * @brief 通道分块格式(kDataFormatNC4HW/kDataFormatNC8HW)的块大小，其余格式为1
+ */
+extern NNDEPLOY_CC_API int getChannelBlock(DataFormat data_format);
+
+/**
+ * @brief 按data_format存储所需的元素数，通道分块格式的通道数向上对齐到块大小
+ */
+extern NNDEPLOY_CC_API size_t shapeCountByDataFormat(const IntVector &dims,
+                                                     DataFormat data_format);
+
+/**
+ * @brief 通道分块格式的实际存储形状
+ * # [N, C, H, W] -> [N, ceil(C / block), H, W, block]
+ */
+extern NNDEPLOY_CC_API IntVector shapeNchw2Blocked(const IntVector &dims,
+                                                   int block);
+
 }  // namespace base
 }  // namespace nndeploy
 
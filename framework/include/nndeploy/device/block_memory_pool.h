@@ -0,0 +1,60 @@
+
+#ifndef _NNDEPLOY_DEVICE_BLOCK_MEMORY_POOL_H_
+#define _NNDEPLOY_DEVICE_BLOCK_MEMORY_POOL_H_
+
+#include "nndeploy/base/common.h"
+#include "nndeploy/base/glic_stl_include.h"
+#include "nndeploy/base/log.h"
+#include "nndeploy/base/macro.h"
+#include "nndeploy/base/object.h"
+#include "nndeploy/base/status.h"
+#include "nndeploy/device/device.h"
+#include "nndeploy/device/memory_pool.h"
+#include "nndeploy/device/type.h"
+
+namespace nndeploy {
+namespace device {
+
+/**
+ * @brief 定长块内存池
+ * # 每次向设备申请一个chunk(blocks_per_chunk个块)，切分为定长块放入空闲链表
+ * # allocate返回一个块，申请大小不能超过块大小；deallocate把块放回空闲链表
+ * # 块只在deinit时归还设备，内存按chunk的粒度增长，不会因释放而产生碎片
+ * # 用于大语言模型的分页KV cache
+ */
+class NNDEPLOY_CC_API BlockMemoryPool : public MemoryPool {
+ public:
+  BlockMemoryPool(Device *device, size_t block_size, int blocks_per_chunk = 1);
+  virtual ~BlockMemoryPool();
+
+  /**
+   * @brief 预先申请size字节(向上取整为chunk)
+   */
+  virtual base::Status init(size_t size);
+
+  virtual base::Status deinit();
+
+  virtual void *allocate(size_t size);
+  virtual void *allocate(const BufferDesc &desc);
+
+  virtual void deallocate(void *ptr);
+
+  size_t getBlockSize();
+  int getBlockNum();
+  int getFreeBlockNum();
+
+ private:
+  base::Status allocateChunk();
+
+ private:
+  size_t block_size_;
+  int blocks_per_chunk_;
+  std::vector<void *> chunks_;
+  std::vector<void *> free_blocks_;
+  std::mutex mutex_;
+};
+
+}  // namespace device
+}  // namespace nndeploy
+
+#endif
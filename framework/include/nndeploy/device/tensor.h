@@ -186,6 +186,12 @@ class NNDEPLOY_CC_API Tensor {
   static base::Status safetensorsShape2Shape(
       const std::vector<size_t> &safetensors_data_shape,
       base::IntVector &shape);
+
+  /**
+   * @brief safetensors没有int4类型，打包的int4(DataType(code, 4, 2))以U8/I8存放，
+   * 并在metadata中记录{name: "int4"/"uint4"}
+   */
+  static std::string getSafetensorsInt4Type(const base::DataType &data_type);
 #endif
 
   inline int addRef() const { return NNDEPLOY_XADD(ref_count_, 1); }
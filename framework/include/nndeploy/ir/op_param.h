@@ -205,6 +205,21 @@ enum OpType : int {
   // TODO: @Leonisux:
   // 1. 增加llama的算子类型
   kOpTypeRMSNorm,
+  kOpTypeAttention,
+  // 经过KV cache块表读取K/V的注意力
+  kOpTypePagedAttention,
+  kOpTypeRotaryEmbedding,
+  kOpTypeSwiGLU,
+  kOpTypeLayerNormalization,
+  kOpTypeGroupNormalization,
+  // x * Phi(x)，按erf精确计算
+  kOpTypeGelu,
+  // x * sigmoid(x)
+  kOpTypeSilu,
+  // 数据格式转换，如NCHW与通道分块格式之间的转换，由图优化插入
+  kOpTypeReorder,
+  // 逐元素运算链融合后的算子，由图优化插入
+  kOpTypeFusedElementwise,
 
   kOpTypeNone,
 };
@@ -486,6 +501,115 @@ class NNDEPLOY_CC_API ConvParam : public OpParam {
   // OpParam* fused_op_param_ = nullptr;
   std::shared_ptr<base::Param> fused_op_param_ = nullptr;
 };
+// AveragePool 参数类
+class NNDEPLOY_CC_API AveragePoolParam : public OpParam {
+ public:
+  AveragePoolParam() : OpParam() {}
+  virtual ~AveragePoolParam() {}
+
+  PARAM_COPY(AveragePoolParam)
+  PARAM_COPY_TO(AveragePoolParam)
+
+  base::Status serialize(rapidjson::Value &json,
+                         rapidjson::Document::AllocatorType &allocator) {
+    json.AddMember("auto_pad_", rapidjson::Value(auto_pad_.c_str(), allocator),
+                   allocator);
+    json.AddMember("ceil_mode_", ceil_mode_, allocator);
+    json.AddMember("count_include_pad_", count_include_pad_, allocator);
+    rapidjson::Value dilations_array(rapidjson::kArrayType);
+    for (size_t i = 0; i < dilations_.size(); ++i) {
+      dilations_array.PushBack(dilations_[i], allocator);
+    }
+    json.AddMember("dilations_", dilations_array, allocator);
+
+    rapidjson::Value kernel_shape_array(rapidjson::kArrayType);
+    for (size_t i = 0; i < kernel_shape_.size(); ++i) {
+      kernel_shape_array.PushBack(kernel_shape_[i], allocator);
+    }
+    json.AddMember("kernel_shape_", kernel_shape_array, allocator);
+
+    rapidjson::Value pads_array(rapidjson::kArrayType);
+    for (size_t i = 0; i < pads_.size(); ++i) {
+      pads_array.PushBack(pads_[i], allocator);
+    }
+    json.AddMember("pads_", pads_array, allocator);
+
+    rapidjson::Value strides_array(rapidjson::kArrayType);
+    for (size_t i = 0; i < strides_.size(); ++i) {
+      strides_array.PushBack(strides_[i], allocator);
+    }
+    json.AddMember("strides_", strides_array, allocator);
+
+    return base::kStatusCodeOk;
+  }
+  base::Status deserialize(rapidjson::Value &json) {
+    if (json.HasMember("auto_pad_")) {
+      auto_pad_ = json["auto_pad_"].GetString();
+    } else {
+      auto_pad_ = "NOTSET";
+    }
+
+    if (json.HasMember("ceil_mode_")) {
+      ceil_mode_ = json["ceil_mode_"].GetInt();
+    } else {
+      ceil_mode_ = 0;
+    }
+
+    if (json.HasMember("count_include_pad_")) {
+      count_include_pad_ = json["count_include_pad_"].GetInt();
+    } else {
+      count_include_pad_ = 0;
+    }
+
+    if (json.HasMember("dilations_")) {
+      dilations_.clear();
+      for (size_t i = 0; i < json["dilations_"].Size(); ++i) {
+        dilations_.push_back(json["dilations_"][i].GetInt());
+      }
+    } else {
+      dilations_ = {1, 1};
+    }
+
+    if (json.HasMember("kernel_shape_")) {
+      kernel_shape_.clear();
+      for (size_t i = 0; i < json["kernel_shape_"].Size(); ++i) {
+        kernel_shape_.push_back(json["kernel_shape_"][i].GetInt());
+      }
+    } else {
+      kernel_shape_.clear();
+    }
+
+    if (json.HasMember("pads_")) {
+      pads_.clear();
+      for (size_t i = 0; i < json["pads_"].Size(); ++i) {
+        pads_.push_back(json["pads_"][i].GetInt());
+      }
+    } else {
+      pads_ = {0, 0, 0, 0};
+    }
+
+    if (json.HasMember("strides_")) {
+      strides_.clear();
+      for (size_t i = 0; i < json["strides_"].Size(); ++i) {
+        strides_.push_back(json["strides_"][i].GetInt());
+      }
+    } else {
+      strides_ = {1, 1};
+    }
+
+    return base::kStatusCodeOk;
+  }
+
+ public:
+  std::string auto_pad_ = "NOTSET";       // 自动填充方式
+  int ceil_mode_ = 0;                     // 是否向上取整
+  int count_include_pad_ = 0;             // 除数是否包含填充
+  std::vector<int> dilations_ = {1, 1};   // 扩张系数
+  std::vector<int> kernel_shape_;         // 池化核大小
+  std::vector<int> pads_ = {0, 0, 0, 0};  // 填充大小
+  std::vector<int> strides_ = {1, 1};     // 步长
+};
+
 // MaxPool 参数类
 class NNDEPLOY_CC_API MaxPoolParam : public OpParam {
  public:
@@ -863,6 +987,557 @@ class NNDEPLOY_CC_API RMSNormParam : public OpParam {
   bool is_last_ = false;
 };
 
+// Attention 参数类
+class NNDEPLOY_CC_API AttentionParam : public OpParam {
+ public:
+  AttentionParam() : OpParam() {}
+  virtual ~AttentionParam() {}
+
+  PARAM_COPY(AttentionParam)
+  PARAM_COPY_TO(AttentionParam)
+
+  base::Status serialize(rapidjson::Value &json,
+                         rapidjson::Document::AllocatorType &allocator) {
+    json.AddMember("is_causal_", is_causal_, allocator);
+    json.AddMember("causal_bottom_right_", causal_bottom_right_, allocator);
+    json.AddMember("q_num_heads_", q_num_heads_, allocator);
+    json.AddMember("kv_num_heads_", kv_num_heads_, allocator);
+    json.AddMember("scale_", scale_, allocator);
+    return base::kStatusCodeOk;
+  }
+  base::Status deserialize(rapidjson::Value &json) {
+    if (json.HasMember("is_causal_")) {
+      is_causal_ = json["is_causal_"].GetBool();
+    } else {
+      is_causal_ = false;  // 默认值
+    }
+
+    if (json.HasMember("causal_bottom_right_")) {
+      causal_bottom_right_ = json["causal_bottom_right_"].GetBool();
+    } else {
+      causal_bottom_right_ = false;  // 默认值
+    }
+
+    if (json.HasMember("q_num_heads_")) {
+      q_num_heads_ = json["q_num_heads_"].GetInt();
+    } else {
+      q_num_heads_ = 0;  // 默认值
+    }
+
+    if (json.HasMember("kv_num_heads_")) {
+      kv_num_heads_ = json["kv_num_heads_"].GetInt();
+    } else {
+      kv_num_heads_ = 0;  // 默认值
+    }
+
+    if (json.HasMember("scale_")) {
+      scale_ = json["scale_"].GetFloat();
+    } else {
+      scale_ = 0.0f;  // 默认值
+    }
+
+    return base::kStatusCodeOk;
+  }
+
+ public:
+  // 因果掩码，默认按左上角对齐(与ONNX、torch一致)，第i个query可见第[0, i]个key
+  bool is_causal_ = false;
+  // 按右下角对齐，第i个query可见第[0, i + kv_len - q_len]个key，
+  // 用于query为序列末尾的场景(如K、V中已拼接了历史)
+  bool causal_bottom_right_ = false;
+  // 输入为3D([batch, seq_len, num_heads * head_size])时必须设置头数，4D时可为0
+  int q_num_heads_ = 0;
+  int kv_num_heads_ = 0;
+  // 为0时取1 / sqrt(head_size)
+  float scale_ = 0.0f;
+};
+
+// PagedAttention 参数类
+class NNDEPLOY_CC_API PagedAttentionParam : public OpParam {
+ public:
+  PagedAttentionParam() : OpParam() {}
+  virtual ~PagedAttentionParam() {}
+
+  PARAM_COPY(PagedAttentionParam)
+  PARAM_COPY_TO(PagedAttentionParam)
+
+  base::Status serialize(rapidjson::Value &json,
+                         rapidjson::Document::AllocatorType &allocator) {
+    json.AddMember("is_causal_", is_causal_, allocator);
+    json.AddMember("q_num_heads_", q_num_heads_, allocator);
+    json.AddMember("scale_", scale_, allocator);
+    json.AddMember("layer_", layer_, allocator);
+    return base::kStatusCodeOk;
+  }
+  base::Status deserialize(rapidjson::Value &json) {
+    if (json.HasMember("is_causal_")) {
+      is_causal_ = json["is_causal_"].GetBool();
+    } else {
+      is_causal_ = false;  // 默认值
+    }
+
+    if (json.HasMember("q_num_heads_")) {
+      q_num_heads_ = json["q_num_heads_"].GetInt();
+    } else {
+      q_num_heads_ = 0;  // 默认值
+    }
+
+    if (json.HasMember("scale_")) {
+      scale_ = json["scale_"].GetFloat();
+    } else {
+      scale_ = 0.0f;  // 默认值
+    }
+
+    if (json.HasMember("layer_")) {
+      layer_ = json["layer_"].GetInt();
+    } else {
+      layer_ = 0;  // 默认值
+    }
+
+    return base::kStatusCodeOk;
+  }
+
+ public:
+  // 含义同AttentionParam，kv头数与head_size由KVCache给出
+  // query为序列末尾的token，causal掩码固定按右下角对齐
+  bool is_causal_ = false;
+  int q_num_heads_ = 0;
+  float scale_ = 0.0f;
+  // 读取KV cache中的第layer_层
+  int layer_ = 0;
+};
+
+// RotaryEmbedding 参数类
+class NNDEPLOY_CC_API RotaryEmbeddingParam : public OpParam {
+ public:
+  RotaryEmbeddingParam() : OpParam() {}
+  virtual ~RotaryEmbeddingParam() {}
+
+  PARAM_COPY(RotaryEmbeddingParam)
+  PARAM_COPY_TO(RotaryEmbeddingParam)
+
+  base::Status serialize(rapidjson::Value &json,
+                         rapidjson::Document::AllocatorType &allocator) {
+    json.AddMember("interleaved_", interleaved_, allocator);
+    json.AddMember("rotary_embedding_dim_", rotary_embedding_dim_, allocator);
+    json.AddMember("num_heads_", num_heads_, allocator);
+    return base::kStatusCodeOk;
+  }
+  base::Status deserialize(rapidjson::Value &json) {
+    if (json.HasMember("interleaved_")) {
+      interleaved_ = json["interleaved_"].GetBool();
+    } else {
+      interleaved_ = false;  // 默认值
+    }
+
+    if (json.HasMember("rotary_embedding_dim_")) {
+      rotary_embedding_dim_ = json["rotary_embedding_dim_"].GetInt();
+    } else {
+      rotary_embedding_dim_ = 0;  // 默认值
+    }
+
+    if (json.HasMember("num_heads_")) {
+      num_heads_ = json["num_heads_"].GetInt();
+    } else {
+      num_heads_ = 0;  // 默认值
+    }
+
+    return base::kStatusCodeOk;
+  }
+
+ public:
+  // true时相邻两个元素为一对(GPT-J)，false时前后两半为一对(GPT-NeoX/llama)
+  bool interleaved_ = false;
+  // 参与旋转的维度，为0时取head_size，其余维度原样输出
+  int rotary_embedding_dim_ = 0;
+  // 输入为3D([batch, seq_len, num_heads * head_size])时必须设置
+  int num_heads_ = 0;
+};
+
+// SwiGLU 参数类
+class NNDEPLOY_CC_API SwiGLUParam : public OpParam {
+ public:
+  SwiGLUParam() : OpParam() {}
+  virtual ~SwiGLUParam() {}
+
+  PARAM_COPY(SwiGLUParam)
+  PARAM_COPY_TO(SwiGLUParam)
+
+  base::Status serialize(rapidjson::Value &json,
+                         rapidjson::Document::AllocatorType &allocator) {
+    json.AddMember("axis_", axis_, allocator);
+    return base::kStatusCodeOk;
+  }
+  base::Status deserialize(rapidjson::Value &json) {
+    if (json.HasMember("axis_")) {
+      axis_ = json["axis_"].GetInt();
+    } else {
+      axis_ = -1;  // 默认值
+    }
+
+    return base::kStatusCodeOk;
+  }
+
+ public:
+  // 只有一个输入时沿axis_对半拆分，前一半为gate，后一半为up
+  int axis_ = -1;
+};
+
+// Reduce系列算子(ReduceSum/ReduceMean/ReduceMax等)共用的参数类
+class NNDEPLOY_CC_API ReduceParam : public OpParam {
+ public:
+  ReduceParam() : OpParam() {}
+  virtual ~ReduceParam() {}
+
+  PARAM_COPY(ReduceParam)
+  PARAM_COPY_TO(ReduceParam)
+
+  base::Status serialize(rapidjson::Value &json,
+                         rapidjson::Document::AllocatorType &allocator) {
+    rapidjson::Value axesArray(rapidjson::kArrayType);
+    for (size_t i = 0; i < axes_.size(); ++i) {
+      axesArray.PushBack(axes_[i], allocator);
+    }
+    json.AddMember("axes_", axesArray, allocator);
+    json.AddMember("keepdims_", keepdims_, allocator);
+    json.AddMember("noop_with_empty_axes_", noop_with_empty_axes_, allocator);
+    return base::kStatusCodeOk;
+  }
+  base::Status deserialize(rapidjson::Value &json) {
+    axes_.clear();
+    if (json.HasMember("axes_")) {
+      for (size_t i = 0; i < json["axes_"].Size(); ++i) {
+        axes_.push_back(json["axes_"][i].GetInt());
+      }
+    }
+    if (json.HasMember("keepdims_")) {
+      keepdims_ = json["keepdims_"].GetInt();
+    } else {
+      keepdims_ = 1;  // 默认值
+    }
+    if (json.HasMember("noop_with_empty_axes_")) {
+      noop_with_empty_axes_ = json["noop_with_empty_axes_"].GetInt();
+    } else {
+      noop_with_empty_axes_ = 0;  // 默认值
+    }
+
+    return base::kStatusCodeOk;
+  }
+
+ public:
+  // 归约的轴，可以为负数；opset 18起也可以由第二个输入给出
+  std::vector<int> axes_;
+  // 为1时保留被归约的维度(大小为1)
+  int keepdims_ = 1;
+  // axes为空时，为0则归约所有维度，为1则原样输出
+  int noop_with_empty_axes_ = 0;
+};
+
+// TopK 参数类
+class NNDEPLOY_CC_API TopKParam : public OpParam {
+ public:
+  TopKParam() : OpParam() {}
+  virtual ~TopKParam() {}
+
+  PARAM_COPY(TopKParam)
+  PARAM_COPY_TO(TopKParam)
+
+  base::Status serialize(rapidjson::Value &json,
+                         rapidjson::Document::AllocatorType &allocator) {
+    json.AddMember("axis_", axis_, allocator);
+    json.AddMember("largest_", largest_, allocator);
+    json.AddMember("sorted_", sorted_, allocator);
+    json.AddMember("k_", k_, allocator);
+    json.AddMember("softmax_", softmax_, allocator);
+    return base::kStatusCodeOk;
+  }
+  base::Status deserialize(rapidjson::Value &json) {
+    if (json.HasMember("axis_")) {
+      axis_ = json["axis_"].GetInt();
+    } else {
+      axis_ = -1;  // 默认值
+    }
+    if (json.HasMember("largest_")) {
+      largest_ = json["largest_"].GetInt();
+    } else {
+      largest_ = 1;  // 默认值
+    }
+    if (json.HasMember("sorted_")) {
+      sorted_ = json["sorted_"].GetInt();
+    } else {
+      sorted_ = 1;  // 默认值
+    }
+    if (json.HasMember("k_")) {
+      k_ = json["k_"].GetInt();
+    } else {
+      k_ = 1;  // 默认值
+    }
+    if (json.HasMember("softmax_")) {
+      softmax_ = json["softmax_"].GetBool();
+    } else {
+      softmax_ = false;  // 默认值
+    }
+
+    return base::kStatusCodeOk;
+  }
+
+ public:
+  int axis_ = -1;
+  // 为1时取最大的k个，为0时取最小的k个
+  int largest_ = 1;
+  // 为1时输出按大小排序
+  int sorted_ = 1;
+  // 没有K输入时使用
+  int k_ = 1;
+  // 为true时values输出softmax后的概率，只归一化选出的k个
+  bool softmax_ = false;
+};
+
+// LayerNormalization 参数类
+class NNDEPLOY_CC_API LayerNormalizationParam : public OpParam {
+ public:
+  LayerNormalizationParam() : OpParam() {}
+  virtual ~LayerNormalizationParam() {}
+
+  PARAM_COPY(LayerNormalizationParam)
+  PARAM_COPY_TO(LayerNormalizationParam)
+
+  base::Status serialize(rapidjson::Value &json,
+                         rapidjson::Document::AllocatorType &allocator) {
+    json.AddMember("axis_", axis_, allocator);
+    json.AddMember("epsilon_", epsilon_, allocator);
+    json.AddMember(
+        "activate_op_",
+        rapidjson::Value(opTypeToString(activate_op_).c_str(), allocator),
+        allocator);
+    return base::kStatusCodeOk;
+  }
+  base::Status deserialize(rapidjson::Value &json) {
+    if (json.HasMember("axis_")) {
+      axis_ = json["axis_"].GetInt();
+    } else {
+      axis_ = -1;  // 默认值
+    }
+    if (json.HasMember("epsilon_")) {
+      epsilon_ = json["epsilon_"].GetFloat();
+    } else {
+      epsilon_ = 1e-5f;  // 默认值
+    }
+    if (json.HasMember("activate_op_")) {
+      activate_op_ = stringToOpType(json["activate_op_"].GetString());
+    } else {
+      activate_op_ = kOpTypeNone;  // 默认值
+    }
+
+    return base::kStatusCodeOk;
+  }
+
+ public:
+  // 从axis_到最后一维归一化
+  int axis_ = -1;
+  float epsilon_ = 1e-5f;
+  // 融合的激活函数，kOpTypeNone表示没有
+  OpType activate_op_ = kOpTypeNone;
+};
+
+// InstanceNormalization 参数类
+class NNDEPLOY_CC_API InstanceNormalizationParam : public OpParam {
+ public:
+  InstanceNormalizationParam() : OpParam() {}
+  virtual ~InstanceNormalizationParam() {}
+
+  PARAM_COPY(InstanceNormalizationParam)
+  PARAM_COPY_TO(InstanceNormalizationParam)
+
+  base::Status serialize(rapidjson::Value &json,
+                         rapidjson::Document::AllocatorType &allocator) {
+    json.AddMember("epsilon_", epsilon_, allocator);
+    json.AddMember(
+        "activate_op_",
+        rapidjson::Value(opTypeToString(activate_op_).c_str(), allocator),
+        allocator);
+    return base::kStatusCodeOk;
+  }
+  base::Status deserialize(rapidjson::Value &json) {
+    if (json.HasMember("epsilon_")) {
+      epsilon_ = json["epsilon_"].GetFloat();
+    } else {
+      epsilon_ = 1e-5f;  // 默认值
+    }
+    if (json.HasMember("activate_op_")) {
+      activate_op_ = stringToOpType(json["activate_op_"].GetString());
+    } else {
+      activate_op_ = kOpTypeNone;  // 默认值
+    }
+
+    return base::kStatusCodeOk;
+  }
+
+ public:
+  float epsilon_ = 1e-5f;
+  // 融合的激活函数，kOpTypeNone表示没有
+  OpType activate_op_ = kOpTypeNone;
+};
+
+// GroupNormalization 参数类
+class NNDEPLOY_CC_API GroupNormalizationParam : public OpParam {
+ public:
+  GroupNormalizationParam() : OpParam() {}
+  virtual ~GroupNormalizationParam() {}
+
+  PARAM_COPY(GroupNormalizationParam)
+  PARAM_COPY_TO(GroupNormalizationParam)
+
+  base::Status serialize(rapidjson::Value &json,
+                         rapidjson::Document::AllocatorType &allocator) {
+    json.AddMember("num_groups_", num_groups_, allocator);
+    json.AddMember("epsilon_", epsilon_, allocator);
+    json.AddMember(
+        "activate_op_",
+        rapidjson::Value(opTypeToString(activate_op_).c_str(), allocator),
+        allocator);
+    return base::kStatusCodeOk;
+  }
+  base::Status deserialize(rapidjson::Value &json) {
+    if (json.HasMember("num_groups_")) {
+      num_groups_ = json["num_groups_"].GetInt();
+    } else {
+      num_groups_ = 1;  // 默认值
+    }
+    if (json.HasMember("epsilon_")) {
+      epsilon_ = json["epsilon_"].GetFloat();
+    } else {
+      epsilon_ = 1e-5f;  // 默认值
+    }
+    if (json.HasMember("activate_op_")) {
+      activate_op_ = stringToOpType(json["activate_op_"].GetString());
+    } else {
+      activate_op_ = kOpTypeNone;  // 默认值
+    }
+
+    return base::kStatusCodeOk;
+  }
+
+ public:
+  int num_groups_ = 1;
+  float epsilon_ = 1e-5f;
+  // 融合的激活函数，kOpTypeNone表示没有
+  OpType activate_op_ = kOpTypeNone;
+};
+
+// Reorder 参数类
+class NNDEPLOY_CC_API ReorderParam : public OpParam {
+ public:
+  ReorderParam() : OpParam() {}
+  virtual ~ReorderParam() {}
+
+  PARAM_COPY(ReorderParam)
+  PARAM_COPY_TO(ReorderParam)
+
+  base::Status serialize(rapidjson::Value &json,
+                         rapidjson::Document::AllocatorType &allocator) {
+    json.AddMember(
+        "data_format_",
+        rapidjson::Value(base::dataFormatToString(data_format_).c_str(),
+                         allocator),
+        allocator);
+    return base::kStatusCodeOk;
+  }
+  base::Status deserialize(rapidjson::Value &json) {
+    if (json.HasMember("data_format_")) {
+      data_format_ = base::stringToDataFormat(json["data_format_"].GetString());
+    } else {
+      data_format_ = base::kDataFormatNCHW;  // 默认值
+    }
+
+    return base::kStatusCodeOk;
+  }
+
+ public:
+  // 输出的数据格式
+  base::DataFormat data_format_ = base::kDataFormatNCHW;
+};
+
+class NNDEPLOY_CC_API CastParam : public OpParam {
+ public:
+  CastParam() : OpParam() {}
+  virtual ~CastParam() {}
+
+  PARAM_COPY(CastParam)
+  PARAM_COPY_TO(CastParam)
+
+  base::Status serialize(rapidjson::Value &json,
+                         rapidjson::Document::AllocatorType &allocator) {
+    json.AddMember(
+        "to_",
+        rapidjson::Value(base::dataTypeToString(to_).c_str(), allocator),
+        allocator);
+    return base::kStatusCodeOk;
+  }
+  base::Status deserialize(rapidjson::Value &json) {
+    if (json.HasMember("to_")) {
+      to_ = base::stringToDataType(json["to_"].GetString());
+    } else {
+      to_ = base::dataTypeOf<float>();  // 默认值
+    }
+
+    return base::kStatusCodeOk;
+  }
+
+ public:
+  // 输出的数据类型
+  base::DataType to_ = base::dataTypeOf<float>();
+};
+
+class NNDEPLOY_CC_API FusedElementwiseParam : public OpParam {
+ public:
+  FusedElementwiseParam() : OpParam() {}
+  virtual ~FusedElementwiseParam() {}
+
+  PARAM_COPY(FusedElementwiseParam)
+  PARAM_COPY_TO(FusedElementwiseParam)
+
+  base::Status serialize(rapidjson::Value &json,
+                         rapidjson::Document::AllocatorType &allocator) {
+    json.AddMember("op_types_", rapidjson::Value(rapidjson::kArrayType),
+                   allocator);
+    for (size_t i = 0; i < op_types_.size(); ++i) {
+      json["op_types_"].PushBack(
+          rapidjson::Value(opTypeToString(op_types_[i]).c_str(), allocator),
+          allocator);
+    }
+    json.AddMember("operands_", rapidjson::Value(rapidjson::kArrayType),
+                   allocator);
+    for (size_t i = 0; i < operands_.size(); ++i) {
+      json["operands_"].PushBack(operands_[i], allocator);
+    }
+    return base::kStatusCodeOk;
+  }
+  base::Status deserialize(rapidjson::Value &json) {
+    op_types_.clear();
+    if (json.HasMember("op_types_")) {
+      for (size_t i = 0; i < json["op_types_"].Size(); ++i) {
+        op_types_.push_back(stringToOpType(json["op_types_"][i].GetString()));
+      }
+    }
+    operands_.clear();
+    if (json.HasMember("operands_")) {
+      for (size_t i = 0; i < json["operands_"].Size(); ++i) {
+        operands_.push_back(json["operands_"][i].GetInt());
+      }
+    }
+
+    return base::kStatusCodeOk;
+  }
+
+ public:
+  // 按计算顺序排列的指令，第i条指令的结果存放在寄存器(输入个数 + i)
+  std::vector<OpType> op_types_;
+  // 每条指令两个操作数的寄存器编号，寄存器[0, 输入个数)为输入，
+  // 一元运算的第二个操作数为-1
+  std::vector<int> operands_;
+};
+
 class NNDEPLOY_CC_API FlattenParam : public OpParam {
  public:
   FlattenParam() : OpParam(){};
@@ -904,6 +1579,7 @@ class NNDEPLOY_CC_API GemmParam : public OpParam {
     json.AddMember("beta_", beta_, allocator);
     json.AddMember("trans_a_", trans_a_, allocator);
     json.AddMember("trans_b_", trans_b_, allocator);
+    json.AddMember("has_b_zero_point_", has_b_zero_point_, allocator);
     return base::kStatusCodeOk;
   }
   base::Status deserialize(rapidjson::Value &json) {
@@ -931,6 +1607,12 @@ class NNDEPLOY_CC_API GemmParam : public OpParam {
       trans_b_ = 0;  // 默认值
     }
 
+    if (json.HasMember("has_b_zero_point_")) {
+      has_b_zero_point_ = json["has_b_zero_point_"].GetBool();
+    } else {
+      has_b_zero_point_ = false;  // 默认值
+    }
+
     return base::kStatusCodeOk;
   }
 
@@ -939,6 +1621,72 @@ class NNDEPLOY_CC_API GemmParam : public OpParam {
   float beta_ = 1.0;   // 默认值为1.0
   int trans_a_ = 0;    // 默认值为0
   int trans_b_ = 0;    // 默认值为0
+  // B为量化类型时，输入3是否为B的zero point，否则输入3为C
+  bool has_b_zero_point_ = false;
+};
+
+// QuantizeLinear 参数类
+class NNDEPLOY_CC_API QuantizeLinearParam : public OpParam {
+ public:
+  QuantizeLinearParam() : OpParam() {}
+  virtual ~QuantizeLinearParam() {}
+
+  PARAM_COPY(QuantizeLinearParam)
+  PARAM_COPY_TO(QuantizeLinearParam)
+
+  base::Status serialize(rapidjson::Value &json,
+                         rapidjson::Document::AllocatorType &allocator) {
+    json.AddMember("axis_", axis_, allocator);
+    json.AddMember("saturate_", saturate_, allocator);
+    return base::kStatusCodeOk;
+  }
+  base::Status deserialize(rapidjson::Value &json) {
+    if (json.HasMember("axis_")) {
+      axis_ = json["axis_"].GetInt();
+    } else {
+      axis_ = 1;  // 默认值
+    }
+
+    if (json.HasMember("saturate_")) {
+      saturate_ = json["saturate_"].GetInt();
+    } else {
+      saturate_ = 1;  // 默认值
+    }
+
+    return base::kStatusCodeOk;
+  }
+
+ public:
+  int axis_ = 1;      // per-axis量化的轴，scale为标量时忽略
+  int saturate_ = 1;  // 超出范围时饱和
+};
+
+// DequantizeLinear 参数类
+class NNDEPLOY_CC_API DequantizeLinearParam : public OpParam {
+ public:
+  DequantizeLinearParam() : OpParam() {}
+  virtual ~DequantizeLinearParam() {}
+
+  PARAM_COPY(DequantizeLinearParam)
+  PARAM_COPY_TO(DequantizeLinearParam)
+
+  base::Status serialize(rapidjson::Value &json,
+                         rapidjson::Document::AllocatorType &allocator) {
+    json.AddMember("axis_", axis_, allocator);
+    return base::kStatusCodeOk;
+  }
+  base::Status deserialize(rapidjson::Value &json) {
+    if (json.HasMember("axis_")) {
+      axis_ = json["axis_"].GetInt();
+    } else {
+      axis_ = 1;  // 默认值
+    }
+
+    return base::kStatusCodeOk;
+  }
+
+ public:
+  int axis_ = 1;  // per-axis反量化的轴，scale为标量时忽略
 };
 
 }  // namespace ir
@@ -24,6 +24,12 @@ class NNDEPLOY_CC_API Net : public op::Op {
                                base::ShapeMap &opt_shape,
                                base::ShapeMap &max_shape);
   base::Status setTensorPoolType(TensorPoolType tensor_pool_type);
+  /**
+   * @brief 设置Net的线程预算，op内的并行计算最多使用num_thread个线程
+   * # <=0表示不限制，使用线程池的全部线程
+   */
+  base::Status setThreadNum(int num_thread);
+  int getThreadNum();
 
   TensorWrapper *createTensor(const std::string &name, bool is_weight = false);
   TensorWrapper *addTensor(device::Tensor *tensor, bool is_external = true,
@@ -94,6 +100,12 @@ class NNDEPLOY_CC_API Net : public op::Op {
    */
   base::Status setDisablePass(std::set<OptPassType>);
 
+  /**
+   * @brief 精度为fp16/bf16时允许以半精度存储与计算的op，为空则使用默认列表
+   */
+  base::Status setPrecisionAllowList(std::set<ir::OpType>);
+  std::set<ir::OpType> getPrecisionAllowList();
+
  protected:
   virtual base::Status construct();
   // NNDEPLOY_LOGI("1. Optimizer Graph V1!\n");
@@ -118,6 +130,7 @@ class NNDEPLOY_CC_API Net : public op::Op {
   base::ShapeMap max_shape_ = base::ShapeMap();  // 当为动态输入时最大shape
   TensorPoolType tensor_pool_type_ =
       kTensorPool1DSharedObjectTypeGreedyBySizeImprove;
+  int num_thread_ = 0;  // op内并行计算的线程预算，<=0表示不限制
 
   Runtime *runtime_;
 
@@ -126,6 +139,7 @@ class NNDEPLOY_CC_API Net : public op::Op {
   std::set<OptPassType>
       disable_pass_;  //禁用这些pass，如果为空则启用全部pass;
                       //如果同时设置了enable_pass_，则只有enable_pass_生效
+  std::set<ir::OpType> precision_allow_list_;  //半精度的op允许列表
 };
 
 Net *createNet(ir::ModelDesc *model_desc, base::DeviceType device_type,
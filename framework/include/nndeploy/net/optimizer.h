@@ -19,6 +19,9 @@ enum OptPassType : int {
   kOptPassTypeFuseConvBatchNorm,
   kOptPassTypeFuseConvRelu,
   kOptPassTypeFuseConvAct,
+  kOptPassTypeFuseQdqConv,
+  kOptPassTypeFuseLayerNorm,
+  kOptPassTypeFuseElementwise,
 
   // Eliminate useless op
   kOptPassTypeEliminateCommonSubexpression,
@@ -26,6 +29,12 @@ enum OptPassType : int {
 
   // Constant Folding
   kOptPassTypeFoldConstant,
+
+  // Layout
+  kOptPassTypePropagateLayout,
+
+  // Precision
+  kOptPassTypeConvertPrecision,
 };
 
 class Net;
@@ -0,0 +1,45 @@
+#ifndef _NNDEPLOY_NET_OPTIMIZER_CONVERT_PRECISION_H_
+#define _NNDEPLOY_NET_OPTIMIZER_CONVERT_PRECISION_H_
+
+#include "nndeploy/net/optimizer.h"
+
+namespace nndeploy {
+namespace net {
+
+/**
+ * @brief Net的精度为kPrecisionTypeFp16/kPrecisionTypeBFp16时，
+ * 将允许列表中的op改为以fp16/bf16存储权重与激活值，计算时仍以float累加
+ * # 允许列表：Net::setPrecisionAllowList设置，为空时使用默认列表
+ *   MatMul、Gemm、Relu/Sigmoid/Tanh/Exp/Erf/Sqrt、Add/Sub/Mul/Div、
+ *   Reshape/Flatten/Transpose/Concat/Split/Slice、FusedElementwise
+ * # op的选取
+ *   a. 输出均为float，输入与输出均不是通道分块格式
+ *   b. MatMul、Gemm与FusedElementwise的输入均为float，
+ *      其余op的第0个输入为float
+ *   c. 只搬运数据的op(Reshape等)需有输入来自已选取的op
+ * # 选取的op的float输入
+ *   a. 常量转换为半精度，只被选取的op使用时原地替换，否则另存一份
+ *   b. 其余张量插入Cast，每个张量只转一次
+ * # 选取的op的输出被未选取的op使用或是模型的输出时，插入Cast转回float，
+ *   模型的输出仍为float
+ * @note 需要在形状推导之后执行，允许列表中的op需支持半精度的输入
+ */
+class ConvertPrecision : public OptPass {
+ public:
+  ConvertPrecision();
+  virtual ~ConvertPrecision();
+
+  virtual base::Status optimize(std::vector<TensorWrapper*>& tensor_repository,
+                                std::vector<OpWrapper*>& op_repository,
+                                int begin_op_index);
+
+ private:
+  OpWrapper* createCast(std::vector<OpWrapper*>& op_repository,
+                        OpWrapper* reference, TensorWrapper* input,
+                        TensorWrapper* output, base::DataType data_type);
+};
+
+}  // namespace net
+}  // namespace nndeploy
+
+#endif /* _NNDEPLOY_NET_OPTIMIZER_CONVERT_PRECISION_H_ */
@@ -44,7 +44,9 @@ class FuseConvAct : public OptPass {
                       std::vector<ir::OpType>& matched_types,
                       int begin_op_index);
   std::vector<OpSet> types{{ir::kOpTypeConv},  // first conv_type
-                           {ir::kOpTypeRelu, ir::kOpTypeSigmoid}};
+                           {ir::kOpTypeRelu, ir::kOpTypeSigmoid,
+                            ir::kOpTypeTanh, ir::kOpTypeGelu,
+                            ir::kOpTypeSilu}};
 };
 
 }  // namespace net
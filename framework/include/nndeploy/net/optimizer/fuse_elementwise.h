@@ -0,0 +1,42 @@
+#ifndef _NNDEPLOY_NET_OPTIMIZER_FUSE_ELEMENTWISE_H_
+#define _NNDEPLOY_NET_OPTIMIZER_FUSE_ELEMENTWISE_H_
+
+#include "nndeploy/net/optimizer.h"
+
+namespace nndeploy {
+namespace net {
+
+/**
+ * @brief 将相连的逐元素op融合为一个FusedElementwise，如
+ *   SiLU：Mul -> Add -> Sigmoid -> Mul，归一化：Sub -> Div，Add -> Relu
+ * # 可融合的op：Add/Sub/Mul/Div/Pow、Relu/Sigmoid/Exp/Tanh/Erf/Sqrt
+ * # 按拓扑逆序以未融合的op为终点，向前吸收产生其输入的op，条件为
+ *   a. 中间结果只被融合的op使用，且不是模型的输出
+ *   b. 中间结果的形状、数据格式与终点的输出相同，不会重复计算
+ *   c. 所有输入输出的数据类型相同，为fp32/fp16/bf16
+ *   d. 通道分块格式时，输入须为相同形状与格式的张量或标量
+ *   e. 最多kFusedElementwiseMaxOps个op
+ * # 中间结果从张量池中删除
+ * @note 在形状推导之后、数据格式传播与精度转换之前执行，
+ *       PropagateLayout与ConvertPrecision把融合后的op作为一个op处理，
+ *       只在融合组的边界插入Reorder与Cast
+ */
+class FuseElementwise : public OptPass {
+ public:
+  FuseElementwise();
+  virtual ~FuseElementwise();
+
+  virtual base::Status optimize(std::vector<TensorWrapper*>& tensor_repository,
+                                std::vector<OpWrapper*>& op_repository,
+                                int begin_op_index);
+
+ private:
+  base::Status fuse(std::vector<TensorWrapper*>& tensor_repository,
+                    std::vector<OpWrapper*>& op_repository,
+                    const std::vector<OpWrapper*>& ops);
+};
+
+}  // namespace net
+}  // namespace nndeploy
+
+#endif /* _NNDEPLOY_NET_OPTIMIZER_FUSE_ELEMENTWISE_H_ */
@@ -0,0 +1,35 @@
+#ifndef _NNDEPLOY_NET_OPTIMIZER_FUSE_LAYER_NORM_H_
+#define _NNDEPLOY_NET_OPTIMIZER_FUSE_LAYER_NORM_H_
+
+#include "nndeploy/net/optimizer.h"
+
+namespace nndeploy {
+namespace net {
+
+/**
+ * @brief 将导出为基础算子的LayerNorm子图融合为LayerNormalization
+ *   mean = ReduceMean(x)       d = Sub(x, mean)
+ *   var  = ReduceMean(Pow(d, 2))
+ *   y    = Div(d, Sqrt(Add(var, eps)))
+ *   y    = Add(Mul(y, gamma), beta)
+ * # 匹配条件
+ *   a. 两个ReduceMean的axes相同，为连续的最内层维度，keepdims为1
+ *   b. Pow的指数、eps、gamma与beta为常量，gamma与beta的维度不超过归一化的维度
+ *   c. 中间结果只在子图内使用，且不是模型的输出
+ *   d. 必须有Mul(gamma)，beta可选；没有gamma时无法在形状推导前得知
+ *      归一化的元素数，不做融合
+ */
+class FuseLayerNorm : public OptPass {
+ public:
+  FuseLayerNorm();
+  virtual ~FuseLayerNorm();
+
+  virtual base::Status optimize(std::vector<TensorWrapper*>& tensor_repository,
+                                std::vector<OpWrapper*>& op_repository,
+                                int begin_op_index);
+};
+
+}  // namespace net
+}  // namespace nndeploy
+
+#endif /* _NNDEPLOY_NET_OPTIMIZER_FUSE_LAYER_NORM_H_ */
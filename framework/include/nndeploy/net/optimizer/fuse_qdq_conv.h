@@ -0,0 +1,34 @@
+#ifndef _NNDEPLOY_NET_OPTIMIZER_FUSE_QDQ_CONV_H_
+#define _NNDEPLOY_NET_OPTIMIZER_FUSE_QDQ_CONV_H_
+
+#include "nndeploy/net/optimizer.h"
+
+namespace nndeploy {
+namespace net {
+
+/**
+ * @brief 将QDQ格式的 DequantizeLinear -> Conv -> QuantizeLinear 融合为
+ * QLinearConv，卷积之间的激活保持为int8
+ * # 匹配条件
+ *   a. Conv的输入由DequantizeLinear产生，scale为标量
+ *   b. Conv的权重由常量int8/uint8权重的DequantizeLinear产生，
+ *      scale为标量或沿axis 0的per-channel
+ *   c. Conv的输出仅被一个scale为标量的QuantizeLinear使用，且不是模型的输出
+ *   d. bias为float常量或常量的DequantizeLinear，按x_scale * w_scale转为int32
+ * # Conv上已融合的激活(FuseConvAct)一并带入QLinearConv
+ * # 不再被使用的DequantizeLinear由EliminateDeadOp删除
+ */
+class FuseQdqConv : public OptPass {
+ public:
+  FuseQdqConv();
+  virtual ~FuseQdqConv();
+
+  virtual base::Status optimize(std::vector<TensorWrapper*>& tensor_repository,
+                                std::vector<OpWrapper*>& op_repository,
+                                int begin_op_index);
+};
+
+}  // namespace net
+}  // namespace nndeploy
+
+#endif /* _NNDEPLOY_NET_OPTIMIZER_FUSE_QDQ_CONV_H_ */
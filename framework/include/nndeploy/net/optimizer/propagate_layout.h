@@ -0,0 +1,47 @@
+#ifndef _NNDEPLOY_NET_OPTIMIZER_PROPAGATE_LAYOUT_H_
+#define _NNDEPLOY_NET_OPTIMIZER_PROPAGATE_LAYOUT_H_
+
+#include "nndeploy/net/optimizer.h"
+
+namespace nndeploy {
+namespace net {
+
+/**
+ * @brief 将以卷积为起点的连通区域改为通道分块格式(NC4HW/NC8HW)计算
+ * # 块大小：支持AVX2时为8，否则为4
+ * # 区域的选取
+ *   a. 起点为float的4D卷积，权重为常量，group为1或depthwise
+ *   b. 按拓扑序向后扩展，支持分块格式且有输入来自区域内的op加入区域：
+ *      MaxPool、AveragePool、GlobalAveragePool、
+ *      Relu/Sigmoid/Exp/Tanh/Erf/Gelu/Silu/Sqrt、
+ *      Add/Sub/Mul/Div/Pow(输入为4D张量或标量常量)、Concat、
+ *      FusedElementwise(输入为与输出形状相同的4D张量或标量常量)
+ * # 区域内张量补齐的通道为0：卷积与池化的结果本身为0，
+ *   逐元素op与Concat计算后重新写0
+ * # 只在区域边界插入Reorder
+ *   a. 区域的输入来自图输入或区域外的op时，转为分块格式，每个张量只转一次
+ *   b. 区域的输出被区域外的op使用时，转回NCHW供这些op使用
+ *   c. 区域的输出是模型的输出时，区域内写分块格式的新张量，
+ *      由Reorder写回原张量，模型的输出仍为NCHW
+ * @note 需要在形状推导之后执行，形状未知的张量不做转换
+ */
+class PropagateLayout : public OptPass {
+ public:
+  PropagateLayout();
+  virtual ~PropagateLayout();
+
+  virtual base::Status optimize(std::vector<TensorWrapper*>& tensor_repository,
+                                std::vector<OpWrapper*>& op_repository,
+                                int begin_op_index);
+
+ private:
+  OpWrapper* createReorder(std::vector<OpWrapper*>& op_repository,
+                           OpWrapper* reference, TensorWrapper* input,
+                           TensorWrapper* output,
+                           base::DataFormat data_format);
+};
+
+}  // namespace net
+}  // namespace nndeploy
+
+#endif /* _NNDEPLOY_NET_OPTIMIZER_PROPAGATE_LAYOUT_H_ */
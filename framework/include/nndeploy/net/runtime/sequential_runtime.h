@@ -41,6 +41,8 @@ class NNDEPLOY_CC_API SequentialRuntime : public Runtime {
   bool workspace_is_external_ = false;  // workspaceǷⲿ
   uint64_t workspace_size_ = 0;         // workspaceС
   void *workspace_ = nullptr;           // opworkspace
+  // ڴʱshapereshapeshapeʱѷڴ
+  base::ShapeMap allocated_shape_;
 };
 
 }  // namespace net
@@ -42,6 +42,16 @@ struct OpBreadth {
   bool operator<(const OpBreadth &other) const { return size_ < other.size_; }
 };
 
+/**
+ * @brief tensor视图，tensor不单独分配内存，直接引用root_从offset_字节开始的内存
+ * # Reshape、Flatten、Slice、Split的输出引用输入
+ * # Concat的输入引用输出，生产者直接写入Concat的输出
+ */
+struct TensorView {
+  TensorWrapper *root_;
+  size_t offset_;
+};
+
 struct Chunk {
   // 共享指针 buffer->getData()
   device::Buffer *buffer_;
@@ -72,11 +82,37 @@ class TensorPool {
    */
   virtual base::Status setMemory(device::Buffer *buffer);
 
+  /**
+   * @brief 动态shape下不重新分配内存时，reshape之前释放视图的buffer，
+   * 视图的shape可以超过原来引用的大小
+   */
+  base::Status deallocateTensorView();
+  /**
+   * @brief 动态shape下不重新分配内存时，reshape之后按新的shape重新计算视图的偏移
+   * # 视图关系仍成立时重新引用root的内存
+   * # 视图关系失效或放不下时单独分配内存，Op::run会退化为拷贝
+   */
+  base::Status updateTensorView();
+
+ protected:
+  /**
+   * @brief 根据Op::getOutputView与Op::getInputView建立tensor视图
+   * # 视图两端都不能是权重，被视图引用的tensor不能再成为其他tensor的视图
+   * # 输入输出tensor不作为视图，只可以被引用
+   */
+  base::Status initTensorView();
+  /**
+   * @brief 在root分配内存之后，为视图tensor创建引用root内存的buffer
+   */
+  base::Status allocateTensorView();
+  base::Status deinitTensorView();
+
  protected:
   device::Device *device_;
   base::IntVector config_ = base::IntVector();
   std::vector<TensorWrapper *> tensor_repository_;
   std::vector<OpWrapper *> op_repository_;
+  std::map<TensorWrapper *, TensorView> tensor_views_;
 };
 
 /**
@@ -109,11 +109,124 @@ NNDEPLOY_CC_API std::shared_ptr<Expr> makeMaxPool(
     std::shared_ptr<ir::MaxPoolParam> param, std::string op_name = "",
     std::string output_name = "");
 
+// AveragePool
+NNDEPLOY_CC_API std::shared_ptr<Expr> makeAveragePool(
+    ir::ModelDesc *model_desc, std::shared_ptr<Expr> input,
+    std::shared_ptr<ir::AveragePoolParam> param, std::string op_name = "",
+    std::string output_name = "");
+
 // GlobalAveragePool
 NNDEPLOY_CC_API std::shared_ptr<Expr> makeGlobalAveragePool(
     ir::ModelDesc *model_desc, std::shared_ptr<Expr> input,
     std::string op_name = "", std::string output_name = "");
 
+// RMSNorm
+// residual不为空时为融合残差相加的RMSNorm，getOutputName()[1]为相加后的残差
+NNDEPLOY_CC_API std::shared_ptr<Expr> makeRMSNorm(
+    ir::ModelDesc *model_desc, std::shared_ptr<Expr> input,
+    std::shared_ptr<ir::RMSNormParam> param, const std::string &weight,
+    std::shared_ptr<Expr> residual = nullptr, std::string op_name = "",
+    std::string output_name = "");
+
+// Attention
+// inputs为[q, k, v, attn_mask]，attn_mask为空时不加掩码
+NNDEPLOY_CC_API std::shared_ptr<Expr> makeAttention(
+    ir::ModelDesc *model_desc, std::shared_ptr<Expr> q,
+    std::shared_ptr<Expr> k, std::shared_ptr<Expr> v,
+    std::shared_ptr<ir::AttentionParam> param,
+    std::shared_ptr<Expr> attn_mask = nullptr, std::string op_name = "",
+    std::string output_name = "");
+
+// RotaryEmbedding
+// cos_cache/sin_cache为权重名，position_ids为空时按缓存的形状取位置
+NNDEPLOY_CC_API std::shared_ptr<Expr> makeRotaryEmbedding(
+    ir::ModelDesc *model_desc, std::shared_ptr<Expr> input,
+    std::shared_ptr<ir::RotaryEmbeddingParam> param,
+    const std::string &cos_cache, const std::string &sin_cache,
+    std::shared_ptr<Expr> position_ids = nullptr, std::string op_name = "",
+    std::string output_name = "");
+
+// SwiGLU
+// up为空时gate沿param->axis_对半拆分为gate与up
+NNDEPLOY_CC_API std::shared_ptr<Expr> makeSwiGLU(
+    ir::ModelDesc *model_desc, std::shared_ptr<Expr> gate,
+    std::shared_ptr<Expr> up = nullptr,
+    std::shared_ptr<ir::SwiGLUParam> param = nullptr,
+    std::string op_name = "", std::string output_name = "");
+
+// Split
+// split为int64权重名，为空时按输出个数均分；param->num_outputs_为输出个数，
+// 每个输出为一个Expr
+NNDEPLOY_CC_API std::vector<std::shared_ptr<Expr>> makeSplit(
+    ir::ModelDesc *model_desc, std::shared_ptr<Expr> input,
+    std::shared_ptr<ir::SplitParam> param, const std::string &split = "",
+    std::string op_name = "", std::string output_name = "");
+
+// Concat
+NNDEPLOY_CC_API std::shared_ptr<Expr> makeConcat(
+    ir::ModelDesc *model_desc, std::vector<std::shared_ptr<Expr>> inputs,
+    std::shared_ptr<ir::ConcatParam> param, std::string op_name = "",
+    std::string output_name = "");
+
+// QuantizeLinear
+// scale与zero_point为权重名，zero_point为空时输出uint8
+NNDEPLOY_CC_API std::shared_ptr<Expr> makeQuantizeLinear(
+    ir::ModelDesc *model_desc, std::shared_ptr<Expr> input,
+    std::shared_ptr<ir::QuantizeLinearParam> param, const std::string &scale,
+    const std::string &zero_point = "", std::string op_name = "",
+    std::string output_name = "");
+
+// DequantizeLinear
+// 反量化常量权重时input可以是Expr(权重名)
+NNDEPLOY_CC_API std::shared_ptr<Expr> makeDequantizeLinear(
+    ir::ModelDesc *model_desc, std::shared_ptr<Expr> input,
+    std::shared_ptr<ir::DequantizeLinearParam> param, const std::string &scale,
+    const std::string &zero_point = "", std::string op_name = "",
+    std::string output_name = "");
+
+// Reduce系列
+// axes为int64权重名，为空时使用param->axes_
+NNDEPLOY_CC_API std::shared_ptr<Expr> makeReduceL1(
+    ir::ModelDesc *model_desc, std::shared_ptr<Expr> input,
+    std::shared_ptr<ir::ReduceParam> param, const std::string &axes = "",
+    std::string op_name = "", std::string output_name = "");
+NNDEPLOY_CC_API std::shared_ptr<Expr> makeReduceL2(
+    ir::ModelDesc *model_desc, std::shared_ptr<Expr> input,
+    std::shared_ptr<ir::ReduceParam> param, const std::string &axes = "",
+    std::string op_name = "", std::string output_name = "");
+NNDEPLOY_CC_API std::shared_ptr<Expr> makeReduceLogSum(
+    ir::ModelDesc *model_desc, std::shared_ptr<Expr> input,
+    std::shared_ptr<ir::ReduceParam> param, const std::string &axes = "",
+    std::string op_name = "", std::string output_name = "");
+NNDEPLOY_CC_API std::shared_ptr<Expr> makeReduceLogSumExp(
+    ir::ModelDesc *model_desc, std::shared_ptr<Expr> input,
+    std::shared_ptr<ir::ReduceParam> param, const std::string &axes = "",
+    std::string op_name = "", std::string output_name = "");
+NNDEPLOY_CC_API std::shared_ptr<Expr> makeReduceMax(
+    ir::ModelDesc *model_desc, std::shared_ptr<Expr> input,
+    std::shared_ptr<ir::ReduceParam> param, const std::string &axes = "",
+    std::string op_name = "", std::string output_name = "");
+NNDEPLOY_CC_API std::shared_ptr<Expr> makeReduceMean(
+    ir::ModelDesc *model_desc, std::shared_ptr<Expr> input,
+    std::shared_ptr<ir::ReduceParam> param, const std::string &axes = "",
+    std::string op_name = "", std::string output_name = "");
+NNDEPLOY_CC_API std::shared_ptr<Expr> makeReduceMin(
+    ir::ModelDesc *model_desc, std::shared_ptr<Expr> input,
+    std::shared_ptr<ir::ReduceParam> param, const std::string &axes = "",
+    std::string op_name = "", std::string output_name = "");
+NNDEPLOY_CC_API std::shared_ptr<Expr> makeReduceProd(
+    ir::ModelDesc *model_desc, std::shared_ptr<Expr> input,
+    std::shared_ptr<ir::ReduceParam> param, const std::string &axes = "",
+    std::string op_name = "", std::string output_name = "");
+NNDEPLOY_CC_API std::shared_ptr<Expr> makeReduceSum(
+    ir::ModelDesc *model_desc, std::shared_ptr<Expr> input,
+    std::shared_ptr<ir::ReduceParam> param, const std::string &axes = "",
+    std::string op_name = "", std::string output_name = "");
+NNDEPLOY_CC_API std::shared_ptr<Expr> makeReduceSumSquare(
+    ir::ModelDesc *model_desc, std::shared_ptr<Expr> input,
+    std::shared_ptr<ir::ReduceParam> param, const std::string &axes = "",
+    std::string op_name = "", std::string output_name = "");
+
 // TODO: @Leonisux:
 // 补充llama的算子的手动构图函数
 
@@ -0,0 +1,109 @@
+#ifndef _NNDEPLOY_OP_IGEMM_H_
+#define _NNDEPLOY_OP_IGEMM_H_
+
+#include "nndeploy/base/common.h"
+#include "nndeploy/base/glic_stl_include.h"
+#include "nndeploy/base/log.h"
+#include "nndeploy/base/macro.h"
+#include "nndeploy/base/status.h"
+#include "nndeploy/ir/ir.h"
+
+namespace nndeploy {
+namespace op {
+
+/**
+ * @brief int8矩阵乘的权重
+ * # 逻辑上为[N, K]，第n行第k个元素为data_[n * stride_n_ + k * stride_k_]
+ * # 数据类型为int8/uint8，zero_points_与权重的数据类型相同，
+ *   个数为1(per-tensor)或N(per-channel)，为nullptr时零点为0
+ */
+struct IGemmWeight {
+  base::DataType data_type_;
+  int n_ = 0;
+  int k_ = 0;
+  const void *data_ = nullptr;
+  int stride_n_ = 0;
+  int stride_k_ = 1;
+  const void *zero_points_ = nullptr;
+  int zero_point_num_ = 0;
+};
+
+/**
+ * @brief int8矩阵乘的输出，int32累加结果的重量化
+ * # real = (acc - 零点修正 + bias_[n]) * scales_[n]，
+ *   其中scales_[n] = a_scale * w_scale[n]
+ * # y = saturate(round(act(real) / y_scale_) + y_zero_point_)
+ * # 第m行第n列写到y_[m * stride_m_ + n * stride_n_]，卷积可直接写NCHW
+ */
+struct IGemmOutput {
+  const float *scales_ = nullptr;
+  // int32的bias，scale为a_scale * w_scale[n]，可为nullptr
+  const int32_t *bias_ = nullptr;
+  ir::OpType activate_op_ = ir::kOpTypeNone;
+  float y_scale_ = 1.0f;
+  int y_zero_point_ = 0;
+  // int8或uint8
+  base::DataType y_data_type_;
+  void *y_ = nullptr;
+  int stride_m_ = 0;
+  int stride_n_ = 1;
+};
+
+/**
+ * @brief 判断是否为igemm支持的数据类型(int8/uint8)
+ */
+NNDEPLOY_CC_API bool isIGemmDataType(const base::DataType &data_type);
+
+/**
+ * @brief A每行需要可读的字节数，K按4对齐
+ * # 对齐部分的权重为0，A中对应的值不影响结果
+ */
+NNDEPLOY_CC_API int igemmPaddedK(int k);
+
+/**
+ * @brief 预打包权重所需的空间大小(字节)
+ */
+NNDEPLOY_CC_API size_t igemmPackedBSize(int n, int k);
+
+/**
+ * @brief 预打包权重
+ * # uint8的权重与零点减去128转为int8，每16个输出通道、每4个K连续存放，
+ *   即vpdpbusd一次处理的布局
+ * # 同时记录每个输出通道的零点与权重和，用于零点修正
+ */
+NNDEPLOY_CC_API base::Status igemmPackB(const IGemmWeight &weight,
+                                        void *packed_b);
+
+/**
+ * @brief igemm所需的workspace大小(字节)
+ */
+NNDEPLOY_CC_API size_t igemmWorkspaceSize(int m, int n);
+
+/**
+ * @brief int8矩阵乘 Y[m, n] = requantize(A[m, k] * W[n, k]^T)
+ *
+ * @param a uint8的A，每行至少igemmPaddedK(k)个可读字节；int8的A需要先
+ *   异或0x80转为uint8，同时零点加128
+ * @param a_zero_point A的零点
+ * @param packed_b igemmPackB打包的权重
+ * @param output 输出与重量化参数
+ * @param workspace 至少igemmWorkspaceSize(m, n)字节
+ * @note
+ * # int32累加，零点修正为
+ *   sum((a - za) * (w - zw)) = sum(a * w) - zw * sum(a) - za * sum(w) +
+ *   k * za * zw，sum(w)在打包时计算，sum(a)每行计算一次
+ * # kernel
+ *   - avx512vnni: vpdpbusd直接做u8 x s8的4元素点积
+ *   - avx2: 扩展为int16后vpmaddwd，避免vpmaddubsw的饱和
+ *   - 标量参考实现
+ * # 重量化与激活在输出tile上完成，int32的中间结果不写回内存
+ */
+NNDEPLOY_CC_API base::Status igemm(int m, int n, int k, const uint8_t *a,
+                                   int lda, int a_zero_point,
+                                   const void *packed_b,
+                                   const IGemmOutput &output, void *workspace);
+
+}  // namespace op
+}  // namespace nndeploy
+
+#endif /* _NNDEPLOY_OP_IGEMM_H_ */
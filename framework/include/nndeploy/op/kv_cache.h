@@ -0,0 +1,112 @@
+#ifndef _NNDEPLOY_OP_KV_CACHE_H_
+#define _NNDEPLOY_OP_KV_CACHE_H_
+
+#include "nndeploy/base/common.h"
+#include "nndeploy/base/glic_stl_include.h"
+#include "nndeploy/base/log.h"
+#include "nndeploy/base/macro.h"
+#include "nndeploy/base/status.h"
+#include "nndeploy/device/block_memory_pool.h"
+#include "nndeploy/device/device.h"
+#include "nndeploy/device/tensor.h"
+
+namespace nndeploy {
+namespace op {
+
+/**
+ * @brief 分页KV cache的参数
+ */
+struct NNDEPLOY_CC_API KVCacheParam {
+  int num_layers_ = 1;
+  int num_kv_heads_ = 1;
+  int head_size_ = 128;
+  // 每个块存放的token数
+  int block_tokens_ = 16;
+  // 内存池每次向设备申请的块数
+  int blocks_per_chunk_ = 16;
+  base::DataType data_type_ = base::dataTypeOf<float>();
+};
+
+/**
+ * @brief 分页KV cache的块管理
+ * # 每个序列持有一张块表，第i个token位于第i / block_tokens个块的
+ *   第i % block_tokens行，序列长度按块的粒度增长，追加token时不移动已有的数据
+ * # 一个块存放所有层的K/V，布局为[num_layers][K/V][num_kv_heads][block_tokens]
+ *   [head_size]，同一头的连续token在块内连续存放
+ * # 块来自BlockMemoryPool，带引用计数；fork的序列共享父序列的全部块，
+ *   向被共享的未满块写入前先复制该块(copy on write)
+ * # 非线程安全，多线程操作同一个KVCache时由调用者加锁
+ */
+class NNDEPLOY_CC_API KVCache {
+ public:
+  KVCache(device::Device *device, const KVCacheParam &param);
+  virtual ~KVCache();
+
+  /**
+   * @brief 预先申请可容纳num_tokens个token的块，0表示按需申请
+   */
+  base::Status init(int num_tokens = 0);
+  base::Status deinit();
+
+  /**
+   * @brief 创建空序列，返回序列id
+   */
+  int createSequence();
+  /**
+   * @brief 复制序列(如beam search、共享system prompt)，新序列与原序列共享块
+   * @return 新序列的id，失败时返回-1
+   */
+  int forkSequence(int seq_id);
+  base::Status freeSequence(int seq_id);
+
+  /**
+   * @brief 序列长度增加num_tokens，必要时申请新块
+   * @note 之后由writeKV写入每一层新增token的K/V
+   */
+  base::Status appendSlots(int seq_id, int num_tokens);
+  /**
+   * @brief 写入序列最后num_tokens个token在第layer层的K/V
+   * # k、v为[num_kv_heads, num_tokens, head_size]，允许前面有大小为1的维度
+   */
+  base::Status writeKV(int seq_id, int layer, device::Tensor *k,
+                       device::Tensor *v);
+  bool hasSequence(int seq_id);
+  int getSequenceLength(int seq_id);
+  const std::vector<void *> &getBlockTable(int seq_id);
+
+  const KVCacheParam &getParam();
+  device::Device *getDevice();
+  size_t getBlockSize();
+  int getBlockNum();
+  int getFreeBlockNum();
+
+  /**
+   * @brief 第layer层第kv_head个头的K/V在块内的字节偏移
+   */
+  size_t getKeyOffset(int layer, int kv_head);
+  size_t getValueOffset(int layer, int kv_head);
+
+ private:
+  struct KVSequence {
+    std::vector<void *> blocks_;
+    int length_ = 0;
+  };
+
+  void *allocateBlock();
+  void releaseBlock(void *block);
+
+ private:
+  device::Device *device_;
+  KVCacheParam param_;
+  size_t block_size_;
+  size_t head_size_bytes_;
+  device::BlockMemoryPool *memory_pool_ = nullptr;
+  int next_seq_id_ = 0;
+  std::map<int, KVSequence> sequences_;
+  std::map<void *, int> block_ref_count_;
+};
+
+}  // namespace op
+}  // namespace nndeploy
+
+#endif /* _NNDEPLOY_OP_KV_CACHE_H_ */
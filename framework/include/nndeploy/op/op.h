@@ -4,6 +4,7 @@
 
 #include "nndeploy/base/any.h"
 #include "nndeploy/base/common.h"
+#include "nndeploy/base/cpu_isa.h"
 #include "nndeploy/base/glic_stl_include.h"
 #include "nndeploy/base/log.h"
 #include "nndeploy/base/macro.h"
@@ -37,7 +38,7 @@ namespace op {
  * ###
  * 未指定max_shape，每次调用reshape函数时，在计算图层面都会：先释放上一次分配的内存，再重新分配内存
  * ## 大语言模型
- * ### kvblock的方式
+ * ### kvblock的方式，KV cache按定长块分配，见op/kv_cache.h与pagedAttention
  */
 class NNDEPLOY_CC_API Op {
  public:
@@ -102,6 +103,13 @@ class NNDEPLOY_CC_API Op {
   base::Status setParallelType(const base::ParallelType &paralle_type);
   base::ParallelType getParallelType();
 
+  /**
+   * @brief 标记输入是否为权重
+   * @note 权重在init之后不再变化，op可以在init中对其做预处理(如预打包)
+   */
+  void setInputWeightFlag(int index, bool flag);
+  bool isInputWeight(int index);
+
   void setInnerFlag(bool flag);
 
   void setInitializedFlag(bool flag);
@@ -167,6 +175,7 @@ class NNDEPLOY_CC_API Op {
   virtual void setWorkspace(void *workspace);
   /**
    * @brief 得到op的flops
+   * # 未设置flops_时按输出元素数估计，用作parallelForWithCost的计算量
    *
    * @return uint64_t
    */
@@ -181,10 +190,36 @@ class NNDEPLOY_CC_API Op {
    */
   virtual base::Status checkOrAllocOutput();
 
+  /**
+   * @brief 输出是否可以作为输入的连续视图，在形状推理之后调用
+   * # 返回true时，outputs_[index]是inputs_[input_index]从offset字节开始的连续区域
+   * # checkOrAllocOutput与TensorPool据此让输出直接引用输入的内存，例如Reshape
+   */
+  virtual bool getOutputView(int index, int &input_index, size_t &offset);
+  /**
+   * @brief 输入是否可以直接存放在输出中，在形状推理之后调用
+   * # 返回true时，inputs_[index]可以是outputs_[output_index]从offset字节开始的连续区域
+   * # TensorPool据此让生产者直接写入输出，例如Concat
+   */
+  virtual bool getInputView(int index, int &output_index, size_t &offset);
+
   virtual base::Status run() = 0;
   virtual base::Status postRun();
 
  protected:
+  /**
+   * @brief 更新op的workspace大小，通常在preRun中调用
+   * @note
+   * # 内部分配的workspace不足时，先释放，在allocateWorkspace中重新分配
+   * # 外部传入的workspace不足时报错
+   */
+  base::Status updateWorkspaceSize(uint64_t size);
+  /**
+   * @brief 单算子模式下没有外部传入的workspace时，由op内部分配
+   * @note 内部分配的workspace在deinit中释放
+   */
+  base::Status allocateWorkspace();
+
   /**
    * @brief op的描述
    * 包含op的类型、名称、输入名称、输出名称、参数
@@ -233,7 +268,7 @@ class NNDEPLOY_CC_API Op {
    * ###
    * 未指定max_shape，每次调用reshape函数时，在计算图层面都会：先释放上一次分配的内存，再重新分配内存
    * ## 大语言模型
-   * ### kvblock的方式
+   * ### kvblock的方式，KV cache按定长块分配，见op/kv_cache.h与pagedAttention
    */
   std::vector<device::Tensor *> outputs_;
 
@@ -251,6 +286,8 @@ class NNDEPLOY_CC_API Op {
   bool is_inner_ = false;
   // 并行类型
   base::ParallelType parallel_type_ = base::kParallelTypeNone;
+  // 输入是否为权重
+  std::vector<bool> is_input_weight_;
   // 是否 可以是inplace op
   bool is_inplace_ = false;
   // 参数&输入是否发生变化
@@ -368,6 +405,57 @@ Op *createOp(base::DeviceType device_type, const std::string &name,
 
 Op *createOp(base::DeviceType device_type, std::shared_ptr<ir::OpDesc> op_desc);
 
+/**
+ * @brief CPU kernel的函数指针，具体签名由各op约定，注册与选择时统一转换
+ */
+using OpKernelFunc = void (*)();
+
+/**
+ * @brief 按(op_type, data_type, isa)注册的CPU kernel
+ */
+struct OpKernelDesc {
+  base::DataType data_type_;
+  base::CpuIsa isa_;
+  OpKernelFunc kernel_;
+};
+
+/**
+ * @brief Get the Global Op Kernel Map object
+ *
+ * @return std::map<ir::OpType, std::vector<OpKernelDesc>>&
+ */
+std::map<ir::OpType, std::vector<OpKernelDesc>> &getGlobalOpKernelMap();
+
+/**
+ * @brief 选择当前CPU可运行的最高级别kernel，没有注册时返回nullptr
+ * # 通常在op的preRun中调用，受base::setCpuIsa的限制
+ */
+NNDEPLOY_CC_API OpKernelFunc selectOpKernel(ir::OpType op_type,
+                                            base::DataType data_type,
+                                            base::CpuIsa *isa = nullptr);
+
+template <typename Func>
+Func getOpKernel(ir::OpType op_type, base::DataType data_type,
+                 base::CpuIsa *isa = nullptr) {
+  return reinterpret_cast<Func>(selectOpKernel(op_type, data_type, isa));
+}
+
+/**
+ * @brief CPU kernel的注册类
+ */
+class OpKernelRegister {
+ public:
+  template <typename Func>
+  explicit OpKernelRegister(ir::OpType op_type, base::DataType data_type,
+                            base::CpuIsa isa, Func kernel) {
+    OpKernelDesc desc;
+    desc.data_type_ = data_type;
+    desc.isa_ = isa;
+    desc.kernel_ = reinterpret_cast<OpKernelFunc>(kernel);
+    getGlobalOpKernelMap()[op_type].push_back(desc);
+  }
+};
+
 using SISOOpFunc =
     std::function<base::Status(device::Tensor *input, device::Tensor *output,
                                std::shared_ptr<base::Param> op_param)>;
@@ -391,6 +479,17 @@ using namespace ir;
   TypeOpRegister<TypeOpCreator<op_class>>                             \
       g_##device_type_code##op_class##_register(device_type_code, op_type);
 
+/**
+ * @brief 注册指定指令集的kernel，同一文件中每行只能注册一个
+ * # kernel可以是模板实例，如binaryLoop<BinaryAdd>
+ */
+#define NNDEPLOY_OP_KERNEL_REGISTER_NAME_IMPL(line) g_op_kernel##line##_register
+#define NNDEPLOY_OP_KERNEL_REGISTER_NAME(line) \
+  NNDEPLOY_OP_KERNEL_REGISTER_NAME_IMPL(line)
+#define REGISTER_OP_ISA_IMPLEMENTION(op_type, data_type, isa, kernel) \
+  static OpKernelRegister NNDEPLOY_OP_KERNEL_REGISTER_NAME(__LINE__)(  \
+      op_type, data_type, isa, &kernel);
+
 }  // namespace op
 }  // namespace nndeploy
 
@@ -13,8 +13,6 @@ class OpAdd : public OpBinary {
  public:
   OpAdd() : OpBinary() {}
   virtual ~OpAdd() {}
-
-  virtual base::Status run();
 };
 
 NNDEPLOY_CC_API base::Status add(device::Tensor *input1, device::Tensor *input2,
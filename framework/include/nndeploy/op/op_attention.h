@@ -0,0 +1,90 @@
+#ifndef _NNDEPLOY_OP_OP_ATTENTION_H_
+#define _NNDEPLOY_OP_OP_ATTENTION_H_
+
+#include "nndeploy/ir/ir.h"
+#include "nndeploy/op/kv_cache.h"
+#include "nndeploy/op/op.h"
+
+namespace nndeploy {
+
+namespace op {
+
+/**
+ * @brief 融合的缩放点积注意力 output = softmax(Q * K^T * scale + mask) * V
+ * # inputs为[Q, K, V, attn_mask]，attn_mask可选
+ * # 4D输入：Q[batch, q_num_heads, q_len, head_size]，
+ *   K[batch, kv_num_heads, kv_len, head_size]，
+ *   V[batch, kv_num_heads, kv_len, v_head_size]，
+ *   output[batch, q_num_heads, q_len, v_head_size]
+ * # 3D输入：Q[batch, q_len, q_num_heads * head_size]，K、V、output同理，
+ *   头数由AttentionParam给出
+ * # q_num_heads为kv_num_heads的整数倍(GQA/MQA)，第h个query头使用第
+ *   h / (q_num_heads / kv_num_heads)个kv头
+ * # attn_mask可广播到[batch, q_num_heads, q_len, kv_len]，float为加性掩码，
+ *   uint8(bool)中0表示不可见
+ * # 不可见任何key的query行输出0
+ */
+class OpAttention : public Op {
+ public:
+  OpAttention() : Op() {}
+  virtual ~OpAttention() {}
+
+  virtual base::Status inferShape();
+
+  /**
+   * @brief Q * K^T与P * V的乘加次数
+   */
+  virtual uint64_t getFlops();
+
+  virtual base::Status run();
+};
+
+/**
+ * @brief attn_mask可以为nullptr
+ */
+NNDEPLOY_CC_API base::Status attention(device::Tensor *q, device::Tensor *k,
+                                       device::Tensor *v,
+                                       device::Tensor *attn_mask,
+                                       std::shared_ptr<ir::AttentionParam> param,
+                                       device::Tensor *output);
+
+/**
+ * @brief 经过KV cache块表读取K/V的注意力，用于自回归解码
+ * # inputs为[Q]，q为[batch, q_num_heads, q_len, head_size]或
+ *   [batch, q_len, q_num_heads * head_size](头数由PagedAttentionParam给出)，
+ *   第i个batch对应序列seq_ids[i]，各序列的kv长度可以不同
+ * # KV cache与seq_ids不属于图的数据，运行前由setKVCache设置
+ * # 当前token的K/V需先由KVCache::appendSlots/writeKV写入
+ * # output与q形状相同
+ */
+class OpPagedAttention : public Op {
+ public:
+  OpPagedAttention() : Op() {}
+  virtual ~OpPagedAttention() {}
+
+  base::Status setKVCache(KVCache *kv_cache, const std::vector<int> &seq_ids);
+
+  virtual base::Status inferShape();
+
+  /**
+   * @brief 按各序列中最长的kv长度估计
+   */
+  virtual uint64_t getFlops();
+
+  virtual base::Status run();
+
+ private:
+  KVCache *kv_cache_ = nullptr;
+  std::vector<int> seq_ids_;
+};
+
+/**
+ * @brief output为空时分配
+ */
+NNDEPLOY_CC_API base::Status pagedAttention(
+    device::Tensor *q, KVCache *kv_cache, const std::vector<int> &seq_ids,
+    std::shared_ptr<ir::PagedAttentionParam> param, device::Tensor *output);
+
+}  // namespace op
+}  // namespace nndeploy
+#endif
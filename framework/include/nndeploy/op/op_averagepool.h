@@ -0,0 +1,34 @@
+
+#ifndef _NNDEPLOY_OP_OP_AVERAGEPOOL_H_
+#define _NNDEPLOY_OP_OP_AVERAGEPOOL_H_
+
+#include "nndeploy/ir/ir.h"
+#include "nndeploy/op/op.h"
+
+namespace nndeploy {
+
+namespace op {
+
+class OpAveragePool : public Op {
+ public:
+  OpAveragePool() : Op() {}
+  virtual ~OpAveragePool() {}
+
+  virtual base::Status inferShape();
+
+  /**
+   * @brief 计算量为输出元素数 * 核大小
+   */
+  virtual uint64_t getFlops();
+
+  virtual base::Status run();
+};
+
+NNDEPLOY_CC_API base::Status averagePool(
+    device::Tensor *input, std::shared_ptr<ir::AveragePoolParam> param,
+    device::Tensor *output);
+
+}  // namespace op
+}  // namespace nndeploy
+
+#endif
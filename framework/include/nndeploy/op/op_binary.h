@@ -8,6 +8,47 @@
 namespace nndeploy {
 namespace op {
 
+/**
+ * @brief 逐元素二元运算的内层循环 c[i] = a[i * a_step] op b[i * b_step]
+ * # a_step、b_step只取0(标量广播)或1(连续)
+ * # c可以与a或b指向同一块内存(inplace)
+ */
+typedef void (*BinaryFunc)(const float *a, int a_step, const float *b,
+                           int b_step, float *c, size_t size);
+
+/**
+ * @brief 获取op_type对应的float内层循环，支持Add/Sub/Mul/Div/Pow
+ * # 从REGISTER_OP_ISA_IMPLEMENTION注册的kernel中选择当前CPU支持的最高级别
+ */
+NNDEPLOY_CC_API BinaryFunc getBinaryFunc(ir::OpType op_type);
+
+/**
+ * @brief 计算numpy风格的广播形状
+ */
+NNDEPLOY_CC_API base::Status getBroadcastShape(const base::IntVector &shape_0,
+                                               const base::IntVector &shape_1,
+                                               base::IntVector &output_shape);
+
+/**
+ * @brief 按广播规则逐元素计算 output = input_0 op input_1
+ * # 每个输入按输出形状计算stride，广播维度的stride为0
+ * # 合并可连续访问的相邻维度，最内层维度交给BinaryFunc
+ * # 外层维度(及过长的最内层维度)通过thread_pool::parallelFor多线程计算，
+ *   cost为调用者算子的getFlops()
+ * # 输出为通道分块格式时按存储形状[N, CB, H, W, block]广播，
+ *   输入须为同样块大小的4D张量或标量，计算后输出补齐的通道写0
+ * # 输入输出支持fp32/fp16/bf16，存在半精度时分段转换为float后调用func
+ */
+NNDEPLOY_CC_API base::Status binaryBroadcast(device::Tensor *input_0,
+                                             device::Tensor *input_1,
+                                             device::Tensor *output,
+                                             BinaryFunc func, uint64_t cost);
+
+/**
+ * @brief 二元逐元素算子的基类
+ * # preRun按(op_type_, 输入的数据类型, CPU指令集)选择内层循环，
+ *   run走binaryBroadcast，半精度的输入使用float的内层循环
+ */
 class OpBinary : public Op {
  public:
   OpBinary() : Op() { is_inplace_ = true; }
@@ -16,6 +57,14 @@ class OpBinary : public Op {
   virtual base::Status inferShape();
 
   virtual base::Status inferDataFormat();
+
+  virtual base::Status preRun();
+
+  virtual base::Status run();
+
+ protected:
+  BinaryFunc func_ = nullptr;
+  base::CpuIsa isa_ = base::kCpuIsaScalar;
 };
 
 }  // namespace op
@@ -0,0 +1,34 @@
+#ifndef _NNDEPLOY_OP_OP_CAST_H_
+#define _NNDEPLOY_OP_OP_CAST_H_
+
+#include "nndeploy/ir/ir.h"
+#include "nndeploy/op/op.h"
+
+namespace nndeploy {
+
+namespace op {
+
+/**
+ * @brief 转换张量的数据类型，输出的数据类型为CastParam::to_
+ * # 支持fp32/fp16/bf16之间的相互转换，类型相同时直接拷贝
+ * # 形状与数据格式与输入相同
+ */
+class OpCast : public Op {
+ public:
+  OpCast() : Op() {}
+  virtual ~OpCast() {}
+
+  virtual base::Status inferDataType();
+
+  virtual base::Status inferShape();
+
+  virtual base::Status run();
+};
+
+NNDEPLOY_CC_API base::Status cast(device::Tensor *input,
+                                  base::DataType data_type,
+                                  device::Tensor *output);
+
+}  // namespace op
+}  // namespace nndeploy
+#endif
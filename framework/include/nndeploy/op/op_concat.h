@@ -15,6 +15,16 @@ class OpConcat : public Op {
 
   virtual base::Status inferShape();
 
+  /**
+   * @brief 拼接轴之前的维度乘积为1时，每个输入都可以直接存放在输出中
+   * # 通道分块格式要求所有输入的通道数都是块大小的整数倍
+   */
+  virtual bool getInputView(int index, int &output_index, size_t &offset);
+
+  /**
+   * @brief 通道分块格式按存储形状[N, CB, H, W, block]拼接，
+   * 沿通道拼接且通道不对齐时逐通道拷贝
+   */
   virtual base::Status run();
 };
 
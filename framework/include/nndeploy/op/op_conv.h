@@ -8,6 +8,22 @@ namespace nndeploy {
 
 namespace op {
 
+/**
+ * @brief 卷积的实现算法
+ */
+enum ConvAlgorithm : int {
+  // im2col + sgemm, 通用实现
+  kConvAlgorithmIm2colGemm = 0x0000,
+  // winograd F(4x4, 3x3), 用于3x3/stride1/dilation1/group1的卷积
+  kConvAlgorithmWinograd,
+  // depthwise 3x3/5x5, stride1/stride2
+  kConvAlgorithmDepthwise,
+  // 1x1/stride1/pad0, 输入直接作为GEMM的B矩阵，不需要im2col
+  kConvAlgorithmPointwise,
+  // 通道分块格式(NC4HW/NC8HW)的直接卷积，支持group1与depthwise
+  kConvAlgorithmBlocked,
+};
+
 class OpConv : public Op {
  public:
   OpConv() : Op() {}
@@ -15,9 +31,56 @@ class OpConv : public Op {
 
   virtual base::Status inferShape();
 
+  /**
+   * @brief 乘加次数，输出元素数 * 每个输出的kernel_h * kernel_w *
+   *        input_c / group
+   */
+  virtual uint64_t getFlops();
+
+  /**
+   * @brief 权重变换，满足条件时将权重变换为winograd域
+   * # 输入为通道分块格式时，将权重打包为按输出通道分块的布局
+   */
+  virtual base::Status init();
+  virtual base::Status deinit();
+
+  /**
+   * @brief 选择卷积算法，并确定所需的workspace大小
+   */
+  virtual base::Status preRun();
+
   virtual base::Status run();
+
+ protected:
+  uint64_t getAlgorithmWorkspaceSize();
+
+  base::Status runIm2colGemm();
+  base::Status runWinograd();
+  base::Status runDepthwise();
+  base::Status runPointwise();
+  base::Status runBlocked();
+
+  base::Status packWinogradWeight();
+  base::Status packBlockedWeight(int block);
+
+ protected:
+  ConvAlgorithm algorithm_ = kConvAlgorithmIm2colGemm;
+  // winograd域的权重 [36, output_c, input_c]
+  device::Tensor *winograd_weight_ = nullptr;
+  // 通道分块格式的权重 [OCB, KH * KW * IC / group, block]
+  device::Tensor *blocked_weight_ = nullptr;
+  int blocked_weight_block_ = 0;
 };
 
+/**
+ * @brief 由输入与权重的形状推导卷积的输出形状，同时补全param中的默认值
+ * # QLinearConv等权重不在第二个输入的卷积共用
+ */
+NNDEPLOY_CC_API base::Status inferConvShape(ir::ConvParam *param,
+                                            const base::IntVector &input_shape,
+                                            const base::IntVector &weight_shape,
+                                            base::IntVector &output_shape);
+
 NNDEPLOY_CC_API base::Status conv(device::Tensor *input, device::Tensor *weight,
                                   device::Tensor *bias,
                                   std::shared_ptr<ir::ConvParam> param,
@@ -0,0 +1,34 @@
+#ifndef _NNDEPLOY_OP_OP_DEQUANTIZE_LINEAR_H_
+#define _NNDEPLOY_OP_OP_DEQUANTIZE_LINEAR_H_
+
+#include "nndeploy/ir/ir.h"
+#include "nndeploy/op/op.h"
+
+namespace nndeploy {
+namespace op {
+
+/**
+ * @brief y = (x - x_zero_point) * x_scale
+ * # 输入依次为[x, x_scale, 可选的x_zero_point]，x为int8/uint8/int32，
+ *   x_scale为标量时按张量反量化，为一维时沿axis_反量化
+ * # 输出为float
+ */
+class OpDequantizeLinear : public Op {
+ public:
+  OpDequantizeLinear() : Op() {}
+  virtual ~OpDequantizeLinear() {}
+
+  virtual base::Status inferDataType();
+  virtual base::Status inferShape();
+
+  virtual base::Status run();
+};
+
+NNDEPLOY_CC_API base::Status dequantizeLinear(
+    device::Tensor *input, device::Tensor *scale, device::Tensor *zero_point,
+    std::shared_ptr<ir::DequantizeLinearParam> param, device::Tensor *output);
+
+}  // namespace op
+}  // namespace nndeploy
+
+#endif
@@ -13,8 +13,6 @@ class OpDiv : public OpBinary {
  public:
   OpDiv() : OpBinary() {}
   virtual ~OpDiv() {}
-
-  virtual base::Status run();
 };
 
 NNDEPLOY_CC_API base::Status div(device::Tensor *input1, device::Tensor *input2,
@@ -15,6 +15,11 @@ class OpFlatten : public Op {
 
   virtual base::Status inferShape();
 
+  /**
+   * @brief 输入连续时，输出直接作为输入的视图
+   */
+  virtual bool getOutputView(int index, int &input_index, size_t &offset);
+
   virtual base::Status run();
 };
 
@@ -0,0 +1,55 @@
+#ifndef _NNDEPLOY_OP_OP_FUSED_ELEMENTWISE_H_
+#define _NNDEPLOY_OP_OP_FUSED_ELEMENTWISE_H_
+
+#include "nndeploy/ir/ir.h"
+#include "nndeploy/op/op.h"
+#include "nndeploy/op/op_binary.h"
+#include "nndeploy/op/vec_math.h"
+
+namespace nndeploy {
+namespace op {
+
+// 一个FusedElementwise最多包含的指令数
+static const int kFusedElementwiseMaxOps = 16;
+
+/**
+ * @brief 融合的逐元素运算链，按FusedElementwiseParam中的指令计算
+ * # 支持的指令：Add/Sub/Mul/Div/Pow、Relu/Sigmoid/Exp/Tanh/Erf/Sqrt
+ * # 输出形状为所有输入的广播形状，最后一条指令的结果为输出
+ * # 按最内层维度分块，每块kFusedElementwiseChunk个元素，所有指令在L1中的
+ *   寄存器上依次计算，输入与输出只读写一次，中间结果不再占用张量
+ * # 寄存器放在workspace中，每个线程一组，在preRun中按线程池的线程数预留
+ * # 通道分块格式时，输入须为相同形状与格式的张量或标量
+ * # 输入输出为同一类型的fp32/fp16/bf16，半精度的输入读取时转换为float
+ */
+class OpFusedElementwise : public Op {
+ public:
+  OpFusedElementwise() : Op() {}
+  virtual ~OpFusedElementwise() {}
+
+  virtual base::Status inferShape();
+
+  virtual base::Status inferDataFormat();
+
+  virtual base::Status preRun();
+
+  /**
+   * @brief 计算量为输出元素数 * 融合的算子数
+   */
+  virtual uint64_t getFlops();
+
+  virtual base::Status run();
+
+ private:
+  std::vector<BinaryFunc> binary_funcs_;
+  std::vector<VecFunc> unary_funcs_;
+};
+
+NNDEPLOY_CC_API base::Status fusedElementwise(
+    std::vector<device::Tensor *> inputs,
+    std::shared_ptr<ir::FusedElementwiseParam> param, device::Tensor *output);
+
+}  // namespace op
+}  // namespace nndeploy
+
+#endif
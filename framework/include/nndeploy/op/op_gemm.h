@@ -15,7 +15,27 @@ class OpGemm : public Op {
 
   virtual base::Status inferShape();
 
+  /**
+   * @brief B为权重时，预打包为sgemm的panel布局
+   * # A、B、C、输出支持fp32/fp16/bf16，半精度的B打包后仍为半精度
+   * # B为int8/int4等量化类型时，B按[N, K]存放(trans_b = 1)，输入依次为
+   *   [A, B, B的scale, 可选的B的zero point, 可选的C]，预打包为qgemm的布局，
+   *   是否有B的zero point由GemmParam::has_b_zero_point_指定
+   */
+  virtual base::Status init();
+  virtual base::Status deinit();
+
+  virtual base::Status preRun();
+
   virtual base::Status run();
+
+ protected:
+  bool isQuantB();
+  base::Status packQuantB();
+
+ protected:
+  // 预打包的B
+  device::Tensor *packed_b_ = nullptr;
 };
 
 NNDEPLOY_CC_API base::Status gemm(device::Tensor *inputs_a,
@@ -24,6 +44,19 @@ NNDEPLOY_CC_API base::Status gemm(device::Tensor *inputs_a,
                                   std::shared_ptr<ir::GemmParam> param,
                                   device::Tensor *output);
 
+/**
+ * @brief B为int8/int4等量化类型的gemm，B按[N, K]存放(trans_b = 1)
+ * # b_zero_point、inputs_c可以为nullptr，param->has_b_zero_point_由b_zero_point
+ *   是否为nullptr决定
+ */
+NNDEPLOY_CC_API base::Status gemm(device::Tensor *inputs_a,
+                                  device::Tensor *inputs_b,
+                                  device::Tensor *b_scale,
+                                  device::Tensor *b_zero_point,
+                                  device::Tensor *inputs_c,
+                                  std::shared_ptr<ir::GemmParam> param,
+                                  device::Tensor *output);
+
 }  // namespace op
 }  // namespace nndeploy
 
@@ -16,6 +16,11 @@ class OpGlobalAveragepool : public Op {
 
   virtual base::Status inferShape();
 
+  /**
+   * @brief 计算量按输入的元素数估计
+   */
+  virtual uint64_t getFlops();
+
   virtual base::Status run();
 };
 
@@ -0,0 +1,56 @@
+#ifndef _NNDEPLOY_OP_OP_GROUP_NORM_H_
+#define _NNDEPLOY_OP_OP_GROUP_NORM_H_
+
+#include "nndeploy/ir/ir.h"
+#include "nndeploy/op/op.h"
+
+namespace nndeploy {
+
+namespace op {
+
+/**
+ * @brief GroupNormalization，input为[N, C, D1, ...]，C个通道分为num_groups_组，
+ * 每组的(C / num_groups_) * D1 * ...个元素一起归一化
+ * # inputs为[input, scale, bias]，bias可选，scale/bias为per-channel(C个)，
+ *   或opset 18的per-group(num_groups_个)
+ * # 每组一遍vecMeanVar(Welford)求均值方差，再按通道把归一化与仿射合并为
+ *   y = x * a + b一遍写出，融合的激活在结果仍在缓存中时原地计算
+ */
+class OpGroupNorm : public Op {
+ public:
+  OpGroupNorm() : Op() { is_inplace_ = true; }
+  virtual ~OpGroupNorm() {}
+
+  virtual base::Status inferShape();
+
+  virtual base::Status run();
+};
+
+/**
+ * @brief InstanceNormalization，即每个通道为一组的GroupNormalization
+ */
+class OpInstanceNorm : public OpGroupNorm {
+ public:
+  OpInstanceNorm() : OpGroupNorm() {}
+  virtual ~OpInstanceNorm() {}
+};
+
+/**
+ * @brief bias可以为nullptr
+ */
+NNDEPLOY_CC_API base::Status groupNorm(
+    device::Tensor *input, device::Tensor *scale, device::Tensor *bias,
+    std::shared_ptr<ir::GroupNormalizationParam> param,
+    device::Tensor *output);
+
+/**
+ * @brief bias可以为nullptr
+ */
+NNDEPLOY_CC_API base::Status instanceNorm(
+    device::Tensor *input, device::Tensor *scale, device::Tensor *bias,
+    std::shared_ptr<ir::InstanceNormalizationParam> param,
+    device::Tensor *output);
+
+}  // namespace op
+}  // namespace nndeploy
+#endif
@@ -0,0 +1,39 @@
+#ifndef _NNDEPLOY_OP_OP_LAYER_NORM_H_
+#define _NNDEPLOY_OP_OP_LAYER_NORM_H_
+
+#include "nndeploy/ir/ir.h"
+#include "nndeploy/op/op.h"
+
+namespace nndeploy {
+
+namespace op {
+
+/**
+ * @brief LayerNormalization，沿LayerNormalizationParam::axis_到最后一维归一化
+ * # inputs为[input, scale, bias]，bias可选，scale/bias的元素数等于归一化的元素数
+ * # outputs为[output, mean, inv_std_dev]，mean与inv_std_dev可选，
+ *   形状为input在axis_及之后的维度置1
+ * # 每行一遍vecMeanVar(Welford)求均值方差，一遍vecNormAffine写出结果，
+ *   融合的激活在结果仍在L1中时原地计算
+ */
+class OpLayerNorm : public Op {
+ public:
+  OpLayerNorm() : Op() { is_inplace_ = true; }
+  virtual ~OpLayerNorm() {}
+
+  virtual base::Status inferShape();
+
+  virtual base::Status run();
+};
+
+/**
+ * @brief bias可以为nullptr
+ */
+NNDEPLOY_CC_API base::Status layerNorm(
+    device::Tensor *input, device::Tensor *scale, device::Tensor *bias,
+    std::shared_ptr<ir::LayerNormalizationParam> param,
+    device::Tensor *output);
+
+}  // namespace op
+}  // namespace nndeploy
+#endif
@@ -15,12 +15,41 @@ class OpMatMul : public Op {
 
   virtual base::Status inferShape();
 
+  /**
+   * @brief B为二维权重时，预打包为sgemm的panel布局
+   * # A、B、输出支持fp32/fp16/bf16，半精度的B打包后仍为半精度
+   * # B为int8/int4等量化类型时，B按[N, K]存放，输入依次为
+   *   [A, B, B的scale, 可选的B的zero point]，预打包为qgemm的布局
+   */
+  virtual base::Status init();
+  virtual base::Status deinit();
+
+  virtual base::Status preRun();
+
   virtual base::Status run();
+
+ protected:
+  bool isQuantB();
+  base::Status packQuantB();
+  base::Status runQuant(int m, int n, int k);
+
+ protected:
+  // 预打包的B
+  device::Tensor *packed_b_ = nullptr;
 };
 
 NNDEPLOY_CC_API base::Status matmul(device::Tensor *inputs_a,
-                                  device::Tensor *inputs_b,
-                                  device::Tensor *output);
+                                    device::Tensor *inputs_b,
+                                    device::Tensor *output);
+
+/**
+ * @brief 仅权重量化的MatMul，B按[N, K]存放，b_zero_point可以为nullptr
+ */
+NNDEPLOY_CC_API base::Status matmul(device::Tensor *inputs_a,
+                                    device::Tensor *inputs_b,
+                                    device::Tensor *b_scale,
+                                    device::Tensor *b_zero_point,
+                                    device::Tensor *output);
 
 }  // namespace op
 }  // namespace nndeploy
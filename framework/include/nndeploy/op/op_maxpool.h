@@ -16,6 +16,11 @@ class OpMaxPool : public Op {
 
   virtual base::Status inferShape();
 
+  /**
+   * @brief 计算量为输出元素数 * 核大小
+   */
+  virtual uint64_t getFlops();
+
   virtual base::Status run();
 };
 
@@ -13,8 +13,6 @@ class OpMul : public OpBinary {
  public:
   OpMul() : OpBinary() {}
   virtual ~OpMul() {}
-
-  virtual base::Status run();
 };
 
 NNDEPLOY_CC_API base::Status mul(device::Tensor *input1, device::Tensor *input2,
@@ -0,0 +1,62 @@
+
+#ifndef _NNDEPLOY_OP_OP_POOL_H_
+#define _NNDEPLOY_OP_OP_POOL_H_
+
+#include "nndeploy/ir/ir.h"
+#include "nndeploy/op/op.h"
+
+namespace nndeploy {
+namespace op {
+
+/**
+ * @brief 2D池化的参数，pads_为[top, left, bottom, right]
+ * # count_include_pad_只对AveragePool有效
+ */
+struct Pool2dParam {
+  int kernel_h_ = 1;
+  int kernel_w_ = 1;
+  int stride_h_ = 1;
+  int stride_w_ = 1;
+  int dilation_h_ = 1;
+  int dilation_w_ = 1;
+  int pads_[4] = {0, 0, 0, 0};
+  bool count_include_pad_ = false;
+};
+
+/**
+ * @brief MaxPool/AveragePool共用的形状推导
+ * # strides、dilations为空时补1，pads为空时按auto_pad计算，结果写回参数
+ * # data_format为NHWC时空间维度为[1, rank - 1)，否则为[2, rank)
+ */
+NNDEPLOY_CC_API base::Status inferPoolShape(
+    const base::IntVector &input_shape, base::DataFormat data_format,
+    const std::string &auto_pad, int ceil_mode,
+    const std::vector<int> &kernel_shape, std::vector<int> &strides,
+    std::vector<int> &pads, std::vector<int> &dilations,
+    base::IntVector &output_shape);
+
+/**
+ * @brief 由ONNX风格的参数得到Pool2dParam，1D池化视为H为1的2D池化
+ */
+NNDEPLOY_CC_API base::Status getPool2dParam(
+    const std::vector<int> &kernel_shape, const std::vector<int> &strides,
+    const std::vector<int> &pads, const std::vector<int> &dilations,
+    bool count_include_pad, Pool2dParam &param);
+
+/**
+ * @brief 2D池化，pool_type为kOpTypeMaxPool或kOpTypeAveragePool
+ * # 输出按行、列分为内部区域与边界区域，内部窗口完全落在输入内，不做越界判断
+ * # NCHW沿输出宽度向量化，按N * C多线程
+ * # NHWC沿通道向量化，按N * OH多线程
+ * # 通道分块格式(NC4HW/NC8HW)视为[N * CB, H, W, block]的NHWC
+ * # cost为调用者算子的getFlops()，决定是否多线程
+ */
+NNDEPLOY_CC_API base::Status pool2d(ir::OpType pool_type,
+                                    device::Tensor *input,
+                                    const Pool2dParam &param,
+                                    device::Tensor *output, uint64_t cost);
+
+}  // namespace op
+}  // namespace nndeploy
+
+#endif
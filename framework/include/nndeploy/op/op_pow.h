@@ -0,0 +1,24 @@
+
+#ifndef _NNDEPLOY_OP_OP_POW_H_
+#define _NNDEPLOY_OP_OP_POW_H_
+
+#include "nndeploy/ir/ir.h"
+#include "nndeploy/op/op.h"
+#include "nndeploy/op/op_binary.h"
+
+namespace nndeploy {
+namespace op {
+
+class OpPow : public OpBinary {
+ public:
+  OpPow() : OpBinary() {}
+  virtual ~OpPow() {}
+};
+
+NNDEPLOY_CC_API base::Status pow(device::Tensor *input1, device::Tensor *input2,
+                                 device::Tensor *output);
+
+}  // namespace op
+}  // namespace nndeploy
+
+#endif
@@ -0,0 +1,56 @@
+#ifndef _NNDEPLOY_OP_OP_QLINEAR_CONV_H_
+#define _NNDEPLOY_OP_OP_QLINEAR_CONV_H_
+
+#include "nndeploy/ir/ir.h"
+#include "nndeploy/op/op.h"
+
+namespace nndeploy {
+namespace op {
+
+/**
+ * @brief int8卷积，与onnx的QLinearConv一致
+ * # 输入依次为[x, x_scale, x_zero_point, w, w_scale, w_zero_point, y_scale,
+ *   y_zero_point, 可选的int32的B]，x、w、y为int8/uint8
+ * # w_scale与w_zero_point为标量或[output_c]，其余scale与zero point为标量
+ * # 参数与Conv共用ConvParam，activate_op_为图优化融合的激活
+ * # im2col按像素连续存放后调用igemm，int32累加，重量化与激活在输出tile上完成
+ */
+class OpQLinearConv : public Op {
+ public:
+  OpQLinearConv() : Op() {}
+  virtual ~OpQLinearConv() {}
+
+  virtual base::Status inferDataType();
+  virtual base::Status inferShape();
+
+  /**
+   * @brief w为权重时，按group预打包为igemm的布局
+   */
+  virtual base::Status init();
+  virtual base::Status deinit();
+
+  /**
+   * @brief 乘加次数，输出元素数 * kernel_h * kernel_w * input_c / group
+   */
+  virtual uint64_t getFlops();
+
+  virtual base::Status run();
+
+ protected:
+  base::Status packWeight();
+
+ protected:
+  // 每个group预打包的w依次存放
+  device::Tensor *packed_w_ = nullptr;
+};
+
+NNDEPLOY_CC_API base::Status qlinearConv(
+    device::Tensor *x, device::Tensor *x_scale, device::Tensor *x_zero_point,
+    device::Tensor *w, device::Tensor *w_scale, device::Tensor *w_zero_point,
+    device::Tensor *y_scale, device::Tensor *y_zero_point, device::Tensor *b,
+    std::shared_ptr<ir::ConvParam> param, device::Tensor *y);
+
+}  // namespace op
+}  // namespace nndeploy
+
+#endif
@@ -0,0 +1,54 @@
+#ifndef _NNDEPLOY_OP_OP_QLINEAR_MAT_MUL_H_
+#define _NNDEPLOY_OP_OP_QLINEAR_MAT_MUL_H_
+
+#include "nndeploy/ir/ir.h"
+#include "nndeploy/op/op.h"
+
+namespace nndeploy {
+namespace op {
+
+/**
+ * @brief int8矩阵乘，与onnx的QLinearMatMul一致
+ * # 输入依次为[a, a_scale, a_zero_point, b, b_scale, b_zero_point, y_scale,
+ *   y_zero_point]，a、b、y为int8/uint8
+ * # b为[K, N]，或与a的batch维度相同的[..., K, N]；b_scale与b_zero_point为
+ *   标量或[N]，其余scale与zero point为标量
+ */
+class OpQLinearMatMul : public Op {
+ public:
+  OpQLinearMatMul() : Op() {}
+  virtual ~OpQLinearMatMul() {}
+
+  virtual base::Status inferDataType();
+  virtual base::Status inferShape();
+
+  /**
+   * @brief b为二维权重时，预打包为igemm的布局
+   */
+  virtual base::Status init();
+  virtual base::Status deinit();
+
+  /**
+   * @brief 乘加次数，输出元素数 * k
+   */
+  virtual uint64_t getFlops();
+
+  virtual base::Status run();
+
+ protected:
+  base::Status packB();
+
+ protected:
+  // 每个batch预打包的b依次存放
+  device::Tensor *packed_b_ = nullptr;
+};
+
+NNDEPLOY_CC_API base::Status qlinearMatmul(
+    device::Tensor *a, device::Tensor *a_scale, device::Tensor *a_zero_point,
+    device::Tensor *b, device::Tensor *b_scale, device::Tensor *b_zero_point,
+    device::Tensor *y_scale, device::Tensor *y_zero_point, device::Tensor *y);
+
+}  // namespace op
+}  // namespace nndeploy
+
+#endif
@@ -0,0 +1,34 @@
+#ifndef _NNDEPLOY_OP_OP_QUANTIZE_LINEAR_H_
+#define _NNDEPLOY_OP_OP_QUANTIZE_LINEAR_H_
+
+#include "nndeploy/ir/ir.h"
+#include "nndeploy/op/op.h"
+
+namespace nndeploy {
+namespace op {
+
+/**
+ * @brief y = saturate(round(x / y_scale) + y_zero_point)
+ * # 输入依次为[x, y_scale, 可选的y_zero_point]，y_scale为标量时按张量量化，
+ *   为一维时沿axis_量化
+ * # 输出的数据类型与y_zero_point相同，没有y_zero_point时为uint8
+ */
+class OpQuantizeLinear : public Op {
+ public:
+  OpQuantizeLinear() : Op() {}
+  virtual ~OpQuantizeLinear() {}
+
+  virtual base::Status inferDataType();
+  virtual base::Status inferShape();
+
+  virtual base::Status run();
+};
+
+NNDEPLOY_CC_API base::Status quantizeLinear(
+    device::Tensor *input, device::Tensor *scale, device::Tensor *zero_point,
+    std::shared_ptr<ir::QuantizeLinearParam> param, device::Tensor *output);
+
+}  // namespace op
+}  // namespace nndeploy
+
+#endif
@@ -0,0 +1,56 @@
+#ifndef _NNDEPLOY_OP_OP_REDUCE_H_
+#define _NNDEPLOY_OP_OP_REDUCE_H_
+
+#include "nndeploy/ir/ir.h"
+#include "nndeploy/op/op.h"
+
+namespace nndeploy {
+
+namespace op {
+
+/**
+ * @brief Reduce系列算子的基类，按op_type_选择归约方式
+ * # inputs为[data, axes]，axes(int64/int32)可选，没有时使用ReduceParam::axes_
+ * # 支持ReduceL1/L2/LogSum/LogSumExp/Max/Mean/Min/Prod/Sum/SumSquare
+ * # 先去掉大小为1的维度、合并相邻的同类维度，每一段连续的归约维度
+ *   看作[outer, reduce, inner]处理一遍：
+ *   inner为1时逐行做SIMD水平归约，否则沿reduce方向逐行纵向累加inner
+ * # 求和类归约按块两两相加(pairwise)，误差随长度对数增长
+ * # 互不相关的输出(outer及inner分块)通过thread_pool::parallelFor多线程计算
+ */
+class OpReduce : public Op {
+ public:
+  OpReduce() : Op() {}
+  virtual ~OpReduce() {}
+
+  virtual base::Status inferShape();
+
+  /**
+   * @brief 计算量按输入的元素数估计
+   */
+  virtual uint64_t getFlops();
+
+  virtual base::Status run();
+};
+
+class OpReduceL1 : public OpReduce {};
+class OpReduceL2 : public OpReduce {};
+class OpReduceLogSum : public OpReduce {};
+class OpReduceLogSumExp : public OpReduce {};
+class OpReduceMax : public OpReduce {};
+class OpReduceMean : public OpReduce {};
+class OpReduceMin : public OpReduce {};
+class OpReduceProd : public OpReduce {};
+class OpReduceSum : public OpReduce {};
+class OpReduceSumSquare : public OpReduce {};
+
+/**
+ * @brief op_type为kOpTypeReduceL1至kOpTypeReduceSumSquare之一
+ */
+NNDEPLOY_CC_API base::Status reduce(ir::OpType op_type, device::Tensor *input,
+                                    std::shared_ptr<ir::ReduceParam> param,
+                                    device::Tensor *output);
+
+}  // namespace op
+}  // namespace nndeploy
+#endif
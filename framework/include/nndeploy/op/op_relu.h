@@ -13,8 +13,6 @@ class OpRelu : public OpUnary {
  public:
   OpRelu() : OpUnary() { is_inplace_ = false; }
   virtual ~OpRelu() {}
-
-  virtual base::Status run();
 };
 
 NNDEPLOY_CC_API base::Status relu(device::Tensor *input,
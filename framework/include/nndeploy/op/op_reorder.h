@@ -0,0 +1,37 @@
+#ifndef _NNDEPLOY_OP_OP_REORDER_H_
+#define _NNDEPLOY_OP_OP_REORDER_H_
+
+#include "nndeploy/ir/ir.h"
+#include "nndeploy/op/op.h"
+
+namespace nndeploy {
+
+namespace op {
+
+/**
+ * @brief 4D张量在NCHW与通道分块格式(NC4HW/NC8HW)之间的转换
+ * # 输出的数据格式为ReorderParam::data_format_，形状与输入相同
+ * # 通道分块格式的存储为[N, ceil(C / block), H, W, block]，
+ *   通道数不是块大小的整数倍时，最后一块多出的通道补0
+ * # 补齐的通道只用于对齐，不会计入有效通道；写出分块格式的算子保持其为0，
+ *   逐元素算子与通道不对齐的Concat在计算后通过zeroChannelPadding重新写0
+ */
+class OpReorder : public Op {
+ public:
+  OpReorder() : Op() {}
+  virtual ~OpReorder() {}
+
+  virtual base::Status inferShape();
+
+  virtual base::Status inferDataFormat();
+
+  virtual base::Status run();
+};
+
+NNDEPLOY_CC_API base::Status reorder(device::Tensor *input,
+                                     base::DataFormat data_format,
+                                     device::Tensor *output);
+
+}  // namespace op
+}  // namespace nndeploy
+#endif
@@ -17,6 +17,11 @@ class OpReshape : public Op {
 
   virtual base::Status inferDataFormat();
 
+  /**
+   * @brief 输入连续时，输出直接作为输入的视图
+   */
+  virtual bool getOutputView(int index, int &input_index, size_t &offset);
+
   virtual base::Status run();
 };
 
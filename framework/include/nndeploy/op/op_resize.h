@@ -8,6 +8,26 @@
 namespace nndeploy {
 namespace op {
 
+/**
+ * @brief 单个轴的插值表
+ * # 输出下标j = sum(weight_[j * taps_ + t] * 输入下标index_[j * taps_ + t])
+ * # outside_[j]为1时输出extrapolation_value(tf_crop_and_resize)
+ */
+struct ResizeAxisTable {
+  int axis_ = 0;
+  int input_size_ = 0;
+  int output_size_ = 0;
+  int taps_ = 1;
+  std::vector<int> index_;
+  std::vector<float> weight_;
+  std::vector<uint8_t> outside_;
+};
+
+/**
+ * @brief Resize
+ * # 每个轴的下标与权重在形状(或scales/roi)变化时计算一次并缓存
+ * # 可分离计算，每个需要插值的轴单独做一遍，中间结果放在workspace中
+ */
 class OpResize : public Op {
  public:
   OpResize() : Op() {}
@@ -16,6 +36,25 @@ class OpResize : public Op {
   virtual base::Status inferShape();
 
   virtual base::Status run();
+
+ protected:
+  /**
+   * @brief 由scales/sizes/roi计算每个轴的scale与roi
+   */
+  base::Status getScalesAndRoi(std::vector<float> &scales,
+                               std::vector<float> &roi);
+  /**
+   * @brief 形状、scales、roi变化时重新计算插值表
+   */
+  base::Status updateTables();
+
+ protected:
+  base::IntVector table_input_shape_;
+  base::IntVector table_output_shape_;
+  std::vector<float> table_scales_;
+  std::vector<float> table_roi_;
+  // 需要插值的轴，按计算顺序排列
+  std::vector<ResizeAxisTable> tables_;
 };
 
 NNDEPLOY_CC_API base::Status resize(device::Tensor *input, device::Tensor *roi,
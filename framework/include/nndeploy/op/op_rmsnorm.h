@@ -8,6 +8,14 @@ namespace nndeploy {
 
 namespace op {
 
+/**
+ * @brief RMSNorm，沿最内层维度归一化
+ * # inputs为[input, weight, residual]，residual可选
+ * # outputs为[output, residual_output]，residual_output可选
+ * # output = h / sqrt(mean(h * h) + eps) * weight
+ * # 无residual时h = input，有residual时h = input + residual，
+ *   存在residual_output时h写入residual_output，供下一层作为残差使用
+ */
 class OpRMSNorm : public Op {
  public:
   OpRMSNorm() : Op() { is_inplace_ = true; }
@@ -18,12 +26,23 @@ class OpRMSNorm : public Op {
   virtual base::Status run();
 };
 
-// TODO: add param，完善inputs的名称
+/**
+ * @brief input1为输入，input2为weight，input3为残差(可以为nullptr)
+ */
 NNDEPLOY_CC_API base::Status rmsNorm(device::Tensor *input1,
                                      device::Tensor *input2,
                                      device::Tensor *input3,
                                      device::Tensor *output);
 
+/**
+ * @brief 残差相加与RMSNorm融合，residual_output = input + residual，
+ * output = rmsNorm(residual_output) * weight
+ */
+NNDEPLOY_CC_API base::Status fusedAddRmsNorm(
+    device::Tensor *input, device::Tensor *residual, device::Tensor *weight,
+    std::shared_ptr<ir::RMSNormParam> param, device::Tensor *output,
+    device::Tensor *residual_output);
+
 }  // namespace op
 }  // namespace nndeploy
 #endif
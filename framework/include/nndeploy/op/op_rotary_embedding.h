@@ -0,0 +1,53 @@
+#ifndef _NNDEPLOY_OP_OP_ROTARY_EMBEDDING_H_
+#define _NNDEPLOY_OP_OP_ROTARY_EMBEDDING_H_
+
+#include "nndeploy/ir/ir.h"
+#include "nndeploy/op/op.h"
+
+namespace nndeploy {
+
+namespace op {
+
+/**
+ * @brief 旋转位置编码(RoPE)，使用预先计算的cos/sin缓存
+ * # inputs为[input, cos_cache, sin_cache, position_ids]，position_ids可选
+ * # input为[batch, num_heads, seq_len, head_size]或
+ *   [batch, seq_len, num_heads * head_size](头数由param给出)，output形状相同
+ * # 有position_ids([batch, seq_len]，int64/int32)时cos/sin缓存为
+ *   [max_position, rotary_dim / 2]，按位置取行；
+ *   没有时为[batch, seq_len, rotary_dim / 2]，或[seq_len, rotary_dim / 2]
+ *   (各batch共用，位置从0开始)
+ * # 每对(x0, x1)旋转为(x0 * cos - x1 * sin, x1 * cos + x0 * sin)，
+ *   rotary_dim之后的维度原样输出
+ */
+class OpRotaryEmbedding : public Op {
+ public:
+  OpRotaryEmbedding() : Op() { is_inplace_ = true; }
+  virtual ~OpRotaryEmbedding() {}
+
+  virtual base::Status inferShape();
+
+  virtual base::Status run();
+};
+
+/**
+ * @brief position_ids可以为nullptr
+ */
+NNDEPLOY_CC_API base::Status rotaryEmbedding(
+    device::Tensor *input, device::Tensor *cos_cache,
+    device::Tensor *sin_cache, device::Tensor *position_ids,
+    std::shared_ptr<ir::RotaryEmbeddingParam> param, device::Tensor *output);
+
+/**
+ * @brief 计算cos/sin缓存，形状为[max_position, rotary_dim / 2]
+ * # 第p行第i列为cos/sin(p * theta^(-2i / rotary_dim))
+ * # cos_cache/sin_cache为空时在host上分配
+ */
+NNDEPLOY_CC_API base::Status computeRotaryCache(int max_position,
+                                                int rotary_dim, float theta,
+                                                device::Tensor *cos_cache,
+                                                device::Tensor *sin_cache);
+
+}  // namespace op
+}  // namespace nndeploy
+#endif
@@ -13,8 +13,6 @@ class OpSigmoid : public OpUnary {
  public:
   OpSigmoid() : OpUnary() { is_inplace_ = true; }
   virtual ~OpSigmoid() {}
-
-  virtual base::Status run();
 };
 
 NNDEPLOY_CC_API base::Status sigmoid(device::Tensor *input,
@@ -15,7 +15,20 @@ class OpSlice : public Op {
 
   virtual base::Status inferShape();
 
+  /**
+   * @brief 切片区域在输入中连续时，输出直接作为输入的视图
+   */
+  virtual bool getOutputView(int index, int &input_index, size_t &offset);
+
   virtual base::Status run();
+
+ private:
+  /**
+   * @brief 按ONNX语义得到每一维的起点、步长与输出形状，未切片的维度起点为0、步长为1
+   */
+  base::Status getSliceInfo(std::vector<int64_t> &starts,
+                            std::vector<int64_t> &steps,
+                            base::IntVector &output_shape);
 };
 
 NNDEPLOY_CC_API base::Status slice(device::Tensor *input,
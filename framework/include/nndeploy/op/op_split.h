@@ -15,7 +15,20 @@ class OpSplit : public Op {
 
   virtual base::Status inferShape();
 
+  /**
+   * @brief 切分轴之前的维度乘积为1时，每个输出都是输入的连续视图
+   */
+  virtual bool getOutputView(int index, int &input_index, size_t &offset);
+
   virtual base::Status run();
+
+ protected:
+  /**
+   * @brief 各输出在切分轴上的大小
+   * # inputs_[1]存在时为int64的split
+   * # 否则按输出个数均分，最后一份可以更小
+   */
+  base::Status getSplitSizes(int axis_size, std::vector<int64_t> &sizes);
 };
 
 NNDEPLOY_CC_API base::Status split(device::Tensor *input,
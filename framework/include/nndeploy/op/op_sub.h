@@ -13,8 +13,6 @@ class OpSub : public OpBinary {
  public:
   OpSub() : OpBinary() {}
   virtual ~OpSub() {}
-
-  virtual base::Status run();
 };
 
 NNDEPLOY_CC_API base::Status sub(device::Tensor *input1, device::Tensor *input2,
@@ -0,0 +1,35 @@
+#ifndef _NNDEPLOY_OP_OP_SWIGLU_H_
+#define _NNDEPLOY_OP_OP_SWIGLU_H_
+
+#include "nndeploy/ir/ir.h"
+#include "nndeploy/op/op.h"
+
+namespace nndeploy {
+
+namespace op {
+
+/**
+ * @brief SwiGLU，output = silu(gate) * up
+ * # inputs为[gate, up]时两者形状相同，output形状与gate相同
+ * # inputs为[input]时沿SwiGLUParam::axis_对半拆分，前一半为gate，
+ *   后一半为up，即gate与up投影合并为一个Gemm的情况
+ */
+class OpSwiGLU : public Op {
+ public:
+  OpSwiGLU() : Op() {}
+  virtual ~OpSwiGLU() {}
+
+  virtual base::Status inferShape();
+
+  virtual base::Status run();
+};
+
+/**
+ * @brief up为nullptr时input沿最后一维对半拆分为gate与up
+ */
+NNDEPLOY_CC_API base::Status swiglu(device::Tensor *gate, device::Tensor *up,
+                                    device::Tensor *output);
+
+}  // namespace op
+}  // namespace nndeploy
+#endif
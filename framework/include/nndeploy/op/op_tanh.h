@@ -0,0 +1,24 @@
+
+#ifndef _NNDEPLOY_OP_OP_TANH_H_
+#define _NNDEPLOY_OP_OP_TANH_H_
+
+#include "nndeploy/ir/ir.h"
+#include "nndeploy/op/op.h"
+#include "nndeploy/op/op_unary.h"
+
+namespace nndeploy {
+namespace op {
+
+class OpTanh : public OpUnary {
+ public:
+  OpTanh() : OpUnary() { is_inplace_ = true; }
+  virtual ~OpTanh() {}
+};
+
+NNDEPLOY_CC_API base::Status tanh(device::Tensor *input,
+                                  device::Tensor *output);
+
+}  // namespace op
+}  // namespace nndeploy
+
+#endif
@@ -0,0 +1,54 @@
+#ifndef _NNDEPLOY_OP_OP_TOPK_H_
+#define _NNDEPLOY_OP_OP_TOPK_H_
+
+#include "nndeploy/ir/ir.h"
+#include "nndeploy/op/op.h"
+
+namespace nndeploy {
+
+namespace op {
+
+/**
+ * @brief TopK，沿TopKParam::axis_取最大(或最小)的k个元素
+ * # inputs为[input, k]，k(int64/int32，一个元素)可选，没有时使用TopKParam::k_
+ * # outputs为[values, indices]，indices为int64，值相同时下标小的在前
+ * # 每行先放入前max(2k, 256)个元素作为候选，以其中第k大的值为阈值，
+ *   其余元素用vecSelectGreater按块预筛选，只有超过阈值的元素进入候选；
+ *   候选达到2k个时用nth_element保留k个并提高阈值
+ * # TopKParam::softmax_为true时values为softmax后的概率，
+ *   只需求max与sum(exp)，不必写出归一化后的整行
+ */
+class OpTopK : public Op {
+ public:
+  OpTopK() : Op() {}
+  virtual ~OpTopK() {}
+
+  virtual base::Status inferDataType();
+
+  virtual base::Status inferShape();
+
+  /**
+   * @brief 计算量按输入的元素数估计，输出只有k个元素
+   */
+  virtual uint64_t getFlops();
+
+  virtual base::Status run();
+};
+
+NNDEPLOY_CC_API base::Status topK(device::Tensor *input,
+                                  std::shared_ptr<ir::TopKParam> param,
+                                  device::Tensor *values,
+                                  device::Tensor *indices);
+
+/**
+ * @brief 融合的softmax + TopK，沿param->axis_取概率最大的k个类别
+ * # 结果与softmax之后再TopK相同，param->softmax_视为true
+ */
+NNDEPLOY_CC_API base::Status softmaxTopK(device::Tensor *input,
+                                         std::shared_ptr<ir::TopKParam> param,
+                                         device::Tensor *values,
+                                         device::Tensor *indices);
+
+}  // namespace op
+}  // namespace nndeploy
+#endif
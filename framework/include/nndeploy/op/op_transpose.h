@@ -8,6 +8,27 @@
 namespace nndeploy {
 namespace op {
 
+/**
+ * @brief 通用的permute引擎 output = input.transpose(perm)
+ * # 只搬运数据，与数据类型无关，element_size支持1/2/4/8字节
+ * # size为1的维度忽略，输入中相邻且在perm中保持顺序的维度合并
+ * # 合并后最内层维度不变时按连续行拷贝
+ * # 否则分解为(批量的)2D转置，4字节元素使用寄存器内的8x8(AVX)/4x4(SSE)
+ *   分块kernel，其余按64x64的cache块计算
+ * # 行块与批量维度通过thread_pool::parallelFor多线程计算，cost为调用者
+ *   算子的getFlops()
+ */
+NNDEPLOY_CC_API base::Status permute(const void *input,
+                                     const base::IntVector &input_shape,
+                                     const std::vector<int> &perm,
+                                     size_t element_size, void *output,
+                                     uint64_t cost);
+
+/**
+ * @brief Transpose
+ * # perm_为空时反转所有维度
+ * # NCHW与NHWC(NCDHW与NDHWC)之间的转置会同时更新输出的data_format
+ */
 class OpTranspose : public Op {
  public:
   OpTranspose() : Op() {}
@@ -24,6 +45,13 @@ NNDEPLOY_CC_API base::Status transpose(
     device::Tensor *input, std::shared_ptr<ir::TransposeParam> param,
     device::Tensor *output);
 
+/**
+ * @brief 数据格式转换，支持NCHW与NHWC、NCDHW与NDHWC互转
+ */
+NNDEPLOY_CC_API base::Status convertDataFormat(device::Tensor *input,
+                                               base::DataFormat data_format,
+                                               device::Tensor *output);
+
 }  // namespace op
 }  // namespace nndeploy
 
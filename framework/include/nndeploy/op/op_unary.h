@@ -4,16 +4,40 @@
 
 #include "nndeploy/ir/ir.h"
 #include "nndeploy/op/op.h"
+#include "nndeploy/op/vec_math.h"
 
 namespace nndeploy {
 namespace op {
 
+/**
+ * @brief 获取op_type对应的逐元素计算函数
+ * # 支持Relu/Sigmoid/Exp/Tanh/Erf/Gelu/Silu/Sqrt
+ */
+NNDEPLOY_CC_API VecFunc getUnaryFunc(ir::OpType op_type);
+
+/**
+ * @brief 逐元素计算 output = func(input)
+ * # 数据量较大时按块通过thread_pool::parallelFor多线程计算，cost为调用者
+ *   算子的getFlops()
+ * # 通道分块格式(NC4HW/NC8HW)按存储的元素数计算，输入输出的块大小须相同，
+ *   计算后输出补齐的通道写0
+ * # 输入输出为同一类型的fp32/fp16/bf16，半精度分段转换为float后计算
+ */
+NNDEPLOY_CC_API base::Status unaryElementwise(device::Tensor *input,
+                                              device::Tensor *output,
+                                              VecFunc func, uint64_t cost);
+
+/**
+ * @brief 一元逐元素算子的基类，run由op_type_选择计算函数后走unaryElementwise
+ */
 class OpUnary : public Op {
  public:
   OpUnary() : Op() { is_inplace_ = true; }
   virtual ~OpUnary() {}
 
   virtual base::Status inferShape();
+
+  virtual base::Status run();
 };
 
 }  // namespace op
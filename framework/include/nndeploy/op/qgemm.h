@@ -0,0 +1,92 @@
+#ifndef _NNDEPLOY_OP_QGEMM_H_
+#define _NNDEPLOY_OP_QGEMM_H_
+
+#include "nndeploy/base/common.h"
+#include "nndeploy/base/glic_stl_include.h"
+#include "nndeploy/base/log.h"
+#include "nndeploy/base/macro.h"
+#include "nndeploy/base/status.h"
+#include "nndeploy/device/tensor.h"
+
+namespace nndeploy {
+namespace op {
+
+/**
+ * @brief 仅权重量化的权重
+ * # 权重按[N, K]存放，每个输出通道沿K连续，沿K每group_size_个元素共用一组
+ *   scale与zero point，w = (q - zero_point) * scale
+ * # 数据类型为int8/uint8，或int4x2/uint4x2(DataType(code, 4, 2))，
+ *   即两个4bit值打包为一个字节，低4位为偶数下标，此时形状为[N, K / 2]
+ * # scales_为[N, K / group_size_]的float
+ * # zero_points_与权重的数据类型相同，int4时同样两个一组打包，为nullptr时零点为0
+ */
+struct QGemmWeight {
+  base::DataType data_type_;
+  int n_ = 0;
+  int k_ = 0;
+  int group_size_ = 0;
+  const void *data_ = nullptr;
+  const float *scales_ = nullptr;
+  const void *zero_points_ = nullptr;
+};
+
+/**
+ * @brief 判断是否为qgemm支持的权重量化数据类型
+ */
+NNDEPLOY_CC_API bool isQGemmDataType(const base::DataType &data_type);
+
+/**
+ * @brief 由量化权重、scale、zero point张量得到QGemmWeight，并检查形状
+ * # weight为[N, K]或打包的[N, K / 2]，scale为[N, K / group_size]
+ */
+NNDEPLOY_CC_API base::Status getQGemmWeight(device::Tensor *weight,
+                                            device::Tensor *scale,
+                                            device::Tensor *zero_point,
+                                            QGemmWeight &qweight);
+
+/**
+ * @brief 预打包量化权重所需的空间大小(字节)
+ */
+NNDEPLOY_CC_API size_t qgemmPackedBSize(const QGemmWeight &qweight);
+
+/**
+ * @brief 预打包量化权重
+ * # 有符号的码值加上偏移转为无符号，zero point与scale转为float
+ * # group_size为32的倍数时，int4在每32个元素内按[0, 16)放低4位、
+ *   [16, 32)放高4位打包，寄存器内用一次移位和掩码即可解出连续的32个码值
+ * # 否则按每个元素一个字节存放，只走标量kernel
+ */
+NNDEPLOY_CC_API base::Status qgemmPackB(const QGemmWeight &qweight,
+                                        void *packed_b);
+
+/**
+ * @brief qgemm所需的workspace大小(字节)
+ */
+NNDEPLOY_CC_API size_t qgemmWorkspaceSize(int m, int n, int k, int group_size);
+
+/**
+ * @brief 仅权重量化的矩阵乘 C[m, n] = alpha * A[m, k] * W[n, k]^T + beta * C
+ *
+ * @param packed_b qgemmPackB打包的权重
+ * @param workspace 至少qgemmWorkspaceSize(m, n, k, group_size)字节
+ * @note
+ * # m较小时(decode)为访存瓶颈，权重在寄存器内反量化，每次读取的权重与多行A复用
+ *   - avx512vnni: A按组动态量化为int8，用vpdpbusd做u8 x s8的整数点积
+ *     A的每组按scale_a = max(|A|) / 127对称量化，单个元素的误差不超过
+ *     scale_a / 2，因此输出与float激活的差不超过
+ *     alpha * sum_g(scale_a[g] / 2 * sum(|W|的组内元素))
+ *   - avx2: 码值转为float后与A做fma
+ *   - 标量参考实现
+ *   avx2与标量路径的A保持float，只有浮点累加顺序的差异
+ *   zero point的贡献为 scale * zero_point * sum(A的组内元素)，每组只算一次
+ * # m较大时(prefill)按N分块反量化为float，再调用sgemm
+ */
+NNDEPLOY_CC_API base::Status qgemm(int m, int n, int k, float alpha,
+                                   float beta, const float *a, int lda,
+                                   const void *packed_b, float *c, int ldc,
+                                   void *workspace);
+
+}  // namespace op
+}  // namespace nndeploy
+
+#endif /* _NNDEPLOY_OP_QGEMM_H_ */
@@ -0,0 +1,142 @@
+
+#ifndef _NNDEPLOY_OP_SGEMM_H_
+#define _NNDEPLOY_OP_SGEMM_H_
+
+#include "nndeploy/base/common.h"
+#include "nndeploy/base/glic_stl_include.h"
+#include "nndeploy/base/log.h"
+#include "nndeploy/base/macro.h"
+#include "nndeploy/base/status.h"
+#include "nndeploy/ir/ir.h"
+
+namespace nndeploy {
+namespace op {
+
+/**
+ * @brief sgemm的参数
+ * # C = alpha * op(A) * op(B) + beta * C
+ * # op(X) = trans ? X^T : X
+ * # beta为0时不读取C的原值
+ * # A、B、C的存储类型支持fp32/fp16/bf16，累加与后处理均为float：
+ *   半精度的A、B在打包时转换为float，半精度的C在workspace中以float
+ *   计算完整的K后再转换写回
+ */
+struct SgemmParam {
+  bool trans_a_ = false;
+  bool trans_b_ = false;
+  float alpha_ = 1.0f;
+  float beta_ = 0.0f;
+  base::DataType a_type_ = base::dataTypeOf<float>();
+  base::DataType b_type_ = base::dataTypeOf<float>();
+  base::DataType c_type_ = base::dataTypeOf<float>();
+};
+
+/**
+ * @brief sgemm输出tile的后处理
+ * # C = act(C + bias)
+ * # bias_按行(M维)广播，为nullptr时不加bias
+ * # activate_op_支持kOpTypeNone/kOpTypeRelu/kOpTypeSigmoid/kOpTypeTanh/
+ *   kOpTypeGelu/kOpTypeSilu
+ * @note 后处理在每个输出tile计算完毕后立即执行，此时tile仍在L1中
+ */
+struct SgemmEpilogue {
+  const float *bias_ = nullptr;
+  ir::OpType activate_op_ = ir::kOpTypeNone;
+};
+
+/**
+ * @brief 输出tile的后处理函数 C[mr, nr] = act(C[mr, nr] + bias[mr])
+ */
+typedef void (*SgemmEpilogueFunc)(float *c, int ldc, int mr, int nr,
+                                  const float *bias);
+
+/**
+ * @brief 选择后处理函数，无bias且无激活时返回nullptr
+ * @note 其他kernel(如winograd的输出变换)也复用该后处理
+ */
+NNDEPLOY_CC_API SgemmEpilogueFunc
+getSgemmEpilogueFunc(const SgemmEpilogue &epilogue);
+
+/**
+ * @brief 判断sgemm是否支持该激活函数的融合
+ */
+NNDEPLOY_CC_API bool isSgemmActivateSupported(ir::OpType activate_op);
+
+/**
+ * @brief sgemm所需的workspace大小(字节)
+ * @note 包含每个线程打包A、B的空间，与当前线程池的线程数相关
+ */
+NNDEPLOY_CC_API size_t sgemmWorkspaceSize(int m, int n, int k);
+
+/**
+ * @brief 按param中的存储类型计算workspace大小(字节)
+ * @note C为半精度时额外包含每个线程的float输出块
+ */
+NNDEPLOY_CC_API size_t sgemmWorkspaceSize(const SgemmParam &param, int m,
+                                          int n, int k);
+
+/**
+ * @brief 预打包B矩阵所需的空间大小(字节)
+ */
+NNDEPLOY_CC_API size_t sgemmPackedBSize(int n, int k);
+
+/**
+ * @brief 预打包B矩阵(通常为权重)
+ * # 打包后的布局为[k / KC][n / NR][KC][NR]，与sgemm内部的打包布局一致
+ * # 常量B只需在init中打包一次，run时调用sgemmPacked
+ */
+NNDEPLOY_CC_API void sgemmPackB(bool trans_b, int n, int k, const float *b,
+                                int ldb, float *packed_b);
+
+/**
+ * @brief 按param.b_type_存储的预打包B所需的空间大小(字节)
+ */
+NNDEPLOY_CC_API size_t sgemmPackedBSize(const SgemmParam &param, int n,
+                                        int k);
+
+/**
+ * @brief 预打包param.b_type_类型的B，打包结果仍为param.b_type_
+ * # 半精度的权重打包后仍占一半的空间，sgemmPacked按panel转换为float
+ */
+NNDEPLOY_CC_API void sgemmPackB(const SgemmParam &param, int n, int k,
+                                const void *b, int ldb, void *packed_b);
+
+/**
+ * @brief 行主序单精度矩阵乘 C = alpha * op(A) * op(B) + beta * C，再执行
+ * epilogue
+ *
+ * @param workspace 至少sgemmWorkspaceSize(param, m, n, k)字节
+ * @note
+ * # 按MC/KC/NC分块，A、B打包为连续的micro panel，保证访存的cache局部性
+ * # micro kernel计算kSgemmMr x kSgemmNr的寄存器tile
+ * # M、N方向的tile通过thread_pool::parallelFor分给多个线程
+ */
+NNDEPLOY_CC_API base::Status sgemm(const SgemmParam &param, int m, int n,
+                                   int k, const void *a, int lda,
+                                   const void *b, int ldb, void *c, int ldc,
+                                   const SgemmEpilogue &epilogue,
+                                   void *workspace);
+
+/**
+ * @brief B已由sgemmPackB预打包的sgemm，忽略param.trans_b_
+ * # packed_b的存储类型为param.b_type_
+ */
+NNDEPLOY_CC_API base::Status sgemmPacked(const SgemmParam &param, int m, int n,
+                                         int k, const void *a, int lda,
+                                         const void *packed_b, void *c,
+                                         int ldc,
+                                         const SgemmEpilogue &epilogue,
+                                         void *workspace);
+
+/**
+ * @brief C[m, n] = A[m, k] * B[k, n]，再执行epilogue
+ */
+NNDEPLOY_CC_API base::Status sgemm(int m, int n, int k, const float *a,
+                                   int lda, const float *b, int ldb, float *c,
+                                   int ldc, const SgemmEpilogue &epilogue,
+                                   void *workspace);
+
+}  // namespace op
+}  // namespace nndeploy
+
+#endif /* _NNDEPLOY_OP_SGEMM_H_ */
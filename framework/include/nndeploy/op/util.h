@@ -35,6 +35,52 @@ bool checkAxesRange(std::vector<int>& axes, int rank);
 int32_t multiplyDims(const base::IntVector& shape, int from,
                      int upto_exclusive);
 
+/**
+ * @brief 创建src从offset字节开始、形状为desc的视图，视图不拥有内存
+ * # src为空、非host设备或越界时返回nullptr，由调用者回退为分配内存
+ */
+NNDEPLOY_CC_API device::Buffer* createBufferView(
+    device::Buffer* src, size_t offset, const device::TensorDesc& desc);
+
+/**
+ * @brief 是否为半精度浮点类型(fp16/bf16)
+ */
+NNDEPLOY_CC_API bool isHalfDataType(const base::DataType& data_type);
+
+/**
+ * @brief 将count个data_type类型的元素转换为float，支持fp32/fp16/bf16
+ * # 半精度存储的kernel在读取时转换，计算与累加仍为float
+ */
+NNDEPLOY_CC_API void convertToFloat(const void* src,
+                                    const base::DataType& data_type,
+                                    float* dst, size_t count);
+
+/**
+ * @brief 将count个float转换为data_type类型，支持fp32/fp16/bf16
+ */
+NNDEPLOY_CC_API void convertFromFloat(const float* src,
+                                      const base::DataType& data_type,
+                                      void* dst, size_t count);
+
+/**
+ * @brief 拷贝rows行、每行row_size字节，src与dst的行间隔分别为src_stride与
+ *        dst_stride字节
+ * # 按字节数切分任务，行数少于线程数时单行也会被切分
+ * # cost为调用者算子的计算量，决定是否并行
+ */
+NNDEPLOY_CC_API void copyRows(void* dst, size_t dst_stride, const void* src,
+                              size_t src_stride, size_t rows, size_t row_size,
+                              uint64_t cost);
+
+/**
+ * @brief 通道分块格式(NC4HW/NC8HW)的通道数不是块大小的整数倍时，
+ *        将最后一块中补齐的通道写0，其余格式直接返回
+ * # 逐元素op连同补齐的通道一起计算，f(0)不一定为0(如Sigmoid、Exp、加标量)，
+ *   写出分块格式的op在计算后调用，保持补齐的通道为0
+ * # cost为调用者算子的计算量，按补齐通道的占比决定是否并行
+ */
+NNDEPLOY_CC_API void zeroChannelPadding(device::Tensor* tensor, uint64_t cost);
+
 }  // namespace op
 }  // namespace nndeploy
 
@@ -0,0 +1,162 @@
+
+#ifndef _NNDEPLOY_OP_VEC_MATH_H_
+#define _NNDEPLOY_OP_VEC_MATH_H_
+
+#include "nndeploy/base/common.h"
+#include "nndeploy/base/glic_stl_include.h"
+#include "nndeploy/base/macro.h"
+
+namespace nndeploy {
+namespace op {
+
+/**
+ * @brief 向量化的超越函数库
+ * # 所有函数计算 y[i] = f(x[i])，x与y可以指向同一块内存(inplace)
+ * # x86上运行时按CPU能力选择AVX-512/AVX2+FMA实现，否则使用标量实现
+ * # 各实现使用相同的多项式近似，结果只在FMA舍入上有差别
+ *
+ * 误差(相对于双精度参考值测量)
+ * # vecExp     : <= 2 ulp，x < -103.97时为0，x > 88.72时为inf
+ * # vecSigmoid : <= 3 ulp
+ * # vecSilu    : <= 4 ulp
+ * # vecTanh    : <= 2 ulp
+ * # vecErf     : <= 3 ulp
+ * # vecGelu    : x >= -1时 <= 5 ulp，x < -1时输出趋于0，相对误差随x * x增大
+ *                (x = -3时约20 ulp，x = -10时约150 ulp)
+ * # 结果或中间值进入非规格化数范围(|x| > 87)时只保证绝对误差
+ */
+typedef void (*VecFunc)(const float *x, float *y, size_t n);
+
+NNDEPLOY_CC_API void vecExp(const float *x, float *y, size_t n);
+
+/**
+ * @brief y = 1 / (1 + exp(-x))
+ */
+NNDEPLOY_CC_API void vecSigmoid(const float *x, float *y, size_t n);
+
+/**
+ * @brief y = x * sigmoid(x)
+ */
+NNDEPLOY_CC_API void vecSilu(const float *x, float *y, size_t n);
+
+NNDEPLOY_CC_API void vecTanh(const float *x, float *y, size_t n);
+
+NNDEPLOY_CC_API void vecErf(const float *x, float *y, size_t n);
+
+/**
+ * @brief y = 0.5 * x * (1 + erf(x / sqrt(2)))
+ */
+NNDEPLOY_CC_API void vecGelu(const float *x, float *y, size_t n);
+
+/**
+ * @brief 返回max(x[0..n))，n为0时返回-inf
+ */
+NNDEPLOY_CC_API float vecMax(const float *x, size_t n);
+
+/**
+ * @brief 返回min(x[0..n))，n为0时返回inf
+ */
+NNDEPLOY_CC_API float vecMin(const float *x, size_t n);
+
+/**
+ * @brief 返回sum(x[0..n))，多路累加，求和顺序与串行累加不同
+ */
+NNDEPLOY_CC_API float vecSum(const float *x, size_t n);
+
+/**
+ * @brief 返回sum(x[i] * x[i])
+ */
+NNDEPLOY_CC_API float vecSquareSum(const float *x, size_t n);
+
+/**
+ * @brief 返回sum(|x[i]|)
+ */
+NNDEPLOY_CC_API float vecAbsSum(const float *x, size_t n);
+
+/**
+ * @brief y = x + r，返回sum(y * y)，y可以与x或r指向同一块内存
+ */
+NNDEPLOY_CC_API float vecAddSquareSum(const float *x, const float *r,
+                                      float *y, size_t n);
+
+/**
+ * @brief y = x * scale * w，y可以与x指向同一块内存
+ */
+NNDEPLOY_CC_API void vecScaleMul(const float *x, float scale, const float *w,
+                                 float *y, size_t n);
+
+/**
+ * @brief 返回sum(x[i] * y[i])
+ */
+NNDEPLOY_CC_API float vecDot(const float *x, const float *y, size_t n);
+
+/**
+ * @brief y = y + a * x
+ */
+NNDEPLOY_CC_API void vecAxpy(float a, const float *x, float *y, size_t n);
+
+/**
+ * @brief y = exp(x - m)，返回sum(y)
+ * @note softmax类计算的核心，exp与求和在一次遍历中完成
+ */
+NNDEPLOY_CC_API float vecExpSum(const float *x, float m, float *y, size_t n);
+
+/**
+ * @brief y = silu(g) * u，SwiGLU的核心，y可以与g或u指向同一块内存
+ */
+NNDEPLOY_CC_API void vecSiluMul(const float *g, const float *u, float *y,
+                                size_t n);
+
+/**
+ * @brief 旋转位置编码，x0与x1为n对坐标的两个分量
+ * # y0 = x0 * c - x1 * s，y1 = x1 * c + x0 * s
+ * # y0/y1可以与x0/x1指向同一块内存
+ */
+NNDEPLOY_CC_API void vecRotary(const float *x0, const float *x1,
+                               const float *c, const float *s, float *y0,
+                               float *y1, size_t n);
+
+/**
+ * @brief 相邻元素成对的旋转位置编码，x与y为2 * n个float，第i对使用c[i]与s[i]
+ */
+NNDEPLOY_CC_API void vecRotaryInterleaved(const float *x, const float *c,
+                                          const float *s, float *y, size_t n);
+
+/**
+ * @brief 按顺序写出x[i] > t的下标i，返回个数，index至少有n个元素
+ * @note TopK的预筛选，阈值较高时绝大部分元素按整块跳过
+ */
+NNDEPLOY_CC_API size_t vecSelectGreater(const float *x, size_t n, float t,
+                                        int32_t *index);
+
+/**
+ * @brief 求x[0..n)的均值与总体方差，n为0时均为0
+ * # 每个lane做Welford累积，最后用Chan公式合并，
+ *   避免E[x * x] - E[x] * E[x]在均值较大时的抵消误差
+ */
+NNDEPLOY_CC_API void vecMeanVar(const float *x, size_t n, float *mean,
+                                float *var);
+
+/**
+ * @brief y = (x - mean) * rstd * gamma + beta，beta可以为nullptr
+ * # y可以与x指向同一块内存
+ */
+NNDEPLOY_CC_API void vecNormAffine(const float *x, float mean, float rstd,
+                                   const float *gamma, const float *beta,
+                                   float *y, size_t n);
+
+/**
+ * @brief y = x * a + b，y可以与x指向同一块内存
+ */
+NNDEPLOY_CC_API void vecScaleShift(const float *x, float a, float b, float *y,
+                                   size_t n);
+
+/**
+ * @brief 当前使用的实现，"avx512"/"avx2"/"scalar"
+ */
+NNDEPLOY_CC_API const char *getVecMathIsa();
+
+}  // namespace op
+}  // namespace nndeploy
+
+#endif /* _NNDEPLOY_OP_VEC_MATH_H_ */
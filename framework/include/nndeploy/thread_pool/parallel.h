@@ -38,6 +38,45 @@ extern NNDEPLOY_CC_API void parallelFor(const base::Range &range,
                                         const ParallelLoopBody &body,
                                         double nstripes = -1.0);
 
+/**
+ * @brief 设置当前线程发起的并行计算最多使用的线程数，<=0表示不限制
+ * # thread_local，Net在run期间设置为自己的线程预算，多个Net并发时互不影响
+ */
+extern NNDEPLOY_CC_API void setThreadBudget(int num);
+
+/**
+ * @brief 当前线程可用的线程数，min(线程池的线程数, 线程预算)，至少为1
+ */
+extern NNDEPLOY_CC_API int getThreadBudget();
+
+/**
+ * @brief 在作用域内设置线程预算，退出时恢复
+ */
+class NNDEPLOY_CC_API ThreadBudgetGuard {
+ public:
+  explicit ThreadBudgetGuard(int num);
+  ~ThreadBudgetGuard();
+
+ private:
+  int last_num_;
+};
+
+// 计算量少于该值时串行计算
+static const uint64_t kParallelMinCost = 64 * 1024;
+// 每个线程至少分到的计算量
+static const uint64_t kParallelGrainCost = 16 * 1024;
+
+/**
+ * @brief 按计算量划分的parallelFor，op的外层循环统一走这里
+ * # cost为整个range的计算量，与Op::getFlops()同一量级，通常取元素数或flops
+ * # cost < kParallelMinCost、range只有一个任务或只有一个线程时直接串行
+ * # 线程数取min(getThreadBudget(), cost / kParallelGrainCost, range大小)，
+ *   range平均切成连续的段，每个线程一段
+ */
+extern NNDEPLOY_CC_API void parallelForWithCost(const base::Range &range,
+                                                const ParallelLoopBody &body,
+                                                uint64_t cost);
+
 }  // namespace thread_pool
 }  // namespace nndeploy
 
@@ -564,6 +564,44 @@ ParallelType stringToParallelType(const std::string &src) {
   }
 }
 
+std::string cpuIsaToString(CpuIsa src) {
+  switch (src) {
+    case kCpuIsaScalar:
+      return "kCpuIsaScalar";
+    case kCpuIsaSse4:
+      return "kCpuIsaSse4";
+    case kCpuIsaAvx2:
+      return "kCpuIsaAvx2";
+    case kCpuIsaAvx512:
+      return "kCpuIsaAvx512";
+    case kCpuIsaAvx512Vnni:
+      return "kCpuIsaAvx512Vnni";
+    case kCpuIsaNeon:
+      return "kCpuIsaNeon";
+    default:
+      return "kCpuIsaNotSupport";
+  }
+}
+
+CpuIsa stringToCpuIsa(const std::string &src) {
+  if (src == "kCpuIsaScalar") {
+    return kCpuIsaScalar;
+  } else if (src == "kCpuIsaSse4") {
+    return kCpuIsaSse4;
+  } else if (src == "kCpuIsaAvx2") {
+    return kCpuIsaAvx2;
+  } else if (src == "kCpuIsaAvx512") {
+    return kCpuIsaAvx512;
+  } else if (src == "kCpuIsaAvx512Vnni") {
+    return kCpuIsaAvx512Vnni;
+  } else if (src == "kCpuIsaNeon") {
+    return kCpuIsaNeon;
+  } else {
+    NNDEPLOY_LOGI("Unsupported cpu isa: %s.\n", src.c_str());
+    return kCpuIsaNotSupport;
+  }
+}
+
 PrecisionType getPrecisionType(DataType data_type) {
   if (data_type.code_ == kDataTypeCodeBFp && data_type.bits_ == 16) {
     return kPrecisionTypeBFp16;
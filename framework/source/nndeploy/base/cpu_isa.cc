@@ -0,0 +1,177 @@
+
+#include "nndeploy/base/cpu_isa.h"
+
+#include "nndeploy/base/log.h"
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || \
+    defined(_M_IX86)
+#define NNDEPLOY_CPU_ISA_X86
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+namespace nndeploy {
+namespace base {
+
+#ifdef NNDEPLOY_CPU_ISA_X86
+static void cpuid(int leaf, int sub_leaf, unsigned int regs[4]) {
+#if defined(_MSC_VER)
+  int info[4] = {0, 0, 0, 0};
+  __cpuidex(info, leaf, sub_leaf);
+  for (int i = 0; i < 4; ++i) {
+    regs[i] = static_cast<unsigned int>(info[i]);
+  }
+#else
+  regs[0] = regs[1] = regs[2] = regs[3] = 0;
+  __cpuid_count(leaf, sub_leaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+}
+
+// 操作系统在上下文切换时保存的寄存器状态(XCR0)
+static uint64_t xgetbv() {
+#if defined(_MSC_VER)
+  return _xgetbv(0);
+#else
+  unsigned int eax = 0;
+  unsigned int edx = 0;
+  __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+  return (static_cast<uint64_t>(edx) << 32) | eax;
+#endif
+}
+
+static CpuIsa detectCpuIsa() {
+  unsigned int regs[4];
+  cpuid(0, 0, regs);
+  unsigned int max_leaf = regs[0];
+  if (max_leaf < 1) {
+    return kCpuIsaScalar;
+  }
+  cpuid(1, 0, regs);
+  unsigned int ecx = regs[2];
+  bool sse4 = (ecx & (1u << 19)) && (ecx & (1u << 20));
+  bool fma = ecx & (1u << 12);
+  bool osxsave = ecx & (1u << 27);
+  bool avx = ecx & (1u << 28);
+  if (!sse4) {
+    return kCpuIsaScalar;
+  }
+  uint64_t xcr0 = osxsave ? xgetbv() : 0;
+  // XMM/YMM状态，以及AVX512的opmask/ZMM状态
+  bool os_avx = (xcr0 & 0x6) == 0x6;
+  bool os_avx512 = (xcr0 & 0xe6) == 0xe6;
+  if (max_leaf < 7 || !avx || !os_avx) {
+    return kCpuIsaSse4;
+  }
+  cpuid(7, 0, regs);
+  unsigned int ebx = regs[1];
+  bool avx2 = ebx & (1u << 5);
+  bool avx512f = ebx & (1u << 16);
+  bool avx512bw = ebx & (1u << 30);
+  bool avx512vl = ebx & (1u << 31);
+  bool avx512vnni = regs[2] & (1u << 11);
+  if (!avx2 || !fma) {
+    return kCpuIsaSse4;
+  }
+  if (avx512f && os_avx512) {
+    if (avx512bw && avx512vl && avx512vnni) {
+      return kCpuIsaAvx512Vnni;
+    }
+    return kCpuIsaAvx512;
+  }
+  return kCpuIsaAvx2;
+}
+
+static bool detectCpuF16c() {
+  unsigned int regs[4];
+  cpuid(0, 0, regs);
+  if (regs[0] < 1) {
+    return false;
+  }
+  cpuid(1, 0, regs);
+  return regs[2] & (1u << 29);
+}
+
+static bool detectCpuAvx512Bf16() {
+  unsigned int regs[4];
+  cpuid(0, 0, regs);
+  if (regs[0] < 7) {
+    return false;
+  }
+  cpuid(7, 0, regs);
+  // 子叶1的EAX第5位
+  if (regs[0] < 1) {
+    return false;
+  }
+  cpuid(7, 1, regs);
+  return regs[0] & (1u << 5);
+}
+#else
+static CpuIsa detectCpuIsa() {
+#if defined(__aarch64__) || defined(_M_ARM64) || defined(__ARM_NEON)
+  return kCpuIsaNeon;
+#else
+  return kCpuIsaScalar;
+#endif
+}
+
+static bool detectCpuF16c() { return false; }
+
+static bool detectCpuAvx512Bf16() { return false; }
+#endif
+
+static std::atomic<int> &getCpuIsaState() {
+  static std::atomic<int> isa(static_cast<int>(getHardwareCpuIsa()));
+  return isa;
+}
+
+CpuIsa getHardwareCpuIsa() {
+  static const CpuIsa isa = detectCpuIsa();
+  return isa;
+}
+
+CpuIsa getCpuIsa() { return static_cast<CpuIsa>(getCpuIsaState().load()); }
+
+static bool isX86CpuIsa(CpuIsa isa) {
+  return isa == kCpuIsaSse4 || isa == kCpuIsaAvx2 || isa == kCpuIsaAvx512 ||
+         isa == kCpuIsaAvx512Vnni;
+}
+
+// limit能否运行isa的kernel
+static bool isCpuIsaCompatible(CpuIsa isa, CpuIsa limit) {
+  if (isa == kCpuIsaScalar || isa == limit) {
+    return true;
+  }
+  return isX86CpuIsa(isa) && isX86CpuIsa(limit) && isa < limit;
+}
+
+Status setCpuIsa(CpuIsa isa) {
+  if (!isCpuIsaCompatible(isa, getHardwareCpuIsa())) {
+    NNDEPLOY_LOGE("cpu isa[%s] is not supported by hardware[%s].\n",
+                  cpuIsaToString(isa).c_str(),
+                  cpuIsaToString(getHardwareCpuIsa()).c_str());
+    return kStatusCodeErrorNotSupport;
+  }
+  getCpuIsaState().store(static_cast<int>(isa));
+  return kStatusCodeOk;
+}
+
+bool isCpuIsaSupported(CpuIsa isa) {
+  return isCpuIsaCompatible(isa, getCpuIsa());
+}
+
+// AVX与AVX512寄存器状态已由对应的指令集级别保证
+bool isCpuF16cSupported() {
+  static const bool f16c = detectCpuF16c();
+  return f16c && isCpuIsaSupported(kCpuIsaAvx2);
+}
+
+bool isCpuAvx512Bf16Supported() {
+  static const bool avx512_bf16 = detectCpuAvx512Bf16();
+  return avx512_bf16 && isCpuIsaSupported(kCpuIsaAvx512);
+}
+
+}  // namespace base
+}  // namespace nndeploy
@@ -1,6 +1,7 @@
 
 #include "nndeploy/base/half.h"
 
+#include "nndeploy/base/cpu_isa.h"
 #include "nndeploy/base/glic_stl_include.h"
 #include "nndeploy/base/half.hpp"
 #include "nndeploy/base/log.h"
@@ -12,6 +13,16 @@
 #endif
 #endif
 
+#if (defined(__x86_64__) || defined(__i386__)) && \
+    (defined(__GNUC__) || defined(__clang__))
+#define NNDEPLOY_HALF_X86
+#include <immintrin.h>
+#define NNDEPLOY_HALF_F16C __attribute__((target("avx2,f16c")))
+#define NNDEPLOY_HALF_AVX2 __attribute__((target("avx2")))
+#define NNDEPLOY_HALF_AVX512_BF16 \
+  __attribute__((target("avx512f,avx512bf16")))
+#endif
+
 using namespace half_float;
 
 typedef half fp16_t;
@@ -28,25 +39,196 @@ namespace base {
 const float MAX_HALF_FLOAT = 65504.0f;
 const float MIN_HALF_FLOAT = -65504.0f;
 
-bool convertFromFloatToBfp16(float *fp32, void *bfp16, int count) {
-  bfp16_t *bfp16ptr = (bfp16_t *)bfp16;
+static void warnHalfOutOfRange() {
+  NNDEPLOY_LOGE("ERROR: value is out of bounds of float16 [%f, %f].\n",
+                MIN_HALF_FLOAT, MAX_HALF_FLOAT);
+}
+
+// 舍入到最近偶数，与F16C指令的结果一致
+static uint16_t floatToFp16Bits(float value) {
+  cvt_32b c;
+  c.f = value;
+  uint16_t sign = (c.u >> 16) & 0x8000;
+  uint32_t abs = c.u & 0x7fffffff;
+  if (abs >= 0x47800000) {
+    // 上溢为inf，NaN保持为quiet NaN
+    return sign | (abs > 0x7f800000 ? 0x7e00 : 0x7c00);
+  }
+  if (abs < 0x38800000) {
+    // 非规格化数：加0.5后由浮点加法完成舍入
+    c.u = abs;
+    c.f += 0.5f;
+    return sign | (uint16_t)(c.u - 0x3f000000);
+  }
+  uint32_t odd = (abs >> 13) & 1;
+  abs += 0xc8000fff + odd;
+  return sign | (uint16_t)(abs >> 13);
+}
+
+// 逐元素转换，也用于向量化实现的尾部
+static bool floatToFp16Scalar(const float *fp32, uint16_t *fp16, int count) {
+  bool exceed = false;
   for (int i = 0; i < count; ++i) {
-    bfp16ptr[i] = fp32[i];
+    float value = fp32[i];
+    if (value > MAX_HALF_FLOAT) {
+      exceed = true;
+      value = MAX_HALF_FLOAT;
+    } else if (value < MIN_HALF_FLOAT) {
+      exceed = true;
+      value = MIN_HALF_FLOAT;
+    }
+    fp16[i] = floatToFp16Bits(value);
   }
+  return exceed;
+}
 
-  return true;
+static void fp16ToFloatScalar(const uint16_t *fp16, float *fp32, int count) {
+  for (int i = 0; i < count; ++i) {
+    fp32[i] = detail::half2float<float>(fp16[i]);
+  }
 }
 
-bool convertFromBfp16ToFloat(void *bfp16, float *fp32, int count) {
-  bfp16_t *bfp16ptr = (bfp16_t *)bfp16;
+static void floatToBfp16Scalar(const float *fp32, uint16_t *bfp16,
+                               int count) {
   for (int i = 0; i < count; ++i) {
-    fp32[i] = float(bfp16ptr[i]);
+    bfp16[i] = bfp16_t(fp32[i]).w;
   }
+}
 
+static void bfp16ToFloatScalar(const uint16_t *bfp16, float *fp32,
+                               int count) {
+  for (int i = 0; i < count; ++i) {
+    cvt_32b c;
+    c.u = (uint32_t)bfp16[i] << 16;
+    fp32[i] = c.f;
+  }
+}
+
+#ifdef NNDEPLOY_HALF_X86
+NNDEPLOY_HALF_F16C static bool floatToFp16F16c(const float *fp32,
+                                               uint16_t *fp16, int count) {
+  const __m256 max_value = _mm256_set1_ps(MAX_HALF_FLOAT);
+  const __m256 min_value = _mm256_set1_ps(MIN_HALF_FLOAT);
+  __m256 exceed = _mm256_setzero_ps();
+  int i = 0;
+  for (; i + 8 <= count; i += 8) {
+    __m256 x = _mm256_loadu_ps(fp32 + i);
+    exceed = _mm256_or_ps(exceed, _mm256_cmp_ps(x, max_value, _CMP_GT_OQ));
+    exceed = _mm256_or_ps(exceed, _mm256_cmp_ps(x, min_value, _CMP_LT_OQ));
+    // x在第二个操作数，NaN原样保留
+    x = _mm256_max_ps(min_value, _mm256_min_ps(max_value, x));
+    __m128i h = _mm256_cvtps_ph(x, _MM_FROUND_TO_NEAREST_INT);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(fp16 + i), h);
+  }
+  bool exceed_tail = floatToFp16Scalar(fp32 + i, fp16 + i, count - i);
+  return _mm256_movemask_ps(exceed) != 0 || exceed_tail;
+}
+
+NNDEPLOY_HALF_F16C static void fp16ToFloatF16c(const uint16_t *fp16,
+                                               float *fp32, int count) {
+  int i = 0;
+  for (; i + 8 <= count; i += 8) {
+    __m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i *>(fp16 + i));
+    _mm256_storeu_ps(fp32 + i, _mm256_cvtph_ps(h));
+  }
+  fp16ToFloatScalar(fp16 + i, fp32 + i, count - i);
+}
+
+// 8个float舍入为bf16，结果在每个32位lane的低16位
+NNDEPLOY_HALF_AVX2 static inline __m256i roundToBfp16Avx2(__m256 x) {
+  const __m256i abs_mask = _mm256_set1_epi32(0x7fffffff);
+  const __m256i inf = _mm256_set1_epi32(0x7f800000);
+  const __m256i bias = _mm256_set1_epi32(0x7fff);
+  const __m256i one = _mm256_set1_epi32(1);
+  const __m256i quiet = _mm256_set1_epi32(0x40);
+  __m256i u = _mm256_castps_si256(x);
+  __m256i lsb = _mm256_and_si256(_mm256_srli_epi32(u, 16), one);
+  __m256i rounded = _mm256_add_epi32(u, _mm256_add_epi32(bias, lsb));
+  rounded = _mm256_srli_epi32(rounded, 16);
+  __m256i nan = _mm256_or_si256(_mm256_srli_epi32(u, 16), quiet);
+  __m256i is_nan = _mm256_cmpgt_epi32(_mm256_and_si256(u, abs_mask), inf);
+  return _mm256_blendv_epi8(rounded, nan, is_nan);
+}
+
+NNDEPLOY_HALF_AVX2 static void floatToBfp16Avx2(const float *fp32,
+                                                uint16_t *bfp16, int count) {
+  int i = 0;
+  for (; i + 16 <= count; i += 16) {
+    __m256i lo = roundToBfp16Avx2(_mm256_loadu_ps(fp32 + i));
+    __m256i hi = roundToBfp16Avx2(_mm256_loadu_ps(fp32 + i + 8));
+    // packus在128位内交错，再按64位重排回原顺序
+    __m256i packed = _mm256_packus_epi32(lo, hi);
+    packed = _mm256_permute4x64_epi64(packed, 0xd8);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(bfp16 + i), packed);
+  }
+  floatToBfp16Scalar(fp32 + i, bfp16 + i, count - i);
+}
+
+// 指令按舍入到最近偶数转换，但总是把非规格化的输入按0处理；
+// 含非规格化数的16个元素改为逐元素转换，结果与其余实现一致
+NNDEPLOY_HALF_AVX512_BF16 static void floatToBfp16Avx512(const float *fp32,
+                                                         uint16_t *bfp16,
+                                                         int count) {
+  const __m512i exponent = _mm512_set1_epi32(0x7f800000);
+  const __m512i mantissa = _mm512_set1_epi32(0x007fffff);
+  int i = 0;
+  for (; i + 16 <= count; i += 16) {
+    __m512 x = _mm512_loadu_ps(fp32 + i);
+    __m512i u = _mm512_castps_si512(x);
+    __mmask16 denormal = _mm512_testn_epi32_mask(u, exponent) &
+                         _mm512_test_epi32_mask(u, mantissa);
+    if (denormal != 0) {
+      floatToBfp16Scalar(fp32 + i, bfp16 + i, 16);
+      continue;
+    }
+    __m256bh h = _mm512_cvtneps_pbh(x);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(bfp16 + i),
+                        reinterpret_cast<__m256i &>(h));
+  }
+  floatToBfp16Scalar(fp32 + i, bfp16 + i, count - i);
+}
+
+NNDEPLOY_HALF_AVX2 static void bfp16ToFloatAvx2(const uint16_t *bfp16,
+                                                float *fp32, int count) {
+  int i = 0;
+  for (; i + 8 <= count; i += 8) {
+    __m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i *>(bfp16 + i));
+    __m256i u = _mm256_slli_epi32(_mm256_cvtepu16_epi32(h), 16);
+    _mm256_storeu_ps(fp32 + i, _mm256_castsi256_ps(u));
+  }
+  bfp16ToFloatScalar(bfp16 + i, fp32 + i, count - i);
+}
+#endif
+
+bool convertFromFloatToBfp16(const float *fp32, void *bfp16, int count) {
+  uint16_t *bfp16ptr = static_cast<uint16_t *>(bfp16);
+#ifdef NNDEPLOY_HALF_X86
+  if (isCpuAvx512Bf16Supported()) {
+    floatToBfp16Avx512(fp32, bfp16ptr, count);
+    return true;
+  }
+  if (isCpuIsaSupported(kCpuIsaAvx2)) {
+    floatToBfp16Avx2(fp32, bfp16ptr, count);
+    return true;
+  }
+#endif
+  floatToBfp16Scalar(fp32, bfp16ptr, count);
+  return true;
+}
+
+bool convertFromBfp16ToFloat(const void *bfp16, float *fp32, int count) {
+  const uint16_t *bfp16ptr = static_cast<const uint16_t *>(bfp16);
+#ifdef NNDEPLOY_HALF_X86
+  if (isCpuIsaSupported(kCpuIsaAvx2)) {
+    bfp16ToFloatAvx2(bfp16ptr, fp32, count);
+    return true;
+  }
+#endif
+  bfp16ToFloatScalar(bfp16ptr, fp32, count);
   return true;
 }
 
-bool convertFromFloatToFp16(float *fp32, void *fp16, int count) {
+bool convertFromFloatToFp16(const float *fp32, void *fp16, int count) {
 #if defined(__APPLE__) && TARGET_OS_IPHONE
   vImage_Buffer halfImage, floatImage;
   {
@@ -58,7 +240,7 @@ bool convertFromFloatToFp16(float *fp32, void *fp16, int count) {
     floatImage.width = count;
     floatImage.height = 1;
     floatImage.rowBytes = count * sizeof(float);
-    floatImage.data = fp32;
+    floatImage.data = const_cast<float *>(fp32);
   }
 
   auto error = vImageConvert_PlanarFtoPlanar16F(&floatImage, &halfImage, 0);
@@ -69,46 +251,33 @@ bool convertFromFloatToFp16(float *fp32, void *fp16, int count) {
     return true;
   }
 #else
-  bool exceedUplimits = false;
-  detail::uint16 *fp16ptr = (detail::uint16 *)fp16;
-  for (int i = 0; i < count; ++i) {
-    if (fp32[i] > MAX_HALF_FLOAT) {
-      exceedUplimits = true;
-      NNDEPLOY_LOGE(
-          "ERROR: the weights[%d]=%f of conv_layer_data is out of bounds "
-          "of float16 max %f. \n",
-          i, fp32[i], MAX_HALF_FLOAT);
-      fp16ptr[i] =
-          detail::float2half<(std::float_round_style)(HALF_ROUND_STYLE)>(
-              MAX_HALF_FLOAT);
-    } else if (fp32[i] < MIN_HALF_FLOAT) {
-      exceedUplimits = true;
-      NNDEPLOY_LOGE(
-          "ERROR: the weights[%d]=%f of conv_layer_data is out of bounds "
-          "of float16 min %f. \n",
-          i, fp32[i], MIN_HALF_FLOAT);
-      fp16ptr[i] =
-          detail::float2half<(std::float_round_style)(HALF_ROUND_STYLE)>(
-              MIN_HALF_FLOAT);
-      ;
-    } else {
-      fp16ptr[i] =
-          detail::float2half<(std::float_round_style)(HALF_ROUND_STYLE)>(
-              fp32[i]);
-    }
+  uint16_t *fp16ptr = static_cast<uint16_t *>(fp16);
+  bool exceed = false;
+#ifdef NNDEPLOY_HALF_X86
+  if (isCpuF16cSupported()) {
+    exceed = floatToFp16F16c(fp32, fp16ptr, count);
+  } else {
+    exceed = floatToFp16Scalar(fp32, fp16ptr, count);
   }
-  return exceedUplimits;
+#else
+  exceed = floatToFp16Scalar(fp32, fp16ptr, count);
+#endif
+  // 截断后的结果仍然可用，只提示一次
+  if (exceed) {
+    warnHalfOutOfRange();
+  }
+  return true;
 #endif
 }
 
-bool convertFromFp16ToFloat(void *fp16, float *fp32, int count) {
+bool convertFromFp16ToFloat(const void *fp16, float *fp32, int count) {
 #if defined(__APPLE__) && TARGET_OS_IPHONE
   vImage_Buffer halfImage, floatImage;
   {
     halfImage.width = count;
     halfImage.height = 1;
     halfImage.rowBytes = count * sizeof(float) / 2;
-    halfImage.data = fp16;
+    halfImage.data = const_cast<void *>(fp16);
 
     floatImage.width = count;
     floatImage.height = 1;
@@ -124,11 +293,14 @@ bool convertFromFp16ToFloat(void *fp16, float *fp32, int count) {
     return true;
   }
 #else
-  detail::uint16 *fp16ptr = (detail::uint16 *)fp16;
-  for (int i = 0; i < count; ++i) {
-    fp32[i] = detail::half2float<float>(fp16ptr[i]);
+  const uint16_t *fp16ptr = static_cast<const uint16_t *>(fp16);
+#ifdef NNDEPLOY_HALF_X86
+  if (isCpuF16cSupported()) {
+    fp16ToFloatF16c(fp16ptr, fp32, count);
+    return true;
   }
-
+#endif
+  fp16ToFloatScalar(fp16ptr, fp32, count);
   return true;
 #endif
 }
@@ -130,5 +130,39 @@ bool isDynamicShape(const IntVector &dims) {
   return false;
 }
 
+int getChannelBlock(DataFormat data_format) {
+  switch (data_format) {
+    case kDataFormatNC4HW:
+      return 4;
+    case kDataFormatNC8HW:
+      return 8;
+    default:
+      return 1;
+  }
+}
+
+size_t shapeCountByDataFormat(const IntVector &dims, DataFormat data_format) {
+  int block = getChannelBlock(data_format);
+  size_t count = 1;
+  for (size_t i = 0; i < dims.size(); ++i) {
+    size_t dim = dims[i];
+    if (i == 1) {
+      dim = (dim + block - 1) / block * block;
+    }
+    count *= dim;
+  }
+  return count;
+}
+
+IntVector shapeNchw2Blocked(const IntVector &dims, int block) {
+  NNDEPLOY_ASSERT(dims.size() == 4 && block > 0);
+  const int n = dims[0];
+  const int c = (dims[1] + block - 1) / block;
+  const int h = dims[2];
+  const int w = dims[3];
+  std::vector<int> blocked = {n, c, h, w, block};
+  return blocked;
+}
+
 }  // namespace base
 }  // namespace nndeploy
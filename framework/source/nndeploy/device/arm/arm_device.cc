@@ -1,5 +1,7 @@
 #include "nndeploy/device/arm/arm_device.h"
 
+#include "nndeploy/base/cpu_isa.h"
+#include "nndeploy/base/shape.h"
 #include "nndeploy/device/buffer.h"
 #include "nndeploy/device/tensor.h"
 
@@ -79,9 +81,8 @@ BufferDesc ArmDevice::toBufferDesc(const TensorDesc &desc,
                                    const base::IntVector &config) {
   size_t size = desc.data_type_.size();
   if (desc.stride_.empty()) {
-    for (int i = 0; i < desc.shape_.size(); ++i) {
-      size *= desc.shape_[i];
-    }
+    // 通道分块格式的通道数向上对齐到块大小
+    size *= base::shapeCountByDataFormat(desc.shape_, desc.data_format_);
   } else {
     size = desc.stride_[0];
   }
@@ -176,7 +177,13 @@ base::Status ArmDevice::upload(Buffer *src, Buffer *dst, int index) {
   }
 }
 
-base::Status ArmDevice::init() { return base::kStatusCodeOk; }
+/**
+ * @brief 检测一次CPU支持的指令集，op在preRun中据此选择kernel
+ */
+base::Status ArmDevice::init() {
+  base::getHardwareCpuIsa();
+  return base::kStatusCodeOk;
+}
 base::Status ArmDevice::deinit() { return base::kStatusCodeOk; }
 
 }  // namespace device
@@ -0,0 +1,102 @@
+
+#include "nndeploy/device/block_memory_pool.h"
+
+#include "nndeploy/device/buffer.h"
+
+namespace nndeploy {
+namespace device {
+
+BlockMemoryPool::BlockMemoryPool(Device *device, size_t block_size,
+                                 int blocks_per_chunk)
+    : MemoryPool(device, base::kMemoryPoolTypeBlock),
+      block_size_(block_size),
+      blocks_per_chunk_(blocks_per_chunk > 0 ? blocks_per_chunk : 1) {}
+
+BlockMemoryPool::~BlockMemoryPool() { this->deinit(); }
+
+base::Status BlockMemoryPool::init(size_t size) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  size_t chunk_size = block_size_ * blocks_per_chunk_;
+  size_t chunk_num = (size + chunk_size - 1) / chunk_size;
+  for (size_t i = chunks_.size(); i < chunk_num; ++i) {
+    base::Status status = allocateChunk();
+    NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk,
+                           "allocateChunk failed");
+  }
+  return base::kStatusCodeOk;
+}
+
+base::Status BlockMemoryPool::deinit() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (free_blocks_.size() != chunks_.size() * blocks_per_chunk_) {
+    NNDEPLOY_LOGE("%d blocks are still in use.\n",
+                  (int)(chunks_.size() * blocks_per_chunk_ -
+                        free_blocks_.size()));
+  }
+  Device *device = getDevice();
+  for (auto chunk : chunks_) {
+    device->deallocate(chunk);
+  }
+  chunks_.clear();
+  free_blocks_.clear();
+  return base::kStatusCodeOk;
+}
+
+void *BlockMemoryPool::allocate(size_t size) {
+  if (size > block_size_) {
+    NNDEPLOY_LOGE("size[%zu] is larger than block size[%zu].\n", size,
+                  block_size_);
+    return nullptr;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (free_blocks_.empty()) {
+    base::Status status = allocateChunk();
+    if (status != base::kStatusCodeOk) {
+      return nullptr;
+    }
+  }
+  void *ptr = free_blocks_.back();
+  free_blocks_.pop_back();
+  return ptr;
+}
+
+void *BlockMemoryPool::allocate(const BufferDesc &desc) {
+  return this->allocate(desc.getRealSize());
+}
+
+void BlockMemoryPool::deallocate(void *ptr) {
+  if (ptr == nullptr) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  free_blocks_.push_back(ptr);
+}
+
+size_t BlockMemoryPool::getBlockSize() { return block_size_; }
+
+int BlockMemoryPool::getBlockNum() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return (int)chunks_.size() * blocks_per_chunk_;
+}
+
+int BlockMemoryPool::getFreeBlockNum() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return (int)free_blocks_.size();
+}
+
+base::Status BlockMemoryPool::allocateChunk() {
+  void *chunk = getDevice()->allocate(block_size_ * blocks_per_chunk_);
+  if (chunk == nullptr) {
+    NNDEPLOY_LOGE("allocate chunk failed.\n");
+    return base::kStatusCodeErrorOutOfMemory;
+  }
+  chunks_.push_back(chunk);
+  // 逆序放入，使块按地址递增的顺序分配
+  for (int i = blocks_per_chunk_ - 1; i >= 0; --i) {
+    free_blocks_.push_back(static_cast<uint8_t *>(chunk) + i * block_size_);
+  }
+  return base::kStatusCodeOk;
+}
+
+}  // namespace device
+}  // namespace nndeploy
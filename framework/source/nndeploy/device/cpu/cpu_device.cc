@@ -1,6 +1,7 @@
 
 #include "nndeploy/device/cpu/cpu_device.h"
 
+#include "nndeploy/base/shape.h"
 #include "nndeploy/device/buffer.h"
 #include "nndeploy/device/tensor.h"
 
@@ -80,9 +81,8 @@ BufferDesc CpuDevice::toBufferDesc(const TensorDesc &desc,
                                    const base::IntVector &config) {
   size_t size = desc.data_type_.size();
   if (desc.stride_.empty()) {
-    for (int i = 0; i < desc.shape_.size(); ++i) {
-      size *= desc.shape_[i];
-    }
+    // 通道分块格式的通道数向上对齐到块大小
+    size *= base::shapeCountByDataFormat(desc.shape_, desc.data_format_);
   } else {
     size = desc.stride_[0];
   }
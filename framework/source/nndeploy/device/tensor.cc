@@ -289,7 +289,9 @@ base::Status Tensor::reshape(base::IntVector shape) {
   //   return base::kStatusCodeErrorInvalidParam;
   // }
   auto device = getDevice();
-  auto buffer_desc = device->toBufferDesc(desc_, base::IntVector());
+  TensorDesc desc = desc_;
+  desc.shape_ = shape;
+  auto buffer_desc = device->toBufferDesc(desc, base::IntVector());
   if (!buffer_->justModify(buffer_desc)) {
     NNDEPLOY_LOGE("buffer_->justModify(buffer_desc) failed.\n");
     return base::kStatusCodeErrorInvalidParam;
@@ -375,6 +377,11 @@ base::Status Tensor::serialize(std::ostream &stream) {
   return base::kStatusCodeOk;
 }
 #if ENABLE_NNDEPLOY_SAFETENSORS_CPP
+std::string Tensor::getSafetensorsInt4Type(const base::DataType &data_type) {
+  return data_type.code_ == base::kDataTypeCodeInt ? "int4" : "uint4";
+}
+#endif
+#if ENABLE_NNDEPLOY_SAFETENSORS_CPP
 base::Status Tensor::safetensorsDtype2Dtype(
     const safetensors::dtype &safetensors_data_type,
     base::DataType &data_type) {
@@ -447,6 +454,8 @@ base::Status Tensor::dtype2SafetensorsDtype(
   switch (data_type.code_) {
     case base::DataTypeCode::kDataTypeCodeUint: {
       switch (data_type.bits_) {
+        // 两个int4打包为一个字节
+        case 4:
         case 8:
           safetensors_data_type = safetensors::kUINT8;
           break;
@@ -467,6 +476,7 @@ base::Status Tensor::dtype2SafetensorsDtype(
 
     case base::DataTypeCode::kDataTypeCodeInt: {
       switch (data_type.bits_) {
+        case 4:
         case 8:
           safetensors_data_type = safetensors::kINT8;
           break;
@@ -567,6 +577,9 @@ base::Status Tensor::serializeToSafetensors(safetensors::safetensors_t &st,
     NNDEPLOY_LOGD("name : %s, data_offsets : %d, %d\n", name_, pre_offsets,
                   pre_offsets + tensor_size);
     st.tensors.insert(name_, std::move(t_t));
+    if (desc_.data_type_.bits_ == 4) {
+      st.metadata.insert(name_, getSafetensorsInt4Type(desc_.data_type_));
+    }
   } else {
     safetensors::tensor_t t_t;
     st.tensors.at(name_, &t_t);
@@ -627,6 +640,19 @@ base::Status Tensor::serializeFromSafetensors(
   st.tensors.at(name_, &t_t);
   safetensorsShape2Shape(t_t.shape, this->desc_.shape_);
   safetensorsDtype2Dtype(t_t.dtype, this->desc_.data_type_);
+  // 打包的int4以U8/I8存放，metadata中记录为{name: "int4"/"uint4"}
+  std::string packed_type;
+  if (st.metadata.at(name_, &packed_type) &&
+      (t_t.dtype == safetensors::kUINT8 || t_t.dtype == safetensors::kINT8)) {
+    if (packed_type == getSafetensorsInt4Type(
+                           base::DataType(base::kDataTypeCodeInt, 4, 2))) {
+      this->desc_.data_type_ = base::DataType(base::kDataTypeCodeInt, 4, 2);
+    } else if (packed_type ==
+               getSafetensorsInt4Type(
+                   base::DataType(base::kDataTypeCodeUint, 4, 2))) {
+      this->desc_.data_type_ = base::DataType(base::kDataTypeCodeUint, 4, 2);
+    }
+  }
   if (this->ref_count_) {
     delete this->ref_count_;
   }
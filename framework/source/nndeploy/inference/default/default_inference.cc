@@ -75,6 +75,11 @@ base::Status DefaultInference::init() {
     NNDEPLOY_LOGE("net_->setTensorPoolType failed!\n");
     return base::kStatusCodeErrorInferenceDefault;
   }
+  status = net_->setThreadNum(default_inference_param->num_thread_);
+  if (status != base::kStatusCodeOk) {
+    NNDEPLOY_LOGE("net_->setThreadNum failed!\n");
+    return base::kStatusCodeErrorInferenceDefault;
+  }
   status = net_->init();
   if (status != base::kStatusCodeOk) {
     NNDEPLOY_LOGE("net_->init failed!\n");
@@ -0,0 +1,45 @@
+
+#include <google/protobuf/message.h>
+#include <google/protobuf/text_format.h>
+
+#include "google/protobuf/io/coded_stream.h"
+#include "google/protobuf/io/zero_copy_stream_impl.h"
+#include "nndeploy/ir/ir.h"
+#include "nndeploy/ir/onnx/onnx_interpret.h"
+
+namespace nndeploy {
+namespace ir {
+
+/**
+ * @brief ONNX Attention(opset 23)
+ * # 不支持past_key/past_value输入与softcap，由OpAttention在推导形状时报错
+ */
+class OnnxAttentionConvert : public OnnxOpConvert {
+ public:
+  OnnxAttentionConvert() : OnnxOpConvert() {}
+  virtual ~OnnxAttentionConvert() {}
+
+  virtual std::shared_ptr<OpDesc> convert(const onnx::NodeProto &onnx_node) {
+    std::shared_ptr<OpDesc> op_desc = std::make_shared<OpDesc>(kOpTypeAttention);
+    OnnxOpConvert::convert(onnx_node, op_desc);
+    AttentionParam *param = (AttentionParam *)(op_desc->op_param_.get());
+    param->is_causal_ =
+        OnnxInterpret::getAttributeInt(onnx_node, "is_causal", 0) != 0;
+    // 没有past_key/past_value时ONNX的causal掩码按左上角对齐
+    param->causal_bottom_right_ = false;
+    param->q_num_heads_ =
+        OnnxInterpret::getAttributeInt(onnx_node, "q_num_heads", 0);
+    param->kv_num_heads_ =
+        OnnxInterpret::getAttributeInt(onnx_node, "kv_num_heads", 0);
+    param->scale_ = OnnxInterpret::getAttributeFloat(onnx_node, "scale", 0.0f);
+    if (OnnxInterpret::getAttributeFloat(onnx_node, "softcap", 0.0f) != 0.0f) {
+      NNDEPLOY_LOGE("Attention softcap is not supported.\n");
+    }
+    return op_desc;
+  };
+};
+
+REGISTER_ONNX_OP_CONVERT_IMPLEMENTION("Attention", OnnxAttentionConvert);
+
+}  // namespace ir
+}  // namespace nndeploy
@@ -0,0 +1,58 @@
+#include <google/protobuf/message.h>
+#include <google/protobuf/text_format.h>
+
+#include "google/protobuf/io/coded_stream.h"
+#include "google/protobuf/io/zero_copy_stream_impl.h"
+#include "nndeploy/ir/ir.h"
+#include "nndeploy/ir/onnx/onnx_interpret.h"
+
+namespace nndeploy {
+namespace ir {
+
+/**
+ * @brief ONNX GroupNormalization
+ * # opset 18的scale/bias为per-group，opset 21起为per-channel，由算子按元素数区分
+ */
+class OnnxGroupNormalizationConvert : public OnnxOpConvert {
+ public:
+  OnnxGroupNormalizationConvert() : OnnxOpConvert() {}
+  virtual ~OnnxGroupNormalizationConvert() {}
+
+  virtual std::shared_ptr<OpDesc> convert(const onnx::NodeProto &onnx_node) {
+    std::shared_ptr<OpDesc> op_desc =
+        std::make_shared<OpDesc>(kOpTypeGroupNormalization);
+    OnnxOpConvert::convert(onnx_node, op_desc);
+    GroupNormalizationParam *param =
+        (GroupNormalizationParam *)(op_desc->op_param_.get());
+    param->num_groups_ =
+        OnnxInterpret::getAttributeInt(onnx_node, "num_groups", 1);
+    param->epsilon_ =
+        OnnxInterpret::getAttributeFloat(onnx_node, "epsilon", 1e-5f);
+    return op_desc;
+  };
+};
+
+class OnnxInstanceNormalizationConvert : public OnnxOpConvert {
+ public:
+  OnnxInstanceNormalizationConvert() : OnnxOpConvert() {}
+  virtual ~OnnxInstanceNormalizationConvert() {}
+
+  virtual std::shared_ptr<OpDesc> convert(const onnx::NodeProto &onnx_node) {
+    std::shared_ptr<OpDesc> op_desc =
+        std::make_shared<OpDesc>(kOpTypeInstanceNormalization);
+    OnnxOpConvert::convert(onnx_node, op_desc);
+    InstanceNormalizationParam *param =
+        (InstanceNormalizationParam *)(op_desc->op_param_.get());
+    param->epsilon_ =
+        OnnxInterpret::getAttributeFloat(onnx_node, "epsilon", 1e-5f);
+    return op_desc;
+  };
+};
+
+REGISTER_ONNX_OP_CONVERT_IMPLEMENTION("GroupNormalization",
+                                      OnnxGroupNormalizationConvert);
+REGISTER_ONNX_OP_CONVERT_IMPLEMENTION("InstanceNormalization",
+                                      OnnxInstanceNormalizationConvert);
+
+}  // namespace ir
+}  // namespace nndeploy
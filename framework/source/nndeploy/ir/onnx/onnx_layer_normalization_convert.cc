@@ -0,0 +1,38 @@
+#include <google/protobuf/message.h>
+#include <google/protobuf/text_format.h>
+
+#include "google/protobuf/io/coded_stream.h"
+#include "google/protobuf/io/zero_copy_stream_impl.h"
+#include "nndeploy/ir/ir.h"
+#include "nndeploy/ir/onnx/onnx_interpret.h"
+
+namespace nndeploy {
+namespace ir {
+
+/**
+ * @brief ONNX LayerNormalization(opset 17)
+ * # stash_type只影响中间结果的精度，CPU实现始终以float计算
+ */
+class OnnxLayerNormalizationConvert : public OnnxOpConvert {
+ public:
+  OnnxLayerNormalizationConvert() : OnnxOpConvert() {}
+  virtual ~OnnxLayerNormalizationConvert() {}
+
+  virtual std::shared_ptr<OpDesc> convert(const onnx::NodeProto &onnx_node) {
+    std::shared_ptr<OpDesc> op_desc =
+        std::make_shared<OpDesc>(kOpTypeLayerNormalization);
+    OnnxOpConvert::convert(onnx_node, op_desc);
+    LayerNormalizationParam *param =
+        (LayerNormalizationParam *)(op_desc->op_param_.get());
+    param->axis_ = OnnxInterpret::getAttributeInt(onnx_node, "axis", -1);
+    param->epsilon_ =
+        OnnxInterpret::getAttributeFloat(onnx_node, "epsilon", 1e-5f);
+    return op_desc;
+  };
+};
+
+REGISTER_ONNX_OP_CONVERT_IMPLEMENTION("LayerNormalization",
+                                      OnnxLayerNormalizationConvert);
+
+}  // namespace ir
+}  // namespace nndeploy
@@ -23,7 +23,8 @@ class OnnxMaxPoolConvert : public OnnxOpConvert {
         OnnxInterpret::getAttributeString(onnx_node, "auto_pad", "NOTSET");
     param->ceil_mode_ =
         OnnxInterpret::getAttributeInt(onnx_node, "ceil_mode", 0);
-    OnnxInterpret::getAttributeIntVector(onnx_node, "dilations");
+    param->dilations_ =
+        OnnxInterpret::getAttributeIntVector(onnx_node, "dilations");
     param->kernel_shape_ =
         OnnxInterpret::getAttributeIntVector(onnx_node, "kernel_shape");
     param->pads_ = OnnxInterpret::getAttributeIntVector(onnx_node, "pads");
@@ -0,0 +1,61 @@
+#include <google/protobuf/message.h>
+#include <google/protobuf/text_format.h>
+
+#include "google/protobuf/io/coded_stream.h"
+#include "google/protobuf/io/zero_copy_stream_impl.h"
+#include "nndeploy/ir/ir.h"
+#include "nndeploy/ir/onnx/onnx_interpret.h"
+
+namespace nndeploy {
+namespace ir {
+
+/**
+ * @brief ONNX Reduce系列算子，共用ReduceParam
+ * # 旧版本axes为属性，ReduceSum(opset 13)及其余算子(opset 18)起为第二个输入，
+ *   输入保留在OpDesc中，由算子在运行时读取
+ */
+template <OpType op_type>
+class OnnxReduceConvert : public OnnxOpConvert {
+ public:
+  OnnxReduceConvert() : OnnxOpConvert() {}
+  virtual ~OnnxReduceConvert() {}
+
+  virtual std::shared_ptr<OpDesc> convert(const onnx::NodeProto &onnx_node) {
+    std::shared_ptr<OpDesc> op_desc = std::make_shared<OpDesc>(op_type);
+    OnnxOpConvert::convert(onnx_node, op_desc);
+    ReduceParam *param = (ReduceParam *)(op_desc->op_param_.get());
+    param->axes_ = OnnxInterpret::getAttributeIntVector(onnx_node, "axes");
+    param->keepdims_ =
+        OnnxInterpret::getAttributeInt(onnx_node, "keepdims", 1);
+    param->noop_with_empty_axes_ =
+        OnnxInterpret::getAttributeInt(onnx_node, "noop_with_empty_axes", 0);
+    return op_desc;
+  };
+};
+
+typedef OnnxReduceConvert<kOpTypeReduceL1> OnnxReduceL1Convert;
+typedef OnnxReduceConvert<kOpTypeReduceL2> OnnxReduceL2Convert;
+typedef OnnxReduceConvert<kOpTypeReduceLogSum> OnnxReduceLogSumConvert;
+typedef OnnxReduceConvert<kOpTypeReduceLogSumExp> OnnxReduceLogSumExpConvert;
+typedef OnnxReduceConvert<kOpTypeReduceMax> OnnxReduceMaxConvert;
+typedef OnnxReduceConvert<kOpTypeReduceMean> OnnxReduceMeanConvert;
+typedef OnnxReduceConvert<kOpTypeReduceMin> OnnxReduceMinConvert;
+typedef OnnxReduceConvert<kOpTypeReduceProd> OnnxReduceProdConvert;
+typedef OnnxReduceConvert<kOpTypeReduceSum> OnnxReduceSumConvert;
+typedef OnnxReduceConvert<kOpTypeReduceSumSquare> OnnxReduceSumSquareConvert;
+
+REGISTER_ONNX_OP_CONVERT_IMPLEMENTION("ReduceL1", OnnxReduceL1Convert);
+REGISTER_ONNX_OP_CONVERT_IMPLEMENTION("ReduceL2", OnnxReduceL2Convert);
+REGISTER_ONNX_OP_CONVERT_IMPLEMENTION("ReduceLogSum", OnnxReduceLogSumConvert);
+REGISTER_ONNX_OP_CONVERT_IMPLEMENTION("ReduceLogSumExp",
+                                      OnnxReduceLogSumExpConvert);
+REGISTER_ONNX_OP_CONVERT_IMPLEMENTION("ReduceMax", OnnxReduceMaxConvert);
+REGISTER_ONNX_OP_CONVERT_IMPLEMENTION("ReduceMean", OnnxReduceMeanConvert);
+REGISTER_ONNX_OP_CONVERT_IMPLEMENTION("ReduceMin", OnnxReduceMinConvert);
+REGISTER_ONNX_OP_CONVERT_IMPLEMENTION("ReduceProd", OnnxReduceProdConvert);
+REGISTER_ONNX_OP_CONVERT_IMPLEMENTION("ReduceSum", OnnxReduceSumConvert);
+REGISTER_ONNX_OP_CONVERT_IMPLEMENTION("ReduceSumSquare",
+                                      OnnxReduceSumSquareConvert);
+
+}  // namespace ir
+}  // namespace nndeploy
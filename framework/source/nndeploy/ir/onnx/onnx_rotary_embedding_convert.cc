@@ -0,0 +1,41 @@
+#include <google/protobuf/message.h>
+#include <google/protobuf/text_format.h>
+
+#include "google/protobuf/io/coded_stream.h"
+#include "google/protobuf/io/zero_copy_stream_impl.h"
+#include "nndeploy/ir/ir.h"
+#include "nndeploy/ir/onnx/onnx_interpret.h"
+
+namespace nndeploy {
+namespace ir {
+
+/**
+ * @brief ONNX RotaryEmbedding(opset 23)
+ * # 输入顺序[X, cos_cache, sin_cache, position_ids]与OpRotaryEmbedding一致
+ */
+class OnnxRotaryEmbeddingConvert : public OnnxOpConvert {
+ public:
+  OnnxRotaryEmbeddingConvert() : OnnxOpConvert() {}
+  virtual ~OnnxRotaryEmbeddingConvert() {}
+
+  virtual std::shared_ptr<OpDesc> convert(const onnx::NodeProto &onnx_node) {
+    std::shared_ptr<OpDesc> op_desc =
+        std::make_shared<OpDesc>(kOpTypeRotaryEmbedding);
+    OnnxOpConvert::convert(onnx_node, op_desc);
+    RotaryEmbeddingParam *param =
+        (RotaryEmbeddingParam *)(op_desc->op_param_.get());
+    param->interleaved_ =
+        OnnxInterpret::getAttributeInt(onnx_node, "interleaved", 0) != 0;
+    param->rotary_embedding_dim_ =
+        OnnxInterpret::getAttributeInt(onnx_node, "rotary_embedding_dim", 0);
+    param->num_heads_ =
+        OnnxInterpret::getAttributeInt(onnx_node, "num_heads", 0);
+    return op_desc;
+  };
+};
+
+REGISTER_ONNX_OP_CONVERT_IMPLEMENTION("RotaryEmbedding",
+                                      OnnxRotaryEmbeddingConvert);
+
+}  // namespace ir
+}  // namespace nndeploy
@@ -0,0 +1,36 @@
+#include <google/protobuf/message.h>
+#include <google/protobuf/text_format.h>
+
+#include "google/protobuf/io/coded_stream.h"
+#include "google/protobuf/io/zero_copy_stream_impl.h"
+#include "nndeploy/ir/ir.h"
+#include "nndeploy/ir/onnx/onnx_interpret.h"
+
+namespace nndeploy {
+namespace ir {
+
+/**
+ * @brief ONNX TopK
+ * # opset 10起k为第二个输入，由算子在运行时读取；opset 1中k为属性
+ */
+class OnnxTopKConvert : public OnnxOpConvert {
+ public:
+  OnnxTopKConvert() : OnnxOpConvert() {}
+  virtual ~OnnxTopKConvert() {}
+
+  virtual std::shared_ptr<OpDesc> convert(const onnx::NodeProto &onnx_node) {
+    std::shared_ptr<OpDesc> op_desc = std::make_shared<OpDesc>(kOpTypeTopK);
+    OnnxOpConvert::convert(onnx_node, op_desc);
+    TopKParam *param = (TopKParam *)(op_desc->op_param_.get());
+    param->axis_ = OnnxInterpret::getAttributeInt(onnx_node, "axis", -1);
+    param->largest_ = OnnxInterpret::getAttributeInt(onnx_node, "largest", 1);
+    param->sorted_ = OnnxInterpret::getAttributeInt(onnx_node, "sorted", 1);
+    param->k_ = OnnxInterpret::getAttributeInt(onnx_node, "k", 1);
+    return op_desc;
+  };
+};
+
+REGISTER_ONNX_OP_CONVERT_IMPLEMENTION("TopK", OnnxTopKConvert);
+
+}  // namespace ir
+}  // namespace nndeploy
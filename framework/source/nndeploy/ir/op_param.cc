@@ -147,6 +147,16 @@ static const std::map<OpType, std::string> g_optype_string_map = {
     {kOpTypeWhere, "kOpTypeWhere"},
     {kOpTypeXor, "kOpTypeXor"},
     {kOpTypeRMSNorm, "kOpTypeRMSNorm"},
+    {kOpTypeAttention, "kOpTypeAttention"},
+    {kOpTypePagedAttention, "kOpTypePagedAttention"},
+    {kOpTypeRotaryEmbedding, "kOpTypeRotaryEmbedding"},
+    {kOpTypeSwiGLU, "kOpTypeSwiGLU"},
+    {kOpTypeLayerNormalization, "kOpTypeLayerNormalization"},
+    {kOpTypeGroupNormalization, "kOpTypeGroupNormalization"},
+    {kOpTypeGelu, "kOpTypeGelu"},
+    {kOpTypeSilu, "kOpTypeSilu"},
+    {kOpTypeReorder, "kOpTypeReorder"},
+    {kOpTypeFusedElementwise, "kOpTypeFusedElementwise"},
     {kOpTypeNone, "kOpTypeNone"},
 };
 
@@ -293,6 +303,16 @@ static const std::map<std::string, OpType> g_string_optype_map = {
     {"kOpTypeWhere", kOpTypeWhere},
     {"kOpTypeXor", kOpTypeXor},
     {"kOpTypeRMSNorm", kOpTypeRMSNorm},
+    {"kOpTypeAttention", kOpTypeAttention},
+    {"kOpTypePagedAttention", kOpTypePagedAttention},
+    {"kOpTypeRotaryEmbedding", kOpTypeRotaryEmbedding},
+    {"kOpTypeSwiGLU", kOpTypeSwiGLU},
+    {"kOpTypeLayerNormalization", kOpTypeLayerNormalization},
+    {"kOpTypeGroupNormalization", kOpTypeGroupNormalization},
+    {"kOpTypeGelu", kOpTypeGelu},
+    {"kOpTypeSilu", kOpTypeSilu},
+    {"kOpTypeReorder", kOpTypeReorder},
+    {"kOpTypeFusedElementwise", kOpTypeFusedElementwise},
     {"kOpTypeNone", kOpTypeNone},
 };
 
@@ -336,6 +356,9 @@ std::shared_ptr<base::Param> createOpParam(OpType type) {
   return temp;
 }
 
+// AveragePool 算子参数类的注册函数
+REGISTER_OP_PARAM_IMPLEMENTION(kOpTypeAveragePool, AveragePoolParam);
+
 // Concat 算子参数类的注册函数
 REGISTER_OP_PARAM_IMPLEMENTION(kOpTypeConcat, ConcatParam);
 
@@ -365,6 +388,55 @@ REGISTER_OP_PARAM_IMPLEMENTION(kOpTypeTranspose, TransposeParam);
 // RMSNorm 算子参数类的注册函数
 REGISTER_OP_PARAM_IMPLEMENTION(kOpTypeRMSNorm, RMSNormParam);
 
+// Attention 算子参数类的注册函数
+REGISTER_OP_PARAM_IMPLEMENTION(kOpTypeAttention, AttentionParam);
+
+// PagedAttention 算子参数类的注册函数
+REGISTER_OP_PARAM_IMPLEMENTION(kOpTypePagedAttention, PagedAttentionParam);
+
+// RotaryEmbedding 算子参数类的注册函数
+REGISTER_OP_PARAM_IMPLEMENTION(kOpTypeRotaryEmbedding, RotaryEmbeddingParam);
+
+// SwiGLU 算子参数类的注册函数
+REGISTER_OP_PARAM_IMPLEMENTION(kOpTypeSwiGLU, SwiGLUParam);
+
+// Reduce 系列算子参数类的注册函数
+REGISTER_OP_PARAM_IMPLEMENTION(kOpTypeReduceL1, ReduceParam);
+REGISTER_OP_PARAM_IMPLEMENTION(kOpTypeReduceL2, ReduceParam);
+REGISTER_OP_PARAM_IMPLEMENTION(kOpTypeReduceLogSum, ReduceParam);
+REGISTER_OP_PARAM_IMPLEMENTION(kOpTypeReduceLogSumExp, ReduceParam);
+REGISTER_OP_PARAM_IMPLEMENTION(kOpTypeReduceMax, ReduceParam);
+REGISTER_OP_PARAM_IMPLEMENTION(kOpTypeReduceMean, ReduceParam);
+REGISTER_OP_PARAM_IMPLEMENTION(kOpTypeReduceMin, ReduceParam);
+REGISTER_OP_PARAM_IMPLEMENTION(kOpTypeReduceProd, ReduceParam);
+REGISTER_OP_PARAM_IMPLEMENTION(kOpTypeReduceSum, ReduceParam);
+REGISTER_OP_PARAM_IMPLEMENTION(kOpTypeReduceSumSquare, ReduceParam);
+
+// TopK 算子参数类的注册函数
+REGISTER_OP_PARAM_IMPLEMENTION(kOpTypeTopK, TopKParam);
+
+// LayerNormalization 算子参数类的注册函数
+REGISTER_OP_PARAM_IMPLEMENTION(kOpTypeLayerNormalization,
+                               LayerNormalizationParam);
+
+// InstanceNormalization 算子参数类的注册函数
+REGISTER_OP_PARAM_IMPLEMENTION(kOpTypeInstanceNormalization,
+                               InstanceNormalizationParam);
+
+// GroupNormalization 算子参数类的注册函数
+REGISTER_OP_PARAM_IMPLEMENTION(kOpTypeGroupNormalization,
+                               GroupNormalizationParam);
+
+// Reorder 算子参数类的注册函数
+REGISTER_OP_PARAM_IMPLEMENTION(kOpTypeReorder, ReorderParam);
+
+// Cast 算子参数类的注册函数
+REGISTER_OP_PARAM_IMPLEMENTION(kOpTypeCast, CastParam);
+
+// FusedElementwise 算子参数类的注册函数
+REGISTER_OP_PARAM_IMPLEMENTION(kOpTypeFusedElementwise,
+                               FusedElementwiseParam);
+
 REGISTER_OP_PARAM_IMPLEMENTION(kOpTypeBatchNormalization,
                                BatchNormalizationParam);
 
@@ -372,5 +444,13 @@ REGISTER_OP_PARAM_IMPLEMENTION(kOpTypeFlatten, FlattenParam);
 
 REGISTER_OP_PARAM_IMPLEMENTION(kOpTypeGemm, GemmParam);
 
+// QLinearConv与Conv共用参数，激活可由图优化融合进来
+REGISTER_OP_PARAM_IMPLEMENTION(kOpTypeQLinearConv, ConvParam);
+
+REGISTER_OP_PARAM_IMPLEMENTION(kOpTypeQuantizeLinear, QuantizeLinearParam);
+
+REGISTER_OP_PARAM_IMPLEMENTION(kOpTypeDequantizeLinear,
+                               DequantizeLinearParam);
+
 }  // namespace ir
 }  // namespace nndeploy
\ No newline at end of file
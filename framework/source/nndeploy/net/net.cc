@@ -4,6 +4,7 @@
 #include "nndeploy/net/optimizer.h"
 #include "nndeploy/net/runtime.h"
 #include "nndeploy/op/op.h"
+#include "nndeploy/thread_pool/parallel.h"
 
 namespace nndeploy {
 namespace net {
@@ -44,6 +45,14 @@ base::Status Net::setTensorPoolType(TensorPoolType tensor_pool_type) {
   return status;
 }
 
+base::Status Net::setThreadNum(int num_thread) {
+  base::Status status = base::kStatusCodeOk;
+  num_thread_ = num_thread;
+  return status;
+}
+
+int Net::getThreadNum() { return num_thread_; }
+
 TensorWrapper *Net::createTensor(const std::string &name, bool is_weight) {
   device::Tensor *tensor = new device::Tensor(name);
   TensorWrapper *tensor_wrapper = new TensorWrapper();
@@ -279,6 +288,11 @@ base::Status Net::init() {
                            "graph optimizer failed!");
   }
 
+  // 线程池按所有Net中最大的线程预算创建，各Net运行时再按自己的预算使用
+  if (num_thread_ > thread_pool::getThreadNum()) {
+    thread_pool::setThreadNum(num_thread_);
+  }
+
   status = this->runtime();
   NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "graph runtime failed!");
 
@@ -324,6 +338,7 @@ base::Status Net::deinit() {
 
   enable_pass_.clear();
   disable_pass_.clear();
+  precision_allow_list_.clear();
 
   return status;
 }
@@ -432,6 +447,7 @@ base::Status Net::preRun() {
   // NNDEPLOY_LOGI("#######################\n");
   // NNDEPLOY_LOGI("Op run Phase!\n");
   // NNDEPLOY_LOGI("#######################\n");
+  thread_pool::ThreadBudgetGuard guard(num_thread_);
   status = runtime_->preRun();
   NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "runtime preRun failed!");
 
@@ -483,6 +499,7 @@ base::Status Net::run() {
   // NNDEPLOY_LOGI("#######################\n");
   // NNDEPLOY_LOGI("Op run Phase!\n");
   // NNDEPLOY_LOGI("#######################\n");
+  thread_pool::ThreadBudgetGuard guard(num_thread_);
   status = runtime_->run();
   NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "runtime run failed!");
 
@@ -773,6 +790,15 @@ base::Status Net::setDisablePass(std::set<OptPassType> disable_pass) {
   return base::kStatusCodeOk;
 }
 
+base::Status Net::setPrecisionAllowList(std::set<ir::OpType> allow_list) {
+  precision_allow_list_ = allow_list;
+  return base::kStatusCodeOk;
+}
+
+std::set<ir::OpType> Net::getPrecisionAllowList() {
+  return precision_allow_list_;
+}
+
 Net *createNet(ir::ModelDesc *model_desc, base::DeviceType device_type,
                base::PrecisionType precision_type) {
   Net *net = new Net();
@@ -0,0 +1,384 @@
+#include "nndeploy/net/optimizer/convert_precision.h"
+
+#include "nndeploy/base/half.h"
+#include "nndeploy/base/shape.h"
+#include "nndeploy/net/net.h"
+#include "nndeploy/op/util.h"
+
+namespace nndeploy {
+namespace net {
+
+static bool isConstant(TensorWrapper* tensor) {
+  return tensor != nullptr && tensor->is_weight_ &&
+         tensor->tensor_ != nullptr && tensor->tensor_->getData() != nullptr;
+}
+
+// float且不是通道分块格式的张量
+static bool isPlainFloat(device::Tensor* tensor) {
+  return tensor != nullptr &&
+         tensor->getDataType() == base::dataTypeOf<float>() &&
+         base::getChannelBlock(tensor->getDataFormat()) <= 1;
+}
+
+static const std::set<ir::OpType>& getDefaultAllowList() {
+  static const std::set<ir::OpType> allow_list = {
+      ir::kOpTypeMatMul,  ir::kOpTypeGemm,    ir::kOpTypeRelu,
+      ir::kOpTypeSigmoid, ir::kOpTypeTanh,    ir::kOpTypeExp,
+      ir::kOpTypeErf,     ir::kOpTypeGelu,    ir::kOpTypeSilu,
+      ir::kOpTypeSqrt,    ir::kOpTypeAdd,     ir::kOpTypeSub,
+      ir::kOpTypeMul,     ir::kOpTypeDiv,     ir::kOpTypeReshape,
+      ir::kOpTypeFlatten, ir::kOpTypeTranspose, ir::kOpTypeConcat,
+      ir::kOpTypeSplit,   ir::kOpTypeSlice,   ir::kOpTypeFusedElementwise};
+  return allow_list;
+}
+
+// 只搬运数据的op，单独转换没有收益
+static bool isDataMovement(ir::OpType op_type) {
+  switch (op_type) {
+    case ir::kOpTypeReshape:
+    case ir::kOpTypeFlatten:
+    case ir::kOpTypeTranspose:
+    case ir::kOpTypeConcat:
+    case ir::kOpTypeSplit:
+    case ir::kOpTypeSlice:
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * @brief op的输入输出满足转换条件时返回true，indices为需要转换的float输入
+ */
+static bool getFloatInputs(OpWrapper* op_wrapper, std::vector<int>& indices) {
+  op::Op* op = op_wrapper->op_;
+  ir::OpType op_type = op->getOpType();
+  std::vector<device::Tensor*> inputs = op->getAllInput();
+  std::vector<device::Tensor*> outputs = op->getAllOutput();
+  indices.clear();
+  if (inputs.empty() || outputs.empty() || !isPlainFloat(inputs[0])) {
+    return false;
+  }
+  for (auto output : outputs) {
+    if (!isPlainFloat(output)) {
+      return false;
+    }
+  }
+  // FusedElementwise的输入输出须为同一类型
+  bool is_all_float = op_type == ir::kOpTypeMatMul ||
+                      op_type == ir::kOpTypeGemm ||
+                      op_type == ir::kOpTypeFusedElementwise;
+  for (int i = 0; i < inputs.size(); ++i) {
+    if (inputs[i] == nullptr) {
+      continue;
+    }
+    if (base::getChannelBlock(inputs[i]->getDataFormat()) > 1) {
+      return false;
+    }
+    if (isPlainFloat(inputs[i])) {
+      indices.push_back(i);
+    } else if (is_all_float) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static bool isProducedBy(TensorWrapper* tensor,
+                         const std::set<OpWrapper*>& region) {
+  return !tensor->producers_.empty() &&
+         region.find(tensor->producers_[0]) != region.end();
+}
+
+// 将op中所有为from的输入替换为to
+static void replaceInput(OpWrapper* op_wrapper, device::Tensor* from,
+                         device::Tensor* to) {
+  std::vector<device::Tensor*> inputs = op_wrapper->op_->getAllInput();
+  for (int i = 0; i < inputs.size(); ++i) {
+    if (inputs[i] == from) {
+      op_wrapper->op_->setInput(to, i);
+    }
+  }
+}
+
+// 与Net::createTensor相同，张量由Net管理
+static TensorWrapper* createTensor(
+    std::vector<TensorWrapper*>& tensor_repository, const std::string& name) {
+  TensorWrapper* tensor_wrapper = new TensorWrapper();
+  tensor_wrapper->is_external_ = false;
+  tensor_wrapper->tensor_ = new device::Tensor(name);
+  tensor_wrapper->name_ = name;
+  tensor_repository.emplace_back(tensor_wrapper);
+  return tensor_wrapper;
+}
+
+// 将float常量转换为data_type类型的新张量
+static device::Tensor* createHalfConstant(device::Tensor* tensor,
+                                          base::DataType data_type,
+                                          const std::string& name) {
+  device::TensorDesc desc = tensor->getDesc();
+  desc.data_type_ = data_type;
+  device::Tensor* half =
+      new device::Tensor(tensor->getDevice(), desc, name);
+  op::convertFromFloat(static_cast<const float*>(tensor->getData()),
+                       data_type, half->getData(),
+                       base::shapeCountByDataFormat(desc.shape_,
+                                                    desc.data_format_));
+  return half;
+}
+
+ConvertPrecision::ConvertPrecision() : OptPass("ConvertPrecision") {}
+
+ConvertPrecision::~ConvertPrecision() {}
+
+OpWrapper* ConvertPrecision::createCast(
+    std::vector<OpWrapper*>& op_repository, OpWrapper* reference,
+    TensorWrapper* input, TensorWrapper* output, base::DataType data_type) {
+  std::string name = output->name_ + ".cast";
+  std::vector<std::string> input_names = {input->name_};
+  std::vector<std::string> output_names = {output->name_};
+  auto param = std::make_shared<ir::CastParam>();
+  param->to_ = data_type;
+  op::Op* op =
+      op::createOp(reference->op_->getDeviceType(), name, ir::kOpTypeCast,
+                   input_names, output_names, param);
+  if (op == nullptr) {
+    NNDEPLOY_LOGE("create Cast failed.\n");
+    return nullptr;
+  }
+  op->setPrecisionType(reference->op_->getPrecisionType());
+  op->setParallelType(reference->op_->getParallelType());
+  op->setInnerFlag(true);
+  op->setInput(input->tensor_, 0);
+  op->setOutput(output->tensor_, 0);
+
+  OpWrapper* op_wrapper = new OpWrapper();
+  op_wrapper->is_external_ = false;
+  op_wrapper->op_ = op;
+  op_wrapper->name_ = name;
+  op_repository.emplace_back(op_wrapper);
+  insertUnique(input->consumers_, op_wrapper);
+  insertUnique(output->producers_, op_wrapper);
+  return op_wrapper;
+}
+
+/*
+ * @brief 转换为半精度存储
+ * @note
+ * 1. 按拓扑序选取op，见类的说明
+ * 2. 选取的op的float输入转换为半精度
+ * 3. 输出被未选取的op使用或是模型的输出时，插入Cast转回float
+ * 4. 重新计算前驱与后继、拓扑排序，并重新推导数据类型、形状与数据格式
+ */
+base::Status ConvertPrecision::optimize(
+    std::vector<TensorWrapper*>& tensor_repository,
+    std::vector<OpWrapper*>& op_repository, int begin_op_index) {
+  base::Status status = base::kStatusCodeOk;
+  base::PrecisionType precision_type = net_->getPrecisionType();
+  base::DataType half_type;
+  std::string suffix;
+  if (precision_type == base::kPrecisionTypeFp16) {
+    half_type = base::dataTypeOf<half_float::half>();
+    suffix = ".fp16";
+  } else if (precision_type == base::kPrecisionTypeBFp16) {
+    half_type = base::dataTypeOf<base::bfp16_t>();
+    suffix = ".bf16";
+  } else {
+    return status;
+  }
+  std::set<ir::OpType> allow_list = net_->getPrecisionAllowList();
+  if (allow_list.empty()) {
+    allow_list = getDefaultAllowList();
+  }
+
+  // 1. 选取op，op_repository已按拓扑序排列
+  std::vector<OpWrapper*> region_ops;
+  std::set<OpWrapper*> region;
+  std::map<OpWrapper*, std::vector<int>> float_inputs;
+  for (auto op_wrapper : op_repository) {
+    ir::OpType op_type = op_wrapper->op_->getOpType();
+    std::vector<int> indices;
+    if (allow_list.find(op_type) == allow_list.end() ||
+        !getFloatInputs(op_wrapper, indices)) {
+      continue;
+    }
+    bool is_selected = !isDataMovement(op_type);
+    for (int i : indices) {
+      TensorWrapper* input =
+          findTensorWrapper(tensor_repository, op_wrapper->op_->getInput(i));
+      if (input == nullptr) {
+        is_selected = false;
+        break;
+      }
+      is_selected = is_selected || isProducedBy(input, region);
+    }
+    if (is_selected) {
+      region_ops.emplace_back(op_wrapper);
+      region.insert(op_wrapper);
+      float_inputs[op_wrapper] = indices;
+    }
+  }
+  if (region_ops.empty()) {
+    return status;
+  }
+
+  // 2. 选取的op的float输入转换为半精度
+  std::map<TensorWrapper*, TensorWrapper*> to_half;
+  for (auto op_wrapper : region_ops) {
+    for (int i : float_inputs[op_wrapper]) {
+      TensorWrapper* input =
+          findTensorWrapper(tensor_repository, op_wrapper->op_->getInput(i));
+      if (input == nullptr || isProducedBy(input, region)) {
+        continue;
+      }
+      TensorWrapper*& half = to_half[input];
+      if (half != nullptr) {
+        continue;
+      }
+      std::vector<OpWrapper*> inner;
+      std::vector<OpWrapper*> outer;
+      for (auto consumer : input->consumers_) {
+        if (region.find(consumer) != region.end()) {
+          inner.emplace_back(consumer);
+        } else {
+          outer.emplace_back(consumer);
+        }
+      }
+      device::Tensor* previous = input->tensor_;
+      if (isConstant(input) && outer.empty()) {
+        // 常量只被选取的op使用，原地替换
+        device::Tensor* tensor =
+            createHalfConstant(previous, half_type, previous->getName());
+        auto net_inputs = net_->getAllInput();
+        auto it = std::find(net_inputs.begin(), net_inputs.end(), previous);
+        if (it != net_inputs.end()) {
+          net_->setInput(tensor, it - net_inputs.begin());
+        }
+        input->tensor_ = tensor;
+        for (auto consumer : inner) {
+          replaceInput(consumer, previous, tensor);
+        }
+        if (!input->is_external_) {
+          delete previous;
+        }
+        input->is_external_ = false;
+        half = input;
+        continue;
+      }
+      input->consumers_ = outer;
+      if (isConstant(input)) {
+        // 常量另存一份半精度
+        half = new TensorWrapper();
+        half->is_external_ = false;
+        half->is_weight_ = true;
+        half->name_ = input->name_ + suffix;
+        half->tensor_ = createHalfConstant(previous, half_type, half->name_);
+        tensor_repository.emplace_back(half);
+      } else {
+        half = createTensor(tensor_repository, input->name_ + suffix);
+        if (createCast(op_repository, op_wrapper, input, half, half_type) ==
+            nullptr) {
+          return base::kStatusCodeErrorNotImplement;
+        }
+      }
+      for (auto consumer : inner) {
+        replaceInput(consumer, previous, half->tensor_);
+        insertUnique(half->consumers_, consumer);
+      }
+    }
+  }
+
+  // 3. 选取的op的输出转回float
+  for (auto op_wrapper : region_ops) {
+    std::vector<device::Tensor*> outputs = op_wrapper->op_->getAllOutput();
+    for (int i = 0; i < outputs.size(); ++i) {
+      TensorWrapper* output = findTensorWrapper(tensor_repository, outputs[i]);
+      if (output == nullptr) {
+        continue;
+      }
+      std::vector<OpWrapper*> inner;
+      std::vector<OpWrapper*> outer;
+      for (auto consumer : output->consumers_) {
+        if (region.find(consumer) != region.end()) {
+          inner.emplace_back(consumer);
+        } else {
+          outer.emplace_back(consumer);
+        }
+      }
+      TensorWrapper* cast_input = output;
+      TensorWrapper* cast_output = nullptr;
+      if (output->input_output_type_ == kOutput ||
+          output->input_output_type_ == kBoth) {
+        // 模型的输出保持为原张量
+        TensorWrapper* half =
+            createTensor(tensor_repository, output->name_ + suffix);
+        op_wrapper->op_->setOutput(half->tensor_, i);
+        half->producers_.emplace_back(op_wrapper);
+        for (auto consumer : inner) {
+          replaceInput(consumer, output->tensor_, half->tensor_);
+          insertUnique(half->consumers_, consumer);
+        }
+        output->producers_.clear();
+        output->consumers_ = outer;
+        cast_input = half;
+        cast_output = output;
+      } else if (!outer.empty()) {
+        TensorWrapper* single =
+            createTensor(tensor_repository, output->name_ + ".fp32");
+        for (auto consumer : outer) {
+          replaceInput(consumer, output->tensor_, single->tensor_);
+          insertUnique(single->consumers_, consumer);
+        }
+        output->consumers_ = inner;
+        cast_output = single;
+      } else {
+        continue;
+      }
+      if (createCast(op_repository, op_wrapper, cast_input, cast_output,
+                     base::dataTypeOf<float>()) == nullptr) {
+        return base::kStatusCodeErrorNotImplement;
+      }
+    }
+  }
+
+  // 4. 重新计算前驱与后继，并拓扑排序
+  for (auto op_wrapper : op_repository) {
+    op_wrapper->predecessors_.clear();
+    op_wrapper->successors_.clear();
+  }
+  for (auto tensor_wrapper : tensor_repository) {
+    for (auto producer : tensor_wrapper->producers_) {
+      for (auto consumer : tensor_wrapper->consumers_) {
+        insertUnique(consumer->predecessors_, producer);
+        insertUnique(producer->successors_, consumer);
+      }
+    }
+  }
+  setColor(op_repository, base::kNodeColorWhite);
+  std::vector<OpWrapper*> topo_op_repository;
+  status = topoSortDFS(op_repository, topo_op_repository);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "topoSortDFS failed!");
+  op_repository = topo_op_repository;
+
+  for (auto op_wrapper : op_repository) {
+    op::Op* op = op_wrapper->op_;
+    status = op->inferDataType();
+    NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk,
+                           "inferDataType failed!");
+    status = op->inferShape();
+    NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "inferShape failed!");
+    status = op->inferDataFormat();
+    NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk,
+                           "inferDataFormat failed!");
+  }
+
+  return status;
+}
+
+TypeOptPassRegister<TypeOptPassCreator<ConvertPrecision>>
+    g_convert_precision_register(base::kDeviceTypeCodeCpu,
+                                 kOptPassTypeConvertPrecision,
+                                 /*优化等级 */ 8);
+
+}  // namespace net
+}  // namespace nndeploy
@@ -0,0 +1,300 @@
+#include "nndeploy/net/optimizer/fuse_elementwise.h"
+
+#include "nndeploy/base/shape.h"
+#include "nndeploy/net/net.h"
+#include "nndeploy/op/op_fused_elementwise.h"
+#include "nndeploy/op/util.h"
+
+namespace nndeploy {
+namespace net {
+
+static bool isElementwise(ir::OpType op_type, size_t num_inputs) {
+  switch (op_type) {
+    case ir::kOpTypeAdd:
+    case ir::kOpTypeSub:
+    case ir::kOpTypeMul:
+    case ir::kOpTypeDiv:
+    case ir::kOpTypePow:
+      return num_inputs == 2;
+    case ir::kOpTypeRelu:
+    case ir::kOpTypeSigmoid:
+    case ir::kOpTypeExp:
+    case ir::kOpTypeTanh:
+    case ir::kOpTypeErf:
+    case ir::kOpTypeGelu:
+    case ir::kOpTypeSilu:
+    case ir::kOpTypeSqrt:
+      return num_inputs == 1;
+    default:
+      return false;
+  }
+}
+
+static bool isBlocked(device::Tensor* tensor) {
+  return base::getChannelBlock(tensor->getDataFormat()) > 1;
+}
+
+/**
+ * @brief op可以加入以reference为输出的融合组
+ * # op的输出与reference的形状、数据格式、数据类型相同
+ * # 输入与reference的数据类型相同，通道分块格式时为相同的张量或标量
+ */
+static bool isFusible(OpWrapper* op_wrapper, device::Tensor* reference) {
+  op::Op* op = op_wrapper->op_;
+  std::vector<device::Tensor*> inputs = op->getAllInput();
+  std::vector<device::Tensor*> outputs = op->getAllOutput();
+  if (!isElementwise(op->getOpType(), inputs.size()) || outputs.size() != 1) {
+    return false;
+  }
+  base::DataType data_type = reference->getDataType();
+  if (data_type != base::dataTypeOf<float>() &&
+      !op::isHalfDataType(data_type)) {
+    return false;
+  }
+  device::Tensor* output = outputs[0];
+  if (output->getShape().empty() ||
+      output->getShape() != reference->getShape() ||
+      output->getDataFormat() != reference->getDataFormat() ||
+      output->getDataType() != data_type) {
+    return false;
+  }
+  for (auto input : inputs) {
+    if (input == nullptr || input->getDataType() != data_type) {
+      return false;
+    }
+    if (!isBlocked(output)) {
+      if (isBlocked(input)) {
+        return false;
+      }
+      continue;
+    }
+    bool is_scalar = !isBlocked(input) &&
+                     base::shapeCount(input->getShape()) == 1;
+    bool is_same = input->getShape() == output->getShape() &&
+                   input->getDataFormat() == output->getDataFormat();
+    if (!is_scalar && !is_same) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// 中间结果只被融合组内的op使用，且不是模型的输出
+static bool isInternal(TensorWrapper* tensor,
+                       const std::set<OpWrapper*>& group) {
+  if (tensor->input_output_type_ == kOutput ||
+      tensor->input_output_type_ == kBoth) {
+    return false;
+  }
+  for (auto consumer : tensor->consumers_) {
+    if (group.find(consumer) == group.end()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+FuseElementwise::FuseElementwise() : OptPass("FuseElementwise") {}
+
+FuseElementwise::~FuseElementwise() {}
+
+/*
+ * @brief 将一组逐元素op替换为FusedElementwise
+ * @note
+ * 1. 生成指令：ops按拓扑序排列，组外的输入去重后作为寄存器[0, 输入个数)，
+ *    第i个op的结果为寄存器(输入个数 + i)
+ * 2. 更新tensor_repository：ops从消费者中删除，输入的消费者加入最后一个op，
+ *    删除中间结果
+ * 3. 更新op_repository：最后一个op的OpWrapper替换为FusedElementwise，
+ *    删除其余的op
+ */
+base::Status FuseElementwise::fuse(
+    std::vector<TensorWrapper*>& tensor_repository,
+    std::vector<OpWrapper*>& op_repository,
+    const std::vector<OpWrapper*>& ops) {
+  // 1. 生成指令
+  OpWrapper* last = ops.back();
+  std::vector<device::Tensor*> inputs;
+  std::map<device::Tensor*, int> registers;
+  for (auto op_wrapper : ops) {
+    for (auto input : op_wrapper->op_->getAllInput()) {
+      TensorWrapper* tensor = findTensorWrapper(tensor_repository, input);
+      bool is_intermediate =
+          !tensor->producers_.empty() &&
+          std::find(ops.begin(), ops.end(), tensor->producers_[0]) !=
+              ops.end();
+      if (!is_intermediate && registers.find(input) == registers.end()) {
+        registers[input] = static_cast<int>(inputs.size());
+        inputs.push_back(input);
+      }
+    }
+  }
+  auto param = std::make_shared<ir::FusedElementwiseParam>();
+  for (int i = 0; i < ops.size(); ++i) {
+    op::Op* op = ops[i]->op_;
+    std::vector<device::Tensor*> op_inputs = op->getAllInput();
+    param->op_types_.push_back(op->getOpType());
+    param->operands_.push_back(registers[op_inputs[0]]);
+    param->operands_.push_back(op_inputs.size() > 1 ? registers[op_inputs[1]]
+                                                    : -1);
+    registers[op->getOutput(0)] = static_cast<int>(inputs.size()) + i;
+  }
+
+  device::Tensor* output = last->op_->getOutput(0);
+  std::vector<std::string> input_names;
+  for (auto input : inputs) {
+    input_names.push_back(input->getName());
+  }
+  std::vector<std::string> output_names = {output->getName()};
+  op::Op* fused = op::createOp(last->op_->getDeviceType(), last->name_,
+                               ir::kOpTypeFusedElementwise, input_names,
+                               output_names, param);
+  if (fused == nullptr) {
+    NNDEPLOY_LOGE("create FusedElementwise failed.\n");
+    return base::kStatusCodeErrorNotImplement;
+  }
+  fused->setPrecisionType(last->op_->getPrecisionType());
+  fused->setParallelType(last->op_->getParallelType());
+  for (int i = 0; i < inputs.size(); ++i) {
+    fused->setInput(inputs[i], i);
+  }
+  fused->setOutput(output, 0);
+
+  // 2. 更新tensor_repository
+  std::vector<TensorWrapper*> to_delete_tensors;
+  for (auto tensor_wrapper : tensor_repository) {
+    for (auto op_wrapper : ops) {
+      auto it = std::find(tensor_wrapper->consumers_.begin(),
+                          tensor_wrapper->consumers_.end(), op_wrapper);
+      if (it != tensor_wrapper->consumers_.end()) {
+        tensor_wrapper->consumers_.erase(it);
+      }
+    }
+    if (std::find(inputs.begin(), inputs.end(), tensor_wrapper->tensor_) !=
+        inputs.end()) {
+      insertUnique(tensor_wrapper->consumers_, last);
+      continue;
+    }
+    for (auto producer : tensor_wrapper->producers_) {
+      if (producer != last &&
+          std::find(ops.begin(), ops.end(), producer) != ops.end()) {
+        to_delete_tensors.push_back(tensor_wrapper);
+        break;
+      }
+    }
+  }
+  for (auto tensor_wrapper : to_delete_tensors) {
+    if (tensor_wrapper->tensor_ != nullptr) {
+      net_->rmInput(tensor_wrapper->tensor_);
+      delete tensor_wrapper->tensor_;
+      tensor_wrapper->tensor_ = nullptr;
+    }
+    tensor_repository.erase(std::find(tensor_repository.begin(),
+                                      tensor_repository.end(), tensor_wrapper));
+    delete tensor_wrapper;
+  }
+
+  // 3. 更新op_repository
+  for (auto op_wrapper : ops) {
+    rmOpFromPredecessor(op_wrapper);
+  }
+  for (auto op_wrapper : ops) {
+    if (op_wrapper == last) {
+      continue;
+    }
+    op_repository.erase(std::find(op_repository.begin(), op_repository.end(),
+                                  op_wrapper));
+    delete op_wrapper->op_;
+    delete op_wrapper;
+  }
+  delete last->op_;
+  last->op_ = fused;
+  last->predecessors_.clear();
+  for (auto tensor_wrapper : tensor_repository) {
+    if (std::find(tensor_wrapper->consumers_.begin(),
+                  tensor_wrapper->consumers_.end(),
+                  last) == tensor_wrapper->consumers_.end()) {
+      continue;
+    }
+    for (auto producer : tensor_wrapper->producers_) {
+      insertUnique(last->predecessors_, producer);
+      insertUnique(producer->successors_, last);
+    }
+  }
+  return base::kStatusCodeOk;
+}
+
+/*
+ * @brief 融合逐元素运算链
+ * @note
+ * 1. 按拓扑逆序选取终点，向前吸收满足条件的op，见类的说明
+ * 2. 包含两个及以上op的组替换为FusedElementwise，各组互不相交
+ */
+base::Status FuseElementwise::optimize(
+    std::vector<TensorWrapper*>& tensor_repository,
+    std::vector<OpWrapper*>& op_repository, int begin_op_index) {
+  base::Status status = base::kStatusCodeOk;
+
+  // 1. 选取融合组，op_repository已按拓扑序排列
+  std::map<OpWrapper*, int> topo_index;
+  for (int i = 0; i < op_repository.size(); ++i) {
+    topo_index[op_repository[i]] = i;
+  }
+  std::set<OpWrapper*> fused;
+  std::vector<std::vector<OpWrapper*>> groups;
+  for (int i = static_cast<int>(op_repository.size()) - 1;
+       i >= begin_op_index; --i) {
+    OpWrapper* tail = op_repository[i];
+    device::Tensor* reference = tail->op_->getOutput(0);
+    if (fused.find(tail) != fused.end() || !isFusible(tail, reference)) {
+      continue;
+    }
+    std::set<OpWrapper*> group = {tail};
+    std::vector<OpWrapper*> worklist = {tail};
+    while (!worklist.empty() &&
+           group.size() < static_cast<size_t>(op::kFusedElementwiseMaxOps)) {
+      OpWrapper* op_wrapper = worklist.back();
+      worklist.pop_back();
+      for (auto input : op_wrapper->op_->getAllInput()) {
+        TensorWrapper* tensor = findTensorWrapper(tensor_repository, input);
+        if (tensor == nullptr || tensor->producers_.size() != 1) {
+          continue;
+        }
+        OpWrapper* producer = tensor->producers_[0];
+        if (group.find(producer) != group.end() ||
+            fused.find(producer) != fused.end() ||
+            !isInternal(tensor, group) || !isFusible(producer, reference) ||
+            group.size() >= static_cast<size_t>(op::kFusedElementwiseMaxOps)) {
+          continue;
+        }
+        group.insert(producer);
+        worklist.push_back(producer);
+      }
+    }
+    if (group.size() < 2) {
+      continue;
+    }
+    std::vector<OpWrapper*> ops(group.begin(), group.end());
+    std::sort(ops.begin(), ops.end(), [&](OpWrapper* a, OpWrapper* b) {
+      return topo_index[a] < topo_index[b];
+    });
+    fused.insert(group.begin(), group.end());
+    groups.emplace_back(ops);
+  }
+
+  // 2. 替换为FusedElementwise
+  for (auto& ops : groups) {
+    status = fuse(tensor_repository, op_repository, ops);
+    NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "fuse failed!");
+  }
+
+  return status;
+}
+
+TypeOptPassRegister<TypeOptPassCreator<FuseElementwise>>
+    g_fuse_elementwise_register(base::kDeviceTypeCodeCpu,
+                                kOptPassTypeFuseElementwise,
+                                /*优化等级 */ 6);
+
+}  // namespace net
+}  // namespace nndeploy
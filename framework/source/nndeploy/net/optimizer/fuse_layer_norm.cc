@@ -0,0 +1,446 @@
+#include "nndeploy/net/optimizer/fuse_layer_norm.h"
+
+#include "nndeploy/net/net.h"
+
+namespace nndeploy {
+namespace net {
+
+/**
+ * @brief 一次匹配到的LayerNorm子图
+ */
+struct LayerNormMatch {
+  // 按计算顺序排列的子图算子，最后一个替换为LayerNormalization
+  std::vector<OpWrapper*> ops_;
+  TensorWrapper* x_ = nullptr;
+  TensorWrapper* gamma_ = nullptr;
+  // 可为nullptr
+  TensorWrapper* beta_ = nullptr;
+  // x从axis_开始的维度，gamma、beta的形状与之相同，或为广播的单个元素
+  base::IntVector normalized_shape_;
+  int axis_ = -1;
+  float epsilon_ = 1e-5f;
+};
+
+static bool isConstant(TensorWrapper* tensor) {
+  return tensor != nullptr && tensor->is_weight_ &&
+         tensor->tensor_ != nullptr && tensor->tensor_->getData() != nullptr;
+}
+
+// tensor由唯一的op_type类型的op产生时返回该op
+static OpWrapper* getProducer(TensorWrapper* tensor, ir::OpType op_type) {
+  if (tensor == nullptr || tensor->producers_.size() != 1 ||
+      tensor->producers_[0]->op_->getOpType() != op_type) {
+    return nullptr;
+  }
+  return tensor->producers_[0];
+}
+
+// 中间结果只被子图内的consumer_num个op使用，且不是模型的输出
+static bool isInternal(TensorWrapper* tensor, size_t consumer_num) {
+  return tensor != nullptr && tensor->consumers_.size() == consumer_num &&
+         tensor->input_output_type_ != kOutput &&
+         tensor->input_output_type_ != kBoth;
+}
+
+// 只有一个元素的float常量
+static bool getScalar(TensorWrapper* tensor, float& value) {
+  if (!isConstant(tensor) ||
+      tensor->tensor_->getDataType() != base::dataTypeOf<float>() ||
+      tensor->tensor_->getSize() != sizeof(float)) {
+    return false;
+  }
+  value = static_cast<float*>(tensor->tensor_->getData())[0];
+  return true;
+}
+
+// 二元op的一个输入为tensor时返回另一个输入
+static TensorWrapper* getOtherInput(
+    OpWrapper* op, device::Tensor* tensor,
+    std::vector<TensorWrapper*>& tensor_repository) {
+  std::vector<device::Tensor*> inputs = op->op_->getAllInput();
+  if (inputs.size() != 2) {
+    return nullptr;
+  }
+  if (inputs[0] == tensor) {
+    return findTensorWrapper(tensor_repository, inputs[1]);
+  }
+  if (inputs[1] == tensor) {
+    return findTensorWrapper(tensor_repository, inputs[0]);
+  }
+  return nullptr;
+}
+
+// 去掉前面为1的维度
+static base::IntVector squeezeLeading(const base::IntVector& shape) {
+  size_t i = 0;
+  while (i < shape.size() && shape[i] == 1) {
+    ++i;
+  }
+  return base::IntVector(shape.begin() + i, shape.end());
+}
+
+// 常量与归一化的维度形状相同，或只有一个元素
+static bool isNormalizedShape(TensorWrapper* tensor,
+                              const base::IntVector& normalized_shape) {
+  float value = 0.0f;
+  return squeezeLeading(tensor->tensor_->getShape()) ==
+             squeezeLeading(normalized_shape) ||
+         getScalar(tensor, value);
+}
+
+// 单个元素的常量广播为归一化维度的形状，LayerNormalization要求元素个数相同
+static TensorWrapper* broadcastConstant(
+    std::vector<TensorWrapper*>& tensor_repository, TensorWrapper* tensor,
+    const base::IntVector& normalized_shape) {
+  float value = 0.0f;
+  if (!getScalar(tensor, value) || base::shapeCount(normalized_shape) == 1) {
+    return tensor;
+  }
+  TensorWrapper* broadcast = new TensorWrapper();
+  broadcast->is_external_ = false;
+  broadcast->is_weight_ = true;
+  broadcast->name_ = tensor->name_ + ".broadcast";
+  device::TensorDesc desc(base::dataTypeOf<float>(), base::kDataFormatAuto,
+                          normalized_shape);
+  broadcast->tensor_ =
+      new device::Tensor(tensor->tensor_->getDevice(), desc, broadcast->name_);
+  broadcast->tensor_->set<float>(value);
+  tensor_repository.emplace_back(broadcast);
+  return broadcast;
+}
+
+/**
+ * @brief ReduceMean的axes转为负数并排序，必须为[-k, ..., -1]
+ * # 形状推导前中间结果的rank未知，非负的axis需要x的形状已知
+ */
+static bool getReduceMeanAxes(OpWrapper* op, int rank,
+                              std::vector<TensorWrapper*>& tensor_repository,
+                              std::vector<int>& axes) {
+  auto param = dynamic_cast<ir::ReduceParam*>(op->op_->getParam().get());
+  if (param == nullptr || param->keepdims_ != 1) {
+    return false;
+  }
+  axes = param->axes_;
+  std::vector<device::Tensor*> inputs = op->op_->getAllInput();
+  if (inputs.size() > 1) {
+    TensorWrapper* axes_tensor = findTensorWrapper(tensor_repository,
+                                                   inputs[1]);
+    if (!isConstant(axes_tensor)) {
+      return false;
+    }
+    device::Tensor* tensor = axes_tensor->tensor_;
+    size_t num = tensor->getSize() / tensor->getDataType().size();
+    axes.clear();
+    for (size_t i = 0; i < num; ++i) {
+      if (tensor->getDataType() == base::dataTypeOf<int32_t>()) {
+        axes.push_back(static_cast<int32_t*>(tensor->getData())[i]);
+      } else {
+        axes.push_back(
+            static_cast<int>(static_cast<int64_t*>(tensor->getData())[i]));
+      }
+    }
+  }
+  if (axes.empty()) {
+    return false;
+  }
+  for (auto& axis : axes) {
+    if (axis >= 0) {
+      if (rank <= 0) {
+        return false;
+      }
+      axis -= rank;
+    }
+  }
+  std::sort(axes.begin(), axes.end());
+  int k = static_cast<int>(axes.size());
+  for (int i = 0; i < k; ++i) {
+    if (axes[i] != i - k) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static bool matchLayerNorm(OpWrapper* div,
+                           std::vector<TensorWrapper*>& tensor_repository,
+                           LayerNormMatch& match) {
+  std::vector<device::Tensor*> inputs = div->op_->getAllInput();
+  if (inputs.size() != 2) {
+    return false;
+  }
+
+  // Div(d, Sqrt(Add(var, eps)))
+  TensorWrapper* d = findTensorWrapper(tensor_repository, inputs[0]);
+  TensorWrapper* s = findTensorWrapper(tensor_repository, inputs[1]);
+  OpWrapper* sqrt = getProducer(s, ir::kOpTypeSqrt);
+  if (sqrt == nullptr || !isInternal(s, 1)) {
+    return false;
+  }
+  TensorWrapper* var_eps =
+      findTensorWrapper(tensor_repository, sqrt->op_->getInput(0));
+  OpWrapper* add_eps = getProducer(var_eps, ir::kOpTypeAdd);
+  if (add_eps == nullptr || !isInternal(var_eps, 1) ||
+      add_eps->op_->getAllInput().size() != 2) {
+    return false;
+  }
+  TensorWrapper* var = nullptr;
+  TensorWrapper* a = findTensorWrapper(tensor_repository,
+                                      add_eps->op_->getInput(0));
+  TensorWrapper* b = findTensorWrapper(tensor_repository,
+                                      add_eps->op_->getInput(1));
+  if (getScalar(b, match.epsilon_)) {
+    var = a;
+  } else if (getScalar(a, match.epsilon_)) {
+    var = b;
+  } else {
+    return false;
+  }
+
+  // var = ReduceMean(Pow(d, 2))
+  OpWrapper* mean_var = getProducer(var, ir::kOpTypeReduceMean);
+  if (mean_var == nullptr || !isInternal(var, 1)) {
+    return false;
+  }
+  TensorWrapper* square =
+      findTensorWrapper(tensor_repository, mean_var->op_->getInput(0));
+  OpWrapper* pow = getProducer(square, ir::kOpTypePow);
+  float exponent = 0.0f;
+  if (pow == nullptr || !isInternal(square, 1) ||
+      pow->op_->getAllInput().size() != 2 ||
+      pow->op_->getInput(0) != inputs[0] ||
+      !getScalar(findTensorWrapper(tensor_repository, pow->op_->getInput(1)),
+                 exponent) ||
+      exponent != 2.0f) {
+    return false;
+  }
+
+  // d = Sub(x, ReduceMean(x))，d只被Pow与Div使用
+  OpWrapper* sub = getProducer(d, ir::kOpTypeSub);
+  if (sub == nullptr || !isInternal(d, 2) ||
+      sub->op_->getAllInput().size() != 2) {
+    return false;
+  }
+  match.x_ = findTensorWrapper(tensor_repository, sub->op_->getInput(0));
+  TensorWrapper* mean =
+      findTensorWrapper(tensor_repository, sub->op_->getInput(1));
+  OpWrapper* mean_x = getProducer(mean, ir::kOpTypeReduceMean);
+  if (match.x_ == nullptr || mean_x == nullptr || !isInternal(mean, 1) ||
+      mean_x->op_->getInput(0) != match.x_->tensor_) {
+    return false;
+  }
+  int rank = static_cast<int>(match.x_->tensor_->getShape().size());
+  std::vector<int> axes;
+  std::vector<int> var_axes;
+  if (!getReduceMeanAxes(mean_x, rank, tensor_repository, axes) ||
+      !getReduceMeanAxes(mean_var, rank, tensor_repository, var_axes) ||
+      axes != var_axes) {
+    return false;
+  }
+  match.axis_ = axes[0];
+  // 归一化的维度需要已知，用于检查gamma、beta的形状
+  if (rank + match.axis_ < 0) {
+    return false;
+  }
+  const base::IntVector& x_shape = match.x_->tensor_->getShape();
+  match.normalized_shape_.assign(x_shape.begin() + rank + match.axis_,
+                                 x_shape.end());
+  for (auto dim : match.normalized_shape_) {
+    if (dim <= 0) {
+      return false;
+    }
+  }
+  match.ops_ = {mean_x, sub, pow, mean_var, add_eps, sqrt, div};
+
+  // Mul(y, gamma)，gamma的形状与归一化的维度相同，或为单个元素
+  TensorWrapper* y = findTensorWrapper(tensor_repository,
+                                      div->op_->getOutput(0));
+  if (!isInternal(y, 1)) {
+    return false;
+  }
+  OpWrapper* mul = y->consumers_[0];
+  if (mul->op_->getOpType() != ir::kOpTypeMul) {
+    return false;
+  }
+  match.gamma_ = getOtherInput(mul, y->tensor_, tensor_repository);
+  if (!isConstant(match.gamma_) ||
+      match.gamma_->tensor_->getDataType() != base::dataTypeOf<float>()) {
+    return false;
+  }
+  if (!isNormalizedShape(match.gamma_, match.normalized_shape_)) {
+    return false;
+  }
+  match.ops_.push_back(mul);
+
+  // Add(y, beta)，可选
+  TensorWrapper* z = findTensorWrapper(tensor_repository,
+                                      mul->op_->getOutput(0));
+  if (!isInternal(z, 1) ||
+      z->consumers_[0]->op_->getOpType() != ir::kOpTypeAdd) {
+    return true;
+  }
+  OpWrapper* add = z->consumers_[0];
+  TensorWrapper* beta = getOtherInput(add, z->tensor_, tensor_repository);
+  if (isConstant(beta) &&
+      beta->tensor_->getDataType() == base::dataTypeOf<float>() &&
+      isNormalizedShape(beta, match.normalized_shape_)) {
+    match.beta_ = beta;
+    match.ops_.push_back(add);
+  }
+  return true;
+}
+
+FuseLayerNorm::FuseLayerNorm() : OptPass("FuseLayerNorm") {}
+
+FuseLayerNorm::~FuseLayerNorm() {}
+
+/*
+ * @brief 融合LayerNorm子图
+ * @note
+ * 1. 模式匹配：从Div开始向前匹配，见matchLayerNorm
+ * 2. 创建LayerNormalization，输入为[x, gamma, 可选的beta]，
+ *    输出为子图最后一个op的输出
+ *    单个元素的gamma、beta另存为广播后的常量
+ * 3. 更新tensor_repository
+ *    a. 子图的op从所有tensor的消费者中删除，x、gamma、beta的消费者加入最后一个op
+ *    b. 删除子图的中间结果，以及不再被使用的常量(eps、指数2、axes)
+ * 4. 更新op_repository
+ *    a. 最后一个op的OpWrapper替换为LayerNormalization，前驱由新的输入重新计算
+ *    b. 删除子图中其余的op
+ */
+base::Status FuseLayerNorm::optimize(
+    std::vector<TensorWrapper*>& tensor_repository,
+    std::vector<OpWrapper*>& op_repository, int begin_op_index) {
+  // 1. 模式匹配
+  LayerNormMatch match;
+  bool is_match = false;
+  for (; begin_op_index < op_repository.size(); ++begin_op_index) {
+    OpWrapper* op_wrapper = op_repository[begin_op_index];
+    if (op_wrapper->op_->getOpType() == ir::kOpTypeDiv &&
+        matchLayerNorm(op_wrapper, tensor_repository, match)) {
+      is_match = true;
+      break;
+    }
+  }
+  if (!is_match) {
+    return base::kStatusCodeOk;
+  }
+
+  // 2. 创建LayerNormalization，单个元素的gamma、beta先广播
+  OpWrapper* last = match.ops_.back();
+  match.gamma_ = broadcastConstant(tensor_repository, match.gamma_,
+                                   match.normalized_shape_);
+  if (match.beta_ != nullptr) {
+    match.beta_ = broadcastConstant(tensor_repository, match.beta_,
+                                    match.normalized_shape_);
+  }
+  std::vector<device::Tensor*> inputs = {match.x_->tensor_,
+                                         match.gamma_->tensor_};
+  if (match.beta_ != nullptr) {
+    inputs.push_back(match.beta_->tensor_);
+  }
+  device::Tensor* output = last->op_->getOutput(0);
+  std::vector<std::string> input_names;
+  for (auto input : inputs) {
+    input_names.push_back(input->getName());
+  }
+  std::vector<std::string> output_names = {output->getName()};
+  auto param = std::make_shared<ir::LayerNormalizationParam>();
+  param->axis_ = match.axis_;
+  param->epsilon_ = match.epsilon_;
+  op::Op* layer_norm = op::createOp(
+      last->op_->getDeviceType(), last->name_, ir::kOpTypeLayerNormalization,
+      input_names, output_names, param);
+  if (layer_norm == nullptr) {
+    NNDEPLOY_LOGE("create LayerNormalization failed.\n");
+    return base::kStatusCodeErrorNotImplement;
+  }
+  for (int i = 0; i < inputs.size(); ++i) {
+    layer_norm->setInput(inputs[i], i);
+  }
+  layer_norm->setOutput(output, 0);
+
+  // 3. 更新tensor_repository
+  std::set<device::Tensor*> old_inputs;
+  for (auto op_wrapper : match.ops_) {
+    for (auto input : op_wrapper->op_->getAllInput()) {
+      old_inputs.insert(input);
+    }
+  }
+  std::vector<TensorWrapper*> to_delete_tensors;
+  for (auto tensor_wrapper : tensor_repository) {
+    for (auto op_wrapper : match.ops_) {
+      auto it = std::find(tensor_wrapper->consumers_.begin(),
+                          tensor_wrapper->consumers_.end(), op_wrapper);
+      if (it != tensor_wrapper->consumers_.end()) {
+        tensor_wrapper->consumers_.erase(it);
+      }
+    }
+    if (std::find(inputs.begin(), inputs.end(), tensor_wrapper->tensor_) !=
+        inputs.end()) {
+      insertUnique(tensor_wrapper->consumers_, last);
+      continue;
+    }
+    bool is_intermediate = false;
+    for (auto producer : tensor_wrapper->producers_) {
+      if (producer != last && std::find(match.ops_.begin(), match.ops_.end(),
+                                        producer) != match.ops_.end()) {
+        is_intermediate = true;
+      }
+    }
+    bool is_unused_constant =
+        tensor_wrapper->producers_.empty() &&
+        tensor_wrapper->consumers_.empty() &&
+        old_inputs.find(tensor_wrapper->tensor_) != old_inputs.end();
+    if (is_intermediate || is_unused_constant) {
+      to_delete_tensors.push_back(tensor_wrapper);
+    }
+  }
+  for (auto tensor_wrapper : to_delete_tensors) {
+    if (tensor_wrapper->tensor_ != nullptr) {
+      net_->rmInput(tensor_wrapper->tensor_);
+      delete tensor_wrapper->tensor_;
+      tensor_wrapper->tensor_ = nullptr;
+    }
+    tensor_repository.erase(std::find(tensor_repository.begin(),
+                                      tensor_repository.end(), tensor_wrapper));
+    delete tensor_wrapper;
+  }
+
+  // 4. 更新op_repository
+  for (auto op_wrapper : match.ops_) {
+    rmOpFromPredecessor(op_wrapper);
+  }
+  for (auto op_wrapper : match.ops_) {
+    if (op_wrapper == last) {
+      continue;
+    }
+    op_repository.erase(std::find(op_repository.begin(), op_repository.end(),
+                                  op_wrapper));
+    delete op_wrapper->op_;
+    delete op_wrapper;
+  }
+  delete last->op_;
+  last->op_ = layer_norm;
+  last->predecessors_.clear();
+  for (auto tensor_wrapper : tensor_repository) {
+    if (std::find(tensor_wrapper->consumers_.begin(),
+                  tensor_wrapper->consumers_.end(),
+                  last) == tensor_wrapper->consumers_.end()) {
+      continue;
+    }
+    for (auto producer : tensor_wrapper->producers_) {
+      insertUnique(last->predecessors_, producer);
+      insertUnique(producer->successors_, last);
+    }
+  }
+
+  return this->optimize(tensor_repository, op_repository, 0);
+}
+
+TypeOptPassRegister<TypeOptPassCreator<FuseLayerNorm>>
+    g_fuse_layer_norm_register(base::kDeviceTypeCodeCpu,
+                               kOptPassTypeFuseLayerNorm,
+                               /*优化等级 */ 2);
+
+}  // namespace net
+}  // namespace nndeploy
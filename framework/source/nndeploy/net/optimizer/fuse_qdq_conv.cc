@@ -0,0 +1,360 @@
+#include "nndeploy/net/optimizer/fuse_qdq_conv.h"
+
+#include "nndeploy/net/net.h"
+
+namespace nndeploy {
+namespace net {
+
+/**
+ * @brief 一次匹配到的 DequantizeLinear -> Conv -> QuantizeLinear
+ */
+struct QdqConvMatch {
+  OpWrapper* conv_ = nullptr;
+  OpWrapper* quant_ = nullptr;
+  OpWrapper* dequant_x_ = nullptr;
+  OpWrapper* dequant_w_ = nullptr;
+  // float的bias，或由DequantizeLinear产生的bias，可为nullptr
+  TensorWrapper* bias_ = nullptr;
+  // Conv的float输出
+  TensorWrapper* output_ = nullptr;
+};
+
+static bool isQuantDataType(const base::DataType& data_type) {
+  return (data_type.code_ == base::kDataTypeCodeInt ||
+          data_type.code_ == base::kDataTypeCodeUint) &&
+         data_type.bits_ == 8 && data_type.lanes_ == 1;
+}
+
+static size_t getElementNum(device::Tensor* tensor) {
+  return tensor->getSize() / tensor->getDataType().size();
+}
+
+static bool isConstant(TensorWrapper* tensor) {
+  return tensor != nullptr && tensor->is_weight_ &&
+         tensor->tensor_ != nullptr && tensor->tensor_->getData() != nullptr;
+}
+
+// tensor由唯一的op_type类型的op产生时返回该op
+static OpWrapper* getProducer(TensorWrapper* tensor, ir::OpType op_type) {
+  if (tensor == nullptr || tensor->producers_.size() != 1 ||
+      tensor->producers_[0]->op_->getOpType() != op_type) {
+    return nullptr;
+  }
+  return tensor->producers_[0];
+}
+
+static bool matchQdqConv(OpWrapper* conv,
+                         std::vector<TensorWrapper*>& tensor_repository,
+                         QdqConvMatch& match) {
+  std::vector<device::Tensor*> inputs = conv->op_->getAllInput();
+  std::vector<device::Tensor*> outputs = conv->op_->getAllOutput();
+  if (inputs.size() < 2 || outputs.size() != 1) {
+    return false;
+  }
+  match.conv_ = conv;
+
+  // a. 输入
+  TensorWrapper* x = findTensorWrapper(tensor_repository, inputs[0]);
+  match.dequant_x_ = getProducer(x, ir::kOpTypeDequantizeLinear);
+  if (match.dequant_x_ == nullptr) {
+    return false;
+  }
+  op::Op* dequant_x = match.dequant_x_->op_;
+  if (!isQuantDataType(dequant_x->getInput(0)->getDataType()) ||
+      getElementNum(dequant_x->getInput(1)) != 1) {
+    return false;
+  }
+
+  // b. 权重
+  TensorWrapper* w = findTensorWrapper(tensor_repository, inputs[1]);
+  match.dequant_w_ = getProducer(w, ir::kOpTypeDequantizeLinear);
+  if (match.dequant_w_ == nullptr) {
+    return false;
+  }
+  std::vector<device::Tensor*> w_inputs = match.dequant_w_->op_->getAllInput();
+  for (auto input : w_inputs) {
+    if (!isConstant(findTensorWrapper(tensor_repository, input))) {
+      return false;
+    }
+  }
+  base::IntVector w_shape = w_inputs[0]->getShape();
+  if (!isQuantDataType(w_inputs[0]->getDataType()) || w_shape.size() != 4) {
+    return false;
+  }
+  size_t w_scale_num = getElementNum(w_inputs[1]);
+  if (w_scale_num != 1) {
+    auto param = dynamic_cast<ir::DequantizeLinearParam*>(
+        match.dequant_w_->op_->getParam().get());
+    int axis = param != nullptr ? param->axis_ : 1;
+    if (axis < 0) {
+      axis += static_cast<int>(w_shape.size());
+    }
+    if (axis != 0 || w_scale_num != w_shape[0]) {
+      return false;
+    }
+  }
+
+  // c. 输出
+  match.output_ = findTensorWrapper(tensor_repository, outputs[0]);
+  if (match.output_ == nullptr || match.output_->consumers_.size() != 1 ||
+      match.output_->input_output_type_ == kOutput) {
+    return false;
+  }
+  match.quant_ = match.output_->consumers_[0];
+  op::Op* quant = match.quant_->op_;
+  if (quant->getOpType() != ir::kOpTypeQuantizeLinear ||
+      quant->getInput(0) != outputs[0] ||
+      getElementNum(quant->getInput(1)) != 1 ||
+      !isQuantDataType(quant->getOutput(0)->getDataType())) {
+    return false;
+  }
+
+  // d. bias
+  match.bias_ = inputs.size() > 2
+                    ? findTensorWrapper(tensor_repository, inputs[2])
+                    : nullptr;
+  if (match.bias_ == nullptr) {
+    return true;
+  }
+  if (!isConstant(findTensorWrapper(tensor_repository,
+                                    dequant_x->getInput(1)))) {
+    return false;
+  }
+  if (isConstant(match.bias_)) {
+    return match.bias_->tensor_->getDataType() == base::dataTypeOf<float>();
+  }
+  OpWrapper* dequant_b =
+      getProducer(match.bias_, ir::kOpTypeDequantizeLinear);
+  if (dequant_b == nullptr) {
+    return false;
+  }
+  for (auto input : dequant_b->op_->getAllInput()) {
+    if (!isConstant(findTensorWrapper(tensor_repository, input))) {
+      return false;
+    }
+  }
+  return dequant_b->op_->getInput(0)->getDataType() ==
+         base::dataTypeOf<int32_t>();
+}
+
+// 创建常量，由Net管理
+static device::Tensor* createConstant(Net* net, device::Device* device,
+                                      const std::string& name,
+                                      base::DataType data_type,
+                                      const base::IntVector& shape) {
+  device::TensorDesc desc(data_type, base::kDataFormatN, shape);
+  device::Tensor* tensor = new device::Tensor(device, desc, name);
+  memset(tensor->getData(), 0, tensor->getSize());
+  net->addTensor(tensor, false, true);
+  return tensor;
+}
+
+// bias转为int32，scale为x_scale * w_scale
+static std::vector<int32_t> quantizeBias(const QdqConvMatch& match,
+                                         int output_c) {
+  std::vector<float> bias(output_c, 0.0f);
+  device::Tensor* bias_tensor = match.bias_->tensor_;
+  OpWrapper* dequant_b =
+      getProducer(match.bias_, ir::kOpTypeDequantizeLinear);
+  if (dequant_b == nullptr) {
+    const float* data = static_cast<float*>(bias_tensor->getData());
+    bias.assign(data, data + output_c);
+  } else {
+    device::Tensor* b_q = dequant_b->op_->getInput(0);
+    device::Tensor* b_scale = dequant_b->op_->getInput(1);
+    device::Tensor* b_zero_point = dequant_b->op_->getInput(2);
+    const int32_t* data = static_cast<int32_t*>(b_q->getData());
+    const float* scale = static_cast<float*>(b_scale->getData());
+    size_t scale_num = getElementNum(b_scale);
+    for (int c = 0; c < output_c; ++c) {
+      int32_t zero_point =
+          b_zero_point != nullptr
+              ? static_cast<int32_t*>(b_zero_point->getData())
+                    [getElementNum(b_zero_point) == 1 ? 0 : c]
+              : 0;
+      bias[c] = (data[c] - zero_point) * scale[scale_num == 1 ? 0 : c];
+    }
+  }
+
+  const float x_scale = static_cast<float*>(
+      match.dequant_x_->op_->getInput(1)->getData())[0];
+  device::Tensor* w_scale_tensor = match.dequant_w_->op_->getInput(1);
+  const float* w_scale = static_cast<float*>(w_scale_tensor->getData());
+  size_t w_scale_num = getElementNum(w_scale_tensor);
+  std::vector<int32_t> result(output_c);
+  for (int c = 0; c < output_c; ++c) {
+    double scale = (double)x_scale * w_scale[w_scale_num == 1 ? 0 : c];
+    double value = scale != 0.0 ? std::nearbyint(bias[c] / scale) : 0.0;
+    value = std::min(std::max(value, (double)INT32_MIN), (double)INT32_MAX);
+    result[c] = static_cast<int32_t>(value);
+  }
+  return result;
+}
+
+FuseQdqConv::FuseQdqConv() : OptPass("FuseQdqConv") {}
+
+FuseQdqConv::~FuseQdqConv() {}
+
+/*
+ * @brief 融合 DequantizeLinear -> Conv -> QuantizeLinear
+ * @note
+ * 1. 模式匹配：见matchQdqConv
+ * 2. 创建QLinearConv，输入为
+ *    [x, x_scale, x_zero_point, w, w_scale, w_zero_point, y_scale,
+ *     y_zero_point, 可选的int32 bias]，缺省的zero point补为0的常量
+ * 3. 更新tensor_repository
+ *    a. Quant的输出：生产者改为Conv的OpWrapper
+ *    b. 量化张量与scale、zero point：消费者加入Conv的OpWrapper
+ *    c. Conv原来的输入：消费者中删除Conv，不再使用的float bias直接删除
+ *    d. 删除Conv的float输出
+ * 4. 更新op_repository
+ *    a. Conv的OpWrapper替换为QLinearConv，前驱由新的输入重新计算
+ *    b. successors_改为Quant的successors_，删除Quant
+ */
+base::Status FuseQdqConv::optimize(
+    std::vector<TensorWrapper*>& tensor_repository,
+    std::vector<OpWrapper*>& op_repository, int begin_op_index) {
+  // 1. 模式匹配
+  QdqConvMatch match;
+  bool is_match = false;
+  for (; begin_op_index < op_repository.size(); ++begin_op_index) {
+    OpWrapper* op_wrapper = op_repository[begin_op_index];
+    if (op_wrapper->op_->getOpType() == ir::kOpTypeConv &&
+        matchQdqConv(op_wrapper, tensor_repository, match)) {
+      is_match = true;
+      break;
+    }
+  }
+  if (!is_match) {
+    return base::kStatusCodeOk;
+  }
+
+  // 2. 创建QLinearConv
+  OpWrapper* conv = match.conv_;
+  op::Op* dequant_x = match.dequant_x_->op_;
+  op::Op* dequant_w = match.dequant_w_->op_;
+  op::Op* quant = match.quant_->op_;
+  base::DeviceType device_type = conv->op_->getDeviceType();
+  device::Device* device = device::getDevice(device_type);
+  auto getZeroPoint = [&](op::Op* op, device::Tensor* quant_tensor,
+                          const std::string& name) {
+    if (op->getAllInput().size() > 2) {
+      return op->getInput(2);
+    }
+    return createConstant(net_, device, name, quant_tensor->getDataType(),
+                          {1});
+  };
+  device::Tensor* w_q = dequant_w->getInput(0);
+  device::Tensor* y_q = quant->getOutput(0);
+  std::vector<device::Tensor*> inputs = {
+      dequant_x->getInput(0),
+      dequant_x->getInput(1),
+      getZeroPoint(dequant_x, dequant_x->getInput(0),
+                   conv->name_ + ".x_zero_point"),
+      w_q,
+      dequant_w->getInput(1),
+      getZeroPoint(dequant_w, w_q, conv->name_ + ".w_zero_point"),
+      quant->getInput(1),
+      getZeroPoint(quant, y_q, conv->name_ + ".y_zero_point")};
+  if (match.bias_ != nullptr) {
+    int output_c = w_q->getShape()[0];
+    std::vector<int32_t> bias = quantizeBias(match, output_c);
+    device::Tensor* bias_tensor =
+        createConstant(net_, device, conv->name_ + ".bias_int32",
+                       base::dataTypeOf<int32_t>(), {output_c});
+    memcpy(bias_tensor->getData(), bias.data(), sizeof(int32_t) * output_c);
+    inputs.push_back(bias_tensor);
+  }
+  std::vector<std::string> input_names;
+  for (auto input : inputs) {
+    input_names.push_back(input->getName());
+  }
+  std::vector<std::string> output_names = {y_q->getName()};
+  op::Op* qlinear_conv =
+      op::createOp(device_type, conv->name_, ir::kOpTypeQLinearConv,
+                   input_names, output_names, conv->op_->getParam());
+  if (qlinear_conv == nullptr) {
+    NNDEPLOY_LOGE("create QLinearConv failed.\n");
+    return base::kStatusCodeErrorNotImplement;
+  }
+  for (int i = 0; i < inputs.size(); ++i) {
+    qlinear_conv->setInput(inputs[i], i);
+  }
+  qlinear_conv->setOutput(y_q, 0);
+
+  // 3. 更新tensor_repository
+  std::vector<device::Tensor*> old_inputs = conv->op_->getAllInput();
+  for (auto tensor_wrapper : tensor_repository) {
+    for (auto& producer : tensor_wrapper->producers_) {
+      if (producer == match.quant_) {
+        producer = conv;
+      }
+    }
+    auto it = std::find(tensor_wrapper->consumers_.begin(),
+                        tensor_wrapper->consumers_.end(), match.quant_);
+    if (it != tensor_wrapper->consumers_.end()) {
+      tensor_wrapper->consumers_.erase(it);
+    }
+    it = std::find(tensor_wrapper->consumers_.begin(),
+                   tensor_wrapper->consumers_.end(), conv);
+    if (it != tensor_wrapper->consumers_.end()) {
+      tensor_wrapper->consumers_.erase(it);
+    }
+    if (std::find(inputs.begin(), inputs.end(), tensor_wrapper->tensor_) !=
+        inputs.end()) {
+      insertUnique(tensor_wrapper->consumers_, conv);
+    }
+  }
+  std::vector<TensorWrapper*> to_delete_tensors = {match.output_};
+  if (match.bias_ != nullptr && match.bias_->producers_.empty() &&
+      match.bias_->consumers_.empty()) {
+    to_delete_tensors.push_back(match.bias_);
+  }
+  for (auto tensor_wrapper : to_delete_tensors) {
+    if (tensor_wrapper->tensor_ != nullptr) {
+      net_->rmInput(tensor_wrapper->tensor_);
+      delete tensor_wrapper->tensor_;
+      tensor_wrapper->tensor_ = nullptr;
+    }
+    tensor_repository.erase(std::find(tensor_repository.begin(),
+                                      tensor_repository.end(), tensor_wrapper));
+    delete tensor_wrapper;
+  }
+
+  // 4. 更新op_repository
+  delete conv->op_;
+  conv->op_ = qlinear_conv;
+  rmOpFromPredecessor(conv);
+  conv->predecessors_.clear();
+  for (auto tensor_wrapper : tensor_repository) {
+    if (std::find(tensor_wrapper->consumers_.begin(),
+                  tensor_wrapper->consumers_.end(),
+                  conv) == tensor_wrapper->consumers_.end()) {
+      continue;
+    }
+    for (auto producer : tensor_wrapper->producers_) {
+      insertUnique(conv->predecessors_, producer);
+      insertUnique(producer->successors_, conv);
+    }
+  }
+  conv->successors_ = match.quant_->successors_;
+  for (auto successor : match.quant_->successors_) {
+    for (auto& predecessor : successor->predecessors_) {
+      if (predecessor == match.quant_) {
+        predecessor = conv;
+      }
+    }
+  }
+  op_repository.erase(std::find(op_repository.begin(), op_repository.end(),
+                                match.quant_));
+  delete match.quant_->op_;
+  delete match.quant_;
+
+  return this->optimize(tensor_repository, op_repository, 0);
+}
+
+TypeOptPassRegister<TypeOptPassCreator<FuseQdqConv>> g_fuse_qdq_conv_register(
+    base::kDeviceTypeCodeCpu, kOptPassTypeFuseQdqConv, /*优化等级 */ 3);
+
+}  // namespace net
+}  // namespace nndeploy
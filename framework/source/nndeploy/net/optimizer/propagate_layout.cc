@@ -0,0 +1,355 @@
+#include "nndeploy/net/optimizer/propagate_layout.h"
+
+#include "nndeploy/base/cpu_isa.h"
+#include "nndeploy/base/shape.h"
+#include "nndeploy/net/net.h"
+
+namespace nndeploy {
+namespace net {
+
+static bool isConstant(TensorWrapper* tensor) {
+  return tensor != nullptr && tensor->is_weight_ &&
+         tensor->tensor_ != nullptr && tensor->tensor_->getData() != nullptr;
+}
+
+// 形状已知的float 4D NCHW张量
+static bool isNchwFloat(device::Tensor* tensor) {
+  return tensor != nullptr && tensor->getShape().size() == 4 &&
+         tensor->getDataFormat() == base::kDataFormatNCHW &&
+         tensor->getDataType() == base::dataTypeOf<float>();
+}
+
+// 只有一个元素的float常量，二元op中可以与分块格式的张量直接广播
+static bool isScalarConstant(TensorWrapper* tensor) {
+  return isConstant(tensor) &&
+         tensor->tensor_->getDataType() == base::dataTypeOf<float>() &&
+         tensor->tensor_->getSize() == sizeof(float);
+}
+
+static bool isLayoutAgnosticUnary(ir::OpType op_type) {
+  switch (op_type) {
+    case ir::kOpTypeRelu:
+    case ir::kOpTypeSigmoid:
+    case ir::kOpTypeExp:
+    case ir::kOpTypeTanh:
+    case ir::kOpTypeErf:
+    case ir::kOpTypeGelu:
+    case ir::kOpTypeSilu:
+    case ir::kOpTypeSqrt:
+      return true;
+    default:
+      return false;
+  }
+}
+
+static bool isLayoutAgnosticBinary(ir::OpType op_type) {
+  switch (op_type) {
+    case ir::kOpTypeAdd:
+    case ir::kOpTypeSub:
+    case ir::kOpTypeMul:
+    case ir::kOpTypeDiv:
+    case ir::kOpTypePow:
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * @brief op支持通道分块格式时返回true，indices为需要分块格式的输入
+ * # 卷积的权重与bias、二元op的标量常量保持原样
+ */
+static bool getBlockedInputs(OpWrapper* op_wrapper,
+                             std::vector<TensorWrapper*>& tensor_repository,
+                             std::vector<int>& indices) {
+  op::Op* op = op_wrapper->op_;
+  ir::OpType op_type = op->getOpType();
+  std::vector<device::Tensor*> inputs = op->getAllInput();
+  indices.clear();
+  if (inputs.empty() || op->getAllOutput().size() != 1 ||
+      !isNchwFloat(op->getOutput(0))) {
+    return false;
+  }
+  if (op_type == ir::kOpTypeConv) {
+    auto param = dynamic_cast<ir::ConvParam*>(op->getParam().get());
+    if (param == nullptr || inputs.size() < 2 || !isNchwFloat(inputs[0]) ||
+        !isConstant(findTensorWrapper(tensor_repository, inputs[1])) ||
+        inputs[1]->getDataType() != base::dataTypeOf<float>()) {
+      return false;
+    }
+    base::IntVector weight_shape = inputs[1]->getShape();
+    if (weight_shape.size() != 4) {
+      return false;
+    }
+    if (param->group_ != 1 &&
+        (weight_shape[1] != 1 || weight_shape[0] != param->group_)) {
+      return false;
+    }
+    indices.push_back(0);
+    return true;
+  }
+  if (op_type == ir::kOpTypeMaxPool || op_type == ir::kOpTypeAveragePool ||
+      op_type == ir::kOpTypeGlobalAveragePool ||
+      isLayoutAgnosticUnary(op_type)) {
+    if (inputs.size() != 1 || !isNchwFloat(inputs[0])) {
+      return false;
+    }
+    indices.push_back(0);
+    return true;
+  }
+  if (isLayoutAgnosticBinary(op_type) || op_type == ir::kOpTypeConcat ||
+      op_type == ir::kOpTypeFusedElementwise) {
+    bool is_binary = op_type != ir::kOpTypeConcat;
+    // FusedElementwise分块计算时不广播，张量输入须与输出形状相同
+    bool is_fused = op_type == ir::kOpTypeFusedElementwise;
+    if (is_binary && !is_fused && inputs.size() != 2) {
+      return false;
+    }
+    for (int i = 0; i < inputs.size(); ++i) {
+      TensorWrapper* input = findTensorWrapper(tensor_repository, inputs[i]);
+      if (input == nullptr) {
+        return false;
+      }
+      if (is_binary && isScalarConstant(input)) {
+        continue;
+      }
+      if (input->is_weight_ || !isNchwFloat(inputs[i]) ||
+          (is_fused && inputs[i]->getShape() != op->getOutput(0)->getShape())) {
+        return false;
+      }
+      indices.push_back(i);
+    }
+    return !indices.empty();
+  }
+  return false;
+}
+
+static bool isProducedBy(TensorWrapper* tensor,
+                         const std::set<OpWrapper*>& region) {
+  return !tensor->producers_.empty() &&
+         region.find(tensor->producers_[0]) != region.end();
+}
+
+// 将op中所有为from的输入替换为to
+static void replaceInput(OpWrapper* op_wrapper, device::Tensor* from,
+                         device::Tensor* to) {
+  std::vector<device::Tensor*> inputs = op_wrapper->op_->getAllInput();
+  for (int i = 0; i < inputs.size(); ++i) {
+    if (inputs[i] == from) {
+      op_wrapper->op_->setInput(to, i);
+    }
+  }
+}
+
+// 与Net::createTensor相同，张量由Net管理
+static TensorWrapper* createTensor(
+    std::vector<TensorWrapper*>& tensor_repository, const std::string& name) {
+  TensorWrapper* tensor_wrapper = new TensorWrapper();
+  tensor_wrapper->is_external_ = false;
+  tensor_wrapper->tensor_ = new device::Tensor(name);
+  tensor_wrapper->name_ = name;
+  tensor_repository.emplace_back(tensor_wrapper);
+  return tensor_wrapper;
+}
+
+static void eraseConsumer(TensorWrapper* tensor, OpWrapper* op_wrapper) {
+  auto it = std::find(tensor->consumers_.begin(), tensor->consumers_.end(),
+                      op_wrapper);
+  if (it != tensor->consumers_.end()) {
+    tensor->consumers_.erase(it);
+  }
+}
+
+PropagateLayout::PropagateLayout() : OptPass("PropagateLayout") {}
+
+PropagateLayout::~PropagateLayout() {}
+
+OpWrapper* PropagateLayout::createReorder(
+    std::vector<OpWrapper*>& op_repository, OpWrapper* reference,
+    TensorWrapper* input, TensorWrapper* output,
+    base::DataFormat data_format) {
+  std::string name = output->name_ + ".reorder";
+  std::vector<std::string> input_names = {input->name_};
+  std::vector<std::string> output_names = {output->name_};
+  auto param = std::make_shared<ir::ReorderParam>();
+  param->data_format_ = data_format;
+  op::Op* op = op::createOp(reference->op_->getDeviceType(), name,
+                            ir::kOpTypeReorder, input_names, output_names,
+                            param);
+  if (op == nullptr) {
+    NNDEPLOY_LOGE("create Reorder failed.\n");
+    return nullptr;
+  }
+  op->setPrecisionType(reference->op_->getPrecisionType());
+  op->setParallelType(reference->op_->getParallelType());
+  op->setInnerFlag(true);
+  op->setInput(input->tensor_, 0);
+  op->setOutput(output->tensor_, 0);
+
+  OpWrapper* op_wrapper = new OpWrapper();
+  op_wrapper->is_external_ = false;
+  op_wrapper->op_ = op;
+  op_wrapper->name_ = name;
+  op_repository.emplace_back(op_wrapper);
+  insertUnique(input->consumers_, op_wrapper);
+  insertUnique(output->producers_, op_wrapper);
+  return op_wrapper;
+}
+
+/*
+ * @brief 传播通道分块格式
+ * @note
+ * 1. 按拓扑序选取区域，见类的说明
+ * 2. 区域的输入转为分块格式，区域内的op改为使用分块格式的新张量
+ * 3. 区域的输出被区域外使用或是模型的输出时，插入Reorder转回NCHW
+ * 4. 重新计算前驱与后继、拓扑排序，并重新推导数据类型、形状与数据格式
+ */
+base::Status PropagateLayout::optimize(
+    std::vector<TensorWrapper*>& tensor_repository,
+    std::vector<OpWrapper*>& op_repository, int begin_op_index) {
+  base::Status status = base::kStatusCodeOk;
+  base::DataFormat blocked_format = base::isCpuIsaSupported(base::kCpuIsaAvx2)
+                                        ? base::kDataFormatNC8HW
+                                        : base::kDataFormatNC4HW;
+
+  // 1. 选取区域，op_repository已按拓扑序排列
+  std::vector<OpWrapper*> region_ops;
+  std::set<OpWrapper*> region;
+  std::map<OpWrapper*, std::vector<int>> blocked_inputs;
+  for (auto op_wrapper : op_repository) {
+    std::vector<int> indices;
+    if (!getBlockedInputs(op_wrapper, tensor_repository, indices)) {
+      continue;
+    }
+    bool is_selected = op_wrapper->op_->getOpType() == ir::kOpTypeConv;
+    for (int i : indices) {
+      TensorWrapper* input =
+          findTensorWrapper(tensor_repository, op_wrapper->op_->getInput(i));
+      is_selected = is_selected || isProducedBy(input, region);
+    }
+    if (is_selected) {
+      region_ops.emplace_back(op_wrapper);
+      region.insert(op_wrapper);
+      blocked_inputs[op_wrapper] = indices;
+    }
+  }
+  if (region_ops.empty()) {
+    return status;
+  }
+
+  // 2. 区域的输入转为分块格式
+  std::map<TensorWrapper*, TensorWrapper*> to_blocked;
+  for (auto op_wrapper : region_ops) {
+    std::vector<TensorWrapper*> replaced;
+    for (int i : blocked_inputs[op_wrapper]) {
+      TensorWrapper* input =
+          findTensorWrapper(tensor_repository, op_wrapper->op_->getInput(i));
+      if (isProducedBy(input, region)) {
+        continue;
+      }
+      TensorWrapper*& blocked = to_blocked[input];
+      if (blocked == nullptr) {
+        blocked = createTensor(tensor_repository, input->name_ + ".blocked");
+        if (createReorder(op_repository, op_wrapper, input, blocked,
+                          blocked_format) == nullptr) {
+          return base::kStatusCodeErrorNotImplement;
+        }
+      }
+      op_wrapper->op_->setInput(blocked->tensor_, i);
+      insertUnique(blocked->consumers_, op_wrapper);
+      replaced.emplace_back(input);
+    }
+    for (auto input : replaced) {
+      eraseConsumer(input, op_wrapper);
+    }
+  }
+
+  // 3. 区域的输出转回NCHW
+  for (auto op_wrapper : region_ops) {
+    TensorWrapper* output =
+        findTensorWrapper(tensor_repository, op_wrapper->op_->getOutput(0));
+    std::vector<OpWrapper*> inner;
+    std::vector<OpWrapper*> outer;
+    for (auto consumer : output->consumers_) {
+      if (region.find(consumer) != region.end()) {
+        inner.emplace_back(consumer);
+      } else {
+        outer.emplace_back(consumer);
+      }
+    }
+    TensorWrapper* reorder_input = output;
+    TensorWrapper* reorder_output = nullptr;
+    if (output->input_output_type_ == kOutput ||
+        output->input_output_type_ == kBoth) {
+      // 模型的输出保持为原张量
+      TensorWrapper* blocked = createTensor(tensor_repository,
+                                             output->name_ + ".blocked");
+      op_wrapper->op_->setOutput(blocked->tensor_, 0);
+      blocked->producers_.emplace_back(op_wrapper);
+      for (auto consumer : inner) {
+        replaceInput(consumer, output->tensor_, blocked->tensor_);
+        insertUnique(blocked->consumers_, consumer);
+      }
+      output->producers_.clear();
+      output->consumers_ = outer;
+      reorder_input = blocked;
+      reorder_output = output;
+    } else if (!outer.empty()) {
+      TensorWrapper* nchw =
+          createTensor(tensor_repository, output->name_ + ".nchw");
+      for (auto consumer : outer) {
+        replaceInput(consumer, output->tensor_, nchw->tensor_);
+        insertUnique(nchw->consumers_, consumer);
+      }
+      output->consumers_ = inner;
+      reorder_output = nchw;
+    } else {
+      continue;
+    }
+    if (createReorder(op_repository, op_wrapper, reorder_input,
+                      reorder_output, base::kDataFormatNCHW) == nullptr) {
+      return base::kStatusCodeErrorNotImplement;
+    }
+  }
+
+  // 4. 重新计算前驱与后继，并拓扑排序
+  for (auto op_wrapper : op_repository) {
+    op_wrapper->predecessors_.clear();
+    op_wrapper->successors_.clear();
+  }
+  for (auto tensor_wrapper : tensor_repository) {
+    for (auto producer : tensor_wrapper->producers_) {
+      for (auto consumer : tensor_wrapper->consumers_) {
+        insertUnique(consumer->predecessors_, producer);
+        insertUnique(producer->successors_, consumer);
+      }
+    }
+  }
+  setColor(op_repository, base::kNodeColorWhite);
+  std::vector<OpWrapper*> topo_op_repository;
+  status = topoSortDFS(op_repository, topo_op_repository);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "topoSortDFS failed!");
+  op_repository = topo_op_repository;
+
+  for (auto op_wrapper : op_repository) {
+    op::Op* op = op_wrapper->op_;
+    status = op->inferDataType();
+    NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk,
+                           "inferDataType failed!");
+    status = op->inferShape();
+    NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "inferShape failed!");
+    status = op->inferDataFormat();
+    NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk,
+                           "inferDataFormat failed!");
+  }
+
+  return status;
+}
+
+TypeOptPassRegister<TypeOptPassCreator<PropagateLayout>>
+    g_propagate_layout_register(base::kDeviceTypeCodeCpu,
+                                kOptPassTypePropagateLayout,
+                                /*优化等级 */ 7);
+
+}  // namespace net
+}  // namespace nndeploy
@@ -14,6 +14,18 @@ TypeRuntimeRegister<TypeRuntimeCreator<SequentialRuntime>>
 TypeRuntimeRegister<TypeRuntimeCreator<SequentialRuntime>>
     g_sequential_runtime_register_none(base::ParallelType::kParallelTypeNone);
 
+static base::ShapeMap getInputShape(
+    std::vector<TensorWrapper *> &tensor_repository) {
+  base::ShapeMap shape_map;
+  for (auto tensor_wrapper : tensor_repository) {
+    if (tensor_wrapper->input_output_type_ == kInput) {
+      shape_map[tensor_wrapper->tensor_->getName()] =
+          tensor_wrapper->tensor_->getShape();
+    }
+  }
+  return shape_map;
+}
+
 SequentialRuntime::SequentialRuntime(const base::DeviceType &device_type)
     : Runtime(device_type) {};
 SequentialRuntime::~SequentialRuntime() {};
@@ -39,11 +51,19 @@ base::Status SequentialRuntime::init(
       NNDEPLOY_LOGE("tensor_pool_ allocate failed\n");
       return status;
     }
+    allocated_shape_ = getInputShape(tensor_repository);
   }
 
   // # op的初始化
   // ## 权重转换
   for (auto iter : op_repository) {
+    std::vector<device::Tensor *> inputs = iter->op_->getAllInput();
+    for (int i = 0; i < inputs.size(); ++i) {
+      TensorWrapper *input_wrapper =
+          findTensorWrapper(tensor_repository, inputs[i]);
+      iter->op_->setInputWeightFlag(
+          i, input_wrapper != nullptr && input_wrapper->is_weight_);
+    }
     iter->op_->setInitializedFlag(false);
     status = iter->op_->init();
     if (status != base::kStatusCodeOk) {
@@ -101,19 +121,20 @@ base::Status SequentialRuntime::reshape(base::ShapeMap &shape_map) {
           continue;
         }
         channge_flag = true;
-        if (!max_shape_.empty()) {
-          if (max_shape_.find(name) != max_shape_.end()) {
-            base::IntVector max_shape = max_shape_[name];
-            for (int i = 0; i < shape.size(); ++i) {
-              if (shape[i] > max_shape[i]) {
-                is_reallocate = true;
-                break;
-              }
-            }
+        // 超过分配内存时的shape才需要重新分配内存
+        auto allocated_iter = allocated_shape_.find(name);
+        if (allocated_iter == allocated_shape_.end() ||
+            allocated_iter->second.size() != shape.size()) {
+          is_reallocate = true;
+          continue;
+        }
+        base::IntVector allocated_shape = allocated_iter->second;
+        for (int i = 0; i < shape.size(); ++i) {
+          if (shape[i] > allocated_shape[i]) {
+            is_reallocate = true;
+            break;
           }
         }
-      } else {
-        is_reallocate = true;
       }
     }
   }
@@ -124,6 +145,12 @@ base::Status SequentialRuntime::reshape(base::ShapeMap &shape_map) {
         NNDEPLOY_LOGE("tensor_pool_ allocate failed\n");
         return status;
       }
+    } else {
+      status = tensor_pool_->deallocateTensorView();
+      if (status != base::kStatusCodeOk) {
+        NNDEPLOY_LOGE("tensor_pool_ deallocateTensorView failed\n");
+        return status;
+      }
     }
     for (auto iter : shape_map) {
       std::string name = iter.first;
@@ -148,6 +175,14 @@ base::Status SequentialRuntime::reshape(base::ShapeMap &shape_map) {
         NNDEPLOY_LOGE("tensor_pool_ allocate failed\n");
         return status;
       }
+      allocated_shape_ = getInputShape(tensor_repository_);
+    } else {
+      // 内存不变，但Split/Slice等视图的偏移随shape变化
+      status = tensor_pool_->updateTensorView();
+      if (status != base::kStatusCodeOk) {
+        NNDEPLOY_LOGE("tensor_pool_ updateTensorView failed\n");
+        return status;
+      }
     }
   }
   return status;
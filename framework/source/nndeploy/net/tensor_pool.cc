@@ -2,6 +2,8 @@
 
 #include "nndeploy/net/tensor_pool.h"
 
+#include "nndeploy/op/util.h"
+
 namespace nndeploy {
 namespace net {
 
@@ -23,6 +25,129 @@ base::Status TensorPool::setMemory(device::Buffer *buffer) {
   return base::kStatusCodeErrorNotImplement;
 }
 
+static bool isTensorViewable(TensorWrapper *tensor_wrapper) {
+  return tensor_wrapper != nullptr && !tensor_wrapper->is_weight_ &&
+         tensor_wrapper->input_output_type_ == kNone;
+}
+
+base::Status TensorPool::initTensorView() {
+  tensor_views_.clear();
+  std::set<TensorWrapper *> roots;
+  for (auto op_wrapper : op_repository_) {
+    op::Op *op = op_wrapper->op_;
+    std::vector<device::Tensor *> inputs = op->getAllInput();
+    std::vector<device::Tensor *> outputs = op->getAllOutput();
+
+    // 输入直接存放在输出中
+    for (size_t i = 0; i < inputs.size(); ++i) {
+      int output_index = -1;
+      size_t offset = 0;
+      if (!op->getInputView((int)i, output_index, offset)) {
+        continue;
+      }
+      TensorWrapper *view = findTensorWrapper(tensor_repository_, inputs[i]);
+      TensorWrapper *root =
+          findTensorWrapper(tensor_repository_, outputs[output_index]);
+      if (!isTensorViewable(view) || view->producers_.size() != 1 ||
+          root == nullptr || root->is_weight_) {
+        continue;
+      }
+      if (tensor_views_.count(view) != 0 || roots.count(view) != 0 ||
+          tensor_views_.count(root) != 0) {
+        continue;
+      }
+      tensor_views_[view] = TensorView{root, offset};
+      roots.insert(root);
+    }
+
+    // 输出引用输入的内存
+    for (size_t i = 0; i < outputs.size(); ++i) {
+      int input_index = -1;
+      size_t offset = 0;
+      if (!op->getOutputView((int)i, input_index, offset)) {
+        continue;
+      }
+      TensorWrapper *view = findTensorWrapper(tensor_repository_, outputs[i]);
+      TensorWrapper *src =
+          findTensorWrapper(tensor_repository_, inputs[input_index]);
+      if (!isTensorViewable(view) || src == nullptr || src->is_weight_) {
+        continue;
+      }
+      if (tensor_views_.count(view) != 0 || roots.count(view) != 0) {
+        continue;
+      }
+      TensorView tensor_view{src, offset};
+      auto iter = tensor_views_.find(src);
+      if (iter != tensor_views_.end()) {
+        tensor_view.root_ = iter->second.root_;
+        tensor_view.offset_ += iter->second.offset_;
+      }
+      tensor_views_[view] = tensor_view;
+      roots.insert(tensor_view.root_);
+    }
+  }
+  return base::kStatusCodeOk;
+}
+
+base::Status TensorPool::allocateTensorView() {
+  for (auto &iter : tensor_views_) {
+    device::Tensor *tensor = iter.first->tensor_;
+    device::Tensor *root = iter.second.root_->tensor_;
+    device::Buffer *buffer = op::createBufferView(
+        root->getBuffer(), iter.second.offset_, tensor->getDesc());
+    if (buffer == nullptr) {
+      // 无法引用时单独分配，Op::run会退化为拷贝
+      tensor->allocate(device_);
+    } else {
+      tensor->justModify(buffer, false);
+    }
+  }
+  return base::kStatusCodeOk;
+}
+
+base::Status TensorPool::deallocateTensorView() {
+  for (auto &iter : tensor_views_) {
+    iter.first->tensor_->deallocate();
+  }
+  return base::kStatusCodeOk;
+}
+
+base::Status TensorPool::updateTensorView() {
+  std::map<TensorWrapper *, TensorView> old_views;
+  old_views.swap(tensor_views_);
+  base::Status status = initTensorView();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk,
+                         "initTensorView failed");
+  std::map<TensorWrapper *, TensorView> new_views;
+  new_views.swap(tensor_views_);
+  // root的生命周期只覆盖原有的视图，因此只更新原有的视图
+  for (auto &iter : old_views) {
+    device::Tensor *tensor = iter.first->tensor_;
+    device::Buffer *buffer = nullptr;
+    auto new_iter = new_views.find(iter.first);
+    if (new_iter != new_views.end() &&
+        new_iter->second.root_ == iter.second.root_) {
+      iter.second = new_iter->second;
+      device::Tensor *root = iter.second.root_->tensor_;
+      buffer = op::createBufferView(root->getBuffer(), iter.second.offset_,
+                                    tensor->getDesc());
+    }
+    // 单独分配的tensor仍记录为视图，下次reshape时释放并重新尝试引用
+    if (buffer == nullptr) {
+      tensor->allocate(device_);
+    } else {
+      tensor->justModify(buffer, false);
+    }
+    tensor_views_[iter.first] = iter.second;
+  }
+  return base::kStatusCodeOk;
+}
+
+base::Status TensorPool::deinitTensorView() {
+  tensor_views_.clear();
+  return base::kStatusCodeOk;
+}
+
 std::map<TensorPoolType, std::shared_ptr<TensorPoolCreator>>
     &getGlobalTensorPoolCreatorMap() {
   static std::once_flag once;
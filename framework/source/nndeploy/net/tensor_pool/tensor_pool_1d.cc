@@ -19,13 +19,42 @@ TensorPool1DSharedObject::TensorPool1DSharedObject(
 
 TensorPool1DSharedObject::~TensorPool1DSharedObject() {}
 
+static std::array<int, 2> getTensorInterval(
+    TensorWrapper *tensor_wrapper, std::vector<OpWrapper *> &op_repository) {
+  int min = op_repository.size() - 1;
+  int max = 0;
+  std::vector<int> order_index = getOpOrderIndex(
+      tensor_wrapper->producers_, tensor_wrapper->consumers_, op_repository);
+  for (size_t j = 0; j < order_index.size(); j++) {
+    if (order_index[j] < min) {
+      min = order_index[j];
+    }
+    if (order_index[j] > max) {
+      max = order_index[j];
+    }
+  }
+  if (tensor_wrapper->input_output_type_ != kNone) {
+    // 打印tensor_repository的名字
+    NNDEPLOY_LOGE("Tensor name: %s\n",
+                  tensor_wrapper->tensor_->getName().c_str());
+    min = 0;
+    max = op_repository.size() - 1;
+  }
+  return {min, max};
+}
+
 base::Status TensorPool1DSharedObject::initTensorUsageRecord() {
   base::Status status = base::kStatusCodeOk;
 
+  std::map<TensorWrapper *, std::shared_ptr<TensorUsageRecord>> records;
   for (size_t i = 0; i < tensor_repository_.size(); i++) {
     if (tensor_repository_[i]->is_weight_) {
       continue;
     }
+    // 视图不单独分配内存
+    if (tensor_views_.count(tensor_repository_[i]) != 0) {
+      continue;
+    }
     // if (tensor_repository_[i]->input_output_type_ != kNone) {
     //   NNDEPLOY_LOGI("tensor name = %s.\n",
     //                 tensor_repository_[i]->tensor_->getName().c_str());
@@ -39,34 +68,27 @@ base::Status TensorPool1DSharedObject::initTensorUsageRecord() {
     device::BufferDesc buffer_desc =
         device_->toBufferDesc(tensor_desc, config_);
     tensor_usage_record->size_ = buffer_desc.getSize();
-    int min = op_repository_.size() - 1;
-    int max = 0;
-    std::vector<int> order_index =
-        getOpOrderIndex(tensor_repository_[i]->producers_,
-                        tensor_repository_[i]->consumers_, op_repository_);
-    for (size_t j = 0; j < order_index.size(); j++) {
-      if (order_index[j] < min) {
-        min = order_index[j];
-      }
-      if (order_index[j] > max) {
-        max = order_index[j];
-      }
-    }
-    if (tensor_repository_[i]->input_output_type_ != kNone) {
-      // 打印tensor_repository_的名字
-      NNDEPLOY_LOGE("Tensor name: %s\n",
-                    tensor_repository_[i]->tensor_->getName().c_str());
-      min = 0;
-      max = op_repository_.size() - 1;
-    }
-    tensor_usage_record->interval_[0] = min;
-    tensor_usage_record->interval_[1] = max;
+    tensor_usage_record->interval_ =
+        getTensorInterval(tensor_repository_[i], op_repository_);
     tensor_usage_records_.push_back(tensor_usage_record);
+    records[tensor_repository_[i]] = tensor_usage_record;
 
     // NNDEPLOY_LOGE("tensor name = %s.\n",
     //               tensor_repository_[i]->tensor_->getName().c_str());
     // NNDEPLOY_LOGE("min=%d, max=%d.\n", min, max);
   }
+  // 被引用的tensor的生命周期需要覆盖所有视图的生命周期
+  for (auto &iter : tensor_views_) {
+    auto record = records.find(iter.second.root_);
+    if (record == records.end()) {
+      continue;
+    }
+    std::array<int, 2> interval = getTensorInterval(iter.first, op_repository_);
+    record->second->interval_[0] =
+        std::min(record->second->interval_[0], interval[0]);
+    record->second->interval_[1] =
+        std::max(record->second->interval_[1], interval[1]);
+  }
   std::sort(tensor_usage_records_.begin(), tensor_usage_records_.end(),
             [](const std::shared_ptr<TensorUsageRecord> &a,
                const std::shared_ptr<TensorUsageRecord> &b) {
@@ -154,6 +176,13 @@ TensorPool1DSharedObjectGreedyBySizeImprove::
 base::Status TensorPool1DSharedObjectGreedyBySizeImprove::allocate() {
   base::Status status = base::kStatusCodeOk;
 
+  // 初始化tensor视图
+  status = initTensorView();
+  if (status != base::kStatusCodeOk) {
+    NNDEPLOY_LOGE("initTensorView failed\n");
+    return status;
+  }
+
   // 初始化TensorUsageRecord, 对tensor大小进行排序
   status = initTensorUsageRecord();
   if (status != base::kStatusCodeOk) {
@@ -275,12 +304,23 @@ base::Status TensorPool1DSharedObjectGreedyBySizeImprove::allocate() {
   // NNDEPLOY_LOGE("Total chunk size: %zu\n", total_chunk_size);
   chunkPrint(chunks_);
 
+  // 视图引用root的内存
+  status = allocateTensorView();
+  if (status != base::kStatusCodeOk) {
+    NNDEPLOY_LOGE("allocateTensorView failed\n");
+    return status;
+  }
+
   return status;
 }
 base::Status TensorPool1DSharedObjectGreedyBySizeImprove::deallocate() {
   base::Status status = base::kStatusCodeOk;
 
   for (auto tensor_wrapper : tensor_repository_) {
+    // 权重不由tensor pool分配，动态shape重新分配时需要保留
+    if (tensor_wrapper->is_weight_) {
+      continue;
+    }
     auto tensor = tensor_wrapper->tensor_;
     tensor->deallocate();
   }
@@ -290,6 +330,8 @@ base::Status TensorPool1DSharedObjectGreedyBySizeImprove::deallocate() {
       delete chunks_[i]->buffer_;
     }
   }
+  // 动态shape重新分配时不能复用已释放的chunk
+  chunks_.clear();
 
   status = deinitPositionalMaximum();
   if (status != base::kStatusCodeOk) {
@@ -309,6 +351,12 @@ base::Status TensorPool1DSharedObjectGreedyBySizeImprove::deallocate() {
     return status;
   }
 
+  status = deinitTensorView();
+  if (status != base::kStatusCodeOk) {
+    NNDEPLOY_LOGE("deinitTensorView failed\n");
+    return status;
+  }
+
   return status;
 }
 
@@ -329,6 +377,13 @@ TensorPool1DSharedObjectGreedyByBreadth::
 base::Status TensorPool1DSharedObjectGreedyByBreadth::allocate() {
   base::Status status = base::kStatusCodeOk;
 
+  // 初始化tensor视图
+  status = initTensorView();
+  if (status != base::kStatusCodeOk) {
+    NNDEPLOY_LOGE("initTensorView failed\n");
+    return status;
+  }
+
   // 初始化TensorUsageRecord, 对tensor大小进行排序
   status = initTensorUsageRecord();
   if (status != base::kStatusCodeOk) {
@@ -431,12 +486,23 @@ base::Status TensorPool1DSharedObjectGreedyByBreadth::allocate() {
     }
   }
 
+  // 视图引用root的内存
+  status = allocateTensorView();
+  if (status != base::kStatusCodeOk) {
+    NNDEPLOY_LOGE("allocateTensorView failed\n");
+    return status;
+  }
+
   return status;
 }
 base::Status TensorPool1DSharedObjectGreedyByBreadth::deallocate() {
   base::Status status = base::kStatusCodeOk;
 
   for (auto tensor_wrapper : tensor_repository_) {
+    // 权重不由tensor pool分配，动态shape重新分配时需要保留
+    if (tensor_wrapper->is_weight_) {
+      continue;
+    }
     auto tensor = tensor_wrapper->tensor_;
     tensor->deallocate();
   }
@@ -446,6 +512,8 @@ base::Status TensorPool1DSharedObjectGreedyByBreadth::deallocate() {
       delete chunks_[i]->buffer_;
     }
   }
+  // 动态shape重新分配时不能复用已释放的chunk
+  chunks_.clear();
 
   status = deinitPositionalMaximum();
   if (status != base::kStatusCodeOk) {
@@ -465,6 +533,12 @@ base::Status TensorPool1DSharedObjectGreedyByBreadth::deallocate() {
     return status;
   }
 
+  status = deinitTensorView();
+  if (status != base::kStatusCodeOk) {
+    NNDEPLOY_LOGE("deinitTensorView failed\n");
+    return status;
+  }
+
   chunk_sizes_.clear();
   chunk_schedules_.clear();
 
@@ -485,7 +559,16 @@ TensorPool1DSharedObjectNone::~TensorPool1DSharedObjectNone() {}
 base::Status TensorPool1DSharedObjectNone::allocate() {
   base::Status status = base::kStatusCodeOk;
 
+  status = initTensorView();
+  if (status != base::kStatusCodeOk) {
+    NNDEPLOY_LOGE("initTensorView failed\n");
+    return status;
+  }
+
   for (auto tensor_wrapper : tensor_repository_) {
+    if (tensor_views_.count(tensor_wrapper) != 0) {
+      continue;
+    }
     auto tensor = tensor_wrapper->tensor_;
     // 直接为每个tensor单独分配内存，不进行任何优化
     if (tensor->getBuffer() == nullptr) {
@@ -493,6 +576,13 @@ base::Status TensorPool1DSharedObjectNone::allocate() {
     }
   }
 
+  // 视图引用root的内存
+  status = allocateTensorView();
+  if (status != base::kStatusCodeOk) {
+    NNDEPLOY_LOGE("allocateTensorView failed\n");
+    return status;
+  }
+
   return status;
 }
 
@@ -500,11 +590,21 @@ base::Status TensorPool1DSharedObjectNone::deallocate() {
   base::Status status = base::kStatusCodeOk;
 
   for (auto tensor_wrapper : tensor_repository_) {
+    // 权重不由tensor pool分配，动态shape重新分配时需要保留
+    if (tensor_wrapper->is_weight_) {
+      continue;
+    }
     auto tensor = tensor_wrapper->tensor_;
     // 释放每个tensor的内存
     tensor->deallocate();
   }
 
+  status = deinitTensorView();
+  if (status != base::kStatusCodeOk) {
+    NNDEPLOY_LOGE("deinitTensorView failed\n");
+    return status;
+  }
+
   return status;
 }
 
@@ -0,0 +1,83 @@
+#include "nndeploy/op/op_binary.h"
+
+#include "nndeploy/base/common.h"
+#include "nndeploy/base/cpu_isa.h"
+#include "nndeploy/base/glic_stl_include.h"
+#include "nndeploy/base/log.h"
+#include "nndeploy/base/macro.h"
+#include "nndeploy/ir/ir.h"
+#include "nndeploy/op/op.h"
+
+// aarch64总是支持NEON，vdivq_f32也只在aarch64上可用
+#if defined(__aarch64__)
+#define NNDEPLOY_BINARY_NEON
+#include <arm_neon.h>
+#endif
+
+namespace nndeploy {
+namespace op {
+
+#ifdef NNDEPLOY_BINARY_NEON
+
+/**
+ * @brief 与binaryLoop相同的三种step组合，向量部分每次处理4个float
+ */
+#define NNDEPLOY_BINARY_NEON_LOOP(name, vec_op, op)                     \
+  static void name(const float *a, int a_step, const float *b,          \
+                   int b_step, float *c, size_t size) {                 \
+    size_t i = 0;                                                       \
+    if (a_step == 1 && b_step == 1) {                                   \
+      for (; i + 4 <= size; i += 4) {                                   \
+        vst1q_f32(c + i, vec_op(vld1q_f32(a + i), vld1q_f32(b + i)));   \
+      }                                                                 \
+      for (; i < size; ++i) {                                           \
+        c[i] = a[i] op b[i];                                            \
+      }                                                                 \
+    } else if (a_step == 1) {                                           \
+      const float value_b = b[0];                                       \
+      float32x4_t vb = vdupq_n_f32(value_b);                            \
+      for (; i + 4 <= size; i += 4) {                                   \
+        vst1q_f32(c + i, vec_op(vld1q_f32(a + i), vb));                 \
+      }                                                                 \
+      for (; i < size; ++i) {                                           \
+        c[i] = a[i] op value_b;                                         \
+      }                                                                 \
+    } else if (b_step == 1) {                                           \
+      const float value_a = a[0];                                       \
+      float32x4_t va = vdupq_n_f32(value_a);                            \
+      for (; i + 4 <= size; i += 4) {                                   \
+        vst1q_f32(c + i, vec_op(va, vld1q_f32(b + i)));                 \
+      }                                                                 \
+      for (; i < size; ++i) {                                           \
+        c[i] = value_a op b[i];                                         \
+      }                                                                 \
+    } else {                                                            \
+      const float value = a[0] op b[0];                                 \
+      float32x4_t vc = vdupq_n_f32(value);                              \
+      for (; i + 4 <= size; i += 4) {                                   \
+        vst1q_f32(c + i, vc);                                           \
+      }                                                                 \
+      for (; i < size; ++i) {                                           \
+        c[i] = value;                                                   \
+      }                                                                 \
+    }                                                                   \
+  }
+
+NNDEPLOY_BINARY_NEON_LOOP(addNeonLoop, vaddq_f32, +)
+NNDEPLOY_BINARY_NEON_LOOP(subNeonLoop, vsubq_f32, -)
+NNDEPLOY_BINARY_NEON_LOOP(mulNeonLoop, vmulq_f32, *)
+NNDEPLOY_BINARY_NEON_LOOP(divNeonLoop, vdivq_f32, /)
+
+REGISTER_OP_ISA_IMPLEMENTION(ir::kOpTypeAdd, base::dataTypeOf<float>(),
+                             base::kCpuIsaNeon, addNeonLoop)
+REGISTER_OP_ISA_IMPLEMENTION(ir::kOpTypeSub, base::dataTypeOf<float>(),
+                             base::kCpuIsaNeon, subNeonLoop)
+REGISTER_OP_ISA_IMPLEMENTION(ir::kOpTypeMul, base::dataTypeOf<float>(),
+                             base::kCpuIsaNeon, mulNeonLoop)
+REGISTER_OP_ISA_IMPLEMENTION(ir::kOpTypeDiv, base::dataTypeOf<float>(),
+                             base::kCpuIsaNeon, divNeonLoop)
+
+#endif
+
+}  // namespace op
+}  // namespace nndeploy
@@ -392,6 +392,36 @@ NNDEPLOY_CC_API std::shared_ptr<Expr> makeMaxPool(
   return expr;
 }
 
+// AveragePool
+NNDEPLOY_CC_API std::shared_ptr<Expr> makeAveragePool(
+    ir::ModelDesc *model_desc, std::shared_ptr<Expr> input,
+    std::shared_ptr<ir::AveragePoolParam> param, std::string op_name,
+    std::string output_name) {
+  std::string name = op_name;
+  if (name.empty()) {
+    if (model_desc != nullptr) {
+      int index = model_desc->op_descs_.size();
+      name = "averagepool" + std::to_string(index);
+    } else {
+      name = "averagepool";
+    }
+  }
+  std::vector<std::string> inputs = {input->getOutputName()[0]};
+  std::vector<std::string> outputs;
+  if (!output_name.empty()) {
+    outputs.push_back(output_name);
+  } else {
+    outputs.push_back(name + ".output");
+  }
+  auto op_desc = std::make_shared<ir::OpDesc>(name, ir::kOpTypeAveragePool,
+                                              inputs, outputs, param);
+  if (model_desc != nullptr) {
+    model_desc->op_descs_.push_back(op_desc);
+  }
+  auto expr = std::make_shared<Expr>(op_desc);
+  return expr;
+}
+
 // GlobalAveragePool
 NNDEPLOY_CC_API std::shared_ptr<Expr> makeGlobalAveragePool(
     ir::ModelDesc *model_desc, std::shared_ptr<Expr> input, std::string op_name,
@@ -421,5 +451,400 @@ NNDEPLOY_CC_API std::shared_ptr<Expr> makeGlobalAveragePool(
   return expr;
 }
 
+// RMSNorm
+NNDEPLOY_CC_API std::shared_ptr<Expr> makeRMSNorm(
+    ir::ModelDesc *model_desc, std::shared_ptr<Expr> input,
+    std::shared_ptr<ir::RMSNormParam> param, const std::string &weight,
+    std::shared_ptr<Expr> residual, std::string op_name,
+    std::string output_name) {
+  std::string name = op_name;
+  if (name.empty()) {
+    if (model_desc != nullptr) {
+      int index = model_desc->op_descs_.size();
+      name = "rmsnorm" + std::to_string(index);
+    } else {
+      name = "rmsnorm";
+    }
+  }
+  std::vector<std::string> inputs = {input->getOutputName()[0], weight};
+  if (residual != nullptr) {
+    inputs.push_back(residual->getOutputName()[0]);
+  }
+  std::vector<std::string> outputs;
+  if (!output_name.empty()) {
+    outputs.push_back(output_name);
+  } else {
+    outputs.push_back(name + ".output");
+  }
+  if (residual != nullptr) {
+    outputs.push_back(name + ".residual");
+  }
+  auto op_desc = std::make_shared<ir::OpDesc>(name, ir::kOpTypeRMSNorm, inputs,
+                                              outputs, param);
+  if (model_desc != nullptr) {
+    model_desc->op_descs_.push_back(op_desc);
+  }
+  auto expr = std::make_shared<Expr>(op_desc);
+  return expr;
+}
+
+// Attention
+NNDEPLOY_CC_API std::shared_ptr<Expr> makeAttention(
+    ir::ModelDesc *model_desc, std::shared_ptr<Expr> q,
+    std::shared_ptr<Expr> k, std::shared_ptr<Expr> v,
+    std::shared_ptr<ir::AttentionParam> param,
+    std::shared_ptr<Expr> attn_mask, std::string op_name,
+    std::string output_name) {
+  std::string name = op_name;
+  if (name.empty()) {
+    if (model_desc != nullptr) {
+      int index = model_desc->op_descs_.size();
+      name = "attention" + std::to_string(index);
+    } else {
+      name = "attention";
+    }
+  }
+  std::vector<std::string> inputs = {q->getOutputName()[0],
+                                     k->getOutputName()[0],
+                                     v->getOutputName()[0]};
+  if (attn_mask != nullptr) {
+    inputs.push_back(attn_mask->getOutputName()[0]);
+  }
+  std::vector<std::string> outputs;
+  if (!output_name.empty()) {
+    outputs.push_back(output_name);
+  } else {
+    outputs.push_back(name + ".output");
+  }
+  auto op_desc = std::make_shared<ir::OpDesc>(name, ir::kOpTypeAttention,
+                                              inputs, outputs, param);
+  if (model_desc != nullptr) {
+    model_desc->op_descs_.push_back(op_desc);
+  }
+  auto expr = std::make_shared<Expr>(op_desc);
+  return expr;
+}
+
+// RotaryEmbedding
+NNDEPLOY_CC_API std::shared_ptr<Expr> makeRotaryEmbedding(
+    ir::ModelDesc *model_desc, std::shared_ptr<Expr> input,
+    std::shared_ptr<ir::RotaryEmbeddingParam> param,
+    const std::string &cos_cache, const std::string &sin_cache,
+    std::shared_ptr<Expr> position_ids, std::string op_name,
+    std::string output_name) {
+  std::string name = op_name;
+  if (name.empty()) {
+    if (model_desc != nullptr) {
+      int index = model_desc->op_descs_.size();
+      name = "rotary_embedding" + std::to_string(index);
+    } else {
+      name = "rotary_embedding";
+    }
+  }
+  std::vector<std::string> inputs = {input->getOutputName()[0], cos_cache,
+                                     sin_cache};
+  if (position_ids != nullptr) {
+    inputs.push_back(position_ids->getOutputName()[0]);
+  }
+  std::vector<std::string> outputs;
+  if (!output_name.empty()) {
+    outputs.push_back(output_name);
+  } else {
+    outputs.push_back(name + ".output");
+  }
+  auto op_desc = std::make_shared<ir::OpDesc>(
+      name, ir::kOpTypeRotaryEmbedding, inputs, outputs, param);
+  if (model_desc != nullptr) {
+    model_desc->op_descs_.push_back(op_desc);
+  }
+  auto expr = std::make_shared<Expr>(op_desc);
+  return expr;
+}
+
+// SwiGLU
+NNDEPLOY_CC_API std::shared_ptr<Expr> makeSwiGLU(
+    ir::ModelDesc *model_desc, std::shared_ptr<Expr> gate,
+    std::shared_ptr<Expr> up, std::shared_ptr<ir::SwiGLUParam> param,
+    std::string op_name, std::string output_name) {
+  std::string name = op_name;
+  if (name.empty()) {
+    if (model_desc != nullptr) {
+      int index = model_desc->op_descs_.size();
+      name = "swiglu" + std::to_string(index);
+    } else {
+      name = "swiglu";
+    }
+  }
+  std::vector<std::string> inputs = {gate->getOutputName()[0]};
+  if (up != nullptr) {
+    inputs.push_back(up->getOutputName()[0]);
+  }
+  std::vector<std::string> outputs;
+  if (!output_name.empty()) {
+    outputs.push_back(output_name);
+  } else {
+    outputs.push_back(name + ".output");
+  }
+  auto op_desc = std::make_shared<ir::OpDesc>(name, ir::kOpTypeSwiGLU, inputs,
+                                              outputs, param);
+  if (model_desc != nullptr) {
+    model_desc->op_descs_.push_back(op_desc);
+  }
+  auto expr = std::make_shared<Expr>(op_desc);
+  return expr;
+}
+
+// Split
+std::vector<std::shared_ptr<Expr>> makeSplit(
+    ir::ModelDesc *model_desc, std::shared_ptr<Expr> input,
+    std::shared_ptr<ir::SplitParam> param, const std::string &split,
+    std::string op_name, std::string output_name) {
+  std::string name = op_name;
+  if (name.empty()) {
+    if (model_desc != nullptr) {
+      int index = model_desc->op_descs_.size();
+      name = "split" + std::to_string(index);
+    } else {
+      name = "split";
+    }
+  }
+  std::vector<std::string> inputs = {input->getOutputName()[0]};
+  if (!split.empty()) {
+    inputs.push_back(split);
+  }
+  std::string prefix = output_name.empty() ? name + ".output" : output_name;
+  std::vector<std::string> outputs;
+  for (int i = 0; i < param->num_outputs_; ++i) {
+    outputs.push_back(prefix + "." + std::to_string(i));
+  }
+  auto op_desc = std::make_shared<ir::OpDesc>(name, ir::kOpTypeSplit, inputs,
+                                              outputs, param);
+  if (model_desc != nullptr) {
+    model_desc->op_descs_.push_back(op_desc);
+  }
+  std::vector<std::shared_ptr<Expr>> exprs;
+  for (auto &output : outputs) {
+    exprs.push_back(std::make_shared<Expr>(output));
+  }
+  return exprs;
+}
+
+// Concat
+std::shared_ptr<Expr> makeConcat(ir::ModelDesc *model_desc,
+                                 std::vector<std::shared_ptr<Expr>> inputs,
+                                 std::shared_ptr<ir::ConcatParam> param,
+                                 std::string op_name,
+                                 std::string output_name) {
+  std::string name = op_name;
+  if (name.empty()) {
+    if (model_desc != nullptr) {
+      int index = model_desc->op_descs_.size();
+      name = "concat" + std::to_string(index);
+    } else {
+      name = "concat";
+    }
+  }
+  std::vector<std::string> input_names;
+  for (auto &input : inputs) {
+    input_names.push_back(input->getOutputName()[0]);
+  }
+  std::vector<std::string> outputs;
+  if (!output_name.empty()) {
+    outputs.push_back(output_name);
+  } else {
+    outputs.push_back(name + ".output");
+  }
+  auto op_desc = std::make_shared<ir::OpDesc>(name, ir::kOpTypeConcat,
+                                              input_names, outputs, param);
+  if (model_desc != nullptr) {
+    model_desc->op_descs_.push_back(op_desc);
+  }
+  auto expr = std::make_shared<Expr>(op_desc);
+  return expr;
+}
+
+// QuantizeLinear
+std::shared_ptr<Expr> makeQuantizeLinear(
+    ir::ModelDesc *model_desc, std::shared_ptr<Expr> input,
+    std::shared_ptr<ir::QuantizeLinearParam> param, const std::string &scale,
+    const std::string &zero_point, std::string op_name,
+    std::string output_name) {
+  std::string name = op_name;
+  if (name.empty()) {
+    if (model_desc != nullptr) {
+      int index = model_desc->op_descs_.size();
+      name = "quantize_linear" + std::to_string(index);
+    } else {
+      name = "quantize_linear";
+    }
+  }
+  std::vector<std::string> inputs = {input->getOutputName()[0], scale};
+  if (!zero_point.empty()) {
+    inputs.push_back(zero_point);
+  }
+  std::vector<std::string> outputs;
+  if (!output_name.empty()) {
+    outputs.push_back(output_name);
+  } else {
+    outputs.push_back(name + ".output");
+  }
+  auto op_desc = std::make_shared<ir::OpDesc>(
+      name, ir::kOpTypeQuantizeLinear, inputs, outputs, param);
+  if (model_desc != nullptr) {
+    model_desc->op_descs_.push_back(op_desc);
+  }
+  auto expr = std::make_shared<Expr>(op_desc);
+  return expr;
+}
+
+// DequantizeLinear
+std::shared_ptr<Expr> makeDequantizeLinear(
+    ir::ModelDesc *model_desc, std::shared_ptr<Expr> input,
+    std::shared_ptr<ir::DequantizeLinearParam> param, const std::string &scale,
+    const std::string &zero_point, std::string op_name,
+    std::string output_name) {
+  std::string name = op_name;
+  if (name.empty()) {
+    if (model_desc != nullptr) {
+      int index = model_desc->op_descs_.size();
+      name = "dequantize_linear" + std::to_string(index);
+    } else {
+      name = "dequantize_linear";
+    }
+  }
+  std::vector<std::string> inputs = {input->getOutputName()[0], scale};
+  if (!zero_point.empty()) {
+    inputs.push_back(zero_point);
+  }
+  std::vector<std::string> outputs;
+  if (!output_name.empty()) {
+    outputs.push_back(output_name);
+  } else {
+    outputs.push_back(name + ".output");
+  }
+  auto op_desc = std::make_shared<ir::OpDesc>(
+      name, ir::kOpTypeDequantizeLinear, inputs, outputs, param);
+  if (model_desc != nullptr) {
+    model_desc->op_descs_.push_back(op_desc);
+  }
+  auto expr = std::make_shared<Expr>(op_desc);
+  return expr;
+}
+
+// Reduce系列共用，name_prefix为默认op名的前缀
+static std::shared_ptr<Expr> makeReduce(
+    ir::ModelDesc *model_desc, ir::OpType op_type,
+    const std::string &name_prefix, std::shared_ptr<Expr> input,
+    std::shared_ptr<ir::ReduceParam> param, const std::string &axes,
+    std::string op_name, std::string output_name) {
+  std::string name = op_name;
+  if (name.empty()) {
+    if (model_desc != nullptr) {
+      int index = model_desc->op_descs_.size();
+      name = name_prefix + std::to_string(index);
+    } else {
+      name = name_prefix;
+    }
+  }
+  std::vector<std::string> inputs = {input->getOutputName()[0]};
+  if (!axes.empty()) {
+    inputs.push_back(axes);
+  }
+  std::vector<std::string> outputs;
+  if (!output_name.empty()) {
+    outputs.push_back(output_name);
+  } else {
+    outputs.push_back(name + ".output");
+  }
+  auto op_desc =
+      std::make_shared<ir::OpDesc>(name, op_type, inputs, outputs, param);
+  if (model_desc != nullptr) {
+    model_desc->op_descs_.push_back(op_desc);
+  }
+  auto expr = std::make_shared<Expr>(op_desc);
+  return expr;
+}
+
+std::shared_ptr<Expr> makeReduceL1(
+    ir::ModelDesc *model_desc, std::shared_ptr<Expr> input,
+    std::shared_ptr<ir::ReduceParam> param, const std::string &axes,
+    std::string op_name, std::string output_name) {
+  return makeReduce(model_desc, ir::kOpTypeReduceL1, "reduce_l1", input, param,
+                    axes, op_name, output_name);
+}
+
+std::shared_ptr<Expr> makeReduceL2(
+    ir::ModelDesc *model_desc, std::shared_ptr<Expr> input,
+    std::shared_ptr<ir::ReduceParam> param, const std::string &axes,
+    std::string op_name, std::string output_name) {
+  return makeReduce(model_desc, ir::kOpTypeReduceL2, "reduce_l2", input, param,
+                    axes, op_name, output_name);
+}
+
+std::shared_ptr<Expr> makeReduceLogSum(
+    ir::ModelDesc *model_desc, std::shared_ptr<Expr> input,
+    std::shared_ptr<ir::ReduceParam> param, const std::string &axes,
+    std::string op_name, std::string output_name) {
+  return makeReduce(model_desc, ir::kOpTypeReduceLogSum, "reduce_log_sum",
+                    input, param, axes, op_name, output_name);
+}
+
+std::shared_ptr<Expr> makeReduceLogSumExp(
+    ir::ModelDesc *model_desc, std::shared_ptr<Expr> input,
+    std::shared_ptr<ir::ReduceParam> param, const std::string &axes,
+    std::string op_name, std::string output_name) {
+  return makeReduce(model_desc, ir::kOpTypeReduceLogSumExp,
+                    "reduce_log_sum_exp", input, param, axes, op_name,
+                    output_name);
+}
+
+std::shared_ptr<Expr> makeReduceMax(
+    ir::ModelDesc *model_desc, std::shared_ptr<Expr> input,
+    std::shared_ptr<ir::ReduceParam> param, const std::string &axes,
+    std::string op_name, std::string output_name) {
+  return makeReduce(model_desc, ir::kOpTypeReduceMax, "reduce_max", input,
+                    param, axes, op_name, output_name);
+}
+
+std::shared_ptr<Expr> makeReduceMean(
+    ir::ModelDesc *model_desc, std::shared_ptr<Expr> input,
+    std::shared_ptr<ir::ReduceParam> param, const std::string &axes,
+    std::string op_name, std::string output_name) {
+  return makeReduce(model_desc, ir::kOpTypeReduceMean, "reduce_mean", input,
+                    param, axes, op_name, output_name);
+}
+
+std::shared_ptr<Expr> makeReduceMin(
+    ir::ModelDesc *model_desc, std::shared_ptr<Expr> input,
+    std::shared_ptr<ir::ReduceParam> param, const std::string &axes,
+    std::string op_name, std::string output_name) {
+  return makeReduce(model_desc, ir::kOpTypeReduceMin, "reduce_min", input,
+                    param, axes, op_name, output_name);
+}
+
+std::shared_ptr<Expr> makeReduceProd(
+    ir::ModelDesc *model_desc, std::shared_ptr<Expr> input,
+    std::shared_ptr<ir::ReduceParam> param, const std::string &axes,
+    std::string op_name, std::string output_name) {
+  return makeReduce(model_desc, ir::kOpTypeReduceProd, "reduce_prod", input,
+                    param, axes, op_name, output_name);
+}
+
+std::shared_ptr<Expr> makeReduceSum(
+    ir::ModelDesc *model_desc, std::shared_ptr<Expr> input,
+    std::shared_ptr<ir::ReduceParam> param, const std::string &axes,
+    std::string op_name, std::string output_name) {
+  return makeReduce(model_desc, ir::kOpTypeReduceSum, "reduce_sum", input,
+                    param, axes, op_name, output_name);
+}
+
+std::shared_ptr<Expr> makeReduceSumSquare(
+    ir::ModelDesc *model_desc, std::shared_ptr<Expr> input,
+    std::shared_ptr<ir::ReduceParam> param, const std::string &axes,
+    std::string op_name, std::string output_name) {
+  return makeReduce(model_desc, ir::kOpTypeReduceSumSquare, "reduce_sum_square",
+                    input, param, axes, op_name, output_name);
+}
+
 }  // namespace op
 }  // namespace nndeploy
\ No newline at end of file
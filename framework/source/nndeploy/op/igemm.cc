@@ -0,0 +1,481 @@
+#include "nndeploy/op/igemm.h"
+
+#include "nndeploy/base/common.h"
+#include "nndeploy/base/cpu_isa.h"
+#include "nndeploy/base/glic_stl_include.h"
+#include "nndeploy/base/log.h"
+#include "nndeploy/base/macro.h"
+#include "nndeploy/base/status.h"
+#include "nndeploy/op/sgemm.h"
+#include "nndeploy/thread_pool/parallel.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && \
+    (defined(__GNUC__) || defined(__clang__))
+#define NNDEPLOY_IGEMM_X86
+#include <immintrin.h>
+#define NNDEPLOY_IGEMM_AVX2 __attribute__((target("avx2")))
+#define NNDEPLOY_IGEMM_AVX512_VNNI \
+  __attribute__((target("avx2,avx512f,avx512bw,avx512vl,avx512vnni")))
+#endif
+
+namespace nndeploy {
+namespace op {
+
+// 每个tile的A的行数
+static const int kIGemmMr = 4;
+// 每个tile的输出通道数，也是权重打包的panel宽度
+static const int kIGemmNr = 16;
+// 每个任务的A的行数，任务内A的分块常驻L2
+static const int kIGemmTaskM = 64;
+// 每个任务的panel数
+static const int kIGemmTaskPanel = 4;
+// 打包buffer与workspace的对齐
+static const size_t kIGemmAlign = 64;
+
+static size_t alignIGemmSize(size_t size) {
+  return (size + kIGemmAlign - 1) / kIGemmAlign * kIGemmAlign;
+}
+
+/**
+ * @brief 打包权重的头部，紧随其后依次为码值[np_ / 16][kp_ / 4][16][4]、
+ * 零点[np_]与权重和[np_]
+ */
+struct IGemmPackedHeader {
+  int n_;
+  int k_;
+  int np_;
+  int kp_;
+  // 为false时所有零点为0，不需要计算A的行和
+  bool has_zero_point_;
+  size_t zero_points_offset_;
+  size_t sums_offset_;
+};
+
+bool isIGemmDataType(const base::DataType &data_type) {
+  return (data_type.code_ == base::kDataTypeCodeInt ||
+          data_type.code_ == base::kDataTypeCodeUint) &&
+         data_type.bits_ == 8 && data_type.lanes_ == 1;
+}
+
+int igemmPaddedK(int k) { return (k + 3) / 4 * 4; }
+
+static int igemmPaddedN(int n) {
+  return (n + kIGemmNr - 1) / kIGemmNr * kIGemmNr;
+}
+
+size_t igemmPackedBSize(int n, int k) {
+  size_t np = igemmPaddedN(n);
+  return alignIGemmSize(sizeof(IGemmPackedHeader)) +
+         alignIGemmSize(np * igemmPaddedK(k)) +
+         2 * alignIGemmSize(sizeof(int32_t) * np);
+}
+
+// 读取权重并转为int8的值
+static inline int getIGemmValue(const void *data, bool is_uint8,
+                                size_t index) {
+  if (is_uint8) {
+    return static_cast<const uint8_t *>(data)[index] - 128;
+  }
+  return static_cast<const int8_t *>(data)[index];
+}
+
+base::Status igemmPackB(const IGemmWeight &weight, void *packed_b) {
+  if (!isIGemmDataType(weight.data_type_)) {
+    NNDEPLOY_LOGE("igemm weight must be int8/uint8.\n");
+    return base::kStatusCodeErrorInvalidParam;
+  }
+  if (weight.zero_points_ != nullptr && weight.zero_point_num_ != 1 &&
+      weight.zero_point_num_ != weight.n_) {
+    NNDEPLOY_LOGE("weight zero point num[%d] must be 1 or %d.\n",
+                  weight.zero_point_num_, weight.n_);
+    return base::kStatusCodeErrorInvalidParam;
+  }
+  const int n = weight.n_;
+  const int k = weight.k_;
+  const int np = igemmPaddedN(n);
+  const int kp = igemmPaddedK(k);
+  const bool is_uint8 = weight.data_type_.code_ == base::kDataTypeCodeUint;
+
+  uint8_t *dst = static_cast<uint8_t *>(packed_b);
+  IGemmPackedHeader *header = reinterpret_cast<IGemmPackedHeader *>(dst);
+  header->n_ = n;
+  header->k_ = k;
+  header->np_ = np;
+  header->kp_ = kp;
+  size_t codes_offset = alignIGemmSize(sizeof(IGemmPackedHeader));
+  header->zero_points_offset_ =
+      codes_offset + alignIGemmSize((size_t)np * kp);
+  header->sums_offset_ =
+      header->zero_points_offset_ + alignIGemmSize(sizeof(int32_t) * np);
+  int8_t *codes = reinterpret_cast<int8_t *>(dst + codes_offset);
+  int32_t *zero_points =
+      reinterpret_cast<int32_t *>(dst + header->zero_points_offset_);
+  int32_t *sums = reinterpret_cast<int32_t *>(dst + header->sums_offset_);
+
+  const int kb_num = kp / 4;
+  header->has_zero_point_ = false;
+  for (int j = 0; j < np; ++j) {
+    int8_t *panel = codes + (size_t)(j / kIGemmNr) * kIGemmNr * kp;
+    int col = j % kIGemmNr;
+    int32_t sum = 0;
+    for (int kb = 0; kb < kb_num; ++kb) {
+      for (int t = 0; t < 4; ++t) {
+        int i = kb * 4 + t;
+        int value = 0;
+        if (j < n && i < k) {
+          value = getIGemmValue(
+              weight.data_, is_uint8,
+              (size_t)j * weight.stride_n_ + (size_t)i * weight.stride_k_);
+        }
+        panel[(kb * kIGemmNr + col) * 4 + t] = static_cast<int8_t>(value);
+        sum += value;
+      }
+    }
+    int zero_point = is_uint8 ? -128 : 0;
+    if (j < n && weight.zero_points_ != nullptr) {
+      zero_point = getIGemmValue(weight.zero_points_, is_uint8,
+                                 weight.zero_point_num_ == 1 ? 0 : j);
+    }
+    zero_points[j] = zero_point;
+    sums[j] = sum;
+    if (j < n && zero_point != 0) {
+      header->has_zero_point_ = true;
+    }
+  }
+  return base::kStatusCodeOk;
+}
+
+size_t igemmWorkspaceSize(int m, int n) {
+  return alignIGemmSize(sizeof(int32_t) * m) +
+         alignIGemmSize(sizeof(int32_t) * igemmPaddedN(n));
+}
+
+/**
+ * @brief 计算一个tile的int32结果 acc[mr][16] = A[mr, kp] * panel
+ */
+typedef void (*IGemmTileFunc)(const uint8_t *a, int lda, int mr,
+                              const int8_t *panel, int kp, int32_t *acc);
+
+static void igemmTileScalar(const uint8_t *a, int lda, int mr,
+                            const int8_t *panel, int kp, int32_t *acc) {
+  const int kb_num = kp / 4;
+  for (int i = 0; i < mr; ++i) {
+    const uint8_t *row = a + (size_t)i * lda;
+    int32_t *dst = acc + i * kIGemmNr;
+    for (int j = 0; j < kIGemmNr; ++j) {
+      dst[j] = 0;
+    }
+    for (int kb = 0; kb < kb_num; ++kb) {
+      const int8_t *w = panel + kb * kIGemmNr * 4;
+      const uint8_t *x = row + kb * 4;
+      for (int j = 0; j < kIGemmNr; ++j) {
+        dst[j] += x[0] * w[j * 4] + x[1] * w[j * 4 + 1] +
+                  x[2] * w[j * 4 + 2] + x[3] * w[j * 4 + 3];
+      }
+    }
+  }
+}
+
+#ifdef NNDEPLOY_IGEMM_X86
+static inline int32_t loadIGemmA4(const uint8_t *x) {
+  int32_t value;
+  memcpy(&value, x, sizeof(value));
+  return value;
+}
+
+template <int MR>
+NNDEPLOY_IGEMM_AVX512_VNNI static void igemmTileAvx512VnniImpl(
+    const uint8_t *a, int lda, const int8_t *panel, int kp, int32_t *acc) {
+  __m256i c0[MR];
+  __m256i c1[MR];
+  for (int i = 0; i < MR; ++i) {
+    c0[i] = _mm256_setzero_si256();
+    c1[i] = _mm256_setzero_si256();
+  }
+  const int kb_num = kp / 4;
+  for (int kb = 0; kb < kb_num; ++kb) {
+    const int8_t *w = panel + kb * kIGemmNr * 4;
+    __m256i w0 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(w));
+    __m256i w1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(w + 32));
+    for (int i = 0; i < MR; ++i) {
+      __m256i x = _mm256_set1_epi32(loadIGemmA4(a + (size_t)i * lda + kb * 4));
+      c0[i] = _mm256_dpbusd_epi32(c0[i], x, w0);
+      c1[i] = _mm256_dpbusd_epi32(c1[i], x, w1);
+    }
+  }
+  for (int i = 0; i < MR; ++i) {
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(acc + i * kIGemmNr),
+                        c0[i]);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(acc + i * kIGemmNr + 8),
+                        c1[i]);
+  }
+}
+
+static void igemmTileAvx512Vnni(const uint8_t *a, int lda, int mr,
+                                const int8_t *panel, int kp, int32_t *acc) {
+  switch (mr) {
+    case 1:
+      igemmTileAvx512VnniImpl<1>(a, lda, panel, kp, acc);
+      break;
+    case 2:
+      igemmTileAvx512VnniImpl<2>(a, lda, panel, kp, acc);
+      break;
+    case 3:
+      igemmTileAvx512VnniImpl<3>(a, lda, panel, kp, acc);
+      break;
+    default:
+      igemmTileAvx512VnniImpl<4>(a, lda, panel, kp, acc);
+      break;
+  }
+}
+
+// 每个输出通道的4个码值扩展为int16后与A做vpmaddwd，
+// 结果中相邻两个int32属于同一输出通道
+template <int MR>
+NNDEPLOY_IGEMM_AVX2 static void igemmTileAvx2Impl(const uint8_t *a, int lda,
+                                                  const int8_t *panel, int kp,
+                                                  int32_t *acc) {
+  __m256i c[MR][4];
+  for (int i = 0; i < MR; ++i) {
+    for (int j = 0; j < 4; ++j) {
+      c[i][j] = _mm256_setzero_si256();
+    }
+  }
+  const int kb_num = kp / 4;
+  for (int kb = 0; kb < kb_num; ++kb) {
+    const int8_t *w = panel + kb * kIGemmNr * 4;
+    __m256i w0 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(w));
+    __m256i w1 = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(w + 32));
+    __m256i w16[4];
+    w16[0] = _mm256_cvtepi8_epi16(_mm256_castsi256_si128(w0));
+    w16[1] = _mm256_cvtepi8_epi16(_mm256_extracti128_si256(w0, 1));
+    w16[2] = _mm256_cvtepi8_epi16(_mm256_castsi256_si128(w1));
+    w16[3] = _mm256_cvtepi8_epi16(_mm256_extracti128_si256(w1, 1));
+    for (int i = 0; i < MR; ++i) {
+      const uint8_t *x = a + (size_t)i * lda + kb * 4;
+      int64_t x16 = (int64_t)x[0] | ((int64_t)x[1] << 16) |
+                    ((int64_t)x[2] << 32) | ((int64_t)x[3] << 48);
+      __m256i xv = _mm256_set1_epi64x(x16);
+      for (int j = 0; j < 4; ++j) {
+        c[i][j] = _mm256_add_epi32(c[i][j], _mm256_madd_epi16(xv, w16[j]));
+      }
+    }
+  }
+  for (int i = 0; i < MR; ++i) {
+    // hadd后为[n0 n1 n4 n5 | n2 n3 n6 n7]，再按64位重排
+    __m256i r0 = _mm256_permute4x64_epi64(_mm256_hadd_epi32(c[i][0], c[i][1]),
+                                          0xD8);
+    __m256i r1 = _mm256_permute4x64_epi64(_mm256_hadd_epi32(c[i][2], c[i][3]),
+                                          0xD8);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(acc + i * kIGemmNr), r0);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(acc + i * kIGemmNr + 8),
+                        r1);
+  }
+}
+
+static void igemmTileAvx2(const uint8_t *a, int lda, int mr,
+                          const int8_t *panel, int kp, int32_t *acc) {
+  // 每次两行，避免累加寄存器溢出
+  for (int i = 0; i < mr; i += 2) {
+    if (mr - i >= 2) {
+      igemmTileAvx2Impl<2>(a + (size_t)i * lda, lda, panel, kp,
+                           acc + i * kIGemmNr);
+    } else {
+      igemmTileAvx2Impl<1>(a + (size_t)i * lda, lda, panel, kp,
+                           acc + i * kIGemmNr);
+    }
+  }
+}
+#endif
+
+/**
+ * @brief 按cpu特性选择的tile kernel
+ */
+struct IGemmKernel {
+  const char *name_;
+  IGemmTileFunc tile_;
+};
+
+#ifdef NNDEPLOY_IGEMM_X86
+static const IGemmKernel kIGemmAvx512Vnni = {"avx512vnni", igemmTileAvx512Vnni};
+static const IGemmKernel kIGemmAvx2 = {"avx2", igemmTileAvx2};
+#endif
+static const IGemmKernel kIGemmScalar = {"scalar", igemmTileScalar};
+
+// 每次调用时按当前生效的指令集级别选择，受base::setCpuIsa的限制
+static const IGemmKernel &getIGemmKernel() {
+#ifdef NNDEPLOY_IGEMM_X86
+  if (base::isCpuIsaSupported(base::kCpuIsaAvx512Vnni)) {
+    return kIGemmAvx512Vnni;
+  }
+  if (base::isCpuIsaSupported(base::kCpuIsaAvx2)) {
+    return kIGemmAvx2;
+  }
+#endif
+  return kIGemmScalar;
+}
+
+struct IGemmArgs {
+  int m_;
+  int n_;
+  const uint8_t *a_;
+  int lda_;
+  const IGemmPackedHeader *header_;
+  const int8_t *codes_;
+  const int32_t *zero_points_;
+  // 每行A的和，所有零点为0时为nullptr
+  const int32_t *a_sums_;
+  // bias与不依赖A的零点修正
+  const int32_t *offsets_;
+  const IGemmOutput *output_;
+  SgemmEpilogueFunc act_;
+  IGemmTileFunc tile_;
+};
+
+// tile的重量化: int32 -> float -> 激活 -> int8/uint8
+static void igemmRequantizeTile(const IGemmArgs &args, int m_begin, int mr,
+                                int n_begin, int nr, const int32_t *acc) {
+  const IGemmOutput &output = *args.output_;
+  float tile[kIGemmMr * kIGemmNr];
+  for (int i = 0; i < mr; ++i) {
+    int32_t a_sum = args.a_sums_ != nullptr ? args.a_sums_[m_begin + i] : 0;
+    for (int j = 0; j < nr; ++j) {
+      int n = n_begin + j;
+      int32_t value = acc[i * kIGemmNr + j] + args.offsets_[n] -
+                      args.zero_points_[n] * a_sum;
+      tile[i * kIGemmNr + j] = value * output.scales_[n];
+    }
+  }
+  if (args.act_ != nullptr) {
+    args.act_(tile, kIGemmNr, mr, nr, nullptr);
+  }
+  const float inv_scale = 1.0f / output.y_scale_;
+  const bool is_uint8 = output.y_data_type_.code_ == base::kDataTypeCodeUint;
+  const int q_min = is_uint8 ? 0 : -128;
+  const int q_max = is_uint8 ? 255 : 127;
+  for (int i = 0; i < mr; ++i) {
+    size_t offset = (size_t)(m_begin + i) * output.stride_m_ +
+                    (size_t)n_begin * output.stride_n_;
+    for (int j = 0; j < nr; ++j) {
+      int q = static_cast<int>(std::nearbyint(tile[i * kIGemmNr + j] *
+                                              inv_scale)) +
+              output.y_zero_point_;
+      q = std::min(std::max(q, q_min), q_max);
+      size_t index = offset + (size_t)j * output.stride_n_;
+      if (is_uint8) {
+        static_cast<uint8_t *>(output.y_)[index] = static_cast<uint8_t>(q);
+      } else {
+        static_cast<int8_t *>(output.y_)[index] = static_cast<int8_t>(q);
+      }
+    }
+  }
+}
+
+class IGemmLoopBody : public thread_pool::ParallelLoopBody {
+ public:
+  IGemmLoopBody(const IGemmArgs &args, int panel_task_num)
+      : args_(args), panel_task_num_(panel_task_num) {}
+
+  virtual void operator()(const base::Range &range) const {
+    const int kp = args_.header_->kp_;
+    const int panel_num = args_.header_->np_ / kIGemmNr;
+    int32_t acc[kIGemmMr * kIGemmNr];
+    for (int task = range.start_; task < range.end_; ++task) {
+      int m_begin = (task / panel_task_num_) * kIGemmTaskM;
+      int m_end = std::min(m_begin + kIGemmTaskM, args_.m_);
+      int panel_begin = (task % panel_task_num_) * kIGemmTaskPanel;
+      int panel_end = std::min(panel_begin + kIGemmTaskPanel, panel_num);
+      for (int p = panel_begin; p < panel_end; ++p) {
+        const int8_t *panel = args_.codes_ + (size_t)p * kIGemmNr * kp;
+        int n_begin = p * kIGemmNr;
+        int nr = std::min(kIGemmNr, args_.n_ - n_begin);
+        for (int m = m_begin; m < m_end; m += kIGemmMr) {
+          int mr = std::min(kIGemmMr, m_end - m);
+          args_.tile_(args_.a_ + (size_t)m * args_.lda_, args_.lda_, mr, panel,
+                      kp, acc);
+          igemmRequantizeTile(args_, m, mr, n_begin, nr, acc);
+        }
+      }
+    }
+  }
+
+ private:
+  IGemmArgs args_;
+  int panel_task_num_;
+};
+
+base::Status igemm(int m, int n, int k, const uint8_t *a, int lda,
+                   int a_zero_point, const void *packed_b,
+                   const IGemmOutput &output, void *workspace) {
+  const uint8_t *src = static_cast<const uint8_t *>(packed_b);
+  const IGemmPackedHeader *header =
+      reinterpret_cast<const IGemmPackedHeader *>(src);
+  if (header->n_ != n || header->k_ != k) {
+    NNDEPLOY_LOGE("packed weight is [%d, %d], expect [%d, %d].\n", header->n_,
+                  header->k_, n, k);
+    return base::kStatusCodeErrorInvalidParam;
+  }
+  if (!isIGemmDataType(output.y_data_type_) || output.y_scale_ == 0.0f) {
+    NNDEPLOY_LOGE("igemm output must be int8/uint8 with non-zero scale.\n");
+    return base::kStatusCodeErrorInvalidParam;
+  }
+  SgemmEpilogue epilogue;
+  epilogue.activate_op_ = output.activate_op_;
+  if (!isSgemmActivateSupported(epilogue.activate_op_)) {
+    NNDEPLOY_LOGE("igemm not support activate op[%s].\n",
+                  ir::opTypeToString(epilogue.activate_op_).c_str());
+    return base::kStatusCodeErrorNotImplement;
+  }
+  const int32_t *zero_points =
+      reinterpret_cast<const int32_t *>(src + header->zero_points_offset_);
+  const int32_t *sums =
+      reinterpret_cast<const int32_t *>(src + header->sums_offset_);
+
+  // 零点修正中只与行或列相关的部分
+  uint8_t *ws = static_cast<uint8_t *>(workspace);
+  int32_t *a_sums = reinterpret_cast<int32_t *>(ws);
+  int32_t *offsets = reinterpret_cast<int32_t *>(
+      ws + alignIGemmSize(sizeof(int32_t) * m));
+  if (header->has_zero_point_) {
+    for (int i = 0; i < m; ++i) {
+      const uint8_t *row = a + (size_t)i * lda;
+      int32_t sum = 0;
+      for (int j = 0; j < k; ++j) {
+        sum += row[j];
+      }
+      a_sums[i] = sum;
+    }
+  }
+  for (int j = 0; j < n; ++j) {
+    int32_t bias = output.bias_ != nullptr ? output.bias_[j] : 0;
+    offsets[j] =
+        bias - a_zero_point * sums[j] + k * a_zero_point * zero_points[j];
+  }
+
+  IGemmArgs args;
+  args.m_ = m;
+  args.n_ = n;
+  args.a_ = a;
+  args.lda_ = lda;
+  args.header_ = header;
+  args.codes_ = reinterpret_cast<const int8_t *>(
+      src + alignIGemmSize(sizeof(IGemmPackedHeader)));
+  args.zero_points_ = zero_points;
+  args.a_sums_ = header->has_zero_point_ ? a_sums : nullptr;
+  args.offsets_ = offsets;
+  args.output_ = &output;
+  epilogue.bias_ = nullptr;
+  args.act_ = getSgemmEpilogueFunc(epilogue);
+  args.tile_ = getIGemmKernel().tile_;
+
+  int panel_num = header->np_ / kIGemmNr;
+  int panel_task_num = (panel_num + kIGemmTaskPanel - 1) / kIGemmTaskPanel;
+  int task_num = (m + kIGemmTaskM - 1) / kIGemmTaskM * panel_task_num;
+  IGemmLoopBody body(args, panel_task_num);
+  thread_pool::parallelForWithCost(base::Range(0, task_num), body,
+                                    (uint64_t)m * n * k);
+  return base::kStatusCodeOk;
+}
+
+}  // namespace op
+}  // namespace nndeploy
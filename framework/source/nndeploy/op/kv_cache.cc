@@ -0,0 +1,264 @@
+#include "nndeploy/op/kv_cache.h"
+
+#include "nndeploy/base/shape.h"
+#include "nndeploy/device/buffer.h"
+
+namespace nndeploy {
+namespace op {
+
+KVCache::KVCache(device::Device *device, const KVCacheParam &param)
+    : device_(device), param_(param) {
+  head_size_bytes_ = (size_t)param_.block_tokens_ * param_.head_size_ *
+                     param_.data_type_.size();
+  block_size_ = (size_t)param_.num_layers_ * 2 * param_.num_kv_heads_ *
+                head_size_bytes_;
+}
+
+KVCache::~KVCache() { this->deinit(); }
+
+base::Status KVCache::init(int num_tokens) {
+  if (param_.num_layers_ <= 0 || param_.num_kv_heads_ <= 0 ||
+      param_.head_size_ <= 0 || param_.block_tokens_ <= 0) {
+    NNDEPLOY_LOGE("invalid kv cache param.\n");
+    return base::kStatusCodeErrorInvalidParam;
+  }
+  if (memory_pool_ == nullptr) {
+    memory_pool_ = new device::BlockMemoryPool(device_, block_size_,
+                                               param_.blocks_per_chunk_);
+  }
+  if (num_tokens > 0) {
+    size_t block_num =
+        (num_tokens + param_.block_tokens_ - 1) / param_.block_tokens_;
+    return memory_pool_->init(block_num * block_size_);
+  }
+  return base::kStatusCodeOk;
+}
+
+base::Status KVCache::deinit() {
+  for (auto &iter : sequences_) {
+    for (auto block : iter.second.blocks_) {
+      releaseBlock(block);
+    }
+  }
+  sequences_.clear();
+  if (memory_pool_ != nullptr) {
+    memory_pool_->deinit();
+    delete memory_pool_;
+    memory_pool_ = nullptr;
+  }
+  return base::kStatusCodeOk;
+}
+
+int KVCache::createSequence() {
+  int seq_id = next_seq_id_++;
+  sequences_[seq_id] = KVSequence();
+  return seq_id;
+}
+
+int KVCache::forkSequence(int seq_id) {
+  auto iter = sequences_.find(seq_id);
+  if (iter == sequences_.end()) {
+    NNDEPLOY_LOGE("sequence[%d] does not exist.\n", seq_id);
+    return -1;
+  }
+  int new_seq_id = next_seq_id_++;
+  KVSequence &seq = sequences_[new_seq_id];
+  seq = iter->second;
+  for (auto block : seq.blocks_) {
+    block_ref_count_[block]++;
+  }
+  return new_seq_id;
+}
+
+base::Status KVCache::freeSequence(int seq_id) {
+  auto iter = sequences_.find(seq_id);
+  if (iter == sequences_.end()) {
+    NNDEPLOY_LOGE("sequence[%d] does not exist.\n", seq_id);
+    return base::kStatusCodeErrorInvalidParam;
+  }
+  for (auto block : iter->second.blocks_) {
+    releaseBlock(block);
+  }
+  sequences_.erase(iter);
+  return base::kStatusCodeOk;
+}
+
+base::Status KVCache::appendSlots(int seq_id, int num_tokens) {
+  auto iter = sequences_.find(seq_id);
+  if (iter == sequences_.end()) {
+    NNDEPLOY_LOGE("sequence[%d] does not exist.\n", seq_id);
+    return base::kStatusCodeErrorInvalidParam;
+  }
+  if (memory_pool_ == nullptr) {
+    NNDEPLOY_LOGE("kv cache is not initialized.\n");
+    return base::kStatusCodeErrorInvalidValue;
+  }
+  KVSequence &seq = iter->second;
+  // 最后一块未满且被共享时，新token会写入该块，先复制
+  if (num_tokens > 0 && seq.length_ % param_.block_tokens_ != 0) {
+    void *last = seq.blocks_.back();
+    if (block_ref_count_[last] > 1) {
+      void *block = allocateBlock();
+      if (block == nullptr) {
+        return base::kStatusCodeErrorOutOfMemory;
+      }
+      base::Status status = device_->copy(last, block, block_size_);
+      if (status != base::kStatusCodeOk) {
+        NNDEPLOY_LOGE("copy failed.\n");
+        releaseBlock(block);
+        return status;
+      }
+      releaseBlock(last);
+      seq.blocks_.back() = block;
+    }
+  }
+  int length = seq.length_ + num_tokens;
+  size_t block_num =
+      (length + param_.block_tokens_ - 1) / param_.block_tokens_;
+  // 申请失败时释放本次申请的块，序列保持原来的长度
+  size_t old_block_num = seq.blocks_.size();
+  while (seq.blocks_.size() < block_num) {
+    void *block = allocateBlock();
+    if (block == nullptr) {
+      while (seq.blocks_.size() > old_block_num) {
+        releaseBlock(seq.blocks_.back());
+        seq.blocks_.pop_back();
+      }
+      return base::kStatusCodeErrorOutOfMemory;
+    }
+    seq.blocks_.push_back(block);
+  }
+  seq.length_ = length;
+  return base::kStatusCodeOk;
+}
+
+base::Status KVCache::writeKV(int seq_id, int layer, device::Tensor *k,
+                              device::Tensor *v) {
+  auto iter = sequences_.find(seq_id);
+  if (iter == sequences_.end()) {
+    NNDEPLOY_LOGE("sequence[%d] does not exist.\n", seq_id);
+    return base::kStatusCodeErrorInvalidParam;
+  }
+  if (layer < 0 || layer >= param_.num_layers_) {
+    NNDEPLOY_LOGE("layer[%d] is out of range.\n", layer);
+    return base::kStatusCodeErrorInvalidParam;
+  }
+  base::IntVector shape = k->getShape();
+  int rank = (int)shape.size();
+  bool valid = rank >= 3 && shape[rank - 3] == param_.num_kv_heads_ &&
+               shape[rank - 1] == param_.head_size_ &&
+               base::shapeEqual(shape, v->getShape()) &&
+               k->getDataType() == param_.data_type_ &&
+               v->getDataType() == param_.data_type_;
+  for (int i = 0; valid && i < rank - 3; ++i) {
+    valid = shape[i] == 1;
+  }
+  if (!valid) {
+    NNDEPLOY_LOGE("k, v must be [num_kv_heads, num_tokens, head_size].\n");
+    return base::kStatusCodeErrorInvalidParam;
+  }
+  KVSequence &seq = iter->second;
+  int num_tokens = shape[rank - 2];
+  if (num_tokens > seq.length_) {
+    NNDEPLOY_LOGE("call appendSlots before writeKV.\n");
+    return base::kStatusCodeErrorInvalidParam;
+  }
+
+  base::Status status = base::kStatusCodeOk;
+  size_t token_bytes = (size_t)param_.head_size_ * param_.data_type_.size();
+  int begin = seq.length_ - num_tokens;
+  for (int h = 0; h < param_.num_kv_heads_; ++h) {
+    uint8_t *k_src = static_cast<uint8_t *>(k->getData()) +
+                     (size_t)h * num_tokens * token_bytes;
+    uint8_t *v_src = static_cast<uint8_t *>(v->getData()) +
+                     (size_t)h * num_tokens * token_bytes;
+    // 块内同一头的token连续存放，按块拷贝
+    for (int t = 0; t < num_tokens;) {
+      int pos = begin + t;
+      int row = pos % param_.block_tokens_;
+      int n = std::min(num_tokens - t, param_.block_tokens_ - row);
+      uint8_t *block = static_cast<uint8_t *>(
+          seq.blocks_[pos / param_.block_tokens_]);
+      status = device_->copy(k_src + t * token_bytes,
+                             block + getKeyOffset(layer, h) + row * token_bytes,
+                             n * token_bytes);
+      NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "copy failed");
+      status =
+          device_->copy(v_src + t * token_bytes,
+                        block + getValueOffset(layer, h) + row * token_bytes,
+                        n * token_bytes);
+      NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "copy failed");
+      t += n;
+    }
+  }
+  return status;
+}
+
+bool KVCache::hasSequence(int seq_id) {
+  return sequences_.find(seq_id) != sequences_.end();
+}
+
+int KVCache::getSequenceLength(int seq_id) {
+  auto iter = sequences_.find(seq_id);
+  if (iter == sequences_.end()) {
+    return 0;
+  }
+  return iter->second.length_;
+}
+
+const std::vector<void *> &KVCache::getBlockTable(int seq_id) {
+  static const std::vector<void *> empty;
+  auto iter = sequences_.find(seq_id);
+  if (iter == sequences_.end()) {
+    return empty;
+  }
+  return iter->second.blocks_;
+}
+
+const KVCacheParam &KVCache::getParam() { return param_; }
+
+device::Device *KVCache::getDevice() { return device_; }
+
+size_t KVCache::getBlockSize() { return block_size_; }
+
+int KVCache::getBlockNum() {
+  return memory_pool_ != nullptr ? memory_pool_->getBlockNum() : 0;
+}
+
+int KVCache::getFreeBlockNum() {
+  return memory_pool_ != nullptr ? memory_pool_->getFreeBlockNum() : 0;
+}
+
+size_t KVCache::getKeyOffset(int layer, int kv_head) {
+  return ((size_t)layer * 2 * param_.num_kv_heads_ + kv_head) *
+         head_size_bytes_;
+}
+
+size_t KVCache::getValueOffset(int layer, int kv_head) {
+  return (((size_t)layer * 2 + 1) * param_.num_kv_heads_ + kv_head) *
+         head_size_bytes_;
+}
+
+void *KVCache::allocateBlock() {
+  void *block = memory_pool_->allocate(block_size_);
+  if (block == nullptr) {
+    NNDEPLOY_LOGE("allocate kv cache block failed.\n");
+    return nullptr;
+  }
+  block_ref_count_[block] = 1;
+  return block;
+}
+
+void KVCache::releaseBlock(void *block) {
+  auto iter = block_ref_count_.find(block);
+  if (iter == block_ref_count_.end()) {
+    return;
+  }
+  if (--iter->second == 0) {
+    block_ref_count_.erase(iter);
+    memory_pool_->deallocate(block);
+  }
+}
+
+}  // namespace op
+}  // namespace nndeploy
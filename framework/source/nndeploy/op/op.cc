@@ -2,6 +2,7 @@
 #include "nndeploy/op/op.h"
 
 #include "nndeploy/ir/ir.h"
+#include "nndeploy/op/util.h"
 
 namespace nndeploy {
 namespace op {
@@ -224,6 +225,22 @@ base::Status Op::setParallelType(const base::ParallelType &paralle_type) {
 }
 base::ParallelType Op::getParallelType() { return parallel_type_; }
 
+void Op::setInputWeightFlag(int index, bool flag) {
+  if (index < 0) {
+    return;
+  }
+  if (index >= is_input_weight_.size()) {
+    is_input_weight_.resize(index + 1, false);
+  }
+  is_input_weight_[index] = flag;
+}
+bool Op::isInputWeight(int index) {
+  if (index < 0 || index >= is_input_weight_.size()) {
+    return false;
+  }
+  return is_input_weight_[index];
+}
+
 void Op::setInnerFlag(bool flag) {
   is_inner_ = flag;
   is_changed_ = true;
@@ -274,6 +291,7 @@ base::Status Op::deinit() {
     device->deallocate(workspace_);
     workspace_is_external_ = false;
     workspace_size_ = 0U;
+    workspace_ = nullptr;
   }
   return base::kStatusCodeOk;
 }
@@ -283,11 +301,48 @@ void Op::setWorkspace(void *workspace) {
   workspace_is_external_ = true;
   workspace_ = workspace;
 }
+base::Status Op::updateWorkspaceSize(uint64_t size) {
+  if (size <= workspace_size_ && workspace_ != nullptr) {
+    return base::kStatusCodeOk;
+  }
+  if (workspace_ != nullptr) {
+    if (workspace_is_external_) {
+      NNDEPLOY_LOGE("Op %s external workspace is not enough.\n",
+                    op_desc_.name_.c_str());
+      return base::kStatusCodeErrorOutOfMemory;
+    }
+    device::Device *device = device::getDevice(device_type_);
+    device->deallocate(workspace_);
+    workspace_ = nullptr;
+  }
+  workspace_size_ = size;
+  return base::kStatusCodeOk;
+}
+base::Status Op::allocateWorkspace() {
+  if (workspace_ != nullptr || workspace_size_ == 0) {
+    return base::kStatusCodeOk;
+  }
+  device::Device *device = device::getDevice(device_type_);
+  workspace_ = device->allocate(workspace_size_);
+  if (workspace_ == nullptr) {
+    NNDEPLOY_LOGE("Op %s allocate workspace failed.\n", op_desc_.name_.c_str());
+    return base::kStatusCodeErrorOutOfMemory;
+  }
+  workspace_is_external_ = false;
+  return base::kStatusCodeOk;
+}
 uint64_t Op::getFlops() {
-  if (flops_ == 0) {
-    NNDEPLOY_LOGE("Op %s flops is not set.\n", op_desc_.name_.c_str());
+  if (flops_ != 0) {
+    return flops_;
+  }
+  // 未设置时按每个输出元素一次运算估计
+  uint64_t flops = 0;
+  for (auto output : outputs_) {
+    if (output != nullptr) {
+      flops += base::shapeCount(output->getShape(), 0, -1);
+    }
   }
-  return flops_;
+  return flops;
 }
 
 base::Status Op::inferDataType() {
@@ -349,17 +404,37 @@ base::Status Op::checkOrAllocOutput() {
       NNDEPLOY_LOGE("Data format inference failed");
       return status;
     }
-    for (auto &output : outputs_) {
-      if (output->getBuffer() == nullptr) {
-        device::Device *device = device::getDevice(device_type_);
-        output->allocate(device);
+    for (size_t i = 0; i < outputs_.size(); ++i) {
+      if (outputs_[i]->getBuffer() != nullptr) {
+        continue;
+      }
+      // 输出可以作为输入的视图时，直接引用输入的内存
+      int input_index = -1;
+      size_t offset = 0;
+      if (this->getOutputView(i, input_index, offset)) {
+        device::Buffer *view =
+            createBufferView(inputs_[input_index]->getBuffer(), offset,
+                             outputs_[i]->getDesc());
+        if (view != nullptr) {
+          outputs_[i]->justModify(view, false);
+          continue;
+        }
       }
+      device::Device *device = device::getDevice(device_type_);
+      outputs_[i]->allocate(device);
     }
     is_changed_ = false;
   }
   return base::kStatusCodeOk;
 }
 
+bool Op::getOutputView(int index, int &input_index, size_t &offset) {
+  return false;
+}
+bool Op::getInputView(int index, int &output_index, size_t &offset) {
+  return false;
+}
+
 base::Status Op::postRun() { return base::kStatusCodeOk; }
 
 std::map<base::DeviceTypeCode, std::map<ir::OpType, std::shared_ptr<OpCreator>>>
@@ -376,6 +451,42 @@ std::map<base::DeviceTypeCode, std::map<ir::OpType, std::shared_ptr<OpCreator>>>
   return *creators;
 }
 
+std::map<ir::OpType, std::vector<OpKernelDesc>> &getGlobalOpKernelMap() {
+  static std::once_flag once;
+  static std::shared_ptr<std::map<ir::OpType, std::vector<OpKernelDesc>>>
+      kernels;
+  std::call_once(once, []() {
+    kernels.reset(new std::map<ir::OpType, std::vector<OpKernelDesc>>);
+  });
+  return *kernels;
+}
+
+OpKernelFunc selectOpKernel(ir::OpType op_type, base::DataType data_type,
+                            base::CpuIsa *isa) {
+  auto &kernel_map = getGlobalOpKernelMap();
+  auto iter = kernel_map.find(op_type);
+  if (iter == kernel_map.end()) {
+    return nullptr;
+  }
+  // kCpuIsaNeon与x86的级别不会同时可用，按枚举值取最高级别即可
+  const OpKernelDesc *best = nullptr;
+  for (auto &desc : iter->second) {
+    if (desc.data_type_ != data_type || !base::isCpuIsaSupported(desc.isa_)) {
+      continue;
+    }
+    if (best == nullptr || desc.isa_ > best->isa_) {
+      best = &desc;
+    }
+  }
+  if (best == nullptr) {
+    return nullptr;
+  }
+  if (isa != nullptr) {
+    *isa = best->isa_;
+  }
+  return best->kernel_;
+}
+
 Op *createOp(base::DeviceType device_type, const std::string &name,
              ir::OpType op_type) {
   auto &creater_map = getGlobalOpCreatorMap();
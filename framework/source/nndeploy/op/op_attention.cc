@@ -0,0 +1,740 @@
+#include "nndeploy/op/op_attention.h"
+
+#include "nndeploy/base/any.h"
+#include "nndeploy/base/common.h"
+#include "nndeploy/base/glic_stl_include.h"
+#include "nndeploy/base/log.h"
+#include "nndeploy/base/macro.h"
+#include "nndeploy/base/object.h"
+#include "nndeploy/base/param.h"
+#include "nndeploy/base/shape.h"
+#include "nndeploy/base/status.h"
+#include "nndeploy/base/string.h"
+#include "nndeploy/base/time_profiler.h"
+#include "nndeploy/device/buffer.h"
+#include "nndeploy/device/device.h"
+#include "nndeploy/device/memory_pool.h"
+#include "nndeploy/device/tensor.h"
+#include "nndeploy/ir/ir.h"
+#include "nndeploy/op/op.h"
+#include "nndeploy/op/vec_math.h"
+#include "nndeploy/thread_pool/parallel.h"
+
+namespace nndeploy {
+namespace op {
+
+/**
+ * @brief 注意力计算的各维度，以及Q/K/V/output按[batch, head, seq]寻址的步长
+ * # 4D与3D输入只有步长不同，kernel统一按步长访问
+ */
+struct AttentionDims {
+  int batch_ = 0;
+  int q_num_heads_ = 0;
+  int kv_num_heads_ = 0;
+  int q_len_ = 0;
+  int kv_len_ = 0;
+  int head_size_ = 0;
+  int v_head_size_ = 0;
+  // [batch, head, seq]的步长，依次为Q、K、V、output
+  size_t strides_[4][3];
+};
+
+static void getAttentionStrides(bool is_3d, int num_heads, int seq_len,
+                                int head_size, size_t *strides) {
+  if (is_3d) {
+    strides[0] = (size_t)seq_len * num_heads * head_size;
+    strides[1] = head_size;
+    strides[2] = (size_t)num_heads * head_size;
+  } else {
+    strides[0] = (size_t)num_heads * seq_len * head_size;
+    strides[1] = (size_t)seq_len * head_size;
+    strides[2] = head_size;
+  }
+}
+
+static base::Status getAttentionDims(const base::IntVector &q_shape,
+                                     const base::IntVector &k_shape,
+                                     const base::IntVector &v_shape,
+                                     ir::AttentionParam *param,
+                                     AttentionDims &dims) {
+  if (q_shape.size() != k_shape.size() || q_shape.size() != v_shape.size() ||
+      (q_shape.size() != 3 && q_shape.size() != 4)) {
+    NNDEPLOY_LOGE("q, k, v must be all 3D or all 4D.\n");
+    return base::kStatusCodeErrorInvalidParam;
+  }
+  bool is_3d = q_shape.size() == 3;
+  if (k_shape[0] != q_shape[0] || v_shape[0] != q_shape[0]) {
+    NNDEPLOY_LOGE("batch of q, k, v must be equal.\n");
+    return base::kStatusCodeErrorInvalidParam;
+  }
+  dims.batch_ = q_shape[0];
+  if (is_3d) {
+    dims.q_num_heads_ = param->q_num_heads_;
+    dims.kv_num_heads_ = param->kv_num_heads_;
+    if (dims.q_num_heads_ <= 0 || dims.kv_num_heads_ <= 0 ||
+        q_shape[2] % dims.q_num_heads_ != 0 ||
+        k_shape[2] % dims.kv_num_heads_ != 0 ||
+        v_shape[2] % dims.kv_num_heads_ != 0) {
+      NNDEPLOY_LOGE("3D attention needs valid q_num_heads and kv_num_heads.\n");
+      return base::kStatusCodeErrorInvalidParam;
+    }
+    dims.q_len_ = q_shape[1];
+    dims.kv_len_ = k_shape[1];
+    dims.head_size_ = q_shape[2] / dims.q_num_heads_;
+    if (k_shape[2] / dims.kv_num_heads_ != dims.head_size_ ||
+        v_shape[1] != dims.kv_len_) {
+      NNDEPLOY_LOGE("k, v shape does not match q.\n");
+      return base::kStatusCodeErrorInvalidParam;
+    }
+    dims.v_head_size_ = v_shape[2] / dims.kv_num_heads_;
+  } else {
+    dims.q_num_heads_ = q_shape[1];
+    dims.kv_num_heads_ = k_shape[1];
+    dims.q_len_ = q_shape[2];
+    dims.kv_len_ = k_shape[2];
+    dims.head_size_ = q_shape[3];
+    if (k_shape[3] != dims.head_size_ || v_shape[1] != dims.kv_num_heads_ ||
+        v_shape[2] != dims.kv_len_) {
+      NNDEPLOY_LOGE("k, v shape does not match q.\n");
+      return base::kStatusCodeErrorInvalidParam;
+    }
+    dims.v_head_size_ = v_shape[3];
+  }
+  if (dims.kv_num_heads_ <= 0 || dims.q_num_heads_ % dims.kv_num_heads_ != 0) {
+    NNDEPLOY_LOGE("q_num_heads[%d] must be a multiple of kv_num_heads[%d].\n",
+                  dims.q_num_heads_, dims.kv_num_heads_);
+    return base::kStatusCodeErrorInvalidParam;
+  }
+  getAttentionStrides(is_3d, dims.q_num_heads_, dims.q_len_, dims.head_size_,
+                      dims.strides_[0]);
+  getAttentionStrides(is_3d, dims.kv_num_heads_, dims.kv_len_,
+                      dims.head_size_, dims.strides_[1]);
+  getAttentionStrides(is_3d, dims.kv_num_heads_, dims.kv_len_,
+                      dims.v_head_size_, dims.strides_[2]);
+  getAttentionStrides(is_3d, dims.q_num_heads_, dims.q_len_,
+                      dims.v_head_size_, dims.strides_[3]);
+  return base::kStatusCodeOk;
+}
+
+/**
+ * @brief attn_mask右对齐广播到[batch, q_num_heads, q_len, kv_len]，
+ * 得到四个维度的步长，广播的维度步长为0
+ */
+static base::Status getAttentionMaskStrides(const base::IntVector &mask_shape,
+                                            const AttentionDims &dims,
+                                            size_t *strides) {
+  const int target[4] = {dims.batch_, dims.q_num_heads_, dims.q_len_,
+                         dims.kv_len_};
+  int rank = (int)mask_shape.size();
+  if (rank > 4) {
+    NNDEPLOY_LOGE("attn_mask rank must be less than or equal to 4.\n");
+    return base::kStatusCodeErrorInvalidParam;
+  }
+  size_t stride = 1;
+  for (int i = 3; i >= 0; --i) {
+    int mask_i = i - (4 - rank);
+    int size = mask_i >= 0 ? mask_shape[mask_i] : 1;
+    if (size != 1 && size != target[i]) {
+      NNDEPLOY_LOGE("attn_mask can not broadcast to attention scores.\n");
+      return base::kStatusCodeErrorInvalidParam;
+    }
+    strides[i] = size == 1 ? 0 : stride;
+    stride *= size;
+  }
+  return base::kStatusCodeOk;
+}
+
+base::Status OpAttention::inferShape() {
+  auto param = dynamic_cast<ir::AttentionParam *>(op_desc_.op_param_.get());
+  NNDEPLOY_CHECK_PARAM_NULL_RET_STATUS(param, "op_desc_.op_param_ is nullptr");
+  if (inputs_.size() < 3) {
+    NNDEPLOY_LOGE("attention needs q, k, v.\n");
+    return base::kStatusCodeErrorInvalidParam;
+  }
+  for (size_t i = 4; i < inputs_.size(); ++i) {
+    if (inputs_[i] != nullptr) {
+      NNDEPLOY_LOGE("attention does not support past_key/past_value.\n");
+      return base::kStatusCodeErrorNotSupport;
+    }
+  }
+  AttentionDims dims;
+  base::IntVector q_shape = inputs_[0]->getShape();
+  base::Status status = getAttentionDims(q_shape, inputs_[1]->getShape(),
+                                         inputs_[2]->getShape(), param, dims);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk,
+                         "getAttentionDims failed");
+  if (inputs_.size() > 3 && inputs_[3] != nullptr) {
+    size_t mask_strides[4];
+    status =
+        getAttentionMaskStrides(inputs_[3]->getShape(), dims, mask_strides);
+    NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk,
+                           "getAttentionMaskStrides failed");
+  }
+  base::IntVector output_shape = q_shape;
+  if (q_shape.size() == 3) {
+    output_shape[2] = dims.q_num_heads_ * dims.v_head_size_;
+  } else {
+    output_shape[3] = dims.v_head_size_;
+  }
+  outputs_[0]->reshape(output_shape);
+  return base::kStatusCodeOk;
+}
+
+// 每个任务处理的query行数、每次处理的key数
+static const int kAttentionQueryBlock = 32;
+static const int kAttentionKeyBlock = 64;
+
+/**
+ * @brief 一段连续存放的key/value，第i个key为k_ + i * k_stride_
+ */
+struct AttentionKVSpan {
+  const float *k_;
+  const float *v_;
+  size_t k_stride_;
+  size_t v_stride_;
+  int num_;
+};
+
+/**
+ * @brief kernel读取K/V的方式：连续的张量，或经过KV cache的块表
+ */
+class AttentionKVSource {
+ public:
+  virtual ~AttentionKVSource() {}
+
+  virtual int getKVLen(int batch) const = 0;
+
+  /**
+   * @brief 从第begin个key开始、不超过max_num个连续存放的key/value
+   */
+  virtual void getKV(int batch, int kv_head, int begin, int max_num,
+                     AttentionKVSpan &span) const = 0;
+};
+
+class DenseKVSource : public AttentionKVSource {
+ public:
+  DenseKVSource(const float *k, const float *v, const AttentionDims &dims)
+      : k_(k), v_(v), dims_(dims) {}
+
+  virtual int getKVLen(int) const { return dims_.kv_len_; }
+
+  virtual void getKV(int batch, int kv_head, int begin, int max_num,
+                     AttentionKVSpan &span) const {
+    span.k_ = k_ + batch * dims_.strides_[1][0] +
+              kv_head * dims_.strides_[1][1] + begin * dims_.strides_[1][2];
+    span.v_ = v_ + batch * dims_.strides_[2][0] +
+              kv_head * dims_.strides_[2][1] + begin * dims_.strides_[2][2];
+    span.k_stride_ = dims_.strides_[1][2];
+    span.v_stride_ = dims_.strides_[2][2];
+    span.num_ = max_num;
+  }
+
+ private:
+  const float *k_;
+  const float *v_;
+  const AttentionDims &dims_;
+};
+
+/**
+ * @brief 第batch个序列的第i个key位于块表中第i / block_tokens个块
+ */
+class PagedKVSource : public AttentionKVSource {
+ public:
+  PagedKVSource(KVCache *kv_cache, const std::vector<int> &seq_ids,
+                int layer) {
+    for (auto seq_id : seq_ids) {
+      block_tables_.push_back(&kv_cache->getBlockTable(seq_id));
+      kv_lens_.push_back(kv_cache->getSequenceLength(seq_id));
+    }
+    const KVCacheParam &param = kv_cache->getParam();
+    block_tokens_ = param.block_tokens_;
+    head_size_ = param.head_size_;
+    for (int h = 0; h < param.num_kv_heads_; ++h) {
+      key_offsets_.push_back(kv_cache->getKeyOffset(layer, h));
+      value_offsets_.push_back(kv_cache->getValueOffset(layer, h));
+    }
+  }
+
+  virtual int getKVLen(int batch) const { return kv_lens_[batch]; }
+
+  virtual void getKV(int batch, int kv_head, int begin, int max_num,
+                     AttentionKVSpan &span) const {
+    const uint8_t *block = static_cast<const uint8_t *>(
+        (*block_tables_[batch])[begin / block_tokens_]);
+    int row = begin % block_tokens_;
+    span.k_ = reinterpret_cast<const float *>(block + key_offsets_[kv_head]) +
+              row * head_size_;
+    span.v_ =
+        reinterpret_cast<const float *>(block + value_offsets_[kv_head]) +
+        row * head_size_;
+    span.k_stride_ = head_size_;
+    span.v_stride_ = head_size_;
+    span.num_ = std::min(max_num, block_tokens_ - row);
+  }
+
+ private:
+  std::vector<const std::vector<void *> *> block_tables_;
+  std::vector<int> kv_lens_;
+  std::vector<size_t> key_offsets_;
+  std::vector<size_t> value_offsets_;
+  int block_tokens_;
+  int head_size_;
+};
+
+/**
+ * @brief flash attention式的分块计算
+ * # 任务为(batch, q_head, query块)，每个query块依次与每个key块计算，
+ *   分数块只有kAttentionQueryBlock x kAttentionKeyBlock，不生成完整的
+ *   [q_len, kv_len]分数矩阵，额外内存为O(q_len)而不是O(q_len * kv_len)
+ * # online softmax：每行维护当前最大值m与指数和l，最大值变大时把已累加的
+ *   输出与l乘以exp(m_old - m_new)
+ * # K、V块在处理一个query块的所有行时留在cache中
+ * # causal时跳过整块不可见的key，块内按行截断
+ * # key块不跨越KV cache的块边界，分页与连续存储共用同一个kernel
+ */
+class AttentionLoopBody : public thread_pool::ParallelLoopBody {
+ public:
+  AttentionLoopBody(const float *q, const AttentionKVSource *kv_source,
+                    const void *mask, bool mask_is_float,
+                    const size_t *mask_strides, float *output,
+                    const AttentionDims &dims, float scale, bool is_causal,
+                    bool causal_bottom_right)
+      : q_(q),
+        kv_source_(kv_source),
+        mask_(mask),
+        mask_is_float_(mask_is_float),
+        mask_strides_(mask_strides),
+        output_(output),
+        dims_(dims),
+        scale_(scale),
+        is_causal_(is_causal),
+        causal_bottom_right_(causal_bottom_right) {
+    num_query_blocks_ =
+        (dims_.q_len_ + kAttentionQueryBlock - 1) / kAttentionQueryBlock;
+  }
+
+  int getTaskNum() const {
+    return dims_.batch_ * dims_.q_num_heads_ * num_query_blocks_;
+  }
+
+  virtual void operator()(const base::Range &range) const {
+    const int v_head_size = dims_.v_head_size_;
+    std::vector<float> scores(kAttentionKeyBlock);
+    std::vector<float> acc((size_t)kAttentionQueryBlock * v_head_size);
+    float row_max[kAttentionQueryBlock];
+    float row_sum[kAttentionQueryBlock];
+    const int group = dims_.q_num_heads_ / dims_.kv_num_heads_;
+    for (int task = range.start_; task < range.end_; ++task) {
+      int query_block = task % num_query_blocks_;
+      int head = (task / num_query_blocks_) % dims_.q_num_heads_;
+      int batch = task / num_query_blocks_ / dims_.q_num_heads_;
+      int kv_head = head / group;
+      int row_begin = query_block * kAttentionQueryBlock;
+      int rows = std::min(kAttentionQueryBlock, dims_.q_len_ - row_begin);
+
+      const float *q = q_ + batch * dims_.strides_[0][0] +
+                       head * dims_.strides_[0][1] +
+                       row_begin * dims_.strides_[0][2];
+      float *output = output_ + batch * dims_.strides_[3][0] +
+                      head * dims_.strides_[3][1] +
+                      row_begin * dims_.strides_[3][2];
+      size_t mask_offset = 0;
+      if (mask_ != nullptr) {
+        mask_offset = batch * mask_strides_[0] + head * mask_strides_[1] +
+                      row_begin * mask_strides_[2];
+      }
+
+      std::fill(acc.begin(), acc.begin() + (size_t)rows * v_head_size, 0.0f);
+      for (int r = 0; r < rows; ++r) {
+        row_max[r] = -INFINITY;
+        row_sum[r] = 0.0f;
+      }
+      int kv_end = kv_source_->getKVLen(batch);
+      // 第i行可见的key为[0, i + causal_offset]，左上角对齐时causal_offset为0
+      int causal_offset = causal_bottom_right_ ? kv_end - dims_.q_len_ : 0;
+      if (is_causal_) {
+        kv_end = std::max(0, std::min(kv_end, row_begin + rows + causal_offset));
+      }
+
+      AttentionKVSpan span;
+      for (int col_begin = 0; col_begin < kv_end; col_begin += span.num_) {
+        kv_source_->getKV(batch, kv_head, col_begin,
+                          std::min(kAttentionKeyBlock, kv_end - col_begin),
+                          span);
+        int cols = span.num_;
+        for (int r = 0; r < rows; ++r) {
+          int n = cols;
+          if (is_causal_) {
+            n = std::min(n, row_begin + r + causal_offset + 1 - col_begin);
+            if (n <= 0) {
+              continue;
+            }
+          }
+          const float *q_row = q + r * dims_.strides_[0][2];
+          float *s = scores.data();
+          for (int c = 0; c < n; ++c) {
+            s[c] = vecDot(q_row, span.k_ + c * span.k_stride_,
+                          dims_.head_size_) *
+                   scale_;
+          }
+          if (mask_ != nullptr) {
+            size_t offset = mask_offset + r * mask_strides_[2] +
+                            col_begin * mask_strides_[3];
+            if (mask_is_float_) {
+              const float *mask = static_cast<const float *>(mask_) + offset;
+              for (int c = 0; c < n; ++c) {
+                s[c] += mask[c * mask_strides_[3]];
+              }
+            } else {
+              const uint8_t *mask =
+                  static_cast<const uint8_t *>(mask_) + offset;
+              for (int c = 0; c < n; ++c) {
+                if (mask[c * mask_strides_[3]] == 0) {
+                  s[c] = -INFINITY;
+                }
+              }
+            }
+          }
+
+          float new_max = std::max(row_max[r], vecMax(s, n));
+          if (new_max == -INFINITY) {
+            // 到目前为止该行的key全部被掩码
+            continue;
+          }
+          float sum = vecExpSum(s, new_max, s, n);
+          float *acc_row = acc.data() + (size_t)r * v_head_size;
+          if (new_max != row_max[r]) {
+            float alpha = std::exp(row_max[r] - new_max);
+            for (int d = 0; d < v_head_size; ++d) {
+              acc_row[d] *= alpha;
+            }
+            row_sum[r] *= alpha;
+            row_max[r] = new_max;
+          }
+          row_sum[r] += sum;
+          for (int c = 0; c < n; ++c) {
+            if (s[c] != 0.0f) {
+              vecAxpy(s[c], span.v_ + c * span.v_stride_,
+                      acc_row, v_head_size);
+            }
+          }
+        }
+      }
+
+      for (int r = 0; r < rows; ++r) {
+        float *dst = output + r * dims_.strides_[3][2];
+        const float *acc_row = acc.data() + (size_t)r * v_head_size;
+        float inv_sum = row_sum[r] > 0.0f ? 1.0f / row_sum[r] : 0.0f;
+        for (int d = 0; d < v_head_size; ++d) {
+          dst[d] = acc_row[d] * inv_sum;
+        }
+      }
+    }
+  }
+
+ private:
+  const float *q_;
+  const AttentionKVSource *kv_source_;
+  const void *mask_;
+  bool mask_is_float_;
+  const size_t *mask_strides_;
+  float *output_;
+  AttentionDims dims_;
+  float scale_;
+  bool is_causal_;
+  bool causal_bottom_right_;
+  int num_query_blocks_;
+};
+
+static uint64_t getAttentionFlops(const AttentionDims &dims) {
+  return (uint64_t)dims.batch_ * dims.q_num_heads_ * dims.q_len_ *
+         dims.kv_len_ * (dims.head_size_ + dims.v_head_size_);
+}
+
+uint64_t OpAttention::getFlops() {
+  auto param = dynamic_cast<ir::AttentionParam *>(op_desc_.op_param_.get());
+  AttentionDims dims;
+  if (param == nullptr ||
+      getAttentionDims(inputs_[0]->getShape(), inputs_[1]->getShape(),
+                       inputs_[2]->getShape(), param,
+                       dims) != base::kStatusCodeOk) {
+    return Op::getFlops();
+  }
+  return getAttentionFlops(dims);
+}
+
+base::Status OpAttention::run() {
+  base::Status status = base::kStatusCodeOk;
+  auto param = dynamic_cast<ir::AttentionParam *>(op_desc_.op_param_.get());
+  NNDEPLOY_CHECK_PARAM_NULL_RET_STATUS(param, "op_desc_.op_param_ is nullptr");
+  for (int i = 0; i < 3; ++i) {
+    if (inputs_[i]->getDataType() != base::dataTypeOf<float>()) {
+      NNDEPLOY_LOGE("attention only support float.\n");
+      return base::kStatusCodeErrorNotSupport;
+    }
+  }
+
+  AttentionDims dims;
+  status = getAttentionDims(inputs_[0]->getShape(), inputs_[1]->getShape(),
+                            inputs_[2]->getShape(), param, dims);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk,
+                         "getAttentionDims failed");
+
+  const void *mask = nullptr;
+  bool mask_is_float = true;
+  size_t mask_strides[4] = {0, 0, 0, 0};
+  if (inputs_.size() > 3 && inputs_[3] != nullptr) {
+    base::DataType mask_data_type = inputs_[3]->getDataType();
+    if (mask_data_type == base::dataTypeOf<float>()) {
+      mask_is_float = true;
+    } else if (mask_data_type == base::dataTypeOf<uint8_t>()) {
+      mask_is_float = false;
+    } else {
+      NNDEPLOY_LOGE("attn_mask only support float and bool(uint8).\n");
+      return base::kStatusCodeErrorNotSupport;
+    }
+    status =
+        getAttentionMaskStrides(inputs_[3]->getShape(), dims, mask_strides);
+    NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk,
+                           "getAttentionMaskStrides failed");
+    mask = inputs_[3]->getData();
+  }
+
+  float scale = param->scale_;
+  if (scale == 0.0f) {
+    scale = 1.0f / std::sqrt((float)dims.head_size_);
+  }
+
+  DenseKVSource kv_source(static_cast<const float *>(inputs_[1]->getData()),
+                          static_cast<const float *>(inputs_[2]->getData()),
+                          dims);
+  AttentionLoopBody body(static_cast<const float *>(inputs_[0]->getData()),
+                         &kv_source, mask, mask_is_float, mask_strides,
+                         static_cast<float *>(outputs_[0]->getData()), dims,
+                         scale, param->is_causal_,
+                         param->causal_bottom_right_);
+  int task_num = body.getTaskNum();
+  if (task_num == 0) {
+    return status;
+  }
+  thread_pool::parallelForWithCost(base::Range(0, task_num), body, getFlops());
+
+  return status;
+}
+
+base::Status attention(device::Tensor *q, device::Tensor *k, device::Tensor *v,
+                       device::Tensor *attn_mask,
+                       std::shared_ptr<ir::AttentionParam> param,
+                       device::Tensor *output) {
+  base::Status status = base::kStatusCodeOk;
+
+  Op *op = createOp(q->getDeviceType(), "", ir::kOpTypeAttention);
+  if (op == nullptr) {
+    NNDEPLOY_LOGE("createOp failed");
+    return base::kStatusCodeErrorNotImplement;
+  }
+  status = op->setParam(param);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setParam failed");
+  status = op->setInput(q, 0);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setInput failed");
+  status = op->setInput(k, 1);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setInput failed");
+  status = op->setInput(v, 2);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setInput failed");
+  if (attn_mask != nullptr) {
+    status = op->setInput(attn_mask, 3);
+    NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setInput failed");
+  }
+  status = op->setOutput(output, 0);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setOutput failed");
+  status = op->init();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "init failed");
+  status = op->preRun();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "preRun failed");
+  status = op->checkOrAllocOutput();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk,
+                         "checkOrAllocOutput failed");
+  status = op->run();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "run failed");
+  status = op->postRun();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "postRun failed");
+  status = op->deinit();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "deinit failed");
+
+  delete op;
+
+  return status;
+}
+
+/**
+ * @brief 由q的形状与KV cache得到paged attention的各维度，kv_len取各序列长度的
+ * 最大值
+ */
+static base::Status getPagedAttentionDims(const base::IntVector &q_shape,
+                                          KVCache *kv_cache,
+                                          const std::vector<int> &seq_ids,
+                                          ir::PagedAttentionParam *param,
+                                          AttentionDims &dims) {
+  if (kv_cache == nullptr) {
+    NNDEPLOY_LOGE("kv cache is not set.\n");
+    return base::kStatusCodeErrorInvalidParam;
+  }
+  const KVCacheParam &cache_param = kv_cache->getParam();
+  if (param->layer_ < 0 || param->layer_ >= cache_param.num_layers_) {
+    NNDEPLOY_LOGE("layer[%d] is out of range.\n", param->layer_);
+    return base::kStatusCodeErrorInvalidParam;
+  }
+  // 第i个batch对应seq_ids[i]
+  bool is_3d = q_shape.size() == 3;
+  if ((q_shape.size() != 3 && q_shape.size() != 4) ||
+      q_shape[0] != (int)seq_ids.size()) {
+    NNDEPLOY_LOGE("q must be 3D or 4D, and batch must be seq_ids.size().\n");
+    return base::kStatusCodeErrorInvalidParam;
+  }
+  dims.batch_ = q_shape[0];
+  dims.q_num_heads_ = is_3d ? param->q_num_heads_ : q_shape[1];
+  dims.kv_num_heads_ = cache_param.num_kv_heads_;
+  dims.q_len_ = is_3d ? q_shape[1] : q_shape[2];
+  dims.kv_len_ = 0;
+  dims.head_size_ = cache_param.head_size_;
+  dims.v_head_size_ = cache_param.head_size_;
+  int q_hidden = is_3d ? q_shape[2] : q_shape[1] * q_shape[3];
+  if (dims.q_num_heads_ <= 0 ||
+      q_hidden != dims.q_num_heads_ * dims.head_size_ ||
+      dims.q_num_heads_ % dims.kv_num_heads_ != 0) {
+    NNDEPLOY_LOGE("q shape does not match kv cache.\n");
+    return base::kStatusCodeErrorInvalidParam;
+  }
+  for (auto seq_id : seq_ids) {
+    if (!kv_cache->hasSequence(seq_id)) {
+      NNDEPLOY_LOGE("sequence[%d] does not exist.\n", seq_id);
+      return base::kStatusCodeErrorInvalidParam;
+    }
+    dims.kv_len_ = std::max(dims.kv_len_, kv_cache->getSequenceLength(seq_id));
+  }
+  getAttentionStrides(is_3d, dims.q_num_heads_, dims.q_len_, dims.head_size_,
+                      dims.strides_[0]);
+  getAttentionStrides(is_3d, dims.q_num_heads_, dims.q_len_,
+                      dims.v_head_size_, dims.strides_[3]);
+  return base::kStatusCodeOk;
+}
+
+base::Status OpPagedAttention::setKVCache(KVCache *kv_cache,
+                                          const std::vector<int> &seq_ids) {
+  kv_cache_ = kv_cache;
+  seq_ids_ = seq_ids;
+  return base::kStatusCodeOk;
+}
+
+base::Status OpPagedAttention::inferShape() {
+  auto param =
+      dynamic_cast<ir::PagedAttentionParam *>(op_desc_.op_param_.get());
+  NNDEPLOY_CHECK_PARAM_NULL_RET_STATUS(param, "op_desc_.op_param_ is nullptr");
+  AttentionDims dims;
+  base::IntVector q_shape = inputs_[0]->getShape();
+  base::Status status =
+      getPagedAttentionDims(q_shape, kv_cache_, seq_ids_, param, dims);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk,
+                         "getPagedAttentionDims failed");
+  outputs_[0]->reshape(q_shape);
+  return base::kStatusCodeOk;
+}
+
+uint64_t OpPagedAttention::getFlops() {
+  auto param =
+      dynamic_cast<ir::PagedAttentionParam *>(op_desc_.op_param_.get());
+  AttentionDims dims;
+  if (param == nullptr || kv_cache_ == nullptr ||
+      getPagedAttentionDims(inputs_[0]->getShape(), kv_cache_, seq_ids_, param,
+                            dims) != base::kStatusCodeOk) {
+    return Op::getFlops();
+  }
+  return getAttentionFlops(dims);
+}
+
+base::Status OpPagedAttention::run() {
+  base::Status status = base::kStatusCodeOk;
+  auto param =
+      dynamic_cast<ir::PagedAttentionParam *>(op_desc_.op_param_.get());
+  NNDEPLOY_CHECK_PARAM_NULL_RET_STATUS(param, "op_desc_.op_param_ is nullptr");
+  if (inputs_[0]->getDataType() != base::dataTypeOf<float>() ||
+      kv_cache_ == nullptr ||
+      kv_cache_->getParam().data_type_ != base::dataTypeOf<float>()) {
+    NNDEPLOY_LOGE("paged attention only support float.\n");
+    return base::kStatusCodeErrorNotSupport;
+  }
+
+  AttentionDims dims;
+  status = getPagedAttentionDims(inputs_[0]->getShape(), kv_cache_, seq_ids_,
+                                 param, dims);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk,
+                         "getPagedAttentionDims failed");
+
+  float scale = param->scale_;
+  if (scale == 0.0f) {
+    scale = 1.0f / std::sqrt((float)dims.head_size_);
+  }
+  PagedKVSource kv_source(kv_cache_, seq_ids_, param->layer_);
+  AttentionLoopBody body(static_cast<const float *>(inputs_[0]->getData()),
+                         &kv_source, nullptr, true, nullptr,
+                         static_cast<float *>(outputs_[0]->getData()), dims,
+                         scale, param->is_causal_, true);
+  int task_num = body.getTaskNum();
+  if (task_num == 0) {
+    return status;
+  }
+  thread_pool::parallelForWithCost(base::Range(0, task_num), body, getFlops());
+
+  return status;
+}
+
+base::Status pagedAttention(device::Tensor *q, KVCache *kv_cache,
+                            const std::vector<int> &seq_ids,
+                            std::shared_ptr<ir::PagedAttentionParam> param,
+                            device::Tensor *output) {
+  base::Status status = base::kStatusCodeOk;
+
+  Op *op = createOp(q->getDeviceType(), "", ir::kOpTypePagedAttention);
+  if (op == nullptr) {
+    NNDEPLOY_LOGE("createOp failed");
+    return base::kStatusCodeErrorNotImplement;
+  }
+  OpPagedAttention *paged_op = dynamic_cast<OpPagedAttention *>(op);
+  if (paged_op == nullptr) {
+    NNDEPLOY_LOGE("dynamic cast to OpPagedAttention failed");
+    delete op;
+    return base::kStatusCodeErrorInvalidValue;
+  }
+  status = paged_op->setKVCache(kv_cache, seq_ids);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setKVCache failed");
+  status = op->setParam(param);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setParam failed");
+  status = op->setInput(q, 0);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setInput failed");
+  status = op->setOutput(output, 0);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setOutput failed");
+  status = op->init();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "init failed");
+  status = op->preRun();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "preRun failed");
+  status = op->checkOrAllocOutput();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk,
+                         "checkOrAllocOutput failed");
+  status = op->run();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "run failed");
+  status = op->postRun();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "postRun failed");
+  status = op->deinit();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "deinit failed");
+
+  delete op;
+
+  return status;
+}
+
+REGISTER_OP_IMPLEMENTION(kDeviceTypeCodeCpu, ir::kOpTypeAttention, OpAttention)
+REGISTER_OP_IMPLEMENTION(kDeviceTypeCodeCpu, ir::kOpTypePagedAttention,
+                         OpPagedAttention)
+
+}  // namespace op
+}  // namespace nndeploy
@@ -0,0 +1,107 @@
+
+#include "nndeploy/op/op_averagepool.h"
+
+#include "nndeploy/base/any.h"
+#include "nndeploy/base/common.h"
+#include "nndeploy/base/glic_stl_include.h"
+#include "nndeploy/base/log.h"
+#include "nndeploy/base/macro.h"
+#include "nndeploy/base/object.h"
+#include "nndeploy/base/param.h"
+#include "nndeploy/base/status.h"
+#include "nndeploy/base/string.h"
+#include "nndeploy/base/time_profiler.h"
+#include "nndeploy/device/buffer.h"
+#include "nndeploy/device/device.h"
+#include "nndeploy/device/memory_pool.h"
+#include "nndeploy/device/tensor.h"
+#include "nndeploy/ir/ir.h"
+#include "nndeploy/op/op.h"
+#include "nndeploy/op/op_pool.h"
+
+namespace nndeploy {
+namespace op {
+
+base::Status OpAveragePool::inferShape() {
+  base::Status status = base::kStatusCodeOk;
+  // 参数
+  auto param = dynamic_cast<ir::AveragePoolParam*>(op_desc_.op_param_.get());
+  NNDEPLOY_CHECK_PARAM_NULL_RET_STATUS(param, "op_desc_.op_param_ is nullptr");
+
+  base::IntVector input_shape = inputs_[0]->getShape();
+  base::IntVector output_shape;
+  status = inferPoolShape(input_shape, inputs_[0]->getDataFormat(),
+                          param->auto_pad_, param->ceil_mode_,
+                          param->kernel_shape_, param->strides_, param->pads_,
+                          param->dilations_, output_shape);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "inferPoolShape failed");
+
+  outputs_[0]->reshape(output_shape);
+
+  return status;
+}
+
+uint64_t OpAveragePool::getFlops() {
+  auto param = dynamic_cast<ir::AveragePoolParam*>(op_desc_.op_param_.get());
+  uint64_t flops = base::shapeCount(outputs_[0]->getShape(), 0, -1);
+  if (param != nullptr) {
+    for (auto kernel : param->kernel_shape_) {
+      flops *= kernel;
+    }
+  }
+  return flops;
+}
+
+base::Status OpAveragePool::run() {
+  base::Status status = base::kStatusCodeOk;
+  auto param = dynamic_cast<ir::AveragePoolParam*>(op_desc_.op_param_.get());
+  NNDEPLOY_CHECK_PARAM_NULL_RET_STATUS(param, "op_desc_.op_param_ is nullptr");
+
+  Pool2dParam pool_param;
+  status = getPool2dParam(param->kernel_shape_, param->strides_, param->pads_,
+                          param->dilations_, param->count_include_pad_ != 0,
+                          pool_param);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "getPool2dParam failed");
+
+  return pool2d(ir::kOpTypeAveragePool, inputs_[0], pool_param, outputs_[0],
+                getFlops());
+}
+
+base::Status averagePool(device::Tensor* input,
+                         std::shared_ptr<ir::AveragePoolParam> param,
+                         device::Tensor* output) {
+  base::Status status = base::kStatusCodeOk;
+
+  Op* op = createOp(input->getDeviceType(), "", ir::kOpTypeAveragePool);
+  if (op == nullptr) {
+    NNDEPLOY_LOGE("createOp failed");
+    return base::kStatusCodeErrorNotImplement;
+  }
+  status = op->setParam(param);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setParam failed");
+  status = op->setInput(input, 0);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setInput failed");
+  status = op->setOutput(output, 0);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setOutput failed");
+  status = op->init();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "init failed");
+  status = op->preRun();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "preRun failed");
+  status = op->checkOrAllocOutput();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk,
+                         "checkOrAllocOutput failed");
+  status = op->run();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "run failed");
+  status = op->postRun();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "postRun failed");
+  status = op->deinit();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "deinit failed");
+  delete op;
+  return status;
+}
+
+REGISTER_OP_IMPLEMENTION(kDeviceTypeCodeCpu, ir::kOpTypeAveragePool,
+                         OpAveragePool)
+
+}  // namespace op
+}  // namespace nndeploy
@@ -7,6 +7,7 @@
 #include "nndeploy/base/macro.h"
 #include "nndeploy/base/object.h"
 #include "nndeploy/base/param.h"
+#include "nndeploy/base/shape.h"
 #include "nndeploy/base/status.h"
 #include "nndeploy/base/string.h"
 #include "nndeploy/base/time_profiler.h"
@@ -16,6 +17,8 @@
 #include "nndeploy/device/tensor.h"
 #include "nndeploy/ir/ir.h"
 #include "nndeploy/op/op.h"
+#include "nndeploy/op/vec_math.h"
+#include "nndeploy/thread_pool/parallel.h"
 
 namespace nndeploy {
 
@@ -27,6 +30,47 @@ base::Status OpBatchNorm::inferShape() {
   return base::kStatusCodeOk;
 }
 
+/**
+ * @brief 每个任务处理一个(batch, channel)平面，
+ * 归一化与仿射合并为y = x * a + b，a = scale / sqrt(var + epsilon)
+ */
+class BatchNormLoopBody : public thread_pool::ParallelLoopBody {
+ public:
+  BatchNormLoopBody(const float *input, const float *scale, const float *bias,
+                    const float *mean, const float *var, float *output,
+                    int channels, size_t spatial, float epsilon)
+      : input_(input),
+        scale_(scale),
+        bias_(bias),
+        mean_(mean),
+        var_(var),
+        output_(output),
+        channels_(channels),
+        spatial_(spatial),
+        epsilon_(epsilon) {}
+
+  virtual void operator()(const base::Range &range) const {
+    for (int task = range.start_; task < range.end_; ++task) {
+      int c = task % channels_;
+      float a = scale_[c] / std::sqrt(var_[c] + epsilon_);
+      float b = bias_[c] - mean_[c] * a;
+      size_t offset = (size_t)task * spatial_;
+      vecScaleShift(input_ + offset, a, b, output_ + offset, spatial_);
+    }
+  }
+
+ private:
+  const float *input_;
+  const float *scale_;
+  const float *bias_;
+  const float *mean_;
+  const float *var_;
+  float *output_;
+  int channels_;
+  size_t spatial_;
+  float epsilon_;
+};
+
 base::Status OpBatchNorm::run() {
   base::Status status = base::kStatusCodeOk;
   // 获取输入、尺度、偏移、均值和方差张量
@@ -43,6 +87,7 @@ base::Status OpBatchNorm::run() {
   // 获取批量归一化参数
   auto param =
       dynamic_cast<ir::BatchNormalizationParam *>(op_desc_.op_param_.get());
+  NNDEPLOY_CHECK_PARAM_NULL_RET_STATUS(param, "op_desc_.op_param_ is nullptr");
   float epsilon = param->epsilon_;
   float *input_data = static_cast<float *>(input_tensor->getData());
   float *scale_data = static_cast<float *>(scale_tensor->getData());
@@ -51,26 +96,17 @@ base::Status OpBatchNorm::run() {
   float *var_data = static_cast<float *>(var_tensor->getData());
   float *output_data = static_cast<float *>(output_tensor->getData());
 
-  // 执行批量归一化操作
+  // 执行批量归一化操作，按(batch, channel)平面并行
   int channel_size = input_shape[1];
-  for (int n = 0; n < input_shape[0]; ++n) {  // 遍历批次
-    for (int c = 0; c < channel_size; ++c) {  // 遍历通道
-      float mean = mean_data[c];
-      float var = var_data[c];
-      float scale = scale_data[c];
-      float bias = bias_data[c];
-      for (int h = 0; h < input_shape[2]; ++h) {    // 遍历高度
-        for (int w = 0; w < input_shape[3]; ++w) {  // 遍历宽度
-          int index = n * channel_size * input_shape[2] * input_shape[3] +
-                      c * input_shape[2] * input_shape[3] + h * input_shape[3] +
-                      w;
-          float normalized_value =
-              (input_data[index] - mean) / sqrt(var + epsilon);
-          output_data[index] = scale * normalized_value + bias;
-        }
-      }
-    }
+  size_t spatial = base::shapeCount(input_shape, 2, -1);
+  int tasks = input_shape[0] * channel_size;
+  if (tasks == 0 || spatial == 0) {
+    return status;
   }
+  BatchNormLoopBody body(input_data, scale_data, bias_data, mean_data,
+                         var_data, output_data, channel_size, spatial,
+                         epsilon);
+  thread_pool::parallelForWithCost(base::Range(0, tasks), body, getFlops());
 
   return status;
 }
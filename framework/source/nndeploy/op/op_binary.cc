@@ -8,6 +8,7 @@
 #include "nndeploy/base/macro.h"
 #include "nndeploy/base/object.h"
 #include "nndeploy/base/param.h"
+#include "nndeploy/base/shape.h"
 #include "nndeploy/base/status.h"
 #include "nndeploy/base/string.h"
 #include "nndeploy/base/time_profiler.h"
@@ -17,10 +18,422 @@
 #include "nndeploy/device/tensor.h"
 #include "nndeploy/ir/ir.h"
 #include "nndeploy/op/op.h"
+#include "nndeploy/op/util.h"
+#include "nndeploy/thread_pool/parallel.h"
 
 namespace nndeploy {
 namespace op {
 
+struct BinaryAdd {
+  static inline float apply(float a, float b) { return a + b; }
+};
+
+struct BinarySub {
+  static inline float apply(float a, float b) { return a - b; }
+};
+
+struct BinaryMul {
+  static inline float apply(float a, float b) { return a * b; }
+};
+
+struct BinaryDiv {
+  static inline float apply(float a, float b) { return a / b; }
+};
+
+struct BinaryPow {
+  static inline float apply(float a, float b) { return std::pow(a, b); }
+};
+
+/**
+ * @brief 三种step组合分别展开为独立的循环，标量提到循环外，便于编译器向量化
+ */
+template <typename Func>
+static void binaryLoop(const float *a, int a_step, const float *b, int b_step,
+                       float *c, size_t size) {
+  if (a_step == 1 && b_step == 1) {
+    for (size_t i = 0; i < size; ++i) {
+      c[i] = Func::apply(a[i], b[i]);
+    }
+  } else if (a_step == 1) {
+    const float value_b = b[0];
+    for (size_t i = 0; i < size; ++i) {
+      c[i] = Func::apply(a[i], value_b);
+    }
+  } else if (b_step == 1) {
+    const float value_a = a[0];
+    for (size_t i = 0; i < size; ++i) {
+      c[i] = Func::apply(value_a, b[i]);
+    }
+  } else {
+    const float value = Func::apply(a[0], b[0]);
+    for (size_t i = 0; i < size; ++i) {
+      c[i] = value;
+    }
+  }
+}
+
+/**
+ * @brief Pow的指数为标量时，常见指数替换为乘法/开方
+ */
+static void binaryPowLoop(const float *a, int a_step, const float *b,
+                          int b_step, float *c, size_t size) {
+  if (a_step == 1 && b_step == 0) {
+    const float exponent = b[0];
+    if (exponent == 1.0f) {
+      for (size_t i = 0; i < size; ++i) {
+        c[i] = a[i];
+      }
+      return;
+    } else if (exponent == 2.0f) {
+      for (size_t i = 0; i < size; ++i) {
+        c[i] = a[i] * a[i];
+      }
+      return;
+    } else if (exponent == 3.0f) {
+      for (size_t i = 0; i < size; ++i) {
+        c[i] = a[i] * a[i] * a[i];
+      }
+      return;
+    } else if (exponent == 0.5f) {
+      for (size_t i = 0; i < size; ++i) {
+        c[i] = std::sqrt(a[i]);
+      }
+      return;
+    }
+  }
+  binaryLoop<BinaryPow>(a, a_step, b, b_step, c, size);
+}
+
+REGISTER_OP_ISA_IMPLEMENTION(ir::kOpTypeAdd, base::dataTypeOf<float>(),
+                             base::kCpuIsaScalar, binaryLoop<BinaryAdd>)
+REGISTER_OP_ISA_IMPLEMENTION(ir::kOpTypeSub, base::dataTypeOf<float>(),
+                             base::kCpuIsaScalar, binaryLoop<BinarySub>)
+REGISTER_OP_ISA_IMPLEMENTION(ir::kOpTypeMul, base::dataTypeOf<float>(),
+                             base::kCpuIsaScalar, binaryLoop<BinaryMul>)
+REGISTER_OP_ISA_IMPLEMENTION(ir::kOpTypeDiv, base::dataTypeOf<float>(),
+                             base::kCpuIsaScalar, binaryLoop<BinaryDiv>)
+REGISTER_OP_ISA_IMPLEMENTION(ir::kOpTypePow, base::dataTypeOf<float>(),
+                             base::kCpuIsaScalar, binaryPowLoop)
+
+BinaryFunc getBinaryFunc(ir::OpType op_type) {
+  return getOpKernel<BinaryFunc>(op_type, base::dataTypeOf<float>());
+}
+
+base::Status getBroadcastShape(const base::IntVector &shape_0,
+                               const base::IntVector &shape_1,
+                               base::IntVector &output_shape) {
+  int rank_0 = static_cast<int>(shape_0.size());
+  int rank_1 = static_cast<int>(shape_1.size());
+  int rank = std::max(rank_0, rank_1);
+  output_shape.resize(rank);
+  // 从右向左对齐
+  for (int i = 0; i < rank; ++i) {
+    int index_0 = i - (rank - rank_0);
+    int index_1 = i - (rank - rank_1);
+    int dim_0 = index_0 >= 0 ? shape_0[index_0] : 1;
+    int dim_1 = index_1 >= 0 ? shape_1[index_1] : 1;
+    if (dim_0 != dim_1 && dim_0 != 1 && dim_1 != 1) {
+      NNDEPLOY_LOGE("broadcast failed.\n");
+      return base::kStatusCodeErrorInvalidParam;
+    }
+    output_shape[i] = dim_0 == 1 ? dim_1 : dim_0;
+  }
+  return base::kStatusCodeOk;
+}
+
+/**
+ * @brief 合并维度后的广播迭代信息
+ * # shape_[rank - 1]为最内层维度，每个输入在最内层的step只能是0或1
+ */
+struct BinaryBroadcastInfo {
+  std::vector<size_t> shape_;
+  std::vector<size_t> strides_0_;
+  std::vector<size_t> strides_1_;
+};
+
+static void getBroadcastStrides(const base::IntVector &shape,
+                                const base::IntVector &output_shape,
+                                std::vector<size_t> &strides) {
+  int rank = static_cast<int>(output_shape.size());
+  int offset = rank - static_cast<int>(shape.size());
+  strides.assign(rank, 0);
+  size_t stride = 1;
+  for (int i = rank - 1; i >= offset; --i) {
+    int dim = shape[i - offset];
+    strides[i] = dim == 1 ? 0 : stride;
+    stride *= dim;
+  }
+}
+
+/**
+ * @brief 通道分块格式的输入按存储形状[N, CB, H, W, block]计算stride
+ * # 通道为1的输入只有lane 0有效，块与lane的stride都为0
+ */
+static void getBlockedBroadcastStrides(const base::IntVector &shape, int block,
+                                       std::vector<size_t> &strides) {
+  int blocks = (shape[1] + block - 1) / block;
+  size_t stride_w = block;
+  size_t stride_h = stride_w * shape[3];
+  size_t stride_c = stride_h * shape[2];
+  size_t stride_n = stride_c * blocks;
+  strides = {shape[0] == 1 ? 0 : stride_n, shape[1] == 1 ? 0 : stride_c,
+             shape[2] == 1 ? 0 : stride_h, shape[3] == 1 ? 0 : stride_w,
+             shape[1] == 1 ? 0 : (size_t)1};
+}
+
+static void mergeBroadcastDims(const base::IntVector &output_shape,
+                               const std::vector<size_t> &strides_0,
+                               const std::vector<size_t> &strides_1,
+                               BinaryBroadcastInfo &info) {
+  // 去掉长度为1的维度，合并两个输入都可以连续访问的相邻维度
+  info.shape_.clear();
+  info.strides_0_.clear();
+  info.strides_1_.clear();
+  for (size_t i = 0; i < output_shape.size(); ++i) {
+    size_t dim = output_shape[i];
+    if (dim == 1) {
+      continue;
+    }
+    if (!info.shape_.empty()) {
+      size_t last_dim = info.shape_.back();
+      size_t &last_stride_0 = info.strides_0_.back();
+      size_t &last_stride_1 = info.strides_1_.back();
+      if (last_stride_0 == strides_0[i] * dim &&
+          last_stride_1 == strides_1[i] * dim) {
+        info.shape_.back() = last_dim * dim;
+        last_stride_0 = strides_0[i];
+        last_stride_1 = strides_1[i];
+        continue;
+      }
+    }
+    info.shape_.push_back(dim);
+    info.strides_0_.push_back(strides_0[i]);
+    info.strides_1_.push_back(strides_1[i]);
+  }
+  if (info.shape_.empty()) {
+    info.shape_.push_back(1);
+    info.strides_0_.push_back(0);
+    info.strides_1_.push_back(0);
+  }
+
+  // 最内层的stride只能是0或1，否则追加一个长度为1的最内层维度
+  if (info.strides_0_.back() > 1 || info.strides_1_.back() > 1) {
+    info.shape_.push_back(1);
+    info.strides_0_.push_back(0);
+    info.strides_1_.push_back(0);
+  }
+}
+
+static void getBinaryBroadcastInfo(const base::IntVector &shape_0,
+                                   const base::IntVector &shape_1,
+                                   const base::IntVector &output_shape,
+                                   BinaryBroadcastInfo &info) {
+  std::vector<size_t> strides_0;
+  std::vector<size_t> strides_1;
+  getBroadcastStrides(shape_0, output_shape, strides_0);
+  getBroadcastStrides(shape_1, output_shape, strides_1);
+  mergeBroadcastDims(output_shape, strides_0, strides_1, info);
+}
+
+/**
+ * @brief 输出为通道分块格式时的广播迭代信息
+ * # 输入须为同样块大小的4D张量，或只有一个元素的标量
+ */
+static base::Status getBlockedBinaryBroadcastInfo(
+    device::Tensor *input_0, device::Tensor *input_1,
+    const base::IntVector &output_shape, int block,
+    BinaryBroadcastInfo &info) {
+  if (output_shape.size() != 4) {
+    NNDEPLOY_LOGE("blocked binary only support 4D output.\n");
+    return base::kStatusCodeErrorNotSupport;
+  }
+  std::vector<size_t> strides[2];
+  device::Tensor *inputs[2] = {input_0, input_1};
+  for (int i = 0; i < 2; ++i) {
+    base::IntVector shape = inputs[i]->getShape();
+    if (base::getChannelBlock(inputs[i]->getDataFormat()) == block &&
+        shape.size() == 4) {
+      getBlockedBroadcastStrides(shape, block, strides[i]);
+    } else if (base::shapeCount(shape) == 1) {
+      strides[i].assign(5, 0);
+    } else {
+      NNDEPLOY_LOGE("input of blocked binary must be blocked or scalar.\n");
+      return base::kStatusCodeErrorNotSupport;
+    }
+  }
+  mergeBroadcastDims(base::shapeNchw2Blocked(output_shape, block), strides[0],
+                     strides[1], info);
+  return base::kStatusCodeOk;
+}
+
+// 单个任务的最少元素数
+static const size_t kBinaryGrainSize = thread_pool::kParallelGrainCost;
+// 半精度数据每次转换为float计算的元素数
+static const size_t kBinaryHalfChunk = 1024;
+
+/**
+ * @brief 二元运算的一个输入或输出，按字节寻址，支持fp32/fp16/bf16
+ */
+struct BinaryOperand {
+  char *data_ = nullptr;
+  base::DataType data_type_ = base::dataTypeOf<float>();
+
+  BinaryOperand(device::Tensor *tensor)
+      : data_(static_cast<char *>(tensor->getData())),
+        data_type_(tensor->getDataType()) {}
+
+  char *at(size_t offset) const { return data_ + offset * data_type_.size(); }
+};
+
+/**
+ * @brief 存在半精度的操作数时，分段转换为float后调用float的内层循环
+ */
+static void binaryHalfLoop(BinaryFunc func, const BinaryOperand &input_0,
+                           size_t offset_0, int step_0,
+                           const BinaryOperand &input_1, size_t offset_1,
+                           int step_1, const BinaryOperand &output,
+                           size_t offset, size_t size) {
+  float a[kBinaryHalfChunk];
+  float b[kBinaryHalfChunk];
+  float c[kBinaryHalfChunk];
+  for (size_t i = 0; i < size; i += kBinaryHalfChunk) {
+    size_t n = std::min(kBinaryHalfChunk, size - i);
+    convertToFloat(input_0.at(offset_0 + i * step_0), input_0.data_type_, a,
+                   step_0 == 0 ? 1 : n);
+    convertToFloat(input_1.at(offset_1 + i * step_1), input_1.data_type_, b,
+                   step_1 == 0 ? 1 : n);
+    func(a, step_0, b, step_1, c, n);
+    convertFromFloat(c, output.data_type_, output.at(offset + i), n);
+  }
+}
+
+class BinaryLoopBody : public thread_pool::ParallelLoopBody {
+ public:
+  BinaryLoopBody(const BinaryBroadcastInfo &info,
+                 const BinaryOperand &input_0, const BinaryOperand &input_1,
+                 const BinaryOperand &output, BinaryFunc func,
+                 size_t inner_chunk)
+      : info_(info),
+        input_0_(input_0),
+        input_1_(input_1),
+        output_(output),
+        func_(func),
+        inner_chunk_(inner_chunk) {
+    const base::DataType float_type = base::dataTypeOf<float>();
+    is_float_ = input_0.data_type_ == float_type &&
+                input_1.data_type_ == float_type &&
+                output.data_type_ == float_type;
+  }
+
+  /**
+   * @brief task按[外层行][最内层分块]编号
+   */
+  virtual void operator()(const base::Range &range) const {
+    int rank = static_cast<int>(info_.shape_.size());
+    size_t inner = info_.shape_[rank - 1];
+    int step_0 = static_cast<int>(info_.strides_0_[rank - 1]);
+    int step_1 = static_cast<int>(info_.strides_1_[rank - 1]);
+    size_t chunks = (inner + inner_chunk_ - 1) / inner_chunk_;
+    for (int task = range.start_; task < range.end_; ++task) {
+      size_t row = task / chunks;
+      size_t begin = (task % chunks) * inner_chunk_;
+      size_t size = std::min(inner_chunk_, inner - begin);
+      // 外层行号转换为各输入的偏移
+      size_t offset_0 = begin * step_0;
+      size_t offset_1 = begin * step_1;
+      size_t remain = row;
+      for (int i = rank - 2; i >= 0; --i) {
+        size_t coord = remain % info_.shape_[i];
+        remain /= info_.shape_[i];
+        offset_0 += coord * info_.strides_0_[i];
+        offset_1 += coord * info_.strides_1_[i];
+      }
+      size_t offset = row * inner + begin;
+      if (!is_float_) {
+        binaryHalfLoop(func_, input_0_, offset_0, step_0, input_1_, offset_1,
+                       step_1, output_, offset, size);
+        continue;
+      }
+      func_(reinterpret_cast<const float *>(input_0_.at(offset_0)), step_0,
+            reinterpret_cast<const float *>(input_1_.at(offset_1)), step_1,
+            reinterpret_cast<float *>(output_.at(offset)), size);
+    }
+  }
+
+ private:
+  const BinaryBroadcastInfo &info_;
+  BinaryOperand input_0_;
+  BinaryOperand input_1_;
+  BinaryOperand output_;
+  BinaryFunc func_;
+  size_t inner_chunk_;
+  bool is_float_ = true;
+};
+
+static bool isBinaryDataTypeSupported(device::Tensor *tensor) {
+  base::DataType data_type = tensor->getDataType();
+  return data_type == base::dataTypeOf<float>() || isHalfDataType(data_type);
+}
+
+base::Status binaryBroadcast(device::Tensor *input_0, device::Tensor *input_1,
+                             device::Tensor *output, BinaryFunc func,
+                             uint64_t cost) {
+  if (!isBinaryDataTypeSupported(input_0) ||
+      !isBinaryDataTypeSupported(input_1) ||
+      !isBinaryDataTypeSupported(output)) {
+    NNDEPLOY_LOGE("binaryBroadcast only support fp32/fp16/bf16.\n");
+    return base::kStatusCodeErrorNotSupport;
+  }
+  base::IntVector shape_0 = input_0->getShape();
+  base::IntVector shape_1 = input_1->getShape();
+  base::IntVector output_shape;
+  base::Status status = getBroadcastShape(shape_0, shape_1, output_shape);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk,
+                         "getBroadcastShape failed");
+  if (output->getShape() != output_shape) {
+    NNDEPLOY_LOGE("output shape is not equal to broadcast shape.\n");
+    return base::kStatusCodeErrorInvalidParam;
+  }
+
+  BinaryBroadcastInfo info;
+  int block = base::getChannelBlock(output->getDataFormat());
+  if (block > 1) {
+    status = getBlockedBinaryBroadcastInfo(input_0, input_1, output_shape,
+                                           block, info);
+    NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk,
+                           "getBlockedBinaryBroadcastInfo failed");
+  } else {
+    getBinaryBroadcastInfo(shape_0, shape_1, output_shape, info);
+  }
+  size_t total = 1;
+  for (auto dim : info.shape_) {
+    total *= dim;
+  }
+  if (total == 0) {
+    return base::kStatusCodeOk;
+  }
+
+  size_t inner = info.shape_.back();
+  size_t rows = total / inner;
+  size_t inner_chunk = inner;
+  int threads = thread_pool::getThreadBudget();
+  if (cost >= thread_pool::kParallelMinCost && threads > 1 &&
+      rows < static_cast<size_t>(threads)) {
+    // 外层行数不足以分给所有线程时，再切分最内层维度
+    size_t chunks = (threads + rows - 1) / rows;
+    inner_chunk = std::max((inner + chunks - 1) / chunks, kBinaryGrainSize);
+  }
+  size_t tasks = rows * ((inner + inner_chunk - 1) / inner_chunk);
+
+  BinaryLoopBody body(info, BinaryOperand(input_0), BinaryOperand(input_1),
+                      BinaryOperand(output), func, inner_chunk);
+  thread_pool::parallelForWithCost(base::Range(0, static_cast<int>(tasks)),
+                                   body, cost);
+  // 与标量的加减等运算使补齐的通道不再为0
+  zeroChannelPadding(output, cost);
+  return base::kStatusCodeOk;
+}
+
 base::Status OpBinary::inferShape() {
   base::Status status = base::kStatusCodeOk;
   auto input0_shape = inputs_[0]->getShape();
@@ -28,48 +441,9 @@ base::Status OpBinary::inferShape() {
 
   // 广播的形状推理
   base::IntVector output_shape;
-  int input0_size = input0_shape.size();
-  int input1_size = input1_shape.size();
-
-  if (input0_size == input1_size) {
-    for (int i = 0; i < input0_size; i++) {
-      if (input0_shape[i] != input1_shape[i] &&
-          (input0_shape[i] == 1 || input1_shape[i] == 1)) {
-        output_shape.push_back(std::max(input0_shape[i], input1_shape[i]));
-      } else {
-        output_shape.push_back(input0_shape[i]);
-      }
-    }
-  } else {
-    // 处理不同维度的情况
-    int max_size = std::max(input0_size, input1_size);
-    const base::IntVector &larger_shape =
-        (input0_size > input1_size) ? input0_shape : input1_shape;
-    const base::IntVector &smaller_shape =
-        (input0_size > input1_size) ? input1_shape : input0_shape;
-
-    output_shape.resize(max_size);
-
-    // 从右向左填充较小的shape
-    int diff = max_size - smaller_shape.size();
-    for (int i = max_size - 1; i >= 0; i--) {
-      if (i >= diff) {
-        int smaller_idx = i - diff;
-        if (larger_shape[i] != smaller_shape[smaller_idx] &&
-            (larger_shape[i] == 1 || smaller_shape[smaller_idx] == 1)) {
-          output_shape[i] =
-              std::max(larger_shape[i], smaller_shape[smaller_idx]);
-        } else if (larger_shape[i] == smaller_shape[smaller_idx]) {
-          output_shape[i] = larger_shape[i];
-        } else {
-          NNDEPLOY_LOGE("broadcast failed.\n");
-          return base::kStatusCodeErrorInvalidParam;
-        }
-      } else {
-        output_shape[i] = larger_shape[i];
-      }
-    }
-  }
+  status = getBroadcastShape(input0_shape, input1_shape, output_shape);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk,
+                         "getBroadcastShape failed");
 
   outputs_[0]->reshape(output_shape);
   return status;
@@ -79,8 +453,18 @@ base::Status OpBinary::inferDataFormat() {
   auto data_format_0 = inputs_[0]->getDataFormat();
   auto data_format_1 = inputs_[1]->getDataFormat();
   auto data_format_output = data_format_0;
-  if (data_format_0 != data_format_1) {
-    if (data_format_0 > data_format_1) {
+  // 通道分块格式与标量运算时，输出保持分块格式
+  if (base::getChannelBlock(data_format_0) > 1) {
+    data_format_output = data_format_0;
+  } else if (base::getChannelBlock(data_format_1) > 1) {
+    data_format_output = data_format_1;
+  } else if (data_format_0 != data_format_1) {
+    // 广播时输出与维度较多的输入相同，如NCHW张量与标量运算
+    size_t rank_0 = inputs_[0]->getShape().size();
+    size_t rank_1 = inputs_[1]->getShape().size();
+    if (rank_0 != rank_1) {
+      data_format_output = rank_0 > rank_1 ? data_format_0 : data_format_1;
+    } else if (data_format_0 > data_format_1) {
       data_format_output = data_format_1;
     } else {
       data_format_output = data_format_0;
@@ -90,5 +474,30 @@ base::Status OpBinary::inferDataFormat() {
   return base::kStatusCodeOk;
 }
 
+base::Status OpBinary::preRun() {
+  base::DataType data_type = inputs_[0]->getDataType();
+  // 半精度转换为float后计算，使用float的内层循环
+  base::DataType kernel_type =
+      isHalfDataType(data_type) ? base::dataTypeOf<float>() : data_type;
+  func_ = getOpKernel<BinaryFunc>(op_desc_.op_type_, kernel_type, &isa_);
+  if (func_ == nullptr) {
+    NNDEPLOY_LOGE("binary op[%s] is not implemented for data type[%s].\n",
+                  ir::opTypeToString(op_desc_.op_type_).c_str(),
+                  base::dataTypeToString(data_type).c_str());
+    return base::kStatusCodeErrorNotImplement;
+  }
+  return base::kStatusCodeOk;
+}
+
+base::Status OpBinary::run() {
+  if (func_ == nullptr) {
+    NNDEPLOY_LOGE("binary op[%s] is not implemented.\n",
+                  ir::opTypeToString(op_desc_.op_type_).c_str());
+    return base::kStatusCodeErrorNotImplement;
+  }
+  return binaryBroadcast(inputs_[0], inputs_[1], outputs_[0], func_,
+                         getFlops());
+}
+
 }  // namespace op
 }  // namespace nndeploy
@@ -0,0 +1,162 @@
+#include "nndeploy/op/op_cast.h"
+
+#include "nndeploy/base/any.h"
+#include "nndeploy/base/common.h"
+#include "nndeploy/base/glic_stl_include.h"
+#include "nndeploy/base/log.h"
+#include "nndeploy/base/macro.h"
+#include "nndeploy/base/object.h"
+#include "nndeploy/base/param.h"
+#include "nndeploy/base/shape.h"
+#include "nndeploy/base/status.h"
+#include "nndeploy/base/string.h"
+#include "nndeploy/base/time_profiler.h"
+#include "nndeploy/device/buffer.h"
+#include "nndeploy/device/device.h"
+#include "nndeploy/device/memory_pool.h"
+#include "nndeploy/device/tensor.h"
+#include "nndeploy/ir/ir.h"
+#include "nndeploy/op/op.h"
+#include "nndeploy/op/util.h"
+#include "nndeploy/thread_pool/parallel.h"
+
+namespace nndeploy {
+namespace op {
+
+// 单个任务的元素数
+static const size_t kCastGrainSize = thread_pool::kParallelGrainCost;
+// 半精度之间转换时经过float的元素数
+static const size_t kCastHalfChunk = 1024;
+
+base::Status OpCast::inferDataType() {
+  auto param = dynamic_cast<ir::CastParam *>(op_desc_.op_param_.get());
+  NNDEPLOY_CHECK_PARAM_NULL_RET_STATUS(param, "op_desc_.op_param_ is nullptr");
+  outputs_[0]->setDataType(param->to_);
+  return base::kStatusCodeOk;
+}
+
+base::Status OpCast::inferShape() {
+  base::IntVector input_shape = inputs_[0]->getShape();
+  outputs_[0]->reshape(input_shape);
+  return base::kStatusCodeOk;
+}
+
+/**
+ * @brief 每个任务转换kCastGrainSize个元素
+ */
+class CastLoopBody : public thread_pool::ParallelLoopBody {
+ public:
+  CastLoopBody(const void *input, const base::DataType &src_type,
+               void *output, const base::DataType &dst_type, size_t size)
+      : input_(static_cast<const char *>(input)),
+        src_type_(src_type),
+        output_(static_cast<char *>(output)),
+        dst_type_(dst_type),
+        size_(size) {}
+
+  virtual void operator()(const base::Range &range) const {
+    const base::DataType float_type = base::dataTypeOf<float>();
+    for (int task = range.start_; task < range.end_; ++task) {
+      size_t begin = task * kCastGrainSize;
+      size_t size = std::min(kCastGrainSize, size_ - begin);
+      const char *x = input_ + begin * src_type_.size();
+      char *y = output_ + begin * dst_type_.size();
+      if (dst_type_ == float_type) {
+        convertToFloat(x, src_type_, reinterpret_cast<float *>(y), size);
+      } else if (src_type_ == float_type) {
+        convertFromFloat(reinterpret_cast<const float *>(x), dst_type_, y,
+                         size);
+      } else {
+        float buffer[kCastHalfChunk];
+        for (size_t i = 0; i < size; i += kCastHalfChunk) {
+          size_t n = std::min(kCastHalfChunk, size - i);
+          convertToFloat(x + i * src_type_.size(), src_type_, buffer, n);
+          convertFromFloat(buffer, dst_type_, y + i * dst_type_.size(), n);
+        }
+      }
+    }
+  }
+
+ private:
+  const char *input_;
+  base::DataType src_type_;
+  char *output_;
+  base::DataType dst_type_;
+  size_t size_;
+};
+
+static bool isCastSupported(const base::DataType &data_type) {
+  return data_type == base::dataTypeOf<float>() || isHalfDataType(data_type);
+}
+
+base::Status OpCast::run() {
+  device::Tensor *input = inputs_[0];
+  device::Tensor *output = outputs_[0];
+  base::DataType src_type = input->getDataType();
+  base::DataType dst_type = output->getDataType();
+  size_t size = base::shapeCountByDataFormat(input->getShape(),
+                                             input->getDataFormat());
+  if (size == 0) {
+    return base::kStatusCodeOk;
+  }
+  if (src_type == dst_type) {
+    if (output->getData() != input->getData()) {
+      std::memcpy(output->getData(), input->getData(),
+                  size * src_type.size());
+    }
+    return base::kStatusCodeOk;
+  }
+  if (!isCastSupported(src_type) || !isCastSupported(dst_type)) {
+    NNDEPLOY_LOGE("cast from %s to %s is not supported.\n",
+                  base::dataTypeToString(src_type).c_str(),
+                  base::dataTypeToString(dst_type).c_str());
+    return base::kStatusCodeErrorNotSupport;
+  }
+
+  CastLoopBody body(input->getData(), src_type, output->getData(), dst_type,
+                    size);
+  int tasks = static_cast<int>((size + kCastGrainSize - 1) / kCastGrainSize);
+  thread_pool::parallelForWithCost(base::Range(0, tasks), body, getFlops());
+  return base::kStatusCodeOk;
+}
+
+base::Status cast(device::Tensor *input, base::DataType data_type,
+                  device::Tensor *output) {
+  base::Status status = base::kStatusCodeOk;
+
+  Op *op = createOp(input->getDeviceType(), "", ir::kOpTypeCast);
+  if (op == nullptr) {
+    NNDEPLOY_LOGE("createOp failed");
+    return base::kStatusCodeErrorNotImplement;
+  }
+  auto param = std::make_shared<ir::CastParam>();
+  param->to_ = data_type;
+  status = op->setParam(param);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setParam failed");
+  status = op->setInput(input, 0);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setInput failed");
+  status = op->setOutput(output, 0);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setOutput failed");
+  status = op->init();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "init failed");
+  status = op->preRun();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "preRun failed");
+  status = op->checkOrAllocOutput();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk,
+                         "checkOrAllocOutput failed");
+  status = op->run();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "run failed");
+  status = op->postRun();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "postRun failed");
+  status = op->deinit();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "deinit failed");
+
+  delete op;
+
+  return status;
+}
+
+REGISTER_OP_IMPLEMENTION(kDeviceTypeCodeCpu, ir::kOpTypeCast, OpCast)
+
+}  // namespace op
+}  // namespace nndeploy
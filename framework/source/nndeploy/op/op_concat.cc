@@ -8,6 +8,7 @@
 #include "nndeploy/base/macro.h"
 #include "nndeploy/base/object.h"
 #include "nndeploy/base/param.h"
+#include "nndeploy/base/shape.h"
 #include "nndeploy/base/status.h"
 #include "nndeploy/base/string.h"
 #include "nndeploy/base/time_profiler.h"
@@ -17,6 +18,8 @@
 #include "nndeploy/device/tensor.h"
 #include "nndeploy/ir/ir.h"
 #include "nndeploy/op/op.h"
+#include "nndeploy/op/util.h"
+#include "nndeploy/thread_pool/parallel.h"
 
 namespace nndeploy {
 namespace op {
@@ -68,8 +71,176 @@ base::Status OpConcat::inferShape() {
   return status;
 }
 
+// 通道分块格式下，所有输入的通道数都是块大小的整数倍
+static bool isChannelAligned(const std::vector<device::Tensor *> &inputs,
+                             int block) {
+  for (auto input : inputs) {
+    if (input->getShape().size() != 4 || input->getShape()[1] % block != 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool OpConcat::getInputView(int index, int &output_index, size_t &offset) {
+  auto param = dynamic_cast<ir::ConcatParam *>(op_desc_.op_param_.get());
+  if (param == nullptr || !outputs_[0]->isContinue()) {
+    return false;
+  }
+  // 通道对齐时分块存储与逻辑形状的元素数相同，偏移的计算不变
+  int block = base::getChannelBlock(outputs_[0]->getDataFormat());
+  if (block > 1 && !isChannelAligned(inputs_, block)) {
+    return false;
+  }
+  int axis = param->axis_;
+  base::IntVector output_shape = outputs_[0]->getShape();
+  if (axis < 0) {
+    axis += (int)output_shape.size();
+  }
+  if (multiplyDims(output_shape, 0, axis) != 1) {
+    return false;
+  }
+  size_t inner = multiplyDims(output_shape, axis + 1, (int)output_shape.size());
+  size_t concat_offset = 0;
+  for (int i = 0; i < index; ++i) {
+    concat_offset += (size_t)inputs_[i]->getShapeIndex(axis);
+  }
+  output_index = 0;
+  offset = concat_offset * inner * outputs_[0]->getDataType().size();
+  return true;
+}
+
+/**
+ * @brief 按存储形状拼接，每个输入在拼接轴之前的每一行整体拷贝
+ * # 每个输入的拷贝按其占输出的比例分摊cost
+ */
+static void concatRows(const std::vector<device::Tensor *> &inputs,
+                       const std::vector<base::IntVector> &input_shapes,
+                       const base::IntVector &output_shape, int axis,
+                       device::Tensor *output, uint64_t cost) {
+  size_t element_size = output->getDataType().size();
+  size_t outer = multiplyDims(output_shape, 0, axis);
+  size_t inner = multiplyDims(output_shape, axis + 1, (int)output_shape.size());
+  size_t output_row = (size_t)output_shape[axis] * inner * element_size;
+  if (output_row == 0) {
+    return;
+  }
+  uint8_t *output_data = static_cast<uint8_t *>(output->getData());
+
+  size_t concat_offset = 0;
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    size_t input_row = (size_t)input_shapes[i][axis] * inner * element_size;
+    const uint8_t *input_data =
+        static_cast<const uint8_t *>(inputs[i]->getData());
+    // 生产者已直接写入输出时无需拷贝
+    if (outer == 1 && input_data == output_data + concat_offset) {
+      concat_offset += input_row;
+      continue;
+    }
+    copyRows(output_data + concat_offset, output_row, input_data, input_row,
+             outer, input_row, cost * input_row / output_row);
+    concat_offset += input_row;
+  }
+}
+
+/**
+ * @brief 通道分块格式沿通道拼接且通道不对齐时，逐通道拷贝
+ * # 通道c位于块c / block的lane c % block，平面内的stride为block
+ * # 按[batch, output_c]个输出通道切分
+ */
+template <typename T>
+class ConcatBlockedChannelsLoopBody : public thread_pool::ParallelLoopBody {
+ public:
+  ConcatBlockedChannelsLoopBody(const std::vector<device::Tensor *> &inputs,
+                                device::Tensor *output, int block)
+      : inputs_(inputs), block_(block) {
+    base::IntVector output_shape = output->getShape();
+    output_c_ = output_shape[1];
+    plane_ = (size_t)output_shape[2] * output_shape[3];
+    output_data_ = static_cast<T *>(output->getData());
+  }
+
+  virtual void operator()(const base::Range &range) const {
+    int output_blocks = (output_c_ + block_ - 1) / block_;
+    for (int index = range.start_; index < range.end_; ++index) {
+      int n = index / output_c_;
+      int oc = index % output_c_;
+      // 找到输出通道oc所在的输入
+      int c = oc;
+      size_t i = 0;
+      while (c >= inputs_[i]->getShape()[1]) {
+        c -= inputs_[i]->getShape()[1];
+        ++i;
+      }
+      int channel = inputs_[i]->getShape()[1];
+      int input_blocks = (channel + block_ - 1) / block_;
+      const T *x = static_cast<const T *>(inputs_[i]->getData()) +
+                   ((size_t)n * input_blocks + c / block_) * plane_ * block_ +
+                   c % block_;
+      T *y = output_data_ +
+             ((size_t)n * output_blocks + oc / block_) * plane_ * block_ +
+             oc % block_;
+      for (size_t p = 0; p < plane_; ++p) {
+        y[p * block_] = x[p * block_];
+      }
+    }
+  }
+
+ private:
+  const std::vector<device::Tensor *> &inputs_;
+  int block_;
+  int output_c_;
+  size_t plane_;
+  T *output_data_;
+};
+
 base::Status OpConcat::run() {
-  NNDEPLOY_LOGI("not implemented.\n");
+  auto param = dynamic_cast<ir::ConcatParam *>(op_desc_.op_param_.get());
+  NNDEPLOY_CHECK_PARAM_NULL_RET_STATUS(param, "op_desc_.op_param_ is nullptr");
+  int axis = param->axis_;
+  base::IntVector output_shape = outputs_[0]->getShape();
+  if (axis < 0) {
+    axis += (int)output_shape.size();
+  }
+  std::vector<base::IntVector> input_shapes;
+  for (auto input : inputs_) {
+    input_shapes.push_back(input->getShape());
+  }
+
+  int block = base::getChannelBlock(outputs_[0]->getDataFormat());
+  if (block == 1) {
+    concatRows(inputs_, input_shapes, output_shape, axis, outputs_[0],
+               getFlops());
+    return base::kStatusCodeOk;
+  }
+
+  // 通道分块格式，所有输入的块大小须与输出相同
+  for (auto input : inputs_) {
+    if (base::getChannelBlock(input->getDataFormat()) != block ||
+        input->getShape().size() != 4) {
+      NNDEPLOY_LOGE("inputs of blocked concat must be 4D with same block.\n");
+      return base::kStatusCodeErrorInvalidParam;
+    }
+  }
+  if (axis == 1 && !isChannelAligned(inputs_, block)) {
+    if (outputs_[0]->getDataType().size() != sizeof(float)) {
+      NNDEPLOY_LOGE("blocked concat only support 4 bytes data type.\n");
+      return base::kStatusCodeErrorNotSupport;
+    }
+    ConcatBlockedChannelsLoopBody<float> body(inputs_, outputs_[0], block);
+    base::Range range(0, output_shape[0] * output_shape[1]);
+    thread_pool::parallelForWithCost(range, body, getFlops());
+    // 只拷贝了有效通道，输出补齐的通道写0
+    zeroChannelPadding(outputs_[0], getFlops());
+    return base::kStatusCodeOk;
+  }
+  // 按存储形状[N, CB, H, W, block]拼接，通道对齐时CB之比等于通道之比
+  for (auto &shape : input_shapes) {
+    shape = base::shapeNchw2Blocked(shape, block);
+  }
+  base::IntVector blocked_shape = base::shapeNchw2Blocked(output_shape, block);
+  concatRows(inputs_, input_shapes, blocked_shape, axis, outputs_[0],
+             getFlops());
   return base::kStatusCodeOk;
 }
 
@@ -3,11 +3,13 @@
 
 #include "nndeploy/base/any.h"
 #include "nndeploy/base/common.h"
+#include "nndeploy/base/cpu_isa.h"
 #include "nndeploy/base/glic_stl_include.h"
 #include "nndeploy/base/log.h"
 #include "nndeploy/base/macro.h"
 #include "nndeploy/base/object.h"
 #include "nndeploy/base/param.h"
+#include "nndeploy/base/shape.h"
 #include "nndeploy/base/status.h"
 #include "nndeploy/base/string.h"
 #include "nndeploy/base/time_profiler.h"
@@ -17,23 +19,39 @@
 #include "nndeploy/device/tensor.h"
 #include "nndeploy/ir/ir.h"
 #include "nndeploy/op/op.h"
+#include "nndeploy/op/sgemm.h"
+#include "nndeploy/op/util.h"
+#include "nndeploy/thread_pool/parallel.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && \
+    (defined(__GNUC__) || defined(__clang__))
+#define NNDEPLOY_CONV_X86
+#include <immintrin.h>
+#define NNDEPLOY_CONV_AVX2 __attribute__((target("avx2,fma")))
+#endif
+
+// 内核模板需要内联进不同指令集的入口函数中
+#if defined(__GNUC__) || defined(__clang__)
+#define NNDEPLOY_CONV_INLINE inline __attribute__((always_inline))
+#else
+#define NNDEPLOY_CONV_INLINE inline
+#endif
 
 namespace nndeploy {
 namespace op {
 
-base::Status OpConv::inferShape() {
+base::Status inferConvShape(ir::ConvParam *param,
+                            const base::IntVector &input_shape,
+                            const base::IntVector &weight_shape,
+                            base::IntVector &output_shape) {
   base::Status status = base::kStatusCodeOk;
 
-  base::IntVector input_shape = inputs_[0]->getShape();
   if (input_shape.size() < 2) {
     NNDEPLOY_LOGE("input_shape.size() < 2.\n");
     return base::kStatusCodeErrorInvalidParam;
   }
   // first dim is the batch axis and the next is the number of channels.
   size_t n_input_dims = static_cast<size_t>(input_shape.size() - 2);
-  // 参数
-  auto param = dynamic_cast<ir::ConvParam *>(op_desc_.op_param_.get());
-  NNDEPLOY_CHECK_PARAM_NULL_RET_STATUS(param, "op_desc_.op_param_ is nullptr");
   std::vector<int> dilations = param->dilations_;
   if (dilations.size() == 0) {
     dilations.resize(n_input_dims, 1);
@@ -41,9 +59,8 @@ base::Status OpConv::inferShape() {
   }
   std::vector<int> kernel_shape = param->kernel_shape_;
   if (kernel_shape.size() == 0) {
-    auto second_input_shape = inputs_[1]->getShape();
-    for (int i = 2; i < second_input_shape.size(); ++i) {
-      kernel_shape.push_back(second_input_shape[i]);
+    for (size_t i = 2; i < weight_shape.size(); ++i) {
+      kernel_shape.push_back(weight_shape[i]);
     }
   }
   std::vector<int> strides = param->strides_;
@@ -93,9 +110,9 @@ base::Status OpConv::inferShape() {
   }
 
   // add the first two dimensions from the input.
-  base::IntVector output_shape = input_shape;
+  output_shape = input_shape;
   output_shape[0] = input_shape[0];
-  output_shape[1] = inputs_[1]->getShape()[0];
+  output_shape[1] = weight_shape[0];
   for (size_t i = 2; i < output_shape.size(); i++) {
     output_shape[i] = -1;
   }
@@ -119,14 +136,1303 @@ base::Status OpConv::inferShape() {
     output_shape[new_i] = 1 + strided_kernel_positions;
   }
 
+  return status;
+}
+
+base::Status OpConv::inferShape() {
+  base::Status status = base::kStatusCodeOk;
+
+  // 参数
+  auto param = dynamic_cast<ir::ConvParam *>(op_desc_.op_param_.get());
+  NNDEPLOY_CHECK_PARAM_NULL_RET_STATUS(param, "op_desc_.op_param_ is nullptr");
+  base::IntVector output_shape;
+  status = inferConvShape(param, inputs_[0]->getShape(),
+                          inputs_[1]->getShape(), output_shape);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "inferConvShape failed");
   outputs_[0]->reshape(output_shape);
   // outputs_[0]->print();
 
   return status;
 }
 
+/**
+ * @brief im2col
+ * # data_col[(c * kernel_h + i) * kernel_w + j][oy * output_w + ox]
+ * # 每一行只计算一次有效的ox区间，内层循环不存在边界判断
+ */
+static void im2col(const float *data_im, int channels, int height, int width,
+                   int kernel_h, int kernel_w, int pad_h, int pad_w,
+                   int stride_h, int stride_w, int dilation_h, int dilation_w,
+                   int output_h, int output_w, float *data_col) {
+  for (int c = 0; c < channels; ++c) {
+    const float *im = data_im + c * height * width;
+    for (int i = 0; i < kernel_h; ++i) {
+      for (int j = 0; j < kernel_w; ++j) {
+        // ix = ox * stride_w + offset_w, 有效区间[ox_begin, ox_end)
+        int offset_w = j * dilation_w - pad_w;
+        int ox_begin = offset_w >= 0 ? 0 : (-offset_w + stride_w - 1) / stride_w;
+        int ox_end =
+            width - offset_w > 0 ? (width - offset_w + stride_w - 1) / stride_w
+                                 : 0;
+        ox_begin = std::min(ox_begin, output_w);
+        ox_end = std::max(std::min(ox_end, output_w), ox_begin);
+        for (int oy = 0; oy < output_h; ++oy) {
+          int iy = oy * stride_h + i * dilation_h - pad_h;
+          if (iy < 0 || iy >= height) {
+            memset(data_col, 0, output_w * sizeof(float));
+            data_col += output_w;
+            continue;
+          }
+          const float *src = im + iy * width + offset_w;
+          for (int ox = 0; ox < ox_begin; ++ox) {
+            data_col[ox] = 0.0f;
+          }
+          if (stride_w == 1) {
+            memcpy(data_col + ox_begin, src + ox_begin,
+                   (ox_end - ox_begin) * sizeof(float));
+          } else {
+            for (int ox = ox_begin; ox < ox_end; ++ox) {
+              data_col[ox] = src[ox * stride_w];
+            }
+          }
+          for (int ox = ox_end; ox < output_w; ++ox) {
+            data_col[ox] = 0.0f;
+          }
+          data_col += output_w;
+        }
+      }
+    }
+  }
+}
+
+/**
+ * @brief 按输入通道切分im2col，每个通道写data_col中连续的
+ *        kernel_h * kernel_w行
+ */
+class Im2colLoopBody : public thread_pool::ParallelLoopBody {
+ public:
+  Im2colLoopBody(const float *data_im, int height, int width, int kernel_h,
+                 int kernel_w, int pad_h, int pad_w, int stride_h,
+                 int stride_w, int dilation_h, int dilation_w, int output_h,
+                 int output_w, float *data_col)
+      : data_im_(data_im),
+        height_(height),
+        width_(width),
+        kernel_h_(kernel_h),
+        kernel_w_(kernel_w),
+        pad_h_(pad_h),
+        pad_w_(pad_w),
+        stride_h_(stride_h),
+        stride_w_(stride_w),
+        dilation_h_(dilation_h),
+        dilation_w_(dilation_w),
+        output_h_(output_h),
+        output_w_(output_w),
+        data_col_(data_col) {}
+
+  virtual void operator()(const base::Range &range) const {
+    size_t col_rows = (size_t)kernel_h_ * kernel_w_ * output_h_ * output_w_;
+    im2col(data_im_ + (size_t)range.start_ * height_ * width_,
+           range.end_ - range.start_, height_, width_, kernel_h_, kernel_w_,
+           pad_h_, pad_w_, stride_h_, stride_w_, dilation_h_, dilation_w_,
+           output_h_, output_w_, data_col_ + range.start_ * col_rows);
+  }
+
+ private:
+  const float *data_im_;
+  int height_;
+  int width_;
+  int kernel_h_;
+  int kernel_w_;
+  int pad_h_;
+  int pad_w_;
+  int stride_h_;
+  int stride_w_;
+  int dilation_h_;
+  int dilation_w_;
+  int output_h_;
+  int output_w_;
+  float *data_col_;
+};
+
+// workspace中各段buffer的对齐
+static inline uint64_t alignWorkspace(uint64_t size) {
+  return (size + 63) / 64 * 64;
+}
+
+/**
+ * @brief im2col + sgemm所需的workspace大小
+ * # im2col矩阵 [in_channels / group * kernel_h * kernel_w, output_h *
+ * output_w]
+ * # sgemm打包A、B的空间
+ */
+static uint64_t getIm2colWorkspaceSize(const base::IntVector &weight_shape,
+                                       const base::IntVector &output_shape,
+                                       int group) {
+  int m = weight_shape[0] / group;
+  int k = weight_shape[1] * weight_shape[2] * weight_shape[3];
+  int n = output_shape[2] * output_shape[3];
+  uint64_t size = alignWorkspace((uint64_t)k * n * sizeof(float));
+  size += sgemmWorkspaceSize(m, n, k);
+  return size;
+}
+
+/**
+ * @brief winograd F(4x4, 3x3)
+ * # 输出按4x4分tile, 每个tile对应6x6的输入
+ * # 权重变换 U = G * g * G^T, 在init中完成
+ * # 输入变换 V = B^T * d * B
+ * # 36个位置分别做GEMM M[xi] = U[xi] * V[xi]
+ * # 输出变换 Y = A^T * M * A
+ * # 输入、输出变换以kWinogradLanes个tile为一组，内层循环在tile维度上向量化
+ */
+static const int kWinogradTile = 4;
+static const int kWinogradAlpha = 6;
+static const int kWinogradLanes = 8;
+// 每次处理的tile数的上限由V、M的大小决定, 保证V、M尽量驻留cache
+static const uint64_t kWinogradBlockBytes = 4 * 1024 * 1024;
+
+// 参数为空时取默认值, 在inferShape中填充
+static bool isAllEqual(const std::vector<int> &values, int value) {
+  for (auto v : values) {
+    if (v != value) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static bool isWinogradSuitable(ir::ConvParam *param,
+                               const base::IntVector &weight_shape) {
+  if (weight_shape.size() != 4 || weight_shape[2] != 3 ||
+      weight_shape[3] != 3) {
+    return false;
+  }
+  if (param->group_ != 1) {
+    return false;
+  }
+  return isAllEqual(param->strides_, 1) && isAllEqual(param->dilations_, 1);
+}
+
+static int getWinogradTileBlock(int tiles, int input_c, int output_c) {
+  uint64_t per_tile = (uint64_t)kWinogradAlpha * kWinogradAlpha *
+                      (input_c + output_c) * sizeof(float);
+  int block = (int)(kWinogradBlockBytes / per_tile);
+  block = block / kWinogradLanes * kWinogradLanes;
+  block = std::max(block, kWinogradLanes);
+  return std::min(block, tiles);
+}
+
+/**
+ * @brief winograd所需的workspace大小
+ * # V [36, input_c, tile_block]
+ * # M [36, output_c, tile_block]
+ * # sgemm打包A、B的空间
+ */
+static uint64_t getWinogradWorkspaceSize(const base::IntVector &input_shape,
+                                         const base::IntVector &output_shape) {
+  int input_c = input_shape[1];
+  int output_c = output_shape[1];
+  int tiles_h = (output_shape[2] + kWinogradTile - 1) / kWinogradTile;
+  int tiles_w = (output_shape[3] + kWinogradTile - 1) / kWinogradTile;
+  int block = getWinogradTileBlock(tiles_h * tiles_w, input_c, output_c);
+  const int alpha2 = kWinogradAlpha * kWinogradAlpha;
+  uint64_t size =
+      alignWorkspace((uint64_t)alpha2 * input_c * block * sizeof(float));
+  size += alignWorkspace((uint64_t)alpha2 * output_c * block * sizeof(float));
+  size += sgemmWorkspaceSize(output_c, block, input_c);
+  return size;
+}
+
+// 权重变换 U = G * g * G^T, g为3x3, U为6x6
+static void winogradWeightTransform(const float *g, float *u) {
+  static const float G[6][3] = {
+      {1.0f / 4, 0.0f, 0.0f},
+      {-1.0f / 6, -1.0f / 6, -1.0f / 6},
+      {-1.0f / 6, 1.0f / 6, -1.0f / 6},
+      {1.0f / 24, 1.0f / 12, 1.0f / 6},
+      {1.0f / 24, -1.0f / 12, 1.0f / 6},
+      {0.0f, 0.0f, 1.0f}};
+  float tmp[6][3];
+  for (int i = 0; i < 6; ++i) {
+    for (int j = 0; j < 3; ++j) {
+      tmp[i][j] = G[i][0] * g[0 * 3 + j] + G[i][1] * g[1 * 3 + j] +
+                  G[i][2] * g[2 * 3 + j];
+    }
+  }
+  for (int i = 0; i < 6; ++i) {
+    for (int j = 0; j < 6; ++j) {
+      u[i * 6 + j] =
+          tmp[i][0] * G[j][0] + tmp[i][1] * G[j][1] + tmp[i][2] * G[j][2];
+    }
+  }
+}
+
+// 输入变换的一维形式 o = B^T * r, r、o的每个元素为kWinogradLanes个tile
+static inline void winogradInputTransform1D(const float *r0, const float *r1,
+                                            const float *r2, const float *r3,
+                                            const float *r4, const float *r5,
+                                            float *o0, float *o1, float *o2,
+                                            float *o3, float *o4, float *o5) {
+  for (int l = 0; l < kWinogradLanes; ++l) {
+    o0[l] = 4.0f * r0[l] - 5.0f * r2[l] + r4[l];
+    o1[l] = -4.0f * (r1[l] + r2[l]) + r3[l] + r4[l];
+    o2[l] = 4.0f * (r1[l] - r2[l]) - r3[l] + r4[l];
+    o3[l] = 2.0f * (r3[l] - r1[l]) - r2[l] + r4[l];
+    o4[l] = 2.0f * (r1[l] - r3[l]) - r2[l] + r4[l];
+    o5[l] = 4.0f * r1[l] - 5.0f * r3[l] + r5[l];
+  }
+}
+
+// 输出变换的一维形式 o = A^T * r
+static inline void winogradOutputTransform1D(const float *r0, const float *r1,
+                                             const float *r2, const float *r3,
+                                             const float *r4, const float *r5,
+                                             float *o0, float *o1, float *o2,
+                                             float *o3) {
+  for (int l = 0; l < kWinogradLanes; ++l) {
+    float a = r1[l] + r2[l];
+    float b = r1[l] - r2[l];
+    float c = r3[l] + r4[l];
+    float d = r3[l] - r4[l];
+    o0[l] = r0[l] + a + c;
+    o1[l] = b + 2.0f * d;
+    o2[l] = a + 4.0f * c;
+    o3[l] = b + 8.0f * d + r5[l];
+  }
+}
+
+// 6x6的数据块，每个元素为kWinogradLanes个tile，按[i][j][lane]存放
+#define WINOGRAD_AT(buf, i, j) ((buf) + ((i) * 6 + (j)) * kWinogradLanes)
+
+/**
+ * @brief 输入变换
+ * # 对[c_begin, c_end)个通道、[tile_begin, tile_begin + tile_count)个tile
+ *   做变换
+ * # 结果存放在v [36, input_c, tile_count]
+ */
+static void winogradInputTransform(const float *input, int input_c,
+                                   int c_begin, int c_end, int input_h,
+                                   int input_w, int pad_h, int pad_w,
+                                   int tiles_w, int tile_begin, int tile_count,
+                                   float *v) {
+  const int alpha2 = kWinogradAlpha * kWinogradAlpha;
+  float d[alpha2 * kWinogradLanes];
+  float t[alpha2 * kWinogradLanes];
+  float o[alpha2 * kWinogradLanes];
+  for (int c = c_begin; c < c_end; ++c) {
+    const float *im = input + (size_t)c * input_h * input_w;
+    for (int t0 = 0; t0 < tile_count; t0 += kWinogradLanes) {
+      int lanes = std::min(kWinogradLanes, tile_count - t0);
+      // gather 6x6的输入块, 越界部分补0
+      for (int l = 0; l < kWinogradLanes; ++l) {
+        if (l >= lanes) {
+          for (int i = 0; i < alpha2; ++i) {
+            d[i * kWinogradLanes + l] = 0.0f;
+          }
+          continue;
+        }
+        int tile = tile_begin + t0 + l;
+        int iy0 = (tile / tiles_w) * kWinogradTile - pad_h;
+        int ix0 = (tile % tiles_w) * kWinogradTile - pad_w;
+        bool inside = iy0 >= 0 && ix0 >= 0 &&
+                      iy0 + kWinogradAlpha <= input_h &&
+                      ix0 + kWinogradAlpha <= input_w;
+        for (int i = 0; i < kWinogradAlpha; ++i) {
+          int iy = iy0 + i;
+          const float *row = im + iy * input_w;
+          for (int j = 0; j < kWinogradAlpha; ++j) {
+            int ix = ix0 + j;
+            float value = 0.0f;
+            if (inside ||
+                (iy >= 0 && iy < input_h && ix >= 0 && ix < input_w)) {
+              value = row[ix];
+            }
+            *(WINOGRAD_AT(d, i, j) + l) = value;
+          }
+        }
+      }
+      // t = B^T * d
+      for (int j = 0; j < kWinogradAlpha; ++j) {
+        winogradInputTransform1D(
+            WINOGRAD_AT(d, 0, j), WINOGRAD_AT(d, 1, j), WINOGRAD_AT(d, 2, j),
+            WINOGRAD_AT(d, 3, j), WINOGRAD_AT(d, 4, j), WINOGRAD_AT(d, 5, j),
+            WINOGRAD_AT(t, 0, j), WINOGRAD_AT(t, 1, j), WINOGRAD_AT(t, 2, j),
+            WINOGRAD_AT(t, 3, j), WINOGRAD_AT(t, 4, j), WINOGRAD_AT(t, 5, j));
+      }
+      // o = t * B
+      for (int i = 0; i < kWinogradAlpha; ++i) {
+        winogradInputTransform1D(
+            WINOGRAD_AT(t, i, 0), WINOGRAD_AT(t, i, 1), WINOGRAD_AT(t, i, 2),
+            WINOGRAD_AT(t, i, 3), WINOGRAD_AT(t, i, 4), WINOGRAD_AT(t, i, 5),
+            WINOGRAD_AT(o, i, 0), WINOGRAD_AT(o, i, 1), WINOGRAD_AT(o, i, 2),
+            WINOGRAD_AT(o, i, 3), WINOGRAD_AT(o, i, 4), WINOGRAD_AT(o, i, 5));
+      }
+      for (int xi = 0; xi < alpha2; ++xi) {
+        memcpy(v + ((size_t)xi * input_c + c) * tile_count + t0,
+               o + xi * kWinogradLanes, lanes * sizeof(float));
+      }
+    }
+  }
+}
+
+/**
+ * @brief 输出变换
+ * # m [36, output_c, tile_count]，只处理[oc_begin, oc_end)个输出通道
+ * # 加bias、激活后写回output
+ */
+static void winogradOutputTransform(const float *m, int output_c,
+                                    int oc_begin, int oc_end, int output_h,
+                                    int output_w, int tiles_w, int tile_begin,
+                                    int tile_count, const float *bias,
+                                    SgemmEpilogueFunc epilogue_func,
+                                    float *output) {
+  const int alpha2 = kWinogradAlpha * kWinogradAlpha;
+  float d[alpha2 * kWinogradLanes];
+  float t[kWinogradTile * kWinogradAlpha * kWinogradLanes];
+  float y[kWinogradTile * kWinogradTile * kWinogradLanes];
+  for (int oc = oc_begin; oc < oc_end; ++oc) {
+    float *out = output + (size_t)oc * output_h * output_w;
+    for (int t0 = 0; t0 < tile_count; t0 += kWinogradLanes) {
+      int lanes = std::min(kWinogradLanes, tile_count - t0);
+      for (int xi = 0; xi < alpha2; ++xi) {
+        const float *src = m + ((size_t)xi * output_c + oc) * tile_count + t0;
+        float *dst = d + xi * kWinogradLanes;
+        for (int l = 0; l < lanes; ++l) {
+          dst[l] = src[l];
+        }
+        for (int l = lanes; l < kWinogradLanes; ++l) {
+          dst[l] = 0.0f;
+        }
+      }
+      // t = A^T * d
+      for (int j = 0; j < kWinogradAlpha; ++j) {
+        winogradOutputTransform1D(
+            WINOGRAD_AT(d, 0, j), WINOGRAD_AT(d, 1, j), WINOGRAD_AT(d, 2, j),
+            WINOGRAD_AT(d, 3, j), WINOGRAD_AT(d, 4, j), WINOGRAD_AT(d, 5, j),
+            WINOGRAD_AT(t, 0, j), WINOGRAD_AT(t, 1, j), WINOGRAD_AT(t, 2, j),
+            WINOGRAD_AT(t, 3, j));
+      }
+      // y = t * A
+      for (int i = 0; i < kWinogradTile; ++i) {
+        winogradOutputTransform1D(
+            WINOGRAD_AT(t, i, 0), WINOGRAD_AT(t, i, 1), WINOGRAD_AT(t, i, 2),
+            WINOGRAD_AT(t, i, 3), WINOGRAD_AT(t, i, 4), WINOGRAD_AT(t, i, 5),
+            y + (i * 4 + 0) * kWinogradLanes, y + (i * 4 + 1) * kWinogradLanes,
+            y + (i * 4 + 2) * kWinogradLanes,
+            y + (i * 4 + 3) * kWinogradLanes);
+      }
+      if (epilogue_func != nullptr) {
+        epilogue_func(y, 0, 1, kWinogradTile * kWinogradTile * kWinogradLanes,
+                      bias != nullptr ? bias + oc : nullptr);
+      }
+      // scatter, 越界部分丢弃
+      for (int l = 0; l < lanes; ++l) {
+        int tile = tile_begin + t0 + l;
+        int oy0 = (tile / tiles_w) * kWinogradTile;
+        int ox0 = (tile % tiles_w) * kWinogradTile;
+        int h = std::min(kWinogradTile, output_h - oy0);
+        int w = std::min(kWinogradTile, output_w - ox0);
+        for (int i = 0; i < h; ++i) {
+          float *row = out + (oy0 + i) * output_w + ox0;
+          for (int j = 0; j < w; ++j) {
+            row[j] = y[(i * 4 + j) * kWinogradLanes + l];
+          }
+        }
+      }
+    }
+  }
+}
+
+#undef WINOGRAD_AT
+
+// 输入变换按输入通道切分
+class WinogradInputLoopBody : public thread_pool::ParallelLoopBody {
+ public:
+  WinogradInputLoopBody(const float *input, int input_c, int input_h,
+                        int input_w, int pad_h, int pad_w, int tiles_w,
+                        int tile_begin, int tile_count, float *v)
+      : input_(input),
+        input_c_(input_c),
+        input_h_(input_h),
+        input_w_(input_w),
+        pad_h_(pad_h),
+        pad_w_(pad_w),
+        tiles_w_(tiles_w),
+        tile_begin_(tile_begin),
+        tile_count_(tile_count),
+        v_(v) {}
+
+  virtual void operator()(const base::Range &range) const {
+    winogradInputTransform(input_, input_c_, range.start_, range.end_,
+                           input_h_, input_w_, pad_h_, pad_w_, tiles_w_,
+                           tile_begin_, tile_count_, v_);
+  }
+
+ private:
+  const float *input_;
+  int input_c_;
+  int input_h_;
+  int input_w_;
+  int pad_h_;
+  int pad_w_;
+  int tiles_w_;
+  int tile_begin_;
+  int tile_count_;
+  float *v_;
+};
+
+// 输出变换按输出通道切分
+class WinogradOutputLoopBody : public thread_pool::ParallelLoopBody {
+ public:
+  WinogradOutputLoopBody(const float *m, int output_c, int output_h,
+                         int output_w, int tiles_w, int tile_begin,
+                         int tile_count, const float *bias,
+                         SgemmEpilogueFunc epilogue_func, float *output)
+      : m_(m),
+        output_c_(output_c),
+        output_h_(output_h),
+        output_w_(output_w),
+        tiles_w_(tiles_w),
+        tile_begin_(tile_begin),
+        tile_count_(tile_count),
+        bias_(bias),
+        epilogue_func_(epilogue_func),
+        output_(output) {}
+
+  virtual void operator()(const base::Range &range) const {
+    winogradOutputTransform(m_, output_c_, range.start_, range.end_,
+                            output_h_, output_w_, tiles_w_, tile_begin_,
+                            tile_count_, bias_, epilogue_func_, output_);
+  }
+
+ private:
+  const float *m_;
+  int output_c_;
+  int output_h_;
+  int output_w_;
+  int tiles_w_;
+  int tile_begin_;
+  int tile_count_;
+  const float *bias_;
+  SgemmEpilogueFunc epilogue_func_;
+  float *output_;
+};
+
+/**
+ * @brief depthwise卷积, group == input_c == output_c
+ * # 支持3x3/5x5, stride1/stride2, dilation1
+ * # 输出分为内部区域与边界区域, 内部区域的窗口完全在输入内, 不需要边界判断
+ * # 内部区域按输出行累加K*K次, stride1时内层循环可向量化
+ */
+static bool isDepthwiseSuitable(ir::ConvParam *param,
+                                const base::IntVector &weight_shape) {
+  if (weight_shape.size() != 4 || weight_shape[1] != 1 ||
+      param->group_ != weight_shape[0]) {
+    return false;
+  }
+  int kernel_h = weight_shape[2];
+  int kernel_w = weight_shape[3];
+  if (kernel_h != kernel_w || (kernel_h != 3 && kernel_h != 5)) {
+    return false;
+  }
+  if (!isAllEqual(param->dilations_, 1)) {
+    return false;
+  }
+  if (param->strides_.empty()) {
+    return true;
+  }
+  int stride = param->strides_[0];
+  return (stride == 1 || stride == 2) && isAllEqual(param->strides_, stride);
+}
+
+// 边界处的单个输出点
+template <int K>
+static inline float depthwiseConvPoint(const float *input, int input_h,
+                                       int input_w, const float *weight,
+                                       int iy0, int ix0) {
+  float sum = 0.0f;
+  for (int i = 0; i < K; ++i) {
+    int iy = iy0 + i;
+    if (iy < 0 || iy >= input_h) {
+      continue;
+    }
+    for (int j = 0; j < K; ++j) {
+      int ix = ix0 + j;
+      if (ix < 0 || ix >= input_w) {
+        continue;
+      }
+      sum += input[iy * input_w + ix] * weight[i * K + j];
+    }
+  }
+  return sum;
+}
+
+// 单个通道的depthwise卷积
+template <int K, int S>
+static void depthwiseConvPlane(const float *input, int input_h, int input_w,
+                               const float *weight, int pad_h, int pad_w,
+                               float *output, int output_h, int output_w) {
+  // 内部区域 [oy_begin, oy_end) x [ox_begin, ox_end)
+  int oy_begin = std::min((pad_h + S - 1) / S, output_h);
+  int oy_end = input_h + pad_h - K >= 0 ? (input_h + pad_h - K) / S + 1 : 0;
+  oy_end = std::max(std::min(oy_end, output_h), oy_begin);
+  int ox_begin = std::min((pad_w + S - 1) / S, output_w);
+  int ox_end = input_w + pad_w - K >= 0 ? (input_w + pad_w - K) / S + 1 : 0;
+  ox_end = std::max(std::min(ox_end, output_w), ox_begin);
+
+  for (int oy = 0; oy < output_h; ++oy) {
+    int iy0 = oy * S - pad_h;
+    float *out = output + oy * output_w;
+    if (oy < oy_begin || oy >= oy_end) {
+      for (int ox = 0; ox < output_w; ++ox) {
+        out[ox] = depthwiseConvPoint<K>(input, input_h, input_w, weight, iy0,
+                                        ox * S - pad_w);
+      }
+      continue;
+    }
+    for (int ox = 0; ox < ox_begin; ++ox) {
+      out[ox] = depthwiseConvPoint<K>(input, input_h, input_w, weight, iy0,
+                                      ox * S - pad_w);
+    }
+    for (int ox = ox_begin; ox < ox_end; ++ox) {
+      out[ox] = 0.0f;
+    }
+    for (int i = 0; i < K; ++i) {
+      const float *row = input + (iy0 + i) * input_w - pad_w;
+      for (int j = 0; j < K; ++j) {
+        const float w = weight[i * K + j];
+        const float *src = row + j;
+        for (int ox = ox_begin; ox < ox_end; ++ox) {
+          out[ox] += w * src[ox * S];
+        }
+      }
+    }
+    for (int ox = ox_end; ox < output_w; ++ox) {
+      out[ox] = depthwiseConvPoint<K>(input, input_h, input_w, weight, iy0,
+                                      ox * S - pad_w);
+    }
+  }
+}
+
+typedef void (*DepthwiseConvPlaneFunc)(const float *input, int input_h,
+                                       int input_w, const float *weight,
+                                       int pad_h, int pad_w, float *output,
+                                       int output_h, int output_w);
+
+static DepthwiseConvPlaneFunc getDepthwiseConvPlaneFunc(int kernel,
+                                                        int stride) {
+  if (kernel == 3) {
+    return stride == 1 ? depthwiseConvPlane<3, 1> : depthwiseConvPlane<3, 2>;
+  } else {
+    return stride == 1 ? depthwiseConvPlane<5, 1> : depthwiseConvPlane<5, 2>;
+  }
+}
+
+// 每个任务计算一个(batch, channel)平面
+class DepthwiseConvLoopBody : public thread_pool::ParallelLoopBody {
+ public:
+  DepthwiseConvLoopBody(const float *input, const float *weight,
+                        const float *bias, float *output, int channels,
+                        int input_h, int input_w, int kernel, int pad_h,
+                        int pad_w, int output_h, int output_w,
+                        DepthwiseConvPlaneFunc plane_func,
+                        SgemmEpilogueFunc epilogue_func)
+      : input_(input),
+        weight_(weight),
+        bias_(bias),
+        output_(output),
+        channels_(channels),
+        input_h_(input_h),
+        input_w_(input_w),
+        kernel_(kernel),
+        pad_h_(pad_h),
+        pad_w_(pad_w),
+        output_h_(output_h),
+        output_w_(output_w),
+        plane_func_(plane_func),
+        epilogue_func_(epilogue_func) {}
+
+  virtual void operator()(const base::Range &range) const {
+    for (int plane = range.start_; plane < range.end_; ++plane) {
+      int c = plane % channels_;
+      const float *input = input_ + (size_t)plane * input_h_ * input_w_;
+      float *output = output_ + (size_t)plane * output_h_ * output_w_;
+      plane_func_(input, input_h_, input_w_, weight_ + c * kernel_ * kernel_,
+                  pad_h_, pad_w_, output, output_h_, output_w_);
+      // 每个通道的bias相同, 按一行处理
+      if (epilogue_func_ != nullptr) {
+        epilogue_func_(output, 0, 1, output_h_ * output_w_,
+                       bias_ != nullptr ? bias_ + c : nullptr);
+      }
+    }
+  }
+
+ private:
+  const float *input_;
+  const float *weight_;
+  const float *bias_;
+  float *output_;
+  int channels_;
+  int input_h_;
+  int input_w_;
+  int kernel_;
+  int pad_h_;
+  int pad_w_;
+  int output_h_;
+  int output_w_;
+  DepthwiseConvPlaneFunc plane_func_;
+  SgemmEpilogueFunc epilogue_func_;
+};
+
+/**
+ * @brief pointwise卷积, 1x1/stride1/pad0
+ * # 每个group的输入[input_c / group, h * w]直接作为GEMM的B矩阵
+ */
+static bool isPointwiseSuitable(ir::ConvParam *param,
+                                const base::IntVector &weight_shape) {
+  if (weight_shape.size() != 4 || weight_shape[2] != 1 ||
+      weight_shape[3] != 1) {
+    return false;
+  }
+  return isAllEqual(param->strides_, 1) && isAllEqual(param->pads_, 0);
+}
+
+/**
+ * @brief 通道分块格式(NC4HW/NC8HW)的直接卷积，支持group1与depthwise
+ * # 输入输出的存储为[N, CB, H, W, block]，权重在preRun中打包为
+ *   group1: [OCB, KH, KW, IC, block]，depthwise: [CB, KH, KW, block]
+ * # 一个输出tile为连续T个输出点的block个通道，累加器常驻寄存器，
+ *   每个权重向量与T个输入点相乘
+ * # 宽度方向分为内部区域与边界区域，内部区域的窗口完全在输入内，不做越界判断
+ */
+static bool isBlockedSuitable(ir::ConvParam *param,
+                              const base::IntVector &weight_shape) {
+  if (weight_shape.size() != 4) {
+    return false;
+  }
+  if (param->group_ == 1) {
+    return true;
+  }
+  return weight_shape[1] == 1 && weight_shape[0] == param->group_;
+}
+
+static bool isBlockedDepthwise(ir::ConvParam *param) {
+  return param->group_ > 1;
+}
+
+struct ConvBlockedArgs {
+  const float *input_ = nullptr;
+  const float *weight_ = nullptr;
+  // 按输出通道补齐到块大小
+  const float *bias_ = nullptr;
+  float *output_ = nullptr;
+  int input_c_ = 0;
+  int input_h_ = 0;
+  int input_w_ = 0;
+  int output_c_ = 0;
+  int output_h_ = 0;
+  int output_w_ = 0;
+  int kernel_h_ = 0;
+  int kernel_w_ = 0;
+  int stride_h_ = 1;
+  int stride_w_ = 1;
+  int dilation_h_ = 1;
+  int dilation_w_ = 1;
+  int pad_h_ = 0;
+  int pad_w_ = 0;
+  SgemmEpilogueFunc epilogue_ = nullptr;
+};
+
+// group1的输出tile，input为当前batch，weight、bias为当前输出块
+// 权重为[KH, KW, IC, block]，最内层循环的每个输入通道读一个连续的权重向量
+template <int B, int T, bool kCheck>
+static NNDEPLOY_CONV_INLINE void convBlockedTile(
+    const ConvBlockedArgs &args, const float *input, const float *weight,
+    const float *bias, float *output, int oh, int ow) {
+  static_assert(!kCheck || T == 1, "border tile must be a single point");
+  float acc[T][B];
+  for (int t = 0; t < T; ++t) {
+    for (int l = 0; l < B; ++l) {
+      acc[t][l] = bias[l];
+    }
+  }
+  const int input_c = args.input_c_;
+  const size_t input_block = (size_t)args.input_h_ * args.input_w_ * B;
+  const int step = args.stride_w_ * B;
+  for (int kh = 0; kh < args.kernel_h_; ++kh) {
+    int ih = oh * args.stride_h_ - args.pad_h_ + kh * args.dilation_h_;
+    if (ih < 0 || ih >= args.input_h_) {
+      continue;
+    }
+    for (int kw = 0; kw < args.kernel_w_; ++kw) {
+      int iw0 = ow * args.stride_w_ - args.pad_w_ + kw * args.dilation_w_;
+      // 边界区域T为1，只需判断一个输出点
+      if (kCheck && (iw0 < 0 || iw0 >= args.input_w_)) {
+        continue;
+      }
+      const float *x_k = input + ((size_t)ih * args.input_w_ + iw0) * B;
+      const float *w_k =
+          weight + (size_t)(kh * args.kernel_w_ + kw) * input_c * B;
+      for (int ic = 0; ic < input_c; ++ic) {
+        // 补齐的输入通道不参与计算
+        const float *x = x_k + (ic / B) * input_block + ic % B;
+        const float *w = w_k + (size_t)ic * B;
+        for (int t = 0; t < T; ++t) {
+          const float x_value = x[t * step];
+          for (int l = 0; l < B; ++l) {
+            acc[t][l] += x_value * w[l];
+          }
+        }
+      }
+    }
+  }
+  for (int t = 0; t < T; ++t) {
+    for (int l = 0; l < B; ++l) {
+      output[(ow + t) * B + l] = acc[t][l];
+    }
+  }
+}
+
+// depthwise的输出tile，input、weight、bias都为当前通道块，block个通道各自独立
+template <int B, int T, bool kCheck>
+static NNDEPLOY_CONV_INLINE void convBlockedDepthwiseTile(
+    const ConvBlockedArgs &args, const float *input, const float *weight,
+    const float *bias, float *output, int oh, int ow) {
+  float acc[T][B];
+  for (int t = 0; t < T; ++t) {
+    for (int l = 0; l < B; ++l) {
+      acc[t][l] = bias[l];
+    }
+  }
+  for (int kh = 0; kh < args.kernel_h_; ++kh) {
+    int ih = oh * args.stride_h_ - args.pad_h_ + kh * args.dilation_h_;
+    if (ih < 0 || ih >= args.input_h_) {
+      continue;
+    }
+    const float *x_row = input + (size_t)ih * args.input_w_ * B;
+    for (int kw = 0; kw < args.kernel_w_; ++kw) {
+      const float *w = weight + (kh * args.kernel_w_ + kw) * B;
+      int iw0 = ow * args.stride_w_ - args.pad_w_ + kw * args.dilation_w_;
+      for (int t = 0; t < T; ++t) {
+        int iw = iw0 + t * args.stride_w_;
+        if (kCheck && (iw < 0 || iw >= args.input_w_)) {
+          continue;
+        }
+        const float *x = x_row + (size_t)iw * B;
+        for (int l = 0; l < B; ++l) {
+          acc[t][l] += x[l] * w[l];
+        }
+      }
+    }
+  }
+  for (int t = 0; t < T; ++t) {
+    for (int l = 0; l < B; ++l) {
+      output[(ow + t) * B + l] = acc[t][l];
+    }
+  }
+}
+
+/**
+ * @brief 输出tile的通用实现，累加器为T * block个float
+ */
+template <int B>
+struct ConvBlockedKernel {
+  // 累加器共32个float
+  static constexpr int kTile = 32 / B;
+
+  template <int T, bool kCheck>
+  static NNDEPLOY_CONV_INLINE void tile(const ConvBlockedArgs &args,
+                                        const float *input,
+                                        const float *weight, const float *bias,
+                                        float *output, int oh, int ow) {
+    convBlockedTile<B, T, kCheck>(args, input, weight, bias, output, oh, ow);
+  }
+
+  template <int T, bool kCheck>
+  static NNDEPLOY_CONV_INLINE void depthwiseTile(
+      const ConvBlockedArgs &args, const float *input, const float *weight,
+      const float *bias, float *output, int oh, int ow) {
+    convBlockedDepthwiseTile<B, T, kCheck>(args, input, weight, bias, output,
+                                           oh, ow);
+  }
+};
+
+#ifdef NNDEPLOY_CONV_X86
+// block为8的AVX2实现，一个输出点的累加器为一个ymm寄存器
+template <int T, bool kCheck>
+NNDEPLOY_CONV_AVX2 static void convBlockedTileAvx2(
+    const ConvBlockedArgs &args, const float *input, const float *weight,
+    const float *bias, float *output, int oh, int ow) {
+  static_assert(!kCheck || T == 1, "border tile must be a single point");
+  __m256 acc[T];
+  const __m256 bias_v = _mm256_loadu_ps(bias);
+  for (int t = 0; t < T; ++t) {
+    acc[t] = bias_v;
+  }
+  const int input_c = args.input_c_;
+  const size_t input_block = (size_t)args.input_h_ * args.input_w_ * 8;
+  const int step = args.stride_w_ * 8;
+  for (int kh = 0; kh < args.kernel_h_; ++kh) {
+    int ih = oh * args.stride_h_ - args.pad_h_ + kh * args.dilation_h_;
+    if (ih < 0 || ih >= args.input_h_) {
+      continue;
+    }
+    for (int kw = 0; kw < args.kernel_w_; ++kw) {
+      int iw0 = ow * args.stride_w_ - args.pad_w_ + kw * args.dilation_w_;
+      if (kCheck && (iw0 < 0 || iw0 >= args.input_w_)) {
+        continue;
+      }
+      const float *x = input + ((size_t)ih * args.input_w_ + iw0) * 8;
+      const float *w =
+          weight + (size_t)(kh * args.kernel_w_ + kw) * input_c * 8;
+      for (int ic = 0; ic < input_c; ic += 8) {
+        // 补齐的输入通道不参与计算
+        const int lanes = std::min(8, input_c - ic);
+        for (int il = 0; il < lanes; ++il) {
+          const __m256 w_v = _mm256_loadu_ps(w + il * 8);
+          for (int t = 0; t < T; ++t) {
+            acc[t] = _mm256_fmadd_ps(_mm256_broadcast_ss(x + t * step + il),
+                                     w_v, acc[t]);
+          }
+        }
+        x += input_block;
+        w += 64;
+      }
+    }
+  }
+  for (int t = 0; t < T; ++t) {
+    _mm256_storeu_ps(output + (ow + t) * 8, acc[t]);
+  }
+}
+
+template <int T, bool kCheck>
+NNDEPLOY_CONV_AVX2 static void convBlockedDepthwiseTileAvx2(
+    const ConvBlockedArgs &args, const float *input, const float *weight,
+    const float *bias, float *output, int oh, int ow) {
+  __m256 acc[T];
+  const __m256 bias_v = _mm256_loadu_ps(bias);
+  for (int t = 0; t < T; ++t) {
+    acc[t] = bias_v;
+  }
+  for (int kh = 0; kh < args.kernel_h_; ++kh) {
+    int ih = oh * args.stride_h_ - args.pad_h_ + kh * args.dilation_h_;
+    if (ih < 0 || ih >= args.input_h_) {
+      continue;
+    }
+    const float *x_row = input + (size_t)ih * args.input_w_ * 8;
+    for (int kw = 0; kw < args.kernel_w_; ++kw) {
+      const __m256 w_v =
+          _mm256_loadu_ps(weight + (kh * args.kernel_w_ + kw) * 8);
+      int iw0 = ow * args.stride_w_ - args.pad_w_ + kw * args.dilation_w_;
+      for (int t = 0; t < T; ++t) {
+        int iw = iw0 + t * args.stride_w_;
+        if (kCheck && (iw < 0 || iw >= args.input_w_)) {
+          continue;
+        }
+        acc[t] = _mm256_fmadd_ps(_mm256_loadu_ps(x_row + (size_t)iw * 8), w_v,
+                                 acc[t]);
+      }
+    }
+  }
+  for (int t = 0; t < T; ++t) {
+    _mm256_storeu_ps(output + (ow + t) * 8, acc[t]);
+  }
+}
+
+struct ConvBlockedKernelAvx2 {
+  // 累加器占12个ymm寄存器
+  static constexpr int kTile = 12;
+
+  template <int T, bool kCheck>
+  static NNDEPLOY_CONV_INLINE void tile(const ConvBlockedArgs &args,
+                                        const float *input,
+                                        const float *weight, const float *bias,
+                                        float *output, int oh, int ow) {
+    convBlockedTileAvx2<T, kCheck>(args, input, weight, bias, output, oh, ow);
+  }
+
+  template <int T, bool kCheck>
+  static NNDEPLOY_CONV_INLINE void depthwiseTile(
+      const ConvBlockedArgs &args, const float *input, const float *weight,
+      const float *bias, float *output, int oh, int ow) {
+    convBlockedDepthwiseTileAvx2<T, kCheck>(args, input, weight, bias, output,
+                                            oh, ow);
+  }
+};
+#endif
+
+template <typename Kernel, bool kDepthwise, int T, bool kCheck>
+static NNDEPLOY_CONV_INLINE void convBlockedTileDispatch(
+    const ConvBlockedArgs &args, const float *input, const float *weight,
+    const float *bias, float *output, int oh, int ow) {
+  if (kDepthwise) {
+    Kernel::template depthwiseTile<T, kCheck>(args, input, weight, bias,
+                                              output, oh, ow);
+  } else {
+    Kernel::template tile<T, kCheck>(args, input, weight, bias, output, oh,
+                                     ow);
+  }
+}
+
+/**
+ * @brief 计算一行输出[OW, block]，task按[N, OCB, OH]编号
+ * # 内部区域依次用kTile、kTile / 2个输出点的tile，其余逐点计算
+ */
+template <int B, bool kDepthwise, typename Kernel>
+static NNDEPLOY_CONV_INLINE void convBlockedRowImpl(
+    const ConvBlockedArgs &args, int task) {
+  constexpr int T = Kernel::kTile;
+  constexpr int kHalf = T / 2;
+  const int output_blocks = (args.output_c_ + B - 1) / B;
+  const int input_blocks = (args.input_c_ + B - 1) / B;
+  const int oh = task % args.output_h_;
+  const int ocb = (task / args.output_h_) % output_blocks;
+  const int n = task / args.output_h_ / output_blocks;
+  const size_t input_block = (size_t)args.input_h_ * args.input_w_ * B;
+  const float *input = args.input_ + (size_t)n * input_blocks * input_block;
+  const float *weight = nullptr;
+  if (kDepthwise) {
+    input += ocb * input_block;
+    weight = args.weight_ + (size_t)ocb * args.kernel_h_ * args.kernel_w_ * B;
+  } else {
+    weight = args.weight_ +
+             (size_t)ocb * args.input_c_ * args.kernel_h_ * args.kernel_w_ * B;
+  }
+  const float *bias = args.bias_ + ocb * B;
+  float *output = args.output_ + (size_t)task * args.output_w_ * B;
+
+  // 内部区域 [ow_begin, ow_end)，窗口完全在输入内
+  const int output_w = args.output_w_;
+  const int reach = (args.kernel_w_ - 1) * args.dilation_w_;
+  int ow_begin = (args.pad_w_ + args.stride_w_ - 1) / args.stride_w_;
+  ow_begin = std::min(ow_begin, output_w);
+  int last = args.input_w_ + args.pad_w_ - reach - 1;
+  int ow_end = last >= 0 ? last / args.stride_w_ + 1 : 0;
+  ow_end = std::max(std::min(ow_end, output_w), ow_begin);
+
+  int ow = 0;
+  for (; ow < ow_begin; ++ow) {
+    convBlockedTileDispatch<Kernel, kDepthwise, 1, true>(
+        args, input, weight, bias, output, oh, ow);
+  }
+  for (; ow + T <= ow_end; ow += T) {
+    convBlockedTileDispatch<Kernel, kDepthwise, T, false>(
+        args, input, weight, bias, output, oh, ow);
+  }
+  for (; ow + kHalf <= ow_end; ow += kHalf) {
+    convBlockedTileDispatch<Kernel, kDepthwise, kHalf, false>(
+        args, input, weight, bias, output, oh, ow);
+  }
+  for (; ow < ow_end; ++ow) {
+    convBlockedTileDispatch<Kernel, kDepthwise, 1, false>(
+        args, input, weight, bias, output, oh, ow);
+  }
+  for (; ow < output_w; ++ow) {
+    convBlockedTileDispatch<Kernel, kDepthwise, 1, true>(
+        args, input, weight, bias, output, oh, ow);
+  }
+  if (args.epilogue_ != nullptr) {
+    args.epilogue_(output, 0, 1, output_w * B, nullptr);
+  }
+}
+
+typedef void (*ConvBlockedRowFunc)(const ConvBlockedArgs &args, int task);
+
+static void convBlockedRow4(const ConvBlockedArgs &args, int task) {
+  convBlockedRowImpl<4, false, ConvBlockedKernel<4>>(args, task);
+}
+static void convBlockedDepthwiseRow4(const ConvBlockedArgs &args, int task) {
+  convBlockedRowImpl<4, true, ConvBlockedKernel<4>>(args, task);
+}
+static void convBlockedRow8(const ConvBlockedArgs &args, int task) {
+  convBlockedRowImpl<8, false, ConvBlockedKernel<8>>(args, task);
+}
+static void convBlockedDepthwiseRow8(const ConvBlockedArgs &args, int task) {
+  convBlockedRowImpl<8, true, ConvBlockedKernel<8>>(args, task);
+}
+
+#ifdef NNDEPLOY_CONV_X86
+NNDEPLOY_CONV_AVX2 static void convBlockedRow8Avx2(
+    const ConvBlockedArgs &args, int task) {
+  convBlockedRowImpl<8, false, ConvBlockedKernelAvx2>(args, task);
+}
+NNDEPLOY_CONV_AVX2 static void convBlockedDepthwiseRow8Avx2(
+    const ConvBlockedArgs &args, int task) {
+  convBlockedRowImpl<8, true, ConvBlockedKernelAvx2>(args, task);
+}
+#endif
+
+static ConvBlockedRowFunc getConvBlockedRowFunc(int block, bool depthwise) {
+  if (block == 4) {
+    return depthwise ? convBlockedDepthwiseRow4 : convBlockedRow4;
+  }
+  if (block != 8) {
+    return nullptr;
+  }
+#ifdef NNDEPLOY_CONV_X86
+  if (base::isCpuIsaSupported(base::kCpuIsaAvx2)) {
+    return depthwise ? convBlockedDepthwiseRow8Avx2 : convBlockedRow8Avx2;
+  }
+#endif
+  return depthwise ? convBlockedDepthwiseRow8 : convBlockedRow8;
+}
+
+class ConvBlockedLoopBody : public thread_pool::ParallelLoopBody {
+ public:
+  ConvBlockedLoopBody(const ConvBlockedArgs &args, ConvBlockedRowFunc func)
+      : args_(args), func_(func) {}
+
+  virtual void operator()(const base::Range &range) const {
+    for (int task = range.start_; task < range.end_; ++task) {
+      func_(args_, task);
+    }
+  }
+
+ private:
+  const ConvBlockedArgs &args_;
+  ConvBlockedRowFunc func_;
+};
+
+uint64_t OpConv::getFlops() {
+  auto weight_shape = inputs_[1]->getShape();
+  return base::shapeCount(outputs_[0]->getShape(), 0, -1) *
+         base::shapeCount(weight_shape, 1, -1);
+}
+
+base::Status OpConv::init() {
+  base::Status status = Op::init();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "Op::init failed");
+
+  auto param = dynamic_cast<ir::ConvParam *>(op_desc_.op_param_.get());
+  NNDEPLOY_CHECK_PARAM_NULL_RET_STATUS(param, "op_desc_.op_param_ is nullptr");
+  device::Tensor *weight_tensor = inputs_.size() > 1 ? inputs_[1] : nullptr;
+  if (weight_tensor == nullptr || weight_tensor->getData() == nullptr) {
+    return status;
+  }
+  // 权重由其他op产生时，init时数据尚未计算，在run中变换
+  if (!isInputWeight(1)) {
+    return status;
+  }
+  int block = base::getChannelBlock(inputs_[0]->getDataFormat());
+  if (block > 1) {
+    return packBlockedWeight(block);
+  }
+  if (!isWinogradSuitable(param, weight_tensor->getShape())) {
+    return status;
+  }
+  return packWinogradWeight();
+}
+
+base::Status OpConv::packWinogradWeight() {
+  // 权重变换 [output_c, input_c, 3, 3] -> [36, output_c, input_c]
+  device::Tensor *weight_tensor = inputs_[1];
+  base::IntVector weight_shape = weight_tensor->getShape();
+  int output_c = weight_shape[0];
+  int input_c = weight_shape[1];
+  const int alpha2 = kWinogradAlpha * kWinogradAlpha;
+  device::TensorDesc desc(base::dataTypeOf<float>(), base::kDataFormatNCL,
+                          {alpha2, output_c, input_c});
+  if (winograd_weight_ == nullptr ||
+      winograd_weight_->getShape() != desc.shape_) {
+    if (winograd_weight_ != nullptr) {
+      delete winograd_weight_;
+    }
+    device::Device *device = device::getDevice(device_type_);
+    winograd_weight_ =
+        new device::Tensor(device, desc, op_desc_.name_ + ".winograd_weight");
+  }
+  const float *weight_data = static_cast<float *>(weight_tensor->getData());
+  float *u_data = static_cast<float *>(winograd_weight_->getData());
+  float u[alpha2];
+  for (int oc = 0; oc < output_c; ++oc) {
+    for (int ic = 0; ic < input_c; ++ic) {
+      winogradWeightTransform(weight_data + ((size_t)oc * input_c + ic) * 9,
+                              u);
+      for (int xi = 0; xi < alpha2; ++xi) {
+        u_data[((size_t)xi * output_c + oc) * input_c + ic] = u[xi];
+      }
+    }
+  }
+  return base::kStatusCodeOk;
+}
+
+base::Status OpConv::packBlockedWeight(int block) {
+  auto param = dynamic_cast<ir::ConvParam *>(op_desc_.op_param_.get());
+  base::IntVector weight_shape = inputs_[1]->getShape();
+  if (!isBlockedSuitable(param, weight_shape)) {
+    NNDEPLOY_LOGE("OpConv[%s] with group[%d] not support %s.\n",
+                  op_desc_.name_.c_str(), param->group_,
+                  base::dataFormatToString(inputs_[0]->getDataFormat())
+                      .c_str());
+    return base::kStatusCodeErrorNotSupport;
+  }
+  // group1: [OC, IC, KH, KW] -> [OCB, KH, KW, IC, block]
+  // depthwise: [C, 1, KH, KW] -> [CB, KH, KW, block]
+  int output_c = weight_shape[0];
+  int input_c = weight_shape[1];
+  int kernel_size = weight_shape[2] * weight_shape[3];
+  int output_blocks = (output_c + block - 1) / block;
+  device::TensorDesc desc(base::dataTypeOf<float>(), base::kDataFormatNCL,
+                          {output_blocks, kernel_size * input_c, block});
+  if (blocked_weight_ == nullptr ||
+      blocked_weight_->getShape() != desc.shape_) {
+    if (blocked_weight_ != nullptr) {
+      delete blocked_weight_;
+    }
+    device::Device *device = device::getDevice(device_type_);
+    blocked_weight_ =
+        new device::Tensor(device, desc, op_desc_.name_ + ".blocked_weight");
+  }
+  blocked_weight_block_ = block;
+  const float *weight_data = static_cast<float *>(inputs_[1]->getData());
+  float *packed = static_cast<float *>(blocked_weight_->getData());
+  for (int ocb = 0; ocb < output_blocks; ++ocb) {
+    for (int k = 0; k < kernel_size; ++k) {
+      for (int ic = 0; ic < input_c; ++ic) {
+        float *dst =
+            packed + (((size_t)ocb * kernel_size + k) * input_c + ic) * block;
+        for (int l = 0; l < block; ++l) {
+          int oc = ocb * block + l;
+          dst[l] = oc < output_c
+                       ? weight_data[((size_t)oc * input_c + ic) * kernel_size +
+                                     k]
+                       : 0.0f;
+        }
+      }
+    }
+  }
+  return base::kStatusCodeOk;
+}
+
+base::Status OpConv::deinit() {
+  if (winograd_weight_ != nullptr) {
+    delete winograd_weight_;
+    winograd_weight_ = nullptr;
+  }
+  if (blocked_weight_ != nullptr) {
+    delete blocked_weight_;
+    blocked_weight_ = nullptr;
+    blocked_weight_block_ = 0;
+  }
+  return Op::deinit();
+}
+
+uint64_t OpConv::getAlgorithmWorkspaceSize() {
+  auto param = dynamic_cast<ir::ConvParam *>(op_desc_.op_param_.get());
+  base::IntVector input_shape = inputs_[0]->getShape();
+  base::IntVector weight_shape = inputs_[1]->getShape();
+  base::IntVector output_shape = outputs_[0]->getShape();
+  if (input_shape.size() != 4 || weight_shape.size() != 4 ||
+      output_shape.size() != 4 || param->group_ <= 0) {
+    return 0;
+  }
+  switch (algorithm_) {
+    case kConvAlgorithmWinograd:
+      return getWinogradWorkspaceSize(input_shape, output_shape);
+    case kConvAlgorithmDepthwise:
+    case kConvAlgorithmBlocked:
+      return 0;
+    case kConvAlgorithmPointwise:
+      return sgemmWorkspaceSize(weight_shape[0] / param->group_,
+                                output_shape[2] * output_shape[3],
+                                weight_shape[1]);
+    default:
+      return getIm2colWorkspaceSize(weight_shape, output_shape, param->group_);
+  }
+}
+
+base::Status OpConv::preRun() {
+  auto param = dynamic_cast<ir::ConvParam *>(op_desc_.op_param_.get());
+  NNDEPLOY_CHECK_PARAM_NULL_RET_STATUS(param, "op_desc_.op_param_ is nullptr");
+  // 选择卷积算法
+  base::IntVector weight_shape = inputs_[1]->getShape();
+  int block = base::getChannelBlock(inputs_[0]->getDataFormat());
+  if (block > 1) {
+    algorithm_ = kConvAlgorithmBlocked;
+  } else if (isDepthwiseSuitable(param, weight_shape)) {
+    algorithm_ = kConvAlgorithmDepthwise;
+  } else if (isPointwiseSuitable(param, weight_shape)) {
+    algorithm_ = kConvAlgorithmPointwise;
+  } else if (isWinogradSuitable(param, weight_shape)) {
+    algorithm_ = kConvAlgorithmWinograd;
+  } else {
+    algorithm_ = kConvAlgorithmIm2colGemm;
+  }
+  // 单算子模式下，输出形状在checkOrAllocOutput中确定，此时在run中更新
+  return updateWorkspaceSize(getAlgorithmWorkspaceSize());
+}
+
 base::Status OpConv::run() {
   base::Status status = base::kStatusCodeOk;
+
+  auto input_shape = inputs_[0]->getShape();
+  auto weight_shape = inputs_[1]->getShape();
+  auto output_shape = outputs_[0]->getShape();
+  if (input_shape.size() != 4 || weight_shape.size() != 4 ||
+      output_shape.size() != 4) {
+    NNDEPLOY_LOGE("OpConv only support 2D conv.\n");
+    return base::kStatusCodeErrorNotImplement;
+  }
+  auto param = dynamic_cast<ir::ConvParam *>(op_desc_.op_param_.get());
+  NNDEPLOY_CHECK_PARAM_NULL_RET_STATUS(param, "op_desc_.op_param_ is nullptr");
+  int group = param->group_;
+  if (group <= 0 || input_shape[1] != weight_shape[1] * group ||
+      weight_shape[0] % group != 0) {
+    NNDEPLOY_LOGE("OpConv group[%d] is invalid.\n", group);
+    return base::kStatusCodeErrorInvalidParam;
+  }
+  if (!isSgemmActivateSupported(param->activate_op_)) {
+    NNDEPLOY_LOGE("OpConv not support activate op[%s].\n",
+                  ir::opTypeToString(param->activate_op_).c_str());
+    return base::kStatusCodeErrorNotImplement;
+  }
+
+  // 权重不是常量时，每次运行前重新变换
+  if (algorithm_ == kConvAlgorithmWinograd &&
+      (winograd_weight_ == nullptr || !isInputWeight(1))) {
+    status = packWinogradWeight();
+    NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk,
+                           "packWinogradWeight failed");
+  }
+  int block = base::getChannelBlock(inputs_[0]->getDataFormat());
+  if (algorithm_ == kConvAlgorithmBlocked &&
+      (blocked_weight_block_ != block || !isInputWeight(1))) {
+    status = packBlockedWeight(block);
+    NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk,
+                           "packBlockedWeight failed");
+  }
+
+  // workspace
+  status = updateWorkspaceSize(getAlgorithmWorkspaceSize());
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk,
+                         "updateWorkspaceSize failed");
+  status = allocateWorkspace();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk,
+                         "allocateWorkspace failed");
+
+  switch (algorithm_) {
+    case kConvAlgorithmWinograd:
+      status = runWinograd();
+      break;
+    case kConvAlgorithmDepthwise:
+      status = runDepthwise();
+      break;
+    case kConvAlgorithmPointwise:
+      status = runPointwise();
+      break;
+    case kConvAlgorithmBlocked:
+      status = runBlocked();
+      break;
+    default:
+      status = runIm2colGemm();
+      break;
+  }
+  return status;
+}
+
+base::Status OpConv::runIm2colGemm() {
+  base::Status status = base::kStatusCodeOk;
   // 获取输入和权重张量
   device::Tensor *input_tensor = inputs_[0];
   device::Tensor *weight_tensor = inputs_[1];
@@ -143,83 +1449,284 @@ base::Status OpConv::run() {
   std::vector<int> pads = param->pads_;
   std::vector<int> strides = param->strides_;
   std::vector<int> dilations = param->dilations_;
-  std::vector<int> kernel_shape = param->kernel_shape_;
+  int group = param->group_;
 
   // 执行卷积操作
-  float *input_data = static_cast<float *>(input_tensor->getData());
-  float *weight_data = static_cast<float *>(weight_tensor->getData());
+  const float *input_data = static_cast<float *>(input_tensor->getData());
+  const float *weight_data = static_cast<float *>(weight_tensor->getData());
   float *output_data = static_cast<float *>(output_tensor->getData());
-  float *bias_data =
+  const float *bias_data =
       bias_tensor ? static_cast<float *>(bias_tensor->getData()) : nullptr;
 
-  int output_height = output_shape[2];
-  int output_width = output_shape[3];
-
-  for (int n = 0; n < input_shape[0]; ++n) {
-    for (int f = 0; f < weight_shape[0]; ++f) {
-      for (int y = 0; y < output_height; ++y) {
-        for (int x = 0; x < output_width; ++x) {
-          float value = 0.0f;
-          for (int k = 0; k < input_shape[1]; ++k) {
-            for (int i = 0; i < kernel_shape[0]; ++i) {
-              for (int j = 0; j < kernel_shape[1]; ++j) {
-                int input_y = y * strides[0] + i * dilations[0] - pads[0];
-                int input_x = x * strides[1] + j * dilations[1] - pads[1];
-                if (input_y >= 0 && input_y < input_shape[2] && input_x >= 0 &&
-                    input_x < input_shape[3]) {
-                  value += input_data[n * input_shape[1] * input_shape[2] *
-                                          input_shape[3] +
-                                      k * input_shape[2] * input_shape[3] +
-                                      input_y * input_shape[3] + input_x] *
-                           weight_data[f * input_shape[1] * kernel_shape[0] *
-                                           kernel_shape[1] +
-                                       k * kernel_shape[0] * kernel_shape[1] +
-                                       i * kernel_shape[1] + j];
-                }
-              }
-            }
-          }
+  int batch = input_shape[0];
+  int input_c = input_shape[1];
+  int input_h = input_shape[2];
+  int input_w = input_shape[3];
+  int output_c = output_shape[1];
+  int output_h = output_shape[2];
+  int output_w = output_shape[3];
+  int kernel_h = weight_shape[2];
+  int kernel_w = weight_shape[3];
 
-          // bias  add
-          if (bias_data) {
-            value += bias_data[f];
-          }
+  // 每个group的GEMM: C[m, n] = A[m, k] * B[k, n]
+  // A: 权重, B: im2col矩阵, C: 输出
+  int group_input_c = input_c / group;
+  int m = output_c / group;
+  int k = group_input_c * kernel_h * kernel_w;
+  int n = output_h * output_w;
+  float *data_col = static_cast<float *>(workspace_);
+  uint64_t col_size = alignWorkspace((uint64_t)k * n * sizeof(float));
+  void *sgemm_workspace = static_cast<char *>(workspace_) + col_size;
 
-          // 融合算子
-          switch (param->activate_op_) {
-            // NOT FUSE
-            case ir::kOpTypeNone:
-              break;
-
-            case ir::kOpTypeRelu:
-              value = value > 0.0f ? value : 0.0f;
-              break;
-            case ir::kOpTypeSigmoid:
-              value = 1.0 / (1.0 + exp(-value));
-              break;
-            case ir::kOpTypeTanh:
-              value = tanh(value);
-              break;
-
-              // case ir::kOpTypeRelu6:
-              //   value = value > 0.0f ? (value < 6.0f ? value : 6.0f) : 0.0f;
-              //   break;
-
-            default:
-              NNDEPLOY_LOGI("not implemented.\n");
-              return base::kStatusCodeOk;
-          }
-          output_data[n * weight_shape[0] * output_height * output_width +
-                      f * output_height * output_width + y * output_width + x] =
-              value;
-        }
+  SgemmEpilogue epilogue;
+  epilogue.activate_op_ = param->activate_op_;
+  // 每个(batch, group)分到的计算量，im2col按它决定是否并行
+  uint64_t cost = getFlops() / ((uint64_t)batch * group);
+  for (int b = 0; b < batch; ++b) {
+    for (int g = 0; g < group; ++g) {
+      const float *im =
+          input_data + ((size_t)b * input_c + g * group_input_c) * input_h *
+                           input_w;
+      Im2colLoopBody im2col_body(im, input_h, input_w, kernel_h, kernel_w,
+                                 pads[0], pads[1], strides[0], strides[1],
+                                 dilations[0], dilations[1], output_h,
+                                 output_w, data_col);
+      thread_pool::parallelForWithCost(base::Range(0, group_input_c),
+                                       im2col_body, cost);
+      const float *a = weight_data + (size_t)g * m * k;
+      float *c = output_data + ((size_t)b * output_c + g * m) * n;
+      epilogue.bias_ = bias_data != nullptr ? bias_data + g * m : nullptr;
+      status = sgemm(m, n, k, a, k, data_col, n, c, n, epilogue,
+                     sgemm_workspace);
+      NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "sgemm failed");
+    }
+  }
+
+  return status;
+}
+
+base::Status OpConv::runWinograd() {
+  base::Status status = base::kStatusCodeOk;
+  device::Tensor *input_tensor = inputs_[0];
+  device::Tensor *bias_tensor = inputs_.size() > 2 ? inputs_[2] : nullptr;
+  device::Tensor *output_tensor = outputs_[0];
+  auto input_shape = input_tensor->getShape();
+  auto output_shape = output_tensor->getShape();
+  auto param = dynamic_cast<ir::ConvParam *>(op_desc_.op_param_.get());
+
+  const float *input_data = static_cast<float *>(input_tensor->getData());
+  const float *u_data = static_cast<float *>(winograd_weight_->getData());
+  float *output_data = static_cast<float *>(output_tensor->getData());
+  const float *bias_data =
+      bias_tensor ? static_cast<float *>(bias_tensor->getData()) : nullptr;
+
+  int batch = input_shape[0];
+  int input_c = input_shape[1];
+  int input_h = input_shape[2];
+  int input_w = input_shape[3];
+  int output_c = output_shape[1];
+  int output_h = output_shape[2];
+  int output_w = output_shape[3];
+  int tiles_h = (output_h + kWinogradTile - 1) / kWinogradTile;
+  int tiles_w = (output_w + kWinogradTile - 1) / kWinogradTile;
+  int tiles = tiles_h * tiles_w;
+  int block = getWinogradTileBlock(tiles, input_c, output_c);
+  const int alpha2 = kWinogradAlpha * kWinogradAlpha;
+
+  float *v = static_cast<float *>(workspace_);
+  float *m = v + alignWorkspace((uint64_t)alpha2 * input_c * block *
+                                sizeof(float)) /
+                     sizeof(float);
+  void *sgemm_workspace =
+      reinterpret_cast<char *>(m) +
+      alignWorkspace((uint64_t)alpha2 * output_c * block * sizeof(float));
+
+  SgemmEpilogue epilogue;
+  epilogue.bias_ = bias_data;
+  epilogue.activate_op_ = param->activate_op_;
+  SgemmEpilogueFunc epilogue_func = getSgemmEpilogueFunc(epilogue);
+  // winograd域的GEMM不做后处理
+  SgemmEpilogue gemm_epilogue;
+
+  uint64_t flops = getFlops();
+  for (int b = 0; b < batch; ++b) {
+    const float *input = input_data + (size_t)b * input_c * input_h * input_w;
+    float *output = output_data + (size_t)b * output_c * output_h * output_w;
+    for (int tile_begin = 0; tile_begin < tiles; tile_begin += block) {
+      int tile_count = std::min(block, tiles - tile_begin);
+      // 这一组tile分到的计算量
+      uint64_t cost = flops * tile_count / ((uint64_t)batch * tiles);
+      WinogradInputLoopBody input_body(input, input_c, input_h, input_w,
+                                       param->pads_[0], param->pads_[1],
+                                       tiles_w, tile_begin, tile_count, v);
+      thread_pool::parallelForWithCost(base::Range(0, input_c), input_body,
+                                       cost);
+      for (int xi = 0; xi < alpha2; ++xi) {
+        status = sgemm(output_c, tile_count, input_c,
+                       u_data + (size_t)xi * output_c * input_c, input_c,
+                       v + (size_t)xi * input_c * tile_count, tile_count,
+                       m + (size_t)xi * output_c * tile_count, tile_count,
+                       gemm_epilogue, sgemm_workspace);
+        NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "sgemm failed");
       }
+      WinogradOutputLoopBody output_body(m, output_c, output_h, output_w,
+                                         tiles_w, tile_begin, tile_count,
+                                         bias_data, epilogue_func, output);
+      thread_pool::parallelForWithCost(base::Range(0, output_c), output_body,
+                                       cost);
     }
   }
 
   return status;
 }
 
+base::Status OpConv::runDepthwise() {
+  device::Tensor *input_tensor = inputs_[0];
+  device::Tensor *weight_tensor = inputs_[1];
+  device::Tensor *bias_tensor = inputs_.size() > 2 ? inputs_[2] : nullptr;
+  device::Tensor *output_tensor = outputs_[0];
+  auto input_shape = input_tensor->getShape();
+  auto weight_shape = weight_tensor->getShape();
+  auto output_shape = output_tensor->getShape();
+  auto param = dynamic_cast<ir::ConvParam *>(op_desc_.op_param_.get());
+
+  const float *input_data = static_cast<float *>(input_tensor->getData());
+  const float *weight_data = static_cast<float *>(weight_tensor->getData());
+  float *output_data = static_cast<float *>(output_tensor->getData());
+  const float *bias_data =
+      bias_tensor ? static_cast<float *>(bias_tensor->getData()) : nullptr;
+
+  int batch = input_shape[0];
+  int channels = input_shape[1];
+  int input_h = input_shape[2];
+  int input_w = input_shape[3];
+  int output_h = output_shape[2];
+  int output_w = output_shape[3];
+  int kernel = weight_shape[2];
+  int stride = param->strides_[0];
+  int pad_h = param->pads_[0];
+  int pad_w = param->pads_[1];
+
+  DepthwiseConvPlaneFunc plane_func = getDepthwiseConvPlaneFunc(kernel, stride);
+  SgemmEpilogue epilogue;
+  epilogue.bias_ = bias_data;
+  epilogue.activate_op_ = param->activate_op_;
+  SgemmEpilogueFunc epilogue_func = getSgemmEpilogueFunc(epilogue);
+
+  DepthwiseConvLoopBody body(input_data, weight_data, bias_data, output_data,
+                             channels, input_h, input_w, kernel, pad_h, pad_w,
+                             output_h, output_w, plane_func, epilogue_func);
+  thread_pool::parallelForWithCost(base::Range(0, batch * channels), body,
+                                    getFlops());
+
+  return base::kStatusCodeOk;
+}
+
+base::Status OpConv::runPointwise() {
+  base::Status status = base::kStatusCodeOk;
+  device::Tensor *input_tensor = inputs_[0];
+  device::Tensor *weight_tensor = inputs_[1];
+  device::Tensor *bias_tensor = inputs_.size() > 2 ? inputs_[2] : nullptr;
+  device::Tensor *output_tensor = outputs_[0];
+  auto input_shape = input_tensor->getShape();
+  auto output_shape = output_tensor->getShape();
+  auto param = dynamic_cast<ir::ConvParam *>(op_desc_.op_param_.get());
+
+  const float *input_data = static_cast<float *>(input_tensor->getData());
+  const float *weight_data = static_cast<float *>(weight_tensor->getData());
+  float *output_data = static_cast<float *>(output_tensor->getData());
+  const float *bias_data =
+      bias_tensor ? static_cast<float *>(bias_tensor->getData()) : nullptr;
+
+  int batch = input_shape[0];
+  int input_c = input_shape[1];
+  int output_c = output_shape[1];
+  int group = param->group_;
+  // C[m, n] = A[m, k] * B[k, n]
+  // A: 权重, B: 输入, C: 输出
+  int m = output_c / group;
+  int k = input_c / group;
+  int n = output_shape[2] * output_shape[3];
+
+  SgemmEpilogue epilogue;
+  epilogue.activate_op_ = param->activate_op_;
+  for (int b = 0; b < batch; ++b) {
+    for (int g = 0; g < group; ++g) {
+      const float *a = weight_data + (size_t)g * m * k;
+      const float *im = input_data + ((size_t)b * input_c + g * k) * n;
+      float *c = output_data + ((size_t)b * output_c + g * m) * n;
+      epilogue.bias_ = bias_data != nullptr ? bias_data + g * m : nullptr;
+      status = sgemm(m, n, k, a, k, im, n, c, n, epilogue, workspace_);
+      NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "sgemm failed");
+    }
+  }
+
+  return status;
+}
+
+base::Status OpConv::runBlocked() {
+  device::Tensor *input_tensor = inputs_[0];
+  device::Tensor *bias_tensor = inputs_.size() > 2 ? inputs_[2] : nullptr;
+  device::Tensor *output_tensor = outputs_[0];
+  auto input_shape = input_tensor->getShape();
+  auto weight_shape = inputs_[1]->getShape();
+  auto output_shape = output_tensor->getShape();
+  auto param = dynamic_cast<ir::ConvParam *>(op_desc_.op_param_.get());
+  int block = base::getChannelBlock(input_tensor->getDataFormat());
+  if (base::getChannelBlock(output_tensor->getDataFormat()) != block ||
+      blocked_weight_ == nullptr || blocked_weight_block_ != block) {
+    NNDEPLOY_LOGE("OpConv blocked input and output format mismatch.\n");
+    return base::kStatusCodeErrorInvalidParam;
+  }
+  bool depthwise = isBlockedDepthwise(param);
+  ConvBlockedRowFunc func = getConvBlockedRowFunc(block, depthwise);
+  if (func == nullptr) {
+    NNDEPLOY_LOGE("OpConv not support channel block[%d].\n", block);
+    return base::kStatusCodeErrorNotSupport;
+  }
+
+  int output_c = output_shape[1];
+  int output_blocks = (output_c + block - 1) / block;
+  // bias按块补齐，补齐的通道为0
+  std::vector<float> bias(output_blocks * block, 0.0f);
+  if (bias_tensor != nullptr) {
+    const float *bias_data = static_cast<float *>(bias_tensor->getData());
+    std::copy(bias_data, bias_data + output_c, bias.begin());
+  }
+  SgemmEpilogue epilogue;
+  epilogue.activate_op_ = param->activate_op_;
+
+  ConvBlockedArgs args;
+  args.input_ = static_cast<float *>(input_tensor->getData());
+  args.weight_ = static_cast<float *>(blocked_weight_->getData());
+  args.bias_ = bias.data();
+  args.output_ = static_cast<float *>(output_tensor->getData());
+  args.input_c_ = depthwise ? input_shape[1] : weight_shape[1];
+  args.input_h_ = input_shape[2];
+  args.input_w_ = input_shape[3];
+  args.output_c_ = output_c;
+  args.output_h_ = output_shape[2];
+  args.output_w_ = output_shape[3];
+  args.kernel_h_ = weight_shape[2];
+  args.kernel_w_ = weight_shape[3];
+  args.stride_h_ = param->strides_[0];
+  args.stride_w_ = param->strides_[1];
+  args.dilation_h_ = param->dilations_[0];
+  args.dilation_w_ = param->dilations_[1];
+  args.pad_h_ = param->pads_[0];
+  args.pad_w_ = param->pads_[1];
+  args.epilogue_ = getSgemmEpilogueFunc(epilogue);
+
+  ConvBlockedLoopBody body(args, func);
+  int tasks = output_shape[0] * output_blocks * output_shape[2];
+  thread_pool::parallelForWithCost(base::Range(0, tasks), body, getFlops());
+  // 融合的激活(如Sigmoid)作用于整块，补齐的通道重新写0
+  if (args.epilogue_ != nullptr) {
+    zeroChannelPadding(output_tensor, getFlops());
+  }
+  return base::kStatusCodeOk;
+}
+
 base::Status conv(device::Tensor *input, device::Tensor *weight,
                   device::Tensor *bias, std::shared_ptr<ir::ConvParam> param,
                   device::Tensor *output) {
@@ -262,5 +1769,7 @@ base::Status conv(device::Tensor *input, device::Tensor *weight,
 
 REGISTER_OP_IMPLEMENTION(kDeviceTypeCodeCpu, ir::kOpTypeConv, OpConv)
 
+REGISTER_OP_IMPLEMENTION(kDeviceTypeCodeX86, ir::kOpTypeConv, OpConv)
+
 }  // namespace op
 }  // namespace nndeploy
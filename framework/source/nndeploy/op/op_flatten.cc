@@ -53,43 +53,26 @@ base::Status OpFlatten::inferShape() {
   return status;
 }
 
-base::Status OpFlatten::run() {
-  // 获取输入和输出张量
-  device::Tensor* input_tensor = inputs_[0];
-  device::Tensor* output_tensor = outputs_[0];
-
-  // 获取输入张量的形状
-  base::IntVector input_shape = input_tensor->getShape();
-
-  // 获取参数
-  auto param = dynamic_cast<ir::FlattenParam*>(op_desc_.op_param_.get());
-  if (!param) {
-    NNDEPLOY_LOGE("Failed to cast op param to FlattenParam\n");
-    return base::kStatusCodeErrorInvalidParam;
+bool OpFlatten::getOutputView(int index, int& input_index, size_t& offset) {
+  if (index != 0 || !inputs_[0]->isContinue()) {
+    return false;
   }
+  input_index = 0;
+  offset = 0;
+  return true;
+}
 
-  // 计算展平的轴
-  int axis = param->axis_;
-  int rank = input_shape.size();
-  if (axis < 0) {
-    axis += rank;
-  }
-  if (axis < 0 || axis >= rank) {
-    NNDEPLOY_LOGE("Axis is out of range\n");
-    return base::kStatusCodeErrorInvalidParam;
+base::Status OpFlatten::run() {
+  void* input_data = inputs_[0]->getData();
+  void* output_data = outputs_[0]->getData();
+  // 输出为输入的视图时无需拷贝
+  if (input_data == output_data) {
+    return base::kStatusCodeOk;
   }
-
-  // 获取输入和输出张量的数据指针
-  float* input_data = reinterpret_cast<float*>(input_tensor->getData());
-  float* output_data = reinterpret_cast<float*>(output_tensor->getData());
-
-  size_t elem_cnt = std::accumulate(input_shape.begin(), input_shape.end(), 1,
-                                    std::multiplies<size_t>());
-
-  // 直接拷贝数据
-  std::memcpy(output_data, input_data,
-              elem_cnt * (input_tensor->getDataType().bits_ / 8));
-
+  base::IntVector input_shape = inputs_[0]->getShape();
+  size_t size = inputs_[0]->getDataType().size() *
+                (size_t)multiplyDims(input_shape, 0, (int)input_shape.size());
+  std::memcpy(output_data, input_data, size);
   return base::kStatusCodeOk;
 }
 
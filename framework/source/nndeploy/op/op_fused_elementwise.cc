@@ -0,0 +1,447 @@
+#include "nndeploy/op/op_fused_elementwise.h"
+
+#include "nndeploy/base/any.h"
+#include "nndeploy/base/common.h"
+#include "nndeploy/base/glic_stl_include.h"
+#include "nndeploy/base/log.h"
+#include "nndeploy/base/macro.h"
+#include "nndeploy/base/object.h"
+#include "nndeploy/base/param.h"
+#include "nndeploy/base/shape.h"
+#include "nndeploy/base/status.h"
+#include "nndeploy/base/string.h"
+#include "nndeploy/base/time_profiler.h"
+#include "nndeploy/device/buffer.h"
+#include "nndeploy/device/device.h"
+#include "nndeploy/device/memory_pool.h"
+#include "nndeploy/device/tensor.h"
+#include "nndeploy/ir/ir.h"
+#include "nndeploy/op/op.h"
+#include "nndeploy/op/op_unary.h"
+#include "nndeploy/op/util.h"
+#include "nndeploy/thread_pool/parallel.h"
+
+namespace nndeploy {
+namespace op {
+
+// 每次计算的元素数，所有寄存器同时放在L1中
+static const size_t kFusedElementwiseChunk = 256;
+// 每个寄存器在workspace中的字节数
+static const size_t kFusedElementwiseRegisterSize =
+    kFusedElementwiseChunk * sizeof(float);
+// 寄存器数的上限：每条指令最多引入一个新的输入
+static const int kFusedElementwiseMaxRegisters =
+    2 * kFusedElementwiseMaxOps + 1;
+// 单个任务的最少元素数
+static const size_t kFusedElementwiseGrainSize =
+    thread_pool::kParallelGrainCost;
+
+static bool isBinaryInstruction(ir::OpType op_type) {
+  return getBinaryFunc(op_type) != nullptr;
+}
+
+static bool isPlainFormat(base::DataFormat data_format) {
+  return base::getChannelBlock(data_format) <= 1;
+}
+
+base::Status OpFusedElementwise::inferShape() {
+  base::Status status = base::kStatusCodeOk;
+  base::IntVector output_shape = inputs_[0]->getShape();
+  for (int i = 1; i < static_cast<int>(inputs_.size()); ++i) {
+    base::IntVector shape;
+    status = getBroadcastShape(output_shape, inputs_[i]->getShape(), shape);
+    NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk,
+                           "getBroadcastShape failed");
+    output_shape = shape;
+  }
+  outputs_[0]->reshape(output_shape);
+  return status;
+}
+
+base::Status OpFusedElementwise::inferDataFormat() {
+  // 与二元op相同：优先通道分块格式，否则取维度最多的输入
+  device::Tensor *reference = inputs_[0];
+  for (auto input : inputs_) {
+    if (!isPlainFormat(input->getDataFormat())) {
+      reference = input;
+      break;
+    }
+    if (input->getShape().size() > reference->getShape().size()) {
+      reference = input;
+    }
+  }
+  outputs_[0]->setDataFormat(reference->getDataFormat());
+  return base::kStatusCodeOk;
+}
+
+base::Status OpFusedElementwise::preRun() {
+  auto param =
+      dynamic_cast<ir::FusedElementwiseParam *>(op_desc_.op_param_.get());
+  NNDEPLOY_CHECK_PARAM_NULL_RET_STATUS(param, "op_desc_.op_param_ is nullptr");
+  int num_ops = static_cast<int>(param->op_types_.size());
+  int num_inputs = static_cast<int>(inputs_.size());
+  if (num_ops == 0 || num_ops > kFusedElementwiseMaxOps ||
+      param->operands_.size() != 2 * param->op_types_.size()) {
+    NNDEPLOY_LOGE("invalid FusedElementwiseParam.\n");
+    return base::kStatusCodeErrorInvalidParam;
+  }
+  binary_funcs_.assign(num_ops, nullptr);
+  unary_funcs_.assign(num_ops, nullptr);
+  for (int i = 0; i < num_ops; ++i) {
+    ir::OpType op_type = param->op_types_[i];
+    int operand_0 = param->operands_[2 * i];
+    int operand_1 = param->operands_[2 * i + 1];
+    // 操作数只能引用输入或之前指令的结果
+    int registers = num_inputs + i;
+    bool is_binary = isBinaryInstruction(op_type);
+    if (is_binary) {
+      binary_funcs_[i] = getBinaryFunc(op_type);
+    } else {
+      unary_funcs_[i] = getUnaryFunc(op_type);
+    }
+    if ((!is_binary && unary_funcs_[i] == nullptr) || operand_0 < 0 ||
+        operand_0 >= registers ||
+        (is_binary && (operand_1 < 0 || operand_1 >= registers))) {
+      NNDEPLOY_LOGE("unsupported instruction %d: %s.\n", i,
+                    ir::opTypeToString(op_type).c_str());
+      return base::kStatusCodeErrorInvalidParam;
+    }
+  }
+  // 每个线程一组寄存器，按线程池的线程数预留，线程预算变化后仍然足够
+  uint64_t slot_size = (num_inputs + num_ops) * kFusedElementwiseRegisterSize;
+  return updateWorkspaceSize(slot_size *
+                             std::max(thread_pool::getThreadNum(), 1));
+}
+
+/**
+ * @brief 各输入按输出形状计算stride，并合并所有输入都可以连续访问的相邻维度
+ * # 最内层维度的stride只为0(广播)或1(连续)
+ */
+struct FusedBroadcastInfo {
+  std::vector<size_t> shape_;
+  std::vector<std::vector<size_t>> strides_;
+};
+
+static base::Status getFusedBroadcastInfo(
+    const std::vector<device::Tensor *> &inputs, device::Tensor *output,
+    FusedBroadcastInfo &info) {
+  base::IntVector output_shape = output->getShape();
+  base::DataFormat output_format = output->getDataFormat();
+  info.shape_.clear();
+  info.strides_.assign(inputs.size(), std::vector<size_t>());
+  int num_inputs = static_cast<int>(inputs.size());
+  if (!isPlainFormat(output_format)) {
+    // 通道分块格式按存储的元素数计算，输入为相同形状的张量或标量
+    size_t size = base::shapeCountByDataFormat(output_shape, output_format);
+    info.shape_.push_back(size);
+    for (int i = 0; i < num_inputs; ++i) {
+      bool is_scalar = base::shapeCount(inputs[i]->getShape()) == 1 &&
+                       isPlainFormat(inputs[i]->getDataFormat());
+      if (!is_scalar && (inputs[i]->getShape() != output_shape ||
+                         inputs[i]->getDataFormat() != output_format)) {
+        NNDEPLOY_LOGE("blocked input %d must match output or be scalar.\n",
+                      i);
+        return base::kStatusCodeErrorNotSupport;
+      }
+      info.strides_[i].push_back(is_scalar ? 0 : 1);
+    }
+    return base::kStatusCodeOk;
+  }
+
+  int rank = static_cast<int>(output_shape.size());
+  std::vector<std::vector<size_t>> strides(inputs.size());
+  for (int i = 0; i < num_inputs; ++i) {
+    base::IntVector shape = inputs[i]->getShape();
+    if (!isPlainFormat(inputs[i]->getDataFormat()) ||
+        static_cast<int>(shape.size()) > rank) {
+      NNDEPLOY_LOGE("input %d can not broadcast to output.\n", i);
+      return base::kStatusCodeErrorNotSupport;
+    }
+    int offset = rank - static_cast<int>(shape.size());
+    strides[i].assign(rank, 0);
+    size_t stride = 1;
+    for (int d = rank - 1; d >= offset; --d) {
+      int dim = shape[d - offset];
+      strides[i][d] = dim == 1 ? 0 : stride;
+      stride *= dim;
+    }
+  }
+  // 去掉长度为1的维度，合并所有输入都可以连续访问的相邻维度
+  for (int d = 0; d < rank; ++d) {
+    size_t dim = output_shape[d];
+    if (dim == 1) {
+      continue;
+    }
+    bool is_merged = !info.shape_.empty();
+    for (int i = 0; i < num_inputs && is_merged; ++i) {
+      is_merged = info.strides_[i].back() == strides[i][d] * dim;
+    }
+    if (is_merged) {
+      info.shape_.back() *= dim;
+      for (int i = 0; i < num_inputs; ++i) {
+        info.strides_[i].back() = strides[i][d];
+      }
+      continue;
+    }
+    info.shape_.push_back(dim);
+    for (int i = 0; i < num_inputs; ++i) {
+      info.strides_[i].push_back(strides[i][d]);
+    }
+  }
+  if (info.shape_.empty()) {
+    info.shape_.push_back(1);
+    for (int i = 0; i < num_inputs; ++i) {
+      info.strides_[i].push_back(0);
+    }
+  }
+  return base::kStatusCodeOk;
+}
+
+/**
+ * @brief 每个任务计算[外层行][最内层分块]中的一块
+ * # 块内再按kFusedElementwiseChunk个元素依次执行所有指令
+ * # float且连续的输入直接作为寄存器，广播的输入只占一个元素
+ * # range为workspace中寄存器组的编号，第slot组依次计算第slot、
+ *   slot + slots、...个任务，同一组寄存器不会被两个线程同时使用
+ */
+class FusedElementwiseLoopBody : public thread_pool::ParallelLoopBody {
+ public:
+  FusedElementwiseLoopBody(const FusedBroadcastInfo &info,
+                           const std::vector<device::Tensor *> &inputs,
+                           device::Tensor *output,
+                           const ir::FusedElementwiseParam &param,
+                           const std::vector<BinaryFunc> &binary_funcs,
+                           const std::vector<VecFunc> &unary_funcs,
+                           size_t inner_chunk, size_t tasks, int slots,
+                           float *workspace)
+      : info_(info),
+        output_(output),
+        param_(param),
+        binary_funcs_(binary_funcs),
+        unary_funcs_(unary_funcs),
+        inner_chunk_(inner_chunk),
+        tasks_(tasks),
+        slots_(slots),
+        workspace_(workspace) {
+    for (auto input : inputs) {
+      inputs_.push_back(static_cast<const char *>(input->getData()));
+      data_types_.push_back(input->getDataType());
+    }
+  }
+
+  virtual void operator()(const base::Range &range) const {
+    int rank = static_cast<int>(info_.shape_.size());
+    int num_inputs = static_cast<int>(inputs_.size());
+    int num_ops = static_cast<int>(param_.op_types_.size());
+    size_t inner = info_.shape_[rank - 1];
+    size_t chunks = (inner + inner_chunk_ - 1) / inner_chunk_;
+    const base::DataType float_type = base::dataTypeOf<float>();
+    base::DataType output_type = output_->getDataType();
+    char *output = static_cast<char *>(output_->getData());
+
+    const float *registers[kFusedElementwiseMaxRegisters];
+    int steps[kFusedElementwiseMaxRegisters];
+    size_t offsets[kFusedElementwiseMaxRegisters];
+    for (int slot = range.start_; slot < range.end_; ++slot) {
+      // 第r个寄存器为buffer + r * kFusedElementwiseChunk
+      float *buffer = workspace_ + static_cast<size_t>(slot) *
+                                       (num_inputs + num_ops) *
+                                       kFusedElementwiseChunk;
+      for (size_t task = slot; task < tasks_; task += slots_) {
+        size_t row = task / chunks;
+        size_t begin = (task % chunks) * inner_chunk_;
+        size_t size = std::min(inner_chunk_, inner - begin);
+        // 外层行号转换为各输入的偏移
+        for (int j = 0; j < num_inputs; ++j) {
+          steps[j] = static_cast<int>(info_.strides_[j][rank - 1]);
+          offsets[j] = begin * steps[j];
+        }
+        size_t remain = row;
+        for (int d = rank - 2; d >= 0; --d) {
+          size_t coord = remain % info_.shape_[d];
+          remain /= info_.shape_[d];
+          for (int j = 0; j < num_inputs; ++j) {
+            offsets[j] += coord * info_.strides_[j][d];
+          }
+        }
+        size_t offset = row * inner + begin;
+
+        for (size_t i = 0; i < size; i += kFusedElementwiseChunk) {
+          size_t n = std::min(kFusedElementwiseChunk, size - i);
+          for (int j = 0; j < num_inputs; ++j) {
+            const char *x = inputs_[j] + (offsets[j] + i * steps[j]) *
+                                             data_types_[j].size();
+            if (data_types_[j] == float_type) {
+              registers[j] = reinterpret_cast<const float *>(x);
+            } else {
+              float *y = buffer + j * kFusedElementwiseChunk;
+              convertToFloat(x, data_types_[j], y, steps[j] ? n : 1);
+              registers[j] = y;
+            }
+          }
+          for (int k = 0; k < num_ops; ++k) {
+            int r = num_inputs + k;
+            int a = param_.operands_[2 * k];
+            int b = param_.operands_[2 * k + 1];
+            float *y = buffer + r * kFusedElementwiseChunk;
+            if (binary_funcs_[k] != nullptr) {
+              steps[r] = steps[a] | steps[b];
+              binary_funcs_[k](registers[a], steps[a], registers[b],
+                               steps[b], y, steps[r] ? n : 1);
+            } else {
+              steps[r] = steps[a];
+              unary_funcs_[k](registers[a], y, steps[r] ? n : 1);
+            }
+            registers[r] = y;
+          }
+          // 最后一条指令的结果写回输出
+          int r = num_inputs + num_ops - 1;
+          float *result = buffer + r * kFusedElementwiseChunk;
+          if (steps[r] == 0) {
+            std::fill(result + 1, result + n, result[0]);
+          }
+          convertFromFloat(result, output_type,
+                           output + (offset + i) * output_type.size(), n);
+        }
+      }
+    }
+  }
+
+ private:
+  const FusedBroadcastInfo &info_;
+  std::vector<const char *> inputs_;
+  std::vector<base::DataType> data_types_;
+  device::Tensor *output_;
+  const ir::FusedElementwiseParam &param_;
+  const std::vector<BinaryFunc> &binary_funcs_;
+  const std::vector<VecFunc> &unary_funcs_;
+  size_t inner_chunk_;
+  size_t tasks_;
+  int slots_;
+  float *workspace_;
+};
+
+static bool isFusedDataTypeSupported(const base::DataType &data_type) {
+  return data_type == base::dataTypeOf<float>() || isHalfDataType(data_type);
+}
+
+uint64_t OpFusedElementwise::getFlops() {
+  auto param =
+      dynamic_cast<ir::FusedElementwiseParam *>(op_desc_.op_param_.get());
+  uint64_t flops = base::shapeCount(outputs_[0]->getShape(), 0, -1);
+  return param != nullptr ? flops * param->op_types_.size() : flops;
+}
+
+base::Status OpFusedElementwise::run() {
+  auto param =
+      dynamic_cast<ir::FusedElementwiseParam *>(op_desc_.op_param_.get());
+  NNDEPLOY_CHECK_PARAM_NULL_RET_STATUS(param, "op_desc_.op_param_ is nullptr");
+  device::Tensor *output = outputs_[0];
+  if (inputs_.size() + param->op_types_.size() >
+      static_cast<size_t>(kFusedElementwiseMaxRegisters)) {
+    NNDEPLOY_LOGE("too many inputs for FusedElementwise.\n");
+    return base::kStatusCodeErrorNotSupport;
+  }
+  for (auto input : inputs_) {
+    if (!isFusedDataTypeSupported(input->getDataType())) {
+      NNDEPLOY_LOGE("FusedElementwise only support fp32/fp16/bf16.\n");
+      return base::kStatusCodeErrorNotSupport;
+    }
+  }
+  if (!isFusedDataTypeSupported(output->getDataType())) {
+    NNDEPLOY_LOGE("FusedElementwise only support fp32/fp16/bf16.\n");
+    return base::kStatusCodeErrorNotSupport;
+  }
+
+  FusedBroadcastInfo info;
+  base::Status status = getFusedBroadcastInfo(inputs_, output, info);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk,
+                         "getFusedBroadcastInfo failed");
+  size_t total = 1;
+  for (auto dim : info.shape_) {
+    total *= dim;
+  }
+  if (total == 0) {
+    return base::kStatusCodeOk;
+  }
+
+  size_t inner = info.shape_.back();
+  size_t rows = total / inner;
+  size_t inner_chunk = inner;
+  int threads = thread_pool::getThreadBudget();
+  uint64_t cost = getFlops();
+  if (cost >= thread_pool::kParallelMinCost && threads > 1 &&
+      rows < static_cast<size_t>(threads)) {
+    // 外层行数不足以分给所有线程时，再切分最内层维度
+    size_t chunks = (threads + rows - 1) / rows;
+    inner_chunk =
+        std::max((inner + chunks - 1) / chunks, kFusedElementwiseGrainSize);
+  }
+  size_t tasks = rows * ((inner + inner_chunk - 1) / inner_chunk);
+
+  // 寄存器放在workspace中，每组供一个线程使用
+  status = allocateWorkspace();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk,
+                         "allocateWorkspace failed");
+  size_t slot_size = (inputs_.size() + param->op_types_.size()) *
+                     kFusedElementwiseRegisterSize;
+  size_t slots = std::min(workspace_size_ / slot_size, tasks);
+  slots = std::min(slots, static_cast<size_t>(std::max(threads, 1)));
+  if (workspace_ == nullptr || slots == 0) {
+    NNDEPLOY_LOGE("FusedElementwise workspace is not enough.\n");
+    return base::kStatusCodeErrorOutOfMemory;
+  }
+
+  FusedElementwiseLoopBody body(info, inputs_, output, *param, binary_funcs_,
+                                unary_funcs_, inner_chunk, tasks,
+                                static_cast<int>(slots),
+                                static_cast<float *>(workspace_));
+  thread_pool::parallelForWithCost(base::Range(0, static_cast<int>(slots)),
+                                   body, cost);
+  // 通道分块格式时，Sigmoid、Exp、加标量等使补齐的通道不为0，重新写0
+  zeroChannelPadding(output, cost);
+  return base::kStatusCodeOk;
+}
+
+base::Status fusedElementwise(std::vector<device::Tensor *> inputs,
+                              std::shared_ptr<ir::FusedElementwiseParam> param,
+                              device::Tensor *output) {
+  base::Status status = base::kStatusCodeOk;
+
+  Op *op = createOp(inputs[0]->getDeviceType(), "",
+                    ir::kOpTypeFusedElementwise);
+  if (op == nullptr) {
+    NNDEPLOY_LOGE("createOp failed");
+    return base::kStatusCodeErrorNotImplement;
+  }
+  status = op->setParam(param);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setParam failed");
+  for (size_t i = 0; i < inputs.size(); i++) {
+    status = op->setInput(inputs[i], i);
+    NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setInput failed");
+  }
+  status = op->setOutput(output, 0);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setOutput failed");
+  status = op->init();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "init failed");
+  status = op->preRun();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "preRun failed");
+  status = op->checkOrAllocOutput();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk,
+                         "checkOrAllocOutput failed");
+  status = op->run();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "run failed");
+  status = op->postRun();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "postRun failed");
+  status = op->deinit();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "deinit failed");
+  delete op;
+
+  return status;
+}
+
+REGISTER_OP_IMPLEMENTION(kDeviceTypeCodeCpu, ir::kOpTypeFusedElementwise,
+                         OpFusedElementwise)
+
+}  // namespace op
+}  // namespace nndeploy
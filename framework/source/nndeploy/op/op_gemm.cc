@@ -17,11 +17,22 @@
 #include "nndeploy/device/tensor.h"
 #include "nndeploy/ir/ir.h"
 #include "nndeploy/op/op.h"
+#include "nndeploy/op/qgemm.h"
+#include "nndeploy/op/sgemm.h"
 #include "nndeploy/op/util.h"
 
 namespace nndeploy {
 namespace op {
 
+// 量化的B之后依次为B的scale、B的zero point(由has_b_zero_point_指定)，最后为C
+static int getGemmBiasIndex(const ir::GemmParam* param,
+                            const std::vector<device::Tensor*>& inputs) {
+  if (inputs.size() < 2 || !isQGemmDataType(inputs[1]->getDataType())) {
+    return 2;
+  }
+  return param->has_b_zero_point_ ? 4 : 3;
+}
+
 base::Status OpGemm::inferShape() {
   base::Status status = base::kStatusCodeOk;
   if (inputs_.size() < 2) {
@@ -35,6 +46,15 @@ base::Status OpGemm::inferShape() {
   bool trans_b = param->trans_b_ != 0;
   auto first_input_shape = inputs_[0]->getShape();
   auto second_input_shape = inputs_[1]->getShape();
+  base::DataType data_type_b = inputs_[1]->getDataType();
+  if (isQGemmDataType(data_type_b)) {
+    // 量化的B按[N, K]存放
+    if (!trans_b || second_input_shape.size() != 2) {
+      NNDEPLOY_LOGE("Quantized B must be [N, K] with trans_b = 1.\n");
+      return base::kStatusCodeErrorInvalidParam;
+    }
+    second_input_shape[1] *= data_type_b.lanes_;
+  }
   if (first_input_shape.size() != 2) {
     NNDEPLOY_LOGE("First input does not have rank 2");
     return base::kStatusCodeErrorInvalidParam;
@@ -57,8 +77,9 @@ base::Status OpGemm::inferShape() {
   // 1. 完全与output shape大小相等
   // 2. 为[1, channel]
   // 3. 为 [channel]
-  if (inputs_.size() > 2) {
-    auto bias_shape = inputs_[2]->getShape();
+  int bias_index = getGemmBiasIndex(param, inputs_);
+  if (static_cast<int>(inputs_.size()) > bias_index) {
+    auto bias_shape = inputs_[bias_index]->getShape();
     auto output_shape = outputs_[0]->getShape();
 
     // 检查bias是否与输出形状兼容
@@ -83,19 +104,125 @@ base::Status OpGemm::inferShape() {
   return status;
 }
 
+base::Status OpGemm::init() {
+  base::Status status = Op::init();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "Op::init failed");
+
+  auto param = dynamic_cast<ir::GemmParam*>(op_desc_.op_param_.get());
+  NNDEPLOY_CHECK_PARAM_NULL_RET_STATUS(param, "op_desc_.op_param_ is nullptr");
+  device::Tensor* input_b = inputs_.size() > 1 ? inputs_[1] : nullptr;
+  if (!isInputWeight(1) || input_b == nullptr ||
+      input_b->getData() == nullptr || input_b->getShape().size() != 2) {
+    return status;
+  }
+  if (isQuantB()) {
+    return packQuantB();
+  }
+
+  // 预打包B，半精度的B打包后仍为半精度
+  base::IntVector shape_b = input_b->getShape();
+  int N = param->trans_b_ ? shape_b[0] : shape_b[1];
+  int K = param->trans_b_ ? shape_b[1] : shape_b[0];
+  SgemmParam sgemm_param;
+  sgemm_param.trans_b_ = param->trans_b_ != 0;
+  sgemm_param.b_type_ = input_b->getDataType();
+  device::TensorDesc desc(
+      sgemm_param.b_type_, base::kDataFormatN,
+      {static_cast<int>(sgemmPackedBSize(sgemm_param, N, K) /
+                        sgemm_param.b_type_.size())});
+  device::Device* device = device::getDevice(device_type_);
+  if (packed_b_ != nullptr) {
+    delete packed_b_;
+  }
+  packed_b_ = new device::Tensor(device, desc, op_desc_.name_ + ".packed_b");
+  sgemmPackB(sgemm_param, N, K, input_b->getData(), shape_b[1],
+             packed_b_->getData());
+  return status;
+}
+
+bool OpGemm::isQuantB() {
+  return inputs_.size() > 1 && isQGemmDataType(inputs_[1]->getDataType());
+}
+
+base::Status OpGemm::packQuantB() {
+  auto param = dynamic_cast<ir::GemmParam*>(op_desc_.op_param_.get());
+  NNDEPLOY_CHECK_PARAM_NULL_RET_STATUS(param, "op_desc_.op_param_ is nullptr");
+  device::Tensor* zero_point = nullptr;
+  if (param->has_b_zero_point_) {
+    if (inputs_.size() < 4) {
+      NNDEPLOY_LOGE("has_b_zero_point_ is set but B zero point is missing.\n");
+      return base::kStatusCodeErrorInvalidParam;
+    }
+    zero_point = inputs_[3];
+  }
+  QGemmWeight qweight;
+  base::Status status = getQGemmWeight(
+      inputs_[1], inputs_.size() > 2 ? inputs_[2] : nullptr, zero_point,
+      qweight);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "getQGemmWeight failed");
+  int size = static_cast<int>(qgemmPackedBSize(qweight));
+  if (packed_b_ == nullptr || packed_b_->getShape()[0] != size) {
+    if (packed_b_ != nullptr) {
+      delete packed_b_;
+    }
+    device::TensorDesc desc(base::dataTypeOf<uint8_t>(), base::kDataFormatN,
+                            {size});
+    device::Device* device = device::getDevice(device_type_);
+    packed_b_ = new device::Tensor(device, desc, op_desc_.name_ + ".packed_b");
+  }
+  return qgemmPackB(qweight, packed_b_->getData());
+}
+
+base::Status OpGemm::deinit() {
+  if (packed_b_ != nullptr) {
+    delete packed_b_;
+    packed_b_ = nullptr;
+  }
+  return Op::deinit();
+}
+
+// A、B、输出的存储类型，支持fp32/fp16/bf16
+static SgemmParam getGemmSgemmParam(const ir::GemmParam* param,
+                                    const std::vector<device::Tensor*>& inputs,
+                                    device::Tensor* output) {
+  SgemmParam sgemm_param;
+  sgemm_param.trans_a_ = param->trans_a_ != 0;
+  sgemm_param.trans_b_ = param->trans_b_ != 0;
+  sgemm_param.alpha_ = param->alpha_;
+  sgemm_param.a_type_ = inputs[0]->getDataType();
+  sgemm_param.b_type_ = inputs[1]->getDataType();
+  sgemm_param.c_type_ = output->getDataType();
+  return sgemm_param;
+}
+
+base::Status OpGemm::preRun() {
+  auto param = dynamic_cast<ir::GemmParam*>(op_desc_.op_param_.get());
+  NNDEPLOY_CHECK_PARAM_NULL_RET_STATUS(param, "op_desc_.op_param_ is nullptr");
+  base::IntVector shape_a = inputs_[0]->getShape();
+  base::IntVector shape_b = inputs_[1]->getShape();
+  if (shape_a.size() != 2 || shape_b.size() != 2) {
+    return base::kStatusCodeOk;
+  }
+  int M = param->trans_a_ ? shape_a[1] : shape_a[0];
+  int N = param->trans_b_ ? shape_b[0] : shape_b[1];
+  int K = param->trans_a_ ? shape_a[0] : shape_a[1];
+  if (isQuantB()) {
+    int group_num = inputs_.size() > 2 && inputs_[2]->getShape().size() == 2
+                        ? inputs_[2]->getShape()[1]
+                        : 1;
+    return updateWorkspaceSize(qgemmWorkspaceSize(M, N, K, K / group_num));
+  }
+  return updateWorkspaceSize(sgemmWorkspaceSize(
+      getGemmSgemmParam(param, inputs_, outputs_[0]), M, N, K));
+}
+
 base::Status OpGemm::run() {
+  base::Status status = base::kStatusCodeOk;
   // 获取输入和输出张量
   device::Tensor* input_a = inputs_[0];
   device::Tensor* input_b = inputs_[1];
-  device::Tensor* input_c =
-      inputs_.size() > 2 ? inputs_[2] : nullptr;  // 可选的偏置矩阵
   device::Tensor* output = outputs_[0];
 
-  // 获取输入张量的形状
-  base::IntVector shape_a = input_a->getShape();
-  base::IntVector shape_b = input_b->getShape();
-  base::IntVector shape_c = input_c ? input_c->getShape() : base::IntVector();
-
   // 获取参数
   auto param = dynamic_cast<ir::GemmParam*>(op_desc_.op_param_.get());
   if (!param) {
@@ -103,10 +230,35 @@ base::Status OpGemm::run() {
     return base::kStatusCodeErrorInvalidParam;
   }
 
+  // 可选的偏置矩阵
+  int bias_index = getGemmBiasIndex(param, inputs_);
+  device::Tensor* input_c =
+      static_cast<int>(inputs_.size()) > bias_index ? inputs_[bias_index] : nullptr;
+
+  // 获取输入张量的形状
+  base::IntVector shape_a = input_a->getShape();
+  base::IntVector shape_b = input_b->getShape();
+  base::IntVector shape_c = input_c ? input_c->getShape() : base::IntVector();
+
   // 确定矩阵乘法的维度
-  size_t M = param->trans_a_ ? shape_a[1] : shape_a[0];
-  size_t N = param->trans_b_ ? shape_b[0] : shape_b[1];
-  size_t K = param->trans_a_ ? shape_a[0] : shape_a[1];
+  int M = param->trans_a_ ? shape_a[1] : shape_a[0];
+  int N = param->trans_b_ ? shape_b[0] : shape_b[1];
+  int K = param->trans_a_ ? shape_a[0] : shape_a[1];
+  bool is_quant_b = isQuantB();
+  SgemmParam sgemm_param = getGemmSgemmParam(param, inputs_, output);
+  if (is_quant_b) {
+    // 量化的B按[N, K]存放
+    shape_b[1] *= input_b->getDataType().lanes_;
+    if (param->trans_a_ || !param->trans_b_) {
+      NNDEPLOY_LOGE("Quantized gemm requires trans_a = 0 and trans_b = 1.\n");
+      return base::kStatusCodeErrorInvalidParam;
+    }
+    if (sgemm_param.a_type_ != base::dataTypeOf<float>() ||
+        sgemm_param.c_type_ != base::dataTypeOf<float>()) {
+      NNDEPLOY_LOGE("Quantized gemm only support float A and output.\n");
+      return base::kStatusCodeErrorNotSupport;
+    }
+  }
 
   // 确保输入张量的形状与参数一致
   if ((param->trans_b_ ? shape_b[1] : shape_b[0]) != K) {
@@ -115,43 +267,74 @@ base::Status OpGemm::run() {
     return base::kStatusCodeErrorInvalidParam;
   }
 
-  // 获取输入和输出张量的数据指针
-  float* data_a = reinterpret_cast<float*>(input_a->getData());
-  float* data_b = reinterpret_cast<float*>(input_b->getData());
-  float* data_c =
-      input_c ? reinterpret_cast<float*>(input_c->getData()) : nullptr;
-  float* data_output = reinterpret_cast<float*>(output->getData());
-
-  // 执行矩阵乘法
-  for (size_t m = 0; m < M; ++m) {
-    for (size_t n = 0; n < N; ++n) {
-      float sum = 0.0f;
-      for (size_t k = 0; k < K; ++k) {
-        size_t a_index = param->trans_a_ ? (k * M + m) : (m * K + k);
-        size_t b_index = param->trans_b_ ? (n * K + k) : (k * N + n);
-        sum += data_a[a_index] * data_b[b_index];
-      }
-      // 应用 bias，如果存在，并且支持广播
-      if (data_c) {
-        // 根据 bias 的形状进行索引计算
-        if (shape_c.size() == 1) {
-          // 规则3: bias形状为[channel]
-          sum += param->beta_ * data_c[n];
-        } else if (shape_c.size() == 2) {
-          // 规则2: bias形状为[1, channel]
-          if (shape_c[0] == 1) {
-            sum += param->beta_ * data_c[n];
-          } else {
-            // 规则3： bias形状与output一致
-            sum += param->beta_ * data_c[m * N + n];
-          }
-        }
+  if (is_quant_b) {
+    if (packed_b_ == nullptr || !isInputWeight(1)) {
+      status = packQuantB();
+      NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk,
+                             "packQuantB failed");
+    }
+    int group_num = inputs_[2]->getShape()[1];
+    status = updateWorkspaceSize(qgemmWorkspaceSize(M, N, K, K / group_num));
+  } else {
+    status = updateWorkspaceSize(sgemmWorkspaceSize(sgemm_param, M, N, K));
+  }
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk,
+                         "updateWorkspaceSize failed");
+  status = allocateWorkspace();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk,
+                         "allocateWorkspace failed");
+
+  // 获取输入和输出张量的数据指针，A、B、C、输出可以是fp32/fp16/bf16
+  const void* data_a = input_a->getData();
+  const void* data_b = input_b->getData();
+  const char* data_c =
+      input_c ? static_cast<const char*>(input_c->getData()) : nullptr;
+  char* data_output = static_cast<char*>(output->getData());
+
+  // Y = alpha * A' * B' + beta * C
+  // 先将C广播到输出，再以beta累加
+  sgemm_param.beta_ = 0.0f;
+  if (data_c != nullptr && param->beta_ != 0.0f) {
+    bool is_full = shape_c.size() == 2 && shape_c[0] == M && M != 1;
+    base::DataType c_type = input_c->getDataType();
+    size_t c_size = c_type.size();
+    size_t output_size = sgemm_param.c_type_.size();
+    std::vector<float> row;
+    for (int m = 0; m < M; ++m) {
+      // 规则1: bias形状与output一致
+      // 规则2/3: bias形状为[1, channel]或[channel]
+      const char* src = is_full ? data_c + (size_t)m * N * c_size : data_c;
+      char* dst = data_output + (size_t)m * N * output_size;
+      if (c_type == sgemm_param.c_type_) {
+        memcpy(dst, src, N * c_size);
+      } else {
+        row.resize(N);
+        convertToFloat(src, c_type, row.data(), N);
+        convertFromFloat(row.data(), sgemm_param.c_type_, dst, N);
       }
-      data_output[m * N + n] = param->alpha_ * sum;
     }
+    sgemm_param.beta_ = param->beta_;
   }
 
-  return base::kStatusCodeOk;
+  SgemmEpilogue epilogue;
+  int lda = param->trans_a_ ? M : K;
+  if (is_quant_b) {
+    status = qgemm(M, N, K, sgemm_param.alpha_, sgemm_param.beta_,
+                   static_cast<const float*>(data_a), lda,
+                   packed_b_->getData(), reinterpret_cast<float*>(data_output),
+                   N, workspace_);
+  } else if (packed_b_ != nullptr) {
+    status = sgemmPacked(sgemm_param, M, N, K, data_a, lda,
+                         packed_b_->getData(), data_output, N, epilogue,
+                         workspace_);
+  } else {
+    int ldb = param->trans_b_ ? K : N;
+    status = sgemm(sgemm_param, M, N, K, data_a, lda, data_b, ldb, data_output,
+                   N, epilogue, workspace_);
+  }
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "gemm failed");
+
+  return status;
 }
 
 base::Status gemm(device::Tensor* inputs_a, device::Tensor* inputs_b,
@@ -194,6 +377,57 @@ base::Status gemm(device::Tensor* inputs_a, device::Tensor* inputs_b,
   return status;
 }
 
+base::Status gemm(device::Tensor* inputs_a, device::Tensor* inputs_b,
+                  device::Tensor* b_scale, device::Tensor* b_zero_point,
+                  device::Tensor* inputs_c,
+                  std::shared_ptr<ir::GemmParam> param,
+                  device::Tensor* output) {
+  base::Status status = base::kStatusCodeOk;
+
+  Op* op = createOp(inputs_a->getDeviceType(), "", ir::kOpTypeGemm);
+  if (op == nullptr) {
+    NNDEPLOY_LOGE("createOp failed");
+    return base::kStatusCodeErrorNotImplement;
+  }
+  // 不修改调用者的参数
+  auto op_param = std::make_shared<ir::GemmParam>(*param);
+  op_param->has_b_zero_point_ = b_zero_point != nullptr;
+  status = op->setParam(op_param);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setParam failed");
+  status = op->setInput(inputs_a, 0);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setInput failed");
+  status = op->setInput(inputs_b, 1);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setInput failed");
+  status = op->setInput(b_scale, 2);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setInput failed");
+  int index = 3;
+  if (b_zero_point != nullptr) {
+    status = op->setInput(b_zero_point, index++);
+    NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setInput failed");
+  }
+  if (inputs_c != nullptr) {
+    status = op->setInput(inputs_c, index);
+    NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setInput failed");
+  }
+  status = op->setOutput(output, 0);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setOutput failed");
+  status = op->init();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "init failed");
+  status = op->preRun();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "preRun failed");
+  status = op->checkOrAllocOutput();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk,
+                         "checkOrAllocOutput failed");
+  status = op->run();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "run failed");
+  status = op->postRun();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "postRun failed");
+  status = op->deinit();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "deinit failed");
+  delete op;
+  return status;
+}
+
 REGISTER_OP_IMPLEMENTION(kDeviceTypeCodeCpu, ir::kOpTypeGemm, OpGemm)
 
 }  // namespace op
@@ -8,6 +8,7 @@
 #include "nndeploy/base/macro.h"
 #include "nndeploy/base/object.h"
 #include "nndeploy/base/param.h"
+#include "nndeploy/base/shape.h"
 #include "nndeploy/base/status.h"
 #include "nndeploy/base/string.h"
 #include "nndeploy/base/time_profiler.h"
@@ -17,6 +18,8 @@
 #include "nndeploy/device/tensor.h"
 #include "nndeploy/ir/ir.h"
 #include "nndeploy/op/op.h"
+#include "nndeploy/op/vec_math.h"
+#include "nndeploy/thread_pool/parallel.h"
 
 namespace nndeploy {
 namespace op {
@@ -29,13 +32,13 @@ base::Status OpGlobalAveragepool::inferShape() {
     NNDEPLOY_LOGE("input_shape.size() < 2.\n");
     return base::kStatusCodeErrorInvalidParam;
   }
-  // first dim is the batch axis and the next is the number of channels.
-  size_t n_input_dims = static_cast<size_t>(input_shape.size() - 2);
-  base::IntVector output_shape;
-  output_shape.emplace_back(input_shape[0]);
-  output_shape.emplace_back(input_shape[1]);
-  for (size_t i = 0; i < n_input_dims; ++i) {
-    output_shape.emplace_back(1);
+  // 除batch与channel外的维度都变为1
+  base::IntVector output_shape(input_shape.size(), 1);
+  output_shape[0] = input_shape[0];
+  if (inputs_[0]->getDataFormat() == base::kDataFormatNHWC) {
+    output_shape.back() = input_shape.back();
+  } else {
+    output_shape[1] = input_shape[1];
   }
 
   outputs_[0]->reshape(output_shape);
@@ -43,38 +46,105 @@ base::Status OpGlobalAveragepool::inferShape() {
   return status;
 }
 
+/**
+ * @brief NCHW，每个task处理一个平面，平面内向量化求和
+ */
+class GlobalAveragePoolNchwLoopBody : public thread_pool::ParallelLoopBody {
+ public:
+  GlobalAveragePoolNchwLoopBody(const float* input, float* output,
+                                size_t plane)
+      : input_(input), output_(output), plane_(plane) {}
+
+  virtual void operator()(const base::Range& range) const {
+    float scale = 1.0f / static_cast<float>(plane_);
+    for (int i = range.start_; i < range.end_; ++i) {
+      output_[i] = vecSum(input_ + i * plane_, plane_) * scale;
+    }
+  }
+
+ private:
+  const float* input_;
+  float* output_;
+  size_t plane_;
+};
+
+/**
+ * @brief NHWC，每个task处理一个batch，沿通道向量化累加
+ */
+class GlobalAveragePoolNhwcLoopBody : public thread_pool::ParallelLoopBody {
+ public:
+  GlobalAveragePoolNhwcLoopBody(const float* input, float* output,
+                                size_t plane, int channel)
+      : input_(input), output_(output), plane_(plane), channel_(channel) {}
+
+  virtual void operator()(const base::Range& range) const {
+    float scale = 1.0f / static_cast<float>(plane_);
+    for (int n = range.start_; n < range.end_; ++n) {
+      const float* src = input_ + n * plane_ * channel_;
+      float* dst = output_ + n * channel_;
+      std::fill(dst, dst + channel_, 0.0f);
+      for (size_t i = 0; i < plane_; ++i) {
+        const float* x = src + i * channel_;
+        for (int c = 0; c < channel_; ++c) {
+          dst[c] += x[c];
+        }
+      }
+      for (int c = 0; c < channel_; ++c) {
+        dst[c] *= scale;
+      }
+    }
+  }
+
+ private:
+  const float* input_;
+  float* output_;
+  size_t plane_;
+  int channel_;
+};
+
+uint64_t OpGlobalAveragepool::getFlops() {
+  return base::shapeCount(inputs_[0]->getShape(), 0, -1);
+}
+
 base::Status OpGlobalAveragepool::run() {
-  // 获取输入和输出张量
   device::Tensor* input_tensor = inputs_[0];
   device::Tensor* output_tensor = outputs_[0];
+  if (input_tensor->getDataType() != base::dataTypeOf<float>()) {
+    NNDEPLOY_LOGE("global average pool only support float.\n");
+    return base::kStatusCodeErrorNotSupport;
+  }
 
-  // 获取输入张量的形状
   base::IntVector input_shape = input_tensor->getShape();
-
-  // 获取输入和输出张量的数据指针
-  float* input_data = reinterpret_cast<float*>(input_tensor->getData());
-  float* output_data = reinterpret_cast<float*>(output_tensor->getData());
-
-  // 计算输入张量的总元素数量（不包括 batch 和 channels）
-  size_t total_elements = std::accumulate(
-      input_shape.begin() + 2, input_shape.end(), 1, std::multiplies<size_t>());
-
-  // 计算全局平均池化
-  for (size_t b = 0; b < input_shape[0]; ++b) {    // batch dimension
-    for (size_t c = 0; c < input_shape[1]; ++c) {  // channel dimension
-      float sum = 0.0f;
-      // size_t total_elements = 1;
-      // for (size_t i = 2; i < input_shape.size(); ++i) {
-      //   total_elements *= input_shape[i];
-      // }
-      size_t input_index =
-          b * input_shape[1] * total_elements + c * total_elements;
-      for (size_t e = 0; e < total_elements; ++e) {
-        sum += input_data[input_index++];
-      }
-      output_data[b * input_shape[1] + c] =
-          sum / static_cast<float>(total_elements);
+  const float* input_data = static_cast<float*>(input_tensor->getData());
+  float* output_data = static_cast<float*>(output_tensor->getData());
+  size_t total = std::accumulate(input_shape.begin(), input_shape.end(),
+                                 (size_t)1, std::multiplies<size_t>());
+
+  int block = base::getChannelBlock(input_tensor->getDataFormat());
+  if (block > 1) {
+    // 通道分块格式视为[N * CB, H * W, block]的NHWC
+    if (input_shape.size() < 2) {
+      NNDEPLOY_LOGE("blocked input must be at least 2D.\n");
+      return base::kStatusCodeErrorInvalidParam;
     }
+    int batch = input_shape[0] * ((input_shape[1] + block - 1) / block);
+    size_t plane = base::shapeCount(input_shape, 2, -1);
+    GlobalAveragePoolNhwcLoopBody body(input_data, output_data, plane, block);
+    base::Range range(0, batch);
+    thread_pool::parallelForWithCost(range, body, getFlops());
+  } else if (input_tensor->getDataFormat() == base::kDataFormatNHWC) {
+    int channel = input_shape.back();
+    size_t plane = total / ((size_t)input_shape[0] * channel);
+    GlobalAveragePoolNhwcLoopBody body(input_data, output_data, plane,
+                                       channel);
+    base::Range range(0, input_shape[0]);
+    thread_pool::parallelForWithCost(range, body, getFlops());
+  } else {
+    int count = input_shape[0] * input_shape[1];
+    size_t plane = total / count;
+    GlobalAveragePoolNchwLoopBody body(input_data, output_data, plane);
+    base::Range range(0, count);
+    thread_pool::parallelForWithCost(range, body, getFlops());
   }
 
   return base::kStatusCodeOk;
@@ -0,0 +1,261 @@
+#include "nndeploy/op/op_group_norm.h"
+
+#include "nndeploy/base/any.h"
+#include "nndeploy/base/common.h"
+#include "nndeploy/base/glic_stl_include.h"
+#include "nndeploy/base/log.h"
+#include "nndeploy/base/macro.h"
+#include "nndeploy/base/object.h"
+#include "nndeploy/base/param.h"
+#include "nndeploy/base/shape.h"
+#include "nndeploy/base/status.h"
+#include "nndeploy/base/string.h"
+#include "nndeploy/base/time_profiler.h"
+#include "nndeploy/device/buffer.h"
+#include "nndeploy/device/device.h"
+#include "nndeploy/device/memory_pool.h"
+#include "nndeploy/device/tensor.h"
+#include "nndeploy/ir/ir.h"
+#include "nndeploy/op/op.h"
+#include "nndeploy/op/op_unary.h"
+#include "nndeploy/op/vec_math.h"
+#include "nndeploy/thread_pool/parallel.h"
+
+namespace nndeploy {
+namespace op {
+
+/**
+ * @brief GroupNormalization与InstanceNormalization共用的参数
+ */
+struct GroupNormInfo {
+  int groups_ = 1;
+  float epsilon_ = 1e-5f;
+  ir::OpType activate_op_ = ir::kOpTypeNone;
+};
+
+static base::Status getGroupNormInfo(Op *op, int channels,
+                                     GroupNormInfo &info) {
+  std::shared_ptr<base::Param> param = op->getParam();
+  if (op->getOpType() == ir::kOpTypeInstanceNormalization) {
+    auto instance_param =
+        dynamic_cast<ir::InstanceNormalizationParam *>(param.get());
+    info.groups_ = channels;
+    if (instance_param != nullptr) {
+      info.epsilon_ = instance_param->epsilon_;
+      info.activate_op_ = instance_param->activate_op_;
+    }
+  } else {
+    auto group_param = dynamic_cast<ir::GroupNormalizationParam *>(param.get());
+    if (group_param != nullptr) {
+      info.groups_ = group_param->num_groups_;
+      info.epsilon_ = group_param->epsilon_;
+      info.activate_op_ = group_param->activate_op_;
+    }
+  }
+  if (info.groups_ <= 0 || channels % info.groups_ != 0) {
+    NNDEPLOY_LOGE("channels[%d] must be divisible by num_groups[%d].\n",
+                  channels, info.groups_);
+    return base::kStatusCodeErrorInvalidParam;
+  }
+  return base::kStatusCodeOk;
+}
+
+base::Status OpGroupNorm::inferShape() {
+  base::IntVector input_shape = inputs_[0]->getShape();
+  if (input_shape.size() < 2) {
+    NNDEPLOY_LOGE("input must be at least 2D.\n");
+    return base::kStatusCodeErrorInvalidParam;
+  }
+  GroupNormInfo info;
+  base::Status status = getGroupNormInfo(this, input_shape[1], info);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk,
+                         "getGroupNormInfo failed");
+  outputs_[0]->reshape(input_shape);
+  return status;
+}
+
+
+/**
+ * @brief 每个任务处理一个(batch, group)，组内的通道连续存放
+ * # 组的均值方差求出后，每个通道的scale/bias与之合并为a、b，
+ *   y = (x - mean) * rstd * scale + bias = x * a + b
+ */
+class GroupNormLoopBody : public thread_pool::ParallelLoopBody {
+ public:
+  GroupNormLoopBody(const float *input, const float *scale, const float *bias,
+                    float *output, int groups, int group_channels,
+                    size_t spatial, bool per_group, float epsilon,
+                    VecFunc activate)
+      : input_(input),
+        scale_(scale),
+        bias_(bias),
+        output_(output),
+        groups_(groups),
+        group_channels_(group_channels),
+        spatial_(spatial),
+        per_group_(per_group),
+        epsilon_(epsilon),
+        activate_(activate) {}
+
+  virtual void operator()(const base::Range &range) const {
+    size_t group_size = group_channels_ * spatial_;
+    for (int task = range.start_; task < range.end_; ++task) {
+      int group = task % groups_;
+      size_t offset = (size_t)task * group_size;
+      float mean = 0.0f;
+      float var = 0.0f;
+      vecMeanVar(input_ + offset, group_size, &mean, &var);
+      float rstd = 1.0f / std::sqrt(var + epsilon_);
+      for (int c = 0; c < group_channels_; ++c) {
+        int channel = group * group_channels_ + c;
+        int index = per_group_ ? group : channel;
+        float a = rstd * scale_[index];
+        float b = (bias_ != nullptr ? bias_[index] : 0.0f) - mean * a;
+        const float *src = input_ + offset + c * spatial_;
+        float *dst = output_ + offset + c * spatial_;
+        vecScaleShift(src, a, b, dst, spatial_);
+        if (activate_ != nullptr) {
+          activate_(dst, dst, spatial_);
+        }
+      }
+    }
+  }
+
+ private:
+  const float *input_;
+  const float *scale_;
+  const float *bias_;
+  float *output_;
+  int groups_;
+  int group_channels_;
+  size_t spatial_;
+  bool per_group_;
+  float epsilon_;
+  VecFunc activate_;
+};
+
+base::Status OpGroupNorm::run() {
+  base::Status status = base::kStatusCodeOk;
+  if (inputs_[0]->getDataType() != base::dataTypeOf<float>()) {
+    NNDEPLOY_LOGE("group norm only support float.\n");
+    return base::kStatusCodeErrorNotSupport;
+  }
+  base::IntVector input_shape = inputs_[0]->getShape();
+  int batch = input_shape[0];
+  int channels = input_shape[1];
+  size_t spatial = base::shapeCount(input_shape, 2, -1);
+  GroupNormInfo info;
+  status = getGroupNormInfo(this, channels, info);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk,
+                         "getGroupNormInfo failed");
+  VecFunc activate = nullptr;
+  if (info.activate_op_ != ir::kOpTypeNone) {
+    activate = getUnaryFunc(info.activate_op_);
+    if (activate == nullptr) {
+      NNDEPLOY_LOGE("fused activate op[%s] is not supported.\n",
+                    ir::opTypeToString(info.activate_op_).c_str());
+      return base::kStatusCodeErrorNotSupport;
+    }
+  }
+
+  // scale/bias为per-channel或per-group
+  if (inputs_.size() < 2 || inputs_[1] == nullptr) {
+    NNDEPLOY_LOGE("scale is required.\n");
+    return base::kStatusCodeErrorInvalidParam;
+  }
+  size_t scale_num = inputs_[1]->getSize() / sizeof(float);
+  bool per_group = scale_num < static_cast<size_t>(channels);
+  if (scale_num < static_cast<size_t>(per_group ? info.groups_ : channels)) {
+    NNDEPLOY_LOGE("scale size must be channels[%d] or num_groups[%d].\n",
+                  channels, info.groups_);
+    return base::kStatusCodeErrorInvalidParam;
+  }
+  const float *bias = nullptr;
+  if (inputs_.size() > 2 && inputs_[2] != nullptr) {
+    if (inputs_[2]->getSize() / sizeof(float) < scale_num) {
+      NNDEPLOY_LOGE("bias size must be equal to scale size.\n");
+      return base::kStatusCodeErrorInvalidParam;
+    }
+    bias = static_cast<const float *>(inputs_[2]->getData());
+  }
+  size_t tasks = (size_t)batch * info.groups_;
+  if (tasks == 0 || spatial == 0) {
+    return status;
+  }
+
+  GroupNormLoopBody body(static_cast<const float *>(inputs_[0]->getData()),
+                         static_cast<const float *>(inputs_[1]->getData()),
+                         bias, static_cast<float *>(outputs_[0]->getData()),
+                         info.groups_, channels / info.groups_, spatial,
+                         per_group, info.epsilon_, activate);
+  thread_pool::parallelForWithCost(base::Range(0, (int)tasks), body,
+                                    getFlops());
+
+  return status;
+}
+
+static base::Status groupNormImpl(ir::OpType op_type, device::Tensor *input,
+                                  device::Tensor *scale, device::Tensor *bias,
+                                  std::shared_ptr<base::Param> param,
+                                  device::Tensor *output) {
+  base::Status status = base::kStatusCodeOk;
+
+  Op *op = createOp(input->getDeviceType(), "", op_type);
+  if (op == nullptr) {
+    NNDEPLOY_LOGE("createOp failed");
+    return base::kStatusCodeErrorNotImplement;
+  }
+  status = op->setParam(param);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setParam failed");
+  status = op->setInput(input, 0);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setInput failed");
+  status = op->setInput(scale, 1);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setInput failed");
+  if (bias != nullptr) {
+    status = op->setInput(bias, 2);
+    NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setInput failed");
+  }
+  status = op->setOutput(output, 0);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setOutput failed");
+  status = op->init();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "init failed");
+  status = op->preRun();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "preRun failed");
+  status = op->checkOrAllocOutput();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk,
+                         "checkOrAllocOutput failed");
+  status = op->run();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "run failed");
+  status = op->postRun();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "postRun failed");
+  status = op->deinit();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "deinit failed");
+
+  delete op;
+
+  return status;
+}
+
+base::Status groupNorm(device::Tensor *input, device::Tensor *scale,
+                       device::Tensor *bias,
+                       std::shared_ptr<ir::GroupNormalizationParam> param,
+                       device::Tensor *output) {
+  return groupNormImpl(ir::kOpTypeGroupNormalization, input, scale, bias,
+                       param, output);
+}
+
+base::Status instanceNorm(
+    device::Tensor *input, device::Tensor *scale, device::Tensor *bias,
+    std::shared_ptr<ir::InstanceNormalizationParam> param,
+    device::Tensor *output) {
+  return groupNormImpl(ir::kOpTypeInstanceNormalization, input, scale, bias,
+                       param, output);
+}
+
+REGISTER_OP_IMPLEMENTION(kDeviceTypeCodeCpu, ir::kOpTypeGroupNormalization,
+                         OpGroupNorm)
+REGISTER_OP_IMPLEMENTION(kDeviceTypeCodeCpu,
+                         ir::kOpTypeInstanceNormalization, OpInstanceNorm)
+
+}  // namespace op
+}  // namespace nndeploy
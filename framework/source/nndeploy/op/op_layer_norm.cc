@@ -0,0 +1,217 @@
+#include "nndeploy/op/op_layer_norm.h"
+
+#include "nndeploy/base/any.h"
+#include "nndeploy/base/common.h"
+#include "nndeploy/base/glic_stl_include.h"
+#include "nndeploy/base/log.h"
+#include "nndeploy/base/macro.h"
+#include "nndeploy/base/object.h"
+#include "nndeploy/base/param.h"
+#include "nndeploy/base/shape.h"
+#include "nndeploy/base/status.h"
+#include "nndeploy/base/string.h"
+#include "nndeploy/base/time_profiler.h"
+#include "nndeploy/device/buffer.h"
+#include "nndeploy/device/device.h"
+#include "nndeploy/device/memory_pool.h"
+#include "nndeploy/device/tensor.h"
+#include "nndeploy/ir/ir.h"
+#include "nndeploy/op/op.h"
+#include "nndeploy/op/op_unary.h"
+#include "nndeploy/op/vec_math.h"
+#include "nndeploy/thread_pool/parallel.h"
+
+namespace nndeploy {
+namespace op {
+
+static int getLayerNormAxis(Op *op, int rank) {
+  auto param =
+      dynamic_cast<ir::LayerNormalizationParam *>(op->getParam().get());
+  int axis = param != nullptr ? param->axis_ : -1;
+  if (axis < 0) {
+    axis += rank;
+  }
+  return axis;
+}
+
+base::Status OpLayerNorm::inferShape() {
+  base::IntVector input_shape = inputs_[0]->getShape();
+  int rank = static_cast<int>(input_shape.size());
+  int axis = getLayerNormAxis(this, rank);
+  if (axis < 0 || axis >= rank) {
+    NNDEPLOY_LOGE("axis is out of range.\n");
+    return base::kStatusCodeErrorInvalidParam;
+  }
+  outputs_[0]->reshape(input_shape);
+  base::IntVector stat_shape = input_shape;
+  for (int i = axis; i < rank; ++i) {
+    stat_shape[i] = 1;
+  }
+  for (size_t i = 1; i < outputs_.size(); ++i) {
+    if (outputs_[i] != nullptr) {
+      outputs_[i]->reshape(stat_shape);
+    }
+  }
+  return base::kStatusCodeOk;
+}
+
+
+/**
+ * @brief 按行划分任务，每行两遍：Welford求均值方差，再归一化与仿射
+ */
+class LayerNormLoopBody : public thread_pool::ParallelLoopBody {
+ public:
+  LayerNormLoopBody(const float *input, const float *scale, const float *bias,
+                    float *output, float *mean, float *inv_std_dev, int size,
+                    float epsilon, VecFunc activate)
+      : input_(input),
+        scale_(scale),
+        bias_(bias),
+        output_(output),
+        mean_(mean),
+        inv_std_dev_(inv_std_dev),
+        size_(size),
+        epsilon_(epsilon),
+        activate_(activate) {}
+
+  virtual void operator()(const base::Range &range) const {
+    for (int row = range.start_; row < range.end_; ++row) {
+      size_t offset = (size_t)row * size_;
+      float mean = 0.0f;
+      float var = 0.0f;
+      vecMeanVar(input_ + offset, size_, &mean, &var);
+      float rstd = 1.0f / std::sqrt(var + epsilon_);
+      float *dst = output_ + offset;
+      vecNormAffine(input_ + offset, mean, rstd, scale_, bias_, dst, size_);
+      if (activate_ != nullptr) {
+        activate_(dst, dst, size_);
+      }
+      if (mean_ != nullptr) {
+        mean_[row] = mean;
+      }
+      if (inv_std_dev_ != nullptr) {
+        inv_std_dev_[row] = rstd;
+      }
+    }
+  }
+
+ private:
+  const float *input_;
+  const float *scale_;
+  const float *bias_;
+  float *output_;
+  float *mean_;
+  float *inv_std_dev_;
+  int size_;
+  float epsilon_;
+  VecFunc activate_;
+};
+
+base::Status OpLayerNorm::run() {
+  base::Status status = base::kStatusCodeOk;
+  if (inputs_[0]->getDataType() != base::dataTypeOf<float>()) {
+    NNDEPLOY_LOGE("layer norm only support float.\n");
+    return base::kStatusCodeErrorNotSupport;
+  }
+  auto param =
+      dynamic_cast<ir::LayerNormalizationParam *>(op_desc_.op_param_.get());
+  NNDEPLOY_CHECK_PARAM_NULL_RET_STATUS(param, "op_desc_.op_param_ is nullptr");
+  VecFunc activate = nullptr;
+  if (param->activate_op_ != ir::kOpTypeNone) {
+    activate = getUnaryFunc(param->activate_op_);
+    if (activate == nullptr) {
+      NNDEPLOY_LOGE("fused activate op[%s] is not supported.\n",
+                    ir::opTypeToString(param->activate_op_).c_str());
+      return base::kStatusCodeErrorNotSupport;
+    }
+  }
+
+  base::IntVector input_shape = inputs_[0]->getShape();
+  int rank = static_cast<int>(input_shape.size());
+  int axis = getLayerNormAxis(this, rank);
+  size_t rows = base::shapeCount(input_shape, 0, axis);
+  size_t size = base::shapeCount(input_shape, axis, -1);
+  if (inputs_.size() < 2 || inputs_[1] == nullptr ||
+      inputs_[1]->getSize() < size * sizeof(float)) {
+    NNDEPLOY_LOGE("scale size must be equal to normalized size[%d].\n",
+                  (int)size);
+    return base::kStatusCodeErrorInvalidParam;
+  }
+  const float *bias = nullptr;
+  if (inputs_.size() > 2 && inputs_[2] != nullptr) {
+    if (inputs_[2]->getSize() < size * sizeof(float)) {
+      NNDEPLOY_LOGE("bias size must be equal to normalized size[%d].\n",
+                    (int)size);
+      return base::kStatusCodeErrorInvalidParam;
+    }
+    bias = static_cast<const float *>(inputs_[2]->getData());
+  }
+  if (rows == 0 || size == 0) {
+    return status;
+  }
+
+  float *mean = nullptr;
+  float *inv_std_dev = nullptr;
+  if (outputs_.size() > 1 && outputs_[1] != nullptr) {
+    mean = static_cast<float *>(outputs_[1]->getData());
+  }
+  if (outputs_.size() > 2 && outputs_[2] != nullptr) {
+    inv_std_dev = static_cast<float *>(outputs_[2]->getData());
+  }
+  LayerNormLoopBody body(static_cast<const float *>(inputs_[0]->getData()),
+                         static_cast<const float *>(inputs_[1]->getData()),
+                         bias, static_cast<float *>(outputs_[0]->getData()),
+                         mean, inv_std_dev, static_cast<int>(size),
+                         param->epsilon_, activate);
+  thread_pool::parallelForWithCost(base::Range(0, (int)rows), body, getFlops());
+
+  return status;
+}
+
+base::Status layerNorm(device::Tensor *input, device::Tensor *scale,
+                       device::Tensor *bias,
+                       std::shared_ptr<ir::LayerNormalizationParam> param,
+                       device::Tensor *output) {
+  base::Status status = base::kStatusCodeOk;
+
+  Op *op = createOp(input->getDeviceType(), "", ir::kOpTypeLayerNormalization);
+  if (op == nullptr) {
+    NNDEPLOY_LOGE("createOp failed");
+    return base::kStatusCodeErrorNotImplement;
+  }
+  status = op->setParam(param);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setParam failed");
+  status = op->setInput(input, 0);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setInput failed");
+  status = op->setInput(scale, 1);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setInput failed");
+  if (bias != nullptr) {
+    status = op->setInput(bias, 2);
+    NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setInput failed");
+  }
+  status = op->setOutput(output, 0);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setOutput failed");
+  status = op->init();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "init failed");
+  status = op->preRun();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "preRun failed");
+  status = op->checkOrAllocOutput();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk,
+                         "checkOrAllocOutput failed");
+  status = op->run();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "run failed");
+  status = op->postRun();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "postRun failed");
+  status = op->deinit();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "deinit failed");
+
+  delete op;
+
+  return status;
+}
+
+REGISTER_OP_IMPLEMENTION(kDeviceTypeCodeCpu, ir::kOpTypeLayerNormalization,
+                         OpLayerNorm)
+
+}  // namespace op
+}  // namespace nndeploy
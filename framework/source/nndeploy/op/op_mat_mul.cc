@@ -17,48 +17,412 @@
 #include "nndeploy/device/tensor.h"
 #include "nndeploy/ir/ir.h"
 #include "nndeploy/op/op.h"
+#include "nndeploy/op/qgemm.h"
+#include "nndeploy/op/sgemm.h"
 #include "nndeploy/op/util.h"
 
 namespace nndeploy {
 namespace op {
 
+/**
+ * @brief MatMul的形状信息，规则与numpy.matmul一致
+ * # 一维的A视为[1, K]，一维的B视为[K, 1]，输出中去掉对应的维度
+ * # batch维度按广播规则展开
+ */
+struct MatMulShape {
+  int m_ = 0;
+  int n_ = 0;
+  int k_ = 0;
+  base::IntVector batch_shape_;
+  // 输出的每个batch对应的A、B的batch偏移(元素个数)
+  std::vector<size_t> a_offsets_;
+  std::vector<size_t> b_offsets_;
+  base::IntVector output_shape_;
+};
+
+static base::Status getMatMulShape(const base::IntVector &shape_a,
+                                   const base::IntVector &shape_b,
+                                   MatMulShape &shape) {
+  if (shape_a.empty() || shape_b.empty()) {
+    NNDEPLOY_LOGE("MatMul input must not be scalar.\n");
+    return base::kStatusCodeErrorInvalidParam;
+  }
+  base::IntVector a = shape_a;
+  base::IntVector b = shape_b;
+  bool squeeze_m = a.size() == 1;
+  bool squeeze_n = b.size() == 1;
+  if (squeeze_m) {
+    a.insert(a.begin(), 1);
+  }
+  if (squeeze_n) {
+    b.push_back(1);
+  }
+  shape.m_ = a[a.size() - 2];
+  shape.k_ = a[a.size() - 1];
+  shape.n_ = b[b.size() - 1];
+  if (b[b.size() - 2] != shape.k_) {
+    NNDEPLOY_LOGE("MatMul input shapes are not compatible.\n");
+    return base::kStatusCodeErrorInvalidParam;
+  }
+
+  // batch维度广播
+  int a_batch_rank = static_cast<int>(a.size()) - 2;
+  int b_batch_rank = static_cast<int>(b.size()) - 2;
+  int batch_rank = std::max(a_batch_rank, b_batch_rank);
+  base::IntVector a_batch(batch_rank, 1);
+  base::IntVector b_batch(batch_rank, 1);
+  for (int i = 0; i < a_batch_rank; ++i) {
+    a_batch[batch_rank - a_batch_rank + i] = a[i];
+  }
+  for (int i = 0; i < b_batch_rank; ++i) {
+    b_batch[batch_rank - b_batch_rank + i] = b[i];
+  }
+  shape.batch_shape_.resize(batch_rank);
+  for (int i = 0; i < batch_rank; ++i) {
+    if (a_batch[i] != b_batch[i] && a_batch[i] != 1 && b_batch[i] != 1) {
+      NNDEPLOY_LOGE("MatMul batch dims are not broadcastable.\n");
+      return base::kStatusCodeErrorInvalidParam;
+    }
+    shape.batch_shape_[i] = std::max(a_batch[i], b_batch[i]);
+  }
+
+  // 每个输出batch对应的A、B偏移，广播维度的stride为0
+  size_t batch = 1;
+  for (auto dim : shape.batch_shape_) {
+    batch *= dim;
+  }
+  std::vector<size_t> a_strides(batch_rank, 0);
+  std::vector<size_t> b_strides(batch_rank, 0);
+  size_t a_stride = (size_t)shape.m_ * shape.k_;
+  size_t b_stride = (size_t)shape.k_ * shape.n_;
+  for (int i = batch_rank - 1; i >= 0; --i) {
+    a_strides[i] = a_batch[i] == 1 ? 0 : a_stride;
+    b_strides[i] = b_batch[i] == 1 ? 0 : b_stride;
+    a_stride *= a_batch[i];
+    b_stride *= b_batch[i];
+  }
+  shape.a_offsets_.resize(batch);
+  shape.b_offsets_.resize(batch);
+  for (size_t index = 0; index < batch; ++index) {
+    size_t remain = index;
+    size_t a_offset = 0;
+    size_t b_offset = 0;
+    for (int i = batch_rank - 1; i >= 0; --i) {
+      size_t coord = remain % shape.batch_shape_[i];
+      remain /= shape.batch_shape_[i];
+      a_offset += coord * a_strides[i];
+      b_offset += coord * b_strides[i];
+    }
+    shape.a_offsets_[index] = a_offset;
+    shape.b_offsets_[index] = b_offset;
+  }
+
+  shape.output_shape_ = shape.batch_shape_;
+  if (!squeeze_m) {
+    shape.output_shape_.push_back(shape.m_);
+  }
+  if (!squeeze_n) {
+    shape.output_shape_.push_back(shape.n_);
+  }
+  // 一维与一维相乘的结果为标量，用[1]表示
+  if (shape.output_shape_.empty()) {
+    shape.output_shape_.push_back(1);
+  }
+  return base::kStatusCodeOk;
+}
+
+// B在所有batch间共享(如二维权重)
+static bool isMatMulSharedB(const MatMulShape &shape) {
+  for (auto offset : shape.b_offsets_) {
+    if (offset != 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// B共享且A的batch连续时，所有batch可以合并到M维，只做一次GEMM
+static bool isMatMulFoldBatch(const MatMulShape &shape) {
+  if (!isMatMulSharedB(shape)) {
+    return false;
+  }
+  size_t a_stride = (size_t)shape.m_ * shape.k_;
+  for (size_t i = 0; i < shape.a_offsets_.size(); ++i) {
+    if (shape.a_offsets_[i] != i * a_stride) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// 量化的B按[N, K]存放，逻辑形状为[K, N]
+static base::IntVector getMatMulShapeB(device::Tensor *input_b) {
+  base::IntVector shape = input_b->getShape();
+  base::DataType data_type = input_b->getDataType();
+  if (isQGemmDataType(data_type) && shape.size() == 2) {
+    return {shape[1] * data_type.lanes_, shape[0]};
+  }
+  return shape;
+}
+
 base::Status OpMatMul::inferShape() {
   base::Status status = base::kStatusCodeOk;
   if (inputs_.size() < 2) {
     NNDEPLOY_LOGE("inputs_.size() < 2.\n");
     return base::kStatusCodeErrorInvalidParam;
   }
-  
-  auto first_input_shape = inputs_[0]->getShape();
-  auto second_input_shape = inputs_[1]->getShape();
-  int shape_size = second_input_shape.size();
 
-  base::IntVector output_shape = first_input_shape;
-  output_shape[shape_size-1] = second_input_shape[shape_size-1];
+  MatMulShape shape;
+  status = getMatMulShape(inputs_[0]->getShape(), getMatMulShapeB(inputs_[1]),
+                          shape);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "getMatMulShape failed");
+
+  outputs_[0]->reshape(shape.output_shape_);
+
+  return status;
+}
 
-  outputs_[0]->reshape(output_shape);
+base::Status OpMatMul::init() {
+  base::Status status = Op::init();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "Op::init failed");
 
+  device::Tensor *input_b = inputs_.size() > 1 ? inputs_[1] : nullptr;
+  if (!isInputWeight(1) || input_b == nullptr ||
+      input_b->getData() == nullptr || input_b->getShape().size() != 2) {
+    return status;
+  }
+  if (isQuantB()) {
+    return packQuantB();
+  }
+
+  // 预打包B，半精度的B打包后仍为半精度
+  base::IntVector shape_b = input_b->getShape();
+  int K = shape_b[0];
+  int N = shape_b[1];
+  SgemmParam param;
+  param.b_type_ = input_b->getDataType();
+  device::TensorDesc desc(
+      param.b_type_, base::kDataFormatN,
+      {static_cast<int>(sgemmPackedBSize(param, N, K) /
+                        param.b_type_.size())});
+  device::Device *device = device::getDevice(device_type_);
+  if (packed_b_ != nullptr) {
+    delete packed_b_;
+  }
+  packed_b_ = new device::Tensor(device, desc, op_desc_.name_ + ".packed_b");
+  sgemmPackB(param, N, K, input_b->getData(), N, packed_b_->getData());
   return status;
 }
 
+bool OpMatMul::isQuantB() {
+  return inputs_.size() > 1 && isQGemmDataType(inputs_[1]->getDataType());
+}
+
+base::Status OpMatMul::packQuantB() {
+  QGemmWeight qweight;
+  base::Status status =
+      getQGemmWeight(inputs_[1], inputs_.size() > 2 ? inputs_[2] : nullptr,
+                     inputs_.size() > 3 ? inputs_[3] : nullptr, qweight);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "getQGemmWeight failed");
+  int size = static_cast<int>(qgemmPackedBSize(qweight));
+  if (packed_b_ == nullptr || packed_b_->getShape()[0] != size) {
+    if (packed_b_ != nullptr) {
+      delete packed_b_;
+    }
+    device::TensorDesc desc(base::dataTypeOf<uint8_t>(), base::kDataFormatN,
+                            {size});
+    device::Device *device = device::getDevice(device_type_);
+    packed_b_ = new device::Tensor(device, desc, op_desc_.name_ + ".packed_b");
+  }
+  return qgemmPackB(qweight, packed_b_->getData());
+}
+
+base::Status OpMatMul::deinit() {
+  if (packed_b_ != nullptr) {
+    delete packed_b_;
+    packed_b_ = nullptr;
+  }
+  return Op::deinit();
+}
+
+// 合并batch后GEMM的M
+static int getMatMulGemmM(const MatMulShape &shape) {
+  if (isMatMulFoldBatch(shape)) {
+    return shape.m_ * static_cast<int>(shape.a_offsets_.size());
+  }
+  return shape.m_;
+}
+
+// A、B、输出的存储类型，支持fp32/fp16/bf16
+static SgemmParam getMatMulSgemmParam(
+    const std::vector<device::Tensor *> &inputs, device::Tensor *output) {
+  SgemmParam param;
+  param.a_type_ = inputs[0]->getDataType();
+  param.b_type_ = inputs[1]->getDataType();
+  param.c_type_ = output->getDataType();
+  return param;
+}
+
+base::Status OpMatMul::preRun() {
+  MatMulShape shape;
+  base::Status status = getMatMulShape(inputs_[0]->getShape(),
+                                       getMatMulShapeB(inputs_[1]), shape);
+  if (status != base::kStatusCodeOk) {
+    return base::kStatusCodeOk;
+  }
+  if (isQuantB()) {
+    int group_num = inputs_.size() > 2 && inputs_[2]->getShape().size() == 2
+                        ? inputs_[2]->getShape()[1]
+                        : 1;
+    return updateWorkspaceSize(qgemmWorkspaceSize(
+        getMatMulGemmM(shape), shape.n_, shape.k_, shape.k_ / group_num));
+  }
+  return updateWorkspaceSize(
+      sgemmWorkspaceSize(getMatMulSgemmParam(inputs_, outputs_[0]),
+                         getMatMulGemmM(shape), shape.n_, shape.k_));
+}
+
 base::Status OpMatMul::run() {
-  NNDEPLOY_LOGI("not implemented.\n");
-  return base::kStatusCodeOk;
+  base::Status status = base::kStatusCodeOk;
+  MatMulShape shape;
+  status = getMatMulShape(inputs_[0]->getShape(), getMatMulShapeB(inputs_[1]),
+                          shape);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "getMatMulShape failed");
+
+  int gemm_m = getMatMulGemmM(shape);
+  if (isQuantB()) {
+    return runQuant(gemm_m, shape.n_, shape.k_);
+  }
+  SgemmParam param = getMatMulSgemmParam(inputs_, outputs_[0]);
+  status = updateWorkspaceSize(
+      sgemmWorkspaceSize(param, gemm_m, shape.n_, shape.k_));
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk,
+                         "updateWorkspaceSize failed");
+  status = allocateWorkspace();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk,
+                         "allocateWorkspace failed");
+
+  // 按字节寻址，A、B、输出可以是fp32/fp16/bf16
+  const char *data_a = static_cast<const char *>(inputs_[0]->getData());
+  const char *data_b = static_cast<const char *>(inputs_[1]->getData());
+  char *data_output = static_cast<char *>(outputs_[0]->getData());
+  const void *packed_b =
+      packed_b_ != nullptr ? packed_b_->getData() : nullptr;
+  size_t a_size = param.a_type_.size();
+  size_t b_size = param.b_type_.size();
+  size_t c_size = param.c_type_.size();
+  int m = shape.m_;
+  int n = shape.n_;
+  int k = shape.k_;
+  SgemmEpilogue epilogue;
+
+  // 所有batch合并为一次GEMM
+  if (gemm_m != m || shape.a_offsets_.size() == 1) {
+    if (packed_b != nullptr) {
+      status = sgemmPacked(param, gemm_m, n, k, data_a, k, packed_b,
+                           data_output, n, epilogue, workspace_);
+    } else {
+      status = sgemm(param, gemm_m, n, k, data_a, k, data_b, n, data_output,
+                     n, epilogue, workspace_);
+    }
+    NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "sgemm failed");
+    return status;
+  }
+
+  // 逐batch计算，每个GEMM内部多线程
+  bool use_packed_b = packed_b != nullptr && isMatMulSharedB(shape);
+  size_t c_stride = (size_t)m * n;
+  for (size_t i = 0; i < shape.a_offsets_.size(); ++i) {
+    const char *a = data_a + shape.a_offsets_[i] * a_size;
+    char *c = data_output + i * c_stride * c_size;
+    if (use_packed_b) {
+      status = sgemmPacked(param, m, n, k, a, k, packed_b, c, n, epilogue,
+                           workspace_);
+    } else {
+      const char *b = data_b + shape.b_offsets_[i] * b_size;
+      status =
+          sgemm(param, m, n, k, a, k, b, n, c, n, epilogue, workspace_);
+    }
+    NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "sgemm failed");
+  }
+
+  return status;
+}
+
+// 量化的B为二维，所有batch合并为一次qgemm
+base::Status OpMatMul::runQuant(int m, int n, int k) {
+  base::Status status = base::kStatusCodeOk;
+  if (packed_b_ == nullptr || !isInputWeight(1)) {
+    status = packQuantB();
+    NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "packQuantB failed");
+  }
+  int group_num = inputs_[2]->getShape()[1];
+  status = updateWorkspaceSize(qgemmWorkspaceSize(m, n, k, k / group_num));
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk,
+                         "updateWorkspaceSize failed");
+  status = allocateWorkspace();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk,
+                         "allocateWorkspace failed");
+  status = qgemm(m, n, k, 1.0f, 0.0f,
+                 static_cast<float *>(inputs_[0]->getData()), k,
+                 packed_b_->getData(),
+                 static_cast<float *>(outputs_[0]->getData()), n, workspace_);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "qgemm failed");
+  return status;
+}
+
+base::Status matmul(device::Tensor *inputs_a, device::Tensor *inputs_b,
+                    device::Tensor *output) {
+  base::Status status = base::kStatusCodeOk;
+
+  Op *op = createOp(inputs_a->getDeviceType(), "", ir::kOpTypeMatMul);
+  if (op == nullptr) {
+    NNDEPLOY_LOGE("createOp failed");
+    return base::kStatusCodeErrorNotImplement;
+  }
+  status = op->setInput(inputs_a, 0);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setInput failed");
+  status = op->setInput(inputs_b, 1);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setInput failed");
+  status = op->setOutput(output, 0);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setOutput failed");
+  status = op->init();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "init failed");
+  status = op->preRun();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "preRun failed");
+  status = op->checkOrAllocOutput();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk,
+                         "checkOrAllocOutput failed");
+  status = op->run();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "run failed");
+  status = op->postRun();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "postRun failed");
+  status = op->deinit();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "deinit failed");
+  delete op;
+  return status;
 }
 
 base::Status matmul(device::Tensor *inputs_a, device::Tensor *inputs_b,
-                  device::Tensor *output) {
+                    device::Tensor *b_scale, device::Tensor *b_zero_point,
+                    device::Tensor *output) {
   base::Status status = base::kStatusCodeOk;
 
-  Op *op = createOp(inputs_a->getDeviceType(), "", ir::kOpTypeMaxPool);
+  Op *op = createOp(inputs_a->getDeviceType(), "", ir::kOpTypeMatMul);
   if (op == nullptr) {
     NNDEPLOY_LOGE("createOp failed");
     return base::kStatusCodeErrorNotImplement;
   }
   status = op->setInput(inputs_a, 0);
   NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setInput failed");
-  status = op->setInput(inputs_b, 0);
+  status = op->setInput(inputs_b, 1);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setInput failed");
+  status = op->setInput(b_scale, 2);
   NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setInput failed");
+  if (b_zero_point != nullptr) {
+    status = op->setInput(b_zero_point, 3);
+    NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setInput failed");
+  }
   status = op->setOutput(output, 0);
   NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setOutput failed");
   status = op->init();
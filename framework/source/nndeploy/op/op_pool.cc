@@ -0,0 +1,540 @@
+
+#include "nndeploy/op/op_pool.h"
+
+#include "nndeploy/base/common.h"
+#include "nndeploy/base/glic_stl_include.h"
+#include "nndeploy/base/log.h"
+#include "nndeploy/base/macro.h"
+#include "nndeploy/base/shape.h"
+#include "nndeploy/base/status.h"
+#include "nndeploy/device/device.h"
+#include "nndeploy/device/tensor.h"
+#include "nndeploy/ir/ir.h"
+#include "nndeploy/op/op.h"
+#include "nndeploy/thread_pool/parallel.h"
+
+namespace nndeploy {
+namespace op {
+
+base::Status inferPoolShape(const base::IntVector &input_shape,
+                            base::DataFormat data_format,
+                            const std::string &auto_pad, int ceil_mode,
+                            const std::vector<int> &kernel_shape,
+                            std::vector<int> &strides, std::vector<int> &pads,
+                            std::vector<int> &dilations,
+                            base::IntVector &output_shape) {
+  if (input_shape.size() < 2) {
+    NNDEPLOY_LOGE("input_shape.size() < 2.\n");
+    return base::kStatusCodeErrorInvalidParam;
+  }
+  // first dim is the batch axis and the next is the number of channels.
+  int n_input_dims = static_cast<int>(input_shape.size() - 2);
+  int spatial_offset = data_format == base::kDataFormatNHWC ? 1 : 2;
+  if (static_cast<int>(kernel_shape.size()) != n_input_dims) {
+    NNDEPLOY_LOGE("kernel_shape.size() must be equal to %d.\n", n_input_dims);
+    return base::kStatusCodeErrorInvalidParam;
+  }
+  if (dilations.size() == 0) {
+    dilations.resize(n_input_dims, 1);
+  }
+  if (strides.size() == 0) {
+    strides.resize(n_input_dims, 1);
+  }
+  if (static_cast<int>(dilations.size()) != n_input_dims ||
+      static_cast<int>(strides.size()) != n_input_dims) {
+    NNDEPLOY_LOGE("size of strides or dilations is invalid.\n");
+    return base::kStatusCodeErrorInvalidParam;
+  }
+
+  std::vector<int> effective_kernel_shape = kernel_shape;
+  for (int i = 0; i < n_input_dims; i++) {
+    // accounting for dilation, how big is the kernel in this dimension
+    effective_kernel_shape[i] =
+        (effective_kernel_shape[i] - 1) * dilations[i] + 1;
+  }
+
+  if (pads.size() == 0) {
+    pads.resize(n_input_dims * 2, 0);
+    if ((!auto_pad.empty()) && (auto_pad != "VALID") &&
+        (auto_pad != "NOTSET")) {
+      for (int i = 0; i < n_input_dims; ++i) {
+        int64_t residual = 0;
+        int64_t stride = strides[i];
+        if (stride > 1) {
+          residual = input_shape[spatial_offset + i];
+          while (residual >= stride) {
+            residual -= stride;
+          }
+        }
+        int64_t total_pad = residual == 0
+                                ? effective_kernel_shape[i] - stride
+                                : effective_kernel_shape[i] - residual;
+        if (total_pad < 0) total_pad = 0;
+        int64_t half_pad_small = total_pad >> 1;
+        int64_t half_pad_big = total_pad - half_pad_small;
+        if (auto_pad == "SAME_UPPER") {
+          pads[i] = half_pad_small;
+          pads[i + n_input_dims] = half_pad_big;
+        } else if (auto_pad == "SAME_LOWER") {
+          pads[i] = half_pad_big;
+          pads[i + n_input_dims] = half_pad_small;
+        }
+      }
+    }
+  }
+  if (static_cast<int>(pads.size()) != n_input_dims * 2) {
+    NNDEPLOY_LOGE("pads.size() must be equal to %d.\n", n_input_dims * 2);
+    return base::kStatusCodeErrorInvalidParam;
+  }
+
+  output_shape = input_shape;
+  for (int i = 0; i < n_input_dims; ++i) {
+    // how big is the input, including padding
+    int input_size = input_shape[spatial_offset + i];
+    int effective_input_size = input_size + pads[i] + pads[i + n_input_dims];
+
+    // how many times we can move the kernel from it's initial position, based
+    // on the stride
+    int64_t strided_kernel_positions;
+    if (ceil_mode == 1) {
+      strided_kernel_positions = (int64_t)(std::ceil(
+          (effective_input_size - effective_kernel_shape[i]) /
+          float(strides[i])));
+      // 最后一个窗口不能从右侧padding开始
+      if (strided_kernel_positions * strides[i] >= input_size + pads[i]) {
+        strided_kernel_positions--;
+      }
+    } else {
+      strided_kernel_positions =
+          (effective_input_size - effective_kernel_shape[i]) / strides[i];
+    }
+
+    // add in the initial position
+    output_shape[spatial_offset + i] = 1 + strided_kernel_positions;
+    if (output_shape[spatial_offset + i] <= 0) {
+      NNDEPLOY_LOGE("pool output size is not positive.\n");
+      return base::kStatusCodeErrorInvalidParam;
+    }
+  }
+
+  return base::kStatusCodeOk;
+}
+
+base::Status getPool2dParam(const std::vector<int> &kernel_shape,
+                            const std::vector<int> &strides,
+                            const std::vector<int> &pads,
+                            const std::vector<int> &dilations,
+                            bool count_include_pad, Pool2dParam &param) {
+  int n = static_cast<int>(kernel_shape.size());
+  if (n != 1 && n != 2) {
+    NNDEPLOY_LOGE("only 1D and 2D pooling are supported.\n");
+    return base::kStatusCodeErrorNotSupport;
+  }
+  if (static_cast<int>(strides.size()) != n ||
+      static_cast<int>(dilations.size()) != n ||
+      static_cast<int>(pads.size()) != 2 * n) {
+    NNDEPLOY_LOGE("pool param is invalid.\n");
+    return base::kStatusCodeErrorInvalidParam;
+  }
+  param = Pool2dParam();
+  int h = n - 2;  // 1D时为-1
+  int w = n - 1;
+  param.kernel_w_ = kernel_shape[w];
+  param.stride_w_ = strides[w];
+  param.dilation_w_ = dilations[w];
+  param.pads_[1] = pads[w];
+  param.pads_[3] = pads[w + n];
+  if (h >= 0) {
+    param.kernel_h_ = kernel_shape[h];
+    param.stride_h_ = strides[h];
+    param.dilation_h_ = dilations[h];
+    param.pads_[0] = pads[h];
+    param.pads_[2] = pads[h + n];
+  }
+  param.count_include_pad_ = count_include_pad;
+  if (param.kernel_h_ <= 0 || param.kernel_w_ <= 0 || param.stride_h_ <= 0 ||
+      param.stride_w_ <= 0 || param.dilation_h_ <= 0 ||
+      param.dilation_w_ <= 0) {
+    NNDEPLOY_LOGE("pool param is invalid.\n");
+    return base::kStatusCodeErrorInvalidParam;
+  }
+  return base::kStatusCodeOk;
+}
+
+/**
+ * @brief 单个空间轴上每个输出位置的窗口
+ * # 窗口第一个元素的输入坐标为start_[o]，有效的核下标为[begin_[o], end_[o])
+ * # count_[o]为AveragePool在该轴上的除数
+ * # [interior_begin_, interior_end_)内的窗口完全落在输入内
+ */
+struct PoolAxisTable {
+  std::vector<int> start_;
+  std::vector<int> begin_;
+  std::vector<int> end_;
+  std::vector<int> count_;
+  int interior_begin_ = 0;
+  int interior_end_ = 0;
+};
+
+// 满足lo <= start + i * dilation <= hi的i的范围[begin, end)，且0 <= i < kernel
+static void getPoolTapRange(int start, int kernel, int dilation, int lo,
+                            int hi, int &begin, int &end) {
+  begin = start >= lo ? 0 : (lo - start + dilation - 1) / dilation;
+  end = start > hi ? 0 : std::min(kernel, (hi - start) / dilation + 1);
+  if (end < begin) {
+    end = begin;
+  }
+}
+
+static void buildPoolAxisTable(int input_size, int output_size, int kernel,
+                               int stride, int dilation, int pad_begin,
+                               int pad_end, bool count_include_pad,
+                               PoolAxisTable &table) {
+  table.start_.resize(output_size);
+  table.begin_.resize(output_size);
+  table.end_.resize(output_size);
+  table.count_.resize(output_size);
+  table.interior_begin_ = output_size;
+  table.interior_end_ = output_size;
+  for (int o = 0; o < output_size; ++o) {
+    int start = o * stride - pad_begin;
+    int begin = 0;
+    int end = 0;
+    getPoolTapRange(start, kernel, dilation, 0, input_size - 1, begin, end);
+    table.start_[o] = start;
+    table.begin_[o] = begin;
+    table.end_[o] = end;
+    if (count_include_pad) {
+      int pad_begin_tap = 0;
+      int pad_end_tap = 0;
+      getPoolTapRange(start, kernel, dilation, -pad_begin,
+                      input_size + pad_end - 1, pad_begin_tap, pad_end_tap);
+      table.count_[o] = pad_end_tap - pad_begin_tap;
+    } else {
+      table.count_[o] = end - begin;
+    }
+    bool is_interior = begin == 0 && end == kernel;
+    if (is_interior && table.interior_begin_ == output_size) {
+      table.interior_begin_ = o;
+    }
+    if (is_interior) {
+      table.interior_end_ = o + 1;
+    }
+  }
+  if (table.interior_begin_ == output_size) {
+    table.interior_begin_ = 0;
+    table.interior_end_ = 0;
+  }
+}
+
+struct PoolMaxFunc {
+  static inline float init() { return -std::numeric_limits<float>::max(); }
+  static inline float apply(float a, float b) { return a < b ? b : a; }
+};
+
+struct PoolAverageFunc {
+  static inline float init() { return 0.0f; }
+  static inline float apply(float a, float b) { return a + b; }
+};
+
+// y[k] = apply(y[k], x[k * stride])
+template <typename Func>
+static inline void poolRow(float *y, const float *x, int n, int stride) {
+  if (stride == 1) {
+    for (int k = 0; k < n; ++k) {
+      y[k] = Func::apply(y[k], x[k]);
+    }
+  } else if (stride == 2) {
+    for (int k = 0; k < n; ++k) {
+      y[k] = Func::apply(y[k], x[2 * k]);
+    }
+  } else {
+    for (int k = 0; k < n; ++k) {
+      y[k] = Func::apply(y[k], x[k * stride]);
+    }
+  }
+}
+
+static inline float getPoolScale(int count) {
+  return count > 0 ? 1.0f / count : 0.0f;
+}
+
+/**
+ * @brief NCHW，每个task处理一个[H, W]平面
+ */
+template <typename Func, bool kIsAverage>
+class PoolNchwLoopBody : public thread_pool::ParallelLoopBody {
+ public:
+  PoolNchwLoopBody(const float *input, float *output, int input_h,
+                   int input_w, int output_h, int output_w,
+                   const Pool2dParam &param, const PoolAxisTable &table_h,
+                   const PoolAxisTable &table_w)
+      : input_(input),
+        output_(output),
+        input_h_(input_h),
+        input_w_(input_w),
+        output_h_(output_h),
+        output_w_(output_w),
+        param_(param),
+        table_h_(table_h),
+        table_w_(table_w) {}
+
+  virtual void operator()(const base::Range &range) const {
+    size_t input_plane = (size_t)input_h_ * input_w_;
+    size_t output_plane = (size_t)output_h_ * output_w_;
+    for (int plane = range.start_; plane < range.end_; ++plane) {
+      const float *src = input_ + plane * input_plane;
+      float *dst = output_ + plane * output_plane;
+      for (int oh = 0; oh < output_h_; ++oh) {
+        poolOutputRow(src, dst + (size_t)oh * output_w_, oh);
+      }
+    }
+  }
+
+ private:
+  void poolOutputRow(const float *src, float *dst, int oh) const {
+    const int dilation_h = param_.dilation_h_;
+    const int dilation_w = param_.dilation_w_;
+    const int kernel_w = param_.kernel_w_;
+    const int stride_w = param_.stride_w_;
+    const int h_start = table_h_.start_[oh];
+    const int h_begin = table_h_.begin_[oh];
+    const int h_end = table_h_.end_[oh];
+
+    // 宽度方向的内部区域：所有核列都有效，沿输出宽度向量化
+    const int interior_begin = table_w_.interior_begin_;
+    const int interior_end = table_w_.interior_end_;
+    const int interior_size = interior_end - interior_begin;
+    if (interior_size > 0) {
+      float *y = dst + interior_begin;
+      if (h_begin == h_end) {
+        std::fill(y, y + interior_size, Func::init());
+      } else {
+        const float *x = src + table_w_.start_[interior_begin];
+        std::fill(y, y + interior_size, Func::init());
+        for (int i = h_begin; i < h_end; ++i) {
+          const float *row =
+              x + (size_t)(h_start + i * dilation_h) * input_w_;
+          for (int j = 0; j < kernel_w; ++j) {
+            poolRow<Func>(y, row + j * dilation_w, interior_size, stride_w);
+          }
+        }
+      }
+      if (kIsAverage) {
+        float scale = getPoolScale(table_h_.count_[oh] *
+                                   table_w_.count_[interior_begin]);
+        for (int k = 0; k < interior_size; ++k) {
+          y[k] *= scale;
+        }
+      }
+    }
+
+    // 宽度方向的边界区域，逐个窗口计算
+    for (int ow = 0; ow < output_w_; ++ow) {
+      if (ow == interior_begin && interior_size > 0) {
+        ow = interior_end - 1;
+        continue;
+      }
+      const int w_start = table_w_.start_[ow];
+      const int w_begin = table_w_.begin_[ow];
+      const int w_end = table_w_.end_[ow];
+      float acc = Func::init();
+      for (int i = h_begin; i < h_end; ++i) {
+        const float *row = src + (size_t)(h_start + i * dilation_h) * input_w_;
+        for (int j = w_begin; j < w_end; ++j) {
+          acc = Func::apply(acc, row[w_start + j * dilation_w]);
+        }
+      }
+      if (kIsAverage) {
+        acc *= getPoolScale(table_h_.count_[oh] * table_w_.count_[ow]);
+      }
+      dst[ow] = acc;
+    }
+  }
+
+ private:
+  const float *input_;
+  float *output_;
+  int input_h_;
+  int input_w_;
+  int output_h_;
+  int output_w_;
+  const Pool2dParam &param_;
+  const PoolAxisTable &table_h_;
+  const PoolAxisTable &table_w_;
+};
+
+/**
+ * @brief NHWC，每个task处理一行输出[OW, C]，沿通道向量化
+ */
+template <typename Func, bool kIsAverage>
+class PoolNhwcLoopBody : public thread_pool::ParallelLoopBody {
+ public:
+  PoolNhwcLoopBody(const float *input, float *output, int channel,
+                   int input_h, int input_w, int output_h, int output_w,
+                   const Pool2dParam &param, const PoolAxisTable &table_h,
+                   const PoolAxisTable &table_w)
+      : input_(input),
+        output_(output),
+        channel_(channel),
+        input_h_(input_h),
+        input_w_(input_w),
+        output_h_(output_h),
+        output_w_(output_w),
+        param_(param),
+        table_h_(table_h),
+        table_w_(table_w) {}
+
+  // range为[0, N * OH)
+  virtual void operator()(const base::Range &range) const {
+    const int channel = channel_;
+    for (int task = range.start_; task < range.end_; ++task) {
+      int n = task / output_h_;
+      int oh = task % output_h_;
+      const float *src = input_ + (size_t)n * input_h_ * input_w_ * channel;
+      float *dst = output_ + (size_t)task * output_w_ * channel;
+      const int h_start = table_h_.start_[oh];
+      const int h_begin = table_h_.begin_[oh];
+      const int h_end = table_h_.end_[oh];
+      for (int ow = 0; ow < output_w_; ++ow) {
+        const int w_start = table_w_.start_[ow];
+        const int w_begin = table_w_.begin_[ow];
+        const int w_end = table_w_.end_[ow];
+        float *y = dst + (size_t)ow * channel;
+        std::fill(y, y + channel, Func::init());
+        for (int i = h_begin; i < h_end; ++i) {
+          int ih = h_start + i * param_.dilation_h_;
+          for (int j = w_begin; j < w_end; ++j) {
+            int iw = w_start + j * param_.dilation_w_;
+            poolRow<Func>(y, src + ((size_t)ih * input_w_ + iw) * channel,
+                          channel, 1);
+          }
+        }
+        if (kIsAverage) {
+          float scale =
+              getPoolScale(table_h_.count_[oh] * table_w_.count_[ow]);
+          for (int c = 0; c < channel; ++c) {
+            y[c] *= scale;
+          }
+        }
+      }
+    }
+  }
+
+ private:
+  const float *input_;
+  float *output_;
+  int channel_;
+  int input_h_;
+  int input_w_;
+  int output_h_;
+  int output_w_;
+  const Pool2dParam &param_;
+  const PoolAxisTable &table_h_;
+  const PoolAxisTable &table_w_;
+};
+
+template <typename Func, bool kIsAverage>
+static void pool2dImpl(bool is_nhwc, const float *input, float *output,
+                       int batch, int channel, int input_h, int input_w,
+                       int output_h, int output_w, const Pool2dParam &param,
+                       const PoolAxisTable &table_h,
+                       const PoolAxisTable &table_w, uint64_t cost) {
+  if (is_nhwc) {
+    PoolNhwcLoopBody<Func, kIsAverage> body(input, output, channel, input_h,
+                                            input_w, output_h, output_w,
+                                            param, table_h, table_w);
+    base::Range range(0, batch * output_h);
+    thread_pool::parallelForWithCost(range, body, cost);
+  } else {
+    PoolNchwLoopBody<Func, kIsAverage> body(input, output, input_h, input_w,
+                                            output_h, output_w, param,
+                                            table_h, table_w);
+    base::Range range(0, batch * channel);
+    thread_pool::parallelForWithCost(range, body, cost);
+  }
+}
+
+base::Status pool2d(ir::OpType pool_type, device::Tensor *input,
+                    const Pool2dParam &param, device::Tensor *output,
+                    uint64_t cost) {
+  if (pool_type != ir::kOpTypeMaxPool && pool_type != ir::kOpTypeAveragePool) {
+    NNDEPLOY_LOGE("pool type[%s] is not supported.\n",
+                  ir::opTypeToString(pool_type).c_str());
+    return base::kStatusCodeErrorNotSupport;
+  }
+  if (input->getDataType() != base::dataTypeOf<float>()) {
+    NNDEPLOY_LOGE("pool2d only support float.\n");
+    return base::kStatusCodeErrorNotSupport;
+  }
+  const base::IntVector &input_shape = input->getShape();
+  const base::IntVector &output_shape = output->getShape();
+  if ((input_shape.size() != 3 && input_shape.size() != 4) ||
+      input_shape.size() != output_shape.size()) {
+    NNDEPLOY_LOGE("pool2d only support 3D or 4D input.\n");
+    return base::kStatusCodeErrorNotSupport;
+  }
+  bool is_nhwc = input->getDataFormat() == base::kDataFormatNHWC &&
+                 input_shape.size() == 4;
+  // 通道分块格式的每个块为[H, W, block]，
+  // 视为batch为N * CB、通道为block的NHWC计算
+  int block = base::getChannelBlock(input->getDataFormat());
+  if (block > 1 && input_shape.size() != 4) {
+    NNDEPLOY_LOGE("pool2d only support 4D blocked input.\n");
+    return base::kStatusCodeErrorNotSupport;
+  }
+  int batch = input_shape[0];
+  int channel = 0;
+  int input_h = 1;
+  int input_w = 0;
+  int output_h = 1;
+  int output_w = 0;
+  if (is_nhwc) {
+    input_h = input_shape[1];
+    input_w = input_shape[2];
+    channel = input_shape[3];
+    output_h = output_shape[1];
+    output_w = output_shape[2];
+  } else if (input_shape.size() == 4) {
+    channel = input_shape[1];
+    input_h = input_shape[2];
+    input_w = input_shape[3];
+    output_h = output_shape[2];
+    output_w = output_shape[3];
+    if (block > 1) {
+      batch *= (channel + block - 1) / block;
+      channel = block;
+      is_nhwc = true;
+    }
+  } else {
+    channel = input_shape[1];
+    input_w = input_shape[2];
+    output_w = output_shape[2];
+  }
+
+  PoolAxisTable table_h;
+  PoolAxisTable table_w;
+  buildPoolAxisTable(input_h, output_h, param.kernel_h_, param.stride_h_,
+                     param.dilation_h_, param.pads_[0], param.pads_[2],
+                     param.count_include_pad_, table_h);
+  buildPoolAxisTable(input_w, output_w, param.kernel_w_, param.stride_w_,
+                     param.dilation_w_, param.pads_[1], param.pads_[3],
+                     param.count_include_pad_, table_w);
+
+  const float *input_data = static_cast<const float *>(input->getData());
+  float *output_data = static_cast<float *>(output->getData());
+  if (pool_type == ir::kOpTypeMaxPool) {
+    pool2dImpl<PoolMaxFunc, false>(is_nhwc, input_data, output_data, batch,
+                                   channel, input_h, input_w, output_h,
+                                   output_w, param, table_h, table_w, cost);
+  } else {
+    pool2dImpl<PoolAverageFunc, true>(is_nhwc, input_data, output_data, batch,
+                                      channel, input_h, input_w, output_h,
+                                      output_w, param, table_h, table_w,
+                                      cost);
+  }
+  return base::kStatusCodeOk;
+}
+
+}  // namespace op
+}  // namespace nndeploy
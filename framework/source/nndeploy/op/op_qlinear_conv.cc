@@ -0,0 +1,401 @@
+#include "nndeploy/op/op_qlinear_conv.h"
+
+#include "nndeploy/base/any.h"
+#include "nndeploy/base/common.h"
+#include "nndeploy/base/glic_stl_include.h"
+#include "nndeploy/base/log.h"
+#include "nndeploy/base/macro.h"
+#include "nndeploy/base/object.h"
+#include "nndeploy/base/param.h"
+#include "nndeploy/base/status.h"
+#include "nndeploy/base/string.h"
+#include "nndeploy/base/time_profiler.h"
+#include "nndeploy/device/buffer.h"
+#include "nndeploy/device/device.h"
+#include "nndeploy/device/memory_pool.h"
+#include "nndeploy/device/tensor.h"
+#include "nndeploy/ir/ir.h"
+#include "nndeploy/op/igemm.h"
+#include "nndeploy/op/op.h"
+#include "nndeploy/op/op_conv.h"
+#include "nndeploy/thread_pool/parallel.h"
+
+namespace nndeploy {
+namespace op {
+
+static inline uint64_t alignWorkspace(uint64_t size) {
+  return (size + 63) / 64 * 64;
+}
+
+// 读取int8/uint8张量的第index个值
+static int getQuantValue(device::Tensor *tensor, int index) {
+  if (tensor->getDataType().code_ == base::kDataTypeCodeUint) {
+    return static_cast<uint8_t *>(tensor->getData())[index];
+  }
+  return static_cast<int8_t *>(tensor->getData())[index];
+}
+
+/**
+ * @brief uint8的im2col，按像素连续存放，只处理[oy_begin, oy_end)行
+ * # data_col[oy * output_w + ox][(c * kernel_h + i) * kernel_w + j]，
+ *   每个像素占ldk个字节
+ * # 越界位置填充零点，int8的输入异或0x80转为uint8
+ */
+static void im2colPixel(const uint8_t *data_im, int channels, int height,
+                        int width, int kernel_h, int kernel_w, int pad_h,
+                        int pad_w, int stride_h, int stride_w, int dilation_h,
+                        int dilation_w, int oy_begin, int oy_end,
+                        int output_w, uint8_t xor_mask, uint8_t pad_value,
+                        int ldk, uint8_t *data_col) {
+  const int k = channels * kernel_h * kernel_w;
+  for (int oy = oy_begin; oy < oy_end; ++oy) {
+    for (int ox = 0; ox < output_w; ++ox) {
+      uint8_t *dst = data_col + ((size_t)oy * output_w + ox) * ldk;
+      for (int c = 0; c < channels; ++c) {
+        const uint8_t *im = data_im + (size_t)c * height * width;
+        for (int i = 0; i < kernel_h; ++i) {
+          int iy = oy * stride_h - pad_h + i * dilation_h;
+          bool is_row_valid = iy >= 0 && iy < height;
+          for (int j = 0; j < kernel_w; ++j) {
+            int ix = ox * stride_w - pad_w + j * dilation_w;
+            *dst++ = is_row_valid && ix >= 0 && ix < width
+                         ? im[iy * width + ix] ^ xor_mask
+                         : pad_value;
+          }
+        }
+      }
+      for (int i = k; i < ldk; ++i) {
+        *dst++ = 0;
+      }
+    }
+  }
+}
+
+// im2colPixel按输出行切分
+class Im2colPixelLoopBody : public thread_pool::ParallelLoopBody {
+ public:
+  Im2colPixelLoopBody(const uint8_t *data_im, int channels, int height,
+                      int width, int kernel_h, int kernel_w, int pad_h,
+                      int pad_w, int stride_h, int stride_w, int dilation_h,
+                      int dilation_w, int output_w, uint8_t xor_mask,
+                      uint8_t pad_value, int ldk, uint8_t *data_col)
+      : data_im_(data_im),
+        channels_(channels),
+        height_(height),
+        width_(width),
+        kernel_h_(kernel_h),
+        kernel_w_(kernel_w),
+        pad_h_(pad_h),
+        pad_w_(pad_w),
+        stride_h_(stride_h),
+        stride_w_(stride_w),
+        dilation_h_(dilation_h),
+        dilation_w_(dilation_w),
+        output_w_(output_w),
+        xor_mask_(xor_mask),
+        pad_value_(pad_value),
+        ldk_(ldk),
+        data_col_(data_col) {}
+
+  virtual void operator()(const base::Range &range) const {
+    im2colPixel(data_im_, channels_, height_, width_, kernel_h_, kernel_w_,
+                pad_h_, pad_w_, stride_h_, stride_w_, dilation_h_, dilation_w_,
+                range.start_, range.end_, output_w_, xor_mask_, pad_value_,
+                ldk_, data_col_);
+  }
+
+ private:
+  const uint8_t *data_im_;
+  int channels_;
+  int height_;
+  int width_;
+  int kernel_h_;
+  int kernel_w_;
+  int pad_h_;
+  int pad_w_;
+  int stride_h_;
+  int stride_w_;
+  int dilation_h_;
+  int dilation_w_;
+  int output_w_;
+  uint8_t xor_mask_;
+  uint8_t pad_value_;
+  int ldk_;
+  uint8_t *data_col_;
+};
+
+base::Status OpQLinearConv::inferDataType() {
+  outputs_[0]->setDataType(inputs_[7]->getDataType());
+  return base::kStatusCodeOk;
+}
+
+base::Status OpQLinearConv::inferShape() {
+  base::Status status = base::kStatusCodeOk;
+  auto param = dynamic_cast<ir::ConvParam *>(op_desc_.op_param_.get());
+  NNDEPLOY_CHECK_PARAM_NULL_RET_STATUS(param, "op_desc_.op_param_ is nullptr");
+  if (inputs_.size() < 8) {
+    NNDEPLOY_LOGE("QLinearConv requires at least 8 inputs.\n");
+    return base::kStatusCodeErrorInvalidParam;
+  }
+  base::IntVector output_shape;
+  status = inferConvShape(param, inputs_[0]->getShape(),
+                          inputs_[3]->getShape(), output_shape);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "inferConvShape failed");
+  outputs_[0]->reshape(output_shape);
+  return status;
+}
+
+base::Status OpQLinearConv::init() {
+  base::Status status = Op::init();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "Op::init failed");
+  if (inputs_.size() < 8 || !isInputWeight(3) ||
+      inputs_[3]->getData() == nullptr || inputs_[3]->getShape().size() != 4) {
+    return status;
+  }
+  return packWeight();
+}
+
+base::Status OpQLinearConv::packWeight() {
+  auto param = dynamic_cast<ir::ConvParam *>(op_desc_.op_param_.get());
+  NNDEPLOY_CHECK_PARAM_NULL_RET_STATUS(param, "op_desc_.op_param_ is nullptr");
+  device::Tensor *weight = inputs_[3];
+  device::Tensor *zero_point = inputs_[5];
+  base::IntVector weight_shape = weight->getShape();
+  int group = param->group_;
+  if (group <= 0 || weight_shape[0] % group != 0) {
+    NNDEPLOY_LOGE("QLinearConv group[%d] is invalid.\n", group);
+    return base::kStatusCodeErrorInvalidParam;
+  }
+  if (!isIGemmDataType(weight->getDataType()) ||
+      zero_point->getDataType() != weight->getDataType()) {
+    NNDEPLOY_LOGE("QLinearConv w and w_zero_point must be int8/uint8.\n");
+    return base::kStatusCodeErrorInvalidParam;
+  }
+  int zero_point_num = static_cast<int>(zero_point->getSize());
+  int output_c = weight_shape[0];
+  if (zero_point_num != 1 && zero_point_num != output_c) {
+    NNDEPLOY_LOGE("w_zero_point must be a scalar or [%d].\n", output_c);
+    return base::kStatusCodeErrorInvalidParam;
+  }
+
+  int m = output_c / group;
+  int k = weight_shape[1] * weight_shape[2] * weight_shape[3];
+  size_t group_size = alignWorkspace(igemmPackedBSize(m, k));
+  int size = static_cast<int>(group_size * group);
+  if (packed_w_ == nullptr || packed_w_->getShape()[0] != size) {
+    if (packed_w_ != nullptr) {
+      delete packed_w_;
+    }
+    device::TensorDesc desc(base::dataTypeOf<uint8_t>(), base::kDataFormatN,
+                            {size});
+    device::Device *device = device::getDevice(device_type_);
+    packed_w_ = new device::Tensor(device, desc, op_desc_.name_ + ".packed_w");
+  }
+  uint8_t *dst = static_cast<uint8_t *>(packed_w_->getData());
+  for (int g = 0; g < group; ++g) {
+    IGemmWeight igemm_weight;
+    igemm_weight.data_type_ = weight->getDataType();
+    igemm_weight.n_ = m;
+    igemm_weight.k_ = k;
+    igemm_weight.data_ = static_cast<uint8_t *>(weight->getData()) +
+                         (size_t)g * m * k;
+    igemm_weight.stride_n_ = k;
+    igemm_weight.stride_k_ = 1;
+    igemm_weight.zero_point_num_ = zero_point_num == 1 ? 1 : m;
+    igemm_weight.zero_points_ =
+        static_cast<uint8_t *>(zero_point->getData()) +
+        (zero_point_num == 1 ? 0 : g * m);
+    base::Status status = igemmPackB(igemm_weight, dst + g * group_size);
+    NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "igemmPackB failed");
+  }
+  return base::kStatusCodeOk;
+}
+
+base::Status OpQLinearConv::deinit() {
+  if (packed_w_ != nullptr) {
+    delete packed_w_;
+    packed_w_ = nullptr;
+  }
+  return Op::deinit();
+}
+
+uint64_t OpQLinearConv::getFlops() {
+  base::IntVector weight_shape = inputs_[3]->getShape();
+  return base::shapeCount(outputs_[0]->getShape(), 0, -1) *
+         base::shapeCount(weight_shape, 1, -1);
+}
+
+base::Status OpQLinearConv::run() {
+  base::Status status = base::kStatusCodeOk;
+  auto param = dynamic_cast<ir::ConvParam *>(op_desc_.op_param_.get());
+  NNDEPLOY_CHECK_PARAM_NULL_RET_STATUS(param, "op_desc_.op_param_ is nullptr");
+  device::Tensor *input_tensor = inputs_[0];
+  device::Tensor *weight_tensor = inputs_[3];
+  device::Tensor *bias_tensor = inputs_.size() > 8 ? inputs_[8] : nullptr;
+  device::Tensor *output_tensor = outputs_[0];
+  auto input_shape = input_tensor->getShape();
+  auto weight_shape = weight_tensor->getShape();
+  auto output_shape = output_tensor->getShape();
+  if (input_shape.size() != 4 || weight_shape.size() != 4 ||
+      output_shape.size() != 4) {
+    NNDEPLOY_LOGE("QLinearConv only support 2D conv.\n");
+    return base::kStatusCodeErrorNotImplement;
+  }
+  int group = param->group_;
+  if (group <= 0 || input_shape[1] != weight_shape[1] * group) {
+    NNDEPLOY_LOGE("QLinearConv group[%d] is invalid.\n", group);
+    return base::kStatusCodeErrorInvalidParam;
+  }
+  base::DataType x_type = input_tensor->getDataType();
+  if (!isIGemmDataType(x_type) || inputs_[2]->getDataType() != x_type ||
+      !isIGemmDataType(output_tensor->getDataType())) {
+    NNDEPLOY_LOGE("QLinearConv x and y must be int8/uint8.\n");
+    return base::kStatusCodeErrorInvalidParam;
+  }
+  if (bias_tensor != nullptr &&
+      bias_tensor->getDataType() != base::dataTypeOf<int32_t>()) {
+    NNDEPLOY_LOGE("QLinearConv B must be int32.\n");
+    return base::kStatusCodeErrorInvalidParam;
+  }
+  if (packed_w_ == nullptr || !isInputWeight(3)) {
+    status = packWeight();
+    NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "packWeight failed");
+  }
+
+  int batch = input_shape[0];
+  int input_c = input_shape[1];
+  int input_h = input_shape[2];
+  int input_w = input_shape[3];
+  int output_c = output_shape[1];
+  int output_h = output_shape[2];
+  int output_w = output_shape[3];
+  int kernel_h = weight_shape[2];
+  int kernel_w = weight_shape[3];
+  int group_input_c = input_c / group;
+  int m = output_c / group;
+  int k = group_input_c * kernel_h * kernel_w;
+  int kp = igemmPaddedK(k);
+  int n = output_h * output_w;
+
+  // 每个输出通道的反量化系数 x_scale * w_scale
+  int w_scale_num = static_cast<int>(inputs_[4]->getSize() / sizeof(float));
+  if (w_scale_num != 1 && w_scale_num != output_c) {
+    NNDEPLOY_LOGE("w_scale must be a scalar or [%d].\n", output_c);
+    return base::kStatusCodeErrorInvalidParam;
+  }
+  uint64_t col_size = alignWorkspace((uint64_t)n * kp);
+  uint64_t scales_size = alignWorkspace(sizeof(float) * output_c);
+  status = updateWorkspaceSize(col_size + scales_size +
+                               igemmWorkspaceSize(n, m));
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk,
+                         "updateWorkspaceSize failed");
+  status = allocateWorkspace();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk,
+                         "allocateWorkspace failed");
+  uint8_t *data_col = static_cast<uint8_t *>(workspace_);
+  float *scales = reinterpret_cast<float *>(data_col + col_size);
+  void *igemm_workspace = data_col + col_size + scales_size;
+  const float x_scale = static_cast<float *>(inputs_[1]->getData())[0];
+  const float *w_scale = static_cast<float *>(inputs_[4]->getData());
+  for (int c = 0; c < output_c; ++c) {
+    scales[c] = x_scale * w_scale[w_scale_num == 1 ? 0 : c];
+  }
+
+  // int8的输入转为uint8，零点同时加128
+  const bool is_int8_x = x_type.code_ == base::kDataTypeCodeInt;
+  const uint8_t xor_mask = is_int8_x ? 0x80 : 0;
+  const int x_zero_point = getQuantValue(inputs_[2], 0) + (is_int8_x ? 128 : 0);
+
+  IGemmOutput output;
+  output.scales_ = scales;
+  output.activate_op_ = param->activate_op_;
+  output.y_scale_ = static_cast<float *>(inputs_[6]->getData())[0];
+  output.y_zero_point_ = getQuantValue(inputs_[7], 0);
+  output.y_data_type_ = output_tensor->getDataType();
+  output.stride_m_ = 1;
+  output.stride_n_ = n;
+
+  const uint8_t *input_data = static_cast<uint8_t *>(input_tensor->getData());
+  uint8_t *output_data = static_cast<uint8_t *>(output_tensor->getData());
+  const int32_t *bias_data =
+      bias_tensor ? static_cast<int32_t *>(bias_tensor->getData()) : nullptr;
+  const uint8_t *packed_w = static_cast<uint8_t *>(packed_w_->getData());
+  size_t packed_group_size = alignWorkspace(igemmPackedBSize(m, k));
+  // im2col的计算量按一次igemm的比例估计
+  uint64_t im2col_cost = getFlops() / ((uint64_t)batch * group);
+  for (int b = 0; b < batch; ++b) {
+    for (int g = 0; g < group; ++g) {
+      const uint8_t *im =
+          input_data + ((size_t)b * input_c + g * group_input_c) * input_h *
+                           input_w;
+      Im2colPixelLoopBody im2col_body(
+          im, group_input_c, input_h, input_w, kernel_h, kernel_w,
+          param->pads_[0], param->pads_[1], param->strides_[0],
+          param->strides_[1], param->dilations_[0], param->dilations_[1],
+          output_w, xor_mask, static_cast<uint8_t>(x_zero_point), kp,
+          data_col);
+      thread_pool::parallelForWithCost(base::Range(0, output_h), im2col_body,
+                                       im2col_cost);
+      // 输出按NCHW存放，第p个像素的第c个通道在c * n + p
+      output.scales_ = scales + g * m;
+      output.bias_ = bias_data != nullptr ? bias_data + g * m : nullptr;
+      output.y_ = output_data + ((size_t)b * output_c + g * m) * n;
+      status = igemm(n, m, k, data_col, kp, x_zero_point,
+                     packed_w + g * packed_group_size, output,
+                     igemm_workspace);
+      NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "igemm failed");
+    }
+  }
+  return status;
+}
+
+base::Status qlinearConv(device::Tensor *x, device::Tensor *x_scale,
+                         device::Tensor *x_zero_point, device::Tensor *w,
+                         device::Tensor *w_scale, device::Tensor *w_zero_point,
+                         device::Tensor *y_scale, device::Tensor *y_zero_point,
+                         device::Tensor *b,
+                         std::shared_ptr<ir::ConvParam> param,
+                         device::Tensor *y) {
+  base::Status status = base::kStatusCodeOk;
+
+  Op *op = createOp(x->getDeviceType(), "", ir::kOpTypeQLinearConv);
+  if (op == nullptr) {
+    NNDEPLOY_LOGE("createOp failed");
+    return base::kStatusCodeErrorNotImplement;
+  }
+  status = op->setParam(param);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setParam failed");
+  std::vector<device::Tensor *> inputs = {x,       x_scale, x_zero_point,
+                                          w,       w_scale, w_zero_point,
+                                          y_scale, y_zero_point};
+  if (b != nullptr) {
+    inputs.push_back(b);
+  }
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    status = op->setInput(inputs[i], i);
+    NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setInput failed");
+  }
+  status = op->setOutput(y, 0);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setOutput failed");
+  status = op->init();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "init failed");
+  status = op->preRun();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "preRun failed");
+  status = op->checkOrAllocOutput();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk,
+                         "checkOrAllocOutput failed");
+  status = op->run();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "run failed");
+  status = op->postRun();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "postRun failed");
+  status = op->deinit();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "deinit failed");
+  delete op;
+  return status;
+}
+
+REGISTER_OP_IMPLEMENTION(kDeviceTypeCodeCpu, ir::kOpTypeQLinearConv,
+                         OpQLinearConv)
+
+}  // namespace op
+}  // namespace nndeploy
@@ -0,0 +1,297 @@
+#include "nndeploy/op/op_qlinear_mat_mul.h"
+
+#include "nndeploy/base/any.h"
+#include "nndeploy/base/common.h"
+#include "nndeploy/base/glic_stl_include.h"
+#include "nndeploy/base/log.h"
+#include "nndeploy/base/macro.h"
+#include "nndeploy/base/object.h"
+#include "nndeploy/base/param.h"
+#include "nndeploy/base/shape.h"
+#include "nndeploy/base/status.h"
+#include "nndeploy/base/string.h"
+#include "nndeploy/base/time_profiler.h"
+#include "nndeploy/device/buffer.h"
+#include "nndeploy/device/device.h"
+#include "nndeploy/device/memory_pool.h"
+#include "nndeploy/device/tensor.h"
+#include "nndeploy/ir/ir.h"
+#include "nndeploy/op/igemm.h"
+#include "nndeploy/op/op.h"
+#include "nndeploy/op/util.h"
+#include "nndeploy/thread_pool/parallel.h"
+
+namespace nndeploy {
+namespace op {
+
+static inline uint64_t alignWorkspace(uint64_t size) {
+  return (size + 63) / 64 * 64;
+}
+
+// 读取int8/uint8张量的第index个值
+static int getQuantValue(device::Tensor *tensor, int index) {
+  if (tensor->getDataType().code_ == base::kDataTypeCodeUint) {
+    return static_cast<uint8_t *>(tensor->getData())[index];
+  }
+  return static_cast<int8_t *>(tensor->getData())[index];
+}
+
+// 将a的每行拷贝为kp字节的uint8，按行切分
+class CopyALoopBody : public thread_pool::ParallelLoopBody {
+ public:
+  CopyALoopBody(const uint8_t *a, int k, int kp, uint8_t xor_mask,
+                uint8_t *dst)
+      : a_(a), k_(k), kp_(kp), xor_mask_(xor_mask), dst_(dst) {}
+
+  virtual void operator()(const base::Range &range) const {
+    for (int i = range.start_; i < range.end_; ++i) {
+      const uint8_t *src = a_ + (size_t)i * k_;
+      uint8_t *dst = dst_ + (size_t)i * kp_;
+      for (int j = 0; j < k_; ++j) {
+        dst[j] = src[j] ^ xor_mask_;
+      }
+      for (int j = k_; j < kp_; ++j) {
+        dst[j] = 0;
+      }
+    }
+  }
+
+ private:
+  const uint8_t *a_;
+  int k_;
+  int kp_;
+  uint8_t xor_mask_;
+  uint8_t *dst_;
+};
+
+base::Status OpQLinearMatMul::inferDataType() {
+  outputs_[0]->setDataType(inputs_[7]->getDataType());
+  return base::kStatusCodeOk;
+}
+
+base::Status OpQLinearMatMul::inferShape() {
+  if (inputs_.size() < 8) {
+    NNDEPLOY_LOGE("QLinearMatMul requires 8 inputs.\n");
+    return base::kStatusCodeErrorInvalidParam;
+  }
+  base::IntVector shape_a = inputs_[0]->getShape();
+  base::IntVector shape_b = inputs_[3]->getShape();
+  int rank_a = static_cast<int>(shape_a.size());
+  int rank_b = static_cast<int>(shape_b.size());
+  if (rank_a < 2 || (rank_b != 2 && rank_b != rank_a) ||
+      shape_a[rank_a - 1] != shape_b[rank_b - 2]) {
+    NNDEPLOY_LOGE("QLinearMatMul a and b shape mismatch.\n");
+    return base::kStatusCodeErrorInvalidParam;
+  }
+  if (rank_b == rank_a &&
+      !base::shapeEqual(shape_a, shape_b, 0, rank_a - 2)) {
+    NNDEPLOY_LOGE("QLinearMatMul batched b must match the batch of a.\n");
+    return base::kStatusCodeErrorNotImplement;
+  }
+  base::IntVector output_shape = shape_a;
+  output_shape[rank_a - 1] = shape_b[rank_b - 1];
+  outputs_[0]->reshape(output_shape);
+  return base::kStatusCodeOk;
+}
+
+base::Status OpQLinearMatMul::init() {
+  base::Status status = Op::init();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "Op::init failed");
+  if (inputs_.size() < 8 || !isInputWeight(3) ||
+      inputs_[3]->getData() == nullptr || inputs_[3]->getShape().size() != 2) {
+    return status;
+  }
+  return packB();
+}
+
+base::Status OpQLinearMatMul::packB() {
+  device::Tensor *input_b = inputs_[3];
+  device::Tensor *zero_point = inputs_[5];
+  if (!isIGemmDataType(input_b->getDataType()) ||
+      zero_point->getDataType() != input_b->getDataType()) {
+    NNDEPLOY_LOGE("QLinearMatMul b and b_zero_point must be int8/uint8.\n");
+    return base::kStatusCodeErrorInvalidParam;
+  }
+  base::IntVector shape_b = input_b->getShape();
+  int rank = static_cast<int>(shape_b.size());
+  int k = shape_b[rank - 2];
+  int n = shape_b[rank - 1];
+  int batch = multiplyDims(shape_b, 0, rank - 2);
+  int zero_point_num = static_cast<int>(zero_point->getSize());
+  if (zero_point_num != 1 && zero_point_num != n) {
+    NNDEPLOY_LOGE("b_zero_point must be a scalar or [%d].\n", n);
+    return base::kStatusCodeErrorInvalidParam;
+  }
+
+  size_t batch_size = alignWorkspace(igemmPackedBSize(n, k));
+  int size = static_cast<int>(batch_size * batch);
+  if (packed_b_ == nullptr || packed_b_->getShape()[0] != size) {
+    if (packed_b_ != nullptr) {
+      delete packed_b_;
+    }
+    device::TensorDesc desc(base::dataTypeOf<uint8_t>(), base::kDataFormatN,
+                            {size});
+    device::Device *device = device::getDevice(device_type_);
+    packed_b_ = new device::Tensor(device, desc, op_desc_.name_ + ".packed_b");
+  }
+  uint8_t *dst = static_cast<uint8_t *>(packed_b_->getData());
+  for (int i = 0; i < batch; ++i) {
+    // b为[K, N]，按[N, K]的视图打包
+    IGemmWeight weight;
+    weight.data_type_ = input_b->getDataType();
+    weight.n_ = n;
+    weight.k_ = k;
+    weight.data_ = static_cast<uint8_t *>(input_b->getData()) +
+                   (size_t)i * k * n;
+    weight.stride_n_ = 1;
+    weight.stride_k_ = n;
+    weight.zero_points_ = zero_point->getData();
+    weight.zero_point_num_ = zero_point_num;
+    base::Status status = igemmPackB(weight, dst + i * batch_size);
+    NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "igemmPackB failed");
+  }
+  return base::kStatusCodeOk;
+}
+
+base::Status OpQLinearMatMul::deinit() {
+  if (packed_b_ != nullptr) {
+    delete packed_b_;
+    packed_b_ = nullptr;
+  }
+  return Op::deinit();
+}
+
+uint64_t OpQLinearMatMul::getFlops() {
+  base::IntVector shape_a = inputs_[0]->getShape();
+  return base::shapeCount(outputs_[0]->getShape(), 0, -1) * shape_a.back();
+}
+
+base::Status OpQLinearMatMul::run() {
+  base::Status status = base::kStatusCodeOk;
+  device::Tensor *input_a = inputs_[0];
+  device::Tensor *output_tensor = outputs_[0];
+  base::DataType a_type = input_a->getDataType();
+  if (!isIGemmDataType(a_type) || inputs_[2]->getDataType() != a_type ||
+      !isIGemmDataType(output_tensor->getDataType())) {
+    NNDEPLOY_LOGE("QLinearMatMul a and y must be int8/uint8.\n");
+    return base::kStatusCodeErrorInvalidParam;
+  }
+  if (packed_b_ == nullptr || !isInputWeight(3)) {
+    status = packB();
+    NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "packB failed");
+  }
+
+  base::IntVector shape_a = input_a->getShape();
+  base::IntVector shape_b = inputs_[3]->getShape();
+  int rank_a = static_cast<int>(shape_a.size());
+  int rank_b = static_cast<int>(shape_b.size());
+  int m = shape_a[rank_a - 2];
+  int k = shape_a[rank_a - 1];
+  int n = shape_b[rank_b - 1];
+  int batch = multiplyDims(shape_a, 0, rank_a - 2);
+  int kp = igemmPaddedK(k);
+
+  int b_scale_num = static_cast<int>(inputs_[4]->getSize() / sizeof(float));
+  if (b_scale_num != 1 && b_scale_num != n) {
+    NNDEPLOY_LOGE("b_scale must be a scalar or [%d].\n", n);
+    return base::kStatusCodeErrorInvalidParam;
+  }
+
+  // int8的a或k不是4的倍数时，a拷贝为每行kp字节的uint8
+  const bool is_int8_a = a_type.code_ == base::kDataTypeCodeInt;
+  const bool is_copy_a = is_int8_a || kp != k;
+  uint64_t a_size =
+      is_copy_a ? alignWorkspace((uint64_t)batch * m * kp) : 0;
+  uint64_t scales_size = alignWorkspace(sizeof(float) * n);
+  status = updateWorkspaceSize(a_size + scales_size + igemmWorkspaceSize(m, n));
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk,
+                         "updateWorkspaceSize failed");
+  status = allocateWorkspace();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk,
+                         "allocateWorkspace failed");
+  uint8_t *ws = static_cast<uint8_t *>(workspace_);
+  float *scales = reinterpret_cast<float *>(ws + a_size);
+  void *igemm_workspace = ws + a_size + scales_size;
+
+  const uint8_t *a = static_cast<uint8_t *>(input_a->getData());
+  const int a_zero_point =
+      getQuantValue(inputs_[2], 0) + (is_int8_a ? 128 : 0);
+  if (is_copy_a) {
+    const uint8_t xor_mask = is_int8_a ? 0x80 : 0;
+    CopyALoopBody body(a, k, kp, xor_mask, ws);
+    // 拷贝的元素数为batch * m * k，即乘加次数除以n
+    thread_pool::parallelForWithCost(base::Range(0, batch * m), body,
+                                     getFlops() / std::max(n, 1));
+    a = ws;
+  }
+  const float a_scale = static_cast<float *>(inputs_[1]->getData())[0];
+  const float *b_scale = static_cast<float *>(inputs_[4]->getData());
+  for (int j = 0; j < n; ++j) {
+    scales[j] = a_scale * b_scale[b_scale_num == 1 ? 0 : j];
+  }
+
+  IGemmOutput output;
+  output.scales_ = scales;
+  output.y_scale_ = static_cast<float *>(inputs_[6]->getData())[0];
+  output.y_zero_point_ = getQuantValue(inputs_[7], 0);
+  output.y_data_type_ = output_tensor->getDataType();
+  output.stride_m_ = n;
+  output.stride_n_ = 1;
+  const uint8_t *packed_b = static_cast<uint8_t *>(packed_b_->getData());
+  size_t packed_batch_size = alignWorkspace(igemmPackedBSize(n, k));
+  uint8_t *output_data = static_cast<uint8_t *>(output_tensor->getData());
+  for (int i = 0; i < batch; ++i) {
+    output.y_ = output_data + (size_t)i * m * n;
+    const uint8_t *b = packed_b + (rank_b == 2 ? 0 : i * packed_batch_size);
+    status = igemm(m, n, k, a + (size_t)i * m * (is_copy_a ? kp : k),
+                   is_copy_a ? kp : k, a_zero_point, b, output,
+                   igemm_workspace);
+    NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "igemm failed");
+  }
+  return status;
+}
+
+base::Status qlinearMatmul(device::Tensor *a, device::Tensor *a_scale,
+                           device::Tensor *a_zero_point, device::Tensor *b,
+                           device::Tensor *b_scale,
+                           device::Tensor *b_zero_point,
+                           device::Tensor *y_scale,
+                           device::Tensor *y_zero_point, device::Tensor *y) {
+  base::Status status = base::kStatusCodeOk;
+
+  Op *op = createOp(a->getDeviceType(), "", ir::kOpTypeQLinearMatMul);
+  if (op == nullptr) {
+    NNDEPLOY_LOGE("createOp failed");
+    return base::kStatusCodeErrorNotImplement;
+  }
+  std::vector<device::Tensor *> inputs = {a,       a_scale,      a_zero_point,
+                                          b,       b_scale,      b_zero_point,
+                                          y_scale, y_zero_point};
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    status = op->setInput(inputs[i], i);
+    NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setInput failed");
+  }
+  status = op->setOutput(y, 0);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setOutput failed");
+  status = op->init();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "init failed");
+  status = op->preRun();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "preRun failed");
+  status = op->checkOrAllocOutput();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk,
+                         "checkOrAllocOutput failed");
+  status = op->run();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "run failed");
+  status = op->postRun();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "postRun failed");
+  status = op->deinit();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "deinit failed");
+  delete op;
+  return status;
+}
+
+REGISTER_OP_IMPLEMENTION(kDeviceTypeCodeCpu, ir::kOpTypeQLinearMatMul,
+                         OpQLinearMatMul)
+
+}  // namespace op
+}  // namespace nndeploy
@@ -0,0 +1,218 @@
+#include "nndeploy/op/op_quantize_linear.h"
+
+#include "nndeploy/base/any.h"
+#include "nndeploy/base/common.h"
+#include "nndeploy/base/glic_stl_include.h"
+#include "nndeploy/base/log.h"
+#include "nndeploy/base/macro.h"
+#include "nndeploy/base/object.h"
+#include "nndeploy/base/param.h"
+#include "nndeploy/base/status.h"
+#include "nndeploy/base/string.h"
+#include "nndeploy/base/time_profiler.h"
+#include "nndeploy/device/buffer.h"
+#include "nndeploy/device/device.h"
+#include "nndeploy/device/memory_pool.h"
+#include "nndeploy/device/tensor.h"
+#include "nndeploy/ir/ir.h"
+#include "nndeploy/op/op.h"
+#include "nndeploy/op/util.h"
+#include "nndeploy/thread_pool/parallel.h"
+
+namespace nndeploy {
+namespace op {
+
+/**
+ * @brief 将输入视为[outer, channel, inner]，scale为标量时channel为1
+ */
+static base::Status getQuantizeLinearBlock(const base::IntVector &shape,
+                                           device::Tensor *scale, int axis,
+                                           int &outer, int &channel,
+                                           int &inner) {
+  int rank = static_cast<int>(shape.size());
+  size_t scale_size = scale->getSize() / sizeof(float);
+  if (scale_size == 1) {
+    outer = 1;
+    channel = 1;
+    inner = multiplyDims(shape, 0, rank);
+    return base::kStatusCodeOk;
+  }
+  adjustNegativeAxes(axis, rank);
+  if (!checkAxesRange(axis, rank) || scale->getShape().size() != 1 ||
+      scale_size != static_cast<size_t>(shape[axis])) {
+    NNDEPLOY_LOGE("scale must be a scalar or a 1-D tensor of input[axis].\n");
+    return base::kStatusCodeErrorInvalidParam;
+  }
+  outer = multiplyDims(shape, 0, axis);
+  channel = shape[axis];
+  inner = multiplyDims(shape, axis + 1, rank);
+  return base::kStatusCodeOk;
+}
+
+// 单个任务的元素数
+static const size_t kQuantizeLinearGrainSize = 16 * 1024;
+
+// 整数类型总是饱和到[q_min, q_max]，round为四舍六入五取偶
+template <typename T>
+class QuantizeLinearLoopBody : public thread_pool::ParallelLoopBody {
+ public:
+  QuantizeLinearLoopBody(const float *x, const float *scale,
+                         const T *zero_point, int channel, int inner,
+                         size_t size, float q_min, float q_max, T *y)
+      : x_(x),
+        scale_(scale),
+        zero_point_(zero_point),
+        channel_(channel),
+        inner_(inner),
+        size_(size),
+        q_min_(q_min),
+        q_max_(q_max),
+        y_(y) {}
+
+  virtual void operator()(const base::Range &range) const {
+    for (int task = range.start_; task < range.end_; ++task) {
+      size_t i = task * kQuantizeLinearGrainSize;
+      size_t end = std::min(i + kQuantizeLinearGrainSize, size_);
+      // 任务可能跨越多行，逐行取该通道的scale与zero_point
+      while (i < end) {
+        size_t row = i / inner_;
+        int c = static_cast<int>(row % channel_);
+        size_t row_end = std::min(end, (row + 1) * inner_);
+        const float s = scale_[c];
+        const float zp = zero_point_ != nullptr ? zero_point_[c] : 0.0f;
+        for (; i < row_end; ++i) {
+          float q = std::nearbyint(x_[i] / s) + zp;
+          y_[i] = static_cast<T>(std::min(std::max(q, q_min_), q_max_));
+        }
+      }
+    }
+  }
+
+ private:
+  const float *x_;
+  const float *scale_;
+  const T *zero_point_;
+  int channel_;
+  size_t inner_;
+  size_t size_;
+  float q_min_;
+  float q_max_;
+  T *y_;
+};
+
+template <typename T>
+static void quantizeLinearImpl(const float *x, const float *scale,
+                               const T *zero_point, int outer, int channel,
+                               int inner, float q_min, float q_max, T *y,
+                               uint64_t cost) {
+  size_t size = (size_t)outer * channel * inner;
+  if (size == 0) {
+    return;
+  }
+  int tasks = static_cast<int>((size + kQuantizeLinearGrainSize - 1) /
+                               kQuantizeLinearGrainSize);
+  QuantizeLinearLoopBody<T> body(x, scale, zero_point, channel, inner, size,
+                                 q_min, q_max, y);
+  thread_pool::parallelForWithCost(base::Range(0, tasks), body, cost);
+}
+
+base::Status OpQuantizeLinear::inferDataType() {
+  if (inputs_.size() > 2) {
+    outputs_[0]->setDataType(inputs_[2]->getDataType());
+  } else {
+    outputs_[0]->setDataType(base::dataTypeOf<uint8_t>());
+  }
+  return base::kStatusCodeOk;
+}
+
+base::Status OpQuantizeLinear::inferShape() {
+  outputs_[0]->reshape(inputs_[0]->getShape());
+  return base::kStatusCodeOk;
+}
+
+base::Status OpQuantizeLinear::run() {
+  base::Status status = base::kStatusCodeOk;
+  auto param =
+      dynamic_cast<ir::QuantizeLinearParam *>(op_desc_.op_param_.get());
+  NNDEPLOY_CHECK_PARAM_NULL_RET_STATUS(param, "op_desc_.op_param_ is nullptr");
+  device::Tensor *input = inputs_[0];
+  device::Tensor *scale = inputs_[1];
+  device::Tensor *zero_point = inputs_.size() > 2 ? inputs_[2] : nullptr;
+  device::Tensor *output = outputs_[0];
+  if (input->getDataType() != base::dataTypeOf<float>() ||
+      scale->getDataType() != base::dataTypeOf<float>()) {
+    NNDEPLOY_LOGE("QuantizeLinear only support float input and scale.\n");
+    return base::kStatusCodeErrorNotImplement;
+  }
+
+  int outer = 0, channel = 0, inner = 0;
+  status = getQuantizeLinearBlock(input->getShape(), scale, param->axis_,
+                                  outer, channel, inner);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk,
+                         "getQuantizeLinearBlock failed");
+  const float *x = static_cast<const float *>(input->getData());
+  const float *s = static_cast<const float *>(scale->getData());
+  const void *zp = zero_point != nullptr ? zero_point->getData() : nullptr;
+  base::DataType data_type = output->getDataType();
+  if (data_type == base::dataTypeOf<uint8_t>()) {
+    quantizeLinearImpl<uint8_t>(x, s, static_cast<const uint8_t *>(zp), outer,
+                                channel, inner, 0.0f, 255.0f,
+                                static_cast<uint8_t *>(output->getData()),
+                                getFlops());
+  } else if (data_type == base::dataTypeOf<int8_t>()) {
+    quantizeLinearImpl<int8_t>(x, s, static_cast<const int8_t *>(zp), outer,
+                               channel, inner, -128.0f, 127.0f,
+                               static_cast<int8_t *>(output->getData()),
+                               getFlops());
+  } else {
+    NNDEPLOY_LOGE("QuantizeLinear only support int8/uint8 output.\n");
+    return base::kStatusCodeErrorNotImplement;
+  }
+  return status;
+}
+
+base::Status quantizeLinear(device::Tensor *input, device::Tensor *scale,
+                            device::Tensor *zero_point,
+                            std::shared_ptr<ir::QuantizeLinearParam> param,
+                            device::Tensor *output) {
+  base::Status status = base::kStatusCodeOk;
+
+  Op *op = createOp(input->getDeviceType(), "", ir::kOpTypeQuantizeLinear);
+  if (op == nullptr) {
+    NNDEPLOY_LOGE("createOp failed");
+    return base::kStatusCodeErrorNotImplement;
+  }
+  status = op->setParam(param);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setParam failed");
+  status = op->setInput(input, 0);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setInput failed");
+  status = op->setInput(scale, 1);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setInput failed");
+  if (zero_point != nullptr) {
+    status = op->setInput(zero_point, 2);
+    NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setInput failed");
+  }
+  status = op->setOutput(output, 0);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setOutput failed");
+  status = op->init();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "init failed");
+  status = op->preRun();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "preRun failed");
+  status = op->checkOrAllocOutput();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk,
+                         "checkOrAllocOutput failed");
+  status = op->run();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "run failed");
+  status = op->postRun();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "postRun failed");
+  status = op->deinit();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "deinit failed");
+  delete op;
+  return status;
+}
+
+REGISTER_OP_IMPLEMENTION(kDeviceTypeCodeCpu, ir::kOpTypeQuantizeLinear,
+                         OpQuantizeLinear)
+
+}  // namespace op
+}  // namespace nndeploy
@@ -0,0 +1,584 @@
+#include "nndeploy/op/op_reduce.h"
+
+#include "nndeploy/base/any.h"
+#include "nndeploy/base/common.h"
+#include "nndeploy/base/glic_stl_include.h"
+#include "nndeploy/base/log.h"
+#include "nndeploy/base/macro.h"
+#include "nndeploy/base/object.h"
+#include "nndeploy/base/param.h"
+#include "nndeploy/base/shape.h"
+#include "nndeploy/base/status.h"
+#include "nndeploy/base/string.h"
+#include "nndeploy/base/time_profiler.h"
+#include "nndeploy/device/buffer.h"
+#include "nndeploy/device/device.h"
+#include "nndeploy/device/memory_pool.h"
+#include "nndeploy/device/tensor.h"
+#include "nndeploy/ir/ir.h"
+#include "nndeploy/op/op.h"
+#include "nndeploy/op/vec_math.h"
+#include "nndeploy/thread_pool/parallel.h"
+
+namespace nndeploy {
+namespace op {
+
+/**
+ * @brief 每一遍[outer, reduce, inner]使用的归约方式
+ * # 多段归约维度时第一遍按算子映射元素(平方、绝对值、exp)，
+ *   之后各遍合并部分结果：SumSquare/AbsSum之后为Sum，其余不变
+ */
+enum ReduceKind : int {
+  kReduceKindSum = 0,
+  kReduceKindSumSquare,
+  kReduceKindAbsSum,
+  kReduceKindMax,
+  kReduceKindMin,
+  kReduceKindProd,
+  kReduceKindLogSumExp,
+};
+
+static base::Status getReduceKind(ir::OpType op_type, ReduceKind &first,
+                                  ReduceKind &rest) {
+  switch (op_type) {
+    case ir::kOpTypeReduceL1:
+      first = kReduceKindAbsSum;
+      rest = kReduceKindSum;
+      break;
+    case ir::kOpTypeReduceL2:
+    case ir::kOpTypeReduceSumSquare:
+      first = kReduceKindSumSquare;
+      rest = kReduceKindSum;
+      break;
+    case ir::kOpTypeReduceLogSum:
+    case ir::kOpTypeReduceMean:
+    case ir::kOpTypeReduceSum:
+      first = rest = kReduceKindSum;
+      break;
+    case ir::kOpTypeReduceLogSumExp:
+      first = rest = kReduceKindLogSumExp;
+      break;
+    case ir::kOpTypeReduceMax:
+      first = rest = kReduceKindMax;
+      break;
+    case ir::kOpTypeReduceMin:
+      first = rest = kReduceKindMin;
+      break;
+    case ir::kOpTypeReduceProd:
+      first = rest = kReduceKindProd;
+      break;
+    default:
+      NNDEPLOY_LOGE("op[%s] is not a reduce op.\n",
+                    ir::opTypeToString(op_type).c_str());
+      return base::kStatusCodeErrorInvalidParam;
+  }
+  return base::kStatusCodeOk;
+}
+
+/**
+ * @brief reduce为0时的结果
+ */
+static float getReduceIdentity(ReduceKind kind) {
+  switch (kind) {
+    case kReduceKindMax:
+    case kReduceKindLogSumExp:
+      return -std::numeric_limits<float>::infinity();
+    case kReduceKindMin:
+      return std::numeric_limits<float>::infinity();
+    case kReduceKindProd:
+      return 1.0f;
+    default:
+      return 0.0f;
+  }
+}
+
+/**
+ * @brief 按维数归一化后的归约轴标记，axes为空且noop_with_empty_axes为1时
+ *        noop为true
+ */
+static base::Status getReduceAxes(Op *op,
+                                  const std::vector<device::Tensor *> &inputs,
+                                  int rank, std::vector<bool> &reduced,
+                                  bool &noop) {
+  auto param = dynamic_cast<ir::ReduceParam *>(op->getParam().get());
+  std::vector<int64_t> axes;
+  if (inputs.size() > 1 && inputs[1] != nullptr &&
+      inputs[1]->getData() != nullptr) {
+    if (inputs[1]->getDataType() == base::dataTypeOf<int32_t>()) {
+      int32_t *data = static_cast<int32_t *>(inputs[1]->getData());
+      axes.assign(data, data + inputs[1]->getSize() / sizeof(int32_t));
+    } else {
+      int64_t *data = static_cast<int64_t *>(inputs[1]->getData());
+      axes.assign(data, data + inputs[1]->getSize() / sizeof(int64_t));
+    }
+  } else if (param != nullptr) {
+    axes.assign(param->axes_.begin(), param->axes_.end());
+  }
+
+  noop = false;
+  reduced.assign(rank, false);
+  if (axes.empty()) {
+    if (param != nullptr && param->noop_with_empty_axes_ != 0) {
+      noop = true;
+    } else {
+      reduced.assign(rank, true);
+    }
+    return base::kStatusCodeOk;
+  }
+  for (auto axis : axes) {
+    if (axis < 0) {
+      axis += rank;
+    }
+    if (axis < 0 || axis >= rank) {
+      NNDEPLOY_LOGE("axis[%d] is out of range.\n", (int)axis);
+      return base::kStatusCodeErrorInvalidParam;
+    }
+    reduced[axis] = true;
+  }
+  return base::kStatusCodeOk;
+}
+
+base::Status OpReduce::inferShape() {
+  base::IntVector input_shape = inputs_[0]->getShape();
+  int rank = static_cast<int>(input_shape.size());
+  std::vector<bool> reduced;
+  bool noop = false;
+  base::Status status = getReduceAxes(this, inputs_, rank, reduced, noop);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "getReduceAxes failed");
+  if (noop) {
+    outputs_[0]->reshape(input_shape);
+    return status;
+  }
+
+  auto param = dynamic_cast<ir::ReduceParam *>(op_desc_.op_param_.get());
+  bool keepdims = param == nullptr || param->keepdims_ != 0;
+  base::IntVector output_shape;
+  for (int i = 0; i < rank; ++i) {
+    if (!reduced[i]) {
+      output_shape.push_back(input_shape[i]);
+    } else if (keepdims) {
+      output_shape.push_back(1);
+    }
+  }
+  // 归约为标量时输出形状为[1]，Tensor不支持空形状
+  if (output_shape.empty()) {
+    output_shape.push_back(1);
+  }
+  outputs_[0]->reshape(output_shape);
+  return status;
+}
+
+// 水平归约时pairwise求和的块长，块内交给vec_math多路累加
+static const size_t kReducePairwiseBlock = 512;
+// 纵向累加时pairwise求和的块行数
+static const size_t kReduceBlockRows = 16;
+// 纵向累加时inner方向的分块宽度，累加器留在L1中
+static const size_t kReduceTile = 512;
+
+template <typename BlockFunc>
+static float pairwiseSum(const float *x, size_t n, BlockFunc func) {
+  if (n <= kReducePairwiseBlock) {
+    return func(x, n);
+  }
+  // 前一半对齐到块长
+  size_t half = (n / 2 + kReducePairwiseBlock - 1) / kReducePairwiseBlock *
+                kReducePairwiseBlock;
+  return pairwiseSum(x, half, func) + pairwiseSum(x + half, n - half, func);
+}
+
+/**
+ * @brief 连续的n个元素归约为一个值
+ */
+static float reduceContiguous(ReduceKind kind, const float *x, size_t n) {
+  switch (kind) {
+    case kReduceKindSum:
+      return pairwiseSum(x, n, vecSum);
+    case kReduceKindSumSquare:
+      return pairwiseSum(x, n, vecSquareSum);
+    case kReduceKindAbsSum:
+      return pairwiseSum(x, n, vecAbsSum);
+    case kReduceKindMax:
+      return vecMax(x, n);
+    case kReduceKindMin:
+      return vecMin(x, n);
+    case kReduceKindProd: {
+      float p = 1.0f;
+      for (size_t i = 0; i < n; ++i) {
+        p *= x[i];
+      }
+      return p;
+    }
+    case kReduceKindLogSumExp: {
+      float m = vecMax(x, n);
+      if (!std::isfinite(m)) {
+        return m;
+      }
+      float buffer[kReducePairwiseBlock];
+      float s = pairwiseSum(x, n, [m, &buffer](const float *block,
+                                               size_t size) {
+        return vecExpSum(block, m, buffer, size);
+      });
+      return m + std::log(s);
+    }
+    default:
+      return 0.0f;
+  }
+}
+
+/**
+ * @brief acc = map(x)，LogSumExp的映射为exp(x - m)
+ */
+static void reduceRowInit(ReduceKind kind, const float *x, size_t w,
+                          const float *m, float *acc) {
+  switch (kind) {
+    case kReduceKindSumSquare:
+      for (size_t i = 0; i < w; ++i) {
+        acc[i] = x[i] * x[i];
+      }
+      break;
+    case kReduceKindAbsSum:
+      for (size_t i = 0; i < w; ++i) {
+        acc[i] = std::fabs(x[i]);
+      }
+      break;
+    case kReduceKindLogSumExp:
+      for (size_t i = 0; i < w; ++i) {
+        acc[i] = x[i] - m[i];
+      }
+      vecExp(acc, acc, w);
+      break;
+    default:
+      memcpy(acc, x, w * sizeof(float));
+      break;
+  }
+}
+
+/**
+ * @brief acc = acc op map(x)，逐元素运算，循环可由编译器直接向量化
+ */
+static void reduceRowAccumulate(ReduceKind kind, const float *x, size_t w,
+                                const float *m, float *acc, float *scratch) {
+  switch (kind) {
+    case kReduceKindSum:
+      vecAxpy(1.0f, x, acc, w);
+      break;
+    case kReduceKindSumSquare:
+      for (size_t i = 0; i < w; ++i) {
+        acc[i] += x[i] * x[i];
+      }
+      break;
+    case kReduceKindAbsSum:
+      for (size_t i = 0; i < w; ++i) {
+        acc[i] += std::fabs(x[i]);
+      }
+      break;
+    case kReduceKindMax:
+      for (size_t i = 0; i < w; ++i) {
+        acc[i] = acc[i] > x[i] ? acc[i] : x[i];
+      }
+      break;
+    case kReduceKindMin:
+      for (size_t i = 0; i < w; ++i) {
+        acc[i] = acc[i] < x[i] ? acc[i] : x[i];
+      }
+      break;
+    case kReduceKindProd:
+      for (size_t i = 0; i < w; ++i) {
+        acc[i] *= x[i];
+      }
+      break;
+    case kReduceKindLogSumExp:
+      reduceRowInit(kind, x, w, m, scratch);
+      vecAxpy(1.0f, scratch, acc, w);
+      break;
+    default:
+      break;
+  }
+}
+
+/**
+ * @brief 将rows行(行距stride)的w个元素纵向归约到acc
+ * # 求和类超过kReduceBlockRows行时两半分别归约后相加(pairwise)，
+ *   tmp为每层递归一行的临时空间
+ */
+static void reduceRows(ReduceKind kind, const float *x, size_t rows,
+                       size_t stride, size_t w, const float *m, float *acc,
+                       float *tmp, float *scratch) {
+  if (rows <= kReduceBlockRows || kind == kReduceKindMax ||
+      kind == kReduceKindMin || kind == kReduceKindProd) {
+    reduceRowInit(kind, x, w, m, acc);
+    for (size_t r = 1; r < rows; ++r) {
+      reduceRowAccumulate(kind, x + r * stride, w, m, acc, scratch);
+    }
+    return;
+  }
+  size_t half = rows / 2;
+  reduceRows(kind, x, half, stride, w, m, acc, tmp + w, scratch);
+  reduceRows(kind, x + half * stride, rows - half, stride, w, m, tmp, tmp + w,
+             scratch);
+  vecAxpy(1.0f, tmp, acc, w);
+}
+
+/**
+ * @brief 一遍[outer, reduce, inner]归约，output为[outer, inner]
+ * # inner为1时每个任务处理一行，做水平归约
+ * # 否则每个任务处理一个outer中宽kReduceTile的一列分块，做纵向累加
+ */
+class ReduceLoopBody : public thread_pool::ParallelLoopBody {
+ public:
+  ReduceLoopBody(ReduceKind kind, const float *input, float *output,
+                 size_t reduce, size_t inner, size_t tiles)
+      : kind_(kind),
+        input_(input),
+        output_(output),
+        reduce_(reduce),
+        inner_(inner),
+        tiles_(tiles) {}
+
+  virtual void operator()(const base::Range &range) const {
+    if (inner_ == 1) {
+      for (int task = range.start_; task < range.end_; ++task) {
+        output_[task] =
+            reduceContiguous(kind_, input_ + task * reduce_, reduce_);
+      }
+      return;
+    }
+
+    // [max, scratch, tmp(每层递归一行)]
+    size_t depth = 1;
+    for (size_t rows = reduce_; rows > kReduceBlockRows; rows -= rows / 2) {
+      ++depth;
+    }
+    std::vector<float> buffer((depth + 2) * kReduceTile);
+    float *m = buffer.data();
+    float *scratch = m + kReduceTile;
+    float *tmp = scratch + kReduceTile;
+    for (int task = range.start_; task < range.end_; ++task) {
+      size_t outer = task / tiles_;
+      size_t begin = (task % tiles_) * kReduceTile;
+      size_t w = std::min(kReduceTile, inner_ - begin);
+      const float *x = input_ + outer * reduce_ * inner_ + begin;
+      float *acc = output_ + outer * inner_ + begin;
+      if (kind_ != kReduceKindLogSumExp) {
+        reduceRows(kind_, x, reduce_, inner_, w, nullptr, acc, tmp, scratch);
+        continue;
+      }
+      // 先求每列的最大值，再累加exp(x - max)
+      reduceRows(kReduceKindMax, x, reduce_, inner_, w, nullptr, acc, tmp,
+                 scratch);
+      for (size_t i = 0; i < w; ++i) {
+        m[i] = std::isfinite(acc[i]) ? acc[i] : 0.0f;
+      }
+      reduceRows(kind_, x, reduce_, inner_, w, m, tmp, tmp + w, scratch);
+      for (size_t i = 0; i < w; ++i) {
+        if (std::isfinite(acc[i])) {
+          acc[i] = m[i] + std::log(tmp[i]);
+        }
+      }
+    }
+  }
+
+ private:
+  ReduceKind kind_;
+  const float *input_;
+  float *output_;
+  size_t reduce_;
+  size_t inner_;
+  size_t tiles_;
+};
+
+static void reduceStage(ReduceKind kind, const float *input, float *output,
+                        size_t outer, size_t reduce, size_t inner,
+                        uint64_t cost) {
+  if (outer == 0 || inner == 0) {
+    return;
+  }
+  if (reduce == 0) {
+    std::fill(output, output + outer * inner, getReduceIdentity(kind));
+    return;
+  }
+  size_t tiles = inner == 1 ? 1 : (inner + kReduceTile - 1) / kReduceTile;
+  size_t tasks = outer * tiles;
+  ReduceLoopBody body(kind, input, output, reduce, inner, tiles);
+  thread_pool::parallelForWithCost(base::Range(0, (int)tasks), body, cost);
+}
+
+uint64_t OpReduce::getFlops() {
+  return base::shapeCount(inputs_[0]->getShape(), 0, -1);
+}
+
+base::Status OpReduce::run() {
+  base::Status status = base::kStatusCodeOk;
+  if (inputs_[0]->getDataType() != base::dataTypeOf<float>()) {
+    NNDEPLOY_LOGE("reduce only support float.\n");
+    return base::kStatusCodeErrorNotSupport;
+  }
+  ReduceKind kind = kReduceKindSum;
+  ReduceKind rest = kReduceKindSum;
+  status = getReduceKind(op_desc_.op_type_, kind, rest);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "getReduceKind failed");
+
+  base::IntVector shape = inputs_[0]->getShape();
+  int rank = static_cast<int>(shape.size());
+  std::vector<bool> reduced;
+  bool noop = false;
+  status = getReduceAxes(this, inputs_, rank, reduced, noop);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "getReduceAxes failed");
+
+  const float *input = static_cast<const float *>(inputs_[0]->getData());
+  float *output = static_cast<float *>(outputs_[0]->getData());
+  if (noop) {
+    if (output != input) {
+      memcpy(output, input, base::shapeCount(shape) * sizeof(float));
+    }
+    return status;
+  }
+
+  // 去掉大小为1的维度，合并相邻的同类维度
+  std::vector<size_t> sizes;
+  std::vector<bool> flags;
+  size_t count = 1;
+  for (int i = 0; i < rank; ++i) {
+    if (reduced[i]) {
+      count *= shape[i];
+    }
+    if (shape[i] == 1) {
+      continue;
+    }
+    if (!flags.empty() && flags.back() == reduced[i]) {
+      sizes.back() *= shape[i];
+    } else {
+      sizes.push_back(shape[i]);
+      flags.push_back(reduced[i]);
+    }
+  }
+  // 没有需要归约的维度时仍做一遍reduce为1的归约，完成元素映射
+  if (std::find(flags.begin(), flags.end(), true) == flags.end()) {
+    sizes.push_back(1);
+    flags.push_back(true);
+  }
+
+  // 从最内侧的一段归约维度开始，每遍去掉一段
+  // 每遍按其读取的元素数占输入的比例分摊计算量
+  uint64_t flops = getFlops();
+  size_t input_count = std::max(base::shapeCount(shape, 0, -1), (size_t)1);
+  std::vector<float> buffer[2];
+  const float *src = input;
+  for (int stage = 0;; ++stage) {
+    int j = static_cast<int>(flags.size()) - 1;
+    while (!flags[j]) {
+      --j;
+    }
+    size_t outer = 1;
+    size_t inner = 1;
+    for (int i = 0; i < j; ++i) {
+      outer *= sizes[i];
+    }
+    for (int i = j + 1; i < static_cast<int>(sizes.size()); ++i) {
+      inner *= sizes[i];
+    }
+    bool last = std::count(flags.begin(), flags.end(), true) == 1;
+    float *dst = output;
+    if (!last) {
+      buffer[stage % 2].resize(outer * inner);
+      dst = buffer[stage % 2].data();
+    }
+    reduceStage(stage == 0 ? kind : rest, src, dst, outer, sizes[j], inner,
+                flops * (outer * sizes[j] * inner) / input_count);
+    if (last) {
+      break;
+    }
+    src = dst;
+    // 去掉第j段，两侧不归约的维度合并
+    if (j > 0 && j + 1 < static_cast<int>(sizes.size())) {
+      sizes[j - 1] *= sizes[j + 1];
+      sizes.erase(sizes.begin() + j, sizes.begin() + j + 2);
+      flags.erase(flags.begin() + j, flags.begin() + j + 2);
+    } else {
+      sizes.erase(sizes.begin() + j);
+      flags.erase(flags.begin() + j);
+    }
+  }
+
+  size_t size = base::shapeCount(outputs_[0]->getShape());
+  switch (op_desc_.op_type_) {
+    case ir::kOpTypeReduceMean: {
+      float scale = 1.0f / static_cast<float>(count);
+      for (size_t i = 0; i < size; ++i) {
+        output[i] *= scale;
+      }
+      break;
+    }
+    case ir::kOpTypeReduceL2:
+      for (size_t i = 0; i < size; ++i) {
+        output[i] = std::sqrt(output[i]);
+      }
+      break;
+    case ir::kOpTypeReduceLogSum:
+      for (size_t i = 0; i < size; ++i) {
+        output[i] = std::log(output[i]);
+      }
+      break;
+    default:
+      break;
+  }
+
+  return status;
+}
+
+base::Status reduce(ir::OpType op_type, device::Tensor *input,
+                    std::shared_ptr<ir::ReduceParam> param,
+                    device::Tensor *output) {
+  base::Status status = base::kStatusCodeOk;
+
+  Op *op = createOp(input->getDeviceType(), "", op_type);
+  if (op == nullptr) {
+    NNDEPLOY_LOGE("createOp failed");
+    return base::kStatusCodeErrorNotImplement;
+  }
+  status = op->setParam(param);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setParam failed");
+  status = op->setInput(input, 0);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setInput failed");
+  status = op->setOutput(output, 0);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setOutput failed");
+  status = op->init();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "init failed");
+  status = op->preRun();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "preRun failed");
+  status = op->checkOrAllocOutput();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk,
+                         "checkOrAllocOutput failed");
+  status = op->run();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "run failed");
+  status = op->postRun();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "postRun failed");
+  status = op->deinit();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "deinit failed");
+
+  delete op;
+
+  return status;
+}
+
+REGISTER_OP_IMPLEMENTION(kDeviceTypeCodeCpu, ir::kOpTypeReduceL1, OpReduceL1)
+REGISTER_OP_IMPLEMENTION(kDeviceTypeCodeCpu, ir::kOpTypeReduceL2, OpReduceL2)
+REGISTER_OP_IMPLEMENTION(kDeviceTypeCodeCpu, ir::kOpTypeReduceLogSum,
+                         OpReduceLogSum)
+REGISTER_OP_IMPLEMENTION(kDeviceTypeCodeCpu, ir::kOpTypeReduceLogSumExp,
+                         OpReduceLogSumExp)
+REGISTER_OP_IMPLEMENTION(kDeviceTypeCodeCpu, ir::kOpTypeReduceMax,
+                         OpReduceMax)
+REGISTER_OP_IMPLEMENTION(kDeviceTypeCodeCpu, ir::kOpTypeReduceMean,
+                         OpReduceMean)
+REGISTER_OP_IMPLEMENTION(kDeviceTypeCodeCpu, ir::kOpTypeReduceMin,
+                         OpReduceMin)
+REGISTER_OP_IMPLEMENTION(kDeviceTypeCodeCpu, ir::kOpTypeReduceProd,
+                         OpReduceProd)
+REGISTER_OP_IMPLEMENTION(kDeviceTypeCodeCpu, ir::kOpTypeReduceSum,
+                         OpReduceSum)
+REGISTER_OP_IMPLEMENTION(kDeviceTypeCodeCpu, ir::kOpTypeReduceSumSquare,
+                         OpReduceSumSquare)
+
+}  // namespace op
+}  // namespace nndeploy
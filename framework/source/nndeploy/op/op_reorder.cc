@@ -0,0 +1,211 @@
+#include "nndeploy/op/op_reorder.h"
+
+#include "nndeploy/base/any.h"
+#include "nndeploy/base/common.h"
+#include "nndeploy/base/glic_stl_include.h"
+#include "nndeploy/base/log.h"
+#include "nndeploy/base/macro.h"
+#include "nndeploy/base/object.h"
+#include "nndeploy/base/param.h"
+#include "nndeploy/base/shape.h"
+#include "nndeploy/base/status.h"
+#include "nndeploy/base/string.h"
+#include "nndeploy/base/time_profiler.h"
+#include "nndeploy/device/buffer.h"
+#include "nndeploy/device/device.h"
+#include "nndeploy/device/memory_pool.h"
+#include "nndeploy/device/tensor.h"
+#include "nndeploy/ir/ir.h"
+#include "nndeploy/op/op.h"
+#include "nndeploy/thread_pool/parallel.h"
+
+namespace nndeploy {
+namespace op {
+
+base::Status OpReorder::inferShape() {
+  base::IntVector input_shape = inputs_[0]->getShape();
+  outputs_[0]->reshape(input_shape);
+  return base::kStatusCodeOk;
+}
+
+base::Status OpReorder::inferDataFormat() {
+  auto param = dynamic_cast<ir::ReorderParam *>(op_desc_.op_param_.get());
+  NNDEPLOY_CHECK_PARAM_NULL_RET_STATUS(param, "op_desc_.op_param_ is nullptr");
+  outputs_[0]->setDataFormat(param->data_format_);
+  return base::kStatusCodeOk;
+}
+
+/**
+ * @brief 单个通道平面在某种数据格式下的位置
+ * # 平面(n, c)的第i个元素位于offset(n, c) + i * step_
+ */
+struct ReorderPlane {
+  int channel_ = 0;
+  int block_ = 1;
+  size_t plane_ = 0;
+
+  size_t offset(int n, int c) const {
+    if (block_ == 1) {
+      return ((size_t)n * channel_ + c) * plane_;
+    }
+    int blocks = (channel_ + block_ - 1) / block_;
+    return (((size_t)n * blocks + c / block_) * plane_) * block_ +
+           c % block_;
+  }
+  size_t step() const { return block_; }
+};
+
+/**
+ * @brief 每个任务拷贝输出的一个通道平面，输出多出的补齐通道写0
+ */
+template <typename T>
+class ReorderLoopBody : public thread_pool::ParallelLoopBody {
+ public:
+  ReorderLoopBody(const T *input, const ReorderPlane &src, T *output,
+                  const ReorderPlane &dst, int channel_aligned)
+      : input_(input),
+        src_(src),
+        output_(output),
+        dst_(dst),
+        channel_aligned_(channel_aligned) {}
+
+  virtual void operator()(const base::Range &range) const {
+    size_t plane = src_.plane_;
+    size_t src_step = src_.step();
+    size_t dst_step = dst_.step();
+    for (int task = range.start_; task < range.end_; ++task) {
+      int n = task / channel_aligned_;
+      int c = task % channel_aligned_;
+      T *y = output_ + dst_.offset(n, c);
+      if (c >= src_.channel_) {
+        for (size_t i = 0; i < plane; ++i) {
+          y[i * dst_step] = T(0);
+        }
+        continue;
+      }
+      const T *x = input_ + src_.offset(n, c);
+      if (src_step == 1 && dst_step == 1) {
+        std::memcpy(y, x, plane * sizeof(T));
+      } else {
+        for (size_t i = 0; i < plane; ++i) {
+          y[i * dst_step] = x[i * src_step];
+        }
+      }
+    }
+  }
+
+ private:
+  const T *input_;
+  ReorderPlane src_;
+  T *output_;
+  ReorderPlane dst_;
+  int channel_aligned_;
+};
+
+template <typename T>
+static void reorderImpl(const void *input, const ReorderPlane &src,
+                        void *output, const ReorderPlane &dst, int batch,
+                        uint64_t cost) {
+  int channel_aligned =
+      (dst.channel_ + dst.block_ - 1) / dst.block_ * dst.block_;
+  ReorderLoopBody<T> body(static_cast<const T *>(input), src,
+                          static_cast<T *>(output), dst, channel_aligned);
+  int tasks = batch * channel_aligned;
+  thread_pool::parallelForWithCost(base::Range(0, tasks), body, cost);
+}
+
+static bool isReorderSupported(base::DataFormat data_format) {
+  return data_format == base::kDataFormatNCHW ||
+         base::getChannelBlock(data_format) > 1;
+}
+
+base::Status OpReorder::run() {
+  device::Tensor *input = inputs_[0];
+  device::Tensor *output = outputs_[0];
+  base::DataFormat src_format = input->getDataFormat();
+  base::DataFormat dst_format = output->getDataFormat();
+  base::IntVector shape = input->getShape();
+  if (shape.size() != 4 || !isReorderSupported(src_format) ||
+      !isReorderSupported(dst_format)) {
+    NNDEPLOY_LOGE("reorder from %s to %s is not supported.\n",
+                  base::dataFormatToString(src_format).c_str(),
+                  base::dataFormatToString(dst_format).c_str());
+    return base::kStatusCodeErrorNotSupport;
+  }
+  if (base::shapeCount(shape) == 0) {
+    return base::kStatusCodeOk;
+  }
+  if (src_format == dst_format) {
+    std::memcpy(output->getData(), input->getData(),
+                base::shapeCountByDataFormat(shape, src_format) *
+                    input->getDataType().size());
+    return base::kStatusCodeOk;
+  }
+
+  ReorderPlane src;
+  src.channel_ = shape[1];
+  src.block_ = base::getChannelBlock(src_format);
+  src.plane_ = (size_t)shape[2] * shape[3];
+  ReorderPlane dst = src;
+  dst.block_ = base::getChannelBlock(dst_format);
+  switch (input->getDataType().size()) {
+    case 4:
+      reorderImpl<uint32_t>(input->getData(), src, output->getData(), dst,
+                            shape[0], getFlops());
+      break;
+    case 2:
+      reorderImpl<uint16_t>(input->getData(), src, output->getData(), dst,
+                            shape[0], getFlops());
+      break;
+    case 1:
+      reorderImpl<uint8_t>(input->getData(), src, output->getData(), dst,
+                           shape[0], getFlops());
+      break;
+    default:
+      NNDEPLOY_LOGE("reorder not support data type[%s].\n",
+                    base::dataTypeToString(input->getDataType()).c_str());
+      return base::kStatusCodeErrorNotSupport;
+  }
+  return base::kStatusCodeOk;
+}
+
+base::Status reorder(device::Tensor *input, base::DataFormat data_format,
+                     device::Tensor *output) {
+  base::Status status = base::kStatusCodeOk;
+
+  Op *op = createOp(input->getDeviceType(), "", ir::kOpTypeReorder);
+  if (op == nullptr) {
+    NNDEPLOY_LOGE("createOp failed");
+    return base::kStatusCodeErrorNotImplement;
+  }
+  auto param = std::make_shared<ir::ReorderParam>();
+  param->data_format_ = data_format;
+  status = op->setParam(param);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setParam failed");
+  status = op->setInput(input, 0);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setInput failed");
+  status = op->setOutput(output, 0);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setOutput failed");
+  status = op->init();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "init failed");
+  status = op->preRun();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "preRun failed");
+  status = op->checkOrAllocOutput();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk,
+                         "checkOrAllocOutput failed");
+  status = op->run();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "run failed");
+  status = op->postRun();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "postRun failed");
+  status = op->deinit();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "deinit failed");
+
+  delete op;
+
+  return status;
+}
+
+REGISTER_OP_IMPLEMENTION(kDeviceTypeCodeCpu, ir::kOpTypeReorder, OpReorder)
+
+}  // namespace op
+}  // namespace nndeploy
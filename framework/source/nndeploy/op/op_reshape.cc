@@ -17,6 +17,7 @@
 #include "nndeploy/device/tensor.h"
 #include "nndeploy/ir/ir.h"
 #include "nndeploy/op/op.h"
+#include "nndeploy/op/util.h"
 
 namespace nndeploy {
 namespace op {
@@ -27,6 +28,15 @@ base::Status OpReshape::inferShape() {
   auto param = dynamic_cast<ir::ReshapeParam *>(op_desc_.op_param_.get());
   NNDEPLOY_CHECK_PARAM_NULL_RET_STATUS(param, "op_desc_.op_param_ is nullptr");
   int allowzero = param->allowzero_;
+  if (inputs_.size() < 2 || inputs_[1] == nullptr ||
+      inputs_[1]->getData() == nullptr) {
+    NNDEPLOY_LOGE("shape is required.\n");
+    return base::kStatusCodeErrorInvalidParam;
+  }
+  if (inputs_[1]->getDataType() != base::dataTypeOf<int64_t>()) {
+    NNDEPLOY_LOGE("shape must be int64.\n");
+    return base::kStatusCodeErrorInvalidParam;
+  }
 
   int target_shape_size = inputs_[1]->getShapeIndex(0);
   int64_t *target_shape_data = (int64_t *)inputs_[1]->getData();
@@ -118,8 +128,28 @@ base::Status OpReshape::inferDataFormat() {
   return status;
 }
 
+bool OpReshape::getOutputView(int index, int &input_index, size_t &offset) {
+  if (index != 0 || !inputs_[0]->isContinue() || inputs_.size() < 2 ||
+      inputs_[1] == nullptr ||
+      inputs_[1]->getDataType() != base::dataTypeOf<int64_t>()) {
+    return false;
+  }
+  input_index = 0;
+  offset = 0;
+  return true;
+}
+
 base::Status OpReshape::run() {
-  NNDEPLOY_LOGI("not implemented.\n");
+  void *input_data = inputs_[0]->getData();
+  void *output_data = outputs_[0]->getData();
+  // 输出为输入的视图时无需拷贝
+  if (input_data == output_data) {
+    return base::kStatusCodeOk;
+  }
+  size_t size = inputs_[0]->getDataType().size() *
+                (size_t)multiplyDims(inputs_[0]->getShape(), 0,
+                                     (int)inputs_[0]->getShape().size());
+  std::memcpy(output_data, input_data, size);
   return base::kStatusCodeOk;
 }
 
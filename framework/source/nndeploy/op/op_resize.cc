@@ -18,6 +18,7 @@
 #include "nndeploy/ir/ir.h"
 #include "nndeploy/op/op.h"
 #include "nndeploy/op/util.h"
+#include "nndeploy/thread_pool/parallel.h"
 
 namespace nndeploy {
 namespace op {
@@ -92,6 +93,27 @@ void resizeShapeInferenceHelper(const base::IntVector& input_shape,
   }
 }
 
+static int getResizeSizesData(device::Tensor* sizes, std::vector<int>& data) {
+  data.clear();
+  if (sizes == nullptr || sizes->getShape().empty() ||
+      sizes->getShape()[0] == 0 || sizes->getData() == nullptr) {
+    return 0;
+  }
+  int size = sizes->getShape()[0];
+  if (sizes->getDataType() == base::dataTypeOf<int64_t>()) {
+    int64_t* ptr = (int64_t*)sizes->getData();
+    for (int i = 0; i < size; ++i) {
+      data.push_back((int)ptr[i]);
+    }
+  } else if (sizes->getDataType() == base::dataTypeOf<int32_t>()) {
+    int32_t* ptr = (int32_t*)sizes->getData();
+    for (int i = 0; i < size; ++i) {
+      data.push_back(ptr[i]);
+    }
+  }
+  return (int)data.size();
+}
+
 base::Status OpResize::inferShape() {
   base::Status status = base::kStatusCodeOk;
   // 参数
@@ -101,45 +123,21 @@ base::Status OpResize::inferShape() {
   const auto& input_shape = inputs_[0]->getShape();
   auto output_shape = input_shape;  // 确定形状
 
-  bool hasScalesInput = inputs_.size() > 2;
-  bool hasSizesInput = inputs_.size() > 3;
-
-  // NNDEPLOY_LOGE("input.size = %lld\n", inputs_.size());
-
-  float* scales =
-      (2 < inputs_.size() ? (float*)inputs_[2]->getData() : nullptr);
-  if (inputs_[2]->getSize() == 0) {
-    scales = nullptr;
-    hasScalesInput = false;
+  // 未提供或为空的scales/sizes视为没有该输入
+  bool hasScalesInput = false;
+  bool hasSizesInput = false;
+  float* scales = nullptr;
+  if (inputs_.size() > 2 && inputs_[2] != nullptr &&
+      inputs_[2]->getSize() > 0) {
+    scales = (float*)inputs_[2]->getData();
+    hasScalesInput = true;
   }
   std::vector<int32_t> sizes_data;
-  if (3 < inputs_.size()) {
-    bool found_sizes = false;
-    const auto sizes_shape = inputs_[3]->getShape();
-    if (sizes_shape.size() > 0) {
-      found_sizes = true;
-    }
-    // If sizes is an empty shape, assume it's not provided
-    if (found_sizes) {
-      if (sizes_shape[0] == 0) {
-        hasSizesInput = false;
-      } else {
-        if (inputs_[3]->getDataType() == base::dataTypeOf<int64_t>()) {
-          int64_t* sizes_shape_data = (int64_t*)inputs_[3]->getData();
-          for (int i = 0; i < sizes_shape[0]; ++i) {
-            sizes_data.push_back((int32_t)sizes_shape_data[i]);
-          }
-        } else if (inputs_[3]->getDataType() == base::dataTypeOf<int32_t>()) {
-          int32_t* sizes_shape_data = (int32_t*)inputs_[3]->getData();
-          for (int i = 0; i < sizes_shape[0]; ++i) {
-            sizes_data.push_back((int32_t)sizes_shape_data[i]);
-          }
-        }
-        output_shape = sizes_data;
-        scales = nullptr;
-        hasScalesInput = false;
-      }
-    }
+  if (inputs_.size() > 3 && getResizeSizesData(inputs_[3], sizes_data) > 0) {
+    hasSizesInput = true;
+    output_shape = sizes_data;
+    scales = nullptr;
+    hasScalesInput = false;
   }
 
   // If scales is an empty constant, assume it's not provided
@@ -271,11 +269,478 @@ base::Status OpResize::inferShape() {
   return status;
 }
 
-base::Status OpResize::run() {
-  NNDEPLOY_LOGI("not implemented.\n");
+base::Status OpResize::getScalesAndRoi(std::vector<float>& scales,
+                                       std::vector<float>& roi) {
+  auto param = dynamic_cast<ir::ResizeParam*>(op_desc_.op_param_.get());
+  NNDEPLOY_CHECK_PARAM_NULL_RET_STATUS(param, "op_desc_.op_param_ is nullptr");
+  const base::IntVector& input_shape = inputs_[0]->getShape();
+  const base::IntVector& output_shape = outputs_[0]->getShape();
+  int rank = (int)input_shape.size();
+  std::vector<int> axes;
+  if (param->axes_ != INT_MAX) {
+    axes.push_back(param->axes_ < 0 ? param->axes_ + rank : param->axes_);
+  } else {
+    for (int i = 0; i < rank; ++i) {
+      axes.push_back(i);
+    }
+  }
+
+  // roi: [start_0, ..., start_n, end_0, ..., end_n]，默认[0, 1]
+  roi.assign(2 * rank, 0.0f);
+  for (int i = 0; i < rank; ++i) {
+    roi[rank + i] = 1.0f;
+  }
+  device::Tensor* roi_tensor = inputs_.size() > 1 ? inputs_[1] : nullptr;
+  if (roi_tensor != nullptr && roi_tensor->getData() != nullptr &&
+      roi_tensor->getDataType() == base::dataTypeOf<float>() &&
+      !roi_tensor->getShape().empty() &&
+      roi_tensor->getShape()[0] == 2 * (int)axes.size()) {
+    const float* roi_data = (const float*)roi_tensor->getData();
+    for (size_t i = 0; i < axes.size(); ++i) {
+      roi[axes[i]] = roi_data[i];
+      roi[rank + axes[i]] = roi_data[axes.size() + i];
+    }
+  }
+
+  scales.assign(rank, 1.0f);
+  std::vector<int> sizes_data;
+  device::Tensor* sizes = inputs_.size() > 3 ? inputs_[3] : nullptr;
+  if (getResizeSizesData(sizes, sizes_data) > 0) {
+    if (sizes_data.size() != axes.size()) {
+      NNDEPLOY_LOGE("size of sizes is not equal to size of axes.\n");
+      return base::kStatusCodeErrorInvalidParam;
+    }
+    // keep_aspect_ratio_policy不是stretch时所有轴使用同一个scale
+    const std::string& policy = param->keep_aspect_ratio_policy_;
+    if (policy == "not_larger" || policy == "not_smaller") {
+      float scale = policy == "not_larger"
+                        ? std::numeric_limits<float>::max()
+                        : std::numeric_limits<float>::lowest();
+      for (size_t i = 0; i < axes.size(); ++i) {
+        float s = sizes_data[i] / static_cast<float>(input_shape[axes[i]]);
+        scale = policy == "not_larger" ? std::min(scale, s)
+                                       : std::max(scale, s);
+      }
+      for (size_t i = 0; i < axes.size(); ++i) {
+        scales[axes[i]] = scale;
+      }
+    } else {
+      for (size_t i = 0; i < axes.size(); ++i) {
+        scales[axes[i]] = output_shape[axes[i]] /
+                          static_cast<float>(input_shape[axes[i]]);
+      }
+    }
+    return base::kStatusCodeOk;
+  }
+
+  device::Tensor* scales_tensor = inputs_.size() > 2 ? inputs_[2] : nullptr;
+  if (scales_tensor == nullptr || scales_tensor->getData() == nullptr ||
+      scales_tensor->getShape().empty() ||
+      scales_tensor->getDataType() != base::dataTypeOf<float>()) {
+    NNDEPLOY_LOGE("Either `sizes` or `scales` must be provided.\n");
+    return base::kStatusCodeErrorInvalidParam;
+  }
+  int scales_size = scales_tensor->getShape()[0];
+  if (scales_size != (int)axes.size()) {
+    NNDEPLOY_LOGE("size of scales is not equal to size of axes.\n");
+    return base::kStatusCodeErrorInvalidParam;
+  }
+  const float* scales_data = (const float*)scales_tensor->getData();
+  for (int i = 0; i < scales_size; ++i) {
+    if (scales_data[i] <= 0.0f) {
+      NNDEPLOY_LOGE("scales must be greater than 0.\n");
+      return base::kStatusCodeErrorInvalidParam;
+    }
+    scales[axes[i]] = scales_data[i];
+  }
   return base::kStatusCodeOk;
 }
 
+/**
+ * @brief 输出坐标x映射到输入坐标，见ONNX Resize的coordinate_transformation_mode
+ */
+static float getResizeOriginCoord(const std::string& mode, float x,
+                                  float scale, int input_size,
+                                  int output_size, float roi_start,
+                                  float roi_end) {
+  if (mode == "half_pixel") {
+    return (x + 0.5f) / scale - 0.5f;
+  } else if (mode == "half_pixel_symmetric") {
+    float adjustment = output_size / (scale * input_size);
+    float center = input_size / 2.0f;
+    float offset = center * (1.0f - adjustment);
+    return offset + (x + 0.5f) / scale - 0.5f;
+  } else if (mode == "pytorch_half_pixel") {
+    return output_size > 1 ? (x + 0.5f) / scale - 0.5f : 0.0f;
+  } else if (mode == "align_corners") {
+    return output_size == 1 ? 0.0f
+                            : x * (input_size - 1) / (float)(output_size - 1);
+  } else if (mode == "asymmetric") {
+    return x / scale;
+  } else if (mode == "tf_crop_and_resize") {
+    if (output_size > 1) {
+      return roi_start * (input_size - 1) +
+             x * (roi_end - roi_start) * (input_size - 1) / (output_size - 1);
+    }
+    return 0.5f * (roi_start + roi_end) * (input_size - 1);
+  }
+  return (x + 0.5f) / scale - 0.5f;
+}
+
+static int getResizeNearestIndex(const std::string& mode, float x) {
+  float fx = std::floor(x);
+  if (mode == "floor") {
+    return (int)fx;
+  } else if (mode == "ceil") {
+    return (int)std::ceil(x);
+  } else if (mode == "round_prefer_ceil") {
+    return x == fx + 0.5f ? (int)fx + 1 : (int)std::round(x);
+  }
+  // round_prefer_floor
+  return x == fx + 0.5f ? (int)fx : (int)std::round(x);
+}
+
+static float getResizeCubicWeight(float x, float a) {
+  x = std::fabs(x);
+  if (x <= 1.0f) {
+    return ((a + 2.0f) * x - (a + 3.0f)) * x * x + 1.0f;
+  } else if (x < 2.0f) {
+    return ((a * x - 5.0f * a) * x + 8.0f * a) * x - 4.0f * a;
+  }
+  return 0.0f;
+}
+
+static base::Status buildResizeAxisTable(const ir::ResizeParam* param,
+                                         int axis, int input_size,
+                                         int output_size, float scale,
+                                         float roi_start, float roi_end,
+                                         ResizeAxisTable& table) {
+  const std::string& mode = param->mode_;
+  const std::string& coord_mode = param->coordinate_transformation_mode_;
+  bool is_nearest = mode == "nearest";
+  bool is_linear = mode == "linear";
+  bool is_cubic = mode == "cubic";
+  if (!is_nearest && !is_linear && !is_cubic) {
+    NNDEPLOY_LOGE("Unknown resize mode: %s.\n", mode.c_str());
+    return base::kStatusCodeErrorInvalidParam;
+  }
+
+  // antialias只在缩小时生效，滤波器的支撑域按1 / scale放大
+  float filter_scale =
+      (param->antialias_ != 0 && scale < 1.0f && !is_nearest) ? scale : 1.0f;
+  int start = 0;
+  if (is_linear) {
+    start = (int)std::floor(-1.0f / filter_scale) + 1;
+  } else if (is_cubic) {
+    start = (int)std::floor(-2.0f / filter_scale) + 1;
+  }
+  int taps = is_nearest ? 1 : 2 - 2 * start;
+
+  table.axis_ = axis;
+  table.input_size_ = input_size;
+  table.output_size_ = output_size;
+  table.taps_ = taps;
+  table.index_.resize((size_t)output_size * taps);
+  table.weight_.resize((size_t)output_size * taps);
+  table.outside_.assign(output_size, 0);
+  bool is_crop = coord_mode == "tf_crop_and_resize";
+  for (int j = 0; j < output_size; ++j) {
+    float x = getResizeOriginCoord(coord_mode, (float)j, scale, input_size,
+                                   output_size, roi_start, roi_end);
+    int* index = table.index_.data() + (size_t)j * taps;
+    float* weight = table.weight_.data() + (size_t)j * taps;
+    if (is_crop && (x < 0.0f || x > input_size - 1)) {
+      table.outside_[j] = 1;
+      std::fill(index, index + taps, 0);
+      std::fill(weight, weight + taps, 0.0f);
+      continue;
+    }
+    if (is_nearest) {
+      int i = getResizeNearestIndex(param->nearest_mode_, x);
+      index[0] = std::min(std::max(i, 0), input_size - 1);
+      weight[0] = 1.0f;
+      continue;
+    }
+    float fx = std::floor(x);
+    float ratio = x - fx;
+    float sum = 0.0f;
+    for (int t = 0; t < taps; ++t) {
+      float offset = (start + t - ratio) * filter_scale;
+      float w = is_linear ? std::max(0.0f, 1.0f - std::fabs(offset))
+                          : getResizeCubicWeight(offset, param->cubic_coeff_a_);
+      int i = (int)fx + start + t;
+      if (i < 0 || i >= input_size) {
+        if (param->exclude_outside_ != 0) {
+          w = 0.0f;
+        }
+        i = std::min(std::max(i, 0), input_size - 1);
+      }
+      index[t] = i;
+      weight[t] = w;
+      sum += w;
+    }
+    if ((filter_scale < 1.0f || param->exclude_outside_ != 0) && sum != 0.0f) {
+      for (int t = 0; t < taps; ++t) {
+        weight[t] /= sum;
+      }
+    }
+  }
+  return base::kStatusCodeOk;
+}
+
+// 每个输出j只取输入j且权重为1时，该轴无需计算
+static bool isResizeAxisIdentity(const ResizeAxisTable& table) {
+  if (table.input_size_ != table.output_size_) {
+    return false;
+  }
+  for (int j = 0; j < table.output_size_; ++j) {
+    if (table.outside_[j]) {
+      return false;
+    }
+    float sum = 0.0f;
+    for (int t = 0; t < table.taps_; ++t) {
+      size_t k = (size_t)j * table.taps_ + t;
+      if (table.index_[k] == j) {
+        sum += table.weight_[k];
+      } else if (table.weight_[k] != 0.0f) {
+        return false;
+      }
+    }
+    if (sum != 1.0f) {
+      return false;
+    }
+  }
+  return true;
+}
+
+base::Status OpResize::updateTables() {
+  base::Status status = base::kStatusCodeOk;
+  auto param = dynamic_cast<ir::ResizeParam*>(op_desc_.op_param_.get());
+  NNDEPLOY_CHECK_PARAM_NULL_RET_STATUS(param, "op_desc_.op_param_ is nullptr");
+  std::vector<float> scales;
+  std::vector<float> roi;
+  status = getScalesAndRoi(scales, roi);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk,
+                         "getScalesAndRoi failed");
+  const base::IntVector& input_shape = inputs_[0]->getShape();
+  const base::IntVector& output_shape = outputs_[0]->getShape();
+  if (input_shape == table_input_shape_ &&
+      output_shape == table_output_shape_ && scales == table_scales_ &&
+      roi == table_roi_) {
+    return status;
+  }
+  if (input_shape.size() != output_shape.size()) {
+    NNDEPLOY_LOGE("rank of input and output is not equal.\n");
+    return base::kStatusCodeErrorInvalidParam;
+  }
+
+  int rank = (int)input_shape.size();
+  tables_.clear();
+  for (int axis = 0; axis < rank; ++axis) {
+    ResizeAxisTable table;
+    status = buildResizeAxisTable(param, axis, input_shape[axis],
+                                  output_shape[axis], scales[axis], roi[axis],
+                                  roi[rank + axis], table);
+    NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk,
+                           "buildResizeAxisTable failed");
+    if (!isResizeAxisIdentity(table)) {
+      tables_.push_back(std::move(table));
+    }
+  }
+  // 先缩小的轴、再放大的轴，中间结果尽量小；同比例时先算靠后的轴
+  std::stable_sort(tables_.begin(), tables_.end(),
+                   [](const ResizeAxisTable& a, const ResizeAxisTable& b) {
+                     float ra = (float)a.output_size_ / a.input_size_;
+                     float rb = (float)b.output_size_ / b.input_size_;
+                     if (ra != rb) {
+                       return ra < rb;
+                     }
+                     return a.axis_ > b.axis_;
+                   });
+
+  table_input_shape_ = input_shape;
+  table_output_shape_ = output_shape;
+  table_scales_ = scales;
+  table_roi_ = roi;
+  return status;
+}
+
+
+/**
+ * @brief 单个轴的插值，张量视为[outer, input_size, inner] -> [outer,
+ * output_size, inner]
+ * # inner为1时逐元素gather
+ * # inner大于1时对连续的inner行做加权求和，内层循环可向量化
+ */
+class ResizeAxisLoopBody : public thread_pool::ParallelLoopBody {
+ public:
+  ResizeAxisLoopBody(const ResizeAxisTable& table, const float* src,
+                     float* dst, size_t inner, float extrapolation_value)
+      : table_(table),
+        src_(src),
+        dst_(dst),
+        inner_(inner),
+        extrapolation_value_(extrapolation_value) {}
+
+  // 每个task处理一个outer
+  virtual void operator()(const base::Range& range) const {
+    for (int outer = range.start_; outer < range.end_; ++outer) {
+      const float* src = src_ + (size_t)outer * table_.input_size_ * inner_;
+      float* dst = dst_ + (size_t)outer * table_.output_size_ * inner_;
+      if (inner_ == 1) {
+        gather(src, dst);
+      } else {
+        combineRows(src, dst);
+      }
+    }
+  }
+
+ private:
+  void gather(const float* src, float* dst) const {
+    int taps = table_.taps_;
+    const int* index = table_.index_.data();
+    const float* weight = table_.weight_.data();
+    int output_size = table_.output_size_;
+    if (taps == 1) {
+      for (int j = 0; j < output_size; ++j) {
+        dst[j] = src[index[j]];
+      }
+    } else if (taps == 2) {
+      for (int j = 0; j < output_size; ++j) {
+        dst[j] = weight[2 * j] * src[index[2 * j]] +
+                 weight[2 * j + 1] * src[index[2 * j + 1]];
+      }
+    } else {
+      for (int j = 0; j < output_size; ++j) {
+        float sum = 0.0f;
+        for (int t = 0; t < taps; ++t) {
+          sum += weight[j * taps + t] * src[index[j * taps + t]];
+        }
+        dst[j] = sum;
+      }
+    }
+    for (int j = 0; j < output_size; ++j) {
+      if (table_.outside_[j]) {
+        dst[j] = extrapolation_value_;
+      }
+    }
+  }
+
+  void combineRows(const float* src, float* dst) const {
+    int taps = table_.taps_;
+    size_t inner = inner_;
+    for (int j = 0; j < table_.output_size_; ++j) {
+      float* out = dst + (size_t)j * inner;
+      if (table_.outside_[j]) {
+        std::fill(out, out + inner, extrapolation_value_);
+        continue;
+      }
+      const int* index = table_.index_.data() + (size_t)j * taps;
+      const float* weight = table_.weight_.data() + (size_t)j * taps;
+      if (taps == 1) {
+        memcpy(out, src + (size_t)index[0] * inner, inner * sizeof(float));
+        continue;
+      }
+      const float* row0 = src + (size_t)index[0] * inner;
+      const float* row1 = src + (size_t)index[1] * inner;
+      const float w0 = weight[0];
+      const float w1 = weight[1];
+      for (size_t k = 0; k < inner; ++k) {
+        out[k] = w0 * row0[k] + w1 * row1[k];
+      }
+      for (int t = 2; t < taps; ++t) {
+        const float* row = src + (size_t)index[t] * inner;
+        const float w = weight[t];
+        for (size_t k = 0; k < inner; ++k) {
+          out[k] += w * row[k];
+        }
+      }
+    }
+  }
+
+ private:
+  const ResizeAxisTable& table_;
+  const float* src_;
+  float* dst_;
+  size_t inner_;
+  float extrapolation_value_;
+};
+
+base::Status OpResize::run() {
+  base::Status status = base::kStatusCodeOk;
+  auto param = dynamic_cast<ir::ResizeParam*>(op_desc_.op_param_.get());
+  NNDEPLOY_CHECK_PARAM_NULL_RET_STATUS(param, "op_desc_.op_param_ is nullptr");
+  device::Tensor* input = inputs_[0];
+  device::Tensor* output = outputs_[0];
+  if (input->getDataType() != base::dataTypeOf<float>()) {
+    NNDEPLOY_LOGE("resize only support float.\n");
+    return base::kStatusCodeErrorNotSupport;
+  }
+
+  status = updateTables();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "updateTables failed");
+
+  const float* input_data = static_cast<float*>(input->getData());
+  float* output_data = static_cast<float*>(output->getData());
+  base::IntVector shape = input->getShape();
+  size_t input_count = std::accumulate(shape.begin(), shape.end(), (size_t)1,
+                                       std::multiplies<size_t>());
+  if (tables_.empty()) {
+    if (output_data != input_data) {
+      memcpy(output_data, input_data, input_count * sizeof(float));
+    }
+    return status;
+  }
+
+  // 中间结果的ping-pong buffer
+  size_t max_count = 0;
+  base::IntVector cur_shape = shape;
+  for (size_t i = 0; i + 1 < tables_.size(); ++i) {
+    cur_shape[tables_[i].axis_] = tables_[i].output_size_;
+    size_t count = std::accumulate(cur_shape.begin(), cur_shape.end(),
+                                   (size_t)1, std::multiplies<size_t>());
+    max_count = std::max(max_count, count);
+  }
+  size_t buffer_size = (max_count * sizeof(float) + 63) / 64 * 64;
+  status = updateWorkspaceSize(tables_.size() > 2 ? 2 * buffer_size
+                                                  : buffer_size);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk,
+                         "updateWorkspaceSize failed");
+  status = allocateWorkspace();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk,
+                         "allocateWorkspace failed");
+  float* buffers[2] = {
+      static_cast<float*>(workspace_),
+      reinterpret_cast<float*>(static_cast<char*>(workspace_) + buffer_size)};
+
+  uint64_t flops = getFlops();
+  size_t output_count = std::max(
+      base::shapeCount(output->getShape(), 0, -1), (size_t)1);
+  const float* src = input_data;
+  cur_shape = shape;
+  for (size_t i = 0; i < tables_.size(); ++i) {
+    const ResizeAxisTable& table = tables_[i];
+    bool is_last = i + 1 == tables_.size();
+    float* dst = is_last ? output_data : buffers[i % 2];
+    int axis = table.axis_;
+    int outer = std::accumulate(cur_shape.begin(), cur_shape.begin() + axis, 1,
+                                std::multiplies<int>());
+    size_t inner =
+        std::accumulate(cur_shape.begin() + axis + 1, cur_shape.end(),
+                        (size_t)1, std::multiplies<size_t>());
+    ResizeAxisLoopBody body(table, src, dst, inner,
+                            param->extrapolation_value_);
+    // 每个轴按其输出元素数占最终输出的比例分摊计算量
+    size_t count = (size_t)outer * table.output_size_ * inner;
+    thread_pool::parallelForWithCost(base::Range(0, outer), body,
+                                     flops * count / output_count);
+    cur_shape[axis] = table.output_size_;
+    src = dst;
+  }
+
+  return status;
+}
+
 base::Status resize(device::Tensor* input, device::Tensor* roi,
                     device::Tensor* scales, device::Tensor* sizes,
                     std::shared_ptr<ir::ResizeParam> param,
@@ -291,11 +756,15 @@ base::Status resize(device::Tensor* input, device::Tensor* roi,
   NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setParam failed");
   status = op->setInput(input, 0);
   NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setInput failed");
-  status = op->setInput(roi, 1);
+  // 未提供的可选输入以空张量占位，保持scales与sizes的输入下标
+  device::Tensor empty_roi("resize.roi");
+  device::Tensor empty_scales("resize.scales");
+  device::Tensor empty_sizes("resize.sizes");
+  status = op->setInput(roi != nullptr ? roi : &empty_roi, 1);
   NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setInput failed");
-  status = op->setInput(scales, 2);
+  status = op->setInput(scales != nullptr ? scales : &empty_scales, 2);
   NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setInput failed");
-  status = op->setInput(sizes, 3);
+  status = op->setInput(sizes != nullptr ? sizes : &empty_sizes, 3);
   NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setInput failed");
   status = op->setOutput(output, 0);
   NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setOutput failed");
@@ -16,19 +16,117 @@
 #include "nndeploy/device/tensor.h"
 #include "nndeploy/ir/ir.h"
 #include "nndeploy/op/op.h"
+#include "nndeploy/op/vec_math.h"
+#include "nndeploy/thread_pool/parallel.h"
 
 namespace nndeploy {
 namespace op {
 
 base::Status OpRMSNorm::inferShape() {
   auto input_shape = inputs_[0]->getShape();
-  outputs_[0]->reshape(input_shape);
+  if (input_shape.empty()) {
+    NNDEPLOY_LOGE("input shape is empty.\n");
+    return base::kStatusCodeErrorInvalidParam;
+  }
+  if (inputs_.size() > 2 && inputs_[2] != nullptr &&
+      !base::shapeEqual(inputs_[2]->getShape(), input_shape, 0, -1)) {
+    NNDEPLOY_LOGE("residual shape must be equal to input shape.\n");
+    return base::kStatusCodeErrorInvalidParam;
+  }
+  for (auto output : outputs_) {
+    output->reshape(input_shape);
+  }
   return base::kStatusCodeOk;
 }
 
+
+/**
+ * @brief 按行划分任务，每行两遍：求平方和(融合残差相加)，再缩放
+ * # 行长为hidden size，通常可以驻留在L1中，第二遍读取不会回到内存
+ */
+class RMSNormLoopBody : public thread_pool::ParallelLoopBody {
+ public:
+  RMSNormLoopBody(const float *input, const float *residual,
+                  const float *weight, float *output, float *residual_output,
+                  int hidden_size, float eps)
+      : input_(input),
+        residual_(residual),
+        weight_(weight),
+        output_(output),
+        residual_output_(residual_output),
+        hidden_size_(hidden_size),
+        eps_(eps) {}
+
+  virtual void operator()(const base::Range &range) const {
+    for (int row = range.start_; row < range.end_; ++row) {
+      size_t offset = (size_t)row * hidden_size_;
+      const float *src = input_ + offset;
+      float *dst = output_ + offset;
+      float square_sum = 0.0f;
+      if (residual_ != nullptr) {
+        // h = input + residual，h先写入residual_output(没有时写入output)
+        float *h = residual_output_ != nullptr ? residual_output_ + offset
+                                               : dst;
+        square_sum = vecAddSquareSum(src, residual_ + offset, h, hidden_size_);
+        src = h;
+      } else {
+        square_sum = vecSquareSum(src, hidden_size_);
+      }
+      float scale = 1.0f / std::sqrt(square_sum / hidden_size_ + eps_);
+      vecScaleMul(src, scale, weight_, dst, hidden_size_);
+    }
+  }
+
+ private:
+  const float *input_;
+  const float *residual_;
+  const float *weight_;
+  float *output_;
+  float *residual_output_;
+  int hidden_size_;
+  float eps_;
+};
+
 base::Status OpRMSNorm::run() {
-  NNDEPLOY_LOGI("not implemented.\n");
-  return base::kStatusCodeOk;
+  base::Status status = base::kStatusCodeOk;
+  if (inputs_[0]->getDataType() != base::dataTypeOf<float>()) {
+    NNDEPLOY_LOGE("rmsnorm only support float.\n");
+    return base::kStatusCodeErrorNotSupport;
+  }
+  auto param = dynamic_cast<ir::RMSNormParam *>(op_desc_.op_param_.get());
+  NNDEPLOY_CHECK_PARAM_NULL_RET_STATUS(param, "op_desc_.op_param_ is nullptr");
+
+  base::IntVector input_shape = inputs_[0]->getShape();
+  int hidden_size = input_shape.back();
+  size_t rows = 1;
+  for (size_t i = 0; i + 1 < input_shape.size(); ++i) {
+    rows *= input_shape[i];
+  }
+  if (inputs_[1]->getSize() < hidden_size * sizeof(float)) {
+    NNDEPLOY_LOGE("weight size must be equal to hidden size[%d].\n",
+                  hidden_size);
+    return base::kStatusCodeErrorInvalidParam;
+  }
+  if (rows == 0 || hidden_size == 0) {
+    return status;
+  }
+
+  const float *residual = nullptr;
+  if (inputs_.size() > 2 && inputs_[2] != nullptr) {
+    residual = static_cast<const float *>(inputs_[2]->getData());
+  }
+  float *residual_output = nullptr;
+  if (outputs_.size() > 1 && outputs_[1] != nullptr) {
+    residual_output = static_cast<float *>(outputs_[1]->getData());
+  }
+  RMSNormLoopBody body(static_cast<const float *>(inputs_[0]->getData()),
+                       residual,
+                       static_cast<const float *>(inputs_[1]->getData()),
+                       static_cast<float *>(outputs_[0]->getData()),
+                       residual_output, hidden_size, param->eps_);
+  thread_pool::parallelForWithCost(base::Range(0, (int)rows), body, getFlops());
+
+  return status;
 }
 
 base::Status rmsNorm(device::Tensor *input1, device::Tensor *input2,
@@ -44,10 +142,55 @@ base::Status rmsNorm(device::Tensor *input1, device::Tensor *input2,
   NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setInput failed");
   status = op->setInput(input2, 1);
   NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setInput failed");
-  status = op->setInput(input3, 2);
+  if (input3 != nullptr) {
+    status = op->setInput(input3, 2);
+    NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setInput failed");
+  }
+  status = op->setOutput(output, 0);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setOutput failed");
+  status = op->init();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "init failed");
+  status = op->preRun();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "preRun failed");
+  status = op->checkOrAllocOutput();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk,
+                         "checkOrAllocOutput failed");
+  status = op->run();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "run failed");
+  status = op->postRun();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "postRun failed");
+  status = op->deinit();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "deinit failed");
+
+  delete op;
+
+  return status;
+}
+
+base::Status fusedAddRmsNorm(device::Tensor *input, device::Tensor *residual,
+                             device::Tensor *weight,
+                             std::shared_ptr<ir::RMSNormParam> param,
+                             device::Tensor *output,
+                             device::Tensor *residual_output) {
+  base::Status status = base::kStatusCodeOk;
+
+  Op *op = createOp(input->getDeviceType(), "", ir::kOpTypeRMSNorm);
+  if (op == nullptr) {
+    NNDEPLOY_LOGE("createOp failed");
+    return base::kStatusCodeErrorNotImplement;
+  }
+  status = op->setParam(param);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setParam failed");
+  status = op->setInput(input, 0);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setInput failed");
+  status = op->setInput(weight, 1);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setInput failed");
+  status = op->setInput(residual, 2);
   NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setInput failed");
   status = op->setOutput(output, 0);
   NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setOutput failed");
+  status = op->setOutput(residual_output, 1);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setOutput failed");
   status = op->init();
   NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "init failed");
   status = op->preRun();
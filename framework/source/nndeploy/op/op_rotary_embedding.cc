@@ -0,0 +1,342 @@
+#include "nndeploy/op/op_rotary_embedding.h"
+
+#include "nndeploy/base/any.h"
+#include "nndeploy/base/common.h"
+#include "nndeploy/base/glic_stl_include.h"
+#include "nndeploy/base/log.h"
+#include "nndeploy/base/macro.h"
+#include "nndeploy/base/object.h"
+#include "nndeploy/base/param.h"
+#include "nndeploy/base/shape.h"
+#include "nndeploy/base/status.h"
+#include "nndeploy/base/string.h"
+#include "nndeploy/base/time_profiler.h"
+#include "nndeploy/device/buffer.h"
+#include "nndeploy/device/device.h"
+#include "nndeploy/device/memory_pool.h"
+#include "nndeploy/device/tensor.h"
+#include "nndeploy/ir/ir.h"
+#include "nndeploy/op/op.h"
+#include "nndeploy/op/vec_math.h"
+#include "nndeploy/thread_pool/parallel.h"
+
+namespace nndeploy {
+namespace op {
+
+struct RotaryDims {
+  bool is_3d_ = false;
+  int batch_ = 0;
+  int num_heads_ = 0;
+  int seq_len_ = 0;
+  int head_size_ = 0;
+  int rotary_dim_ = 0;
+};
+
+static base::Status getRotaryDims(const base::IntVector &shape,
+                                  ir::RotaryEmbeddingParam *param,
+                                  RotaryDims &dims) {
+  if (shape.size() == 4) {
+    dims.is_3d_ = false;
+    dims.batch_ = shape[0];
+    dims.num_heads_ = shape[1];
+    dims.seq_len_ = shape[2];
+    dims.head_size_ = shape[3];
+  } else if (shape.size() == 3) {
+    if (param->num_heads_ <= 0 || shape[2] % param->num_heads_ != 0) {
+      NNDEPLOY_LOGE("num_heads_[%d] is invalid for 3D input.\n",
+                    param->num_heads_);
+      return base::kStatusCodeErrorInvalidParam;
+    }
+    dims.is_3d_ = true;
+    dims.batch_ = shape[0];
+    dims.num_heads_ = param->num_heads_;
+    dims.seq_len_ = shape[1];
+    dims.head_size_ = shape[2] / param->num_heads_;
+  } else {
+    NNDEPLOY_LOGE("rotary embedding input must be 3D or 4D.\n");
+    return base::kStatusCodeErrorInvalidParam;
+  }
+  dims.rotary_dim_ = param->rotary_embedding_dim_ > 0
+                         ? param->rotary_embedding_dim_
+                         : dims.head_size_;
+  if (dims.rotary_dim_ % 2 != 0 || dims.rotary_dim_ > dims.head_size_) {
+    NNDEPLOY_LOGE("rotary_dim[%d] must be even and <= head_size[%d].\n",
+                  dims.rotary_dim_, dims.head_size_);
+    return base::kStatusCodeErrorInvalidParam;
+  }
+  return base::kStatusCodeOk;
+}
+
+/**
+ * @brief 每个token在cos/sin缓存中的行号，同时检查position_ids的范围
+ */
+static base::Status getRotaryCacheRows(const RotaryDims &dims,
+                                       device::Tensor *cache,
+                                       device::Tensor *position_ids,
+                                       std::vector<int> &rows) {
+  base::IntVector cache_shape = cache->getShape();
+  int tokens = dims.batch_ * dims.seq_len_;
+  rows.resize(tokens);
+  if (position_ids != nullptr) {
+    if (cache_shape.size() != 2) {
+      NNDEPLOY_LOGE("cache must be 2D when position_ids is given.\n");
+      return base::kStatusCodeErrorInvalidParam;
+    }
+    base::DataType data_type = position_ids->getDataType();
+    size_t num = position_ids->getSize() / data_type.size();
+    if (num != static_cast<size_t>(tokens)) {
+      NNDEPLOY_LOGE("position_ids must be [batch, seq_len].\n");
+      return base::kStatusCodeErrorInvalidParam;
+    }
+    for (int i = 0; i < tokens; ++i) {
+      int64_t position = 0;
+      if (data_type == base::dataTypeOf<int64_t>()) {
+        position = static_cast<const int64_t *>(position_ids->getData())[i];
+      } else if (data_type == base::dataTypeOf<int32_t>()) {
+        position = static_cast<const int32_t *>(position_ids->getData())[i];
+      } else {
+        NNDEPLOY_LOGE("position_ids only support int64/int32.\n");
+        return base::kStatusCodeErrorNotSupport;
+      }
+      if (position < 0 || position >= cache_shape[0]) {
+        NNDEPLOY_LOGE("position[%ld] is out of cache range[%d].\n",
+                      (long)position, cache_shape[0]);
+        return base::kStatusCodeErrorInvalidParam;
+      }
+      rows[i] = (int)position;
+    }
+  } else if (cache_shape.size() == 3) {
+    if (cache_shape[0] != dims.batch_ || cache_shape[1] != dims.seq_len_) {
+      NNDEPLOY_LOGE("cache must be [batch, seq_len, rotary_dim / 2].\n");
+      return base::kStatusCodeErrorInvalidParam;
+    }
+    for (int i = 0; i < tokens; ++i) {
+      rows[i] = i;
+    }
+  } else if (cache_shape.size() == 2) {
+    if (cache_shape[0] < dims.seq_len_) {
+      NNDEPLOY_LOGE("cache rows[%d] must be >= seq_len[%d].\n",
+                    cache_shape[0], dims.seq_len_);
+      return base::kStatusCodeErrorInvalidParam;
+    }
+    for (int i = 0; i < tokens; ++i) {
+      rows[i] = i % dims.seq_len_;
+    }
+  } else {
+    NNDEPLOY_LOGE("cache must be 2D or 3D.\n");
+    return base::kStatusCodeErrorInvalidParam;
+  }
+  return base::kStatusCodeOk;
+}
+
+base::Status OpRotaryEmbedding::inferShape() {
+  auto param =
+      dynamic_cast<ir::RotaryEmbeddingParam *>(op_desc_.op_param_.get());
+  NNDEPLOY_CHECK_PARAM_NULL_RET_STATUS(param, "op_desc_.op_param_ is nullptr");
+  RotaryDims dims;
+  base::Status status = getRotaryDims(inputs_[0]->getShape(), param, dims);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "getRotaryDims failed");
+  outputs_[0]->reshape(inputs_[0]->getShape());
+  return base::kStatusCodeOk;
+}
+
+
+/**
+ * @brief 按(batch, head, seq)的行划分任务，每行一遍完成旋转
+ * # 4D按[batch, head, seq]的顺序，3D按[batch, seq, head]的顺序遍历，
+ *   均为内存顺序
+ */
+class RotaryEmbeddingLoopBody : public thread_pool::ParallelLoopBody {
+ public:
+  RotaryEmbeddingLoopBody(const float *input, const float *cos_cache,
+                          const float *sin_cache, const int *cache_rows,
+                          float *output, const RotaryDims &dims,
+                          bool interleaved)
+      : input_(input),
+        cos_cache_(cos_cache),
+        sin_cache_(sin_cache),
+        cache_rows_(cache_rows),
+        output_(output),
+        dims_(dims),
+        interleaved_(interleaved) {}
+
+  virtual void operator()(const base::Range &range) const {
+    const int half = dims_.rotary_dim_ / 2;
+    const int rest = dims_.head_size_ - dims_.rotary_dim_;
+    for (int row = range.start_; row < range.end_; ++row) {
+      int batch = 0;
+      int seq = 0;
+      if (dims_.is_3d_) {
+        batch = row / (dims_.seq_len_ * dims_.num_heads_);
+        seq = row / dims_.num_heads_ % dims_.seq_len_;
+      } else {
+        batch = row / (dims_.num_heads_ * dims_.seq_len_);
+        seq = row % dims_.seq_len_;
+      }
+      size_t offset = (size_t)row * dims_.head_size_;
+      size_t cache_offset =
+          (size_t)cache_rows_[batch * dims_.seq_len_ + seq] * half;
+      const float *src = input_ + offset;
+      float *dst = output_ + offset;
+      const float *c = cos_cache_ + cache_offset;
+      const float *s = sin_cache_ + cache_offset;
+      if (interleaved_) {
+        vecRotaryInterleaved(src, c, s, dst, half);
+      } else {
+        vecRotary(src, src + half, c, s, dst, dst + half, half);
+      }
+      if (rest > 0 && dst != src) {
+        memcpy(dst + dims_.rotary_dim_, src + dims_.rotary_dim_,
+               rest * sizeof(float));
+      }
+    }
+  }
+
+ private:
+  const float *input_;
+  const float *cos_cache_;
+  const float *sin_cache_;
+  const int *cache_rows_;
+  float *output_;
+  RotaryDims dims_;
+  bool interleaved_;
+};
+
+base::Status OpRotaryEmbedding::run() {
+  base::Status status = base::kStatusCodeOk;
+  for (int i = 0; i < 3; ++i) {
+    if (inputs_[i]->getDataType() != base::dataTypeOf<float>()) {
+      NNDEPLOY_LOGE("rotary embedding only support float.\n");
+      return base::kStatusCodeErrorNotSupport;
+    }
+  }
+  auto param =
+      dynamic_cast<ir::RotaryEmbeddingParam *>(op_desc_.op_param_.get());
+  NNDEPLOY_CHECK_PARAM_NULL_RET_STATUS(param, "op_desc_.op_param_ is nullptr");
+
+  RotaryDims dims;
+  status = getRotaryDims(inputs_[0]->getShape(), param, dims);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "getRotaryDims failed");
+  base::IntVector cos_shape = inputs_[1]->getShape();
+  if (!base::shapeEqual(cos_shape, inputs_[2]->getShape()) ||
+      cos_shape.empty() || cos_shape.back() != dims.rotary_dim_ / 2) {
+    NNDEPLOY_LOGE("cos/sin cache must be [..., rotary_dim / 2(%d)].\n",
+                  dims.rotary_dim_ / 2);
+    return base::kStatusCodeErrorInvalidParam;
+  }
+  device::Tensor *position_ids = nullptr;
+  if (inputs_.size() > 3 && inputs_[3] != nullptr) {
+    position_ids = inputs_[3];
+  }
+  std::vector<int> cache_rows;
+  status = getRotaryCacheRows(dims, inputs_[1], position_ids, cache_rows);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk,
+                         "getRotaryCacheRows failed");
+
+  int rows = dims.batch_ * dims.num_heads_ * dims.seq_len_;
+  if (rows == 0 || dims.rotary_dim_ == 0) {
+    if (inputs_[0]->getData() != outputs_[0]->getData()) {
+      memcpy(outputs_[0]->getData(), inputs_[0]->getData(),
+             inputs_[0]->getSize());
+    }
+    return status;
+  }
+  RotaryEmbeddingLoopBody body(
+      static_cast<const float *>(inputs_[0]->getData()),
+      static_cast<const float *>(inputs_[1]->getData()),
+      static_cast<const float *>(inputs_[2]->getData()), cache_rows.data(),
+      static_cast<float *>(outputs_[0]->getData()), dims,
+      param->interleaved_);
+  thread_pool::parallelForWithCost(base::Range(0, rows), body, getFlops());
+
+  return status;
+}
+
+base::Status rotaryEmbedding(device::Tensor *input, device::Tensor *cos_cache,
+                             device::Tensor *sin_cache,
+                             device::Tensor *position_ids,
+                             std::shared_ptr<ir::RotaryEmbeddingParam> param,
+                             device::Tensor *output) {
+  base::Status status = base::kStatusCodeOk;
+
+  Op *op = createOp(input->getDeviceType(), "", ir::kOpTypeRotaryEmbedding);
+  if (op == nullptr) {
+    NNDEPLOY_LOGE("createOp failed");
+    return base::kStatusCodeErrorNotImplement;
+  }
+  status = op->setParam(param);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setParam failed");
+  status = op->setInput(input, 0);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setInput failed");
+  status = op->setInput(cos_cache, 1);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setInput failed");
+  status = op->setInput(sin_cache, 2);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setInput failed");
+  if (position_ids != nullptr) {
+    status = op->setInput(position_ids, 3);
+    NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setInput failed");
+  }
+  status = op->setOutput(output, 0);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setOutput failed");
+  status = op->init();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "init failed");
+  status = op->preRun();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "preRun failed");
+  status = op->checkOrAllocOutput();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk,
+                         "checkOrAllocOutput failed");
+  status = op->run();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "run failed");
+  status = op->postRun();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "postRun failed");
+  status = op->deinit();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "deinit failed");
+
+  delete op;
+
+  return status;
+}
+
+base::Status computeRotaryCache(int max_position, int rotary_dim, float theta,
+                                device::Tensor *cos_cache,
+                                device::Tensor *sin_cache) {
+  if (max_position <= 0 || rotary_dim <= 0 || rotary_dim % 2 != 0) {
+    NNDEPLOY_LOGE("max_position[%d] or rotary_dim[%d] is invalid.\n",
+                  max_position, rotary_dim);
+    return base::kStatusCodeErrorInvalidParam;
+  }
+  int half = rotary_dim / 2;
+  base::IntVector shape = {max_position, half};
+  for (auto cache : {cos_cache, sin_cache}) {
+    if (cache->getBuffer() == nullptr) {
+      cache->setDataType(base::dataTypeOf<float>());
+      cache->setDataFormat(base::kDataFormatNC);
+      cache->reshape(shape);
+      cache->allocate(device::getDefaultHostDevice());
+    } else if (cache->getDataType() != base::dataTypeOf<float>() ||
+               !base::shapeEqual(cache->getShape(), shape)) {
+      NNDEPLOY_LOGE("cache must be float [%d, %d].\n", max_position, half);
+      return base::kStatusCodeErrorInvalidParam;
+    }
+  }
+  float *cos_data = static_cast<float *>(cos_cache->getData());
+  float *sin_data = static_cast<float *>(sin_cache->getData());
+  std::vector<double> inv_freq(half);
+  for (int i = 0; i < half; ++i) {
+    inv_freq[i] = std::pow((double)theta, -2.0 * i / rotary_dim);
+  }
+  for (int p = 0; p < max_position; ++p) {
+    for (int i = 0; i < half; ++i) {
+      double angle = p * inv_freq[i];
+      cos_data[(size_t)p * half + i] = (float)std::cos(angle);
+      sin_data[(size_t)p * half + i] = (float)std::sin(angle);
+    }
+  }
+  return base::kStatusCodeOk;
+}
+
+REGISTER_OP_IMPLEMENTION(kDeviceTypeCodeCpu, ir::kOpTypeRotaryEmbedding,
+                         OpRotaryEmbedding)
+
+}  // namespace op
+}  // namespace nndeploy
@@ -21,11 +21,6 @@
 namespace nndeploy {
 namespace op {
 
-base::Status OpSigmoid::run() {
-  NNDEPLOY_LOGI("not implemented.\n");
-  return base::kStatusCodeOk;
-}
-
 base::Status sigmoid(device::Tensor *input, device::Tensor *output) {
   base::Status status = base::kStatusCodeOk;
 
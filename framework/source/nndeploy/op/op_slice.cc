@@ -18,105 +18,280 @@
 #include "nndeploy/ir/ir.h"
 #include "nndeploy/op/op.h"
 #include "nndeploy/op/util.h"
+#include "nndeploy/thread_pool/parallel.h"
 
 namespace nndeploy {
 namespace op {
 
-base::Status OpSlice::inferShape() {
-  base::Status status = base::kStatusCodeOk;
-  const auto& input_shape = inputs_[0]->getShape();
-  std::vector<int64_t> starts;
-  if (inputs_[1]->getDataType() == base::dataTypeOf<int32_t>()) {
-    int32_t* input_data = static_cast<int32_t*>(inputs_[1]->getData());
-    size_t input_size = inputs_[1]->getSize() / sizeof(int32_t);
-    starts.resize(input_size);
-    for (size_t i = 0; i < input_size; ++i) {
-      starts[i] = static_cast<int64_t>(input_data[i]);
-    }
+static bool getSliceValues(device::Tensor* tensor,
+                           std::vector<int64_t>& values) {
+  values.clear();
+  if (tensor == nullptr || tensor->getData() == nullptr) {
+    return true;
+  }
+  if (tensor->getDataType() == base::dataTypeOf<int32_t>()) {
+    int32_t* data = static_cast<int32_t*>(tensor->getData());
+    size_t size = tensor->getSize() / sizeof(int32_t);
+    values.assign(data, data + size);
+  } else if (tensor->getDataType() == base::dataTypeOf<int64_t>()) {
+    int64_t* data = static_cast<int64_t*>(tensor->getData());
+    size_t size = tensor->getSize() / sizeof(int64_t);
+    values.assign(data, data + size);
   } else {
-    int64_t* input_data = static_cast<int64_t*>(inputs_[1]->getData());
-    size_t input_size = inputs_[1]->getSize() / sizeof(int64_t);
-    starts.resize(input_size);
-    for (size_t i = 0; i < input_size; ++i) {
-      starts[i] = input_data[i];
+    NNDEPLOY_LOGE("%s must be int32 or int64.\n", tensor->getName().c_str());
+    return false;
+  }
+  return true;
+}
+
+base::Status OpSlice::getSliceInfo(std::vector<int64_t>& starts,
+                                   std::vector<int64_t>& steps,
+                                   base::IntVector& output_shape) {
+  const base::IntVector input_shape = inputs_[0]->getShape();
+  int rank = (int)input_shape.size();
+
+  std::vector<int64_t> slice_starts;
+  std::vector<int64_t> slice_ends;
+  std::vector<int64_t> slice_axes;
+  std::vector<int64_t> slice_steps;
+  if (inputs_.size() < 3) {
+    NNDEPLOY_LOGE("starts and ends are required.\n");
+    return base::kStatusCodeErrorInvalidParam;
+  }
+  bool valid = getSliceValues(inputs_[1], slice_starts) &&
+               getSliceValues(inputs_[2], slice_ends);
+  if (valid && inputs_.size() > 3) {
+    valid = getSliceValues(inputs_[3], slice_axes);
+  }
+  if (valid && inputs_.size() > 4) {
+    valid = getSliceValues(inputs_[4], slice_steps);
+  }
+  if (!valid) {
+    return base::kStatusCodeErrorInvalidParam;
+  }
+  if (slice_ends.size() != slice_starts.size()) {
+    NNDEPLOY_LOGE("starts and ends must have the same size.\n");
+    return base::kStatusCodeErrorInvalidParam;
+  }
+  if (slice_axes.empty()) {
+    for (size_t i = 0; i < slice_starts.size(); ++i) {
+      slice_axes.push_back((int64_t)i);
     }
   }
-  std::vector<int64_t> ends(starts.size());
-  if (inputs_[2]->getDataType() == base::dataTypeOf<int32_t>()) {
-    int32_t* input_data = static_cast<int32_t*>(inputs_[2]->getData());
-    size_t input_size = inputs_[2]->getSize() / sizeof(int32_t);
-    for (size_t i = 0; i < input_size; ++i) {
-      ends[i] = static_cast<int64_t>(input_data[i]);
+  if (slice_steps.empty()) {
+    slice_steps.assign(slice_starts.size(), 1);
+  }
+  if (slice_axes.size() != slice_starts.size() ||
+      slice_steps.size() != slice_starts.size()) {
+    NNDEPLOY_LOGE("axes and steps must have the same size as starts.\n");
+    return base::kStatusCodeErrorInvalidParam;
+  }
+
+  starts.assign(rank, 0);
+  steps.assign(rank, 1);
+  output_shape = input_shape;
+  for (size_t i = 0; i < slice_axes.size(); ++i) {
+    int64_t axis = slice_axes[i];
+    if (axis < -rank || axis >= rank) {
+      NNDEPLOY_LOGE("axis[%ld] is invalid.\n", axis);
+      return base::kStatusCodeErrorInvalidParam;
     }
-  } else {
-    int64_t* input_data = static_cast<int64_t*>(inputs_[2]->getData());
-    size_t input_size = inputs_[2]->getSize() / sizeof(int64_t);
-    for (size_t i = 0; i < input_size; ++i) {
-      ends[i] = input_data[i];
+    if (axis < 0) {
+      axis += rank;
+    }
+    int64_t dim = input_shape[axis];
+    int64_t start = slice_starts[i];
+    int64_t end = slice_ends[i];
+    int64_t step = slice_steps[i];
+    if (step == 0) {
+      NNDEPLOY_LOGE("step can not be 0.\n");
+      return base::kStatusCodeErrorInvalidParam;
+    }
+    if (start < 0) {
+      start += dim;
+    }
+    if (end < 0) {
+      end += dim;
+    }
+    int64_t count = 0;
+    if (step > 0) {
+      start = std::max(int64_t(0), std::min(start, dim));
+      end = std::max(int64_t(0), std::min(end, dim));
+      count = (end - start + step - 1) / step;
+    } else {
+      start = std::max(int64_t(0), std::min(start, dim - 1));
+      end = std::max(int64_t(-1), std::min(end, dim - 1));
+      count = (start - end - step - 1) / (-step);
     }
+    starts[axis] = start;
+    steps[axis] = step;
+    output_shape[axis] = (int)std::max(int64_t(0), count);
+  }
+
+  return base::kStatusCodeOk;
+}
+
+base::Status OpSlice::inferShape() {
+  std::vector<int64_t> starts;
+  std::vector<int64_t> steps;
+  base::IntVector output_shape;
+  base::Status status = getSliceInfo(starts, steps, output_shape);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "getSliceInfo failed");
+  outputs_[0]->reshape(output_shape);
+  return status;
+}
+
+bool OpSlice::getOutputView(int index, int& input_index, size_t& offset) {
+  if (index != 0 || !inputs_[0]->isContinue()) {
+    return false;
   }
-  std::vector<int64_t> axes(starts.size());
-  if (inputs_[3]->getDataType() == base::dataTypeOf<int32_t>()) {
-    int32_t* input_data = static_cast<int32_t*>(inputs_[3]->getData());
-    size_t input_size = inputs_[3]->getSize() / sizeof(int32_t);
-    for (size_t i = 0; i < input_size; ++i) {
-      axes[i] = static_cast<int64_t>(input_data[i]);
+  std::vector<int64_t> starts;
+  std::vector<int64_t> steps;
+  base::IntVector output_shape;
+  if (getSliceInfo(starts, steps, output_shape) != base::kStatusCodeOk) {
+    return false;
+  }
+  const base::IntVector input_shape = inputs_[0]->getShape();
+  int rank = (int)input_shape.size();
+  // 最内层的非完整维度之外全为1、之内全为完整维度时，切片区域连续
+  int last = -1;
+  for (int i = rank - 1; i >= 0; --i) {
+    bool full = output_shape[i] == input_shape[i] && starts[i] == 0 &&
+                (steps[i] == 1 || output_shape[i] <= 1);
+    if (!full) {
+      last = i;
+      break;
     }
-  } else {
-    int64_t* input_data = static_cast<int64_t*>(inputs_[3]->getData());
-    size_t input_size = inputs_[3]->getSize() / sizeof(int64_t);
-    for (size_t i = 0; i < input_size; ++i) {
-      axes[i] = input_data[i];
+  }
+  if (last >= 0 && steps[last] != 1 && output_shape[last] > 1) {
+    return false;
+  }
+  for (int i = 0; i < last; ++i) {
+    if (output_shape[i] != 1) {
+      return false;
     }
   }
-  std::vector<int64_t> steps(starts.size(), 1);
-  if (inputs_.size() == 5) {
-    if (inputs_[4]->getDataType() == base::dataTypeOf<int32_t>()) {
-      int32_t* input_data = static_cast<int32_t*>(inputs_[4]->getData());
-      size_t input_size = inputs_[4]->getSize() / sizeof(int32_t);
-      for (size_t i = 0; i < input_size; ++i) {
-        steps[i] = static_cast<int64_t>(input_data[i]);
+  size_t element_offset = 0;
+  size_t stride = 1;
+  for (int i = rank - 1; i >= 0; --i) {
+    element_offset += (size_t)starts[i] * stride;
+    stride *= (size_t)input_shape[i];
+  }
+  input_index = 0;
+  offset = element_offset * inputs_[0]->getDataType().size();
+  return true;
+}
+
+/**
+ * @brief 按输出的行切分，每个任务从起始行的下标开始逐行前进
+ */
+class SliceLoopBody : public thread_pool::ParallelLoopBody {
+ public:
+  SliceLoopBody(const uint8_t* input_data, uint8_t* output_data,
+                size_t element_size, const base::IntVector& output_shape,
+                const std::vector<int64_t>& steps,
+                const std::vector<int64_t>& input_strides, int64_t base_offset)
+      : input_data_(input_data),
+        output_data_(output_data),
+        element_size_(element_size),
+        output_shape_(output_shape),
+        steps_(steps),
+        input_strides_(input_strides),
+        base_offset_(base_offset) {}
+
+  virtual void operator()(const base::Range& range) const {
+    int rank = (int)output_shape_.size();
+    int64_t cols = output_shape_[rank - 1];
+    int64_t col_step = steps_[rank - 1];
+    std::vector<int64_t> index(rank, 0);
+    int64_t rest = range.start_;
+    for (int i = rank - 2; i >= 0; --i) {
+      index[i] = rest % output_shape_[i];
+      rest /= output_shape_[i];
+    }
+    for (int64_t r = range.start_; r < range.end_; ++r) {
+      int64_t src = base_offset_;
+      for (int i = 0; i < rank - 1; ++i) {
+        src += index[i] * steps_[i] * input_strides_[i];
       }
-    } else {
-      int64_t* input_data = static_cast<int64_t*>(inputs_[4]->getData());
-      size_t input_size = inputs_[4]->getSize() / sizeof(int64_t);
-      for (size_t i = 0; i < input_size; ++i) {
-        steps[i] = input_data[i];
+      const uint8_t* src_row = input_data_ + src * element_size_;
+      uint8_t* dst_row = output_data_ + r * cols * element_size_;
+      if (col_step == 1) {
+        std::memcpy(dst_row, src_row, cols * element_size_);
+      } else {
+        for (int64_t c = 0; c < cols; ++c) {
+          std::memcpy(dst_row + c * element_size_,
+                      src_row + c * col_step * (int64_t)element_size_,
+                      element_size_);
+        }
+      }
+      for (int i = rank - 2; i >= 0; --i) {
+        if (++index[i] < output_shape_[i]) {
+          break;
+        }
+        index[i] = 0;
       }
     }
   }
 
-  base::IntVector output_shape = input_shape;
+ private:
+  const uint8_t* input_data_;
+  uint8_t* output_data_;
+  size_t element_size_;
+  const base::IntVector& output_shape_;
+  const std::vector<int64_t>& steps_;
+  const std::vector<int64_t>& input_strides_;
+  int64_t base_offset_;
+};
 
-  for (size_t i = 0; i < axes.size(); ++i) {
-    int64_t axis = axes[i];
-    int64_t start = starts[i];
-    int64_t end = ends[i];
-    int64_t step = steps[i];
+base::Status OpSlice::run() {
+  std::vector<int64_t> starts;
+  std::vector<int64_t> steps;
+  base::IntVector output_shape;
+  base::Status status = getSliceInfo(starts, steps, output_shape);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "getSliceInfo failed");
 
-    if (start < 0) {
-      start += input_shape[axis];
-    }
-    if (end < 0) {
-      end += input_shape[axis];
-    }
+  const base::IntVector input_shape = inputs_[0]->getShape();
+  int rank = (int)input_shape.size();
+  size_t element_size = inputs_[0]->getDataType().size();
+  const uint8_t* input_data =
+      static_cast<const uint8_t*>(inputs_[0]->getData());
+  uint8_t* output_data = static_cast<uint8_t*>(outputs_[0]->getData());
 
-    start = std::max(int64_t(0), std::min(start, (int64_t)input_shape[axis]));
-    end = std::max(int64_t(0), std::min(end, (int64_t)input_shape[axis]));
+  std::vector<int64_t> input_strides(rank, 1);
+  for (int i = rank - 2; i >= 0; --i) {
+    input_strides[i] = input_strides[i + 1] * input_shape[i + 1];
+  }
+  int64_t base_offset = 0;
+  for (int i = 0; i < rank; ++i) {
+    base_offset += starts[i] * input_strides[i];
+  }
 
-    output_shape[axis] = (end - start + step - 1) / step;
+  // 输出为输入的视图时无需拷贝
+  if (output_data == input_data + base_offset * element_size) {
+    int input_index = -1;
+    size_t offset = 0;
+    if (getOutputView(0, input_index, offset)) {
+      return base::kStatusCodeOk;
+    }
   }
 
-  outputs_[0]->reshape(output_shape);
+  int64_t cols = output_shape[rank - 1];
+  int64_t rows = 1;
+  for (int i = 0; i < rank - 1; ++i) {
+    rows *= output_shape[i];
+  }
+  if (rows == 0 || cols == 0) {
+    return base::kStatusCodeOk;
+  }
+  SliceLoopBody body(input_data, output_data, element_size, output_shape,
+                     steps, input_strides, base_offset);
+  thread_pool::parallelForWithCost(base::Range(0, (int)rows), body,
+                                   getFlops());
 
   return status;
 }
 
-base::Status OpSlice::run() {
-  NNDEPLOY_LOGI("not implemented.\n");
-  return base::kStatusCodeOk;
-}
-
 base::Status slice(device::Tensor* input, device::Tensor* starts,
                    device::Tensor* ends, device::Tensor* axes,
                    device::Tensor* steps, device::Tensor* output) {
@@ -17,6 +17,8 @@
 #include "nndeploy/device/tensor.h"
 #include "nndeploy/ir/ir.h"
 #include "nndeploy/op/op.h"
+#include "nndeploy/op/vec_math.h"
+#include "nndeploy/thread_pool/parallel.h"
 
 namespace nndeploy {
 namespace op {
@@ -45,19 +47,190 @@ base::Status OpSoftmax::inferShape() {
   return status;
 }
 
+// axis为最内层维度时，每个块的元素数
+static const int kSoftmaxBlock = 2048;
+// inner_size > 1时，inner方向每次处理的元素数
+static const int kSoftmaxInnerChunk = 256;
+// inner_size > 1时，axis方向每个块的行数
+static const int kSoftmaxRowBlock = 32;
+
+/**
+ * @brief online softmax，axis为最内层维度，SIMD沿axis方向
+ * # 逐块求max并计算exp(x - m)，m增大时按exp(m_old - m)重标定已累加的和
+ * # 每块的exp结果直接写入dst并记录所用的m，最后一遍只做乘法
+ * # 输入只读一遍，每个元素只计算一次exp
+ * # 全为-inf的块exp结果为0，整行全为-inf时输出nan(与exp(x - max)的定义一致)
+ */
+static void softmaxLastAxis(const float *src, float *dst, int axis_size,
+                            std::vector<float> &block_max) {
+  int blocks = (axis_size + kSoftmaxBlock - 1) / kSoftmaxBlock;
+  block_max.resize(blocks);
+  float m = -std::numeric_limits<float>::infinity();
+  float sum = 0.0f;
+  for (int b = 0; b < blocks; ++b) {
+    int begin = b * kSoftmaxBlock;
+    int size = std::min(kSoftmaxBlock, axis_size - begin);
+    float local_max = vecMax(src + begin, size);
+    if (local_max > m) {
+      sum *= std::exp(m - local_max);
+      m = local_max;
+    }
+    // m为-inf时该块全为-inf，按偏移0计算使exp结果为0而不是nan
+    float offset = m == -std::numeric_limits<float>::infinity() ? 0.0f : m;
+    sum += vecExpSum(src + begin, offset, dst + begin, size);
+    block_max[b] = m;
+  }
+  float inv_sum = 1.0f / sum;
+  for (int b = 0; b < blocks; ++b) {
+    int begin = b * kSoftmaxBlock;
+    int size = std::min(kSoftmaxBlock, axis_size - begin);
+    float scale = std::exp(block_max[b] - m) * inv_sum;
+    float *ptr = dst + begin;
+    for (int i = 0; i < size; ++i) {
+      ptr[i] *= scale;
+    }
+  }
+}
+
+/**
+ * @brief online softmax，inner_size > 1，SIMD沿inner方向
+ * # 处理inner方向[0, chunk)的连续元素，axis方向按kSoftmaxRowBlock行分块
+ * # 每个行块先求逐列max，再逐行计算exp并累加，同样按块记录m并在最后重标定
+ * # 列的max为-inf时按偏移0计算，已处理的行全为-inf时exp结果为0
+ */
+static void softmaxInnerChunk(const float *src, float *dst, int axis_size,
+                              int inner_size, int chunk,
+                              std::vector<float> &buffer) {
+  int blocks = (axis_size + kSoftmaxRowBlock - 1) / kSoftmaxRowBlock;
+  buffer.resize((size_t)(4 + blocks) * chunk);
+  float *m = buffer.data();
+  float *sum = m + chunk;
+  float *scale = sum + chunk;
+  float *offset = scale + chunk;
+  float *block_max = offset + chunk;
+  std::fill(m, m + chunk, -std::numeric_limits<float>::infinity());
+  std::fill(sum, sum + chunk, 0.0f);
+  for (int b = 0; b < blocks; ++b) {
+    int row_begin = b * kSoftmaxRowBlock;
+    int row_end = std::min(axis_size, row_begin + kSoftmaxRowBlock);
+    // 行块的逐列max
+    std::fill(scale, scale + chunk, -std::numeric_limits<float>::infinity());
+    for (int j = row_begin; j < row_end; ++j) {
+      const float *row = src + (size_t)j * inner_size;
+      for (int k = 0; k < chunk; ++k) {
+        scale[k] = std::max(scale[k], row[k]);
+      }
+    }
+    // 重标定已累加的和
+    for (int k = 0; k < chunk; ++k) {
+      float new_max = std::max(m[k], scale[k]);
+      offset[k] =
+          new_max == -std::numeric_limits<float>::infinity() ? 0.0f : new_max;
+      scale[k] = m[k] - offset[k];
+      m[k] = new_max;
+    }
+    vecExp(scale, scale, chunk);
+    for (int k = 0; k < chunk; ++k) {
+      sum[k] *= scale[k];
+    }
+    for (int j = row_begin; j < row_end; ++j) {
+      const float *row = src + (size_t)j * inner_size;
+      float *out = dst + (size_t)j * inner_size;
+      for (int k = 0; k < chunk; ++k) {
+        out[k] = row[k] - offset[k];
+      }
+      vecExp(out, out, chunk);
+      for (int k = 0; k < chunk; ++k) {
+        sum[k] += out[k];
+      }
+    }
+    memcpy(block_max + (size_t)b * chunk, m, chunk * sizeof(float));
+  }
+  for (int k = 0; k < chunk; ++k) {
+    sum[k] = 1.0f / sum[k];
+  }
+  for (int b = 0; b < blocks; ++b) {
+    int row_begin = b * kSoftmaxRowBlock;
+    int row_end = std::min(axis_size, row_begin + kSoftmaxRowBlock);
+    const float *local_max = block_max + (size_t)b * chunk;
+    for (int k = 0; k < chunk; ++k) {
+      scale[k] = local_max[k] - m[k];
+    }
+    vecExp(scale, scale, chunk);
+    for (int k = 0; k < chunk; ++k) {
+      scale[k] *= sum[k];
+    }
+    for (int j = row_begin; j < row_end; ++j) {
+      float *out = dst + (size_t)j * inner_size;
+      for (int k = 0; k < chunk; ++k) {
+        out[k] *= scale[k];
+      }
+    }
+  }
+}
+
+/**
+ * @brief 按outer(以及inner方向的分块)划分任务
+ */
+class SoftmaxLoopBody : public thread_pool::ParallelLoopBody {
+ public:
+  SoftmaxLoopBody(const float *input, float *output, int axis_size,
+                  int inner_size)
+      : input_(input),
+        output_(output),
+        axis_size_(axis_size),
+        inner_size_(inner_size) {}
+
+  int getChunks() const {
+    return (inner_size_ + kSoftmaxInnerChunk - 1) / kSoftmaxInnerChunk;
+  }
+
+  virtual void operator()(const base::Range &range) const {
+    std::vector<float> buffer;
+    size_t block_size = (size_t)axis_size_ * inner_size_;
+    int chunks = getChunks();
+    for (int task = range.start_; task < range.end_; ++task) {
+      int outer = task / chunks;
+      const float *src = input_ + outer * block_size;
+      float *dst = output_ + outer * block_size;
+      if (inner_size_ == 1) {
+        softmaxLastAxis(src, dst, axis_size_, buffer);
+        continue;
+      }
+      int k = (task % chunks) * kSoftmaxInnerChunk;
+      int chunk = std::min(kSoftmaxInnerChunk, inner_size_ - k);
+      softmaxInnerChunk(src + k, dst + k, axis_size_, inner_size_, chunk,
+                        buffer);
+    }
+  }
+
+ private:
+  const float *input_;
+  float *output_;
+  int axis_size_;
+  int inner_size_;
+};
+
 base::Status OpSoftmax::run() {
   base::Status status = base::kStatusCodeOk;
   // 获取输入和输出张量
   device::Tensor *input_tensor = inputs_[0];
   device::Tensor *output_tensor = outputs_[0];
+  if (input_tensor->getDataType() != base::dataTypeOf<float>()) {
+    NNDEPLOY_LOGE("softmax only support float.\n");
+    return base::kStatusCodeErrorNotSupport;
+  }
 
   // 获取输入和输出的维度信息
   auto input_shape = input_tensor->getShape();
-  auto output_shape = output_tensor->getShape();
 
   // 获取softmax参数
   auto param = dynamic_cast<ir::SoftmaxParam *>(op_desc_.op_param_.get());
+  NNDEPLOY_CHECK_PARAM_NULL_RET_STATUS(param, "op_desc_.op_param_ is nullptr");
   int axis = param->axis_;
+  if (axis < 0) {
+    axis += (int)input_shape.size();
+  }
 
   // 获取输入输出数据
   float *input_data = static_cast<float *>(input_tensor->getData());
@@ -73,32 +246,14 @@ base::Status OpSoftmax::run() {
   for (int i = axis + 1; i < input_shape.size(); i++) {
     inner_size *= input_shape[i];
   }
+  if (outer_size == 0 || axis_size == 0 || inner_size == 0) {
+    return status;
+  }
 
   // 执行softmax操作
-  for (int i = 0; i < outer_size; i++) {
-    for (int k = 0; k < inner_size; k++) {
-      // 找到最大值
-      float max_val = -std::numeric_limits<float>::infinity();
-      for (int j = 0; j < axis_size; j++) {
-        int index = i * axis_size * inner_size + j * inner_size + k;
-        max_val = std::max(max_val, input_data[index]);
-      }
-
-      // 计算exp和
-      float sum = 0.0f;
-      for (int j = 0; j < axis_size; j++) {
-        int index = i * axis_size * inner_size + j * inner_size + k;
-        output_data[index] = std::exp(input_data[index] - max_val);
-        sum += output_data[index];
-      }
-
-      // 归一化
-      for (int j = 0; j < axis_size; j++) {
-        int index = i * axis_size * inner_size + j * inner_size + k;
-        output_data[index] /= sum;
-      }
-    }
-  }
+  SoftmaxLoopBody body(input_data, output_data, axis_size, inner_size);
+  int tasks = outer_size * body.getChunks();
+  thread_pool::parallelForWithCost(base::Range(0, tasks), body, getFlops());
 
   return status;
 }
@@ -17,10 +17,50 @@
 #include "nndeploy/device/tensor.h"
 #include "nndeploy/ir/ir.h"
 #include "nndeploy/op/op.h"
+#include "nndeploy/op/util.h"
 
 namespace nndeploy {
 namespace op {
 
+base::Status OpSplit::getSplitSizes(int axis_size,
+                                    std::vector<int64_t> &sizes) {
+  sizes.clear();
+  if (inputs_.size() > 1 && inputs_[1] != nullptr &&
+      inputs_[1]->getData() != nullptr) {
+    if (inputs_[1]->getDataType() != base::dataTypeOf<int64_t>()) {
+      NNDEPLOY_LOGE("split must be int64.\n");
+      return base::kStatusCodeErrorInvalidParam;
+    }
+    int64_t *split_data = (int64_t *)inputs_[1]->getData();
+    size_t split_size = inputs_[1]->getSize() / sizeof(int64_t);
+    sizes.assign(split_data, split_data + split_size);
+  } else {
+    int64_t num = (int64_t)outputs_.size();
+    int64_t chunk = (axis_size + num - 1) / num;
+    for (int64_t i = 0; i < num; ++i) {
+      sizes.push_back(
+          std::max(int64_t(0), std::min(chunk, axis_size - i * chunk)));
+    }
+  }
+  int64_t axis_split_size = 0;
+  for (size_t i = 0; i < sizes.size(); i++) {
+    if (sizes[i] < 0) {
+      NNDEPLOY_LOGE("split[%d] < 0.\n", (int)i);
+      return base::kStatusCodeErrorInvalidParam;
+    }
+    axis_split_size += sizes[i];
+  }
+  if (axis_split_size != axis_size) {
+    NNDEPLOY_LOGE("axis_split_size != axis_size.\n");
+    return base::kStatusCodeErrorInvalidParam;
+  }
+  if (outputs_.size() != sizes.size()) {
+    NNDEPLOY_LOGE("outputs_.size() != split size.\n");
+    return base::kStatusCodeErrorInvalidParam;
+  }
+  return base::kStatusCodeOk;
+}
+
 base::Status OpSplit::inferShape() {
   base::Status status = base::kStatusCodeOk;
   // 参数
@@ -39,40 +79,83 @@ base::Status OpSplit::inferShape() {
 
   //
   base::IntVector input_shape = inputs_[0]->getShape();
-  int axis_size = input_shape[axis];
-  int target_shape_size = inputs_[1]->getShapeIndex(0);
-  int64_t *target_shape_data = (int64_t *)inputs_[1]->getData();
-  int axis_split_size = 0;
-  for (int i = 0; i < target_shape_size; i++) {
-    if (target_shape_data[i] < 0) {
-      NNDEPLOY_LOGE("target_shape_data[%d] < 0.\n", i);
-      return base::kStatusCodeErrorInvalidParam;
-    }
-    axis_split_size += target_shape_data[i];
-  }
-  if (axis_split_size != axis_size) {
-    NNDEPLOY_LOGE("axis_split_size != axis_size.\n");
-    return base::kStatusCodeErrorInvalidParam;
-  }
-  if (outputs_.size() != target_shape_size) {
-    NNDEPLOY_LOGE("outputs_.size() != target_shape_size.\n");
-    return base::kStatusCodeErrorInvalidParam;
-  }
+  std::vector<int64_t> split_sizes;
+  status = getSplitSizes(input_shape[axis], split_sizes);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "getSplitSizes failed");
 
-  param->num_outputs_ = target_shape_size;
+  param->num_outputs_ = (int)split_sizes.size();
 
   // infer output shape
   for (size_t i = 0; i < outputs_.size(); i++) {
     auto output_shape = input_shape;
-    output_shape[axis] = target_shape_data[i];
+    output_shape[axis] = (int)split_sizes[i];
     outputs_[i]->reshape(output_shape);
   }
 
   return status;
 }
 
+bool OpSplit::getOutputView(int index, int &input_index, size_t &offset) {
+  auto param = dynamic_cast<ir::SplitParam *>(op_desc_.op_param_.get());
+  if (param == nullptr || !inputs_[0]->isContinue()) {
+    return false;
+  }
+  int axis = param->axis_;
+  base::IntVector input_shape = inputs_[0]->getShape();
+  if (axis < 0) {
+    axis += (int)input_shape.size();
+  }
+  if (multiplyDims(input_shape, 0, axis) != 1) {
+    return false;
+  }
+  std::vector<int64_t> split_sizes;
+  if (getSplitSizes(input_shape[axis], split_sizes) != base::kStatusCodeOk ||
+      index >= (int)split_sizes.size()) {
+    return false;
+  }
+  size_t inner = multiplyDims(input_shape, axis + 1, (int)input_shape.size());
+  size_t split_offset = 0;
+  for (int i = 0; i < index; ++i) {
+    split_offset += (size_t)split_sizes[i];
+  }
+  input_index = 0;
+  offset = split_offset * inner * inputs_[0]->getDataType().size();
+  return true;
+}
+
 base::Status OpSplit::run() {
-  NNDEPLOY_LOGI("not implemented.\n");
+  auto param = dynamic_cast<ir::SplitParam *>(op_desc_.op_param_.get());
+  NNDEPLOY_CHECK_PARAM_NULL_RET_STATUS(param, "op_desc_.op_param_ is nullptr");
+  int axis = param->axis_;
+  base::IntVector input_shape = inputs_[0]->getShape();
+  if (axis < 0) {
+    axis += (int)input_shape.size();
+  }
+  size_t element_size = inputs_[0]->getDataType().size();
+  size_t outer = multiplyDims(input_shape, 0, axis);
+  size_t inner = multiplyDims(input_shape, axis + 1, (int)input_shape.size());
+  size_t input_row = (size_t)input_shape[axis] * inner * element_size;
+  if (input_row == 0) {
+    return base::kStatusCodeOk;
+  }
+  const uint8_t *input_data =
+      static_cast<const uint8_t *>(inputs_[0]->getData());
+
+  size_t split_offset = 0;
+  for (size_t i = 0; i < outputs_.size(); ++i) {
+    size_t output_row = (size_t)outputs_[i]->getShapeIndex(axis) * inner *
+                        element_size;
+    uint8_t *output_data = static_cast<uint8_t *>(outputs_[i]->getData());
+    // 输出为输入的视图时无需拷贝
+    if (outer == 1 && output_data == input_data + split_offset) {
+      split_offset += output_row;
+      continue;
+    }
+    // 每个输出的拷贝按其占输入的比例分摊计算量
+    copyRows(output_data, output_row, input_data + split_offset, input_row,
+             outer, output_row, getFlops() * output_row / input_row);
+    split_offset += output_row;
+  }
   return base::kStatusCodeOk;
 }
 
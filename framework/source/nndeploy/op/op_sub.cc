@@ -21,12 +21,6 @@
 namespace nndeploy {
 namespace op {
 
-base::Status OpSub::run() {
-  // TODO: 实现除法运算
-  NNDEPLOY_LOGI("not implemented.\n");
-  return base::kStatusCodeOk;
-}
-
 base::Status sub(device::Tensor *input1, device::Tensor *input2,
                  device::Tensor *output) {
   base::Status status = base::kStatusCodeOk;
@@ -0,0 +1,194 @@
+#include "nndeploy/op/op_swiglu.h"
+
+#include "nndeploy/base/any.h"
+#include "nndeploy/base/common.h"
+#include "nndeploy/base/glic_stl_include.h"
+#include "nndeploy/base/log.h"
+#include "nndeploy/base/macro.h"
+#include "nndeploy/base/object.h"
+#include "nndeploy/base/param.h"
+#include "nndeploy/base/shape.h"
+#include "nndeploy/base/status.h"
+#include "nndeploy/base/string.h"
+#include "nndeploy/base/time_profiler.h"
+#include "nndeploy/device/buffer.h"
+#include "nndeploy/device/device.h"
+#include "nndeploy/device/memory_pool.h"
+#include "nndeploy/device/tensor.h"
+#include "nndeploy/ir/ir.h"
+#include "nndeploy/op/op.h"
+#include "nndeploy/op/vec_math.h"
+#include "nndeploy/thread_pool/parallel.h"
+
+namespace nndeploy {
+namespace op {
+
+/**
+ * @brief 单输入时拆分的轴，已按维数归一化
+ */
+static base::Status getSwiGLUAxis(Op *op, const base::IntVector &shape,
+                                  int &axis) {
+  auto param = dynamic_cast<ir::SwiGLUParam *>(op->getParam().get());
+  axis = param != nullptr ? param->axis_ : -1;
+  int rank = static_cast<int>(shape.size());
+  if (axis < 0) {
+    axis += rank;
+  }
+  if (axis < 0 || axis >= rank) {
+    NNDEPLOY_LOGE("axis is out of range.\n");
+    return base::kStatusCodeErrorInvalidParam;
+  }
+  if (shape[axis] % 2 != 0) {
+    NNDEPLOY_LOGE("dim[%d] of axis[%d] must be even.\n", shape[axis], axis);
+    return base::kStatusCodeErrorInvalidParam;
+  }
+  return base::kStatusCodeOk;
+}
+
+base::Status OpSwiGLU::inferShape() {
+  base::IntVector shape = inputs_[0]->getShape();
+  if (inputs_.size() > 1 && inputs_[1] != nullptr) {
+    if (!base::shapeEqual(shape, inputs_[1]->getShape())) {
+      NNDEPLOY_LOGE("gate shape must be equal to up shape.\n");
+      return base::kStatusCodeErrorInvalidParam;
+    }
+  } else {
+    int axis = 0;
+    base::Status status = getSwiGLUAxis(this, shape, axis);
+    NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk,
+                           "getSwiGLUAxis failed");
+    shape[axis] /= 2;
+  }
+  outputs_[0]->reshape(shape);
+  return base::kStatusCodeOk;
+}
+
+// 每个任务处理的元素数
+static const size_t kSwiGLUBlockSize = 16 * 1024;
+
+/**
+ * @brief 一遍完成silu(gate) * up
+ * # 输出按[outer, chunk]划分，第o行的gate与up分别从gate_ + o * stride_与
+ *   up_ + o * stride_开始，双输入时outer为1
+ * # 每行再按kSwiGLUBlockSize分块，outer较小时也能并行
+ */
+class SwiGLULoopBody : public thread_pool::ParallelLoopBody {
+ public:
+  SwiGLULoopBody(const float *gate, const float *up, float *output,
+                 size_t chunk, size_t stride, size_t blocks)
+      : gate_(gate),
+        up_(up),
+        output_(output),
+        chunk_(chunk),
+        stride_(stride),
+        blocks_(blocks) {}
+
+  virtual void operator()(const base::Range &range) const {
+    for (int task = range.start_; task < range.end_; ++task) {
+      size_t outer = task / blocks_;
+      size_t begin = (task % blocks_) * kSwiGLUBlockSize;
+      size_t size = std::min(kSwiGLUBlockSize, chunk_ - begin);
+      vecSiluMul(gate_ + outer * stride_ + begin, up_ + outer * stride_ + begin,
+                 output_ + outer * chunk_ + begin, size);
+    }
+  }
+
+ private:
+  const float *gate_;
+  const float *up_;
+  float *output_;
+  size_t chunk_;
+  size_t stride_;
+  size_t blocks_;
+};
+
+base::Status OpSwiGLU::run() {
+  base::Status status = base::kStatusCodeOk;
+  bool has_up = inputs_.size() > 1 && inputs_[1] != nullptr;
+  if (inputs_[0]->getDataType() != base::dataTypeOf<float>() ||
+      (has_up && inputs_[1]->getDataType() != base::dataTypeOf<float>())) {
+    NNDEPLOY_LOGE("swiglu only support float.\n");
+    return base::kStatusCodeErrorNotSupport;
+  }
+
+  base::IntVector shape = inputs_[0]->getShape();
+  const float *gate = static_cast<const float *>(inputs_[0]->getData());
+  const float *up = nullptr;
+  size_t outer = 1;
+  size_t chunk = 1;
+  size_t stride = 0;
+  if (has_up) {
+    up = static_cast<const float *>(inputs_[1]->getData());
+    for (auto dim : shape) {
+      chunk *= dim;
+    }
+  } else {
+    int axis = 0;
+    status = getSwiGLUAxis(this, shape, axis);
+    NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk,
+                           "getSwiGLUAxis failed");
+    for (int i = 0; i < axis; ++i) {
+      outer *= shape[i];
+    }
+    chunk = shape[axis] / 2;
+    for (int i = axis + 1; i < shape.size(); ++i) {
+      chunk *= shape[i];
+    }
+    // gate与up在同一行中相邻
+    up = gate + chunk;
+    stride = 2 * chunk;
+  }
+  if (outer == 0 || chunk == 0) {
+    return status;
+  }
+
+  size_t blocks = (chunk + kSwiGLUBlockSize - 1) / kSwiGLUBlockSize;
+  size_t tasks = outer * blocks;
+  SwiGLULoopBody body(gate, up, static_cast<float *>(outputs_[0]->getData()),
+                      chunk, stride, blocks);
+  thread_pool::parallelForWithCost(base::Range(0, (int)tasks), body,
+                                    getFlops());
+
+  return status;
+}
+
+base::Status swiglu(device::Tensor *gate, device::Tensor *up,
+                    device::Tensor *output) {
+  base::Status status = base::kStatusCodeOk;
+
+  Op *op = createOp(gate->getDeviceType(), "", ir::kOpTypeSwiGLU);
+  if (op == nullptr) {
+    NNDEPLOY_LOGE("createOp failed");
+    return base::kStatusCodeErrorNotImplement;
+  }
+  status = op->setInput(gate, 0);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setInput failed");
+  if (up != nullptr) {
+    status = op->setInput(up, 1);
+    NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setInput failed");
+  }
+  status = op->setOutput(output, 0);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setOutput failed");
+  status = op->init();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "init failed");
+  status = op->preRun();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "preRun failed");
+  status = op->checkOrAllocOutput();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk,
+                         "checkOrAllocOutput failed");
+  status = op->run();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "run failed");
+  status = op->postRun();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "postRun failed");
+  status = op->deinit();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "deinit failed");
+
+  delete op;
+
+  return status;
+}
+
+REGISTER_OP_IMPLEMENTION(kDeviceTypeCodeCpu, ir::kOpTypeSwiGLU, OpSwiGLU)
+
+}  // namespace op
+}  // namespace nndeploy
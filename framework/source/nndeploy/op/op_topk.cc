@@ -0,0 +1,320 @@
+#include "nndeploy/op/op_topk.h"
+
+#include "nndeploy/base/any.h"
+#include "nndeploy/base/common.h"
+#include "nndeploy/base/glic_stl_include.h"
+#include "nndeploy/base/log.h"
+#include "nndeploy/base/macro.h"
+#include "nndeploy/base/object.h"
+#include "nndeploy/base/param.h"
+#include "nndeploy/base/shape.h"
+#include "nndeploy/base/status.h"
+#include "nndeploy/base/string.h"
+#include "nndeploy/base/time_profiler.h"
+#include "nndeploy/device/buffer.h"
+#include "nndeploy/device/device.h"
+#include "nndeploy/device/memory_pool.h"
+#include "nndeploy/device/tensor.h"
+#include "nndeploy/ir/ir.h"
+#include "nndeploy/op/op.h"
+#include "nndeploy/op/vec_math.h"
+#include "nndeploy/thread_pool/parallel.h"
+
+namespace nndeploy {
+namespace op {
+
+/**
+ * @brief 归一化后的axis与k
+ */
+static base::Status getTopKInfo(Op *op,
+                                const std::vector<device::Tensor *> &inputs,
+                                int &axis, int &k) {
+  auto param = dynamic_cast<ir::TopKParam *>(op->getParam().get());
+  base::IntVector shape = inputs[0]->getShape();
+  int rank = static_cast<int>(shape.size());
+  axis = param != nullptr ? param->axis_ : -1;
+  if (axis < 0) {
+    axis += rank;
+  }
+  if (axis < 0 || axis >= rank) {
+    NNDEPLOY_LOGE("axis is out of range.\n");
+    return base::kStatusCodeErrorInvalidParam;
+  }
+  k = param != nullptr ? param->k_ : 1;
+  if (inputs.size() > 1 && inputs[1] != nullptr &&
+      inputs[1]->getData() != nullptr) {
+    if (inputs[1]->getDataType() == base::dataTypeOf<int32_t>()) {
+      k = static_cast<int32_t *>(inputs[1]->getData())[0];
+    } else {
+      k = static_cast<int>(static_cast<int64_t *>(inputs[1]->getData())[0]);
+    }
+  }
+  if (k < 0 || k > shape[axis]) {
+    NNDEPLOY_LOGE("k[%d] must be in [0, %d].\n", k, shape[axis]);
+    return base::kStatusCodeErrorInvalidParam;
+  }
+  return base::kStatusCodeOk;
+}
+
+base::Status OpTopK::inferDataType() {
+  outputs_[0]->setDataType(inputs_[0]->getDataType());
+  if (outputs_.size() > 1) {
+    outputs_[1]->setDataType(base::dataTypeOf<int64_t>());
+  }
+  return base::kStatusCodeOk;
+}
+
+base::Status OpTopK::inferShape() {
+  int axis = 0;
+  int k = 0;
+  base::Status status = getTopKInfo(this, inputs_, axis, k);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "getTopKInfo failed");
+  base::IntVector shape = inputs_[0]->getShape();
+  shape[axis] = k;
+  for (auto output : outputs_) {
+    output->reshape(shape);
+  }
+  return status;
+}
+
+// 每次预筛选的元素数
+static const int kTopKBlock = 1024;
+// 候选数达到max(2k, kTopKMinCandidates)时裁剪为k个
+static const size_t kTopKMinCandidates = 256;
+
+struct TopKItem {
+  float value_;
+  int32_t index_;
+};
+
+static inline bool topKGreater(const TopKItem &a, const TopKItem &b) {
+  return a.value_ > b.value_ || (a.value_ == b.value_ && a.index_ < b.index_);
+}
+
+/**
+ * @brief 在连续的n个元素中选出最大的k个写入items，sorted时从大到小排序
+ * # index为kTopKBlock个元素的临时空间
+ */
+static void selectTopK(const float *x, int n, int k, bool sorted,
+                       std::vector<TopKItem> &items, int32_t *index) {
+  items.clear();
+  if (k == 0) {
+    return;
+  }
+  // 先取前limit个元素为候选，裁剪后的第k大值作为初始阈值
+  size_t limit = std::max(2 * static_cast<size_t>(k), kTopKMinCandidates);
+  int head = static_cast<int>(std::min(static_cast<size_t>(n), limit));
+  items.reserve(limit + kTopKBlock);
+  for (int i = 0; i < head; ++i) {
+    items.push_back({x[i], i});
+  }
+  float threshold = 0.0f;
+  if (head < n) {
+    std::nth_element(items.begin(), items.begin() + k - 1, items.end(),
+                     topKGreater);
+    items.resize(k);
+    threshold = items[k - 1].value_;
+  }
+  // 与阈值相等的元素下标更大，不会排在已有候选之前
+  for (int begin = head; begin < n; begin += kTopKBlock) {
+    int size = std::min(kTopKBlock, n - begin);
+    size_t count = vecSelectGreater(x + begin, size, threshold, index);
+    for (size_t c = 0; c < count; ++c) {
+      int i = begin + index[c];
+      items.push_back({x[i], i});
+    }
+    if (items.size() >= limit) {
+      std::nth_element(items.begin(), items.begin() + k - 1, items.end(),
+                       topKGreater);
+      items.resize(k);
+      threshold = items[k - 1].value_;
+    }
+  }
+  if (items.size() > k) {
+    std::nth_element(items.begin(), items.begin() + k - 1, items.end(),
+                     topKGreater);
+    items.resize(k);
+  }
+  if (sorted) {
+    std::sort(items.begin(), items.end(), topKGreater);
+  }
+}
+
+/**
+ * @brief 每个任务处理一行，即[outer, n, inner]中固定outer与inner的n个元素
+ * # inner不为1时先拷贝成连续的一行，取最小的k个时取反后按最大处理
+ */
+class TopKLoopBody : public thread_pool::ParallelLoopBody {
+ public:
+  TopKLoopBody(const float *input, float *values, int64_t *indices, int n,
+               int inner, int k, bool largest, bool sorted, bool softmax)
+      : input_(input),
+        values_(values),
+        indices_(indices),
+        n_(n),
+        inner_(inner),
+        k_(k),
+        largest_(largest),
+        sorted_(sorted),
+        softmax_(softmax) {}
+
+  virtual void operator()(const base::Range &range) const {
+    std::vector<float> buffer;
+    std::vector<float> scratch;
+    std::vector<TopKItem> items;
+    int32_t index[kTopKBlock];
+    if (inner_ != 1 || !largest_) {
+      buffer.resize(n_);
+    }
+    if (softmax_) {
+      scratch.resize(kTopKBlock);
+    }
+    for (int task = range.start_; task < range.end_; ++task) {
+      size_t outer = task / inner_;
+      size_t inner = task % inner_;
+      const float *src = input_ + outer * n_ * inner_ + inner;
+      const float *row = src;
+      if (inner_ != 1) {
+        for (int i = 0; i < n_; ++i) {
+          buffer[i] = src[i * inner_];
+        }
+        row = buffer.data();
+      }
+
+      // softmax只需要整行的max与sum(exp(x - max))
+      float m = 0.0f;
+      float s = 1.0f;
+      if (softmax_) {
+        m = vecMax(row, n_);
+        s = 0.0f;
+        for (int begin = 0; begin < n_; begin += kTopKBlock) {
+          int size = std::min(kTopKBlock, n_ - begin);
+          s += vecExpSum(row + begin, m, scratch.data(), size);
+        }
+      }
+      if (!largest_) {
+        for (int i = 0; i < n_; ++i) {
+          buffer[i] = -row[i];
+        }
+        row = buffer.data();
+      }
+
+      selectTopK(row, n_, k_, sorted_, items, index);
+      size_t offset = outer * k_ * inner_ + inner;
+      for (int j = 0; j < k_; ++j) {
+        float value = largest_ ? items[j].value_ : -items[j].value_;
+        if (softmax_) {
+          value = std::exp(value - m) / s;
+        }
+        values_[offset + j * inner_] = value;
+        if (indices_ != nullptr) {
+          indices_[offset + j * inner_] = items[j].index_;
+        }
+      }
+    }
+  }
+
+ private:
+  const float *input_;
+  float *values_;
+  int64_t *indices_;
+  int n_;
+  int inner_;
+  int k_;
+  bool largest_;
+  bool sorted_;
+  bool softmax_;
+};
+
+uint64_t OpTopK::getFlops() {
+  return base::shapeCount(inputs_[0]->getShape(), 0, -1);
+}
+
+base::Status OpTopK::run() {
+  base::Status status = base::kStatusCodeOk;
+  if (inputs_[0]->getDataType() != base::dataTypeOf<float>()) {
+    NNDEPLOY_LOGE("topk only support float.\n");
+    return base::kStatusCodeErrorNotSupport;
+  }
+  int axis = 0;
+  int k = 0;
+  status = getTopKInfo(this, inputs_, axis, k);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "getTopKInfo failed");
+  auto param = dynamic_cast<ir::TopKParam *>(op_desc_.op_param_.get());
+  bool largest = param == nullptr || param->largest_ != 0;
+  bool sorted = param == nullptr || param->sorted_ != 0;
+  bool softmax = param != nullptr && param->softmax_;
+
+  base::IntVector shape = inputs_[0]->getShape();
+  size_t outer = base::shapeCount(shape, 0, axis);
+  size_t inner = base::shapeCount(shape, axis + 1, -1);
+  int n = shape[axis];
+  size_t rows = outer * inner;
+  if (rows == 0 || k == 0) {
+    return status;
+  }
+
+  int64_t *indices = nullptr;
+  if (outputs_.size() > 1 && outputs_[1] != nullptr) {
+    indices = static_cast<int64_t *>(outputs_[1]->getData());
+  }
+  TopKLoopBody body(static_cast<const float *>(inputs_[0]->getData()),
+                    static_cast<float *>(outputs_[0]->getData()), indices, n,
+                    static_cast<int>(inner), k, largest, sorted, softmax);
+  thread_pool::parallelForWithCost(base::Range(0, (int)rows), body, getFlops());
+
+  return status;
+}
+
+base::Status topK(device::Tensor *input, std::shared_ptr<ir::TopKParam> param,
+                  device::Tensor *values, device::Tensor *indices) {
+  base::Status status = base::kStatusCodeOk;
+
+  Op *op = createOp(input->getDeviceType(), "", ir::kOpTypeTopK);
+  if (op == nullptr) {
+    NNDEPLOY_LOGE("createOp failed");
+    return base::kStatusCodeErrorNotImplement;
+  }
+  status = op->setParam(param);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setParam failed");
+  status = op->setInput(input, 0);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setInput failed");
+  status = op->setOutput(values, 0);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setOutput failed");
+  status = op->setOutput(indices, 1);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setOutput failed");
+  status = op->init();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "init failed");
+  status = op->preRun();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "preRun failed");
+  status = op->checkOrAllocOutput();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk,
+                         "checkOrAllocOutput failed");
+  status = op->run();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "run failed");
+  status = op->postRun();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "postRun failed");
+  status = op->deinit();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "deinit failed");
+
+  delete op;
+
+  return status;
+}
+
+base::Status softmaxTopK(device::Tensor *input,
+                         std::shared_ptr<ir::TopKParam> param,
+                         device::Tensor *values, device::Tensor *indices) {
+  std::shared_ptr<ir::TopKParam> softmax_param =
+      std::make_shared<ir::TopKParam>();
+  if (param != nullptr) {
+    param->copyTo(softmax_param.get());
+  }
+  softmax_param->softmax_ = true;
+  return topK(input, softmax_param, values, indices);
+}
+
+REGISTER_OP_IMPLEMENTION(kDeviceTypeCodeCpu, ir::kOpTypeTopK, OpTopK)
+
+}  // namespace op
+}  // namespace nndeploy
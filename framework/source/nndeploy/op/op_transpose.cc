@@ -3,6 +3,7 @@
 
 #include "nndeploy/base/any.h"
 #include "nndeploy/base/common.h"
+#include "nndeploy/base/cpu_isa.h"
 #include "nndeploy/base/glic_stl_include.h"
 #include "nndeploy/base/log.h"
 #include "nndeploy/base/macro.h"
@@ -17,10 +18,460 @@
 #include "nndeploy/device/tensor.h"
 #include "nndeploy/ir/ir.h"
 #include "nndeploy/op/op.h"
+#include "nndeploy/thread_pool/parallel.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && \
+    (defined(__GNUC__) || defined(__clang__))
+#define NNDEPLOY_TRANSPOSE_X86
+#include <immintrin.h>
+#define NNDEPLOY_TRANSPOSE_AVX __attribute__((target("avx")))
+#endif
 
 namespace nndeploy {
 namespace op {
 
+/**
+ * @brief 2D转置 dst[c * dst_stride + r] = src[r * src_stride + c]
+ * @note stride以元素为单位
+ */
+typedef void (*Transpose2dFunc)(const void *src, size_t src_stride,
+                                void *dst, size_t dst_stride, int rows,
+                                int cols);
+
+// cache块的边长(元素个数)
+static const int kTransposeBlock = 64;
+
+template <typename T>
+static inline void transposeScalar(const T *src, size_t src_stride, T *dst,
+                                   size_t dst_stride, int rows, int cols) {
+  for (int r = 0; r < rows; ++r) {
+    for (int c = 0; c < cols; ++c) {
+      dst[c * dst_stride + r] = src[r * src_stride + c];
+    }
+  }
+}
+
+template <typename T>
+static void transpose2dBlocked(const void *src_ptr, size_t src_stride,
+                               void *dst_ptr, size_t dst_stride, int rows,
+                               int cols) {
+  const T *src = static_cast<const T *>(src_ptr);
+  T *dst = static_cast<T *>(dst_ptr);
+  const int tile = 8;
+  for (int cb = 0; cb < cols; cb += kTransposeBlock) {
+    int ce = std::min(cols, cb + kTransposeBlock);
+    int r = 0;
+    for (; r + tile <= rows; r += tile) {
+      for (int c = cb; c < ce; c += tile) {
+        int n = std::min(tile, ce - c);
+        transposeScalar(src + r * src_stride + c, src_stride,
+                        dst + c * dst_stride + r, dst_stride, tile, n);
+      }
+    }
+    if (r < rows) {
+      transposeScalar(src + r * src_stride + cb, src_stride,
+                      dst + cb * dst_stride + r, dst_stride, rows - r,
+                      ce - cb);
+    }
+  }
+}
+
+#ifdef NNDEPLOY_TRANSPOSE_X86
+
+static inline void transpose4x4Sse(const float *src, size_t src_stride,
+                                   float *dst, size_t dst_stride) {
+  __m128 r0 = _mm_loadu_ps(src);
+  __m128 r1 = _mm_loadu_ps(src + src_stride);
+  __m128 r2 = _mm_loadu_ps(src + 2 * src_stride);
+  __m128 r3 = _mm_loadu_ps(src + 3 * src_stride);
+  _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+  _mm_storeu_ps(dst, r0);
+  _mm_storeu_ps(dst + dst_stride, r1);
+  _mm_storeu_ps(dst + 2 * dst_stride, r2);
+  _mm_storeu_ps(dst + 3 * dst_stride, r3);
+}
+
+NNDEPLOY_TRANSPOSE_AVX static inline void transpose8x8Avx(const float *src,
+                                                          size_t src_stride,
+                                                          float *dst,
+                                                          size_t dst_stride) {
+  __m256 r0 = _mm256_loadu_ps(src);
+  __m256 r1 = _mm256_loadu_ps(src + src_stride);
+  __m256 r2 = _mm256_loadu_ps(src + 2 * src_stride);
+  __m256 r3 = _mm256_loadu_ps(src + 3 * src_stride);
+  __m256 r4 = _mm256_loadu_ps(src + 4 * src_stride);
+  __m256 r5 = _mm256_loadu_ps(src + 5 * src_stride);
+  __m256 r6 = _mm256_loadu_ps(src + 6 * src_stride);
+  __m256 r7 = _mm256_loadu_ps(src + 7 * src_stride);
+  __m256 t0 = _mm256_unpacklo_ps(r0, r1);
+  __m256 t1 = _mm256_unpackhi_ps(r0, r1);
+  __m256 t2 = _mm256_unpacklo_ps(r2, r3);
+  __m256 t3 = _mm256_unpackhi_ps(r2, r3);
+  __m256 t4 = _mm256_unpacklo_ps(r4, r5);
+  __m256 t5 = _mm256_unpackhi_ps(r4, r5);
+  __m256 t6 = _mm256_unpacklo_ps(r6, r7);
+  __m256 t7 = _mm256_unpackhi_ps(r6, r7);
+  __m256 u0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+  __m256 u1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+  __m256 u2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+  __m256 u3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+  __m256 u4 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(1, 0, 1, 0));
+  __m256 u5 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(3, 2, 3, 2));
+  __m256 u6 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(1, 0, 1, 0));
+  __m256 u7 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(3, 2, 3, 2));
+  _mm256_storeu_ps(dst, _mm256_permute2f128_ps(u0, u4, 0x20));
+  _mm256_storeu_ps(dst + dst_stride, _mm256_permute2f128_ps(u1, u5, 0x20));
+  _mm256_storeu_ps(dst + 2 * dst_stride, _mm256_permute2f128_ps(u2, u6, 0x20));
+  _mm256_storeu_ps(dst + 3 * dst_stride, _mm256_permute2f128_ps(u3, u7, 0x20));
+  _mm256_storeu_ps(dst + 4 * dst_stride, _mm256_permute2f128_ps(u0, u4, 0x31));
+  _mm256_storeu_ps(dst + 5 * dst_stride, _mm256_permute2f128_ps(u1, u5, 0x31));
+  _mm256_storeu_ps(dst + 6 * dst_stride, _mm256_permute2f128_ps(u2, u6, 0x31));
+  _mm256_storeu_ps(dst + 7 * dst_stride, _mm256_permute2f128_ps(u3, u7, 0x31));
+}
+
+/**
+ * @brief 4字节元素的2D转置，按tile大小的寄存器kernel分块，边角用标量
+ */
+#define NNDEPLOY_TRANSPOSE_B4_LOOP(attr, name, kernel, tile)                  \
+  attr static void name(const void *src_ptr, size_t src_stride,              \
+                        void *dst_ptr, size_t dst_stride, int rows,          \
+                        int cols) {                                          \
+    const float *src = static_cast<const float *>(src_ptr);                  \
+    float *dst = static_cast<float *>(dst_ptr);                              \
+    for (int cb = 0; cb < cols; cb += kTransposeBlock) {                     \
+      int ce = std::min(cols, cb + kTransposeBlock);                         \
+      int r = 0;                                                             \
+      for (; r + tile <= rows; r += tile) {                                  \
+        int c = cb;                                                          \
+        for (; c + tile <= ce; c += tile) {                                  \
+          kernel(src + r * src_stride + c, src_stride,                       \
+                 dst + c * dst_stride + r, dst_stride);                      \
+        }                                                                    \
+        if (c < ce) {                                                        \
+          transposeScalar(src + r * src_stride + c, src_stride,              \
+                          dst + c * dst_stride + r, dst_stride, tile,        \
+                          ce - c);                                           \
+        }                                                                    \
+      }                                                                      \
+      if (r < rows) {                                                        \
+        transposeScalar(src + r * src_stride + cb, src_stride,               \
+                        dst + cb * dst_stride + r, dst_stride, rows - r,     \
+                        ce - cb);                                            \
+      }                                                                      \
+    }                                                                        \
+  }
+
+NNDEPLOY_TRANSPOSE_B4_LOOP(, transpose2dSse, transpose4x4Sse, 4)
+NNDEPLOY_TRANSPOSE_B4_LOOP(NNDEPLOY_TRANSPOSE_AVX, transpose2dAvx,
+                           transpose8x8Avx, 8)
+
+#endif
+
+// 每次调用时按当前生效的指令集级别选择，AVX包含在kCpuIsaAvx2中
+static Transpose2dFunc selectTranspose2dB4() {
+#ifdef NNDEPLOY_TRANSPOSE_X86
+  if (base::isCpuIsaSupported(base::kCpuIsaAvx2)) {
+    return transpose2dAvx;
+  }
+  return transpose2dSse;
+#else
+  return transpose2dBlocked<uint32_t>;
+#endif
+}
+
+static Transpose2dFunc getTranspose2dFunc(size_t element_size) {
+  switch (element_size) {
+    case 1:
+      return transpose2dBlocked<uint8_t>;
+    case 2:
+      return transpose2dBlocked<uint16_t>;
+    case 4:
+      return selectTranspose2dB4();
+    case 8:
+      return transpose2dBlocked<uint64_t>;
+    default:
+      return nullptr;
+  }
+}
+
+/**
+ * @brief 去掉size为1的维度，合并输入中相邻且在perm中保持顺序的维度
+ */
+static void simplifyPermute(const base::IntVector &input_shape,
+                            const std::vector<int> &perm,
+                            std::vector<size_t> &shape,
+                            std::vector<int> &new_perm) {
+  int rank = static_cast<int>(input_shape.size());
+  // 去掉size为1的维度
+  std::vector<int> index(rank, -1);
+  std::vector<size_t> squeezed;
+  for (int i = 0; i < rank; ++i) {
+    if (input_shape[i] != 1) {
+      index[i] = static_cast<int>(squeezed.size());
+      squeezed.push_back(input_shape[i]);
+    }
+  }
+  std::vector<int> squeezed_perm;
+  for (int i = 0; i < rank; ++i) {
+    if (index[perm[i]] >= 0) {
+      squeezed_perm.push_back(index[perm[i]]);
+    }
+  }
+  // 合并在输出中连续出现的输入维度(输出第k维之后紧跟输入的下一维)
+  int n = static_cast<int>(squeezed.size());
+  std::vector<int> group(n, -1);
+  std::vector<int> group_head;
+  for (int k = 0; k < n; ++k) {
+    int d = squeezed_perm[k];
+    if (k > 0 && squeezed_perm[k - 1] == d - 1) {
+      group[d] = group[d - 1];
+    } else {
+      group[d] = static_cast<int>(group_head.size());
+      group_head.push_back(d);
+    }
+  }
+  // 按输入维度顺序给合并后的维度编号
+  std::vector<int> group_to_input;
+  std::vector<int> group_index(group_head.size(), -1);
+  shape.clear();
+  for (int d = 0; d < n; ++d) {
+    int g = group[d];
+    if (group_index[g] < 0) {
+      group_index[g] = static_cast<int>(shape.size());
+      shape.push_back(squeezed[d]);
+    } else {
+      shape[group_index[g]] *= squeezed[d];
+    }
+  }
+  new_perm.clear();
+  for (size_t g = 0; g < group_head.size(); ++g) {
+    new_perm.push_back(group_index[g]);
+  }
+}
+
+/**
+ * @brief 最内层维度不变，按输出顺序拷贝连续的行
+ */
+class PermuteCopyLoopBody : public thread_pool::ParallelLoopBody {
+ public:
+  PermuteCopyLoopBody(const uint8_t *src, uint8_t *dst,
+                      const std::vector<size_t> &out_shape,
+                      const std::vector<size_t> &in_stride_of_out,
+                      size_t row_bytes)
+      : src_(src),
+        dst_(dst),
+        out_shape_(out_shape),
+        in_stride_of_out_(in_stride_of_out),
+        row_bytes_(row_bytes) {}
+
+  // range为输出行的下标，输出行的维度为out_shape_
+  virtual void operator()(const base::Range &range) const {
+    int rank = static_cast<int>(out_shape_.size());
+    std::vector<size_t> index(rank, 0);
+    size_t rest = range.start_;
+    size_t offset = 0;
+    for (int k = rank - 1; k >= 0; --k) {
+      index[k] = rest % out_shape_[k];
+      rest /= out_shape_[k];
+      offset += index[k] * in_stride_of_out_[k];
+    }
+    uint8_t *dst = dst_ + (size_t)range.start_ * row_bytes_;
+    for (int row = range.start_; row < range.end_; ++row) {
+      memcpy(dst, src_ + offset * row_bytes_, row_bytes_);
+      dst += row_bytes_;
+      for (int k = rank - 1; k >= 0; --k) {
+        offset += in_stride_of_out_[k];
+        if (++index[k] < out_shape_[k]) {
+          break;
+        }
+        offset -= index[k] * in_stride_of_out_[k];
+        index[k] = 0;
+      }
+    }
+  }
+
+ private:
+  const uint8_t *src_;
+  uint8_t *dst_;
+  const std::vector<size_t> &out_shape_;
+  const std::vector<size_t> &in_stride_of_out_;
+  size_t row_bytes_;
+};
+
+/**
+ * @brief 一组2D平面的转置，平面的行为输入维度row_dim，列为输入最内层维度
+ * # 每个task处理一个平面中kTransposeBlock行
+ * # 其余维度按输出顺序排列在batch_shape中
+ */
+class PermutePlaneLoopBody : public thread_pool::ParallelLoopBody {
+ public:
+  PermutePlaneLoopBody(const uint8_t *src, uint8_t *dst, size_t element_size,
+                       const std::vector<size_t> &batch_shape,
+                       const std::vector<size_t> &batch_in_stride,
+                       const std::vector<size_t> &batch_out_stride,
+                       int rows, int cols, size_t src_stride,
+                       size_t dst_stride, Transpose2dFunc func)
+      : src_(src),
+        dst_(dst),
+        element_size_(element_size),
+        batch_shape_(batch_shape),
+        batch_in_stride_(batch_in_stride),
+        batch_out_stride_(batch_out_stride),
+        rows_(rows),
+        cols_(cols),
+        src_stride_(src_stride),
+        dst_stride_(dst_stride),
+        func_(func) {
+    row_blocks_ = (rows + kTransposeBlock - 1) / kTransposeBlock;
+  }
+
+  int getTaskNum() const {
+    size_t batch = 1;
+    for (auto s : batch_shape_) {
+      batch *= s;
+    }
+    return static_cast<int>(batch * row_blocks_);
+  }
+
+  virtual void operator()(const base::Range &range) const {
+    int rank = static_cast<int>(batch_shape_.size());
+    for (int task = range.start_; task < range.end_; ++task) {
+      size_t batch = task / row_blocks_;
+      int r = (task % row_blocks_) * kTransposeBlock;
+      size_t in_offset = 0;
+      size_t out_offset = 0;
+      for (int k = rank - 1; k >= 0; --k) {
+        size_t i = batch % batch_shape_[k];
+        batch /= batch_shape_[k];
+        in_offset += i * batch_in_stride_[k];
+        out_offset += i * batch_out_stride_[k];
+      }
+      in_offset += r * src_stride_;
+      out_offset += r;
+      func_(src_ + in_offset * element_size_, src_stride_,
+            dst_ + out_offset * element_size_, dst_stride_,
+            std::min(kTransposeBlock, rows_ - r), cols_);
+    }
+  }
+
+ private:
+  const uint8_t *src_;
+  uint8_t *dst_;
+  size_t element_size_;
+  const std::vector<size_t> &batch_shape_;
+  const std::vector<size_t> &batch_in_stride_;
+  const std::vector<size_t> &batch_out_stride_;
+  int rows_;
+  int cols_;
+  size_t src_stride_;
+  size_t dst_stride_;
+  Transpose2dFunc func_;
+  int row_blocks_;
+};
+
+base::Status permute(const void *input, const base::IntVector &input_shape,
+                     const std::vector<int> &perm, size_t element_size,
+                     void *output, uint64_t cost) {
+  int rank = static_cast<int>(input_shape.size());
+  if (static_cast<int>(perm.size()) != rank) {
+    NNDEPLOY_LOGE("perm.size() != input_shape.size().\n");
+    return base::kStatusCodeErrorInvalidParam;
+  }
+  std::vector<bool> used(rank, false);
+  for (int i = 0; i < rank; ++i) {
+    if (perm[i] < 0 || perm[i] >= rank || used[perm[i]]) {
+      NNDEPLOY_LOGE("perm is not a permutation.\n");
+      return base::kStatusCodeErrorInvalidParam;
+    }
+    used[perm[i]] = true;
+  }
+  Transpose2dFunc func = getTranspose2dFunc(element_size);
+  if (func == nullptr) {
+    NNDEPLOY_LOGE("element size %zu is not supported.\n", element_size);
+    return base::kStatusCodeErrorNotSupport;
+  }
+
+  std::vector<size_t> shape;
+  std::vector<int> new_perm;
+  simplifyPermute(input_shape, perm, shape, new_perm);
+  size_t total = 1;
+  for (auto s : shape) {
+    total *= s;
+  }
+  for (auto s : input_shape) {
+    if (s == 0) {
+      return base::kStatusCodeOk;
+    }
+  }
+  const uint8_t *src = static_cast<const uint8_t *>(input);
+  uint8_t *dst = static_cast<uint8_t *>(output);
+  rank = static_cast<int>(shape.size());
+  if (rank <= 1) {
+    memcpy(dst, src, total * element_size);
+    return base::kStatusCodeOk;
+  }
+
+  std::vector<size_t> in_stride(rank, 1);
+  for (int d = rank - 2; d >= 0; --d) {
+    in_stride[d] = in_stride[d + 1] * shape[d + 1];
+  }
+  std::vector<size_t> out_stride_of_in(rank, 1);
+  size_t stride = 1;
+  for (int k = rank - 1; k >= 0; --k) {
+    out_stride_of_in[new_perm[k]] = stride;
+    stride *= shape[new_perm[k]];
+  }
+
+  if (new_perm[rank - 1] == rank - 1) {
+    // 最内层维度不变，按输出顺序拷贝连续的行
+    std::vector<size_t> out_shape;
+    std::vector<size_t> in_stride_of_out;
+    for (int k = 0; k < rank - 1; ++k) {
+      out_shape.push_back(shape[new_perm[k]]);
+      in_stride_of_out.push_back(in_stride[new_perm[k]] / shape[rank - 1]);
+    }
+    PermuteCopyLoopBody body(src, dst, out_shape, in_stride_of_out,
+                             shape[rank - 1] * element_size);
+    base::Range range(0, static_cast<int>(total / shape[rank - 1]));
+    thread_pool::parallelForWithCost(range, body, cost);
+    return base::kStatusCodeOk;
+  }
+
+  // 平面的行为输出最内层对应的输入维度，列为输入最内层维度
+  int row_dim = new_perm[rank - 1];
+  int col_dim = rank - 1;
+  std::vector<size_t> batch_shape;
+  std::vector<size_t> batch_in_stride;
+  std::vector<size_t> batch_out_stride;
+  for (int k = 0; k < rank; ++k) {
+    int d = new_perm[k];
+    if (d != row_dim && d != col_dim) {
+      batch_shape.push_back(shape[d]);
+      batch_in_stride.push_back(in_stride[d]);
+      batch_out_stride.push_back(out_stride_of_in[d]);
+    }
+  }
+  PermutePlaneLoopBody body(
+      src, dst, element_size, batch_shape, batch_in_stride, batch_out_stride,
+      static_cast<int>(shape[row_dim]), static_cast<int>(shape[col_dim]),
+      in_stride[row_dim], out_stride_of_in[col_dim], func);
+  base::Range range(0, body.getTaskNum());
+  thread_pool::parallelForWithCost(range, body, cost);
+  return base::kStatusCodeOk;
+}
+
+static std::vector<int> getTransposePerm(const ir::TransposeParam *param,
+                                         int rank) {
+  std::vector<int> perm = param->perm_;
+  if (perm.empty()) {
+    for (int i = rank - 1; i >= 0; --i) {
+      perm.push_back(i);
+    }
+  }
+  return perm;
+}
+
+
 base::Status OpTranspose::inferShape() {
   base::Status status = base::kStatusCodeOk;
   // 参数
@@ -51,22 +502,97 @@ base::Status OpTranspose::inferShape() {
 
 base::Status OpTranspose::inferDataFormat() {
   base::Status status = base::kStatusCodeOk;
-  /*auto output_shape = outputs_[0]->getShape();
-  auto input_shape = inputs_[0]->getShape();*/
-  outputs_[0]->setDataFormat(base::kDataFormatAuto);
+  auto param = dynamic_cast<ir::TransposeParam *>(op_desc_.op_param_.get());
+  NNDEPLOY_CHECK_PARAM_NULL_RET_STATUS(param, "op_desc_.op_param_ is nullptr");
+  base::DataFormat data_format = inputs_[0]->getDataFormat();
+  std::vector<int> perm =
+      getTransposePerm(param, (int)inputs_[0]->getShape().size());
+  if (data_format == base::kDataFormatNCHW &&
+      perm == std::vector<int>({0, 2, 3, 1})) {
+    outputs_[0]->setDataFormat(base::kDataFormatNHWC);
+  } else if (data_format == base::kDataFormatNHWC &&
+             perm == std::vector<int>({0, 3, 1, 2})) {
+    outputs_[0]->setDataFormat(base::kDataFormatNCHW);
+  } else if (data_format == base::kDataFormatNCDHW &&
+             perm == std::vector<int>({0, 2, 3, 4, 1})) {
+    outputs_[0]->setDataFormat(base::kDataFormatNDHWC);
+  } else if (data_format == base::kDataFormatNDHWC &&
+             perm == std::vector<int>({0, 4, 1, 2, 3})) {
+    outputs_[0]->setDataFormat(base::kDataFormatNCDHW);
+  } else {
+    outputs_[0]->setDataFormat(base::kDataFormatAuto);
+  }
   return status;
 }
 
 base::Status OpTranspose::run() {
-  NNDEPLOY_LOGI("not implemented.\n");
-  return base::kStatusCodeOk;
+  auto param = dynamic_cast<ir::TransposeParam *>(op_desc_.op_param_.get());
+  NNDEPLOY_CHECK_PARAM_NULL_RET_STATUS(param, "op_desc_.op_param_ is nullptr");
+  device::Tensor *input = inputs_[0];
+  device::Tensor *output = outputs_[0];
+  const base::IntVector &input_shape = input->getShape();
+  std::vector<int> perm = getTransposePerm(param, (int)input_shape.size());
+  return permute(input->getData(), input_shape, perm,
+                 input->getDataType().size(), output->getData(), getFlops());
 }
 
 base::Status transpose(device::Tensor *input,
                        std::shared_ptr<ir::TransposeParam> param,
                        device::Tensor *output) {
-  NNDEPLOY_LOGI("not implemented.\n");
-  return base::kStatusCodeOk;
+  base::Status status = base::kStatusCodeOk;
+
+  Op *op = createOp(input->getDeviceType(), "", ir::kOpTypeTranspose);
+  if (op == nullptr) {
+    NNDEPLOY_LOGE("createOp failed");
+    return base::kStatusCodeErrorNotImplement;
+  }
+  status = op->setParam(param);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setParam failed");
+  status = op->setInput(input, 0);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setInput failed");
+  status = op->setOutput(output, 0);
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "setOutput failed");
+  status = op->init();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "init failed");
+  status = op->preRun();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "preRun failed");
+  status = op->checkOrAllocOutput();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk,
+                         "checkOrAllocOutput failed");
+  status = op->run();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "run failed");
+  status = op->postRun();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "postRun failed");
+  status = op->deinit();
+  NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "deinit failed");
+  delete op;
+
+  return status;
+}
+
+base::Status convertDataFormat(device::Tensor *input,
+                               base::DataFormat data_format,
+                               device::Tensor *output) {
+  base::DataFormat src = input->getDataFormat();
+  auto param = std::make_shared<ir::TransposeParam>();
+  if (src == base::kDataFormatNCHW && data_format == base::kDataFormatNHWC) {
+    param->perm_ = {0, 2, 3, 1};
+  } else if (src == base::kDataFormatNHWC &&
+             data_format == base::kDataFormatNCHW) {
+    param->perm_ = {0, 3, 1, 2};
+  } else if (src == base::kDataFormatNCDHW &&
+             data_format == base::kDataFormatNDHWC) {
+    param->perm_ = {0, 2, 3, 4, 1};
+  } else if (src == base::kDataFormatNDHWC &&
+             data_format == base::kDataFormatNCDHW) {
+    param->perm_ = {0, 4, 1, 2, 3};
+  } else {
+    NNDEPLOY_LOGE("convert data format from %s to %s is not supported.\n",
+                  base::dataFormatToString(src).c_str(),
+                  base::dataFormatToString(data_format).c_str());
+    return base::kStatusCodeErrorNotSupport;
+  }
+  return transpose(input, param, output);
 }
 
 REGISTER_OP_IMPLEMENTION(kDeviceTypeCodeCpu, ir::kOpTypeTranspose, OpTranspose)
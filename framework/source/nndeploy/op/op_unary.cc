@@ -8,6 +8,7 @@
 #include "nndeploy/base/macro.h"
 #include "nndeploy/base/object.h"
 #include "nndeploy/base/param.h"
+#include "nndeploy/base/shape.h"
 #include "nndeploy/base/status.h"
 #include "nndeploy/base/string.h"
 #include "nndeploy/base/time_profiler.h"
@@ -17,6 +18,9 @@
 #include "nndeploy/device/tensor.h"
 #include "nndeploy/ir/ir.h"
 #include "nndeploy/op/op.h"
+#include "nndeploy/op/util.h"
+#include "nndeploy/op/vec_math.h"
+#include "nndeploy/thread_pool/parallel.h"
 
 namespace nndeploy {
 namespace op {
@@ -27,5 +31,130 @@ base::Status OpUnary::inferShape() {
   return base::kStatusCodeOk;
 }
 
+base::Status OpUnary::run() {
+  VecFunc func = getUnaryFunc(op_desc_.op_type_);
+  if (func == nullptr) {
+    NNDEPLOY_LOGE("unary op[%s] is not implemented.\n",
+                  ir::opTypeToString(op_desc_.op_type_).c_str());
+    return base::kStatusCodeErrorNotImplement;
+  }
+  return unaryElementwise(inputs_[0], outputs_[0], func, getFlops());
+}
+
+static void reluLoop(const float *x, float *y, size_t n) {
+  for (size_t i = 0; i < n; ++i) {
+    y[i] = x[i] > 0.0f ? x[i] : 0.0f;
+  }
+}
+
+static void sqrtLoop(const float *x, float *y, size_t n) {
+  for (size_t i = 0; i < n; ++i) {
+    y[i] = std::sqrt(x[i]);
+  }
+}
+
+VecFunc getUnaryFunc(ir::OpType op_type) {
+  switch (op_type) {
+    case ir::kOpTypeRelu:
+      return reluLoop;
+    case ir::kOpTypeSigmoid:
+      return vecSigmoid;
+    case ir::kOpTypeExp:
+      return vecExp;
+    case ir::kOpTypeTanh:
+      return vecTanh;
+    case ir::kOpTypeErf:
+      return vecErf;
+    case ir::kOpTypeGelu:
+      return vecGelu;
+    case ir::kOpTypeSilu:
+      return vecSilu;
+    case ir::kOpTypeSqrt:
+      return sqrtLoop;
+    default:
+      return nullptr;
+  }
+}
+
+// 单个任务的元素数
+static const size_t kUnaryGrainSize = 16 * 1024;
+// 半精度数据每次转换为float计算的元素数
+static const size_t kUnaryHalfChunk = 1024;
+
+class UnaryLoopBody : public thread_pool::ParallelLoopBody {
+ public:
+  UnaryLoopBody(const void *input, void *output, size_t size, VecFunc func,
+                const base::DataType &data_type)
+      : input_(input),
+        output_(output),
+        size_(size),
+        func_(func),
+        data_type_(data_type) {}
+
+  virtual void operator()(const base::Range &range) const {
+    size_t element_size = data_type_.size();
+    bool is_float = data_type_ == base::dataTypeOf<float>();
+    float buffer[kUnaryHalfChunk];
+    for (int task = range.start_; task < range.end_; ++task) {
+      size_t begin = task * kUnaryGrainSize;
+      size_t size = std::min(kUnaryGrainSize, size_ - begin);
+      const char *x = static_cast<const char *>(input_) + begin * element_size;
+      char *y = static_cast<char *>(output_) + begin * element_size;
+      if (is_float) {
+        func_(reinterpret_cast<const float *>(x), reinterpret_cast<float *>(y),
+              size);
+        continue;
+      }
+      // 半精度：读取时转换为float，计算后再转换写回
+      for (size_t i = 0; i < size; i += kUnaryHalfChunk) {
+        size_t n = std::min(kUnaryHalfChunk, size - i);
+        convertToFloat(x + i * element_size, data_type_, buffer, n);
+        func_(buffer, buffer, n);
+        convertFromFloat(buffer, data_type_, y + i * element_size, n);
+      }
+    }
+  }
+
+ private:
+  const void *input_;
+  void *output_;
+  size_t size_;
+  VecFunc func_;
+  base::DataType data_type_;
+};
+
+base::Status unaryElementwise(device::Tensor *input, device::Tensor *output,
+                              VecFunc func, uint64_t cost) {
+  base::DataType data_type = input->getDataType();
+  if ((data_type != base::dataTypeOf<float>() && !isHalfDataType(data_type)) ||
+      output->getDataType() != data_type) {
+    NNDEPLOY_LOGE("unaryElementwise only support fp32/fp16/bf16.\n");
+    return base::kStatusCodeErrorNotSupport;
+  }
+  base::IntVector shape = input->getShape();
+  if (output->getShape() != shape) {
+    NNDEPLOY_LOGE("output shape is not equal to input shape.\n");
+    return base::kStatusCodeErrorInvalidParam;
+  }
+  if (base::getChannelBlock(input->getDataFormat()) !=
+      base::getChannelBlock(output->getDataFormat())) {
+    NNDEPLOY_LOGE("output channel block is not equal to input.\n");
+    return base::kStatusCodeErrorInvalidParam;
+  }
+  // 逐元素计算与布局无关，通道分块格式连同补齐的通道一起计算，
+  // 最后再将补齐的通道写0
+  size_t size = base::shapeCountByDataFormat(shape, input->getDataFormat());
+  if (size == 0) {
+    return base::kStatusCodeOk;
+  }
+  int tasks = static_cast<int>((size + kUnaryGrainSize - 1) / kUnaryGrainSize);
+  UnaryLoopBody body(input->getData(), output->getData(), size, func,
+                     data_type);
+  thread_pool::parallelForWithCost(base::Range(0, tasks), body, cost);
+  // Sigmoid、Exp等f(0)不为0，补齐的通道重新写0
+  zeroChannelPadding(output, cost);
+  return base::kStatusCodeOk;
+}
+
 }  // namespace op
 }  // namespace nndeploy
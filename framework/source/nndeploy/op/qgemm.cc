@@ -0,0 +1,665 @@
+#include "nndeploy/op/qgemm.h"
+
+#include "nndeploy/base/common.h"
+#include "nndeploy/base/cpu_isa.h"
+#include "nndeploy/base/glic_stl_include.h"
+#include "nndeploy/base/log.h"
+#include "nndeploy/base/macro.h"
+#include "nndeploy/base/status.h"
+#include "nndeploy/device/tensor.h"
+#include "nndeploy/op/sgemm.h"
+#include "nndeploy/thread_pool/parallel.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && \
+    (defined(__GNUC__) || defined(__clang__))
+#define NNDEPLOY_QGEMM_X86
+#include <immintrin.h>
+#define NNDEPLOY_QGEMM_AVX2 __attribute__((target("avx2,fma")))
+#define NNDEPLOY_QGEMM_AVX512_VNNI \
+  __attribute__((target("avx2,fma,avx512f,avx512bw,avx512vl,avx512vnni")))
+#endif
+
+namespace nndeploy {
+namespace op {
+
+// 寄存器内同时计算的A的行数，每次读取的权重与这些行复用
+static const int kQGemmMr = 4;
+// 每个任务计算的输出通道数
+static const int kQGemmNr = 16;
+// simd kernel每次处理的码值个数
+static const int kQGemmChunk = 32;
+// m不小于该值时按N分块反量化后调用sgemm
+static const int kQGemmDequantM = 16;
+// 反量化分块的输出通道数
+static const int kQGemmPanelN = 128;
+// 打包buffer与workspace的对齐
+static const size_t kQGemmAlign = 64;
+
+static size_t alignQGemmSize(size_t size) {
+  return (size + kQGemmAlign - 1) / kQGemmAlign * kQGemmAlign;
+}
+
+/**
+ * @brief 打包权重的头部，紧随其后依次为码值[N][row_bytes_]、
+ * scale[N][group_num_]与scale * zero_point[N][group_num_]
+ */
+struct QGemmPackedHeader {
+  int n_;
+  int k_;
+  int group_size_;
+  int group_num_;
+  // 为true时int4按32个一组打包，否则每个码值一个字节
+  bool is_nibble_;
+  // 为true时可以走simd kernel
+  bool is_simd_;
+  size_t row_bytes_;
+  size_t scales_offset_;
+  size_t zeros_offset_;
+};
+
+bool isQGemmDataType(const base::DataType &data_type) {
+  if (data_type.code_ != base::kDataTypeCodeInt &&
+      data_type.code_ != base::kDataTypeCodeUint) {
+    return false;
+  }
+  return (data_type.bits_ == 8 && data_type.lanes_ == 1) ||
+         (data_type.bits_ == 4 && data_type.lanes_ == 2);
+}
+
+base::Status getQGemmWeight(device::Tensor *weight, device::Tensor *scale,
+                            device::Tensor *zero_point,
+                            QGemmWeight &qweight) {
+  if (weight == nullptr || !isQGemmDataType(weight->getDataType())) {
+    NNDEPLOY_LOGE("weight must be int8/uint8/int4x2/uint4x2.\n");
+    return base::kStatusCodeErrorInvalidParam;
+  }
+  if (scale == nullptr || scale->getDataType() != base::dataTypeOf<float>()) {
+    NNDEPLOY_LOGE("quantized weight requires float scale.\n");
+    return base::kStatusCodeErrorInvalidParam;
+  }
+  base::DataType data_type = weight->getDataType();
+  base::IntVector weight_shape = weight->getShape();
+  base::IntVector scale_shape = scale->getShape();
+  if (weight_shape.size() != 2 || scale_shape.size() != 2 ||
+      scale_shape[0] != weight_shape[0] || scale_shape[1] <= 0) {
+    NNDEPLOY_LOGE("weight must be [N, K] and scale must be [N, groups].\n");
+    return base::kStatusCodeErrorInvalidParam;
+  }
+  int k = weight_shape[1] * data_type.lanes_;
+  int group_num = scale_shape[1];
+  if (k % group_num != 0) {
+    NNDEPLOY_LOGE("K[%d] is not divisible by group num[%d].\n", k, group_num);
+    return base::kStatusCodeErrorInvalidParam;
+  }
+  if (zero_point != nullptr) {
+    base::IntVector zero_shape = zero_point->getShape();
+    int zero_num = (group_num + data_type.lanes_ - 1) / data_type.lanes_;
+    if (zero_point->getDataType() != data_type || zero_shape.size() != 2 ||
+        zero_shape[0] != weight_shape[0] || zero_shape[1] != zero_num) {
+      NNDEPLOY_LOGE("zero point does not match weight.\n");
+      return base::kStatusCodeErrorInvalidParam;
+    }
+  }
+  qweight.data_type_ = data_type;
+  qweight.n_ = weight_shape[0];
+  qweight.k_ = k;
+  qweight.group_size_ = k / group_num;
+  qweight.data_ = weight->getData();
+  qweight.scales_ = static_cast<const float *>(scale->getData());
+  qweight.zero_points_ =
+      zero_point != nullptr ? zero_point->getData() : nullptr;
+  return base::kStatusCodeOk;
+}
+
+static void getQGemmPackedHeader(const QGemmWeight &qweight,
+                                 QGemmPackedHeader &header) {
+  header.n_ = qweight.n_;
+  header.k_ = qweight.k_;
+  header.group_size_ = qweight.group_size_;
+  header.group_num_ = qweight.k_ / qweight.group_size_;
+  header.is_simd_ = qweight.group_size_ % kQGemmChunk == 0;
+  header.is_nibble_ = qweight.data_type_.bits_ == 4 && header.is_simd_;
+  header.row_bytes_ = header.is_nibble_ ? qweight.k_ / 2 : qweight.k_;
+  size_t codes_offset = alignQGemmSize(sizeof(QGemmPackedHeader));
+  header.scales_offset_ =
+      codes_offset + alignQGemmSize(header.row_bytes_ * header.n_);
+  header.zeros_offset_ =
+      header.scales_offset_ +
+      alignQGemmSize(sizeof(float) * header.group_num_ * header.n_);
+}
+
+size_t qgemmPackedBSize(const QGemmWeight &qweight) {
+  QGemmPackedHeader header;
+  getQGemmPackedHeader(qweight, header);
+  return header.zeros_offset_ +
+         alignQGemmSize(sizeof(float) * header.group_num_ * header.n_);
+}
+
+// 第index个量化值，int4时低4位为偶数下标
+static inline int getQuantValue(const uint8_t *data, size_t index, int bits,
+                                bool is_signed) {
+  if (bits == 8) {
+    return is_signed ? static_cast<int8_t>(data[index]) : data[index];
+  }
+  int value = (index & 1) ? (data[index >> 1] >> 4) : (data[index >> 1] & 0xF);
+  return is_signed ? (value ^ 8) - 8 : value;
+}
+
+base::Status qgemmPackB(const QGemmWeight &qweight, void *packed_b) {
+  if (!isQGemmDataType(qweight.data_type_) || qweight.group_size_ <= 0 ||
+      qweight.k_ % qweight.group_size_ != 0) {
+    NNDEPLOY_LOGE("invalid quantized weight.\n");
+    return base::kStatusCodeErrorInvalidParam;
+  }
+  QGemmPackedHeader header;
+  getQGemmPackedHeader(qweight, header);
+  uint8_t *dst = static_cast<uint8_t *>(packed_b);
+  memcpy(dst, &header, sizeof(header));
+  uint8_t *codes = dst + alignQGemmSize(sizeof(QGemmPackedHeader));
+  float *scales = reinterpret_cast<float *>(dst + header.scales_offset_);
+  float *zeros = reinterpret_cast<float *>(dst + header.zeros_offset_);
+
+  const int bits = qweight.data_type_.bits_;
+  const bool is_signed = qweight.data_type_.code_ == base::kDataTypeCodeInt;
+  // 有符号码值加上偏移转为无符号
+  const int offset = is_signed ? (1 << (bits - 1)) : 0;
+  const uint8_t *src = static_cast<const uint8_t *>(qweight.data_);
+  const uint8_t *src_zeros =
+      static_cast<const uint8_t *>(qweight.zero_points_);
+  const int k = header.k_;
+  const int group_num = header.group_num_;
+  const int zero_stride =
+      (group_num + qweight.data_type_.lanes_ - 1) / qweight.data_type_.lanes_;
+  for (int n = 0; n < header.n_; ++n) {
+    uint8_t *row = codes + n * header.row_bytes_;
+    size_t base = (size_t)n * k;
+    if (header.is_nibble_) {
+      for (int c = 0; c < k; c += kQGemmChunk) {
+        for (int j = 0; j < kQGemmChunk / 2; ++j) {
+          int lo = getQuantValue(src, base + c + j, bits, is_signed) + offset;
+          int hi = getQuantValue(src, base + c + j + kQGemmChunk / 2, bits,
+                                 is_signed) +
+                   offset;
+          row[c / 2 + j] = static_cast<uint8_t>(lo | (hi << 4));
+        }
+      }
+    } else {
+      for (int i = 0; i < k; ++i) {
+        row[i] = static_cast<uint8_t>(
+            getQuantValue(src, base + i, bits, is_signed) + offset);
+      }
+    }
+    for (int g = 0; g < group_num; ++g) {
+      float scale = qweight.scales_[(size_t)n * group_num + g];
+      int zero = 0;
+      if (src_zeros != nullptr) {
+        zero = getQuantValue(src_zeros + (size_t)n * zero_stride, g, bits,
+                             is_signed);
+      }
+      scales[(size_t)n * group_num + g] = scale;
+      zeros[(size_t)n * group_num + g] = scale * (zero + offset);
+    }
+  }
+  return base::kStatusCodeOk;
+}
+
+/**
+ * @brief 量化GEMV的参数
+ * # x_sums_为A每组元素之和，int8激活时为反量化后的和
+ * # x_int8_与x_scales_为按组动态量化的A，只在int8激活的kernel中使用
+ */
+struct QGemvArgs {
+  const QGemmPackedHeader *header_;
+  const uint8_t *codes_;
+  const float *scales_;
+  const float *zeros_;
+  const float *a_;
+  int lda_;
+  const int8_t *x_int8_;
+  const float *x_scales_;
+  const float *x_sums_;
+  float *c_;
+  int ldc_;
+  float alpha_;
+  float beta_;
+};
+
+// 打包后第i个码值
+static inline int getPackedCode(const QGemmPackedHeader &header,
+                                const uint8_t *row, int i) {
+  if (!header.is_nibble_) {
+    return row[i];
+  }
+  int j = i % kQGemmChunk;
+  uint8_t byte = row[(i - j) / 2 + j % (kQGemmChunk / 2)];
+  return j < kQGemmChunk / 2 ? (byte & 0xF) : (byte >> 4);
+}
+
+typedef void (*QGemvFunc)(const QGemvArgs &args, int m_begin, int mr,
+                          int n_begin, int n_end);
+
+static inline void storeQGemmOutput(const QGemvArgs &args, int m, int n,
+                                    float value) {
+  float *c = args.c_ + (size_t)m * args.ldc_ + n;
+  *c = args.beta_ == 0.0f ? args.alpha_ * value
+                          : args.alpha_ * value + args.beta_ * (*c);
+}
+
+static void qgemvScalar(const QGemvArgs &args, int m_begin, int mr,
+                        int n_begin, int n_end) {
+  const QGemmPackedHeader &header = *args.header_;
+  const int group_size = header.group_size_;
+  const int group_num = header.group_num_;
+  for (int n = n_begin; n < n_end; ++n) {
+    const uint8_t *row = args.codes_ + n * header.row_bytes_;
+    const float *scales = args.scales_ + (size_t)n * group_num;
+    const float *zeros = args.zeros_ + (size_t)n * group_num;
+    for (int r = 0; r < mr; ++r) {
+      int m = m_begin + r;
+      const float *x = args.a_ + (size_t)m * args.lda_;
+      const float *x_sums = args.x_sums_ + (size_t)m * group_num;
+      float sum = 0.0f;
+      for (int g = 0; g < group_num; ++g) {
+        float group_sum = 0.0f;
+        for (int i = g * group_size; i < (g + 1) * group_size; ++i) {
+          group_sum += getPackedCode(header, row, i) * x[i];
+        }
+        sum += scales[g] * group_sum - zeros[g] * x_sums[g];
+      }
+      storeQGemmOutput(args, m, n, sum);
+    }
+  }
+}
+
+#ifdef NNDEPLOY_QGEMM_X86
+NNDEPLOY_QGEMM_AVX2 static inline float reduceSumQGemmAvx2(__m256 v) {
+  __m128 lo = _mm256_castps256_ps128(v);
+  __m128 hi = _mm256_extractf128_ps(v, 1);
+  lo = _mm_add_ps(lo, hi);
+  lo = _mm_add_ps(lo, _mm_movehl_ps(lo, lo));
+  lo = _mm_add_ss(lo, _mm_movehdup_ps(lo));
+  return _mm_cvtss_f32(lo);
+}
+
+// 解出连续32个码值，lo为[0, 16)，hi为[16, 32)
+NNDEPLOY_QGEMM_AVX2 static inline void loadQGemmCodesAvx2(
+    const uint8_t *row, int k, bool is_nibble, __m128i &lo, __m128i &hi) {
+  if (is_nibble) {
+    const __m128i mask = _mm_set1_epi8(0x0F);
+    __m128i bytes =
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(row + k / 2));
+    lo = _mm_and_si128(bytes, mask);
+    hi = _mm_and_si128(_mm_srli_epi16(bytes, 4), mask);
+  } else {
+    lo = _mm_loadu_si128(reinterpret_cast<const __m128i *>(row + k));
+    hi = _mm_loadu_si128(reinterpret_cast<const __m128i *>(row + k + 16));
+  }
+}
+
+/**
+ * @brief avx2的量化GEMV，码值在寄存器内转为float与A做fma
+ * # 组内先累加不带scale的点积，组末再乘scale，行数少时用多个累加器打断依赖链
+ */
+template <int MR>
+NNDEPLOY_QGEMM_AVX2 static void qgemvAvx2Impl(const QGemvArgs &args,
+                                              int m_begin, int n_begin,
+                                              int n_end) {
+  const int kAcc = MR == 1 ? 4 : (MR == 2 ? 2 : 1);
+  const QGemmPackedHeader &header = *args.header_;
+  const int group_size = header.group_size_;
+  const int group_num = header.group_num_;
+  const float *x[MR];
+  const float *x_sums[MR];
+  for (int r = 0; r < MR; ++r) {
+    x[r] = args.a_ + (size_t)(m_begin + r) * args.lda_;
+    x_sums[r] = args.x_sums_ + (size_t)(m_begin + r) * group_num;
+  }
+  for (int n = n_begin; n < n_end; ++n) {
+    const uint8_t *row = args.codes_ + n * header.row_bytes_;
+    const float *scales = args.scales_ + (size_t)n * group_num;
+    const float *zeros = args.zeros_ + (size_t)n * group_num;
+    __m256 acc[MR];
+    float zero_sum[MR];
+    for (int r = 0; r < MR; ++r) {
+      acc[r] = _mm256_setzero_ps();
+      zero_sum[r] = 0.0f;
+    }
+    for (int g = 0; g < group_num; ++g) {
+      __m256 group_acc[MR][kAcc];
+      for (int r = 0; r < MR; ++r) {
+        for (int i = 0; i < kAcc; ++i) {
+          group_acc[r][i] = _mm256_setzero_ps();
+        }
+      }
+      for (int k = g * group_size; k < (g + 1) * group_size;
+           k += kQGemmChunk) {
+        __m128i lo, hi;
+        loadQGemmCodesAvx2(row, k, header.is_nibble_, lo, hi);
+        __m256 w[4];
+        w[0] = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(lo));
+        w[1] = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_srli_si128(lo, 8)));
+        w[2] = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(hi));
+        w[3] = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_srli_si128(hi, 8)));
+        for (int p = 0; p < 4; ++p) {
+          for (int r = 0; r < MR; ++r) {
+            group_acc[r][p % kAcc] =
+                _mm256_fmadd_ps(w[p], _mm256_loadu_ps(x[r] + k + p * 8),
+                                group_acc[r][p % kAcc]);
+          }
+        }
+      }
+      __m256 scale = _mm256_set1_ps(scales[g]);
+      for (int r = 0; r < MR; ++r) {
+        for (int i = 1; i < kAcc; ++i) {
+          group_acc[r][0] = _mm256_add_ps(group_acc[r][0], group_acc[r][i]);
+        }
+        acc[r] = _mm256_fmadd_ps(group_acc[r][0], scale, acc[r]);
+        zero_sum[r] += zeros[g] * x_sums[r][g];
+      }
+    }
+    for (int r = 0; r < MR; ++r) {
+      storeQGemmOutput(args, m_begin + r, n,
+                       reduceSumQGemmAvx2(acc[r]) - zero_sum[r]);
+    }
+  }
+}
+
+static void qgemvAvx2(const QGemvArgs &args, int m_begin, int mr, int n_begin,
+                      int n_end) {
+  switch (mr) {
+    case 1:
+      qgemvAvx2Impl<1>(args, m_begin, n_begin, n_end);
+      break;
+    case 2:
+      qgemvAvx2Impl<2>(args, m_begin, n_begin, n_end);
+      break;
+    case 3:
+      qgemvAvx2Impl<3>(args, m_begin, n_begin, n_end);
+      break;
+    default:
+      qgemvAvx2Impl<4>(args, m_begin, n_begin, n_end);
+      break;
+  }
+}
+
+/**
+ * @brief avx512vnni的量化GEMV，A已按组量化为int8
+ * # vpdpbusd计算u8码值与s8激活的点积，组末转为float并乘上两者的scale
+ * # 使用256位寄存器(avx512vl)，访存瓶颈下与512位吞吐相当且不触发降频
+ */
+template <int MR>
+NNDEPLOY_QGEMM_AVX512_VNNI static void qgemvAvx512VnniImpl(
+    const QGemvArgs &args, int m_begin, int n_begin, int n_end) {
+  const int kAcc = MR == 1 ? 2 : 1;
+  const QGemmPackedHeader &header = *args.header_;
+  const int group_size = header.group_size_;
+  const int group_num = header.group_num_;
+  const int8_t *x[MR];
+  const float *x_scales[MR];
+  const float *x_sums[MR];
+  for (int r = 0; r < MR; ++r) {
+    x[r] = args.x_int8_ + (size_t)(m_begin + r) * header.k_;
+    x_scales[r] = args.x_scales_ + (size_t)(m_begin + r) * group_num;
+    x_sums[r] = args.x_sums_ + (size_t)(m_begin + r) * group_num;
+  }
+  for (int n = n_begin; n < n_end; ++n) {
+    const uint8_t *row = args.codes_ + n * header.row_bytes_;
+    const float *scales = args.scales_ + (size_t)n * group_num;
+    const float *zeros = args.zeros_ + (size_t)n * group_num;
+    __m256 acc[MR];
+    float zero_sum[MR];
+    for (int r = 0; r < MR; ++r) {
+      acc[r] = _mm256_setzero_ps();
+      zero_sum[r] = 0.0f;
+    }
+    for (int g = 0; g < group_num; ++g) {
+      __m256i group_acc[MR][kAcc];
+      for (int r = 0; r < MR; ++r) {
+        for (int i = 0; i < kAcc; ++i) {
+          group_acc[r][i] = _mm256_setzero_si256();
+        }
+      }
+      int chunk = 0;
+      for (int k = g * group_size; k < (g + 1) * group_size;
+           k += kQGemmChunk, ++chunk) {
+        __m128i lo, hi;
+        loadQGemmCodesAvx2(row, k, header.is_nibble_, lo, hi);
+        __m256i w = _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+        for (int r = 0; r < MR; ++r) {
+          __m256i xv =
+              _mm256_loadu_si256(reinterpret_cast<const __m256i *>(x[r] + k));
+          group_acc[r][chunk % kAcc] =
+              _mm256_dpbusd_epi32(group_acc[r][chunk % kAcc], w, xv);
+        }
+      }
+      for (int r = 0; r < MR; ++r) {
+        for (int i = 1; i < kAcc; ++i) {
+          group_acc[r][0] = _mm256_add_epi32(group_acc[r][0], group_acc[r][i]);
+        }
+        acc[r] = _mm256_fmadd_ps(_mm256_cvtepi32_ps(group_acc[r][0]),
+                                 _mm256_set1_ps(scales[g] * x_scales[r][g]),
+                                 acc[r]);
+        zero_sum[r] += zeros[g] * x_sums[r][g];
+      }
+    }
+    for (int r = 0; r < MR; ++r) {
+      storeQGemmOutput(args, m_begin + r, n,
+                       reduceSumQGemmAvx2(acc[r]) - zero_sum[r]);
+    }
+  }
+}
+
+static void qgemvAvx512Vnni(const QGemvArgs &args, int m_begin, int mr,
+                            int n_begin, int n_end) {
+  switch (mr) {
+    case 1:
+      qgemvAvx512VnniImpl<1>(args, m_begin, n_begin, n_end);
+      break;
+    case 2:
+      qgemvAvx512VnniImpl<2>(args, m_begin, n_begin, n_end);
+      break;
+    case 3:
+      qgemvAvx512VnniImpl<3>(args, m_begin, n_begin, n_end);
+      break;
+    default:
+      qgemvAvx512VnniImpl<4>(args, m_begin, n_begin, n_end);
+      break;
+  }
+}
+#endif
+
+/**
+ * @brief 按cpu特性选择的量化GEMV kernel
+ * # is_int8_act_为true时A需要先按组量化为int8
+ */
+struct QGemvKernel {
+  const char *name_;
+  bool is_int8_act_;
+  QGemvFunc gemv_;
+};
+
+#ifdef NNDEPLOY_QGEMM_X86
+static const QGemvKernel kQGemvAvx512Vnni = {"avx512vnni", true,
+                                             qgemvAvx512Vnni};
+static const QGemvKernel kQGemvAvx2 = {"avx2", false, qgemvAvx2};
+#endif
+static const QGemvKernel kQGemvScalar = {"scalar", false, qgemvScalar};
+
+// 每次调用时按当前生效的指令集级别选择，受base::setCpuIsa的限制
+static const QGemvKernel &getQGemvKernel() {
+#ifdef NNDEPLOY_QGEMM_X86
+  if (base::isCpuIsaSupported(base::kCpuIsaAvx512Vnni)) {
+    return kQGemvAvx512Vnni;
+  }
+  if (base::isCpuIsaSupported(base::kCpuIsaAvx2)) {
+    return kQGemvAvx2;
+  }
+#endif
+  return kQGemvScalar;
+}
+
+// 每组A的和，以及int8激活时按组的对称量化
+static void prepareQGemvInput(const QGemmPackedHeader &header, int m,
+                              const float *a, int lda, bool is_int8_act,
+                              int8_t *x_int8, float *x_scales,
+                              float *x_sums) {
+  const int group_size = header.group_size_;
+  const int group_num = header.group_num_;
+  for (int i = 0; i < m; ++i) {
+    const float *x = a + (size_t)i * lda;
+    for (int g = 0; g < group_num; ++g) {
+      const float *src = x + g * group_size;
+      size_t index = (size_t)i * group_num + g;
+      if (!is_int8_act) {
+        float sum = 0.0f;
+        for (int j = 0; j < group_size; ++j) {
+          sum += src[j];
+        }
+        x_sums[index] = sum;
+        continue;
+      }
+      float amax = 0.0f;
+      for (int j = 0; j < group_size; ++j) {
+        amax = std::max(amax, std::fabs(src[j]));
+      }
+      float scale = amax / 127.0f;
+      float inv_scale = amax > 0.0f ? 127.0f / amax : 0.0f;
+      int8_t *dst = x_int8 + (size_t)i * header.k_ + g * group_size;
+      int sum = 0;
+      for (int j = 0; j < group_size; ++j) {
+        int value = static_cast<int>(std::nearbyint(src[j] * inv_scale));
+        dst[j] = static_cast<int8_t>(value);
+        sum += value;
+      }
+      x_scales[index] = scale;
+      x_sums[index] = scale * sum;
+    }
+  }
+}
+
+class QGemvLoopBody : public thread_pool::ParallelLoopBody {
+ public:
+  QGemvLoopBody(const QGemvArgs &args, QGemvFunc gemv, int m)
+      : args_(args), gemv_(gemv), m_(m) {}
+
+  virtual void operator()(const base::Range &range) const {
+    for (int task = range.start_; task < range.end_; ++task) {
+      int n_begin = task * kQGemmNr;
+      int n_end = std::min(n_begin + kQGemmNr, args_.header_->n_);
+      for (int m = 0; m < m_; m += kQGemmMr) {
+        gemv_(args_, m, std::min(kQGemmMr, m_ - m), n_begin, n_end);
+      }
+    }
+  }
+
+ private:
+  QGemvArgs args_;
+  QGemvFunc gemv_;
+  int m_;
+};
+
+// 反量化[n_begin, n_end)的权重为float，布局为[n][k]
+static void dequantizeQGemmPanel(const QGemmPackedHeader &header,
+                                 const uint8_t *codes, const float *scales,
+                                 const float *zeros, int n_begin, int n_end,
+                                 float *panel) {
+  const int k = header.k_;
+  const int group_size = header.group_size_;
+  const int group_num = header.group_num_;
+  for (int n = n_begin; n < n_end; ++n) {
+    const uint8_t *row = codes + n * header.row_bytes_;
+    float *dst = panel + (size_t)(n - n_begin) * k;
+    for (int i = 0; i < k; ++i) {
+      size_t g = (size_t)n * group_num + i / group_size;
+      dst[i] = getPackedCode(header, row, i) * scales[g] - zeros[g];
+    }
+  }
+}
+
+size_t qgemmWorkspaceSize(int m, int n, int k, int group_size) {
+  if (m >= kQGemmDequantM) {
+    int panel_n = std::min(kQGemmPanelN, n);
+    return alignQGemmSize(sizeof(float) * panel_n * k) +
+           sgemmWorkspaceSize(m, panel_n, k);
+  }
+  size_t group_num = group_size > 0 ? k / group_size : k;
+  return alignQGemmSize((size_t)m * k) +
+         2 * alignQGemmSize(sizeof(float) * m * group_num);
+}
+
+base::Status qgemm(int m, int n, int k, float alpha, float beta,
+                   const float *a, int lda, const void *packed_b, float *c,
+                   int ldc, void *workspace) {
+  const uint8_t *src = static_cast<const uint8_t *>(packed_b);
+  const QGemmPackedHeader *header =
+      reinterpret_cast<const QGemmPackedHeader *>(src);
+  if (header->n_ != n || header->k_ != k) {
+    NNDEPLOY_LOGE("packed weight is [%d, %d], expect [%d, %d].\n", header->n_,
+                  header->k_, n, k);
+    return base::kStatusCodeErrorInvalidParam;
+  }
+  const uint8_t *codes = src + alignQGemmSize(sizeof(QGemmPackedHeader));
+  const float *scales =
+      reinterpret_cast<const float *>(src + header->scales_offset_);
+  const float *zeros =
+      reinterpret_cast<const float *>(src + header->zeros_offset_);
+  uint8_t *ws = static_cast<uint8_t *>(workspace);
+
+  // prefill: 计算密集，分块反量化后复用sgemm
+  if (m >= kQGemmDequantM) {
+    int panel_n = std::min(kQGemmPanelN, n);
+    float *panel = reinterpret_cast<float *>(ws);
+    void *sgemm_workspace = ws + alignQGemmSize(sizeof(float) * panel_n * k);
+    SgemmParam param;
+    param.trans_b_ = true;
+    param.alpha_ = alpha;
+    param.beta_ = beta;
+    SgemmEpilogue epilogue;
+    for (int n_begin = 0; n_begin < n; n_begin += panel_n) {
+      int n_end = std::min(n_begin + panel_n, n);
+      dequantizeQGemmPanel(*header, codes, scales, zeros, n_begin, n_end,
+                           panel);
+      base::Status status =
+          sgemm(param, m, n_end - n_begin, k, a, lda, panel, k, c + n_begin,
+                ldc, epilogue, sgemm_workspace);
+      NNDEPLOY_RETURN_ON_NEQ(status, base::kStatusCodeOk, "sgemm failed");
+    }
+    return base::kStatusCodeOk;
+  }
+
+  // decode: 访存密集，权重在寄存器内反量化
+  const QGemvKernel &kernel = getQGemvKernel();
+  QGemvFunc gemv = header->is_simd_ ? kernel.gemv_ : qgemvScalar;
+  bool is_int8_act = header->is_simd_ && kernel.is_int8_act_;
+  size_t x_size = alignQGemmSize(sizeof(float) * m * header->group_num_);
+  int8_t *x_int8 = reinterpret_cast<int8_t *>(ws);
+  float *x_scales =
+      reinterpret_cast<float *>(ws + alignQGemmSize((size_t)m * k));
+  float *x_sums = reinterpret_cast<float *>(
+      ws + alignQGemmSize((size_t)m * k) + x_size);
+  prepareQGemvInput(*header, m, a, lda, is_int8_act, x_int8, x_scales,
+                    x_sums);
+
+  QGemvArgs args;
+  args.header_ = header;
+  args.codes_ = codes;
+  args.scales_ = scales;
+  args.zeros_ = zeros;
+  args.a_ = a;
+  args.lda_ = lda;
+  args.x_int8_ = x_int8;
+  args.x_scales_ = x_scales;
+  args.x_sums_ = x_sums;
+  args.c_ = c;
+  args.ldc_ = ldc;
+  args.alpha_ = alpha;
+  args.beta_ = beta;
+  QGemvLoopBody body(args, gemv, m);
+  int task_num = (n + kQGemmNr - 1) / kQGemmNr;
+  thread_pool::parallelForWithCost(base::Range(0, task_num), body,
+                                    (uint64_t)m * n * k);
+  return base::kStatusCodeOk;
+}
+
+}  // namespace op
+}  // namespace nndeploy
@@ -0,0 +1,763 @@
+
+#include "nndeploy/op/sgemm.h"
+
+#include "nndeploy/base/common.h"
+#include "nndeploy/base/cpu_isa.h"
+#include "nndeploy/base/glic_stl_include.h"
+#include "nndeploy/base/log.h"
+#include "nndeploy/base/macro.h"
+#include "nndeploy/base/status.h"
+#include "nndeploy/ir/ir.h"
+#include "nndeploy/op/util.h"
+#include "nndeploy/op/vec_math.h"
+#include "nndeploy/thread_pool/parallel.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && \
+    (defined(__GNUC__) || defined(__clang__))
+#define NNDEPLOY_SGEMM_X86
+#include <immintrin.h>
+#define NNDEPLOY_SGEMM_AVX2 __attribute__((target("avx2,fma")))
+#endif
+
+namespace nndeploy {
+namespace op {
+
+// 寄存器tile大小, kSgemmMr x kSgemmNr个累加器常驻寄存器
+static const int kSgemmMr = 4;
+static const int kSgemmNr = 8;
+// cache分块大小
+// # A的MC x KC块常驻L2
+// # B的KC x NR micro panel常驻L1
+// # B的KC x NC块常驻L3
+static const int kSgemmMc = 128;
+static const int kSgemmKc = 256;
+static const int kSgemmNc = 1024;
+// 打包buffer的对齐
+static const size_t kSgemmAlign = 64;
+// 计算量小于该值时不做多线程
+static const double kSgemmParallelFlops = 256.0 * 1024.0;
+
+static inline int roundUp(int value, int align) {
+  return (value + align - 1) / align * align;
+}
+
+static inline size_t alignSize(size_t size) {
+  return (size + kSgemmAlign - 1) / kSgemmAlign * kSgemmAlign;
+}
+
+// 将A[mc, kc]打包为kSgemmMr行一组的micro panel，不足部分补0
+// A(i, p) = a[i * rs + p * cs]
+static void packA(int mc, int kc, const float *a, int rs, int cs,
+                  float *pack) {
+  for (int i = 0; i < mc; i += kSgemmMr) {
+    int mr = std::min(kSgemmMr, mc - i);
+    const float *src = a + i * rs;
+    if (mr == kSgemmMr && rs == 1) {
+      // A转置时同一列的kSgemmMr个元素连续
+      for (int p = 0; p < kc; ++p) {
+        memcpy(pack, src + p * cs, kSgemmMr * sizeof(float));
+        pack += kSgemmMr;
+      }
+      continue;
+    }
+    for (int p = 0; p < kc; ++p) {
+      int r = 0;
+      for (; r < mr; ++r) {
+        pack[r] = src[r * rs + p * cs];
+      }
+      for (; r < kSgemmMr; ++r) {
+        pack[r] = 0.0f;
+      }
+      pack += kSgemmMr;
+    }
+  }
+}
+
+// 将B[kc, nc]打包为kSgemmNr列一组的micro panel，不足部分补0
+// B(p, j) = b[p * rs + j * cs]
+static void packB(int kc, int nc, const float *b, int rs, int cs,
+                  float *pack) {
+  for (int j = 0; j < nc; j += kSgemmNr) {
+    int nr = std::min(kSgemmNr, nc - j);
+    const float *src = b + j * cs;
+    if (nr == kSgemmNr && cs == 1) {
+      for (int p = 0; p < kc; ++p) {
+        memcpy(pack, src + p * rs, kSgemmNr * sizeof(float));
+        pack += kSgemmNr;
+      }
+      continue;
+    }
+    for (int p = 0; p < kc; ++p) {
+      int c = 0;
+      for (; c < nr; ++c) {
+        pack[c] = src[p * rs + c * cs];
+      }
+      for (; c < kSgemmNr; ++c) {
+        pack[c] = 0.0f;
+      }
+      pack += kSgemmNr;
+    }
+  }
+}
+
+static inline const void *offsetData(const void *data,
+                                     const base::DataType &data_type,
+                                     size_t offset) {
+  return static_cast<const char *>(data) + offset * data_type.size();
+}
+
+// 半精度的A[mc, kc]沿连续的方向转换为float后打包，布局与packA相同
+static void packAHalf(int mc, int kc, const void *a,
+                      const base::DataType &data_type, int rs, int cs,
+                      float *pack) {
+  float line[kSgemmKc > kSgemmMc ? kSgemmKc : kSgemmMc];
+  int mp = roundUp(mc, kSgemmMr);
+  if (cs == 1) {
+    // A的每行连续
+    for (int i = 0; i < mp; ++i) {
+      float *dst = pack + (i / kSgemmMr) * kSgemmMr * kc + i % kSgemmMr;
+      if (i >= mc) {
+        for (int p = 0; p < kc; ++p) {
+          dst[p * kSgemmMr] = 0.0f;
+        }
+        continue;
+      }
+      convertToFloat(offsetData(a, data_type, (size_t)i * rs), data_type,
+                     line, kc);
+      for (int p = 0; p < kc; ++p) {
+        dst[p * kSgemmMr] = line[p];
+      }
+    }
+    return;
+  }
+  // A转置时每列连续
+  for (int p = 0; p < kc; ++p) {
+    convertToFloat(offsetData(a, data_type, (size_t)p * cs), data_type, line,
+                   mc);
+    for (int i = 0; i < mp; ++i) {
+      pack[(i / kSgemmMr) * kSgemmMr * kc + p * kSgemmMr + i % kSgemmMr] =
+          i < mc ? line[i] : 0.0f;
+    }
+  }
+}
+
+// 半精度的B[kc, nc]沿连续的方向转换为float后打包，布局与packB相同
+static void packBHalf(int kc, int nc, const void *b,
+                      const base::DataType &data_type, int rs, int cs,
+                      float *pack) {
+  float line[kSgemmNc > kSgemmKc ? kSgemmNc : kSgemmKc];
+  int np = roundUp(nc, kSgemmNr);
+  if (cs == 1) {
+    // B的每行连续
+    for (int p = 0; p < kc; ++p) {
+      convertToFloat(offsetData(b, data_type, (size_t)p * rs), data_type,
+                     line, nc);
+      for (int j = 0; j < np; ++j) {
+        pack[(j / kSgemmNr) * kSgemmNr * kc + p * kSgemmNr + j % kSgemmNr] =
+            j < nc ? line[j] : 0.0f;
+      }
+    }
+    return;
+  }
+  // B转置时每列连续
+  for (int j = 0; j < np; ++j) {
+    float *dst = pack + (j / kSgemmNr) * kSgemmNr * kc + j % kSgemmNr;
+    if (j >= nc) {
+      for (int p = 0; p < kc; ++p) {
+        dst[p * kSgemmNr] = 0.0f;
+      }
+      continue;
+    }
+    convertToFloat(offsetData(b, data_type, (size_t)j * cs), data_type, line,
+                   kc);
+    for (int p = 0; p < kc; ++p) {
+      dst[p * kSgemmNr] = line[p];
+    }
+  }
+}
+
+// 将累加结果写回C[mr, nr] = alpha * acc + beta * C[mr, nr]
+static inline void sgemmStoreTile(const float acc[kSgemmMr][kSgemmNr],
+                                  float *c, int ldc, int mr, int nr,
+                                  float alpha, float beta) {
+  if (beta == 0.0f) {
+    for (int i = 0; i < mr; ++i) {
+      float *dst = c + i * ldc;
+      for (int j = 0; j < nr; ++j) {
+        dst[j] = alpha * acc[i][j];
+      }
+    }
+  } else if (beta == 1.0f) {
+    for (int i = 0; i < mr; ++i) {
+      float *dst = c + i * ldc;
+      for (int j = 0; j < nr; ++j) {
+        dst[j] += alpha * acc[i][j];
+      }
+    }
+  } else {
+    for (int i = 0; i < mr; ++i) {
+      float *dst = c + i * ldc;
+      for (int j = 0; j < nr; ++j) {
+        dst[j] = alpha * acc[i][j] + beta * dst[j];
+      }
+    }
+  }
+}
+
+// micro kernel: C[mr, nr] = alpha * A_panel * B_panel + beta * C[mr, nr]
+typedef void (*SgemmMicroKernelFunc)(int kc, const float *a, const float *b,
+                                     float *c, int ldc, int mr, int nr,
+                                     float alpha, float beta);
+
+static void sgemmMicroKernelScalar(int kc, const float *a, const float *b,
+                                   float *c, int ldc, int mr, int nr,
+                                   float alpha, float beta) {
+  float acc[kSgemmMr][kSgemmNr] = {{0.0f}};
+  for (int p = 0; p < kc; ++p) {
+    for (int i = 0; i < kSgemmMr; ++i) {
+      const float ai = a[i];
+      for (int j = 0; j < kSgemmNr; ++j) {
+        acc[i][j] += ai * b[j];
+      }
+    }
+    a += kSgemmMr;
+    b += kSgemmNr;
+  }
+  sgemmStoreTile(acc, c, ldc, mr, nr, alpha, beta);
+}
+
+#ifdef NNDEPLOY_SGEMM_X86
+// kSgemmNr个float正好是一个ymm，每行一个累加器，A的元素广播后做fma
+// K方向展开两次，两组累加器交替使用以隐藏fma的延迟
+NNDEPLOY_SGEMM_AVX2 static void sgemmMicroKernelAvx2(
+    int kc, const float *a, const float *b, float *c, int ldc, int mr, int nr,
+    float alpha, float beta) {
+  __m256 acc0 = _mm256_setzero_ps();
+  __m256 acc1 = _mm256_setzero_ps();
+  __m256 acc2 = _mm256_setzero_ps();
+  __m256 acc3 = _mm256_setzero_ps();
+  __m256 acc4 = _mm256_setzero_ps();
+  __m256 acc5 = _mm256_setzero_ps();
+  __m256 acc6 = _mm256_setzero_ps();
+  __m256 acc7 = _mm256_setzero_ps();
+  int p = 0;
+  for (; p + 2 <= kc; p += 2) {
+    __m256 b0 = _mm256_loadu_ps(b);
+    __m256 b1 = _mm256_loadu_ps(b + kSgemmNr);
+    acc0 = _mm256_fmadd_ps(_mm256_broadcast_ss(a + 0), b0, acc0);
+    acc1 = _mm256_fmadd_ps(_mm256_broadcast_ss(a + 1), b0, acc1);
+    acc2 = _mm256_fmadd_ps(_mm256_broadcast_ss(a + 2), b0, acc2);
+    acc3 = _mm256_fmadd_ps(_mm256_broadcast_ss(a + 3), b0, acc3);
+    acc4 = _mm256_fmadd_ps(_mm256_broadcast_ss(a + 4), b1, acc4);
+    acc5 = _mm256_fmadd_ps(_mm256_broadcast_ss(a + 5), b1, acc5);
+    acc6 = _mm256_fmadd_ps(_mm256_broadcast_ss(a + 6), b1, acc6);
+    acc7 = _mm256_fmadd_ps(_mm256_broadcast_ss(a + 7), b1, acc7);
+    a += 2 * kSgemmMr;
+    b += 2 * kSgemmNr;
+  }
+  if (p < kc) {
+    __m256 b0 = _mm256_loadu_ps(b);
+    acc0 = _mm256_fmadd_ps(_mm256_broadcast_ss(a + 0), b0, acc0);
+    acc1 = _mm256_fmadd_ps(_mm256_broadcast_ss(a + 1), b0, acc1);
+    acc2 = _mm256_fmadd_ps(_mm256_broadcast_ss(a + 2), b0, acc2);
+    acc3 = _mm256_fmadd_ps(_mm256_broadcast_ss(a + 3), b0, acc3);
+  }
+  __m256 rows[kSgemmMr] = {
+      _mm256_add_ps(acc0, acc4), _mm256_add_ps(acc1, acc5),
+      _mm256_add_ps(acc2, acc6), _mm256_add_ps(acc3, acc7)};
+  if (mr == kSgemmMr && nr == kSgemmNr) {
+    __m256 valpha = _mm256_set1_ps(alpha);
+    __m256 vbeta = _mm256_set1_ps(beta);
+    for (int i = 0; i < kSgemmMr; ++i) {
+      float *dst = c + i * ldc;
+      __m256 v = _mm256_mul_ps(valpha, rows[i]);
+      if (beta == 1.0f) {
+        v = _mm256_add_ps(v, _mm256_loadu_ps(dst));
+      } else if (beta != 0.0f) {
+        v = _mm256_fmadd_ps(vbeta, _mm256_loadu_ps(dst), v);
+      }
+      _mm256_storeu_ps(dst, v);
+    }
+    return;
+  }
+  // 边界tile先落到栈上，再按mr/nr写回
+  float acc[kSgemmMr][kSgemmNr];
+  for (int i = 0; i < kSgemmMr; ++i) {
+    _mm256_storeu_ps(acc[i], rows[i]);
+  }
+  sgemmStoreTile(acc, c, ldc, mr, nr, alpha, beta);
+}
+#endif
+
+// 每次调用时按当前生效的指令集级别选择，base::setCpuIsa对之后的调用立即生效
+// AVX-512下同样使用AVX2的kernel：tile的宽度kSgemmNr为一个ymm，
+// 打包好的B按kSgemmNr排布，加宽tile会改变已打包权重的格式
+static SgemmMicroKernelFunc getSgemmMicroKernel() {
+#ifdef NNDEPLOY_SGEMM_X86
+  if (base::isCpuIsaSupported(base::kCpuIsaAvx2)) {
+    return sgemmMicroKernelAvx2;
+  }
+#endif
+  return sgemmMicroKernelScalar;
+}
+
+// 激活函数
+// 激活函数按行计算，超越函数走vec_math的向量化实现
+struct ActNone {
+  static inline void apply(float *x, int n) {}
+};
+struct ActRelu {
+  static inline void apply(float *x, int n) {
+    for (int j = 0; j < n; ++j) {
+      x[j] = x[j] > 0.0f ? x[j] : 0.0f;
+    }
+  }
+};
+struct ActSigmoid {
+  static inline void apply(float *x, int n) { vecSigmoid(x, x, n); }
+};
+struct ActTanh {
+  static inline void apply(float *x, int n) { vecTanh(x, x, n); }
+};
+struct ActGelu {
+  static inline void apply(float *x, int n) { vecGelu(x, x, n); }
+};
+struct ActSilu {
+  static inline void apply(float *x, int n) { vecSilu(x, x, n); }
+};
+
+// tile的后处理, 激活函数在模板参数中确定, 内层循环不存在分支
+template <typename Act, bool HasBias>
+static void sgemmEpilogueTile(float *c, int ldc, int mr, int nr,
+                              const float *bias) {
+  for (int i = 0; i < mr; ++i) {
+    float *dst = c + i * ldc;
+    if (HasBias) {
+      const float b = bias[i];
+      for (int j = 0; j < nr; ++j) {
+        dst[j] += b;
+      }
+    }
+    Act::apply(dst, nr);
+  }
+}
+
+template <typename Act>
+static SgemmEpilogueFunc selectEpilogue(bool has_bias) {
+  return has_bias ? sgemmEpilogueTile<Act, true> : sgemmEpilogueTile<Act, false>;
+}
+
+SgemmEpilogueFunc getSgemmEpilogueFunc(const SgemmEpilogue &epilogue) {
+  bool has_bias = epilogue.bias_ != nullptr;
+  switch (epilogue.activate_op_) {
+    case ir::kOpTypeNone:
+      return has_bias ? sgemmEpilogueTile<ActNone, true> : nullptr;
+    case ir::kOpTypeRelu:
+      return selectEpilogue<ActRelu>(has_bias);
+    case ir::kOpTypeSigmoid:
+      return selectEpilogue<ActSigmoid>(has_bias);
+    case ir::kOpTypeTanh:
+      return selectEpilogue<ActTanh>(has_bias);
+    case ir::kOpTypeGelu:
+      return selectEpilogue<ActGelu>(has_bias);
+    case ir::kOpTypeSilu:
+      return selectEpilogue<ActSilu>(has_bias);
+    default:
+      return nullptr;
+  }
+}
+
+bool isSgemmActivateSupported(ir::OpType activate_op) {
+  switch (activate_op) {
+    case ir::kOpTypeNone:
+    case ir::kOpTypeRelu:
+    case ir::kOpTypeSigmoid:
+    case ir::kOpTypeTanh:
+    case ir::kOpTypeGelu:
+    case ir::kOpTypeSilu:
+      return true;
+    default:
+      return false;
+  }
+}
+
+/**
+ * @brief sgemm的任务划分
+ * # 输出按MC行 x chunk_n_列划分为多个task，每个task独立计算完整的K
+ * # task按slot静态分配，每个slot拥有独立的A、B打包buffer
+ */
+struct SgemmPartition {
+  int m_blocks_ = 1;
+  int n_chunks_ = 1;
+  int chunk_n_ = kSgemmNr;
+  int slots_ = 1;
+};
+
+/**
+ * @brief 计算量足够时最多使用threads个线程
+ * # 划分任务时threads取当前的线程预算，workspace按线程池的线程数预留，
+ *   保证预算变化后空间仍然足够
+ */
+static int getSgemmThreadNum(int m, int n, int k, int threads) {
+  if (2.0 * m * n * k < kSgemmParallelFlops) {
+    return 1;
+  }
+  return std::max(threads, 1);
+}
+
+static SgemmPartition getSgemmPartition(int m, int n, int k) {
+  SgemmPartition partition;
+  partition.m_blocks_ = (m + kSgemmMc - 1) / kSgemmMc;
+  int threads = getSgemmThreadNum(m, n, k, thread_pool::getThreadBudget());
+  int n_chunks = 1;
+  if (partition.m_blocks_ < threads) {
+    n_chunks = (threads + partition.m_blocks_ - 1) / partition.m_blocks_;
+  }
+  int chunk_n = roundUp((n + n_chunks - 1) / n_chunks, kSgemmNr);
+  partition.chunk_n_ = std::min(chunk_n, kSgemmNc);
+  partition.n_chunks_ = (n + partition.chunk_n_ - 1) / partition.chunk_n_;
+  partition.slots_ =
+      std::min(threads, partition.m_blocks_ * partition.n_chunks_);
+  return partition;
+}
+
+static bool isSgemmFloat(const base::DataType &data_type) {
+  return data_type == base::dataTypeOf<float>();
+}
+
+// 每个slot的打包buffer大小(字节)
+// 按chunk_n_的上界计算，保证m、n、k更小时所需空间不会更大
+// C为半精度时再加上float的输出块[mc, nc]
+static size_t getSgemmSlotSize(const SgemmParam &param, int m, int n, int k) {
+  int mc = roundUp(std::min(m, kSgemmMc), kSgemmMr);
+  int kc = std::min(k, kSgemmKc);
+  int nc = std::min(roundUp(n, kSgemmNr), kSgemmNc);
+  size_t size = alignSize((size_t)mc * kc * sizeof(float));
+  size += alignSize((size_t)kc * nc * sizeof(float));
+  if (!isSgemmFloat(param.c_type_)) {
+    size += alignSize((size_t)mc * nc * sizeof(float));
+  }
+  return size;
+}
+
+size_t sgemmWorkspaceSize(int m, int n, int k) {
+  return sgemmWorkspaceSize(SgemmParam(), m, n, k);
+}
+
+size_t sgemmWorkspaceSize(const SgemmParam &param, int m, int n, int k) {
+  if (m <= 0 || n <= 0 || k <= 0) {
+    return 0;
+  }
+  // 预留对齐空间
+  int threads = getSgemmThreadNum(m, n, k, thread_pool::getThreadNum());
+  return getSgemmSlotSize(param, m, n, k) * threads + kSgemmAlign;
+}
+
+size_t sgemmPackedBSize(int n, int k) {
+  return (size_t)roundUp(n, kSgemmNr) * k * sizeof(float);
+}
+
+size_t sgemmPackedBSize(const SgemmParam &param, int n, int k) {
+  return (size_t)roundUp(n, kSgemmNr) * k * param.b_type_.size();
+}
+
+void sgemmPackB(bool trans_b, int n, int k, const float *b, int ldb,
+                float *packed_b) {
+  int rs = trans_b ? 1 : ldb;
+  int cs = trans_b ? ldb : 1;
+  int np = roundUp(n, kSgemmNr);
+  for (int pc = 0; pc < k; pc += kSgemmKc) {
+    int kc = std::min(kSgemmKc, k - pc);
+    packB(kc, n, b + pc * rs, rs, cs, packed_b + (size_t)pc * np);
+  }
+}
+
+void sgemmPackB(const SgemmParam &param, int n, int k, const void *b, int ldb,
+                void *packed_b) {
+  const base::DataType &data_type = param.b_type_;
+  if (isSgemmFloat(data_type)) {
+    sgemmPackB(param.trans_b_, n, k, static_cast<const float *>(b), ldb,
+               static_cast<float *>(packed_b));
+    return;
+  }
+  // 每次以float打包[KC, NC]的一块，再转换回半精度
+  int rs = param.trans_b_ ? 1 : ldb;
+  int cs = param.trans_b_ ? ldb : 1;
+  int np = roundUp(n, kSgemmNr);
+  std::vector<float> pack((size_t)kSgemmKc * kSgemmNc);
+  for (int pc = 0; pc < k; pc += kSgemmKc) {
+    int kc = std::min(kSgemmKc, k - pc);
+    for (int jc = 0; jc < n; jc += kSgemmNc) {
+      int nc = std::min(kSgemmNc, n - jc);
+      packBHalf(kc, nc,
+                offsetData(b, data_type, (size_t)pc * rs + (size_t)jc * cs),
+                data_type, rs, cs, pack.data());
+      size_t offset = (size_t)pc * np + (size_t)jc * kc;
+      convertFromFloat(pack.data(), data_type,
+                       static_cast<char *>(packed_b) +
+                           offset * data_type.size(),
+                       (size_t)roundUp(nc, kSgemmNr) * kc);
+    }
+  }
+}
+
+struct SgemmContext {
+  SgemmParam param_;
+  int m_;
+  int n_;
+  int k_;
+  const void *a_;
+  int lda_;
+  const void *b_;
+  int ldb_;
+  const void *packed_b_;
+  void *c_;
+  int ldc_;
+  const float *bias_;
+  SgemmEpilogueFunc epilogue_func_;
+  SgemmMicroKernelFunc micro_kernel_;
+  SgemmPartition partition_;
+  char *workspace_;
+  size_t slot_size_;
+};
+
+// 半精度的C[mc, nc]与float的buffer之间逐行转换
+static void convertSgemmBlockC(const SgemmContext &ctx, int ic, int jc, int mc,
+                               int nc, float *buffer, bool to_float) {
+  const base::DataType &data_type = ctx.param_.c_type_;
+  for (int i = 0; i < mc; ++i) {
+    size_t offset = (size_t)(ic + i) * ctx.ldc_ + jc;
+    char *c = static_cast<char *>(ctx.c_) + offset * data_type.size();
+    if (to_float) {
+      convertToFloat(c, data_type, buffer + (size_t)i * nc, nc);
+    } else {
+      convertFromFloat(buffer + (size_t)i * nc, data_type, c, nc);
+    }
+  }
+}
+
+// 计算一个task: C[ic : ic + mc, jc : jc + nc]
+// 半精度的C在buffer_c中以float计算完整的K后再写回
+static void sgemmTask(const SgemmContext &ctx, int task, float *pack_a,
+                      float *pack_b, float *buffer_c) {
+  const SgemmPartition &partition = ctx.partition_;
+  const SgemmParam &param = ctx.param_;
+  int ic = (task / partition.n_chunks_) * kSgemmMc;
+  int jc = (task % partition.n_chunks_) * partition.chunk_n_;
+  int mc = std::min(kSgemmMc, ctx.m_ - ic);
+  int nc = std::min(partition.chunk_n_, ctx.n_ - jc);
+  int rsa = param.trans_a_ ? 1 : ctx.lda_;
+  int csa = param.trans_a_ ? ctx.lda_ : 1;
+  int rsb = param.trans_b_ ? 1 : ctx.ldb_;
+  int csb = param.trans_b_ ? ctx.ldb_ : 1;
+  int np = roundUp(ctx.n_, kSgemmNr);
+  bool is_float_a = isSgemmFloat(param.a_type_);
+  bool is_float_b = isSgemmFloat(param.b_type_);
+  bool is_float_c = isSgemmFloat(param.c_type_);
+  float *c = nullptr;
+  int ldc = ctx.ldc_;
+  if (is_float_c) {
+    c = static_cast<float *>(ctx.c_) + (size_t)ic * ldc + jc;
+  } else {
+    c = buffer_c;
+    ldc = nc;
+    if (param.beta_ != 0.0f) {
+      convertSgemmBlockC(ctx, ic, jc, mc, nc, buffer_c, true);
+    }
+  }
+  for (int pc = 0; pc < ctx.k_; pc += kSgemmKc) {
+    int kc = std::min(kSgemmKc, ctx.k_ - pc);
+    float beta = pc == 0 ? param.beta_ : 1.0f;
+    bool is_last_k = pc + kc >= ctx.k_;
+    const float *panels_b = nullptr;
+    if (ctx.packed_b_ != nullptr) {
+      size_t offset = (size_t)pc * np + (size_t)jc * kc;
+      if (is_float_b) {
+        panels_b = static_cast<const float *>(ctx.packed_b_) + offset;
+      } else {
+        // 预打包的半精度panel连续存放，整体转换
+        convertToFloat(offsetData(ctx.packed_b_, param.b_type_, offset),
+                       param.b_type_, pack_b,
+                       (size_t)roundUp(nc, kSgemmNr) * kc);
+        panels_b = pack_b;
+      }
+    } else {
+      size_t offset = (size_t)pc * rsb + (size_t)jc * csb;
+      if (is_float_b) {
+        packB(kc, nc, static_cast<const float *>(ctx.b_) + offset, rsb, csb,
+              pack_b);
+      } else {
+        packBHalf(kc, nc, offsetData(ctx.b_, param.b_type_, offset),
+                  param.b_type_, rsb, csb, pack_b);
+      }
+      panels_b = pack_b;
+    }
+    size_t offset_a = (size_t)ic * rsa + (size_t)pc * csa;
+    if (is_float_a) {
+      packA(mc, kc, static_cast<const float *>(ctx.a_) + offset_a, rsa, csa,
+            pack_a);
+    } else {
+      packAHalf(mc, kc, offsetData(ctx.a_, param.a_type_, offset_a),
+                param.a_type_, rsa, csa, pack_a);
+    }
+    // macro kernel
+    for (int jr = 0; jr < nc; jr += kSgemmNr) {
+      int nr = std::min(kSgemmNr, nc - jr);
+      const float *panel_b = panels_b + jr * kc;
+      for (int ir = 0; ir < mc; ir += kSgemmMr) {
+        int mr = std::min(kSgemmMr, mc - ir);
+        float *tile_c = c + ir * ldc + jr;
+        ctx.micro_kernel_(kc, pack_a + ir * kc, panel_b, tile_c, ldc, mr, nr,
+                          param.alpha_, beta);
+        if (is_last_k && ctx.epilogue_func_ != nullptr) {
+          const float *bias =
+              ctx.bias_ != nullptr ? ctx.bias_ + ic + ir : nullptr;
+          ctx.epilogue_func_(tile_c, ldc, mr, nr, bias);
+        }
+      }
+    }
+  }
+  if (!is_float_c) {
+    convertSgemmBlockC(ctx, ic, jc, mc, nc, buffer_c, false);
+  }
+}
+
+class SgemmLoopBody : public thread_pool::ParallelLoopBody {
+ public:
+  SgemmLoopBody(const SgemmContext &ctx) : ctx_(ctx) {}
+  virtual void operator()(const base::Range &range) const {
+    int mc = roundUp(std::min(ctx_.m_, kSgemmMc), kSgemmMr);
+    int kc = std::min(ctx_.k_, kSgemmKc);
+    int nc = std::min(roundUp(ctx_.n_, kSgemmNr), kSgemmNc);
+    size_t pack_a_size = alignSize((size_t)mc * kc * sizeof(float));
+    size_t pack_b_size = alignSize((size_t)kc * nc * sizeof(float));
+    const SgemmPartition &partition = ctx_.partition_;
+    int tasks = partition.m_blocks_ * partition.n_chunks_;
+    for (int slot = range.start_; slot < range.end_; ++slot) {
+      char *buffer = ctx_.workspace_ + ctx_.slot_size_ * slot;
+      float *pack_a = reinterpret_cast<float *>(buffer);
+      float *pack_b = reinterpret_cast<float *>(buffer + pack_a_size);
+      float *buffer_c =
+          reinterpret_cast<float *>(buffer + pack_a_size + pack_b_size);
+      for (int task = slot; task < tasks; task += partition.slots_) {
+        sgemmTask(ctx_, task, pack_a, pack_b, buffer_c);
+      }
+    }
+  }
+
+ private:
+  const SgemmContext &ctx_;
+};
+
+static bool isSgemmDataTypeSupported(const base::DataType &data_type) {
+  return isSgemmFloat(data_type) || isHalfDataType(data_type);
+}
+
+// K为0时 C = epilogue(beta * C)
+static void sgemmScaleC(const SgemmParam &param, int m, int n, void *c,
+                        int ldc, const SgemmEpilogue &epilogue,
+                        SgemmEpilogueFunc epilogue_func) {
+  std::vector<float> row(n);
+  size_t element_size = param.c_type_.size();
+  for (int i = 0; i < m; ++i) {
+    char *dst = static_cast<char *>(c) + (size_t)i * ldc * element_size;
+    if (param.beta_ != 0.0f) {
+      convertToFloat(dst, param.c_type_, row.data(), n);
+    }
+    for (int j = 0; j < n; ++j) {
+      row[j] = param.beta_ == 0.0f ? 0.0f : param.beta_ * row[j];
+    }
+    if (epilogue_func != nullptr) {
+      const float *bias =
+          epilogue.bias_ != nullptr ? epilogue.bias_ + i : nullptr;
+      epilogue_func(row.data(), n, 1, n, bias);
+    }
+    convertFromFloat(row.data(), param.c_type_, dst, n);
+  }
+}
+
+static base::Status sgemmImpl(const SgemmParam &param, int m, int n, int k,
+                              const void *a, int lda, const void *b, int ldb,
+                              const void *packed_b, void *c, int ldc,
+                              const SgemmEpilogue &epilogue, void *workspace) {
+  if (m <= 0 || n <= 0) {
+    return base::kStatusCodeOk;
+  }
+  if (!isSgemmActivateSupported(epilogue.activate_op_)) {
+    NNDEPLOY_LOGE("sgemm not support activate op[%s].\n",
+                  ir::opTypeToString(epilogue.activate_op_).c_str());
+    return base::kStatusCodeErrorNotImplement;
+  }
+  if (!isSgemmDataTypeSupported(param.a_type_) ||
+      !isSgemmDataTypeSupported(param.b_type_) ||
+      !isSgemmDataTypeSupported(param.c_type_)) {
+    NNDEPLOY_LOGE("sgemm only support fp32/fp16/bf16.\n");
+    return base::kStatusCodeErrorNotSupport;
+  }
+  SgemmEpilogueFunc epilogue_func = getSgemmEpilogueFunc(epilogue);
+
+  if (k <= 0) {
+    sgemmScaleC(param, m, n, c, ldc, epilogue, epilogue_func);
+    return base::kStatusCodeOk;
+  }
+  if (workspace == nullptr) {
+    NNDEPLOY_LOGE("sgemm workspace is nullptr.\n");
+    return base::kStatusCodeErrorNullParam;
+  }
+
+  SgemmContext ctx;
+  ctx.param_ = param;
+  ctx.m_ = m;
+  ctx.n_ = n;
+  ctx.k_ = k;
+  ctx.a_ = a;
+  ctx.lda_ = lda;
+  ctx.b_ = b;
+  ctx.ldb_ = ldb;
+  ctx.packed_b_ = packed_b;
+  ctx.c_ = c;
+  ctx.ldc_ = ldc;
+  ctx.bias_ = epilogue.bias_;
+  ctx.epilogue_func_ = epilogue_func;
+  ctx.micro_kernel_ = getSgemmMicroKernel();
+  ctx.partition_ = getSgemmPartition(m, n, k);
+  uintptr_t ptr = reinterpret_cast<uintptr_t>(workspace);
+  ptr = (ptr + kSgemmAlign - 1) / kSgemmAlign * kSgemmAlign;
+  ctx.workspace_ = reinterpret_cast<char *>(ptr);
+  ctx.slot_size_ = getSgemmSlotSize(param, m, n, k);
+
+  SgemmLoopBody body(ctx);
+  if (ctx.partition_.slots_ > 1) {
+    thread_pool::parallelFor(base::Range(0, ctx.partition_.slots_), body);
+  } else {
+    body(base::Range(0, 1));
+  }
+
+  return base::kStatusCodeOk;
+}
+
+base::Status sgemm(const SgemmParam &param, int m, int n, int k,
+                   const void *a, int lda, const void *b, int ldb, void *c,
+                   int ldc, const SgemmEpilogue &epilogue, void *workspace) {
+  return sgemmImpl(param, m, n, k, a, lda, b, ldb, nullptr, c, ldc, epilogue,
+                   workspace);
+}
+
+base::Status sgemmPacked(const SgemmParam &param, int m, int n, int k,
+                         const void *a, int lda, const void *packed_b,
+                         void *c, int ldc, const SgemmEpilogue &epilogue,
+                         void *workspace) {
+  return sgemmImpl(param, m, n, k, a, lda, nullptr, 0, packed_b, c, ldc,
+                   epilogue, workspace);
+}
+
+base::Status sgemm(int m, int n, int k, const float *a, int lda,
+                   const float *b, int ldb, float *c, int ldc,
+                   const SgemmEpilogue &epilogue, void *workspace) {
+  SgemmParam param;
+  return sgemmImpl(param, m, n, k, a, lda, b, ldb, nullptr, c, ldc, epilogue,
+                   workspace);
+}
+
+}  // namespace op
+}  // namespace nndeploy
@@ -9,6 +9,7 @@
 #include "nndeploy/base/macro.h"
 #include "nndeploy/base/object.h"
 #include "nndeploy/base/param.h"
+#include "nndeploy/base/shape.h"
 #include "nndeploy/base/status.h"
 #include "nndeploy/base/string.h"
 #include "nndeploy/base/time_profiler.h"
@@ -17,6 +18,7 @@
 #include "nndeploy/device/memory_pool.h"
 #include "nndeploy/device/tensor.h"
 #include "nndeploy/ir/ir.h"
+#include "nndeploy/thread_pool/parallel.h"
 
 namespace nndeploy {
 namespace op {
@@ -62,5 +64,155 @@ int32_t multiplyDims(const base::IntVector& shape, int from,
   return dim;
 }
 
+device::Buffer* createBufferView(device::Buffer* src, size_t offset,
+                                 const device::TensorDesc& desc) {
+  if (src == nullptr || src->getData() == nullptr) {
+    return nullptr;
+  }
+  device::Device* device = src->getDevice();
+  if (!device::isHostDeviceType(device->getDeviceType())) {
+    return nullptr;
+  }
+  device::BufferDesc buffer_desc =
+      device->toBufferDesc(desc, base::IntVector());
+  if (offset + buffer_desc.getSize() > src->getSize()) {
+    return nullptr;
+  }
+  void* ptr = static_cast<uint8_t*>(src->getData()) + offset;
+  return new device::Buffer(device, buffer_desc, ptr,
+                            base::kMemoryTypeExternal);
+}
+
+bool isHalfDataType(const base::DataType& data_type) {
+  return data_type == base::dataTypeOf<half_float::half>() ||
+         data_type == base::dataTypeOf<base::bfp16_t>();
+}
+
+void convertToFloat(const void* src, const base::DataType& data_type,
+                    float* dst, size_t count) {
+  if (data_type == base::dataTypeOf<half_float::half>()) {
+    base::convertFromFp16ToFloat(src, dst, static_cast<int>(count));
+  } else if (data_type == base::dataTypeOf<base::bfp16_t>()) {
+    base::convertFromBfp16ToFloat(src, dst, static_cast<int>(count));
+  } else if (src != dst) {
+    std::memcpy(dst, src, count * sizeof(float));
+  }
+}
+
+void convertFromFloat(const float* src, const base::DataType& data_type,
+                      void* dst, size_t count) {
+  if (data_type == base::dataTypeOf<half_float::half>()) {
+    base::convertFromFloatToFp16(src, dst, static_cast<int>(count));
+  } else if (data_type == base::dataTypeOf<base::bfp16_t>()) {
+    base::convertFromFloatToBfp16(src, dst, static_cast<int>(count));
+  } else if (src != dst) {
+    std::memcpy(dst, src, count * sizeof(float));
+  }
+}
+
+// 单个拷贝任务的字节数
+static const size_t kCopyRowsGrainSize = 64 * 1024;
+
+class CopyRowsLoopBody : public thread_pool::ParallelLoopBody {
+ public:
+  CopyRowsLoopBody(uint8_t* dst, size_t dst_stride, const uint8_t* src,
+                   size_t src_stride, size_t row_size, size_t size)
+      : dst_(dst),
+        dst_stride_(dst_stride),
+        src_(src),
+        src_stride_(src_stride),
+        row_size_(row_size),
+        size_(size) {}
+
+  virtual void operator()(const base::Range& range) const {
+    for (int task = range.start_; task < range.end_; ++task) {
+      size_t i = task * kCopyRowsGrainSize;
+      size_t end = std::min(i + kCopyRowsGrainSize, size_);
+      // 任务可能跨越多行，也可能只是一行中的一段
+      while (i < end) {
+        size_t row = i / row_size_;
+        size_t col = i % row_size_;
+        size_t n = std::min(end - i, row_size_ - col);
+        std::memcpy(dst_ + row * dst_stride_ + col,
+                    src_ + row * src_stride_ + col, n);
+        i += n;
+      }
+    }
+  }
+
+ private:
+  uint8_t* dst_;
+  size_t dst_stride_;
+  const uint8_t* src_;
+  size_t src_stride_;
+  size_t row_size_;
+  size_t size_;
+};
+
+void copyRows(void* dst, size_t dst_stride, const void* src,
+              size_t src_stride, size_t rows, size_t row_size, uint64_t cost) {
+  size_t size = rows * row_size;
+  if (size == 0) {
+    return;
+  }
+  int tasks =
+      static_cast<int>((size + kCopyRowsGrainSize - 1) / kCopyRowsGrainSize);
+  CopyRowsLoopBody body(static_cast<uint8_t*>(dst), dst_stride,
+                        static_cast<const uint8_t*>(src), src_stride, row_size,
+                        size);
+  thread_pool::parallelForWithCost(base::Range(0, tasks), body, cost);
+}
+
+/**
+ * @brief 每个任务处理一个batch的最后一个通道块，逐点写0
+ */
+class ZeroChannelPaddingLoopBody : public thread_pool::ParallelLoopBody {
+ public:
+  ZeroChannelPaddingLoopBody(uint8_t* data, size_t batch_stride,
+                             size_t point_stride, size_t plane, size_t size)
+      : data_(data),
+        batch_stride_(batch_stride),
+        point_stride_(point_stride),
+        plane_(plane),
+        size_(size) {}
+
+  virtual void operator()(const base::Range& range) const {
+    for (int n = range.start_; n < range.end_; ++n) {
+      uint8_t* y = data_ + n * batch_stride_;
+      for (size_t p = 0; p < plane_; ++p) {
+        std::memset(y + p * point_stride_, 0, size_);
+      }
+    }
+  }
+
+ private:
+  uint8_t* data_;
+  size_t batch_stride_;
+  size_t point_stride_;
+  size_t plane_;
+  size_t size_;
+};
+
+void zeroChannelPadding(device::Tensor* tensor, uint64_t cost) {
+  int block = base::getChannelBlock(tensor->getDataFormat());
+  base::IntVector shape = tensor->getShape();
+  if (block <= 1 || shape.size() != 4 || shape[1] % block == 0) {
+    return;
+  }
+  int blocks = (shape[1] + block - 1) / block;
+  int tail = shape[1] % block;
+  size_t element_size = tensor->getDataType().size();
+  size_t plane = (size_t)shape[2] * shape[3];
+  size_t point_stride = block * element_size;
+  size_t batch_stride = blocks * plane * point_stride;
+  // 从最后一块中第一个补齐的通道开始
+  uint8_t* data = static_cast<uint8_t*>(tensor->getData()) +
+                  (blocks - 1) * plane * point_stride + tail * element_size;
+  ZeroChannelPaddingLoopBody body(data, batch_stride, point_stride, plane,
+                                  (block - tail) * element_size);
+  uint64_t share = cost * (block - tail) / ((uint64_t)blocks * block);
+  thread_pool::parallelForWithCost(base::Range(0, shape[0]), body, share);
+}
+
 }  // namespace op
-}  // namespace nndeploy
\ No newline at end of file
+}  // namespace nndeploy
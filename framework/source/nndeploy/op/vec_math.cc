@@ -0,0 +1,1748 @@
+
+#include "nndeploy/op/vec_math.h"
+
+#include "nndeploy/base/common.h"
+#include "nndeploy/base/cpu_isa.h"
+#include "nndeploy/base/glic_stl_include.h"
+#include "nndeploy/base/log.h"
+#include "nndeploy/base/macro.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && \
+    (defined(__GNUC__) || defined(__clang__))
+#define NNDEPLOY_VEC_MATH_X86
+#include <immintrin.h>
+#define NNDEPLOY_VEC_MATH_AVX2 __attribute__((target("avx2,fma")))
+#define NNDEPLOY_VEC_MATH_AVX512 __attribute__((target("avx512f")))
+#endif
+
+namespace nndeploy {
+namespace op {
+
+/**
+ * 多项式近似
+ * # exp : x = n * ln2 + r, |r| <= ln2 / 2，exp(r)用5阶多项式(cephes expf)
+ *         2^n拆成两个规格化数的乘积，覆盖非规格化数与溢出
+ * # tanh: |x| < 0.625时用奇多项式(cephes tanhf)，否则 1 - 2 / (exp(2|x|) + 1)
+ * # erf : |x| < 0.75时用泰勒展开，否则 1 - erfc(|x|)
+ *         erfc(z) = t * exp(-z * z + P(t)), t = 1 / (1 + z / 2)
+ */
+static const float kExpLo = -104.0f;
+static const float kExpHi = 89.0f;
+static const float kLog2e = 1.44269504088896341f;
+static const float kLn2Hi = 0.693359375f;
+static const float kLn2Lo = -2.12194440e-4f;
+static const float kExpP0 = 1.9875691500e-4f;
+static const float kExpP1 = 1.3981999507e-3f;
+static const float kExpP2 = 8.3334519073e-3f;
+static const float kExpP3 = 4.1665795894e-2f;
+static const float kExpP4 = 1.6666665459e-1f;
+static const float kExpP5 = 5.0000001201e-1f;
+
+static const float kTanhSmall = 0.625f;
+static const float kTanhP0 = -5.70498872745e-3f;
+static const float kTanhP1 = 2.06390887954e-2f;
+static const float kTanhP2 = -5.37397155531e-2f;
+static const float kTanhP3 = 1.33314422036e-1f;
+static const float kTanhP4 = -3.33332819422e-1f;
+
+static const float kErfSmall = 0.75f;
+// erf(x) = x * sum(kErfT[i] * x^(2i)), |x| < 0.75
+static const float kErfT0 = 1.12837916709551257f;
+static const float kErfT1 = -3.76126389031837538e-1f;
+static const float kErfT2 = 1.12837916709551257e-1f;
+static const float kErfT3 = -2.68661706451312518e-2f;
+static const float kErfT4 = 5.22397762544218784e-3f;
+static const float kErfT5 = -8.54832702345085283e-4f;
+static const float kErfT6 = 1.20553329817896643e-4f;
+static const float kErfT7 = -1.49256503584062500e-5f;
+static const float kErfT8 = 1.64621143658892458e-6f;
+// erfc(z) = t * exp(-z * z + sum(kErfC[i] * t^i))
+static const float kErfC0 = -1.26551223f;
+static const float kErfC1 = 1.00002368f;
+static const float kErfC2 = 0.37409196f;
+static const float kErfC3 = 0.09678418f;
+static const float kErfC4 = -0.18628806f;
+static const float kErfC5 = 0.27886807f;
+static const float kErfC6 = -1.13520398f;
+static const float kErfC7 = 1.48851587f;
+static const float kErfC8 = -0.82215223f;
+static const float kErfC9 = 0.17087277f;
+
+static const float kSqrtHalf = 0.707106781186547524f;
+
+// 标量实现
+static inline float pow2Scalar(int n) {
+  int bits = (n + 127) << 23;
+  float value;
+  memcpy(&value, &bits, sizeof(float));
+  return value;
+}
+
+static inline float expScalar(float x) {
+  if (std::isnan(x)) {
+    return x;
+  }
+  x = std::min(kExpHi, std::max(kExpLo, x));
+  float fx = std::floor(x * kLog2e + 0.5f);
+  float r = x - fx * kLn2Hi;
+  r = r - fx * kLn2Lo;
+  float p = kExpP0;
+  p = p * r + kExpP1;
+  p = p * r + kExpP2;
+  p = p * r + kExpP3;
+  p = p * r + kExpP4;
+  p = p * r + kExpP5;
+  float y = p * (r * r) + (r + 1.0f);
+  int n = static_cast<int>(fx);
+  int n1 = n >> 1;
+  return y * pow2Scalar(n1) * pow2Scalar(n - n1);
+}
+
+static inline float tanhScalar(float x) {
+  float ax = std::fabs(x);
+  if (ax < kTanhSmall) {
+    float z = x * x;
+    float p = kTanhP0;
+    p = p * z + kTanhP1;
+    p = p * z + kTanhP2;
+    p = p * z + kTanhP3;
+    p = p * z + kTanhP4;
+    return x + x * z * p;
+  }
+  float y = 1.0f - 2.0f / (expScalar(2.0f * ax) + 1.0f);
+  return std::copysign(y, x);
+}
+
+// x * sum(kErfT[i] * x^(2i))
+static inline float erfSmallScalar(float x) {
+  float z = x * x;
+  float p = kErfT8;
+  p = p * z + kErfT7;
+  p = p * z + kErfT6;
+  p = p * z + kErfT5;
+  p = p * z + kErfT4;
+  p = p * z + kErfT3;
+  p = p * z + kErfT2;
+  p = p * z + kErfT1;
+  p = p * z + kErfT0;
+  return x * p;
+}
+
+// erfc(z), z >= 0
+static inline float erfcScalar(float z) {
+  float t = 1.0f / (1.0f + 0.5f * z);
+  float p = kErfC9;
+  p = p * t + kErfC8;
+  p = p * t + kErfC7;
+  p = p * t + kErfC6;
+  p = p * t + kErfC5;
+  p = p * t + kErfC4;
+  p = p * t + kErfC3;
+  p = p * t + kErfC2;
+  p = p * t + kErfC1;
+  p = p * t + kErfC0;
+  return t * expScalar(p - z * z);
+}
+
+static inline float erfScalar(float x) {
+  float ax = std::fabs(x);
+  if (ax < kErfSmall) {
+    return erfSmallScalar(x);
+  }
+  return std::copysign(1.0f - erfcScalar(ax), x);
+}
+
+static inline float geluScalar(float x) {
+  float u = x * kSqrtHalf;
+  float au = std::fabs(u);
+  // 1 + erf(u)
+  float e;
+  if (au < kErfSmall) {
+    e = 1.0f + erfSmallScalar(u);
+  } else if (u > 0.0f) {
+    e = 2.0f - erfcScalar(au);
+  } else {
+    e = erfcScalar(au);
+  }
+  return 0.5f * x * e;
+}
+
+static void expScalarLoop(const float *x, float *y, size_t n) {
+  for (size_t i = 0; i < n; ++i) {
+    y[i] = expScalar(x[i]);
+  }
+}
+
+// e = exp(-|x|) 不会溢出，x < 0时 sigmoid(x) = e / (1 + e)
+static inline float sigmoidScalar(float x) {
+  float e = expScalar(-std::fabs(x));
+  float r = 1.0f / (1.0f + e);
+  return x < 0.0f ? e * r : r;
+}
+
+static void sigmoidScalarLoop(const float *x, float *y, size_t n) {
+  for (size_t i = 0; i < n; ++i) {
+    y[i] = sigmoidScalar(x[i]);
+  }
+}
+
+static void siluScalarLoop(const float *x, float *y, size_t n) {
+  for (size_t i = 0; i < n; ++i) {
+    y[i] = x[i] * sigmoidScalar(x[i]);
+  }
+}
+
+static void tanhScalarLoop(const float *x, float *y, size_t n) {
+  for (size_t i = 0; i < n; ++i) {
+    y[i] = tanhScalar(x[i]);
+  }
+}
+
+static void erfScalarLoop(const float *x, float *y, size_t n) {
+  for (size_t i = 0; i < n; ++i) {
+    y[i] = erfScalar(x[i]);
+  }
+}
+
+static void geluScalarLoop(const float *x, float *y, size_t n) {
+  for (size_t i = 0; i < n; ++i) {
+    y[i] = geluScalar(x[i]);
+  }
+}
+
+static float maxScalarLoop(const float *x, size_t n) {
+  float m = -std::numeric_limits<float>::infinity();
+  for (size_t i = 0; i < n; ++i) {
+    m = std::max(m, x[i]);
+  }
+  return m;
+}
+
+static float minScalarLoop(const float *x, size_t n) {
+  float m = std::numeric_limits<float>::infinity();
+  for (size_t i = 0; i < n; ++i) {
+    m = std::min(m, x[i]);
+  }
+  return m;
+}
+
+static float sumScalarLoop(const float *x, size_t n) {
+  float s0 = 0.0f, s1 = 0.0f, s2 = 0.0f, s3 = 0.0f;
+  size_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    s0 += x[i];
+    s1 += x[i + 1];
+    s2 += x[i + 2];
+    s3 += x[i + 3];
+  }
+  for (; i < n; ++i) {
+    s0 += x[i];
+  }
+  return (s0 + s1) + (s2 + s3);
+}
+
+static float squareSumScalarLoop(const float *x, size_t n) {
+  float s0 = 0.0f, s1 = 0.0f, s2 = 0.0f, s3 = 0.0f;
+  size_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    s0 += x[i] * x[i];
+    s1 += x[i + 1] * x[i + 1];
+    s2 += x[i + 2] * x[i + 2];
+    s3 += x[i + 3] * x[i + 3];
+  }
+  for (; i < n; ++i) {
+    s0 += x[i] * x[i];
+  }
+  return (s0 + s1) + (s2 + s3);
+}
+
+static float absSumScalarLoop(const float *x, size_t n) {
+  float s0 = 0.0f, s1 = 0.0f, s2 = 0.0f, s3 = 0.0f;
+  size_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    s0 += std::fabs(x[i]);
+    s1 += std::fabs(x[i + 1]);
+    s2 += std::fabs(x[i + 2]);
+    s3 += std::fabs(x[i + 3]);
+  }
+  for (; i < n; ++i) {
+    s0 += std::fabs(x[i]);
+  }
+  return (s0 + s1) + (s2 + s3);
+}
+
+static float addSquareSumScalarLoop(const float *x, const float *r, float *y,
+                                    size_t n) {
+  float s0 = 0.0f, s1 = 0.0f;
+  size_t i = 0;
+  for (; i + 2 <= n; i += 2) {
+    float v0 = x[i] + r[i];
+    float v1 = x[i + 1] + r[i + 1];
+    y[i] = v0;
+    y[i + 1] = v1;
+    s0 += v0 * v0;
+    s1 += v1 * v1;
+  }
+  for (; i < n; ++i) {
+    float v = x[i] + r[i];
+    y[i] = v;
+    s0 += v * v;
+  }
+  return s0 + s1;
+}
+
+static void scaleMulScalarLoop(const float *x, float scale, const float *w,
+                               float *y, size_t n) {
+  for (size_t i = 0; i < n; ++i) {
+    y[i] = x[i] * scale * w[i];
+  }
+}
+
+static float dotScalarLoop(const float *x, const float *y, size_t n) {
+  float s0 = 0.0f, s1 = 0.0f, s2 = 0.0f, s3 = 0.0f;
+  size_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    s0 += x[i] * y[i];
+    s1 += x[i + 1] * y[i + 1];
+    s2 += x[i + 2] * y[i + 2];
+    s3 += x[i + 3] * y[i + 3];
+  }
+  for (; i < n; ++i) {
+    s0 += x[i] * y[i];
+  }
+  return (s0 + s1) + (s2 + s3);
+}
+
+static void axpyScalarLoop(float a, const float *x, float *y, size_t n) {
+  for (size_t i = 0; i < n; ++i) {
+    y[i] += a * x[i];
+  }
+}
+
+static float expSumScalarLoop(const float *x, float m, float *y, size_t n) {
+  float sum = 0.0f;
+  for (size_t i = 0; i < n; ++i) {
+    y[i] = expScalar(x[i] - m);
+    sum += y[i];
+  }
+  return sum;
+}
+
+static void siluMulScalarLoop(const float *g, const float *u, float *y,
+                              size_t n) {
+  for (size_t i = 0; i < n; ++i) {
+    y[i] = g[i] * sigmoidScalar(g[i]) * u[i];
+  }
+}
+
+static void rotaryScalarLoop(const float *x0, const float *x1, const float *c,
+                             const float *s, float *y0, float *y1, size_t n) {
+  for (size_t i = 0; i < n; ++i) {
+    float a = x0[i];
+    float b = x1[i];
+    y0[i] = a * c[i] - b * s[i];
+    y1[i] = b * c[i] + a * s[i];
+  }
+}
+
+static void rotaryInterleavedScalarLoop(const float *x, const float *c,
+                                        const float *s, float *y, size_t n) {
+  for (size_t i = 0; i < n; ++i) {
+    float a = x[2 * i];
+    float b = x[2 * i + 1];
+    y[2 * i] = a * c[i] - b * s[i];
+    y[2 * i + 1] = b * c[i] + a * s[i];
+  }
+}
+
+static size_t selectGreaterScalarLoop(const float *x, size_t n, float t,
+                                      int32_t *index) {
+  size_t count = 0;
+  for (size_t i = 0; i < n; ++i) {
+    index[count] = static_cast<int32_t>(i);
+    count += x[i] > t ? 1 : 0;
+  }
+  return count;
+}
+
+/**
+ * @brief 合并lanes路各count个元素的Welford结果，再用Chan公式并入尾部元素
+ * # m为各路均值，s为各路偏差平方和
+ * # 各路个数相同，合并后的均值为各路均值的平均
+ * # 尾部元素不足一次向量，先两遍求均值与偏差平方和，再整体合并
+ */
+static void meanVarMerge(const float *m, const float *s, int lanes,
+                         size_t count, const float *tail, size_t tail_n,
+                         float *mean, float *var) {
+  float mu = 0.0f;
+  float m2 = 0.0f;
+  if (count > 0) {
+    for (int l = 0; l < lanes; ++l) {
+      mu += m[l];
+    }
+    mu /= lanes;
+    float spread = 0.0f;
+    for (int l = 0; l < lanes; ++l) {
+      m2 += s[l];
+      spread += (m[l] - mu) * (m[l] - mu);
+    }
+    m2 += spread * count;
+  }
+  size_t na = count * lanes;
+  if (tail_n > 0) {
+    float tail_mu = 0.0f;
+    for (size_t i = 0; i < tail_n; ++i) {
+      tail_mu += tail[i];
+    }
+    tail_mu /= tail_n;
+    float tail_m2 = 0.0f;
+    for (size_t i = 0; i < tail_n; ++i) {
+      tail_m2 += (tail[i] - tail_mu) * (tail[i] - tail_mu);
+    }
+    float total = static_cast<float>(na + tail_n);
+    float delta = tail_mu - mu;
+    mu += delta * (tail_n / total);
+    m2 += tail_m2 + delta * delta * (static_cast<float>(na) * tail_n / total);
+  }
+  size_t n = na + tail_n;
+  *mean = mu;
+  *var = n > 0 ? m2 / n : 0.0f;
+}
+
+static void meanVarScalarLoop(const float *x, size_t n, float *mean,
+                              float *var) {
+  float m[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+  float s[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+  size_t count = 0;
+  size_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    float r = 1.0f / static_cast<float>(++count);
+    for (int l = 0; l < 4; ++l) {
+      float d = x[i + l] - m[l];
+      m[l] += d * r;
+      s[l] += d * (x[i + l] - m[l]);
+    }
+  }
+  meanVarMerge(m, s, 4, count, x + i, n - i, mean, var);
+}
+
+static void normAffineScalarLoop(const float *x, float mean, float rstd,
+                                 const float *gamma, const float *beta,
+                                 float *y, size_t n) {
+  if (beta != nullptr) {
+    for (size_t i = 0; i < n; ++i) {
+      y[i] = (x[i] - mean) * rstd * gamma[i] + beta[i];
+    }
+  } else {
+    for (size_t i = 0; i < n; ++i) {
+      y[i] = (x[i] - mean) * rstd * gamma[i];
+    }
+  }
+}
+
+static void scaleShiftScalarLoop(const float *x, float a, float b, float *y,
+                                 size_t n) {
+  for (size_t i = 0; i < n; ++i) {
+    y[i] = x[i] * a + b;
+  }
+}
+
+#ifdef NNDEPLOY_VEC_MATH_X86
+
+// AVX2 + FMA实现，每次处理8个float
+NNDEPLOY_VEC_MATH_AVX2 static inline __m256 expAvx2(__m256 x) {
+  // max/min的第二个操作数为NaN时返回NaN
+  x = _mm256_min_ps(_mm256_set1_ps(kExpHi),
+                    _mm256_max_ps(_mm256_set1_ps(kExpLo), x));
+  __m256 fx = _mm256_floor_ps(
+      _mm256_fmadd_ps(x, _mm256_set1_ps(kLog2e), _mm256_set1_ps(0.5f)));
+  __m256 r = _mm256_fnmadd_ps(fx, _mm256_set1_ps(kLn2Hi), x);
+  r = _mm256_fnmadd_ps(fx, _mm256_set1_ps(kLn2Lo), r);
+  __m256 p = _mm256_set1_ps(kExpP0);
+  p = _mm256_fmadd_ps(p, r, _mm256_set1_ps(kExpP1));
+  p = _mm256_fmadd_ps(p, r, _mm256_set1_ps(kExpP2));
+  p = _mm256_fmadd_ps(p, r, _mm256_set1_ps(kExpP3));
+  p = _mm256_fmadd_ps(p, r, _mm256_set1_ps(kExpP4));
+  p = _mm256_fmadd_ps(p, r, _mm256_set1_ps(kExpP5));
+  __m256 y = _mm256_fmadd_ps(p, _mm256_mul_ps(r, r),
+                             _mm256_add_ps(r, _mm256_set1_ps(1.0f)));
+  __m256i n = _mm256_cvtps_epi32(fx);
+  __m256i n1 = _mm256_srai_epi32(n, 1);
+  __m256i n2 = _mm256_sub_epi32(n, n1);
+  __m256i bias = _mm256_set1_epi32(127);
+  __m256 s1 = _mm256_castsi256_ps(
+      _mm256_slli_epi32(_mm256_add_epi32(n1, bias), 23));
+  __m256 s2 = _mm256_castsi256_ps(
+      _mm256_slli_epi32(_mm256_add_epi32(n2, bias), 23));
+  return _mm256_mul_ps(_mm256_mul_ps(y, s1), s2);
+}
+
+NNDEPLOY_VEC_MATH_AVX2 static inline __m256 absAvx2(__m256 x) {
+  return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), x);
+}
+
+// 将x的符号位复制到非负数y上
+NNDEPLOY_VEC_MATH_AVX2 static inline __m256 copySignAvx2(__m256 y, __m256 x) {
+  return _mm256_or_ps(y, _mm256_and_ps(_mm256_set1_ps(-0.0f), x));
+}
+
+NNDEPLOY_VEC_MATH_AVX2 static inline __m256 sigmoidAvx2(__m256 x) {
+  __m256 one = _mm256_set1_ps(1.0f);
+  __m256 e = expAvx2(_mm256_or_ps(_mm256_set1_ps(-0.0f), x));
+  __m256 r = _mm256_div_ps(one, _mm256_add_ps(one, e));
+  __m256 negative = _mm256_cmp_ps(x, _mm256_setzero_ps(), _CMP_LT_OQ);
+  return _mm256_blendv_ps(r, _mm256_mul_ps(e, r), negative);
+}
+
+NNDEPLOY_VEC_MATH_AVX2 static inline __m256 siluAvx2(__m256 x) {
+  return _mm256_mul_ps(x, sigmoidAvx2(x));
+}
+
+NNDEPLOY_VEC_MATH_AVX2 static inline __m256 tanhAvx2(__m256 x) {
+  __m256 ax = absAvx2(x);
+  __m256 z = _mm256_mul_ps(x, x);
+  __m256 p = _mm256_set1_ps(kTanhP0);
+  p = _mm256_fmadd_ps(p, z, _mm256_set1_ps(kTanhP1));
+  p = _mm256_fmadd_ps(p, z, _mm256_set1_ps(kTanhP2));
+  p = _mm256_fmadd_ps(p, z, _mm256_set1_ps(kTanhP3));
+  p = _mm256_fmadd_ps(p, z, _mm256_set1_ps(kTanhP4));
+  __m256 small = _mm256_fmadd_ps(_mm256_mul_ps(x, z), p, x);
+  __m256 one = _mm256_set1_ps(1.0f);
+  __m256 e = expAvx2(_mm256_add_ps(ax, ax));
+  __m256 large = _mm256_sub_ps(
+      one, _mm256_div_ps(_mm256_set1_ps(2.0f), _mm256_add_ps(e, one)));
+  large = copySignAvx2(large, x);
+  __m256 mask = _mm256_cmp_ps(ax, _mm256_set1_ps(kTanhSmall), _CMP_LT_OQ);
+  return _mm256_blendv_ps(large, small, mask);
+}
+
+NNDEPLOY_VEC_MATH_AVX2 static inline __m256 erfSmallAvx2(__m256 x) {
+  __m256 z = _mm256_mul_ps(x, x);
+  __m256 p = _mm256_set1_ps(kErfT8);
+  p = _mm256_fmadd_ps(p, z, _mm256_set1_ps(kErfT7));
+  p = _mm256_fmadd_ps(p, z, _mm256_set1_ps(kErfT6));
+  p = _mm256_fmadd_ps(p, z, _mm256_set1_ps(kErfT5));
+  p = _mm256_fmadd_ps(p, z, _mm256_set1_ps(kErfT4));
+  p = _mm256_fmadd_ps(p, z, _mm256_set1_ps(kErfT3));
+  p = _mm256_fmadd_ps(p, z, _mm256_set1_ps(kErfT2));
+  p = _mm256_fmadd_ps(p, z, _mm256_set1_ps(kErfT1));
+  p = _mm256_fmadd_ps(p, z, _mm256_set1_ps(kErfT0));
+  return _mm256_mul_ps(x, p);
+}
+
+NNDEPLOY_VEC_MATH_AVX2 static inline __m256 erfcAvx2(__m256 z) {
+  __m256 one = _mm256_set1_ps(1.0f);
+  __m256 t = _mm256_div_ps(
+      one, _mm256_fmadd_ps(_mm256_set1_ps(0.5f), z, one));
+  __m256 p = _mm256_set1_ps(kErfC9);
+  p = _mm256_fmadd_ps(p, t, _mm256_set1_ps(kErfC8));
+  p = _mm256_fmadd_ps(p, t, _mm256_set1_ps(kErfC7));
+  p = _mm256_fmadd_ps(p, t, _mm256_set1_ps(kErfC6));
+  p = _mm256_fmadd_ps(p, t, _mm256_set1_ps(kErfC5));
+  p = _mm256_fmadd_ps(p, t, _mm256_set1_ps(kErfC4));
+  p = _mm256_fmadd_ps(p, t, _mm256_set1_ps(kErfC3));
+  p = _mm256_fmadd_ps(p, t, _mm256_set1_ps(kErfC2));
+  p = _mm256_fmadd_ps(p, t, _mm256_set1_ps(kErfC1));
+  p = _mm256_fmadd_ps(p, t, _mm256_set1_ps(kErfC0));
+  return _mm256_mul_ps(t, expAvx2(_mm256_fnmadd_ps(z, z, p)));
+}
+
+NNDEPLOY_VEC_MATH_AVX2 static inline __m256 erfAvx2(__m256 x) {
+  __m256 ax = absAvx2(x);
+  __m256 small = erfSmallAvx2(x);
+  __m256 large =
+      copySignAvx2(_mm256_sub_ps(_mm256_set1_ps(1.0f), erfcAvx2(ax)), x);
+  __m256 mask = _mm256_cmp_ps(ax, _mm256_set1_ps(kErfSmall), _CMP_LT_OQ);
+  return _mm256_blendv_ps(large, small, mask);
+}
+
+NNDEPLOY_VEC_MATH_AVX2 static inline __m256 geluAvx2(__m256 x) {
+  __m256 u = _mm256_mul_ps(x, _mm256_set1_ps(kSqrtHalf));
+  __m256 au = absAvx2(u);
+  __m256 small = _mm256_add_ps(_mm256_set1_ps(1.0f), erfSmallAvx2(u));
+  __m256 erfc = erfcAvx2(au);
+  __m256 positive = _mm256_cmp_ps(u, _mm256_setzero_ps(), _CMP_GT_OQ);
+  __m256 large = _mm256_blendv_ps(
+      erfc, _mm256_sub_ps(_mm256_set1_ps(2.0f), erfc), positive);
+  __m256 mask = _mm256_cmp_ps(au, _mm256_set1_ps(kErfSmall), _CMP_LT_OQ);
+  __m256 e = _mm256_blendv_ps(large, small, mask);
+  return _mm256_mul_ps(_mm256_mul_ps(_mm256_set1_ps(0.5f), x), e);
+}
+
+// 尾部不足8个时拷贝到栈上计算，保证与主循环结果一致
+#define NNDEPLOY_VEC_MATH_AVX2_LOOP(name, func)                          \
+  NNDEPLOY_VEC_MATH_AVX2 static void name(const float *x, float *y,      \
+                                          size_t n) {                    \
+    size_t i = 0;                                                        \
+    for (; i + 8 <= n; i += 8) {                                         \
+      _mm256_storeu_ps(y + i, func(_mm256_loadu_ps(x + i)));             \
+    }                                                                    \
+    if (i < n) {                                                         \
+      float buffer[8] = {0.0f};                                          \
+      memcpy(buffer, x + i, (n - i) * sizeof(float));                    \
+      _mm256_storeu_ps(buffer, func(_mm256_loadu_ps(buffer)));           \
+      memcpy(y + i, buffer, (n - i) * sizeof(float));                    \
+    }                                                                    \
+  }
+
+NNDEPLOY_VEC_MATH_AVX2_LOOP(expAvx2Loop, expAvx2)
+NNDEPLOY_VEC_MATH_AVX2_LOOP(sigmoidAvx2Loop, sigmoidAvx2)
+NNDEPLOY_VEC_MATH_AVX2_LOOP(siluAvx2Loop, siluAvx2)
+NNDEPLOY_VEC_MATH_AVX2_LOOP(tanhAvx2Loop, tanhAvx2)
+NNDEPLOY_VEC_MATH_AVX2_LOOP(erfAvx2Loop, erfAvx2)
+NNDEPLOY_VEC_MATH_AVX2_LOOP(geluAvx2Loop, geluAvx2)
+
+NNDEPLOY_VEC_MATH_AVX2 static inline float reduceMaxAvx2(__m256 v) {
+  __m128 r = _mm_max_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+  r = _mm_max_ps(r, _mm_movehl_ps(r, r));
+  r = _mm_max_ss(r, _mm_movehdup_ps(r));
+  return _mm_cvtss_f32(r);
+}
+
+NNDEPLOY_VEC_MATH_AVX2 static inline float reduceSumAvx2(__m256 v) {
+  __m128 r = _mm_add_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+  r = _mm_add_ps(r, _mm_movehl_ps(r, r));
+  r = _mm_add_ss(r, _mm_movehdup_ps(r));
+  return _mm_cvtss_f32(r);
+}
+
+NNDEPLOY_VEC_MATH_AVX2 static inline float reduceMinAvx2(__m256 v) {
+  __m128 r = _mm_min_ps(_mm256_castps256_ps128(v), _mm256_extractf128_ps(v, 1));
+  r = _mm_min_ps(r, _mm_movehl_ps(r, r));
+  r = _mm_min_ss(r, _mm_movehdup_ps(r));
+  return _mm_cvtss_f32(r);
+}
+
+NNDEPLOY_VEC_MATH_AVX2 static float maxAvx2Loop(const float *x, size_t n) {
+  __m256 m0 = _mm256_set1_ps(-std::numeric_limits<float>::infinity());
+  __m256 m1 = m0;
+  size_t i = 0;
+  for (; i + 16 <= n; i += 16) {
+    m0 = _mm256_max_ps(m0, _mm256_loadu_ps(x + i));
+    m1 = _mm256_max_ps(m1, _mm256_loadu_ps(x + i + 8));
+  }
+  float m = reduceMaxAvx2(_mm256_max_ps(m0, m1));
+  for (; i < n; ++i) {
+    m = std::max(m, x[i]);
+  }
+  return m;
+}
+
+NNDEPLOY_VEC_MATH_AVX2 static float minAvx2Loop(const float *x, size_t n) {
+  __m256 m0 = _mm256_set1_ps(std::numeric_limits<float>::infinity());
+  __m256 m1 = m0;
+  size_t i = 0;
+  for (; i + 16 <= n; i += 16) {
+    m0 = _mm256_min_ps(m0, _mm256_loadu_ps(x + i));
+    m1 = _mm256_min_ps(m1, _mm256_loadu_ps(x + i + 8));
+  }
+  float m = reduceMinAvx2(_mm256_min_ps(m0, m1));
+  for (; i < n; ++i) {
+    m = std::min(m, x[i]);
+  }
+  return m;
+}
+
+NNDEPLOY_VEC_MATH_AVX2 static float sumAvx2Loop(const float *x, size_t n) {
+  __m256 s0 = _mm256_setzero_ps();
+  __m256 s1 = s0;
+  __m256 s2 = s0;
+  __m256 s3 = s0;
+  size_t i = 0;
+  for (; i + 32 <= n; i += 32) {
+    s0 = _mm256_add_ps(s0, _mm256_loadu_ps(x + i));
+    s1 = _mm256_add_ps(s1, _mm256_loadu_ps(x + i + 8));
+    s2 = _mm256_add_ps(s2, _mm256_loadu_ps(x + i + 16));
+    s3 = _mm256_add_ps(s3, _mm256_loadu_ps(x + i + 24));
+  }
+  for (; i + 8 <= n; i += 8) {
+    s0 = _mm256_add_ps(s0, _mm256_loadu_ps(x + i));
+  }
+  float s = reduceSumAvx2(
+      _mm256_add_ps(_mm256_add_ps(s0, s1), _mm256_add_ps(s2, s3)));
+  for (; i < n; ++i) {
+    s += x[i];
+  }
+  return s;
+}
+
+NNDEPLOY_VEC_MATH_AVX2 static float squareSumAvx2Loop(const float *x,
+                                                    size_t n) {
+  __m256 s0 = _mm256_setzero_ps();
+  __m256 s1 = s0;
+  __m256 s2 = s0;
+  __m256 s3 = s0;
+  size_t i = 0;
+  for (; i + 32 <= n; i += 32) {
+    __m256 v0 = _mm256_loadu_ps(x + i);
+    __m256 v1 = _mm256_loadu_ps(x + i + 8);
+    __m256 v2 = _mm256_loadu_ps(x + i + 16);
+    __m256 v3 = _mm256_loadu_ps(x + i + 24);
+    s0 = _mm256_fmadd_ps(v0, v0, s0);
+    s1 = _mm256_fmadd_ps(v1, v1, s1);
+    s2 = _mm256_fmadd_ps(v2, v2, s2);
+    s3 = _mm256_fmadd_ps(v3, v3, s3);
+  }
+  for (; i + 8 <= n; i += 8) {
+    __m256 v = _mm256_loadu_ps(x + i);
+    s0 = _mm256_fmadd_ps(v, v, s0);
+  }
+  float s = reduceSumAvx2(
+      _mm256_add_ps(_mm256_add_ps(s0, s1), _mm256_add_ps(s2, s3)));
+  for (; i < n; ++i) {
+    s += x[i] * x[i];
+  }
+  return s;
+}
+
+NNDEPLOY_VEC_MATH_AVX2 static float absSumAvx2Loop(const float *x, size_t n) {
+  const __m256 sign = _mm256_set1_ps(-0.0f);
+  __m256 s0 = _mm256_setzero_ps();
+  __m256 s1 = s0;
+  __m256 s2 = s0;
+  __m256 s3 = s0;
+  size_t i = 0;
+  for (; i + 32 <= n; i += 32) {
+    s0 = _mm256_add_ps(s0, _mm256_andnot_ps(sign, _mm256_loadu_ps(x + i)));
+    s1 = _mm256_add_ps(s1, _mm256_andnot_ps(sign, _mm256_loadu_ps(x + i + 8)));
+    s2 = _mm256_add_ps(s2,
+                       _mm256_andnot_ps(sign, _mm256_loadu_ps(x + i + 16)));
+    s3 = _mm256_add_ps(s3,
+                       _mm256_andnot_ps(sign, _mm256_loadu_ps(x + i + 24)));
+  }
+  for (; i + 8 <= n; i += 8) {
+    s0 = _mm256_add_ps(s0, _mm256_andnot_ps(sign, _mm256_loadu_ps(x + i)));
+  }
+  float s = reduceSumAvx2(
+      _mm256_add_ps(_mm256_add_ps(s0, s1), _mm256_add_ps(s2, s3)));
+  for (; i < n; ++i) {
+    s += std::fabs(x[i]);
+  }
+  return s;
+}
+
+NNDEPLOY_VEC_MATH_AVX2 static float addSquareSumAvx2Loop(const float *x,
+                                                       const float *r,
+                                                       float *y, size_t n) {
+  __m256 s0 = _mm256_setzero_ps();
+  __m256 s1 = s0;
+  size_t i = 0;
+  for (; i + 16 <= n; i += 16) {
+    __m256 v0 = _mm256_add_ps(_mm256_loadu_ps(x + i), _mm256_loadu_ps(r + i));
+    __m256 v1 =
+        _mm256_add_ps(_mm256_loadu_ps(x + i + 8), _mm256_loadu_ps(r + i + 8));
+    _mm256_storeu_ps(y + i, v0);
+    _mm256_storeu_ps(y + i + 8, v1);
+    s0 = _mm256_fmadd_ps(v0, v0, s0);
+    s1 = _mm256_fmadd_ps(v1, v1, s1);
+  }
+  for (; i + 8 <= n; i += 8) {
+    __m256 v = _mm256_add_ps(_mm256_loadu_ps(x + i), _mm256_loadu_ps(r + i));
+    _mm256_storeu_ps(y + i, v);
+    s0 = _mm256_fmadd_ps(v, v, s0);
+  }
+  float s = reduceSumAvx2(_mm256_add_ps(s0, s1));
+  for (; i < n; ++i) {
+    float v = x[i] + r[i];
+    y[i] = v;
+    s += v * v;
+  }
+  return s;
+}
+
+NNDEPLOY_VEC_MATH_AVX2 static void scaleMulAvx2Loop(const float *x,
+                                                   float scale, const float *w,
+                                                   float *y, size_t n) {
+  __m256 vs = _mm256_set1_ps(scale);
+  size_t i = 0;
+  for (; i + 16 <= n; i += 16) {
+    __m256 v0 = _mm256_mul_ps(_mm256_loadu_ps(x + i), vs);
+    __m256 v1 = _mm256_mul_ps(_mm256_loadu_ps(x + i + 8), vs);
+    _mm256_storeu_ps(y + i, _mm256_mul_ps(v0, _mm256_loadu_ps(w + i)));
+    _mm256_storeu_ps(y + i + 8, _mm256_mul_ps(v1, _mm256_loadu_ps(w + i + 8)));
+  }
+  for (; i + 8 <= n; i += 8) {
+    __m256 v = _mm256_mul_ps(_mm256_loadu_ps(x + i), vs);
+    _mm256_storeu_ps(y + i, _mm256_mul_ps(v, _mm256_loadu_ps(w + i)));
+  }
+  for (; i < n; ++i) {
+    y[i] = x[i] * scale * w[i];
+  }
+}
+
+NNDEPLOY_VEC_MATH_AVX2 static float dotAvx2Loop(const float *x,
+                                              const float *y, size_t n) {
+  __m256 s0 = _mm256_setzero_ps();
+  __m256 s1 = s0;
+  __m256 s2 = s0;
+  __m256 s3 = s0;
+  size_t i = 0;
+  for (; i + 32 <= n; i += 32) {
+    s0 = _mm256_fmadd_ps(_mm256_loadu_ps(x + i), _mm256_loadu_ps(y + i), s0);
+    s1 = _mm256_fmadd_ps(_mm256_loadu_ps(x + i + 8),
+                         _mm256_loadu_ps(y + i + 8), s1);
+    s2 = _mm256_fmadd_ps(_mm256_loadu_ps(x + i + 16),
+                         _mm256_loadu_ps(y + i + 16), s2);
+    s3 = _mm256_fmadd_ps(_mm256_loadu_ps(x + i + 24),
+                         _mm256_loadu_ps(y + i + 24), s3);
+  }
+  for (; i + 8 <= n; i += 8) {
+    s0 = _mm256_fmadd_ps(_mm256_loadu_ps(x + i), _mm256_loadu_ps(y + i), s0);
+  }
+  float s = reduceSumAvx2(
+      _mm256_add_ps(_mm256_add_ps(s0, s1), _mm256_add_ps(s2, s3)));
+  for (; i < n; ++i) {
+    s += x[i] * y[i];
+  }
+  return s;
+}
+
+NNDEPLOY_VEC_MATH_AVX2 static void axpyAvx2Loop(float a, const float *x,
+                                               float *y, size_t n) {
+  __m256 va = _mm256_set1_ps(a);
+  size_t i = 0;
+  for (; i + 16 <= n; i += 16) {
+    _mm256_storeu_ps(y + i, _mm256_fmadd_ps(va, _mm256_loadu_ps(x + i),
+                                            _mm256_loadu_ps(y + i)));
+    _mm256_storeu_ps(y + i + 8,
+                     _mm256_fmadd_ps(va, _mm256_loadu_ps(x + i + 8),
+                                     _mm256_loadu_ps(y + i + 8)));
+  }
+  for (; i + 8 <= n; i += 8) {
+    _mm256_storeu_ps(y + i, _mm256_fmadd_ps(va, _mm256_loadu_ps(x + i),
+                                            _mm256_loadu_ps(y + i)));
+  }
+  for (; i < n; ++i) {
+    y[i] += a * x[i];
+  }
+}
+
+NNDEPLOY_VEC_MATH_AVX2 static float expSumAvx2Loop(const float *x, float m,
+                                                   float *y, size_t n) {
+  __m256 vm = _mm256_set1_ps(m);
+  __m256 sum = _mm256_setzero_ps();
+  size_t i = 0;
+  for (; i + 8 <= n; i += 8) {
+    __m256 e = expAvx2(_mm256_sub_ps(_mm256_loadu_ps(x + i), vm));
+    _mm256_storeu_ps(y + i, e);
+    sum = _mm256_add_ps(sum, e);
+  }
+  if (i < n) {
+    // 无效lane填-inf，exp后为0
+    float buffer[8];
+    std::fill(buffer, buffer + 8, -std::numeric_limits<float>::infinity());
+    memcpy(buffer, x + i, (n - i) * sizeof(float));
+    __m256 e = expAvx2(_mm256_sub_ps(_mm256_loadu_ps(buffer), vm));
+    _mm256_storeu_ps(buffer, e);
+    memcpy(y + i, buffer, (n - i) * sizeof(float));
+    sum = _mm256_add_ps(sum, e);
+  }
+  return reduceSumAvx2(sum);
+}
+
+NNDEPLOY_VEC_MATH_AVX2 static void siluMulAvx2Loop(const float *g,
+                                                  const float *u, float *y,
+                                                  size_t n) {
+  size_t i = 0;
+  for (; i + 8 <= n; i += 8) {
+    __m256 v = siluAvx2(_mm256_loadu_ps(g + i));
+    _mm256_storeu_ps(y + i, _mm256_mul_ps(v, _mm256_loadu_ps(u + i)));
+  }
+  if (i < n) {
+    float buffer[8] = {0.0f};
+    float up[8] = {0.0f};
+    memcpy(buffer, g + i, (n - i) * sizeof(float));
+    memcpy(up, u + i, (n - i) * sizeof(float));
+    __m256 v = siluAvx2(_mm256_loadu_ps(buffer));
+    _mm256_storeu_ps(buffer, _mm256_mul_ps(v, _mm256_loadu_ps(up)));
+    memcpy(y + i, buffer, (n - i) * sizeof(float));
+  }
+}
+
+NNDEPLOY_VEC_MATH_AVX2 static void rotaryAvx2Loop(const float *x0,
+                                                 const float *x1,
+                                                 const float *c,
+                                                 const float *s, float *y0,
+                                                 float *y1, size_t n) {
+  size_t i = 0;
+  for (; i + 8 <= n; i += 8) {
+    __m256 a = _mm256_loadu_ps(x0 + i);
+    __m256 b = _mm256_loadu_ps(x1 + i);
+    __m256 vc = _mm256_loadu_ps(c + i);
+    __m256 vs = _mm256_loadu_ps(s + i);
+    _mm256_storeu_ps(y0 + i, _mm256_fmsub_ps(a, vc, _mm256_mul_ps(b, vs)));
+    _mm256_storeu_ps(y1 + i, _mm256_fmadd_ps(b, vc, _mm256_mul_ps(a, vs)));
+  }
+  rotaryScalarLoop(x0 + i, x1 + i, c + i, s + i, y0 + i, y1 + i, n - i);
+}
+
+// 每次处理4对，cos/sin按对复制，交换对内顺序后用fmaddsub一次完成旋转
+NNDEPLOY_VEC_MATH_AVX2 static void rotaryInterleavedAvx2Loop(const float *x,
+                                                            const float *c,
+                                                            const float *s,
+                                                            float *y,
+                                                            size_t n) {
+  const __m256i index = _mm256_setr_epi32(0, 0, 1, 1, 2, 2, 3, 3);
+  size_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    __m256 v = _mm256_loadu_ps(x + 2 * i);
+    __m256 vc = _mm256_permutevar8x32_ps(
+        _mm256_castps128_ps256(_mm_loadu_ps(c + i)), index);
+    __m256 vs = _mm256_permutevar8x32_ps(
+        _mm256_castps128_ps256(_mm_loadu_ps(s + i)), index);
+    __m256 swap = _mm256_permute_ps(v, 0xB1);
+    _mm256_storeu_ps(y + 2 * i,
+                     _mm256_fmaddsub_ps(v, vc, _mm256_mul_ps(swap, vs)));
+  }
+  rotaryInterleavedScalarLoop(x + 2 * i, c + i, s + i, y + 2 * i, n - i);
+}
+
+NNDEPLOY_VEC_MATH_AVX2 static size_t selectGreaterAvx2Loop(const float *x,
+                                                         size_t n, float t,
+                                                         int32_t *index) {
+  const __m256 vt = _mm256_set1_ps(t);
+  size_t count = 0;
+  size_t i = 0;
+  // 大部分块没有超过阈值的元素，整块跳过
+  for (; i + 16 <= n; i += 16) {
+    int mask0 = _mm256_movemask_ps(
+        _mm256_cmp_ps(_mm256_loadu_ps(x + i), vt, _CMP_GT_OQ));
+    int mask1 = _mm256_movemask_ps(
+        _mm256_cmp_ps(_mm256_loadu_ps(x + i + 8), vt, _CMP_GT_OQ));
+    unsigned mask = static_cast<unsigned>(mask0 | (mask1 << 8));
+    while (mask != 0) {
+      index[count++] = static_cast<int32_t>(i + __builtin_ctz(mask));
+      mask &= mask - 1;
+    }
+  }
+  for (; i < n; ++i) {
+    index[count] = static_cast<int32_t>(i);
+    count += x[i] > t ? 1 : 0;
+  }
+  return count;
+}
+
+// 两组累加器交替更新，缩短均值的依赖链
+NNDEPLOY_VEC_MATH_AVX2 static void meanVarAvx2Loop(const float *x, size_t n,
+                                                  float *mean, float *var) {
+  __m256 m0 = _mm256_setzero_ps();
+  __m256 m1 = m0;
+  __m256 s0 = m0;
+  __m256 s1 = m0;
+  size_t count = 0;
+  size_t i = 0;
+  for (; i + 16 <= n; i += 16) {
+    __m256 r = _mm256_set1_ps(1.0f / static_cast<float>(++count));
+    __m256 v0 = _mm256_loadu_ps(x + i);
+    __m256 v1 = _mm256_loadu_ps(x + i + 8);
+    __m256 d0 = _mm256_sub_ps(v0, m0);
+    __m256 d1 = _mm256_sub_ps(v1, m1);
+    m0 = _mm256_fmadd_ps(d0, r, m0);
+    m1 = _mm256_fmadd_ps(d1, r, m1);
+    s0 = _mm256_fmadd_ps(d0, _mm256_sub_ps(v0, m0), s0);
+    s1 = _mm256_fmadd_ps(d1, _mm256_sub_ps(v1, m1), s1);
+  }
+  float m[16];
+  float s[16];
+  _mm256_storeu_ps(m, m0);
+  _mm256_storeu_ps(m + 8, m1);
+  _mm256_storeu_ps(s, s0);
+  _mm256_storeu_ps(s + 8, s1);
+  meanVarMerge(m, s, 16, count, x + i, n - i, mean, var);
+}
+
+NNDEPLOY_VEC_MATH_AVX2 static void normAffineAvx2Loop(
+    const float *x, float mean, float rstd, const float *gamma,
+    const float *beta, float *y, size_t n) {
+  __m256 vm = _mm256_set1_ps(mean);
+  __m256 vr = _mm256_set1_ps(rstd);
+  size_t i = 0;
+  if (beta != nullptr) {
+    for (; i + 8 <= n; i += 8) {
+      __m256 t = _mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(x + i), vm), vr);
+      _mm256_storeu_ps(y + i, _mm256_fmadd_ps(t, _mm256_loadu_ps(gamma + i),
+                                              _mm256_loadu_ps(beta + i)));
+    }
+  } else {
+    for (; i + 8 <= n; i += 8) {
+      __m256 t = _mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(x + i), vm), vr);
+      _mm256_storeu_ps(y + i, _mm256_mul_ps(t, _mm256_loadu_ps(gamma + i)));
+    }
+  }
+  normAffineScalarLoop(x + i, mean, rstd, gamma + i,
+                       beta != nullptr ? beta + i : nullptr, y + i, n - i);
+}
+
+NNDEPLOY_VEC_MATH_AVX2 static void scaleShiftAvx2Loop(const float *x, float a,
+                                                     float b, float *y,
+                                                     size_t n) {
+  __m256 va = _mm256_set1_ps(a);
+  __m256 vb = _mm256_set1_ps(b);
+  size_t i = 0;
+  for (; i + 16 <= n; i += 16) {
+    _mm256_storeu_ps(y + i, _mm256_fmadd_ps(_mm256_loadu_ps(x + i), va, vb));
+    _mm256_storeu_ps(y + i + 8,
+                     _mm256_fmadd_ps(_mm256_loadu_ps(x + i + 8), va, vb));
+  }
+  for (; i + 8 <= n; i += 8) {
+    _mm256_storeu_ps(y + i, _mm256_fmadd_ps(_mm256_loadu_ps(x + i), va, vb));
+  }
+  for (; i < n; ++i) {
+    y[i] = x[i] * a + b;
+  }
+}
+
+// AVX-512实现，每次处理16个float
+NNDEPLOY_VEC_MATH_AVX512 static inline __m512 expAvx512(__m512 x) {
+  x = _mm512_min_ps(_mm512_set1_ps(kExpHi),
+                    _mm512_max_ps(_mm512_set1_ps(kExpLo), x));
+  __m512 fx = _mm512_roundscale_ps(
+      _mm512_fmadd_ps(x, _mm512_set1_ps(kLog2e), _mm512_set1_ps(0.5f)),
+      _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+  __m512 r = _mm512_fnmadd_ps(fx, _mm512_set1_ps(kLn2Hi), x);
+  r = _mm512_fnmadd_ps(fx, _mm512_set1_ps(kLn2Lo), r);
+  __m512 p = _mm512_set1_ps(kExpP0);
+  p = _mm512_fmadd_ps(p, r, _mm512_set1_ps(kExpP1));
+  p = _mm512_fmadd_ps(p, r, _mm512_set1_ps(kExpP2));
+  p = _mm512_fmadd_ps(p, r, _mm512_set1_ps(kExpP3));
+  p = _mm512_fmadd_ps(p, r, _mm512_set1_ps(kExpP4));
+  p = _mm512_fmadd_ps(p, r, _mm512_set1_ps(kExpP5));
+  __m512 y = _mm512_fmadd_ps(p, _mm512_mul_ps(r, r),
+                             _mm512_add_ps(r, _mm512_set1_ps(1.0f)));
+  __m512i n = _mm512_cvtps_epi32(fx);
+  __m512i n1 = _mm512_srai_epi32(n, 1);
+  __m512i n2 = _mm512_sub_epi32(n, n1);
+  __m512i bias = _mm512_set1_epi32(127);
+  __m512 s1 = _mm512_castsi512_ps(
+      _mm512_slli_epi32(_mm512_add_epi32(n1, bias), 23));
+  __m512 s2 = _mm512_castsi512_ps(
+      _mm512_slli_epi32(_mm512_add_epi32(n2, bias), 23));
+  return _mm512_mul_ps(_mm512_mul_ps(y, s1), s2);
+}
+
+NNDEPLOY_VEC_MATH_AVX512 static inline __m512 absAvx512(__m512 x) {
+  return _mm512_castsi512_ps(_mm512_and_si512(
+      _mm512_castps_si512(x), _mm512_set1_epi32(0x7fffffff)));
+}
+
+NNDEPLOY_VEC_MATH_AVX512 static inline __m512 copySignAvx512(__m512 y,
+                                                             __m512 x) {
+  __m512i sign = _mm512_and_si512(_mm512_castps_si512(x),
+                                  _mm512_set1_epi32(0x80000000));
+  return _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(y), sign));
+}
+
+NNDEPLOY_VEC_MATH_AVX512 static inline __m512 sigmoidAvx512(__m512 x) {
+  __m512 one = _mm512_set1_ps(1.0f);
+  __m512 e = expAvx512(_mm512_castsi512_ps(_mm512_or_si512(
+      _mm512_castps_si512(x), _mm512_set1_epi32(0x80000000))));
+  __m512 r = _mm512_div_ps(one, _mm512_add_ps(one, e));
+  __mmask16 negative =
+      _mm512_cmp_ps_mask(x, _mm512_setzero_ps(), _CMP_LT_OQ);
+  return _mm512_mask_blend_ps(negative, r, _mm512_mul_ps(e, r));
+}
+
+NNDEPLOY_VEC_MATH_AVX512 static inline __m512 siluAvx512(__m512 x) {
+  return _mm512_mul_ps(x, sigmoidAvx512(x));
+}
+
+NNDEPLOY_VEC_MATH_AVX512 static inline __m512 tanhAvx512(__m512 x) {
+  __m512 ax = absAvx512(x);
+  __m512 z = _mm512_mul_ps(x, x);
+  __m512 p = _mm512_set1_ps(kTanhP0);
+  p = _mm512_fmadd_ps(p, z, _mm512_set1_ps(kTanhP1));
+  p = _mm512_fmadd_ps(p, z, _mm512_set1_ps(kTanhP2));
+  p = _mm512_fmadd_ps(p, z, _mm512_set1_ps(kTanhP3));
+  p = _mm512_fmadd_ps(p, z, _mm512_set1_ps(kTanhP4));
+  __m512 small = _mm512_fmadd_ps(_mm512_mul_ps(x, z), p, x);
+  __m512 one = _mm512_set1_ps(1.0f);
+  __m512 e = expAvx512(_mm512_add_ps(ax, ax));
+  __m512 large = _mm512_sub_ps(
+      one, _mm512_div_ps(_mm512_set1_ps(2.0f), _mm512_add_ps(e, one)));
+  large = copySignAvx512(large, x);
+  __mmask16 mask =
+      _mm512_cmp_ps_mask(ax, _mm512_set1_ps(kTanhSmall), _CMP_LT_OQ);
+  return _mm512_mask_blend_ps(mask, large, small);
+}
+
+NNDEPLOY_VEC_MATH_AVX512 static inline __m512 erfSmallAvx512(__m512 x) {
+  __m512 z = _mm512_mul_ps(x, x);
+  __m512 p = _mm512_set1_ps(kErfT8);
+  p = _mm512_fmadd_ps(p, z, _mm512_set1_ps(kErfT7));
+  p = _mm512_fmadd_ps(p, z, _mm512_set1_ps(kErfT6));
+  p = _mm512_fmadd_ps(p, z, _mm512_set1_ps(kErfT5));
+  p = _mm512_fmadd_ps(p, z, _mm512_set1_ps(kErfT4));
+  p = _mm512_fmadd_ps(p, z, _mm512_set1_ps(kErfT3));
+  p = _mm512_fmadd_ps(p, z, _mm512_set1_ps(kErfT2));
+  p = _mm512_fmadd_ps(p, z, _mm512_set1_ps(kErfT1));
+  p = _mm512_fmadd_ps(p, z, _mm512_set1_ps(kErfT0));
+  return _mm512_mul_ps(x, p);
+}
+
+NNDEPLOY_VEC_MATH_AVX512 static inline __m512 erfcAvx512(__m512 z) {
+  __m512 one = _mm512_set1_ps(1.0f);
+  __m512 t = _mm512_div_ps(
+      one, _mm512_fmadd_ps(_mm512_set1_ps(0.5f), z, one));
+  __m512 p = _mm512_set1_ps(kErfC9);
+  p = _mm512_fmadd_ps(p, t, _mm512_set1_ps(kErfC8));
+  p = _mm512_fmadd_ps(p, t, _mm512_set1_ps(kErfC7));
+  p = _mm512_fmadd_ps(p, t, _mm512_set1_ps(kErfC6));
+  p = _mm512_fmadd_ps(p, t, _mm512_set1_ps(kErfC5));
+  p = _mm512_fmadd_ps(p, t, _mm512_set1_ps(kErfC4));
+  p = _mm512_fmadd_ps(p, t, _mm512_set1_ps(kErfC3));
+  p = _mm512_fmadd_ps(p, t, _mm512_set1_ps(kErfC2));
+  p = _mm512_fmadd_ps(p, t, _mm512_set1_ps(kErfC1));
+  p = _mm512_fmadd_ps(p, t, _mm512_set1_ps(kErfC0));
+  return _mm512_mul_ps(t, expAvx512(_mm512_fnmadd_ps(z, z, p)));
+}
+
+NNDEPLOY_VEC_MATH_AVX512 static inline __m512 erfAvx512(__m512 x) {
+  __m512 ax = absAvx512(x);
+  __m512 small = erfSmallAvx512(x);
+  __m512 large = copySignAvx512(
+      _mm512_sub_ps(_mm512_set1_ps(1.0f), erfcAvx512(ax)), x);
+  __mmask16 mask =
+      _mm512_cmp_ps_mask(ax, _mm512_set1_ps(kErfSmall), _CMP_LT_OQ);
+  return _mm512_mask_blend_ps(mask, large, small);
+}
+
+NNDEPLOY_VEC_MATH_AVX512 static inline __m512 geluAvx512(__m512 x) {
+  __m512 u = _mm512_mul_ps(x, _mm512_set1_ps(kSqrtHalf));
+  __m512 au = absAvx512(u);
+  __m512 small = _mm512_add_ps(_mm512_set1_ps(1.0f), erfSmallAvx512(u));
+  __m512 erfc = erfcAvx512(au);
+  __mmask16 positive =
+      _mm512_cmp_ps_mask(u, _mm512_setzero_ps(), _CMP_GT_OQ);
+  __m512 large = _mm512_mask_blend_ps(
+      positive, erfc, _mm512_sub_ps(_mm512_set1_ps(2.0f), erfc));
+  __mmask16 mask =
+      _mm512_cmp_ps_mask(au, _mm512_set1_ps(kErfSmall), _CMP_LT_OQ);
+  __m512 e = _mm512_mask_blend_ps(mask, large, small);
+  return _mm512_mul_ps(_mm512_mul_ps(_mm512_set1_ps(0.5f), x), e);
+}
+
+// 尾部使用masked load/store
+#define NNDEPLOY_VEC_MATH_AVX512_LOOP(name, func)                        \
+  NNDEPLOY_VEC_MATH_AVX512 static void name(const float *x, float *y,    \
+                                            size_t n) {                  \
+    size_t i = 0;                                                        \
+    for (; i + 16 <= n; i += 16) {                                       \
+      _mm512_storeu_ps(y + i, func(_mm512_loadu_ps(x + i)));             \
+    }                                                                    \
+    if (i < n) {                                                         \
+      __mmask16 mask = static_cast<__mmask16>((1u << (n - i)) - 1);      \
+      _mm512_mask_storeu_ps(y + i, mask,                                 \
+                            func(_mm512_maskz_loadu_ps(mask, x + i)));   \
+    }                                                                    \
+  }
+
+NNDEPLOY_VEC_MATH_AVX512_LOOP(expAvx512Loop, expAvx512)
+NNDEPLOY_VEC_MATH_AVX512_LOOP(sigmoidAvx512Loop, sigmoidAvx512)
+NNDEPLOY_VEC_MATH_AVX512_LOOP(siluAvx512Loop, siluAvx512)
+NNDEPLOY_VEC_MATH_AVX512_LOOP(tanhAvx512Loop, tanhAvx512)
+NNDEPLOY_VEC_MATH_AVX512_LOOP(erfAvx512Loop, erfAvx512)
+NNDEPLOY_VEC_MATH_AVX512_LOOP(geluAvx512Loop, geluAvx512)
+
+NNDEPLOY_VEC_MATH_AVX512 static float maxAvx512Loop(const float *x,
+                                                    size_t n) {
+  __m512 m0 = _mm512_set1_ps(-std::numeric_limits<float>::infinity());
+  __m512 m1 = m0;
+  size_t i = 0;
+  for (; i + 32 <= n; i += 32) {
+    m0 = _mm512_max_ps(m0, _mm512_loadu_ps(x + i));
+    m1 = _mm512_max_ps(m1, _mm512_loadu_ps(x + i + 16));
+  }
+  for (; i + 16 <= n; i += 16) {
+    m0 = _mm512_max_ps(m0, _mm512_loadu_ps(x + i));
+  }
+  if (i < n) {
+    __mmask16 mask = static_cast<__mmask16>((1u << (n - i)) - 1);
+    m1 = _mm512_mask_max_ps(m1, mask, m1, _mm512_maskz_loadu_ps(mask, x + i));
+  }
+  return _mm512_reduce_max_ps(_mm512_max_ps(m0, m1));
+}
+
+NNDEPLOY_VEC_MATH_AVX512 static float minAvx512Loop(const float *x,
+                                                    size_t n) {
+  __m512 m0 = _mm512_set1_ps(std::numeric_limits<float>::infinity());
+  __m512 m1 = m0;
+  size_t i = 0;
+  for (; i + 32 <= n; i += 32) {
+    m0 = _mm512_min_ps(m0, _mm512_loadu_ps(x + i));
+    m1 = _mm512_min_ps(m1, _mm512_loadu_ps(x + i + 16));
+  }
+  for (; i + 16 <= n; i += 16) {
+    m0 = _mm512_min_ps(m0, _mm512_loadu_ps(x + i));
+  }
+  if (i < n) {
+    __mmask16 mask = static_cast<__mmask16>((1u << (n - i)) - 1);
+    m1 = _mm512_mask_min_ps(m1, mask, m1, _mm512_maskz_loadu_ps(mask, x + i));
+  }
+  return _mm512_reduce_min_ps(_mm512_min_ps(m0, m1));
+}
+
+NNDEPLOY_VEC_MATH_AVX512 static float sumAvx512Loop(const float *x,
+                                                    size_t n) {
+  __m512 s0 = _mm512_setzero_ps();
+  __m512 s1 = s0;
+  __m512 s2 = s0;
+  __m512 s3 = s0;
+  size_t i = 0;
+  for (; i + 64 <= n; i += 64) {
+    s0 = _mm512_add_ps(s0, _mm512_loadu_ps(x + i));
+    s1 = _mm512_add_ps(s1, _mm512_loadu_ps(x + i + 16));
+    s2 = _mm512_add_ps(s2, _mm512_loadu_ps(x + i + 32));
+    s3 = _mm512_add_ps(s3, _mm512_loadu_ps(x + i + 48));
+  }
+  for (; i + 16 <= n; i += 16) {
+    s0 = _mm512_add_ps(s0, _mm512_loadu_ps(x + i));
+  }
+  if (i < n) {
+    __mmask16 mask = static_cast<__mmask16>((1u << (n - i)) - 1);
+    s1 = _mm512_add_ps(s1, _mm512_maskz_loadu_ps(mask, x + i));
+  }
+  return _mm512_reduce_add_ps(
+      _mm512_add_ps(_mm512_add_ps(s0, s1), _mm512_add_ps(s2, s3)));
+}
+
+NNDEPLOY_VEC_MATH_AVX512 static float squareSumAvx512Loop(const float *x,
+                                                          size_t n) {
+  __m512 s0 = _mm512_setzero_ps();
+  __m512 s1 = s0;
+  __m512 s2 = s0;
+  __m512 s3 = s0;
+  size_t i = 0;
+  for (; i + 64 <= n; i += 64) {
+    __m512 v0 = _mm512_loadu_ps(x + i);
+    __m512 v1 = _mm512_loadu_ps(x + i + 16);
+    __m512 v2 = _mm512_loadu_ps(x + i + 32);
+    __m512 v3 = _mm512_loadu_ps(x + i + 48);
+    s0 = _mm512_fmadd_ps(v0, v0, s0);
+    s1 = _mm512_fmadd_ps(v1, v1, s1);
+    s2 = _mm512_fmadd_ps(v2, v2, s2);
+    s3 = _mm512_fmadd_ps(v3, v3, s3);
+  }
+  for (; i + 16 <= n; i += 16) {
+    __m512 v = _mm512_loadu_ps(x + i);
+    s0 = _mm512_fmadd_ps(v, v, s0);
+  }
+  if (i < n) {
+    __mmask16 mask = static_cast<__mmask16>((1u << (n - i)) - 1);
+    __m512 v = _mm512_maskz_loadu_ps(mask, x + i);
+    s1 = _mm512_fmadd_ps(v, v, s1);
+  }
+  return _mm512_reduce_add_ps(
+      _mm512_add_ps(_mm512_add_ps(s0, s1), _mm512_add_ps(s2, s3)));
+}
+
+NNDEPLOY_VEC_MATH_AVX512 static float absSumAvx512Loop(const float *x,
+                                                       size_t n) {
+  __m512 s0 = _mm512_setzero_ps();
+  __m512 s1 = s0;
+  __m512 s2 = s0;
+  __m512 s3 = s0;
+  size_t i = 0;
+  for (; i + 64 <= n; i += 64) {
+    s0 = _mm512_add_ps(s0, _mm512_abs_ps(_mm512_loadu_ps(x + i)));
+    s1 = _mm512_add_ps(s1, _mm512_abs_ps(_mm512_loadu_ps(x + i + 16)));
+    s2 = _mm512_add_ps(s2, _mm512_abs_ps(_mm512_loadu_ps(x + i + 32)));
+    s3 = _mm512_add_ps(s3, _mm512_abs_ps(_mm512_loadu_ps(x + i + 48)));
+  }
+  for (; i + 16 <= n; i += 16) {
+    s0 = _mm512_add_ps(s0, _mm512_abs_ps(_mm512_loadu_ps(x + i)));
+  }
+  if (i < n) {
+    __mmask16 mask = static_cast<__mmask16>((1u << (n - i)) - 1);
+    s1 = _mm512_add_ps(s1, _mm512_abs_ps(_mm512_maskz_loadu_ps(mask, x + i)));
+  }
+  return _mm512_reduce_add_ps(
+      _mm512_add_ps(_mm512_add_ps(s0, s1), _mm512_add_ps(s2, s3)));
+}
+
+NNDEPLOY_VEC_MATH_AVX512 static float addSquareSumAvx512Loop(const float *x,
+                                                             const float *r,
+                                                             float *y,
+                                                             size_t n) {
+  __m512 s0 = _mm512_setzero_ps();
+  __m512 s1 = s0;
+  size_t i = 0;
+  for (; i + 32 <= n; i += 32) {
+    __m512 v0 = _mm512_add_ps(_mm512_loadu_ps(x + i), _mm512_loadu_ps(r + i));
+    __m512 v1 = _mm512_add_ps(_mm512_loadu_ps(x + i + 16),
+                              _mm512_loadu_ps(r + i + 16));
+    _mm512_storeu_ps(y + i, v0);
+    _mm512_storeu_ps(y + i + 16, v1);
+    s0 = _mm512_fmadd_ps(v0, v0, s0);
+    s1 = _mm512_fmadd_ps(v1, v1, s1);
+  }
+  for (; i + 16 <= n; i += 16) {
+    __m512 v = _mm512_add_ps(_mm512_loadu_ps(x + i), _mm512_loadu_ps(r + i));
+    _mm512_storeu_ps(y + i, v);
+    s0 = _mm512_fmadd_ps(v, v, s0);
+  }
+  if (i < n) {
+    __mmask16 mask = static_cast<__mmask16>((1u << (n - i)) - 1);
+    __m512 v = _mm512_add_ps(_mm512_maskz_loadu_ps(mask, x + i),
+                             _mm512_maskz_loadu_ps(mask, r + i));
+    _mm512_mask_storeu_ps(y + i, mask, v);
+    s1 = _mm512_fmadd_ps(v, v, s1);
+  }
+  return _mm512_reduce_add_ps(_mm512_add_ps(s0, s1));
+}
+
+NNDEPLOY_VEC_MATH_AVX512 static void scaleMulAvx512Loop(const float *x,
+                                                        float scale,
+                                                        const float *w,
+                                                        float *y, size_t n) {
+  __m512 vs = _mm512_set1_ps(scale);
+  size_t i = 0;
+  for (; i + 16 <= n; i += 16) {
+    __m512 v = _mm512_mul_ps(_mm512_loadu_ps(x + i), vs);
+    _mm512_storeu_ps(y + i, _mm512_mul_ps(v, _mm512_loadu_ps(w + i)));
+  }
+  if (i < n) {
+    __mmask16 mask = static_cast<__mmask16>((1u << (n - i)) - 1);
+    __m512 v = _mm512_mul_ps(_mm512_maskz_loadu_ps(mask, x + i), vs);
+    _mm512_mask_storeu_ps(y + i, mask,
+                          _mm512_mul_ps(v, _mm512_maskz_loadu_ps(mask, w + i)));
+  }
+}
+
+NNDEPLOY_VEC_MATH_AVX512 static float dotAvx512Loop(const float *x,
+                                                    const float *y, size_t n) {
+  __m512 s0 = _mm512_setzero_ps();
+  __m512 s1 = s0;
+  __m512 s2 = s0;
+  __m512 s3 = s0;
+  size_t i = 0;
+  for (; i + 64 <= n; i += 64) {
+    s0 = _mm512_fmadd_ps(_mm512_loadu_ps(x + i), _mm512_loadu_ps(y + i), s0);
+    s1 = _mm512_fmadd_ps(_mm512_loadu_ps(x + i + 16),
+                         _mm512_loadu_ps(y + i + 16), s1);
+    s2 = _mm512_fmadd_ps(_mm512_loadu_ps(x + i + 32),
+                         _mm512_loadu_ps(y + i + 32), s2);
+    s3 = _mm512_fmadd_ps(_mm512_loadu_ps(x + i + 48),
+                         _mm512_loadu_ps(y + i + 48), s3);
+  }
+  for (; i + 16 <= n; i += 16) {
+    s0 = _mm512_fmadd_ps(_mm512_loadu_ps(x + i), _mm512_loadu_ps(y + i), s0);
+  }
+  if (i < n) {
+    __mmask16 mask = static_cast<__mmask16>((1u << (n - i)) - 1);
+    s1 = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(mask, x + i),
+                         _mm512_maskz_loadu_ps(mask, y + i), s1);
+  }
+  return _mm512_reduce_add_ps(
+      _mm512_add_ps(_mm512_add_ps(s0, s1), _mm512_add_ps(s2, s3)));
+}
+
+NNDEPLOY_VEC_MATH_AVX512 static void axpyAvx512Loop(float a, const float *x,
+                                                    float *y, size_t n) {
+  __m512 va = _mm512_set1_ps(a);
+  size_t i = 0;
+  for (; i + 16 <= n; i += 16) {
+    _mm512_storeu_ps(y + i, _mm512_fmadd_ps(va, _mm512_loadu_ps(x + i),
+                                            _mm512_loadu_ps(y + i)));
+  }
+  if (i < n) {
+    __mmask16 mask = static_cast<__mmask16>((1u << (n - i)) - 1);
+    _mm512_mask_storeu_ps(
+        y + i, mask,
+        _mm512_fmadd_ps(va, _mm512_maskz_loadu_ps(mask, x + i),
+                        _mm512_maskz_loadu_ps(mask, y + i)));
+  }
+}
+
+NNDEPLOY_VEC_MATH_AVX512 static float expSumAvx512Loop(const float *x,
+                                                       float m, float *y,
+                                                       size_t n) {
+  __m512 vm = _mm512_set1_ps(m);
+  __m512 sum = _mm512_setzero_ps();
+  size_t i = 0;
+  for (; i + 16 <= n; i += 16) {
+    __m512 e = expAvx512(_mm512_sub_ps(_mm512_loadu_ps(x + i), vm));
+    _mm512_storeu_ps(y + i, e);
+    sum = _mm512_add_ps(sum, e);
+  }
+  if (i < n) {
+    __mmask16 mask = static_cast<__mmask16>((1u << (n - i)) - 1);
+    __m512 e = expAvx512(_mm512_sub_ps(_mm512_maskz_loadu_ps(mask, x + i), vm));
+    _mm512_mask_storeu_ps(y + i, mask, e);
+    sum = _mm512_mask_add_ps(sum, mask, sum, e);
+  }
+  return _mm512_reduce_add_ps(sum);
+}
+
+NNDEPLOY_VEC_MATH_AVX512 static void siluMulAvx512Loop(const float *g,
+                                                      const float *u,
+                                                      float *y, size_t n) {
+  size_t i = 0;
+  for (; i + 16 <= n; i += 16) {
+    __m512 v = siluAvx512(_mm512_loadu_ps(g + i));
+    _mm512_storeu_ps(y + i, _mm512_mul_ps(v, _mm512_loadu_ps(u + i)));
+  }
+  if (i < n) {
+    __mmask16 mask = static_cast<__mmask16>((1u << (n - i)) - 1);
+    __m512 v = siluAvx512(_mm512_maskz_loadu_ps(mask, g + i));
+    _mm512_mask_storeu_ps(
+        y + i, mask, _mm512_mul_ps(v, _mm512_maskz_loadu_ps(mask, u + i)));
+  }
+}
+
+NNDEPLOY_VEC_MATH_AVX512 static void rotaryAvx512Loop(
+    const float *x0, const float *x1, const float *c, const float *s,
+    float *y0, float *y1, size_t n) {
+  size_t i = 0;
+  __mmask16 mask = 0xFFFF;
+  for (; i < n; i += 16) {
+    if (i + 16 > n) {
+      mask = static_cast<__mmask16>((1u << (n - i)) - 1);
+    }
+    __m512 a = _mm512_maskz_loadu_ps(mask, x0 + i);
+    __m512 b = _mm512_maskz_loadu_ps(mask, x1 + i);
+    __m512 vc = _mm512_maskz_loadu_ps(mask, c + i);
+    __m512 vs = _mm512_maskz_loadu_ps(mask, s + i);
+    __m512 r0 = _mm512_fmsub_ps(a, vc, _mm512_mul_ps(b, vs));
+    __m512 r1 = _mm512_fmadd_ps(b, vc, _mm512_mul_ps(a, vs));
+    _mm512_mask_storeu_ps(y0 + i, mask, r0);
+    _mm512_mask_storeu_ps(y1 + i, mask, r1);
+  }
+}
+
+NNDEPLOY_VEC_MATH_AVX512 static void rotaryInterleavedAvx512Loop(
+    const float *x, const float *c, const float *s, float *y, size_t n) {
+  const __m512i index = _mm512_setr_epi32(0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5,
+                                          6, 6, 7, 7);
+  size_t i = 0;
+  for (; i + 8 <= n; i += 8) {
+    __m512 v = _mm512_loadu_ps(x + 2 * i);
+    __m512 vc = _mm512_permutexvar_ps(
+        index, _mm512_castps256_ps512(_mm256_loadu_ps(c + i)));
+    __m512 vs = _mm512_permutexvar_ps(
+        index, _mm512_castps256_ps512(_mm256_loadu_ps(s + i)));
+    __m512 swap = _mm512_permute_ps(v, 0xB1);
+    _mm512_storeu_ps(y + 2 * i,
+                     _mm512_fmaddsub_ps(v, vc, _mm512_mul_ps(swap, vs)));
+  }
+  rotaryInterleavedScalarLoop(x + 2 * i, c + i, s + i, y + 2 * i, n - i);
+}
+
+NNDEPLOY_VEC_MATH_AVX512 static size_t selectGreaterAvx512Loop(const float *x,
+                                                           size_t n, float t,
+                                                           int32_t *index) {
+  const __m512 vt = _mm512_set1_ps(t);
+  const __m512i step = _mm512_set1_epi32(16);
+  __m512i offset = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12,
+                                     13, 14, 15);
+  size_t count = 0;
+  size_t i = 0;
+  for (; i + 16 <= n; i += 16) {
+    __mmask16 mask =
+        _mm512_cmp_ps_mask(_mm512_loadu_ps(x + i), vt, _CMP_GT_OQ);
+    if (mask != 0) {
+      _mm512_mask_compressstoreu_epi32(index + count, mask, offset);
+      count += __builtin_popcount(mask);
+    }
+    offset = _mm512_add_epi32(offset, step);
+  }
+  if (i < n) {
+    __mmask16 tail = static_cast<__mmask16>((1u << (n - i)) - 1);
+    __mmask16 mask = _mm512_mask_cmp_ps_mask(
+        tail, _mm512_maskz_loadu_ps(tail, x + i), vt, _CMP_GT_OQ);
+    _mm512_mask_compressstoreu_epi32(index + count, mask, offset);
+    count += __builtin_popcount(mask);
+  }
+  return count;
+}
+
+NNDEPLOY_VEC_MATH_AVX512 static void meanVarAvx512Loop(const float *x,
+                                                      size_t n, float *mean,
+                                                      float *var) {
+  __m512 m0 = _mm512_setzero_ps();
+  __m512 m1 = m0;
+  __m512 s0 = m0;
+  __m512 s1 = m0;
+  size_t count = 0;
+  size_t i = 0;
+  for (; i + 32 <= n; i += 32) {
+    __m512 r = _mm512_set1_ps(1.0f / static_cast<float>(++count));
+    __m512 v0 = _mm512_loadu_ps(x + i);
+    __m512 v1 = _mm512_loadu_ps(x + i + 16);
+    __m512 d0 = _mm512_sub_ps(v0, m0);
+    __m512 d1 = _mm512_sub_ps(v1, m1);
+    m0 = _mm512_fmadd_ps(d0, r, m0);
+    m1 = _mm512_fmadd_ps(d1, r, m1);
+    s0 = _mm512_fmadd_ps(d0, _mm512_sub_ps(v0, m0), s0);
+    s1 = _mm512_fmadd_ps(d1, _mm512_sub_ps(v1, m1), s1);
+  }
+  float m[32];
+  float s[32];
+  _mm512_storeu_ps(m, m0);
+  _mm512_storeu_ps(m + 16, m1);
+  _mm512_storeu_ps(s, s0);
+  _mm512_storeu_ps(s + 16, s1);
+  meanVarMerge(m, s, 32, count, x + i, n - i, mean, var);
+}
+
+NNDEPLOY_VEC_MATH_AVX512 static void normAffineAvx512Loop(
+    const float *x, float mean, float rstd, const float *gamma,
+    const float *beta, float *y, size_t n) {
+  __m512 vm = _mm512_set1_ps(mean);
+  __m512 vr = _mm512_set1_ps(rstd);
+  for (size_t i = 0; i < n; i += 16) {
+    __mmask16 mask = n - i >= 16
+                         ? static_cast<__mmask16>(0xffff)
+                         : static_cast<__mmask16>((1u << (n - i)) - 1);
+    __m512 t = _mm512_mul_ps(
+        _mm512_sub_ps(_mm512_maskz_loadu_ps(mask, x + i), vm), vr);
+    __m512 v = _mm512_maskz_loadu_ps(mask, gamma + i);
+    if (beta != nullptr) {
+      v = _mm512_fmadd_ps(t, v, _mm512_maskz_loadu_ps(mask, beta + i));
+    } else {
+      v = _mm512_mul_ps(t, v);
+    }
+    _mm512_mask_storeu_ps(y + i, mask, v);
+  }
+}
+
+NNDEPLOY_VEC_MATH_AVX512 static void scaleShiftAvx512Loop(const float *x,
+                                                         float a, float b,
+                                                         float *y, size_t n) {
+  __m512 va = _mm512_set1_ps(a);
+  __m512 vb = _mm512_set1_ps(b);
+  size_t i = 0;
+  for (; i + 16 <= n; i += 16) {
+    _mm512_storeu_ps(y + i, _mm512_fmadd_ps(_mm512_loadu_ps(x + i), va, vb));
+  }
+  if (i < n) {
+    __mmask16 mask = static_cast<__mmask16>((1u << (n - i)) - 1);
+    _mm512_mask_storeu_ps(
+        y + i, mask,
+        _mm512_fmadd_ps(_mm512_maskz_loadu_ps(mask, x + i), va, vb));
+  }
+}
+
+#endif
+
+/**
+ * @brief 按CPU能力选出的一组实现，首次使用时确定
+ */
+struct VecMathKernel {
+  const char *isa_;
+  VecFunc exp_;
+  VecFunc sigmoid_;
+  VecFunc silu_;
+  VecFunc tanh_;
+  VecFunc erf_;
+  VecFunc gelu_;
+  float (*max_)(const float *x, size_t n);
+  float (*min_)(const float *x, size_t n);
+  float (*sum_)(const float *x, size_t n);
+  float (*square_sum_)(const float *x, size_t n);
+  float (*abs_sum_)(const float *x, size_t n);
+  float (*add_square_sum_)(const float *x, const float *r, float *y,
+                           size_t n);
+  void (*scale_mul_)(const float *x, float scale, const float *w, float *y,
+                     size_t n);
+  float (*dot_)(const float *x, const float *y, size_t n);
+  void (*axpy_)(float a, const float *x, float *y, size_t n);
+  float (*exp_sum_)(const float *x, float m, float *y, size_t n);
+  void (*silu_mul_)(const float *g, const float *u, float *y, size_t n);
+  void (*rotary_)(const float *x0, const float *x1, const float *c,
+                  const float *s, float *y0, float *y1, size_t n);
+  void (*rotary_interleaved_)(const float *x, const float *c, const float *s,
+                              float *y, size_t n);
+  size_t (*select_greater_)(const float *x, size_t n, float t, int32_t *index);
+  void (*mean_var_)(const float *x, size_t n, float *mean, float *var);
+  void (*norm_affine_)(const float *x, float mean, float rstd,
+                       const float *gamma, const float *beta, float *y,
+                       size_t n);
+  void (*scale_shift_)(const float *x, float a, float b, float *y, size_t n);
+};
+
+#ifdef NNDEPLOY_VEC_MATH_X86
+static const VecMathKernel kVecMathAvx512 = {"avx512",
+                                             expAvx512Loop,
+                                             sigmoidAvx512Loop,
+                                             siluAvx512Loop,
+                                             tanhAvx512Loop,
+                                             erfAvx512Loop,
+                                             geluAvx512Loop,
+                                             maxAvx512Loop,
+                                             minAvx512Loop,
+                                             sumAvx512Loop,
+                                             squareSumAvx512Loop,
+                                             absSumAvx512Loop,
+                                             addSquareSumAvx512Loop,
+                                             scaleMulAvx512Loop,
+                                             dotAvx512Loop,
+                                             axpyAvx512Loop,
+                                             expSumAvx512Loop,
+                                             siluMulAvx512Loop,
+                                             rotaryAvx512Loop,
+                                             rotaryInterleavedAvx512Loop,
+                                             selectGreaterAvx512Loop,
+                                             meanVarAvx512Loop,
+                                             normAffineAvx512Loop,
+                                             scaleShiftAvx512Loop};
+
+static const VecMathKernel kVecMathAvx2 = {"avx2",
+                                           expAvx2Loop,
+                                           sigmoidAvx2Loop,
+                                           siluAvx2Loop,
+                                           tanhAvx2Loop,
+                                           erfAvx2Loop,
+                                           geluAvx2Loop,
+                                           maxAvx2Loop,
+                                           minAvx2Loop,
+                                           sumAvx2Loop,
+                                           squareSumAvx2Loop,
+                                           absSumAvx2Loop,
+                                           addSquareSumAvx2Loop,
+                                           scaleMulAvx2Loop,
+                                           dotAvx2Loop,
+                                           axpyAvx2Loop,
+                                           expSumAvx2Loop,
+                                           siluMulAvx2Loop,
+                                           rotaryAvx2Loop,
+                                           rotaryInterleavedAvx2Loop,
+                                           selectGreaterAvx2Loop,
+                                           meanVarAvx2Loop,
+                                           normAffineAvx2Loop,
+                                           scaleShiftAvx2Loop};
+#endif
+
+static const VecMathKernel kVecMathScalar = {"scalar",
+                                             expScalarLoop,
+                                             sigmoidScalarLoop,
+                                             siluScalarLoop,
+                                             tanhScalarLoop,
+                                             erfScalarLoop,
+                                             geluScalarLoop,
+                                             maxScalarLoop,
+                                             minScalarLoop,
+                                             sumScalarLoop,
+                                             squareSumScalarLoop,
+                                             absSumScalarLoop,
+                                             addSquareSumScalarLoop,
+                                             scaleMulScalarLoop,
+                                             dotScalarLoop,
+                                             axpyScalarLoop,
+                                             expSumScalarLoop,
+                                             siluMulScalarLoop,
+                                             rotaryScalarLoop,
+                                             rotaryInterleavedScalarLoop,
+                                             selectGreaterScalarLoop,
+                                             meanVarScalarLoop,
+                                             normAffineScalarLoop,
+                                             scaleShiftScalarLoop};
+
+// 每次调用时按当前生效的指令集级别选择，base::setCpuIsa对之后的调用立即生效
+static const VecMathKernel &getVecMathKernel() {
+#ifdef NNDEPLOY_VEC_MATH_X86
+  if (base::isCpuIsaSupported(base::kCpuIsaAvx512)) {
+    return kVecMathAvx512;
+  }
+  if (base::isCpuIsaSupported(base::kCpuIsaAvx2)) {
+    return kVecMathAvx2;
+  }
+#endif
+  return kVecMathScalar;
+}
+
+void vecExp(const float *x, float *y, size_t n) {
+  getVecMathKernel().exp_(x, y, n);
+}
+
+void vecSigmoid(const float *x, float *y, size_t n) {
+  getVecMathKernel().sigmoid_(x, y, n);
+}
+
+void vecSilu(const float *x, float *y, size_t n) {
+  getVecMathKernel().silu_(x, y, n);
+}
+
+void vecTanh(const float *x, float *y, size_t n) {
+  getVecMathKernel().tanh_(x, y, n);
+}
+
+void vecErf(const float *x, float *y, size_t n) {
+  getVecMathKernel().erf_(x, y, n);
+}
+
+void vecGelu(const float *x, float *y, size_t n) {
+  getVecMathKernel().gelu_(x, y, n);
+}
+
+float vecMax(const float *x, size_t n) { return getVecMathKernel().max_(x, n); }
+
+float vecMin(const float *x, size_t n) { return getVecMathKernel().min_(x, n); }
+
+float vecSum(const float *x, size_t n) {
+  return getVecMathKernel().sum_(x, n);
+}
+
+float vecSquareSum(const float *x, size_t n) {
+  return getVecMathKernel().square_sum_(x, n);
+}
+
+float vecAbsSum(const float *x, size_t n) {
+  return getVecMathKernel().abs_sum_(x, n);
+}
+
+float vecAddSquareSum(const float *x, const float *r, float *y, size_t n) {
+  return getVecMathKernel().add_square_sum_(x, r, y, n);
+}
+
+void vecScaleMul(const float *x, float scale, const float *w, float *y,
+                 size_t n) {
+  getVecMathKernel().scale_mul_(x, scale, w, y, n);
+}
+
+float vecDot(const float *x, const float *y, size_t n) {
+  return getVecMathKernel().dot_(x, y, n);
+}
+
+void vecAxpy(float a, const float *x, float *y, size_t n) {
+  getVecMathKernel().axpy_(a, x, y, n);
+}
+
+float vecExpSum(const float *x, float m, float *y, size_t n) {
+  return getVecMathKernel().exp_sum_(x, m, y, n);
+}
+
+void vecSiluMul(const float *g, const float *u, float *y, size_t n) {
+  getVecMathKernel().silu_mul_(g, u, y, n);
+}
+
+void vecRotary(const float *x0, const float *x1, const float *c,
+               const float *s, float *y0, float *y1, size_t n) {
+  getVecMathKernel().rotary_(x0, x1, c, s, y0, y1, n);
+}
+
+void vecRotaryInterleaved(const float *x, const float *c, const float *s,
+                          float *y, size_t n) {
+  getVecMathKernel().rotary_interleaved_(x, c, s, y, n);
+}
+
+size_t vecSelectGreater(const float *x, size_t n, float t, int32_t *index) {
+  return getVecMathKernel().select_greater_(x, n, t, index);
+}
+
+void vecMeanVar(const float *x, size_t n, float *mean, float *var) {
+  getVecMathKernel().mean_var_(x, n, mean, var);
+}
+
+void vecNormAffine(const float *x, float mean, float rstd, const float *gamma,
+                   const float *beta, float *y, size_t n) {
+  getVecMathKernel().norm_affine_(x, mean, rstd, gamma, beta, y, n);
+}
+
+void vecScaleShift(const float *x, float a, float b, float *y, size_t n) {
+  getVecMathKernel().scale_shift_(x, a, b, y, n);
+}
+
+const char *getVecMathIsa() { return getVecMathKernel().isa_; }
+
+}  // namespace op
+}  // namespace nndeploy
@@ -0,0 +1,114 @@
+#include "nndeploy/op/op_binary.h"
+
+#include "nndeploy/base/common.h"
+#include "nndeploy/base/cpu_isa.h"
+#include "nndeploy/base/glic_stl_include.h"
+#include "nndeploy/base/log.h"
+#include "nndeploy/base/macro.h"
+#include "nndeploy/ir/ir.h"
+#include "nndeploy/op/op.h"
+
+// 只有kernel带target属性，注册等静态初始化代码按基础指令集编译，
+// 在不支持AVX的机器上也能正常加载
+#if (defined(__x86_64__) || defined(__i386__)) && \
+    (defined(__GNUC__) || defined(__clang__))
+#define NNDEPLOY_BINARY_X86
+#include <immintrin.h>
+#define NNDEPLOY_BINARY_AVX2 __attribute__((target("avx2,fma")))
+#define NNDEPLOY_BINARY_AVX512 __attribute__((target("avx512f")))
+#endif
+
+namespace nndeploy {
+namespace op {
+
+#ifdef NNDEPLOY_BINARY_X86
+
+/**
+ * @brief 与binaryLoop相同的三种step组合，向量部分每次处理width个float
+ * # 尾部按标量计算，加减乘除与标量实现的结果逐位一致
+ */
+#define NNDEPLOY_BINARY_X86_LOOP(name, attr, prefix, vec, width, vec_op, op) \
+  attr static void name(const float *a, int a_step, const float *b,         \
+                        int b_step, float *c, size_t size) {                \
+    size_t i = 0;                                                           \
+    if (a_step == 1 && b_step == 1) {                                       \
+      for (; i + width <= size; i += width) {                               \
+        vec va = prefix##_loadu_ps(a + i);                                  \
+        vec vb = prefix##_loadu_ps(b + i);                                  \
+        prefix##_storeu_ps(c + i, prefix##_##vec_op##_ps(va, vb));          \
+      }                                                                     \
+      for (; i < size; ++i) {                                               \
+        c[i] = a[i] op b[i];                                                \
+      }                                                                     \
+    } else if (a_step == 1) {                                               \
+      const float value_b = b[0];                                           \
+      vec vb = prefix##_set1_ps(value_b);                                   \
+      for (; i + width <= size; i += width) {                               \
+        vec va = prefix##_loadu_ps(a + i);                                  \
+        prefix##_storeu_ps(c + i, prefix##_##vec_op##_ps(va, vb));          \
+      }                                                                     \
+      for (; i < size; ++i) {                                               \
+        c[i] = a[i] op value_b;                                             \
+      }                                                                     \
+    } else if (b_step == 1) {                                               \
+      const float value_a = a[0];                                           \
+      vec va = prefix##_set1_ps(value_a);                                   \
+      for (; i + width <= size; i += width) {                               \
+        vec vb = prefix##_loadu_ps(b + i);                                  \
+        prefix##_storeu_ps(c + i, prefix##_##vec_op##_ps(va, vb));          \
+      }                                                                     \
+      for (; i < size; ++i) {                                               \
+        c[i] = value_a op b[i];                                             \
+      }                                                                     \
+    } else {                                                                \
+      const float value = a[0] op b[0];                                     \
+      vec vc = prefix##_set1_ps(value);                                     \
+      for (; i + width <= size; i += width) {                               \
+        prefix##_storeu_ps(c + i, vc);                                      \
+      }                                                                     \
+      for (; i < size; ++i) {                                               \
+        c[i] = value;                                                       \
+      }                                                                     \
+    }                                                                       \
+  }
+
+NNDEPLOY_BINARY_X86_LOOP(addAvx2Loop, NNDEPLOY_BINARY_AVX2, _mm256, __m256, 8,
+                         add, +)
+NNDEPLOY_BINARY_X86_LOOP(subAvx2Loop, NNDEPLOY_BINARY_AVX2, _mm256, __m256, 8,
+                         sub, -)
+NNDEPLOY_BINARY_X86_LOOP(mulAvx2Loop, NNDEPLOY_BINARY_AVX2, _mm256, __m256, 8,
+                         mul, *)
+NNDEPLOY_BINARY_X86_LOOP(divAvx2Loop, NNDEPLOY_BINARY_AVX2, _mm256, __m256, 8,
+                         div, /)
+
+NNDEPLOY_BINARY_X86_LOOP(addAvx512Loop, NNDEPLOY_BINARY_AVX512, _mm512,
+                         __m512, 16, add, +)
+NNDEPLOY_BINARY_X86_LOOP(subAvx512Loop, NNDEPLOY_BINARY_AVX512, _mm512,
+                         __m512, 16, sub, -)
+NNDEPLOY_BINARY_X86_LOOP(mulAvx512Loop, NNDEPLOY_BINARY_AVX512, _mm512,
+                         __m512, 16, mul, *)
+NNDEPLOY_BINARY_X86_LOOP(divAvx512Loop, NNDEPLOY_BINARY_AVX512, _mm512,
+                         __m512, 16, div, /)
+
+REGISTER_OP_ISA_IMPLEMENTION(ir::kOpTypeAdd, base::dataTypeOf<float>(),
+                             base::kCpuIsaAvx2, addAvx2Loop)
+REGISTER_OP_ISA_IMPLEMENTION(ir::kOpTypeSub, base::dataTypeOf<float>(),
+                             base::kCpuIsaAvx2, subAvx2Loop)
+REGISTER_OP_ISA_IMPLEMENTION(ir::kOpTypeMul, base::dataTypeOf<float>(),
+                             base::kCpuIsaAvx2, mulAvx2Loop)
+REGISTER_OP_ISA_IMPLEMENTION(ir::kOpTypeDiv, base::dataTypeOf<float>(),
+                             base::kCpuIsaAvx2, divAvx2Loop)
+
+REGISTER_OP_ISA_IMPLEMENTION(ir::kOpTypeAdd, base::dataTypeOf<float>(),
+                             base::kCpuIsaAvx512, addAvx512Loop)
+REGISTER_OP_ISA_IMPLEMENTION(ir::kOpTypeSub, base::dataTypeOf<float>(),
+                             base::kCpuIsaAvx512, subAvx512Loop)
+REGISTER_OP_ISA_IMPLEMENTION(ir::kOpTypeMul, base::dataTypeOf<float>(),
+                             base::kCpuIsaAvx512, mulAvx512Loop)
+REGISTER_OP_ISA_IMPLEMENTION(ir::kOpTypeDiv, base::dataTypeOf<float>(),
+                             base::kCpuIsaAvx512, divAvx512Loop)
+
+#endif
+
+}  // namespace op
+}  // namespace nndeploy
@@ -41,5 +41,41 @@ void parallelFor(const base::Range &range, const ParallelLoopBody &body,
   return;
 }
 
+static thread_local int g_thread_budget = 0;
+
+void setThreadBudget(int num) { g_thread_budget = num; }
+
+int getThreadBudget() {
+  int num = getThreadNum();
+  if (g_thread_budget > 0 && g_thread_budget < num) {
+    num = g_thread_budget;
+  }
+  return std::max(num, 1);
+}
+
+ThreadBudgetGuard::ThreadBudgetGuard(int num) : last_num_(g_thread_budget) {
+  g_thread_budget = num;
+}
+
+ThreadBudgetGuard::~ThreadBudgetGuard() { g_thread_budget = last_num_; }
+
+void parallelForWithCost(const base::Range &range,
+                         const ParallelLoopBody &body, uint64_t cost) {
+  if (range.empty()) {
+    return;
+  }
+  uint64_t tasks = static_cast<uint64_t>(range.size());
+  uint64_t threads = static_cast<uint64_t>(getThreadBudget());
+  threads = std::min(threads, cost / kParallelGrainCost);
+  threads = std::min(threads, tasks);
+  if (cost < kParallelMinCost || threads <= 1) {
+    body(range);
+    return;
+  }
+  // nstripes为每次领取的任务数，切成threads段；为1时交给线程池自动划分
+  double step = static_cast<double>((tasks + threads - 1) / threads);
+  parallelFor(range, body, step > 1.0 ? step : -1.0);
+}
+
 }  // namespace thread_pool
 }  // namespace nndeploy
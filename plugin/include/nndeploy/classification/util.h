@@ -17,34 +17,49 @@
 #include "nndeploy/device/device.h"
 #include "nndeploy/device/memory_pool.h"
 #include "nndeploy/device/tensor.h"
+#include "nndeploy/ir/op_param.h"
+#include "nndeploy/op/op_topk.h"
 
 namespace nndeploy {
 namespace classification {
 
-// topk sometimes is a very small value
-// so this implementation is simple but I don't think it will
-// cost too much time
-// Also there may be cause problem since we suppose the minimum value is
-// -99999999
-// Do not use this function on array which topk contains value less than
-// -99999999
+/**
+ * @brief array中最大的topk个元素的下标，按值从大到小排列，值相同时下标小的在前
+ * # 转发到op::topK，array先转为float的cpu tensor
+ * @deprecated 直接使用op::topK，或在softmax之后取topk时使用op::softmaxTopK
+ */
 template <typename T>
+NNDEPLOY_DEPRECATED("use op::topK or op::softmaxTopK instead")
 std::vector<int32_t> topKIndices(const T* array, int array_size, int topk) {
   topk = std::min(array_size, topk);
-  std::vector<int32_t> res(topk);
-  std::set<int32_t> searched;
-  for (int32_t i = 0; i < topk; ++i) {
-    T min = static_cast<T>(-99999999);
-    for (int32_t j = 0; j < array_size; ++j) {
-      if (searched.find(j) != searched.end()) {
-        continue;
-      }
-      if (*(array + j) > min) {
-        res[i] = j;
-        min = *(array + j);
-      }
-    }
-    searched.insert(res[i]);
+  std::vector<int32_t> res;
+  if (topk <= 0) {
+    return res;
+  }
+  // TopK注册在cpu上
+  device::Device* device =
+      device::getDevice(base::DeviceType(base::kDeviceTypeCodeCpu));
+  device::TensorDesc desc(base::dataTypeOf<float>(), base::kDataFormatNC,
+                          {1, array_size});
+  device::Tensor input(device, desc, "topk_input");
+  float* data = static_cast<float*>(input.getData());
+  for (int i = 0; i < array_size; ++i) {
+    data[i] = static_cast<float>(array[i]);
+  }
+  std::shared_ptr<ir::TopKParam> param = std::make_shared<ir::TopKParam>();
+  param->axis_ = 1;
+  param->k_ = topk;
+  device::Tensor values("topk_values");
+  device::Tensor indices("topk_indices");
+  base::Status status = op::topK(&input, param, &values, &indices);
+  if (status != base::kStatusCodeOk) {
+    NNDEPLOY_LOGE("op::topK failed!\n");
+    return res;
+  }
+  const int64_t* index = static_cast<const int64_t*>(indices.getData());
+  res.resize(topk);
+  for (int i = 0; i < topk; ++i) {
+    res[i] = static_cast<int32_t>(index[i]);
   }
   return res;
 }
@@ -10,7 +10,6 @@
 #include "nndeploy/base/opencv_include.h"
 #include "nndeploy/base/status.h"
 #include "nndeploy/base/string.h"
-#include "nndeploy/classification/util.h"
 #include "nndeploy/dag/edge.h"
 #include "nndeploy/dag/node.h"
 #include "nndeploy/device/buffer.h"
@@ -18,7 +17,7 @@
 #include "nndeploy/device/memory_pool.h"
 #include "nndeploy/device/tensor.h"
 #include "nndeploy/infer/infer.h"
-#include "nndeploy/op/op_softmax.h"
+#include "nndeploy/op/op_topk.h"
 #include "nndeploy/preprocess/cvtcolor_resize.h"
 
 namespace nndeploy {
@@ -35,33 +34,34 @@ base::Status ClassificationPostProcess::run() {
   // tensor->print();
   // tensor->getDesc().print();
 
-  std::shared_ptr<ir::SoftmaxParam> op_param =
-      std::make_shared<ir::SoftmaxParam>();
+  int batch = tensor->getShapeIndex(0);
+  int num_classes = tensor->getShapeIndex(1);
+  param->topk_ = std::min(num_classes, param->topk_);
+  int topk = param->topk_;
+
+  // softmax与topk融合，只对选出的topk个类别归一化
+  std::shared_ptr<ir::TopKParam> op_param = std::make_shared<ir::TopKParam>();
   op_param->axis_ = 1;
-  device::Tensor softmax_tensor(tensor->getDevice(), tensor->getDesc());
-  base::Status status = op::softmax(tensor, op_param, &softmax_tensor);
+  op_param->k_ = topk;
+  device::Tensor values_tensor("values");
+  device::Tensor indices_tensor("indices");
+  base::Status status =
+      op::softmaxTopK(tensor, op_param, &values_tensor, &indices_tensor);
   if (status != base::kStatusCodeOk) {
-    NNDEPLOY_LOGE("op::softmax failed!\n");
+    NNDEPLOY_LOGE("op::softmaxTopK failed!\n");
     return status;
   }
-  float *data = (float *)softmax_tensor.getData();
-  int batch = softmax_tensor.getShapeIndex(0);
-  int num_classes = softmax_tensor.getShapeIndex(1);
+  float *scores = (float *)values_tensor.getData();
+  int64_t *label_ids = (int64_t *)indices_tensor.getData();
 
   ClassificationResult *results = new ClassificationResult();
-  param->topk_ = std::min(num_classes, param->topk_);
-  int topk = param->topk_;
   results->labels_.resize(topk * batch);
-
-  // 使用优先队列找出topk个最大值
   for (int b = 0; b < batch; ++b) {
-    float *iter_data = data + b * num_classes;
-    std::vector<int> label_ids_ = topKIndices(iter_data, num_classes, topk);
-    ;
     for (int i = 0; i < topk; ++i) {
       results->labels_[i + b * topk].index_ = b;
-      results->labels_[i + b * topk].label_ids_ = label_ids_[i];
-      results->labels_[i + b * topk].scores_ = *(iter_data + label_ids_[i]);
+      results->labels_[i + b * topk].label_ids_ =
+          static_cast<int>(label_ids[i + b * topk]);
+      results->labels_[i + b * topk].scores_ = scores[i + b * topk];
     }
   }
 
@@ -6,6 +6,10 @@ from .optimizer import (
     FuseConvBias,
     FuseConvBatchNorm,
     FuseConvRelu,
+    FuseQdqConv,
+    FuseElementwise,
     EliminateCommonSubexpression,
     EliminateDeadOp,
+    PropagateLayout,
+    ConvertPrecision,
 )
@@ -6,6 +6,9 @@ import nndeploy._nndeploy_internal as _C
 FuseConvBias = _C.net.OptPassType.kOptPassTypeFuseConvBias
 FuseConvBatchNorm = _C.net.OptPassType.kOptPassTypeFuseConvBatchNorm
 FuseConvRelu = _C.net.OptPassType.kOptPassTypeFuseConvRelu
+FuseQdqConv = _C.net.OptPassType.kOptPassTypeFuseQdqConv
+FuseLayerNorm = _C.net.OptPassType.kOptPassTypeFuseLayerNorm
+FuseElementwise = _C.net.OptPassType.kOptPassTypeFuseElementwise
 
 
 # 消除冗余算子
@@ -13,3 +16,9 @@ EliminateCommonSubexpression = (
     _C.net.OptPassType.kOptPassTypeEliminateCommonSubexpression
 )
 EliminateDeadOp = _C.net.OptPassType.kOptPassTypeEliminateDeadOp
+
+# 数据格式
+PropagateLayout = _C.net.OptPassType.kOptPassTypePropagateLayout
+
+# 精度
+ConvertPrecision = _C.net.OptPassType.kOptPassTypeConvertPrecision
@@ -2,6 +2,7 @@ from .expr import Module
 from .expr import (
     Conv,
     Relu,
+    Sigmoid,
     BatchNorm,
     SoftMax,
     Add,
@@ -9,4 +10,23 @@ from .expr import (
     Gemm,
     GlobalAveragePool,
     MaxPool,
+    AveragePool,
+    RMSNorm,
+    Attention,
+    RotaryEmbedding,
+    SwiGLU,
+    Split,
+    Concat,
+    QuantizeLinear,
+    DequantizeLinear,
+    ReduceL1,
+    ReduceL2,
+    ReduceLogSum,
+    ReduceLogSumExp,
+    ReduceMax,
+    ReduceMean,
+    ReduceMin,
+    ReduceProd,
+    ReduceSum,
+    ReduceSumSquare,
 )
@@ -73,6 +73,17 @@ class Relu(Module):
         return _C.op.makeRelu(self.model_desc, data)
 
 
+class Sigmoid(Module):
+    def __init__(self):
+        super().__init__()
+
+    def __call__(self, data):
+        return self.makeExpr(data)
+
+    def makeExpr(self, data):
+        return _C.op.makeSigmoid(self.model_desc, data)
+
+
 class BatchNorm(Module):
     def __init__(self, scale_name, bias_name, mean_name, var_name):
         super().__init__()
@@ -182,6 +193,24 @@ class MaxPool(Module):
         return _C.op.makeMaxPool(self.model_desc, data, self.param)
 
 
+class AveragePool(Module):
+    def __init__(self, kernel_size, stride=1, padding=0, dilation=1, ceil_mode=False, count_include_pad=False):
+        super().__init__()
+        self.param = _C.ir.AveragePoolParam()
+        self.param.kernel_shape_ = [kernel_size] * 2
+        self.param.strides_ = [stride] * 2
+        self.param.pads_ = [padding] * 4
+        self.param.dilations_ = [dilation] * 2
+        self.param.ceil_mode_ = ceil_mode
+        self.param.count_include_pad_ = count_include_pad
+
+    def __call__(self, data):
+        return self.makeExpr(data)
+
+    def makeExpr(self, data):
+        return _C.op.makeAveragePool(self.model_desc, data, self.param)
+
+
 class GlobalAveragePool(Module):
     def __init__(self):
         super().__init__()
@@ -191,3 +220,207 @@ class GlobalAveragePool(Module):
 
     def makeExpr(self, data):
         return _C.op.makeGlobalAveragePool(self.model_desc, data)
+
+
+class RMSNorm(Module):
+    def __init__(self, weight_name, eps=1e-6):
+        super().__init__()
+        self.param = _C.ir.RMSNormParam()
+        self.param.eps_ = eps
+
+        self.weight_name = weight_name
+
+    def __call__(self, data, residual=None):
+        return self.makeExpr(data, residual)
+
+    def makeExpr(self, data, residual=None):
+        return _C.op.makeRMSNorm(
+            self.model_desc, data, self.param, self.weight_name, residual
+        )
+
+
+class Attention(Module):
+    def __init__(self, is_causal=False, q_num_heads=0, kv_num_heads=0, scale=0.0, causal_bottom_right=False):
+        super().__init__()
+        self.param = _C.ir.AttentionParam()
+        self.param.is_causal_ = is_causal
+        self.param.causal_bottom_right_ = causal_bottom_right
+        self.param.q_num_heads_ = q_num_heads
+        self.param.kv_num_heads_ = kv_num_heads
+        self.param.scale_ = scale
+
+    def __call__(self, q, k, v, attn_mask=None):
+        return self.makeExpr(q, k, v, attn_mask)
+
+    def makeExpr(self, q, k, v, attn_mask=None):
+        return _C.op.makeAttention(
+            self.model_desc, q, k, v, self.param, attn_mask
+        )
+
+
+class RotaryEmbedding(Module):
+    def __init__(self, cos_cache_name, sin_cache_name, interleaved=False, rotary_embedding_dim=0, num_heads=0):
+        super().__init__()
+        self.param = _C.ir.RotaryEmbeddingParam()
+        self.param.interleaved_ = interleaved
+        self.param.rotary_embedding_dim_ = rotary_embedding_dim
+        self.param.num_heads_ = num_heads
+
+        self.cos_cache_name = cos_cache_name
+        self.sin_cache_name = sin_cache_name
+
+    def __call__(self, data, position_ids=None):
+        return self.makeExpr(data, position_ids)
+
+    def makeExpr(self, data, position_ids=None):
+        return _C.op.makeRotaryEmbedding(
+            self.model_desc,
+            data,
+            self.param,
+            self.cos_cache_name,
+            self.sin_cache_name,
+            position_ids,
+        )
+
+
+class SwiGLU(Module):
+    def __init__(self, axis=-1):
+        super().__init__()
+        self.param = _C.ir.SwiGLUParam()
+        self.param.axis_ = axis
+
+    def __call__(self, gate, up=None):
+        return self.makeExpr(gate, up)
+
+    def makeExpr(self, gate, up=None):
+        return _C.op.makeSwiGLU(self.model_desc, gate, up, self.param)
+
+
+class Split(Module):
+    def __init__(self, num_outputs, axis=0, split_name=""):
+        super().__init__()
+        self.param = _C.ir.SplitParam()
+        self.param.axis_ = axis
+        self.param.num_outputs_ = num_outputs
+
+        self.split_name = split_name
+
+    def __call__(self, data):
+        return self.makeExpr(data)
+
+    def makeExpr(self, data):
+        return _C.op.makeSplit(self.model_desc, data, self.param, self.split_name)
+
+
+class Concat(Module):
+    def __init__(self, axis=0):
+        super().__init__()
+        self.param = _C.ir.ConcatParam()
+        self.param.axis_ = axis
+
+    def __call__(self, inputs):
+        return self.makeExpr(inputs)
+
+    def makeExpr(self, inputs):
+        return _C.op.makeConcat(self.model_desc, inputs, self.param)
+
+
+class QuantizeLinear(Module):
+    def __init__(self, scale_name, zero_point_name="", axis=1, saturate=1):
+        super().__init__()
+        self.param = _C.ir.QuantizeLinearParam()
+        self.param.axis_ = axis
+        self.param.saturate_ = saturate
+
+        self.scale_name = scale_name
+        self.zero_point_name = zero_point_name
+
+    def __call__(self, data):
+        return self.makeExpr(data)
+
+    def makeExpr(self, data):
+        return _C.op.makeQuantizeLinear(self.model_desc, data, self.param, self.scale_name, self.zero_point_name)
+
+
+class DequantizeLinear(Module):
+    def __init__(self, scale_name, zero_point_name="", axis=1):
+        super().__init__()
+        self.param = _C.ir.DequantizeLinearParam()
+        self.param.axis_ = axis
+
+        self.scale_name = scale_name
+        self.zero_point_name = zero_point_name
+
+    def __call__(self, data):
+        return self.makeExpr(data)
+
+    def makeExpr(self, data):
+        # data为权重名时反量化常量权重
+        if isinstance(data, str):
+            data = _C.op.Expr(data)
+        return _C.op.makeDequantizeLinear(self.model_desc, data, self.param, self.scale_name, self.zero_point_name)
+
+
+class Reduce(Module):
+    """
+    Reduce系列的基类，子类给出make_func；axes_name为int64权重名，
+    不为空时由该输入给出归约的轴
+    """
+
+    make_func = None
+
+    def __init__(self, axes=None, keepdims=1, noop_with_empty_axes=0, axes_name=""):
+        super().__init__()
+        self.param = _C.ir.ReduceParam()
+        if axes is not None:
+            self.param.axes_ = [axes] if isinstance(axes, int) else list(axes)
+        self.param.keepdims_ = keepdims
+        self.param.noop_with_empty_axes_ = noop_with_empty_axes
+
+        self.axes_name = axes_name
+
+    def __call__(self, data):
+        return self.makeExpr(data)
+
+    def makeExpr(self, data):
+        return type(self).make_func(self.model_desc, data, self.param, self.axes_name)
+
+
+class ReduceL1(Reduce):
+    make_func = _C.op.makeReduceL1
+
+
+class ReduceL2(Reduce):
+    make_func = _C.op.makeReduceL2
+
+
+class ReduceLogSum(Reduce):
+    make_func = _C.op.makeReduceLogSum
+
+
+class ReduceLogSumExp(Reduce):
+    make_func = _C.op.makeReduceLogSumExp
+
+
+class ReduceMax(Reduce):
+    make_func = _C.op.makeReduceMax
+
+
+class ReduceMean(Reduce):
+    make_func = _C.op.makeReduceMean
+
+
+class ReduceMin(Reduce):
+    make_func = _C.op.makeReduceMin
+
+
+class ReduceProd(Reduce):
+    make_func = _C.op.makeReduceProd
+
+
+class ReduceSum(Reduce):
+    make_func = _C.op.makeReduceSum
+
+
+class ReduceSumSquare(Reduce):
+    make_func = _C.op.makeReduceSumSquare
@@ -29,6 +29,36 @@ def relu(input):
     return _C.op.relu(input)
 
 
+def sigmoid(input):
+    return _C.op.sigmoid(input)
+
+
+def exp(input):
+    return _C.op.exp(input)
+
+
+def tanh(input):
+    return _C.op.tanh(input)
+
+
+def erf(input):
+    return _C.op.erf(input)
+
+
+def gelu(input):
+    return _C.op.gelu(input)
+
+
+def silu(input):
+    return _C.op.silu(input)
+
+
+def softmax(input, axis=-1):
+    param = _C.ir.SoftmaxParam()
+    param.axis_ = axis
+    return _C.op.softmax(input, param)
+
+
 def add(input1, input2):
     return _C.op.add(input1, input2)
 
@@ -39,6 +69,12 @@ def flatten(input, axis=1):
     return _C.op.flatten(input, param)
 
 
+def transpose(input, perm=None):
+    param = _C.ir.TransposeParam()
+    param.perm_ = [] if perm is None else list(perm)
+    return _C.op.transpose(input, param)
+
+
 def gemm(input_a, input_b, input_c=None, alpha=1.0, beta=1.0, trans_a=0, trans_b=0):
     param = _C.ir.GemmParam()
     param.alpha_ = alpha
@@ -48,6 +84,131 @@ def gemm(input_a, input_b, input_c=None, alpha=1.0, beta=1.0, trans_a=0, trans_b
     return _C.op.gemm(input_a, input_b, input_c, param)
 
 
+def quant_gemm(input_a, input_b, b_scale, b_zero_point=None, input_c=None, alpha=1.0, beta=1.0):
+    """
+    input_b为[N, K]的int8/uint8量化权重，b_scale为[N, K / group_size]
+    """
+    param = _C.ir.GemmParam()
+    param.alpha_ = alpha
+    param.beta_ = beta
+    param.trans_b_ = 1
+    return _C.op.quant_gemm(input_a, input_b, b_scale, b_zero_point, input_c, param)
+
+
+def quant_matmul(input_a, input_b, b_scale, b_zero_point=None):
+    return _C.op.quant_matmul(input_a, input_b, b_scale, b_zero_point)
+
+
+def quantize_linear(input, scale, zero_point=None, axis=1, saturate=1):
+    """
+    输出类型与zero_point相同，未给出zero_point时为uint8
+    """
+    param = _C.ir.QuantizeLinearParam()
+    param.axis_ = axis
+    param.saturate_ = saturate
+    return _C.op.quantize_linear(input, scale, zero_point, param)
+
+
+def dequantize_linear(input, scale, zero_point=None, axis=1):
+    param = _C.ir.DequantizeLinearParam()
+    param.axis_ = axis
+    return _C.op.dequantize_linear(input, scale, zero_point, param)
+
+
+def qlinear_conv(x, x_scale, x_zero_point, w, w_scale, w_zero_point, y_scale, y_zero_point, b=None, stride=1, padding=0, dilation=1, groups=1):
+    """
+    w为OIHW格式的int8/uint8权重，w_scale与w_zero_point为标量或[O]，b为int32
+    """
+    assert len(w.shape) == 4
+    param = _C.ir.ConvParam()
+    param.dilations_ = [dilation, dilation]
+    param.group_ = groups
+    param.kernel_shape_ = [w.shape[2], w.shape[3]]
+    param.strides_ = [stride, stride]
+    param.pads_ = [padding, padding, padding, padding]
+    return _C.op.qlinear_conv(x, x_scale, x_zero_point, w, w_scale, w_zero_point, y_scale, y_zero_point, b, param)
+
+
+def qlinear_matmul(a, a_scale, a_zero_point, b, b_scale, b_zero_point, y_scale, y_zero_point):
+    """
+    b为[K, N]，b_scale与b_zero_point为标量或[N]
+    """
+    return _C.op.qlinear_matmul(a, a_scale, a_zero_point, b, b_scale, b_zero_point, y_scale, y_zero_point)
+
+
+def _reduce_param(axes, keepdims, noop_with_empty_axes):
+    param = _C.ir.ReduceParam()
+    if axes is not None:
+        param.axes_ = [axes] if isinstance(axes, int) else list(axes)
+    param.keepdims_ = keepdims
+    param.noop_with_empty_axes_ = noop_with_empty_axes
+    return param
+
+
+def reduce_l1(input, axes=None, keepdims=1, noop_with_empty_axes=0):
+    return _C.op.reduce_l1(input, _reduce_param(axes, keepdims, noop_with_empty_axes))
+
+
+def reduce_l2(input, axes=None, keepdims=1, noop_with_empty_axes=0):
+    return _C.op.reduce_l2(input, _reduce_param(axes, keepdims, noop_with_empty_axes))
+
+
+def reduce_log_sum(input, axes=None, keepdims=1, noop_with_empty_axes=0):
+    return _C.op.reduce_log_sum(input, _reduce_param(axes, keepdims, noop_with_empty_axes))
+
+
+def reduce_log_sum_exp(input, axes=None, keepdims=1, noop_with_empty_axes=0):
+    return _C.op.reduce_log_sum_exp(input, _reduce_param(axes, keepdims, noop_with_empty_axes))
+
+
+def reduce_max(input, axes=None, keepdims=1, noop_with_empty_axes=0):
+    return _C.op.reduce_max(input, _reduce_param(axes, keepdims, noop_with_empty_axes))
+
+
+def reduce_mean(input, axes=None, keepdims=1, noop_with_empty_axes=0):
+    return _C.op.reduce_mean(input, _reduce_param(axes, keepdims, noop_with_empty_axes))
+
+
+def reduce_min(input, axes=None, keepdims=1, noop_with_empty_axes=0):
+    return _C.op.reduce_min(input, _reduce_param(axes, keepdims, noop_with_empty_axes))
+
+
+def reduce_prod(input, axes=None, keepdims=1, noop_with_empty_axes=0):
+    return _C.op.reduce_prod(input, _reduce_param(axes, keepdims, noop_with_empty_axes))
+
+
+def reduce_sum(input, axes=None, keepdims=1, noop_with_empty_axes=0):
+    return _C.op.reduce_sum(input, _reduce_param(axes, keepdims, noop_with_empty_axes))
+
+
+def reduce_sum_square(input, axes=None, keepdims=1, noop_with_empty_axes=0):
+    return _C.op.reduce_sum_square(input, _reduce_param(axes, keepdims, noop_with_empty_axes))
+
+
+def topk(input, k, axis=-1, largest=1, sorted=1):
+    """
+    返回(values, indices)，indices为int64，值相同时下标小的在前
+    """
+    param = _C.ir.TopKParam()
+    param.k_ = k
+    param.axis_ = axis
+    param.largest_ = largest
+    param.sorted_ = sorted
+    values, indices = _C.op.topk(input, param)
+    return values, indices
+
+
+def softmax_topk(input, k, axis=-1):
+    """
+    融合的softmax + topk，结果与softmax之后再topk相同
+    """
+    param = _C.ir.TopKParam()
+    param.k_ = k
+    param.axis_ = axis
+    values, indices = _C.op.softmax_topk(input, param)
+    return values, indices
+
+
 def global_averagepool(input):
     return _C.op.global_averagepool(input)
 
@@ -60,3 +221,95 @@ def maxpool(input, kernel_size, stride=1, padding=0, dilation=1, ceil_mode=False
     param.dilations_ = [dilation] * 2
     param.ceil_mode_ = ceil_mode
     return _C.op.maxpool(input, param)
+
+
+def averagepool(input, kernel_size, stride=1, padding=0, dilation=1, ceil_mode=False, count_include_pad=False):
+    param = _C.ir.AveragePoolParam()
+    param.kernel_shape_ = [kernel_size] * 2
+    param.strides_ = [stride] * 2
+    param.pads_ = [padding] * 4
+    param.dilations_ = [dilation] * 2
+    param.ceil_mode_ = ceil_mode
+    param.count_include_pad_ = count_include_pad
+    return _C.op.averagepool(input, param)
+
+
+def resize(input, scales, roi=None, mode="nearest", coordinate_transformation_mode="half_pixel", nearest_mode="round_prefer_floor", cubic_coeff_a=-0.75, exclude_outside=0, extrapolation_value=0.0, antialias=0):
+    param = _C.ir.ResizeParam()
+    param.mode_ = mode
+    param.coordinate_transformation_mode_ = coordinate_transformation_mode
+    param.nearest_mode_ = nearest_mode
+    param.cubic_coeff_a_ = cubic_coeff_a
+    param.exclude_outside_ = exclude_outside
+    param.extrapolation_value_ = extrapolation_value
+    param.antialias_ = antialias
+    return _C.op.resize(input, roi, scales, None, param)
+
+
+def rms_norm(input, weight, residual=None):
+    return _C.op.rms_norm(input, weight, residual)
+
+
+def attention(q, k, v, attn_mask=None, is_causal=False, q_num_heads=0, kv_num_heads=0, scale=0.0, causal_bottom_right=False):
+    param = _C.ir.AttentionParam()
+    param.is_causal_ = is_causal
+    param.causal_bottom_right_ = causal_bottom_right
+    param.q_num_heads_ = q_num_heads
+    param.kv_num_heads_ = kv_num_heads
+    param.scale_ = scale
+    return _C.op.attention(q, k, v, attn_mask, param)
+
+
+def paged_attention(q, kv_cache, seq_ids, layer=0, is_causal=False, q_num_heads=0, scale=0.0):
+    param = _C.ir.PagedAttentionParam()
+    param.is_causal_ = is_causal
+    param.q_num_heads_ = q_num_heads
+    param.scale_ = scale
+    param.layer_ = layer
+    return _C.op.paged_attention(q, kv_cache, seq_ids, param)
+
+
+def rotary_embedding(input, cos_cache, sin_cache, position_ids=None, interleaved=False, rotary_embedding_dim=0, num_heads=0):
+    param = _C.ir.RotaryEmbeddingParam()
+    param.interleaved_ = interleaved
+    param.rotary_embedding_dim_ = rotary_embedding_dim
+    param.num_heads_ = num_heads
+    return _C.op.rotary_embedding(input, cos_cache, sin_cache, position_ids, param)
+
+
+def swiglu(gate, up=None):
+    return _C.op.swiglu(gate, up)
+
+
+def layer_norm(input, weight, bias=None, axis=-1, epsilon=1e-5):
+    param = _C.ir.LayerNormalizationParam()
+    param.axis_ = axis
+    param.epsilon_ = epsilon
+    return _C.op.layer_norm(input, weight, bias, param)
+
+
+def group_norm(input, num_groups, weight, bias=None, epsilon=1e-5):
+    param = _C.ir.GroupNormalizationParam()
+    param.num_groups_ = num_groups
+    param.epsilon_ = epsilon
+    return _C.op.group_norm(input, weight, bias, param)
+
+
+def instance_norm(input, weight, bias=None, epsilon=1e-5):
+    param = _C.ir.InstanceNormalizationParam()
+    param.epsilon_ = epsilon
+    return _C.op.instance_norm(input, weight, bias, param)
+
+
+def concat(inputs, axis=0):
+    param = _C.ir.ConcatParam()
+    param.axis_ = axis
+    return _C.op.concat(inputs, param)
+
+
+def reorder(input, data_format):
+    return _C.op.reorder(input, data_format)
+
+
+def cast(input, data_type):
+    return _C.op.cast(input, data_type)
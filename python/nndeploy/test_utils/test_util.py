@@ -7,7 +7,13 @@ from nndeploy.base.common import device_name_to_code
 
 str_to_np_data_types = {
     'float32': np.float32,
-    'float16': np.float16
+    'float16': np.float16,
+    'float64': np.float64,
+    'int8': np.int8,
+    'uint8': np.uint8,
+    'int16': np.int16,
+    'int32': np.int32,
+    'int64': np.int64
 }
 
 
@@ -0,0 +1,104 @@
+import unittest
+import numpy as np
+import nndeploy
+
+from nndeploy.test_utils import createTensorFromNumpy, createNumpyFromTensor
+from nndeploy.net import build_model
+
+
+_C = nndeploy._C
+
+input_shape = [16, 64]
+weight_shape = [64, 64]
+
+np_input = np.random.uniform(-1, 1, input_shape).astype(np.float32)
+np_weight = np.random.uniform(-0.2, 0.2, weight_shape).astype(np.float32)
+np_bias = np.random.uniform(-0.2, 0.2, [weight_shape[1]]).astype(np.float32)
+
+nndeploy_weight_map = {
+    "gemm_weight": createTensorFromNumpy(np_weight),
+    "gemm_bias": createTensorFromNumpy(np_bias),
+}
+
+
+def np_fp16(x):
+    return x.astype(np.float16).astype(np.float32)
+
+
+def np_bfp16(x):
+    u = x.astype(np.float32).view(np.uint32).astype(np.uint64)
+    u = ((u + 0x7fff + ((u >> 16) & 1)) >> 16) << 16
+    return u.astype(np.uint32).view(np.float32)
+
+
+def reference(rounding):
+    """
+    按半精度存储模拟：权重与每个op的输出舍入为半精度，计算以float进行
+    """
+    x = rounding(np_input)
+    y = rounding(x @ rounding(np_weight) + rounding(np_bias))
+    y = rounding(np.maximum(y, 0))
+    return rounding(y + x)
+
+
+class TestNet(nndeploy.net.Model):
+    """
+    Gemm -> Relu -> Add(input)，默认允许列表中的op都以半精度存储
+    """
+
+    def __init__(self):
+        super().__init__()
+
+        self.weight_map = nndeploy_weight_map
+
+        self.gemm = nndeploy.op.Gemm("gemm_weight", "gemm_bias")
+        self.relu = nndeploy.op.Relu()
+        self.add = nndeploy.op.Add()
+
+    @build_model
+    def construct(self, enable_net_opt=True, enable_pass=set(), disable_pass=set()):
+        data_type = _C.base.DataType()
+        data_type.code_ = _C.base.DataTypeCode.kDataTypeCodeFp
+        input = _C.op.makeInput(self.model_desc, "input", data_type,
+                                input_shape)
+        data = self.relu(self.gemm(input))
+        return self.add(data, input)
+
+
+def run(precision_type):
+    model = TestNet()
+    # 精度在init之前设置，ConvertPrecision在init时按精度插入Cast
+    model.net.setPrecisionType(precision_type)
+    model.construct()
+    model.net.setInputs({"input": createTensorFromNumpy(np_input)})
+    return createNumpyFromTensor(model.run()[0])
+
+
+class TestConvertPrecision(unittest.TestCase):
+
+    def test_convert_precision(self):
+        PrecisionType = _C.base.PrecisionType
+        expect = run(PrecisionType.kPrecisionTypeFp32)
+        self.assertTrue(
+            np.allclose(expect, reference(lambda x: x), rtol=1e-04,
+                        atol=1e-05))
+        for precision_type, rounding, tolerance in [
+                (PrecisionType.kPrecisionTypeFp16, np_fp16, 2e-03),
+                (PrecisionType.kPrecisionTypeBFp16, np_bfp16, 2e-02)]:
+            message = str(precision_type)
+            result = run(precision_type)
+            # 模型的输出仍为float
+            self.assertEqual(result.dtype, np.float32, message)
+            self.assertEqual(list(expect.shape), list(result.shape), message)
+            # 与模拟半精度存储的结果一致，与float的结果只在精度范围内接近
+            self.assertTrue(
+                np.allclose(reference(rounding), result, rtol=tolerance,
+                            atol=tolerance), message)
+            self.assertTrue(
+                np.allclose(expect, result, rtol=4 * tolerance,
+                            atol=4 * tolerance), message)
+            self.assertFalse(np.array_equal(expect, result), message)
+
+
+if __name__ == "__main__":
+    unittest.main()
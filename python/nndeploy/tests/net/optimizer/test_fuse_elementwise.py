@@ -0,0 +1,161 @@
+import unittest
+import numpy as np
+import nndeploy
+
+from nndeploy.test_utils import createTensorFromNumpy, createNumpyFromTensor
+from nndeploy.net import build_model
+from nndeploy.net import FuseElementwise, PropagateLayout, ConvertPrecision
+
+
+_C = nndeploy._C
+
+# 计算量足够大，融合后的op会走多线程
+input_shape = [2, 16, 32, 40]
+
+# bias按不同的形状广播，覆盖相邻维度的合并
+bias_shapes = [
+    [2, 16, 32, 40],  # 所有维度合并为一维
+    [1, 16, 1, 40],  # 中间维度广播
+    [40],  # 只有最内层维度
+    [2, 16, 32, 1],  # 最内层维度广播
+    [1, 16, 32, 40],  # 最外层维度广播，其余维度合并
+    [1],  # 标量
+]
+
+np_input = np.random.uniform(-2, 2, input_shape).astype(np.float32)
+
+
+def np_sigmoid(x):
+    return 1 / (1 + np.exp(-x))
+
+
+def float_type():
+    data_type = _C.base.DataType()
+    data_type.code_ = _C.base.DataTypeCode.kDataTypeCodeFp
+    return data_type
+
+
+class BroadcastNet(nndeploy.net.Model):
+    """
+    Add(input, bias) -> Sigmoid -> Add(input) -> Relu，融合为一个op
+    """
+
+    def __init__(self, bias_shape):
+        super().__init__()
+
+        self.bias_shape = bias_shape
+
+        self.add1 = nndeploy.op.Add()
+        self.sigmoid = nndeploy.op.Sigmoid()
+        self.add2 = nndeploy.op.Add()
+        self.relu = nndeploy.op.Relu()
+
+    @build_model
+    def construct(self, enable_net_opt=True, enable_pass=set(), disable_pass=set()):
+        input = _C.op.makeInput(self.model_desc, "input", float_type(),
+                                input_shape)
+        bias = _C.op.makeInput(self.model_desc, "bias", float_type(),
+                               self.bias_shape)
+        data = self.sigmoid(self.add1(input, bias))
+        return self.relu(self.add2(data, input))
+
+
+def run_broadcast(np_bias, enable_fuse, thread_num):
+    model = BroadcastNet(list(np_bias.shape))
+    model.net.setThreadNum(thread_num)
+    if enable_fuse:
+        model.construct(enable_pass=[FuseElementwise])
+    else:
+        model.construct(enable_net_opt=False)
+    model.net.setInputs({"input": createTensorFromNumpy(np_input),
+                         "bias": createTensorFromNumpy(np_bias)})
+    return createNumpyFromTensor(model.run()[0])
+
+
+mid_channel = 13
+conv_input_shape = [1, 3, 20, 20]
+
+np_conv_input = np.random.uniform(-1, 1, conv_input_shape).astype(np.float32)
+
+nndeploy_weight_map = {
+    "conv_weight": createTensorFromNumpy(
+        np.random.uniform(-0.3, 0.3, [mid_channel, 3, 3, 3]).astype(
+            np.float32)),
+    "conv_bias": createTensorFromNumpy(
+        np.random.uniform(-0.3, 0.3, [mid_channel]).astype(np.float32)),
+}
+
+
+class ConvNet(nndeploy.net.Model):
+    """
+    Conv -> Sigmoid -> Add(Conv) -> Relu，
+    融合后的op进入通道分块格式或半精度的区域
+    """
+
+    def __init__(self):
+        super().__init__()
+
+        self.weight_map = nndeploy_weight_map
+
+        self.conv = nndeploy.op.Conv(3, mid_channel, [3, 3], padding=1,
+                                     weight_name="conv_weight",
+                                     bias_name="conv_bias")
+        self.sigmoid = nndeploy.op.Sigmoid()
+        self.add = nndeploy.op.Add()
+        self.relu = nndeploy.op.Relu()
+
+    @build_model
+    def construct(self, enable_net_opt=True, enable_pass=set(), disable_pass=set()):
+        data = _C.op.makeInput(self.model_desc, "input", float_type(),
+                               conv_input_shape)
+        data = self.conv(data)
+        return self.relu(self.add(self.sigmoid(data), data))
+
+
+def run_conv(enable_pass, precision_type=None):
+    model = ConvNet()
+    if precision_type is not None:
+        model.net.setPrecisionType(precision_type)
+    if enable_pass:
+        model.construct(enable_pass=enable_pass)
+    else:
+        model.construct(enable_net_opt=False)
+    model.net.setInputs({"input": createTensorFromNumpy(np_conv_input)})
+    return createNumpyFromTensor(model.run()[0])
+
+
+class TestFuseElementwise(unittest.TestCase):
+
+    def test_broadcast(self):
+        for bias_shape in bias_shapes:
+            message = str(bias_shape)
+            np_bias = np.random.uniform(-1, 1, bias_shape).astype(np.float32)
+            expect = run_broadcast(np_bias, False, 1)
+            reference = np.maximum(np_sigmoid(np_input + np_bias) + np_input,
+                                   0)
+            self.assertTrue(
+                np.allclose(reference, expect, rtol=1e-05, atol=1e-06),
+                message)
+            # 融合前后的指令相同，结果逐位一致，与线程数无关
+            for thread_num in [1, 4]:
+                result = run_broadcast(np_bias, True, thread_num)
+                self.assertEqual(list(expect.shape), list(result.shape),
+                                 message)
+                self.assertTrue(np.array_equal(expect, result), message)
+
+    def test_propagate_layout(self):
+        expect = run_conv([])
+        result = run_conv([FuseElementwise, PropagateLayout])
+        self.assertEqual(list(expect.shape), list(result.shape))
+        self.assertTrue(np.allclose(expect, result, rtol=1e-04, atol=1e-05))
+
+    def test_convert_precision(self):
+        expect = run_conv([])
+        result = run_conv([FuseElementwise, ConvertPrecision],
+                          _C.base.PrecisionType.kPrecisionTypeFp16)
+        self.assertEqual(result.dtype, np.float32)
+        self.assertTrue(np.allclose(expect, result, rtol=4e-03, atol=4e-03))
+
+
+if __name__ == "__main__":
+    unittest.main()
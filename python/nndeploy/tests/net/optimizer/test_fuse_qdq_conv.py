@@ -0,0 +1,137 @@
+import unittest
+import numpy as np
+import nndeploy
+from nndeploy.op import functional as F
+
+from nndeploy.test_utils import createTensorFromNumpy, createNumpyFromTensor
+from nndeploy.net import build_model
+from nndeploy.net import FuseQdqConv
+
+
+input_shape = [1, 8, 9, 9]
+conv_weight_shape = [16, 8, 3, 3]
+conv_bias_shape = [16]
+
+# 输入按per-tensor量化，权重按输出通道量化
+np_input = np.random.uniform(-2, 2, input_shape).astype(np.float32)
+np_x_scale = np.array([0.02], dtype=np.float32)
+np_x_zero_point = np.array([3], dtype=np.int8)
+np_conv_weight = np.random.randint(-128, 128, conv_weight_shape).astype(np.int8)
+np_w_scale = np.random.uniform(0.005, 0.02, conv_bias_shape).astype(np.float32)
+np_w_zero_point = np.zeros(conv_bias_shape, dtype=np.int8)
+np_conv_bias = np.random.uniform(-0.5, 0.5, conv_bias_shape).astype(np.float32)
+np_y_scale = np.array([0.05], dtype=np.float32)
+np_y_zero_point = np.array([-2], dtype=np.int8)
+
+nndeploy_weight_map = {
+    "x_scale": createTensorFromNumpy(np_x_scale),
+    "x_zero_point": createTensorFromNumpy(np_x_zero_point),
+    "conv_weight": createTensorFromNumpy(np_conv_weight),
+    "w_scale": createTensorFromNumpy(np_w_scale),
+    "w_zero_point": createTensorFromNumpy(np_w_zero_point),
+    "conv_bias": createTensorFromNumpy(np_conv_bias),
+    "y_scale": createTensorFromNumpy(np_y_scale),
+    "y_zero_point": createTensorFromNumpy(np_y_zero_point),
+}
+
+nndeploy_input_map = {"input": createTensorFromNumpy(np_input)}
+
+
+# 计算float参考结果: Q -> DQ -> Conv -> Q
+def np_quantize(x, scale, zero_point):
+    q = np.rint(x / scale) + zero_point.astype(np.float32)
+    return np.clip(q, -128, 127).astype(np.int8)
+
+
+np_x = (
+    np_quantize(np_input, np_x_scale, np_x_zero_point).astype(np.float32)
+    - np_x_zero_point
+) * np_x_scale
+np_w = np_conv_weight.astype(np.float32) * np_w_scale.reshape(-1, 1, 1, 1)
+np_y = createNumpyFromTensor(
+    F.conv(
+        createTensorFromNumpy(np_x.astype(np.float32)),
+        createTensorFromNumpy(np_w.astype(np.float32)),
+        createTensorFromNumpy(np_conv_bias),
+        padding=1,
+    )
+)
+reference_result = np_quantize(np_y, np_y_scale, np_y_zero_point)
+
+
+class TestNet(nndeploy.net.Model):
+    def __init__(self):
+        super().__init__()
+
+        self.weight_map = nndeploy_weight_map
+
+        self.quantize1 = nndeploy.op.QuantizeLinear("x_scale", "x_zero_point")
+        self.dequantize2 = nndeploy.op.DequantizeLinear("x_scale",
+                                                        "x_zero_point")
+        self.dequantize3 = nndeploy.op.DequantizeLinear(
+            "w_scale", "w_zero_point", axis=0
+        )
+        self.quantize5 = nndeploy.op.QuantizeLinear("y_scale", "y_zero_point")
+
+        self.conv_param = nndeploy._C.ir.ConvParam()
+        self.conv_param.kernel_shape_ = [3, 3]
+        self.conv_param.pads_ = [1, 1, 1, 1]
+        self.conv_param.strides_ = [1, 1]
+        self.conv_param.dilations_ = [1, 1]
+
+    @build_model
+    def construct(self, enable_net_opt=True, enable_pass=set(), disable_pass=set()):
+        data_type = nndeploy._C.base.DataType()
+        data_type.code_ = nndeploy._C.base.DataTypeCode.kDataTypeCodeFp
+        data = nndeploy._C.op.makeInput(
+            self.model_desc, "input", data_type, input_shape
+        )
+        data = self.quantize1(data)
+        data = self.dequantize2(data)
+        # 权重由DequantizeLinear产生，Conv的权重名取其输出名
+        weight = self.dequantize3("conv_weight")
+        data = nndeploy._C.op.makeConv(
+            self.model_desc,
+            data,
+            self.conv_param,
+            weight.getOutputName()[0],
+            "conv_bias",
+        )
+        data = self.quantize5(data)
+        return data
+
+
+def run(model):
+    model.net.setInputs(nndeploy_input_map)
+    return createNumpyFromTensor(model.run()[0])
+
+
+def compare(test, expect, result, message):
+    # QLinearConv的累加与重量化顺序不同于float卷积，允许相差1个最低位
+    test.assertEqual(result.dtype, np.int8, message)
+    diff = np.abs(expect.astype(np.int32) - result.astype(np.int32))
+    test.assertLessEqual(int(diff.max()), 1, message)
+
+
+class TestFuseQdqConv(unittest.TestCase):
+
+    def test_fuse_qdq_conv(self):
+        # 禁止图优化，逐个运行Q/DQ与float卷积
+        test_net0 = TestNet()
+        test_net0.construct(enable_net_opt=False)
+        no_opt_result = run(test_net0)
+        compare(self, reference_result, no_opt_result, "no_opt")
+
+        # 仅开启FuseQdqConv
+        test_net1 = TestNet()
+        test_net1.construct(enable_pass=[FuseQdqConv])
+        compare(self, no_opt_result, run(test_net1), "fuse_qdq_conv")
+
+        # 开启图优化
+        test_net2 = TestNet()
+        test_net2.construct()
+        compare(self, no_opt_result, run(test_net2), "graph_opt")
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,109 @@
+import unittest
+import numpy as np
+import nndeploy
+
+from nndeploy.test_utils import createTensorFromNumpy, createNumpyFromTensor
+from nndeploy.net import build_model
+from nndeploy.net import PropagateLayout
+
+
+_C = nndeploy._C
+
+# 通道数13与26不是块大小的整数倍，区域内的张量都有补齐的通道
+input_shape = [1, 3, 20, 20]
+mid_channel = 13
+output_channel = 10
+
+
+def random_weight(shape):
+    return createTensorFromNumpy(
+        np.random.uniform(-0.3, 0.3, shape).astype(np.float32))
+
+
+nndeploy_weight_map = {
+    "conv1_weight": random_weight([mid_channel, 3, 3, 3]),
+    "conv1_bias": random_weight([mid_channel]),
+    "conv2_weight": random_weight([mid_channel, 1, 3, 3]),
+    "conv2_bias": random_weight([mid_channel]),
+    "conv3_weight": random_weight([output_channel, 2 * mid_channel, 1, 1]),
+    "conv3_bias": random_weight([output_channel]),
+}
+
+np_input = np.random.uniform(-1, 1, input_shape).astype(np.float32)
+
+
+class TestNet(nndeploy.net.Model):
+    """
+    Conv -> Sigmoid -> MaxPool/AveragePool -> Add
+                    -> depthwise Conv(stride 2)
+    Concat(Add, depthwise Conv) -> Conv(1x1)
+    """
+
+    def __init__(self):
+        super().__init__()
+
+        self.weight_map = nndeploy_weight_map
+
+        self.conv1 = nndeploy.op.Conv(3, mid_channel, [3, 3], padding=1,
+                                      weight_name="conv1_weight",
+                                      bias_name="conv1_bias")
+        self.sigmoid = nndeploy.op.Sigmoid()
+        self.max_pool = nndeploy.op.MaxPool([2, 2], 2)
+        self.average_pool = nndeploy.op.AveragePool([2, 2], 2)
+        self.add = nndeploy.op.Add()
+        self.conv2 = nndeploy.op.Conv(mid_channel, mid_channel, [3, 3],
+                                      stride=2, padding=1, groups=mid_channel,
+                                      weight_name="conv2_weight",
+                                      bias_name="conv2_bias")
+        self.concat = nndeploy.op.Concat(1)
+        self.conv3 = nndeploy.op.Conv(2 * mid_channel, output_channel, [1, 1],
+                                      weight_name="conv3_weight",
+                                      bias_name="conv3_bias")
+
+    @build_model
+    def construct(self, enable_net_opt=True, enable_pass=set(), disable_pass=set()):
+        data_type = _C.base.DataType()
+        data_type.code_ = _C.base.DataTypeCode.kDataTypeCodeFp
+        data = _C.op.makeInput(self.model_desc, "input", data_type,
+                               input_shape)
+        data = self.sigmoid(self.conv1(data))
+        pooled = self.add(self.max_pool(data), self.average_pool(data))
+        data = self.concat([pooled, self.conv2(data)])
+        return self.conv3(data)
+
+
+def run(enable_layout):
+    model = TestNet()
+    if enable_layout:
+        model.construct(enable_pass=[PropagateLayout])
+    else:
+        model.construct(enable_net_opt=False)
+    model.net.setInputs({"input": createTensorFromNumpy(np_input)})
+    return createNumpyFromTensor(model.run()[0])
+
+
+class TestPropagateLayout(unittest.TestCase):
+
+    def setUp(self):
+        self.hardware = _C.base.getHardwareCpuIsa()
+
+    def tearDown(self):
+        _C.base.setCpuIsa(self.hardware)
+
+    def test_propagate_layout(self):
+        # 块大小随指令集选择：支持AVX2时为NC8HW，否则为NC4HW
+        isas = [_C.base.CpuIsa.kCpuIsaScalar]
+        if _C.base.isCpuIsaSupported(_C.base.CpuIsa.kCpuIsaAvx2):
+            isas.append(_C.base.CpuIsa.kCpuIsaAvx2)
+        for isa in isas:
+            _C.base.setCpuIsa(isa)
+            expect = run(False)
+            result = run(True)
+            # 模型的输出仍为NCHW
+            self.assertEqual(list(expect.shape), list(result.shape), str(isa))
+            self.assertTrue(
+                np.allclose(expect, result, rtol=1e-04, atol=1e-05), str(isa))
+
+
+if __name__ == "__main__":
+    unittest.main()
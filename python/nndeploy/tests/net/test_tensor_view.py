@@ -0,0 +1,86 @@
+import unittest
+import numpy as np
+import nndeploy
+
+from nndeploy.test_utils import createTensorFromNumpy, createNumpyFromTensor
+from nndeploy.net import build_model
+
+
+max_shape = [1, 6, 8, 8]
+np_split = np.array([2, 4], dtype=np.int64)
+
+
+def softmax(x, axis):
+    e = np.exp(x - np.max(x, axis=axis, keepdims=True))
+    return e / np.sum(e, axis=axis, keepdims=True)
+
+
+def reference(x, sections):
+    a, b = np.split(x, sections, axis=1)
+    return np.concatenate([softmax(b, -1), np.maximum(a, 0)], axis=1)
+
+
+class SplitConcatNet(nndeploy.net.Model):
+    """
+    Split的输出引用输入，Relu/Softmax的输出引用Concat的输出，
+    Concat的输入顺序与Split相反
+    """
+
+    def __init__(self, split_name="split"):
+        super().__init__()
+
+        self.weight_map = {"split": createTensorFromNumpy(np_split)}
+
+        self.split = nndeploy.op.Split(2, axis=1, split_name=split_name)
+        self.relu = nndeploy.op.Relu()
+        self.softmax = nndeploy.op.SoftMax(-1)
+        self.concat = nndeploy.op.Concat(axis=1)
+
+    @build_model
+    def construct(self, enable_net_opt=True, enable_pass=set(), disable_pass=set()):
+        data_type = nndeploy._C.base.DataType()
+        data_type.code_ = nndeploy._C.base.DataTypeCode.kDataTypeCodeFp
+        data = nndeploy._C.op.makeInput(self.model_desc, "input", data_type, max_shape)
+        a, b = self.split(data)
+        a = self.relu(a)
+        b = self.softmax(b)
+        return self.concat([b, a])
+
+
+class TestTensorView(unittest.TestCase):
+
+    def check(self, model, shape, sections=[2]):
+        np_input = np.random.uniform(-1, 1, shape).astype(np.float32)
+        model.net.setInputs({"input": createTensorFromNumpy(np_input)})
+        result = createNumpyFromTensor(model.run()[0])
+        self.assertEqual(list(result.shape), list(shape))
+        self.assertTrue(
+            np.allclose(reference(np_input, sections), result, rtol=1e-05, atol=1e-06),
+            "shape=%s" % shape,
+        )
+
+    def test_split_concat(self):
+        model = SplitConcatNet()
+        model.construct()
+        self.check(model, max_shape)
+
+    def test_split_concat_equal(self):
+        # 没有split输入时按输出个数均分
+        model = SplitConcatNet(split_name="")
+        model.construct()
+        self.check(model, max_shape, sections=2)
+
+    def test_split_concat_reshape(self):
+        # 不超过max shape时复用内存，视图的偏移随shape变化；超过时重新分配
+        model = SplitConcatNet()
+        model.net.setDynamicShape(
+            True, {"input": [1, 6, 1, 1]}, {"input": max_shape}, {"input": max_shape}
+        )
+        model.construct()
+        for shape in [max_shape, [1, 6, 4, 4], [1, 6, 8, 3], max_shape, [1, 6, 9, 9]]:
+            model.net.reshape({"input": shape})
+            self.check(model, shape)
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,111 @@
+import unittest
+import numpy as np
+import nndeploy
+
+from nndeploy.test_utils import createTensorFromNumpy, createNumpyFromTensor
+from nndeploy.net import build_model
+
+
+# 计算量足够大，各op都会走多线程
+input_shape = [1, 16, 64, 64]
+conv_weight_shape = [16, 16, 3, 3]
+conv_bias_shape = [16]
+
+np_input = np.random.uniform(-1, 1, input_shape).astype(np.float32)
+np_conv_weight = np.random.uniform(-0.2, 0.2, conv_weight_shape).astype(
+    np.float32)
+np_conv_bias = np.random.uniform(-0.2, 0.2, conv_bias_shape).astype(np.float32)
+
+nndeploy_weight_map = {
+    "conv_weight": createTensorFromNumpy(np_conv_weight),
+    "conv_bias": createTensorFromNumpy(np_conv_bias),
+}
+
+nndeploy_input_map = {"input": createTensorFromNumpy(np_input)}
+
+# 测试期间线程池默认的线程数
+pool_thread_num = 2
+
+
+class TestNet(nndeploy.net.Model):
+    """
+    Conv -> Relu -> Add -> MaxPool/AveragePool -> Concat
+    """
+
+    def __init__(self):
+        super().__init__()
+
+        self.weight_map = nndeploy_weight_map
+
+        self.conv = nndeploy.op.Conv(16, 16, [3, 3], padding=1,
+                                     weight_name="conv_weight",
+                                     bias_name="conv_bias")
+        self.relu = nndeploy.op.Relu()
+        self.add = nndeploy.op.Add()
+        self.max_pool = nndeploy.op.MaxPool([2, 2], 2)
+        self.average_pool = nndeploy.op.AveragePool([2, 2], 2)
+        self.concat = nndeploy.op.Concat(1)
+
+    @build_model
+    def construct(self, enable_net_opt=True, enable_pass=set(), disable_pass=set()):
+        data_type = nndeploy._C.base.DataType()
+        data_type.code_ = nndeploy._C.base.DataTypeCode.kDataTypeCodeFp
+        input = nndeploy._C.op.makeInput(self.model_desc, "input", data_type,
+                                         input_shape)
+        data = self.conv(input)
+        data = self.relu(data)
+        data = self.add(data, input)
+        return self.concat([self.max_pool(data), self.average_pool(data)])
+
+
+def run(thread_num):
+    model = TestNet()
+    # 线程预算在init之前设置，init时按需扩大线程池
+    model.net.setThreadNum(thread_num)
+    model.construct()
+    model.net.setInputs(nndeploy_input_map)
+    return createNumpyFromTensor(model.run()[0])
+
+
+class TestThreadNum(unittest.TestCase):
+
+    def setUp(self):
+        self.thread_num = nndeploy._C.thread_pool.getThreadNum()
+        nndeploy._C.thread_pool.setThreadNum(pool_thread_num)
+
+    def tearDown(self):
+        nndeploy._C.thread_pool.setThreadNum(self.thread_num)
+
+    def test_thread_num(self):
+        thread_pool = nndeploy._C.thread_pool
+        self.assertEqual(thread_pool.getThreadNum(), pool_thread_num)
+
+        # 预算为1时串行计算，作为参考结果
+        expect = run(1)
+        # 预算小于线程池时线程池不变
+        self.assertEqual(thread_pool.getThreadNum(), pool_thread_num)
+
+        # 不限制预算时使用线程池的全部线程
+        result = run(0)
+        self.assertEqual(thread_pool.getThreadNum(), pool_thread_num)
+        self.assertTrue(np.allclose(expect, result, rtol=1e-05, atol=1e-06),
+                        "thread_num=0")
+
+        # 预算大于线程池时init扩大线程池
+        result = run(4)
+        self.assertEqual(thread_pool.getThreadNum(), 4)
+        self.assertTrue(np.allclose(expect, result, rtol=1e-05, atol=1e-06),
+                        "thread_num=4")
+
+        # run结束后恢复调用线程的预算
+        self.assertEqual(thread_pool.getThreadBudget(), 4)
+
+    def test_get_thread_num(self):
+        net = nndeploy._C.net.Net()
+        self.assertEqual(net.getThreadNum(), 0)
+        net.setThreadNum(3)
+        self.assertEqual(net.getThreadNum(), 3)
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,141 @@
+import unittest
+import numpy as np
+import torch
+import nndeploy
+from nndeploy.op import functional as F
+
+from nndeploy.test_utils import (
+    createTensorFromNumpy,
+    createNumpyFromTensor,
+    device_name_to_code,
+)
+
+
+def torch_attention(q, k, v, attn_mask=None, is_causal=False):
+    """
+    以torch的scaled_dot_product_attention为参考，causal按左上角对齐
+    """
+    q = torch.tensor(q)
+    k = torch.tensor(k)
+    v = torch.tensor(v)
+    group = q.shape[1] // k.shape[1]
+    k = k.repeat_interleave(group, dim=1)
+    v = v.repeat_interleave(group, dim=1)
+    if attn_mask is not None:
+        attn_mask = torch.tensor(attn_mask)
+    return torch.nn.functional.scaled_dot_product_attention(
+        q, k, v, attn_mask=attn_mask, is_causal=is_causal
+    )
+
+
+def random_qkv(batch, q_heads, kv_heads, q_len, kv_len, head_size):
+    np_q = np.random.uniform(-1, 1, (batch, q_heads, q_len, head_size)).astype(
+        np.float32)
+    np_k = np.random.uniform(-1, 1, (batch, kv_heads, kv_len, head_size)).astype(
+        np.float32)
+    np_v = np.random.uniform(-1, 1, (batch, kv_heads, kv_len, head_size)).astype(
+        np.float32)
+    return np_q, np_k, np_v
+
+
+class TestAttentionOp(unittest.TestCase):
+
+    def test_attention(self):
+        np_q, np_k, np_v = random_qkv(2, 8, 8, 77, 77, 64)
+        np_mask = np.random.random((2, 1, 77, 77)).astype(np.float32)
+
+        torch_result = torch_attention(np_q, np_k, np_v, np_mask)
+
+        nndeploy_result = F.attention(
+            createTensorFromNumpy(np_q),
+            createTensorFromNumpy(np_k),
+            createTensorFromNumpy(np_v),
+            createTensorFromNumpy(np_mask),
+        )
+
+        self.assertTrue(
+            np.allclose(
+                torch_result.detach().numpy(),
+                createNumpyFromTensor(nndeploy_result),
+                rtol=1e-03,
+                atol=1e-04,
+            )
+        )
+
+    def test_attention_causal_gqa(self):
+        # 默认与ONNX、torch一致按左上角对齐，q_len与kv_len不同时覆盖两个方向
+        for q_len, kv_len in [(40, 100), (100, 40), (77, 77)]:
+            np_q, np_k, np_v = random_qkv(1, 8, 2, q_len, kv_len, 32)
+
+            torch_result = torch_attention(np_q, np_k, np_v, is_causal=True)
+
+            nndeploy_result = F.attention(
+                createTensorFromNumpy(np_q),
+                createTensorFromNumpy(np_k),
+                createTensorFromNumpy(np_v),
+                is_causal=True,
+            )
+
+            self.assertTrue(
+                np.allclose(
+                    torch_result.detach().numpy(),
+                    createNumpyFromTensor(nndeploy_result),
+                    rtol=1e-03,
+                    atol=1e-04,
+                ),
+                "q_len=%d kv_len=%d" % (q_len, kv_len),
+            )
+
+    def test_attention_causal_bottom_right(self):
+        # 右下角对齐时第i个query可见第[0, i + kv_len - q_len]个key
+        q_len, kv_len = 40, 100
+        np_q, np_k, np_v = random_qkv(1, 8, 2, q_len, kv_len, 32)
+        np_causal = np.tril(np.ones((q_len, kv_len), dtype=bool),
+                            k=kv_len - q_len)
+
+        torch_result = torch_attention(np_q, np_k, np_v, np_causal)
+
+        nndeploy_result = F.attention(
+            createTensorFromNumpy(np_q),
+            createTensorFromNumpy(np_k),
+            createTensorFromNumpy(np_v),
+            is_causal=True,
+            causal_bottom_right=True,
+        )
+
+        self.assertTrue(
+            np.allclose(
+                torch_result.detach().numpy(),
+                createNumpyFromTensor(nndeploy_result),
+                rtol=1e-03,
+                atol=1e-04,
+            )
+        )
+
+    def test_attention_bool_mask(self):
+        # bool掩码以uint8传入，为0的位置不可见，每行至少保留一个可见的key
+        np_q, np_k, np_v = random_qkv(2, 4, 4, 33, 70, 32)
+        np_mask = np.random.random((2, 1, 33, 70)) > 0.5
+        np_mask[..., 0] = True
+
+        torch_result = torch_attention(np_q, np_k, np_v, np_mask)
+
+        nndeploy_result = F.attention(
+            createTensorFromNumpy(np_q),
+            createTensorFromNumpy(np_k),
+            createTensorFromNumpy(np_v),
+            createTensorFromNumpy(np_mask.astype(np.uint8)),
+        )
+
+        self.assertTrue(
+            np.allclose(
+                torch_result.detach().numpy(),
+                createNumpyFromTensor(nndeploy_result),
+                rtol=1e-03,
+                atol=1e-04,
+            )
+        )
+
+
+if __name__ == "__main__":
+    unittest.main()
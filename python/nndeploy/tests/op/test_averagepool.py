@@ -0,0 +1,144 @@
+import math
+import unittest
+import numpy as np
+import torch
+import nndeploy
+from nndeploy.op import functional as F
+
+from nndeploy.test_utils import (
+    createTensorFromNumpy,
+    createNumpyFromTensor,
+    device_name_to_code,
+)
+
+
+def pool_output_size(input_size, kernel, stride, pad, dilation, ceil_mode):
+    effective_kernel = dilation * (kernel - 1) + 1
+    if ceil_mode:
+        size = math.ceil((input_size + 2 * pad - effective_kernel) / stride) + 1
+        # 最后一个窗口不能从右侧padding开始
+        if (size - 1) * stride >= input_size + pad:
+            size -= 1
+        return size
+    return (input_size + 2 * pad - effective_kernel) // stride + 1
+
+
+def pool_reference(x, mode, kernel, stride, pad, dilation, ceil_mode,
+                   count_include_pad=False):
+    """
+    NCHW的2D pooling参考实现，count_include_pad时除数只计入左右padding内的位置
+    """
+    n, c, h, w = x.shape
+    oh = pool_output_size(h, kernel, stride, pad, dilation, ceil_mode)
+    ow = pool_output_size(w, kernel, stride, pad, dilation, ceil_mode)
+    y = np.zeros([n, c, oh, ow], dtype=np.float64)
+    for i in range(oh):
+        for j in range(ow):
+            rows = [i * stride - pad + k * dilation for k in range(kernel)]
+            cols = [j * stride - pad + k * dilation for k in range(kernel)]
+            valid_rows = [r for r in rows if 0 <= r < h]
+            valid_cols = [q for q in cols if 0 <= q < w]
+            window = x[:, :, valid_rows][:, :, :, valid_cols]
+            if mode == "max":
+                y[:, :, i, j] = window.max(axis=(2, 3))
+                continue
+            if count_include_pad:
+                count = len([r for r in rows if -pad <= r < h + pad]) * len(
+                    [q for q in cols if -pad <= q < w + pad]
+                )
+            else:
+                count = len(valid_rows) * len(valid_cols)
+            y[:, :, i, j] = window.sum(axis=(2, 3)) / count
+    return y
+
+
+class TestAveragePoolOp(unittest.TestCase):
+
+    def check_torch(self, input_shape, kernel_size, stride, padding, ceil_mode,
+                    count_include_pad):
+        np_input = np.random.random(input_shape).astype(np.float32)
+
+        torch_result = torch.nn.functional.avg_pool2d(
+            torch.tensor(np_input),
+            kernel_size=kernel_size,
+            stride=stride,
+            padding=padding,
+            ceil_mode=ceil_mode,
+            count_include_pad=count_include_pad,
+        )
+
+        input = createTensorFromNumpy(np_input)
+
+        nndeploy_result = F.averagepool(
+            input,
+            kernel_size,
+            stride,
+            padding,
+            1,
+            ceil_mode,
+            count_include_pad,
+        )
+
+        self.assertTrue(
+            np.allclose(
+                torch_result.detach().numpy(),
+                createNumpyFromTensor(nndeploy_result),
+                rtol=1e-03,
+                atol=1e-04,
+            )
+        )
+
+    def test_averagepool0(self):
+        self.check_torch([32, 4, 16, 16], 2, 2, 0, False, False)
+
+    def test_averagepool_padding(self):
+        for count_include_pad in [False, True]:
+            self.check_torch([2, 4, 17, 23], 3, 1, 1, False, count_include_pad)
+            self.check_torch([2, 4, 17, 23], 5, 2, 2, False, count_include_pad)
+
+    def test_averagepool_ceil_mode(self):
+        # 最后的窗口超出右侧padding，count_include_pad时不计入超出的部分
+        for count_include_pad in [False, True]:
+            self.check_torch([2, 4, 16, 16], 3, 2, 1, True, count_include_pad)
+            self.check_torch([2, 4, 17, 20], 2, 3, 0, True, count_include_pad)
+            self.check_torch([1, 3, 9, 11], 4, 3, 2, True, count_include_pad)
+
+    def test_averagepool_dilations(self):
+        np_input = np.random.random([2, 3, 19, 21]).astype(np.float32)
+        for kernel, stride, pad, dilation, ceil_mode in [
+            (3, 1, 0, 2, False),
+            (3, 2, 2, 2, False),
+            (2, 2, 1, 3, True),
+        ]:
+            for count_include_pad in [False, True]:
+                expect = pool_reference(
+                    np_input,
+                    "average",
+                    kernel,
+                    stride,
+                    pad,
+                    dilation,
+                    ceil_mode,
+                    count_include_pad,
+                )
+                nndeploy_result = F.averagepool(
+                    createTensorFromNumpy(np_input),
+                    kernel,
+                    stride,
+                    pad,
+                    dilation,
+                    ceil_mode,
+                    count_include_pad,
+                )
+                self.assertTrue(
+                    np.allclose(
+                        expect,
+                        createNumpyFromTensor(nndeploy_result),
+                        rtol=1e-03,
+                        atol=1e-04,
+                    )
+                )
+
+
+if __name__ == "__main__":
+    unittest.main()
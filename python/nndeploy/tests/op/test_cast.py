@@ -0,0 +1,176 @@
+import unittest
+import numpy as np
+import nndeploy
+from nndeploy.op import functional as F
+
+from nndeploy.test_utils import createTensorFromNumpy, createNumpyFromTensor
+
+
+_C = nndeploy._C
+
+X86_ISA = [
+    _C.base.CpuIsa.kCpuIsaScalar,
+    _C.base.CpuIsa.kCpuIsaSse4,
+    _C.base.CpuIsa.kCpuIsaAvx2,
+    _C.base.CpuIsa.kCpuIsaAvx512,
+    _C.base.CpuIsa.kCpuIsaAvx512Vnni,
+]
+
+
+def data_type(code, bits):
+    dt = _C.base.DataType()
+    dt.code_ = code
+    dt.bits_ = bits
+    dt.lanes_ = 1
+    return dt
+
+
+fp32 = data_type(_C.base.DataTypeCode.kDataTypeCodeFp, 32)
+fp16 = data_type(_C.base.DataTypeCode.kDataTypeCodeFp, 16)
+bfp16 = data_type(_C.base.DataTypeCode.kDataTypeCodeBFp, 16)
+
+
+def np_bfp16_bits(x):
+    """
+    float -> bf16的参考实现：舍入到最近的偶数，非规格化数不清零，NaN为quiet NaN
+    """
+    u = x.astype(np.float32).view(np.uint32).astype(np.uint64)
+    rounded = (u + 0x7fff + ((u >> 16) & 1)) >> 16
+    nan = (u >> 16) | 0x40
+    is_nan = (u & 0x7fffffff) > 0x7f800000
+    return np.where(is_nan, nan, rounded).astype(np.uint16)
+
+
+def np_bfp16_to_float(bits):
+    return (bits.astype(np.uint32) << 16).view(np.float32)
+
+
+def np_fp16(x):
+    # 超出fp16范围的值(包括inf)截断到±65504，NaN保持为NaN
+    return np.clip(x, -65504, 65504).astype(np.float16)
+
+
+def special_values():
+    values = [0.0, -0.0, 1.0, -1.0, np.inf, -np.inf, np.nan, -np.nan,
+              # float32的非规格化数
+              1e-40, -1e-40, 1.4e-45, 1.1754942e-38,
+              # 最小的规格化数附近
+              1.1754944e-38, -1.1754944e-38,
+              # fp16的非规格化数与边界
+              1e-6, -3e-7, 6.1e-5, 65504.0, 65519.0, 65520.0, 1e5, -1e5,
+              # bf16舍入到偶数的中点与上溢
+              1.0 + 2.0 ** -8, 1.0 + 3 * 2.0 ** -8, 3.4e38, -3.4e38]
+    return np.array(values, dtype=np.float32)
+
+
+def random_values(count, seed):
+    rng = np.random.RandomState(seed)
+    # 指数覆盖非规格化数到接近上溢的范围
+    mantissa = rng.uniform(-2, 2, count)
+    exponent = rng.randint(-149, 128, count)
+    with np.errstate(over="ignore"):
+        x = np.ldexp(mantissa, exponent).astype(np.float32)
+    # 把特殊值散布到向量化实现的各个分块中
+    specials = special_values()
+    index = rng.choice(count, len(specials) * 4, replace=False)
+    x[index] = np.tile(specials, 4)
+    return x
+
+
+class TestCast(unittest.TestCase):
+
+    def setUp(self):
+        self.hardware = _C.base.getHardwareCpuIsa()
+        # 依次走逐元素、AVX2(F16C)与AVX512(AVX512-BF16)的实现，
+        # isCpuIsaSupported按当前生效的级别判断，须在降低级别之前选取
+        _C.base.setCpuIsa(self.hardware)
+        if self.hardware in X86_ISA:
+            self.isa_levels = [_C.base.CpuIsa.kCpuIsaScalar]
+            for isa in [_C.base.CpuIsa.kCpuIsaAvx2,
+                        _C.base.CpuIsa.kCpuIsaAvx512]:
+                if _C.base.isCpuIsaSupported(isa):
+                    self.isa_levels.append(isa)
+        else:
+            self.isa_levels = [_C.base.CpuIsa.kCpuIsaScalar, self.hardware]
+
+    def tearDown(self):
+        _C.base.setCpuIsa(self.hardware)
+
+    def check_bits(self, expect, result, message):
+        # NaN只比较是否为NaN，其余逐位比较
+        expect_nan = np.isnan(expect.astype(np.float32))
+        result_nan = np.isnan(result.astype(np.float32))
+        self.assertTrue(np.array_equal(expect_nan, result_nan), message)
+        self.assertTrue(
+            np.array_equal(expect.view(np.uint16)[~expect_nan],
+                           result.view(np.uint16)[~expect_nan]), message)
+
+    def test_bfp16(self):
+        # 长度不是16的整数倍，覆盖向量化实现的尾部
+        for x in [special_values(), random_values(1003, 0)]:
+            count = len(x)
+            expect = np_bfp16_bits(x)
+            for isa in self.isa_levels:
+                _C.base.setCpuIsa(isa)
+                message = "isa=%s count=%d" % (isa, count)
+                half = F.cast(createTensorFromNumpy(x), bfp16)
+                bits = createNumpyFromTensor(half)
+                self.assertEqual(bits.dtype, np.uint16, message)
+                # 各实现的NaN都是输入的高16位置quiet位，可以逐位比较
+                self.assertTrue(np.array_equal(expect, bits), message)
+                # bf16 -> float是精确的
+                back = createNumpyFromTensor(F.cast(half, fp32))
+                self.assertTrue(
+                    np.array_equal(np_bfp16_to_float(bits), back,
+                                   equal_nan=True), message)
+
+    def test_bfp16_denormal(self):
+        # 非规格化数不清零，与规格化数混在同一个16元素的分块中
+        x = np.ldexp(np.arange(1, 49, dtype=np.float64), -133).astype(
+            np.float32)
+        x[::3] = np.linspace(0.5, 2.0, 16)
+        expect = np_bfp16_bits(x)
+        for isa in self.isa_levels:
+            _C.base.setCpuIsa(isa)
+            bits = createNumpyFromTensor(
+                F.cast(createTensorFromNumpy(x), bfp16))
+            self.assertTrue(np.array_equal(expect, bits), str(isa))
+            self.assertTrue(np.all(bits[np.abs(x) > 0] != 0), str(isa))
+
+    def test_fp16(self):
+        for x in [special_values(), random_values(1003, 0)]:
+            count = len(x)
+            expect = np_fp16(x)
+            for isa in self.isa_levels:
+                _C.base.setCpuIsa(isa)
+                message = "isa=%s count=%d" % (isa, count)
+                half = F.cast(createTensorFromNumpy(x), fp16)
+                result = createNumpyFromTensor(half)
+                self.assertEqual(result.dtype, np.float16, message)
+                self.check_bits(expect, result, message)
+                # fp16 -> float是精确的
+                back = createNumpyFromTensor(F.cast(half, fp32))
+                self.assertTrue(
+                    np.array_equal(expect.astype(np.float32), back,
+                                   equal_nan=True), message)
+
+    def test_fp16_input(self):
+        # fp16的非规格化数、inf与NaN转换为float与转换为bf16
+        x = np.array([0, 6e-8, -6e-8, 1e-5, 65504, np.inf, -np.inf, np.nan,
+                      1.0, -2.5] * 3, dtype=np.float16)
+        for isa in self.isa_levels:
+            _C.base.setCpuIsa(isa)
+            result = createNumpyFromTensor(
+                F.cast(createTensorFromNumpy(x), fp32))
+            self.assertTrue(
+                np.array_equal(x.astype(np.float32), result, equal_nan=True),
+                str(isa))
+            bits = createNumpyFromTensor(
+                F.cast(createTensorFromNumpy(x), bfp16))
+            self.assertTrue(
+                np.array_equal(np_bfp16_bits(x.astype(np.float32)), bits),
+                str(isa))
+
+
+if __name__ == "__main__":
+    unittest.main()
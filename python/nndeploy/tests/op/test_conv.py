@@ -11,6 +11,41 @@ from nndeploy.test_utils import (
 )
 
 
+def conv_with_param(np_input, np_weight, np_bias, strides, pads, group=1):
+    """
+    pads为onnx的顺序[top, left, bottom, right]，可以不对称
+    """
+    param = nndeploy._C.ir.ConvParam()
+    param.dilations_ = [1, 1]
+    param.group_ = group
+    param.kernel_shape_ = [np_weight.shape[2], np_weight.shape[3]]
+    param.strides_ = [strides, strides]
+    param.pads_ = pads
+    bias = createTensorFromNumpy(np_bias) if np_bias is not None else None
+    result = nndeploy._C.op.conv(
+        createTensorFromNumpy(np_input), createTensorFromNumpy(np_weight), bias,
+        param
+    )
+    return createNumpyFromTensor(result)
+
+
+def torch_conv_reference(np_input, np_weight, np_bias, strides, pads, group=1):
+    """
+    float64的直接卷积作为参考，不对称的pad先用F.pad补齐
+    """
+    input = torch.nn.functional.pad(
+        torch.tensor(np_input, dtype=torch.float64),
+        (pads[1], pads[3], pads[0], pads[2]),
+    )
+    bias = None
+    if np_bias is not None:
+        bias = torch.tensor(np_bias, dtype=torch.float64)
+    return torch.nn.functional.conv2d(
+        input, torch.tensor(np_weight, dtype=torch.float64), bias,
+        stride=strides, groups=group
+    ).numpy()
+
+
 class TestConvOp(unittest.TestCase):
 
     def test_conv_without_bias_0(self):
@@ -66,6 +101,119 @@ class TestConvOp(unittest.TestCase):
             )
         )
 
+    def test_conv_winograd(self):
+        # 3x3/stride1/group1走winograd F(4x4, 3x3)，与float64的直接卷积对比
+        # H、W跨多个4x4的tile且不是4的整数倍，覆盖边界tile
+        # 输入与权重有正有负，C=32时实测的最大绝对误差约为1.3e-4
+        for input_shape, pad in [([1, 32, 30, 27], 1), ([2, 32, 19, 22], 0)]:
+            weight_shape = [24, input_shape[1], 3, 3]
+            np_input = np.random.uniform(-1, 1, input_shape).astype(np.float32)
+            np_weight = np.random.uniform(-1, 1, weight_shape).astype(np.float32)
+            np_bias = np.random.uniform(-1, 1, weight_shape[0]).astype(np.float32)
+            pads = [pad, pad, pad, pad]
+
+            expect = torch_conv_reference(np_input, np_weight, np_bias, 1, pads)
+            result = conv_with_param(np_input, np_weight, np_bias, 1, pads)
+            self.assertEqual(list(expect.shape), list(result.shape))
+            self.assertTrue(
+                np.allclose(expect, result, rtol=1e-04, atol=5e-04),
+                str(input_shape),
+            )
+
+    def test_conv_depthwise(self):
+        # group == input_c == output_c，3x3/5x5与stride1/2走depthwise的fast path
+        channels = 8
+        for kernel in [3, 5]:
+            for stride in [1, 2]:
+                np_input = np.random.uniform(-1, 1, [2, channels, 17, 19]).astype(
+                    np.float32)
+                np_weight = np.random.uniform(
+                    -1, 1, [channels, 1, kernel, kernel]).astype(np.float32)
+                np_bias = np.random.uniform(-1, 1, channels).astype(np.float32)
+                pads = [kernel // 2] * 4
+
+                expect = torch_conv_reference(np_input, np_weight, np_bias,
+                                              stride, pads, channels)
+                result = conv_with_param(np_input, np_weight, np_bias, stride,
+                                         pads, channels)
+                message = "kernel=%d stride=%d" % (kernel, stride)
+                self.assertEqual(list(expect.shape), list(result.shape), message)
+                self.assertTrue(
+                    np.allclose(expect, result, rtol=1e-05, atol=1e-05), message)
+
+    def test_conv_depth_multiplier(self):
+        # group == input_c，output_c为input_c的整数倍，不走depthwise的fast path
+        channels = 6
+        for multiplier, kernel, stride in [(2, 3, 1), (3, 5, 2)]:
+            np_input = np.random.uniform(-1, 1, [1, channels, 15, 13]).astype(
+                np.float32)
+            np_weight = np.random.uniform(
+                -1, 1, [channels * multiplier, 1, kernel, kernel]).astype(
+                    np.float32)
+            np_bias = np.random.uniform(-1, 1, channels * multiplier).astype(
+                np.float32)
+            pads = [kernel // 2] * 4
+
+            expect = torch_conv_reference(np_input, np_weight, np_bias, stride,
+                                          pads, channels)
+            result = conv_with_param(np_input, np_weight, np_bias, stride, pads,
+                                     channels)
+            message = "multiplier=%d" % multiplier
+            self.assertEqual(list(expect.shape), list(result.shape), message)
+            self.assertTrue(
+                np.allclose(expect, result, rtol=1e-05, atol=1e-05), message)
+
+    def test_conv_asymmetric_pads(self):
+        # 起止两侧的pad不同，覆盖winograd、depthwise与通用路径
+        for input_c, output_c, group, stride, pads in [
+                (8, 10, 1, 1, [0, 1, 2, 1]),
+                (8, 10, 1, 2, [2, 0, 1, 1]),
+                (8, 8, 8, 1, [1, 2, 0, 1]),
+                (8, 8, 8, 2, [1, 0, 0, 2])]:
+            np_input = np.random.uniform(-1, 1, [1, input_c, 14, 15]).astype(
+                np.float32)
+            np_weight = np.random.uniform(
+                -1, 1, [output_c, input_c // group, 3, 3]).astype(np.float32)
+            np_bias = np.random.uniform(-1, 1, output_c).astype(np.float32)
+
+            expect = torch_conv_reference(np_input, np_weight, np_bias, stride,
+                                          pads, group)
+            result = conv_with_param(np_input, np_weight, np_bias, stride, pads,
+                                     group)
+            message = "group=%d stride=%d pads=%s" % (group, stride, pads)
+            self.assertEqual(list(expect.shape), list(result.shape), message)
+            self.assertTrue(
+                np.allclose(expect, result, rtol=1e-04, atol=1e-04), message)
+
+    def test_conv_pointwise(self):
+        # 1x1/stride1/pad0走pointwise，输入直接作为GEMM的B矩阵
+        for group in [1, 2]:
+            np_input = np.random.uniform(-1, 1, [2, 16, 13, 11]).astype(
+                np.float32)
+            np_weight = np.random.uniform(-1, 1, [24, 16 // group, 1, 1]).astype(
+                np.float32)
+            np_bias = np.random.uniform(-1, 1, 24).astype(np.float32)
+
+            torch_result = torch.nn.functional.conv2d(
+                torch.tensor(np_input), torch.tensor(np_weight),
+                torch.tensor(np_bias), groups=group
+            )
+            nndeploy_result = F.conv(
+                createTensorFromNumpy(np_input),
+                createTensorFromNumpy(np_weight),
+                createTensorFromNumpy(np_bias),
+                groups=group,
+            )
+            self.assertTrue(
+                np.allclose(
+                    torch_result.detach().numpy(),
+                    createNumpyFromTensor(nndeploy_result),
+                    rtol=1e-04,
+                    atol=1e-04,
+                ),
+                "group=%d" % group,
+            )
+
 
 if __name__ == "__main__":
     unittest.main()
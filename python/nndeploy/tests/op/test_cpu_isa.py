@@ -0,0 +1,109 @@
+import unittest
+import numpy as np
+import nndeploy
+from nndeploy.op import functional as F
+
+from nndeploy.test_utils import (
+    createTensorFromNumpy,
+    createNumpyFromTensor,
+)
+
+_C = nndeploy._C
+
+X86_ISA = [
+    _C.base.CpuIsa.kCpuIsaScalar,
+    _C.base.CpuIsa.kCpuIsaSse4,
+    _C.base.CpuIsa.kCpuIsaAvx2,
+    _C.base.CpuIsa.kCpuIsaAvx512,
+    _C.base.CpuIsa.kCpuIsaAvx512Vnni,
+]
+
+# Add注册了的kernel级别，x86/arm下的kernel随cpu一起编译
+ADD_KERNEL_ISA = [
+    _C.base.CpuIsa.kCpuIsaScalar,
+    _C.base.CpuIsa.kCpuIsaAvx2,
+    _C.base.CpuIsa.kCpuIsaAvx512,
+    _C.base.CpuIsa.kCpuIsaNeon,
+]
+
+
+def float_type():
+    data_type = _C.base.DataType()
+    data_type.code_ = _C.base.DataTypeCode.kDataTypeCodeFp
+    data_type.bits_ = 32
+    data_type.lanes_ = 1
+    return data_type
+
+
+class TestCpuIsa(unittest.TestCase):
+
+    def setUp(self):
+        self.hardware = _C.base.getHardwareCpuIsa()
+
+    def tearDown(self):
+        _C.base.setCpuIsa(self.hardware)
+
+    def supported_levels(self):
+        if self.hardware in X86_ISA:
+            return X86_ISA[: X86_ISA.index(self.hardware) + 1]
+        return [_C.base.CpuIsa.kCpuIsaScalar, self.hardware]
+
+    def test_detection(self):
+        self.assertNotEqual(self.hardware, _C.base.CpuIsa.kCpuIsaNotSupport)
+        self.assertEqual(_C.base.getCpuIsa(), self.hardware)
+        self.assertTrue(_C.base.isCpuIsaSupported(self.hardware))
+        self.assertTrue(_C.base.isCpuIsaSupported(_C.base.CpuIsa.kCpuIsaScalar))
+
+    def test_override(self):
+        for isa in self.supported_levels():
+            _C.base.setCpuIsa(isa)
+            self.assertEqual(_C.base.getCpuIsa(), isa)
+            self.assertTrue(_C.base.isCpuIsaSupported(isa))
+            if isa in X86_ISA and isa != X86_ISA[-1]:
+                higher = X86_ISA[X86_ISA.index(isa) + 1]
+                self.assertFalse(_C.base.isCpuIsaSupported(higher))
+
+        # 不能高于硬件支持的级别，x86与arm的级别互不兼容
+        _C.base.setCpuIsa(self.hardware)
+        if self.hardware in X86_ISA:
+            unsupported = X86_ISA[X86_ISA.index(self.hardware) + 1 :]
+            unsupported.append(_C.base.CpuIsa.kCpuIsaNeon)
+        else:
+            unsupported = X86_ISA[1:]
+        for isa in unsupported:
+            with self.assertRaises(RuntimeError):
+                _C.base.setCpuIsa(isa)
+            self.assertEqual(_C.base.getCpuIsa(), self.hardware)
+
+    def test_registry_fallback(self):
+        np_input1 = np.random.uniform(-3, 3, (3, 5, 67)).astype(np.float32)
+        np_input2 = np.random.uniform(-3, 3, (3, 5, 67)).astype(np.float32)
+        expect = np_input1 + np_input2
+
+        for isa in self.supported_levels():
+            _C.base.setCpuIsa(isa)
+            # 没有该级别的kernel时退回到可运行的最高级别
+            registered = [
+                k for k in ADD_KERNEL_ISA if _C.base.isCpuIsaSupported(k)
+            ]
+            self.assertEqual(
+                _C.op.get_op_kernel_isa("kOpTypeAdd", float_type()),
+                max(registered, key=int),
+            )
+
+            nndeploy_result = F.add(
+                createTensorFromNumpy(np_input1), createTensorFromNumpy(np_input2)
+            )
+            # 各级别的加法与标量实现逐位一致
+            self.assertTrue(
+                np.array_equal(expect, createNumpyFromTensor(nndeploy_result))
+            )
+
+        self.assertEqual(
+            _C.op.get_op_kernel_isa("kOpTypeRelu", float_type()),
+            _C.base.CpuIsa.kCpuIsaNotSupport,
+        )
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -180,6 +180,48 @@ class TestGemmOp(unittest.TestCase):
                 atol=1e-04,
             )
         )
+    def test_gemm_cpu_isa(self):
+        # m、n不是tile大小的整数倍，K为奇数，覆盖micro kernel的边界tile
+        input_shape = [37, 301]
+        weight_shape = [301, 29]
+
+        np_input = np.random.uniform(-1, 1, input_shape).astype(np.float32)
+        np_weight = np.random.uniform(-1, 1, weight_shape).astype(np.float32)
+        np_bias = np.random.uniform(-1, 1, (1, weight_shape[1])).astype(np.float32)
+        alpha = 0.5
+        beta = -0.75
+
+        expect = alpha * (
+            np_input.astype(np.float64) @ np_weight.astype(np.float64)
+        ) + beta * np_bias.astype(np.float64)
+
+        hardware = nndeploy._C.base.getHardwareCpuIsa()
+        CpuIsa = nndeploy._C.base.CpuIsa
+        try:
+            # 各指令集级别的micro kernel都与float64的参考一致
+            for isa in [CpuIsa.kCpuIsaScalar, CpuIsa.kCpuIsaAvx2,
+                        CpuIsa.kCpuIsaAvx512]:
+                if not nndeploy._C.base.isCpuIsaSupported(isa):
+                    continue
+                nndeploy._C.base.setCpuIsa(isa)
+                nndeploy_result = F.gemm(
+                    createTensorFromNumpy(np_input),
+                    createTensorFromNumpy(np_weight),
+                    createTensorFromNumpy(np_bias),
+                    alpha=alpha,
+                    beta=beta,
+                )
+                self.assertTrue(
+                    np.allclose(
+                        expect,
+                        createNumpyFromTensor(nndeploy_result),
+                        rtol=1e-04,
+                        atol=1e-04,
+                    ),
+                    str(isa),
+                )
+        finally:
+            nndeploy._C.base.setCpuIsa(hardware)
 
 
 if __name__ == "__main__":
@@ -36,6 +36,24 @@ class TestGlobalAveragePoolOp(unittest.TestCase):
             )
         )
 
+    def test_global_averagepool_shapes(self):
+        # 回归：非方形、奇数大小、单个元素以及量级较大的输入
+        for input_shape in [[2, 3, 7, 13], [1, 5, 1, 1], [3, 17, 1, 129]]:
+            np_input = np.random.uniform(-1e3, 1e3, input_shape).astype(np.float32)
+
+            expect = np.mean(np_input.astype(np.float64), axis=(2, 3), keepdims=True)
+
+            nndeploy_result = F.global_averagepool(createTensorFromNumpy(np_input))
+
+            self.assertTrue(
+                np.allclose(
+                    expect,
+                    createNumpyFromTensor(nndeploy_result),
+                    rtol=1e-04,
+                    atol=1e-03,
+                )
+            )
+
 
 if __name__ == "__main__":
     unittest.main()
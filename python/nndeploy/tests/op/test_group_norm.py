@@ -0,0 +1,74 @@
+import unittest
+import numpy as np
+import torch
+import nndeploy
+from nndeploy.op import functional as F
+
+from nndeploy.test_utils import (
+    createTensorFromNumpy,
+    createNumpyFromTensor,
+    device_name_to_code,
+)
+
+
+class TestGroupNormOp(unittest.TestCase):
+
+    def test_group_norm(self):
+        np_input = np.random.uniform(-2, 6, (2, 32, 16, 16)).astype(np.float32)
+        np_weight = np.random.random(32).astype(np.float32)
+        np_bias = np.random.random(32).astype(np.float32)
+
+        torch_result = torch.nn.functional.group_norm(
+            torch.tensor(np_input),
+            8,
+            torch.tensor(np_weight),
+            torch.tensor(np_bias),
+            eps=1e-5,
+        )
+
+        nndeploy_result = F.group_norm(
+            createTensorFromNumpy(np_input),
+            8,
+            createTensorFromNumpy(np_weight),
+            createTensorFromNumpy(np_bias),
+        )
+
+        self.assertTrue(
+            np.allclose(
+                torch_result.detach().numpy(),
+                createNumpyFromTensor(nndeploy_result),
+                rtol=1e-03,
+                atol=1e-05,
+            )
+        )
+
+    def test_instance_norm(self):
+        np_input = np.random.random((2, 16, 20, 20)).astype(np.float32)
+        np_weight = np.random.random(16).astype(np.float32)
+        np_bias = np.random.random(16).astype(np.float32)
+
+        torch_result = torch.nn.functional.instance_norm(
+            torch.tensor(np_input),
+            weight=torch.tensor(np_weight),
+            bias=torch.tensor(np_bias),
+            eps=1e-5,
+        )
+
+        nndeploy_result = F.instance_norm(
+            createTensorFromNumpy(np_input),
+            createTensorFromNumpy(np_weight),
+            createTensorFromNumpy(np_bias),
+        )
+
+        self.assertTrue(
+            np.allclose(
+                torch_result.detach().numpy(),
+                createNumpyFromTensor(nndeploy_result),
+                rtol=1e-03,
+                atol=1e-05,
+            )
+        )
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,69 @@
+import unittest
+import numpy as np
+import torch
+import nndeploy
+from nndeploy.op import functional as F
+
+from nndeploy.test_utils import (
+    createTensorFromNumpy,
+    createNumpyFromTensor,
+    device_name_to_code,
+)
+
+
+class TestLayerNormOp(unittest.TestCase):
+
+    def test_layer_norm(self):
+        np_input = np.random.uniform(-3, 5, (2, 77, 768)).astype(np.float32)
+        np_weight = np.random.random(768).astype(np.float32)
+        np_bias = np.random.random(768).astype(np.float32)
+
+        torch_result = torch.nn.functional.layer_norm(
+            torch.tensor(np_input),
+            (768,),
+            torch.tensor(np_weight),
+            torch.tensor(np_bias),
+            eps=1e-5,
+        )
+
+        nndeploy_result = F.layer_norm(
+            createTensorFromNumpy(np_input),
+            createTensorFromNumpy(np_weight),
+            createTensorFromNumpy(np_bias),
+        )
+
+        self.assertTrue(
+            np.allclose(
+                torch_result.detach().numpy(),
+                createNumpyFromTensor(nndeploy_result),
+                rtol=1e-03,
+                atol=1e-05,
+            )
+        )
+
+    def test_layer_norm_multi_axis(self):
+        np_input = np.random.random((3, 5, 7, 9)).astype(np.float32)
+        np_weight = np.random.random((7, 9)).astype(np.float32)
+
+        torch_result = torch.nn.functional.layer_norm(
+            torch.tensor(np_input), (7, 9), torch.tensor(np_weight)
+        )
+
+        nndeploy_result = F.layer_norm(
+            createTensorFromNumpy(np_input),
+            createTensorFromNumpy(np_weight),
+            axis=-2,
+        )
+
+        self.assertTrue(
+            np.allclose(
+                torch_result.detach().numpy(),
+                createNumpyFromTensor(nndeploy_result),
+                rtol=1e-03,
+                atol=1e-05,
+            )
+        )
+
+
+if __name__ == "__main__":
+    unittest.main()
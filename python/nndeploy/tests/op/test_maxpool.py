@@ -81,6 +81,55 @@ class TestMaxPoolOp(unittest.TestCase):
             )
         )
 
+    def check(self, np_input, kernel_size, stride, padding, dilation, ceil_mode):
+        torch_result = torch.nn.functional.max_pool2d(
+            torch.tensor(np_input),
+            kernel_size=kernel_size,
+            stride=stride,
+            padding=padding,
+            dilation=dilation,
+            ceil_mode=ceil_mode,
+        )
+
+        input = createTensorFromNumpy(np_input)
+
+        nndeploy_result = F.maxpool(
+            input, kernel_size, stride, padding, dilation, ceil_mode
+        )
+
+        self.assertTrue(
+            np.array_equal(
+                torch_result.detach().numpy(),
+                createNumpyFromTensor(nndeploy_result),
+            )
+        )
+
+    def test_maxpool_dilations(self):
+        np_input = np.random.random([2, 4, 19, 23]).astype(np.float32)
+        for kernel_size, stride, padding, dilation, ceil_mode in [
+            (3, 1, 0, 2, False),
+            (3, 2, 1, 2, False),
+            (3, 2, 1, 3, True),
+            (2, 3, 1, 2, True),
+        ]:
+            self.check(np_input, kernel_size, stride, padding, dilation, ceil_mode)
+
+    def test_maxpool_ceil_mode(self):
+        # 最后的窗口不能从右侧padding开始
+        for input_shape in [[2, 3, 16, 16], [2, 3, 17, 20], [1, 5, 9, 11]]:
+            np_input = np.random.random(input_shape).astype(np.float32)
+            for kernel_size, stride, padding in [(2, 2, 1), (3, 3, 1), (4, 3, 2)]:
+                self.check(np_input, kernel_size, stride, padding, 1, True)
+                self.check(np_input, kernel_size, stride, padding, 1, False)
+
+    def test_maxpool_negative_input(self):
+        # 回归：padding的位置不参与max，全为负数时结果不能为0
+        np_input = -np.random.uniform(1, 2, [2, 8, 13, 13]).astype(np.float32)
+        self.check(np_input, 3, 2, 1, 1, False)
+        self.check(np_input, 3, 1, 1, 1, True)
+        # 窗口覆盖整个输入
+        self.check(np_input, 13, 1, 0, 1, False)
+
 
 if __name__ == "__main__":
     unittest.main()
@@ -0,0 +1,213 @@
+import unittest
+import numpy as np
+import nndeploy
+from nndeploy.op import functional as F
+
+from nndeploy.base.common import DeviceType
+from nndeploy.test_utils import (
+    createTensorFromNumpy,
+    createNumpyFromTensor,
+)
+
+_C = nndeploy._C
+
+num_layers = 2
+num_kv_heads = 2
+head_size = 16
+block_tokens = 4
+
+
+def create_kv_cache():
+    param = _C.op.KVCacheParam()
+    param.num_layers_ = num_layers
+    param.num_kv_heads_ = num_kv_heads
+    param.head_size_ = head_size
+    param.block_tokens_ = block_tokens
+    param.blocks_per_chunk_ = 8
+    kv_cache = _C.op.KVCache(DeviceType("cpu"), param)
+    kv_cache.init()
+    return kv_cache
+
+
+def random_kv(num_tokens):
+    shape = (num_kv_heads, num_tokens, head_size)
+    return [
+        np.random.uniform(-1, 1, shape).astype(np.float32)
+        for _ in range(num_layers * 2)
+    ]
+
+
+class KVSequence:
+    """
+    KV cache中的一个序列，同时保存连续存放的K/V作为参考
+    """
+
+    def __init__(self, kv_cache, seq_id, kv=None):
+        self.kv_cache = kv_cache
+        self.seq_id = seq_id
+        self.kv = kv if kv is not None else [
+            np.zeros((num_kv_heads, 0, head_size), dtype=np.float32)
+            for _ in range(num_layers * 2)
+        ]
+
+    def append(self, num_tokens):
+        self.kv_cache.appendSlots(self.seq_id, num_tokens)
+        new_kv = random_kv(num_tokens)
+        for layer in range(num_layers):
+            self.kv_cache.writeKV(
+                self.seq_id,
+                layer,
+                createTensorFromNumpy(new_kv[layer * 2]),
+                createTensorFromNumpy(new_kv[layer * 2 + 1]),
+            )
+        self.kv = [np.concatenate([a, b], axis=1) for a, b in zip(self.kv, new_kv)]
+
+    def fork(self):
+        seq_id = self.kv_cache.forkSequence(self.seq_id)
+        assert seq_id >= 0
+        return KVSequence(self.kv_cache, seq_id, [kv.copy() for kv in self.kv])
+
+
+class TestKVCache(unittest.TestCase):
+
+    def used_block_num(self, kv_cache):
+        return kv_cache.getBlockNum() - kv_cache.getFreeBlockNum()
+
+    def test_fork_free(self):
+        kv_cache = create_kv_cache()
+        a = KVSequence(kv_cache, kv_cache.createSequence())
+        a.append(10)
+        self.assertEqual(self.used_block_num(kv_cache), 3)
+        # fork的序列共享全部块，任一序列释放后块仍被另一个持有
+        b = a.fork()
+        self.assertEqual(kv_cache.getSequenceLength(b.seq_id), 10)
+        self.assertEqual(self.used_block_num(kv_cache), 3)
+        kv_cache.freeSequence(a.seq_id)
+        self.assertFalse(kv_cache.hasSequence(a.seq_id))
+        self.assertEqual(self.used_block_num(kv_cache), 3)
+        kv_cache.freeSequence(b.seq_id)
+        self.assertEqual(self.used_block_num(kv_cache), 0)
+
+    def test_copy_on_write(self):
+        kv_cache = create_kv_cache()
+        a = KVSequence(kv_cache, kv_cache.createSequence())
+        a.append(6)
+        b = a.fork()
+        c = a.fork()
+        self.assertEqual(self.used_block_num(kv_cache), 2)
+        # 向共享的未满块追加时复制该块，共享的满块不复制
+        b.append(1)
+        self.assertEqual(self.used_block_num(kv_cache), 3)
+        c.append(3)
+        self.assertEqual(self.used_block_num(kv_cache), 5)
+        # 最后一块只剩a引用，不再复制
+        a.append(2)
+        self.assertEqual(self.used_block_num(kv_cache), 5)
+        for seq in [a, b, c]:
+            check_paged_attention(self, kv_cache, [seq])
+        # 满块在块边界处追加，不复制
+        d = a.fork()
+        d.append(1)
+        self.assertEqual(self.used_block_num(kv_cache), 6)
+        check_paged_attention(self, kv_cache, [a, d])
+        for seq in [a, b, c, d]:
+            kv_cache.freeSequence(seq.seq_id)
+        self.assertEqual(self.used_block_num(kv_cache), 0)
+
+
+def dense_attention(q, seq, layer, is_causal):
+    """
+    按连续存放的K/V计算，q为[1, q_num_heads, q_len, head_size]
+    """
+    k = createTensorFromNumpy(seq.kv[layer * 2][np.newaxis])
+    v = createTensorFromNumpy(seq.kv[layer * 2 + 1][np.newaxis])
+    result = F.attention(createTensorFromNumpy(q), k, v, is_causal=is_causal)
+    return createNumpyFromTensor(result)
+
+
+def check_paged_attention(test, kv_cache, seqs, q_num_heads=4, q_len=1,
+                          is_causal=False, is_3d=False):
+    seq_ids = [seq.seq_id for seq in seqs]
+    np_q = np.random.uniform(
+        -1, 1, (len(seqs), q_num_heads, q_len, head_size)
+    ).astype(np.float32)
+    for layer in range(num_layers):
+        expect = np.concatenate(
+            [
+                dense_attention(np_q[i:i + 1], seq, layer, is_causal)
+                for i, seq in enumerate(seqs)
+            ]
+        )
+        if is_3d:
+            # [batch, q_len, q_num_heads * head_size]
+            q = np.ascontiguousarray(
+                np_q.transpose(0, 2, 1, 3).reshape(len(seqs), q_len, -1)
+            )
+            result = createNumpyFromTensor(
+                F.paged_attention(
+                    createTensorFromNumpy(q),
+                    kv_cache,
+                    seq_ids,
+                    layer,
+                    is_causal,
+                    q_num_heads,
+                )
+            )
+            result = result.reshape(len(seqs), q_len, q_num_heads, -1)
+            result = result.transpose(0, 2, 1, 3)
+        else:
+            result = createNumpyFromTensor(
+                F.paged_attention(
+                    createTensorFromNumpy(np_q), kv_cache, seq_ids, layer,
+                    is_causal
+                )
+            )
+        test.assertTrue(
+            np.allclose(expect, result, rtol=1e-04, atol=1e-05),
+            "seq_ids=%s layer=%d q_len=%d is_causal=%s is_3d=%s"
+            % (seq_ids, layer, q_len, is_causal, is_3d),
+        )
+
+
+class TestPagedAttentionOp(unittest.TestCase):
+
+    def test_paged_attention(self):
+        # 各序列长度不同，包含不足一块、正好整块与跨多块的情况
+        kv_cache = create_kv_cache()
+        seqs = []
+        for length in [1, 4, 7, 33]:
+            seq = KVSequence(kv_cache, kv_cache.createSequence())
+            seq.append(length)
+            seqs.append(seq)
+        for q_num_heads in [2, 4]:
+            for is_3d in [False, True]:
+                check_paged_attention(self, kv_cache, seqs, q_num_heads,
+                                      is_3d=is_3d)
+
+    def test_paged_attention_prefill(self):
+        # 多个query token，因果掩码按右下角对齐
+        kv_cache = create_kv_cache()
+        seqs = []
+        for length in [5, 9, 16]:
+            seq = KVSequence(kv_cache, kv_cache.createSequence())
+            seq.append(length)
+            seqs.append(seq)
+        for is_causal in [False, True]:
+            check_paged_attention(self, kv_cache, seqs, q_len=5,
+                                  is_causal=is_causal)
+            check_paged_attention(self, kv_cache, seqs, q_len=5,
+                                  is_causal=is_causal, is_3d=True)
+
+    def test_paged_attention_decode(self):
+        # 逐token追加并解码
+        kv_cache = create_kv_cache()
+        seqs = [KVSequence(kv_cache, kv_cache.createSequence()) for _ in range(2)]
+        seqs[0].append(3)
+        for _ in range(6):
+            for seq in seqs:
+                seq.append(1)
+            check_paged_attention(self, kv_cache, seqs)
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,154 @@
+import unittest
+import numpy as np
+import nndeploy
+from nndeploy.op import functional as F
+
+from nndeploy.test_utils import (
+    createTensorFromNumpy,
+    createNumpyFromTensor,
+)
+
+_C = nndeploy._C
+
+
+def quantize_weight(n, k, group_size, data_type, with_zero_point):
+    """
+    随机生成[N, K]的量化权重，返回(码值, scale, zero point, 反量化的float权重)
+    """
+    info = np.iinfo(data_type)
+    q = np.random.randint(info.min, info.max + 1, (n, k)).astype(data_type)
+    scale = np.random.uniform(0.001, 0.02, (n, k // group_size)).astype(np.float32)
+    zero_point = None
+    zero = np.zeros((n, k // group_size), dtype=np.float32)
+    if with_zero_point:
+        zero_point = np.random.randint(
+            info.min, info.max + 1, (n, k // group_size)
+        ).astype(data_type)
+        zero = zero_point.astype(np.float32)
+    w = (q.astype(np.float32).reshape(n, -1, group_size) - zero[..., np.newaxis]) * \
+        scale[..., np.newaxis]
+    return q, scale, zero_point, w.reshape(n, k)
+
+
+def to_tensor(x):
+    return createTensorFromNumpy(x) if x is not None else None
+
+
+class TestQGemm(unittest.TestCase):
+
+    def setUp(self):
+        self.hardware = _C.base.getHardwareCpuIsa()
+
+    def tearDown(self):
+        _C.base.setCpuIsa(self.hardware)
+
+    def isa_list(self):
+        if self.hardware == _C.base.CpuIsa.kCpuIsaNeon:
+            return [_C.base.CpuIsa.kCpuIsaScalar, self.hardware]
+        return [
+            isa
+            for isa in [
+                _C.base.CpuIsa.kCpuIsaScalar,
+                _C.base.CpuIsa.kCpuIsaAvx2,
+                _C.base.CpuIsa.kCpuIsaAvx512,
+                _C.base.CpuIsa.kCpuIsaAvx512Vnni,
+            ]
+            if _C.base.isCpuIsaSupported(isa)
+        ]
+
+    def check(self, m, n, k, group_size, data_type, with_zero_point,
+              with_bias=False):
+        np_a = np.random.uniform(-1, 1, (m, k)).astype(np.float32)
+        q, scale, zero_point, w = quantize_weight(n, k, group_size, data_type,
+                                                  with_zero_point)
+        np_bias = np.random.uniform(-1, 1, (n,)).astype(np.float32)
+        # 反量化后的float权重走sgemm作为参考
+        expect = createNumpyFromTensor(
+            F.gemm(createTensorFromNumpy(np_a), createTensorFromNumpy(w),
+                   createTensorFromNumpy(np_bias) if with_bias else None,
+                   trans_b=1)
+        )
+        message = "m=%d n=%d k=%d group_size=%d %s zero_point=%s bias=%s" % (
+            m, n, k, group_size, np.dtype(data_type).name, with_zero_point,
+            with_bias,
+        )
+        # avx512vnni把A按组量化为int8，误差上界见qgemm.h：
+        # sum_g(max(|A|) / 127 / 2 * sum(|W|的组内元素))，其余路径A保持float
+        a_scale = np.abs(np_a.reshape(m, -1, group_size)).max(axis=2) / 127.0
+        w_abs_sum = np.abs(w.reshape(n, -1, group_size)).sum(axis=2)
+        int8_act_bound = a_scale / 2 @ w_abs_sum.T
+        reference = None
+        for isa in self.isa_list():
+            _C.base.setCpuIsa(isa)
+            result = createNumpyFromTensor(
+                F.quant_gemm(
+                    createTensorFromNumpy(np_a),
+                    createTensorFromNumpy(q),
+                    createTensorFromNumpy(scale),
+                    to_tensor(zero_point),
+                    createTensorFromNumpy(np_bias) if with_bias else None,
+                )
+            )
+            if isa == _C.base.CpuIsa.kCpuIsaScalar:
+                # 标量kernel作为各指令集的参考，本身与sgemm一致
+                reference = result
+                self.assertTrue(
+                    np.allclose(expect, result, rtol=1e-04, atol=1e-04),
+                    "%s isa=%s" % (message, isa),
+                )
+            elif isa == _C.base.CpuIsa.kCpuIsaAvx512Vnni:
+                self.assertTrue(
+                    np.all(np.abs(result - reference) <= int8_act_bound + 1e-04),
+                    "%s isa=%s" % (message, isa),
+                )
+            else:
+                self.assertTrue(
+                    np.allclose(reference, result, rtol=1e-04, atol=1e-04),
+                    "%s isa=%s" % (message, isa),
+                )
+            if not with_bias:
+                matmul_result = createNumpyFromTensor(
+                    F.quant_matmul(
+                        createTensorFromNumpy(np_a),
+                        createTensorFromNumpy(q),
+                        createTensorFromNumpy(scale),
+                        to_tensor(zero_point),
+                    )
+                )
+                # 同一指令集下Gemm与MatMul走相同的kernel
+                self.assertTrue(
+                    np.allclose(result, matmul_result, rtol=1e-05, atol=1e-05),
+                    "matmul %s isa=%s" % (message, isa),
+                )
+
+    def test_qgemm_decode(self):
+        # m较小时在寄存器内反量化，m不是每次计算行数的整数倍
+        for m in [1, 2, 3, 5]:
+            for data_type in [np.int8, np.uint8]:
+                for with_zero_point in [False, True]:
+                    self.check(m, 37, 128, 32, data_type, with_zero_point)
+                    self.check(m, 16, 256, 128, data_type, with_zero_point)
+
+    def test_qgemm_prefill(self):
+        # m较大时按N分块反量化后调用sgemm，N跨过多个分块
+        for data_type in [np.int8, np.uint8]:
+            for with_zero_point in [False, True]:
+                self.check(20, 300, 64, 32, data_type, with_zero_point)
+
+    def test_qgemm_scalar_group(self):
+        # group_size不是32的倍数时只走标量kernel
+        for data_type in [np.int8, np.uint8]:
+            for with_zero_point in [False, True]:
+                self.check(3, 24, 60, 12, data_type, with_zero_point)
+                self.check(17, 24, 60, 20, data_type, with_zero_point)
+
+    def test_qgemm_bias(self):
+        # B的zero point与C都是可选输入，由has_b_zero_point_区分
+        for with_zero_point in [False, True]:
+            self.check(2, 40, 64, 32, np.int8, with_zero_point, with_bias=True)
+            self.check(18, 40, 64, 64, np.uint8, with_zero_point,
+                       with_bias=True)
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,310 @@
+import unittest
+import numpy as np
+import nndeploy
+from nndeploy.op import functional as F
+
+from nndeploy.test_utils import (
+    createTensorFromNumpy,
+    createNumpyFromTensor,
+)
+
+_C = nndeploy._C
+
+
+def to_tensor(x):
+    return createTensorFromNumpy(x) if x is not None else None
+
+
+def channel_shape(rank, axis):
+    """
+    per-channel的scale/zero_point沿axis广播时的形状
+    """
+    shape = [1] * rank
+    shape[axis] = -1
+    return shape
+
+
+def np_quantize(x, scale, zero_point, data_type, axis=1):
+    """
+    float参考实现，round为四舍六入五取偶，结果饱和到data_type的范围
+    """
+    if scale.size > 1:
+        scale = scale.reshape(channel_shape(x.ndim, axis))
+    zero = np.zeros(1, dtype=np.float32)
+    if zero_point is not None:
+        zero = zero_point.astype(np.float32)
+        if zero.size > 1:
+            zero = zero.reshape(channel_shape(x.ndim, axis))
+    info = np.iinfo(data_type)
+    q = np.rint(x / scale) + zero
+    return np.clip(q, info.min, info.max).astype(data_type)
+
+
+def np_dequantize(q, scale, zero_point, axis=1):
+    if scale.size > 1:
+        scale = scale.reshape(channel_shape(q.ndim, axis))
+    zero = np.zeros(1, dtype=np.float32)
+    if zero_point is not None:
+        zero = zero_point.astype(np.float32)
+        if zero.size > 1:
+            zero = zero.reshape(channel_shape(q.ndim, axis))
+    return ((q.astype(np.float32) - zero) * scale).astype(np.float32)
+
+
+def random_quant(shape, data_type):
+    info = np.iinfo(data_type)
+    return np.random.randint(info.min, info.max + 1, shape).astype(data_type)
+
+
+def random_scale(num):
+    return np.random.uniform(0.002, 0.02, (num,)).astype(np.float32)
+
+
+def random_zero_point(num, data_type):
+    # 零点取在范围中部附近，避免参考结果大面积饱和
+    center = 0 if data_type == np.int8 else 128
+    return np.random.randint(center - 20, center + 20, (num,)).astype(data_type)
+
+
+class TestQuantizeLinear(unittest.TestCase):
+
+    def check_quantize(self, shape, axis, per_channel, data_type,
+                       with_zero_point):
+        np_x = np.random.uniform(-2, 2, shape).astype(np.float32)
+        num = shape[axis] if per_channel else 1
+        scale = random_scale(num)
+        zero_point = (random_zero_point(num, data_type)
+                      if with_zero_point else None)
+        # 未给出zero_point时输出uint8
+        out_type = data_type if with_zero_point else np.uint8
+        expect = np_quantize(np_x, scale, zero_point, out_type, axis)
+        result = createNumpyFromTensor(
+            F.quantize_linear(createTensorFromNumpy(np_x),
+                              createTensorFromNumpy(scale),
+                              to_tensor(zero_point), axis)
+        )
+        message = "shape=%s axis=%d per_channel=%s %s zero_point=%s" % (
+            shape, axis, per_channel, np.dtype(data_type).name,
+            with_zero_point,
+        )
+        self.assertEqual(result.dtype, out_type, message)
+        self.assertTrue(np.array_equal(expect, result), message)
+
+    def test_quantize_per_tensor(self):
+        for data_type in [np.int8, np.uint8]:
+            for with_zero_point in [False, True]:
+                self.check_quantize((2, 3, 5, 7), 1, False, data_type,
+                                    with_zero_point)
+
+    def test_quantize_per_channel(self):
+        for data_type in [np.int8, np.uint8]:
+            for with_zero_point in [False, True]:
+                self.check_quantize((2, 3, 5, 7), 1, True, data_type,
+                                    with_zero_point)
+                self.check_quantize((6, 4), 0, True, data_type,
+                                    with_zero_point)
+                self.check_quantize((6, 4), -1, True, data_type,
+                                    with_zero_point)
+
+    def test_quantize_round_and_saturate(self):
+        # 正好落在.5上的值取偶数，超出范围的值饱和
+        np_x = np.array([0.5, 1.5, 2.5, -0.5, -1.5, -2.5, 1000.0, -1000.0],
+                        dtype=np.float32)
+        scale = np.array([1.0], dtype=np.float32)
+        for data_type, expect in [
+            (np.int8, [0, 2, 2, 0, -2, -2, 127, -128]),
+            (np.uint8, [10, 12, 12, 10, 8, 8, 255, 0]),
+        ]:
+            zero_point = np.array([0 if data_type == np.int8 else 10],
+                                  dtype=data_type)
+            result = createNumpyFromTensor(
+                F.quantize_linear(createTensorFromNumpy(np_x),
+                                  createTensorFromNumpy(scale),
+                                  createTensorFromNumpy(zero_point))
+            )
+            self.assertTrue(
+                np.array_equal(np.array(expect, dtype=data_type), result),
+                np.dtype(data_type).name,
+            )
+
+    def check_dequantize(self, shape, axis, per_channel, data_type,
+                         with_zero_point):
+        np_q = random_quant(shape, data_type)
+        num = shape[axis] if per_channel else 1
+        scale = random_scale(num)
+        zero_point = (random_zero_point(num, data_type)
+                      if with_zero_point else None)
+        expect = np_dequantize(np_q, scale, zero_point, axis)
+        result = createNumpyFromTensor(
+            F.dequantize_linear(createTensorFromNumpy(np_q),
+                                createTensorFromNumpy(scale),
+                                to_tensor(zero_point), axis)
+        )
+        self.assertTrue(
+            np.allclose(expect, result, rtol=1e-06, atol=1e-06),
+            "shape=%s axis=%d per_channel=%s %s zero_point=%s" % (
+                shape, axis, per_channel, np.dtype(data_type).name,
+                with_zero_point,
+            ),
+        )
+
+    def test_dequantize(self):
+        for data_type in [np.int8, np.uint8]:
+            for with_zero_point in [False, True]:
+                for per_channel in [False, True]:
+                    self.check_dequantize((2, 3, 5, 7), 1, per_channel,
+                                          data_type, with_zero_point)
+                    self.check_dequantize((6, 4), 0, per_channel, data_type,
+                                          with_zero_point)
+
+    def test_quantize_dequantize_round_trip(self):
+        # 反量化再量化得到原来的码值
+        for data_type in [np.int8, np.uint8]:
+            np_q = random_quant((3, 8, 4), data_type)
+            scale = random_scale(8)
+            zero_point = random_zero_point(8, data_type)
+            x = F.dequantize_linear(createTensorFromNumpy(np_q),
+                                    createTensorFromNumpy(scale),
+                                    createTensorFromNumpy(zero_point))
+            result = createNumpyFromTensor(
+                F.quantize_linear(x, createTensorFromNumpy(scale),
+                                  createTensorFromNumpy(zero_point))
+            )
+            self.assertTrue(np.array_equal(np_q, result),
+                            np.dtype(data_type).name)
+
+
+def assert_quant_close(test, expect, result, message):
+    # igemm的累加与重量化顺序不同于float参考，允许相差1个最低位
+    diff = np.abs(expect.astype(np.int32) - result.astype(np.int32))
+    test.assertEqual(expect.shape, result.shape, message)
+    test.assertLessEqual(int(diff.max()), 1, message)
+
+
+class TestQLinearMatMul(unittest.TestCase):
+
+    def check(self, shape_a, n, data_type, per_channel, y_type):
+        k = shape_a[-1]
+        np_a = random_quant(shape_a, data_type)
+        np_b = random_quant((k, n), data_type)
+        a_scale = random_scale(1)
+        a_zero_point = random_zero_point(1, data_type)
+        num = n if per_channel else 1
+        b_scale = random_scale(num)
+        b_zero_point = random_zero_point(num, data_type)
+        # 用float的反量化结果计算参考输出，再量化为y
+        a = np_dequantize(np_a, a_scale, a_zero_point)
+        b = np_dequantize(np_b, b_scale, b_zero_point, axis=1)
+        y = np.matmul(a, b)
+        y_scale = np.array([np.abs(y).max() / 100.0], dtype=np.float32)
+        y_zero_point = random_zero_point(1, y_type)
+        expect = np_quantize(y, y_scale, y_zero_point, y_type)
+        result = createNumpyFromTensor(
+            F.qlinear_matmul(
+                createTensorFromNumpy(np_a),
+                createTensorFromNumpy(a_scale),
+                createTensorFromNumpy(a_zero_point),
+                createTensorFromNumpy(np_b),
+                createTensorFromNumpy(b_scale),
+                createTensorFromNumpy(b_zero_point),
+                createTensorFromNumpy(y_scale),
+                createTensorFromNumpy(y_zero_point),
+            )
+        )
+        assert_quant_close(
+            self, expect, result,
+            "shape_a=%s n=%d %s per_channel=%s y=%s" % (
+                shape_a, n, np.dtype(data_type).name, per_channel,
+                np.dtype(y_type).name,
+            ),
+        )
+
+    def test_qlinear_matmul(self):
+        for data_type in [np.int8, np.uint8]:
+            for per_channel in [False, True]:
+                for y_type in [np.int8, np.uint8]:
+                    self.check((5, 32), 24, data_type, per_channel, y_type)
+                    # k不是4的倍数时a按行补齐
+                    self.check((2, 7, 30), 17, data_type, per_channel, y_type)
+
+
+class TestQLinearConv(unittest.TestCase):
+
+    def check(self, x_shape, out_channels, kernel_size, stride, padding,
+              groups, data_type, per_channel, with_bias):
+        in_channels = x_shape[1]
+        w_shape = (out_channels, in_channels // groups, kernel_size,
+                   kernel_size)
+        np_x = random_quant(x_shape, data_type)
+        np_w = random_quant(w_shape, np.int8)
+        x_scale = random_scale(1)
+        x_zero_point = random_zero_point(1, data_type)
+        num = out_channels if per_channel else 1
+        w_scale = random_scale(num)
+        w_zero_point = random_zero_point(num, np.int8)
+        np_b = None
+        if with_bias:
+            np_b = np.random.randint(-2000, 2000,
+                                     (out_channels,)).astype(np.int32)
+
+        # 参考: 反量化后做float卷积，bias的scale为x_scale * w_scale
+        x = np_dequantize(np_x, x_scale, x_zero_point)
+        w = np_dequantize(np_w, w_scale, w_zero_point, axis=0)
+        b = None
+        if with_bias:
+            b = (np_b.astype(np.float32) * x_scale *
+                 np.broadcast_to(w_scale, (out_channels,))).astype(np.float32)
+        y = createNumpyFromTensor(
+            F.conv(createTensorFromNumpy(x), createTensorFromNumpy(w),
+                   to_tensor(b), stride, padding, 1, groups)
+        )
+        y_scale = np.array([np.abs(y).max() / 100.0], dtype=np.float32)
+        y_zero_point = random_zero_point(1, data_type)
+        expect = np_quantize(y, y_scale, y_zero_point, data_type)
+
+        result = createNumpyFromTensor(
+            F.qlinear_conv(
+                createTensorFromNumpy(np_x),
+                createTensorFromNumpy(x_scale),
+                createTensorFromNumpy(x_zero_point),
+                createTensorFromNumpy(np_w),
+                createTensorFromNumpy(w_scale),
+                createTensorFromNumpy(w_zero_point),
+                createTensorFromNumpy(y_scale),
+                createTensorFromNumpy(y_zero_point),
+                to_tensor(np_b),
+                stride,
+                padding,
+                1,
+                groups,
+            )
+        )
+        assert_quant_close(
+            self, expect, result,
+            "x=%s oc=%d k=%d stride=%d pad=%d groups=%d %s per_channel=%s "
+            "bias=%s" % (
+                x_shape, out_channels, kernel_size, stride, padding, groups,
+                np.dtype(data_type).name, per_channel, with_bias,
+            ),
+        )
+
+    def test_qlinear_conv(self):
+        for data_type in [np.int8, np.uint8]:
+            for per_channel in [False, True]:
+                for with_bias in [False, True]:
+                    self.check((1, 8, 9, 9), 16, 3, 1, 1, 1, data_type,
+                               per_channel, with_bias)
+                    self.check((2, 3, 10, 7), 5, 3, 2, 0, 1, data_type,
+                               per_channel, with_bias)
+
+    def test_qlinear_conv_group(self):
+        for data_type in [np.int8, np.uint8]:
+            for per_channel in [False, True]:
+                self.check((1, 8, 6, 6), 8, 3, 1, 1, 2, data_type,
+                           per_channel, True)
+                self.check((1, 4, 5, 5), 4, 3, 1, 1, 4, data_type,
+                           per_channel, True)
+
+
+if __name__ == "__main__":
+    unittest.main()
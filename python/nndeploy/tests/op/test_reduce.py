@@ -0,0 +1,168 @@
+import unittest
+import numpy as np
+import nndeploy
+from nndeploy.op import functional as F
+
+from nndeploy.test_utils import createTensorFromNumpy, createNumpyFromTensor
+from nndeploy.net import build_model
+
+
+# numpy参考实现，axis为None时对全部维度归约
+np_reduce = {
+    "l1": lambda x, axis, keepdims: np.sum(np.abs(x), axis=axis,
+                                           keepdims=keepdims),
+    "l2": lambda x, axis, keepdims: np.sqrt(
+        np.sum(x * x, axis=axis, keepdims=keepdims)),
+    "log_sum": lambda x, axis, keepdims: np.log(
+        np.sum(x, axis=axis, keepdims=keepdims)),
+    "log_sum_exp": lambda x, axis, keepdims: np.log(
+        np.sum(np.exp(x), axis=axis, keepdims=keepdims)),
+    "max": lambda x, axis, keepdims: np.max(x, axis=axis, keepdims=keepdims),
+    "mean": lambda x, axis, keepdims: np.mean(x, axis=axis, keepdims=keepdims),
+    "min": lambda x, axis, keepdims: np.min(x, axis=axis, keepdims=keepdims),
+    "prod": lambda x, axis, keepdims: np.prod(x, axis=axis, keepdims=keepdims),
+    "sum": lambda x, axis, keepdims: np.sum(x, axis=axis, keepdims=keepdims),
+    "sum_square": lambda x, axis, keepdims: np.sum(x * x, axis=axis,
+                                                   keepdims=keepdims),
+}
+
+module_types = {
+    "l1": nndeploy.op.ReduceL1,
+    "l2": nndeploy.op.ReduceL2,
+    "log_sum": nndeploy.op.ReduceLogSum,
+    "log_sum_exp": nndeploy.op.ReduceLogSumExp,
+    "max": nndeploy.op.ReduceMax,
+    "mean": nndeploy.op.ReduceMean,
+    "min": nndeploy.op.ReduceMin,
+    "prod": nndeploy.op.ReduceProd,
+    "sum": nndeploy.op.ReduceSum,
+    "sum_square": nndeploy.op.ReduceSumSquare,
+}
+
+
+def random_input(shape):
+    # 取正数保证ReduceLogSum有定义，prod的结果不会溢出
+    return np.random.uniform(0.5, 1.5, shape).astype(np.float32)
+
+
+def reference(name, x, axes, keepdims, noop_with_empty_axes):
+    if not axes:
+        if noop_with_empty_axes:
+            return x
+        axes = None
+    axis = tuple(axes) if axes is not None else None
+    expect = np.asarray(np_reduce[name](x.astype(np.float64), axis,
+                                        bool(keepdims)))
+    # 归约为标量时输出形状为[1]
+    if expect.ndim == 0:
+        expect = expect.reshape([1])
+    return expect.astype(np.float32)
+
+
+class TestReduce(unittest.TestCase):
+
+    def check(self, name, shape, axes, keepdims=1, noop_with_empty_axes=0):
+        np_input = random_input(shape)
+        expect = reference(name, np_input, axes, keepdims,
+                           noop_with_empty_axes)
+        result = createNumpyFromTensor(
+            getattr(F, "reduce_" + name)(createTensorFromNumpy(np_input),
+                                         axes, keepdims, noop_with_empty_axes)
+        )
+        message = "reduce_%s shape=%s axes=%s keepdims=%d noop=%d" % (
+            name, shape, axes, keepdims, noop_with_empty_axes)
+        self.assertEqual(list(expect.shape), list(result.shape), message)
+        self.assertTrue(
+            np.allclose(expect, result, rtol=1e-04, atol=1e-05), message)
+
+    def test_keepdims(self):
+        for name in np_reduce:
+            for keepdims in [0, 1]:
+                self.check(name, (2, 3, 5, 7), [1], keepdims)
+                self.check(name, (2, 3, 5, 7), [3], keepdims)
+
+    def test_negative_axes(self):
+        for name in np_reduce:
+            for keepdims in [0, 1]:
+                self.check(name, (2, 3, 5, 7), [-1], keepdims)
+                self.check(name, (4, 33), [-2], keepdims)
+
+    def test_multiple_axes(self):
+        for name in np_reduce:
+            for keepdims in [0, 1]:
+                self.check(name, (2, 3, 5, 7), [0, 2], keepdims)
+                self.check(name, (2, 3, 5, 7), [1, -1], keepdims)
+                self.check(name, (2, 3, 5, 7), [-3, -2, -1], keepdims)
+
+    def test_empty_axes(self):
+        # 没有axes时对全部维度归约，keepdims为0时输出形状为[1]
+        for name in np_reduce:
+            for keepdims in [0, 1]:
+                self.check(name, (2, 3, 5, 7), None, keepdims)
+                self.check(name, (1030,), None, keepdims)
+
+    def test_noop_with_empty_axes(self):
+        # noop_with_empty_axes为1且没有axes时输出等于输入
+        for name in np_reduce:
+            for keepdims in [0, 1]:
+                self.check(name, (2, 3, 5), None, keepdims, 1)
+            # 给出axes时noop_with_empty_axes不起作用
+            self.check(name, (2, 3, 5), [1], 1, 1)
+
+
+input_shape = [2, 3, 5, 7]
+np_axes = np.array([-1, 1], dtype=np.int64)
+
+
+class ReduceNet(nndeploy.net.Model):
+    """
+    每种Reduce各接一个输出，奇数个由axes输入给出归约轴
+    """
+
+    def __init__(self, keepdims):
+        super().__init__()
+
+        self.weight_map = {"axes": createTensorFromNumpy(np_axes)}
+
+        # build_model只给Model的属性设置model_desc，逐个挂为属性
+        for i, name in enumerate(np_reduce):
+            if i % 2 == 0:
+                module = module_types[name](axes=[0, 2], keepdims=keepdims)
+            else:
+                module = module_types[name](keepdims=keepdims,
+                                            axes_name="axes")
+            setattr(self, "reduce_" + name, module)
+
+    @build_model
+    def construct(self, enable_net_opt=True, enable_pass=set(), disable_pass=set()):
+        data_type = nndeploy._C.base.DataType()
+        data_type.code_ = nndeploy._C.base.DataTypeCode.kDataTypeCodeFp
+        data = nndeploy._C.op.makeInput(self.model_desc, "input", data_type,
+                                        input_shape)
+        return [getattr(self, "reduce_" + name)(data) for name in np_reduce]
+
+
+class TestReduceExpr(unittest.TestCase):
+
+    def test_reduce_expr(self):
+        np_input = random_input(input_shape)
+        for keepdims in [0, 1]:
+            model = ReduceNet(keepdims)
+            model.construct()
+            model.net.setInputs({"input": createTensorFromNumpy(np_input)})
+            results = model.run()
+            self.assertEqual(len(results), len(np_reduce))
+            for i, name in enumerate(np_reduce):
+                axes = [0, 2] if i % 2 == 0 else list(np_axes)
+                expect = reference(name, np_input, axes, keepdims, 0)
+                result = createNumpyFromTensor(results[i])
+                message = "reduce_%s keepdims=%d" % (name, keepdims)
+                self.assertEqual(list(expect.shape), list(result.shape),
+                                 message)
+                self.assertTrue(
+                    np.allclose(expect, result, rtol=1e-04, atol=1e-05),
+                    message)
+
+
+if __name__ == "__main__":
+    unittest.main()
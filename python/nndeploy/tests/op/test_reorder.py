@@ -0,0 +1,140 @@
+import unittest
+import numpy as np
+import nndeploy
+from nndeploy.op import functional as F
+
+from nndeploy.test_utils import createTensorFromNumpy, createNumpyFromTensor
+
+
+DataFormat = nndeploy._C.base.DataFormat
+blocked_formats = {4: DataFormat.kDataFormatNC4HW,
+                   8: DataFormat.kDataFormatNC8HW}
+
+
+def np_blocked(x, block):
+    """
+    NCHW -> [N, ceil(C / block), H, W, block]，补齐的通道为0
+    """
+    n, c, h, w = x.shape
+    blocks = (c + block - 1) // block
+    padded = np.zeros((n, blocks * block, h, w), dtype=x.dtype)
+    padded[:, :c] = x
+    return padded.reshape(n, blocks, block, h, w).transpose(0, 1, 3, 4, 2)
+
+
+def to_blocked(x, block):
+    return F.reorder(createTensorFromNumpy(x), blocked_formats[block])
+
+
+def to_nchw(tensor):
+    return createNumpyFromTensor(
+        F.reorder(tensor, DataFormat.kDataFormatNCHW))
+
+
+def check_padding(test, tensor, channel, block, message):
+    # 分块格式的张量按存储形状导出，补齐的通道须为0
+    storage = createNumpyFromTensor(tensor)
+    tail = channel % block
+    test.assertEqual(storage.shape[1], (channel + block - 1) // block, message)
+    if tail != 0:
+        test.assertTrue(np.all(storage[:, -1, :, :, tail:] == 0), message)
+
+
+class TestReorder(unittest.TestCase):
+
+    def test_round_trip(self):
+        # 通道数不是块大小整数倍时最后一块有补齐的通道
+        for block in blocked_formats:
+            for c in [1, 3, 5, 6, 13, 16]:
+                x = np.random.uniform(-1, 1, (2, c, 5, 7)).astype(np.float32)
+                blocked = to_blocked(x, block)
+                message = "block=%d c=%d" % (block, c)
+                self.assertEqual(list(blocked.shape), [2, c, 5, 7], message)
+                self.assertTrue(
+                    np.array_equal(np_blocked(x, block),
+                                   createNumpyFromTensor(blocked)), message)
+                self.assertTrue(np.array_equal(x, to_nchw(blocked)), message)
+
+    def test_block_to_block(self):
+        # NC4HW与NC8HW之间直接转换
+        x = np.random.uniform(-1, 1, (2, 13, 6, 6)).astype(np.float32)
+        for src, dst in [(4, 8), (8, 4)]:
+            blocked = F.reorder(to_blocked(x, src), blocked_formats[dst])
+            message = "block %d -> %d" % (src, dst)
+            self.assertTrue(
+                np.array_equal(np_blocked(x, dst),
+                               createNumpyFromTensor(blocked)), message)
+
+
+class TestBlockedOp(unittest.TestCase):
+    """
+    分块格式的计算结果转回NCHW后与NCHW的计算结果比较，
+    并检查输出补齐的通道仍为0
+    """
+
+    def check(self, name, func, inputs, channel, rtol=1e-05, atol=1e-06):
+        expect = createNumpyFromTensor(
+            func(*[createTensorFromNumpy(x) for x in inputs]))
+        for block in blocked_formats:
+            message = "%s block=%d" % (name, block)
+            blocked = func(*[to_blocked(x, block) for x in inputs])
+            check_padding(self, blocked, channel, block, message)
+            self.assertTrue(
+                np.allclose(expect, to_nchw(blocked), rtol=rtol, atol=atol),
+                message)
+
+    def test_conv(self):
+        for c in [3, 13]:
+            x = np.random.uniform(-1, 1, (2, c, 11, 11)).astype(np.float32)
+            for oc in [5, 16]:
+                w = np.random.uniform(-0.5, 0.5, (oc, c, 3, 3)).astype(
+                    np.float32)
+                b = np.random.uniform(-0.5, 0.5, (oc,)).astype(np.float32)
+                self.check("conv c=%d oc=%d" % (c, oc),
+                           lambda t: F.conv(t, createTensorFromNumpy(w),
+                                            createTensorFromNumpy(b),
+                                            padding=1),
+                           [x], oc, 1e-04, 1e-05)
+            # depthwise
+            w = np.random.uniform(-0.5, 0.5, (c, 1, 3, 3)).astype(np.float32)
+            self.check("depthwise conv c=%d" % c,
+                       lambda t: F.conv(t, createTensorFromNumpy(w),
+                                        stride=2, padding=1, groups=c),
+                       [x], c, 1e-04, 1e-05)
+
+    def test_pool(self):
+        x = np.random.uniform(-1, 1, (2, 13, 12, 12)).astype(np.float32)
+        self.check("maxpool", lambda t: F.maxpool(t, 3, 2, 1), [x], 13)
+        self.check("averagepool", lambda t: F.averagepool(t, 2, 2), [x], 13)
+        self.check("global_averagepool", F.global_averagepool, [x], 13)
+
+    def test_unary(self):
+        # f(0)不为0的函数也要保持补齐的通道为0
+        x = np.random.uniform(-2, 2, (2, 13, 6, 6)).astype(np.float32)
+        for name in ["relu", "sigmoid", "exp", "tanh", "gelu", "silu"]:
+            self.check(name, getattr(F, name), [x], 13)
+
+    def test_binary(self):
+        a = np.random.uniform(-1, 1, (2, 13, 6, 6)).astype(np.float32)
+        b = np.random.uniform(-1, 1, (2, 13, 6, 6)).astype(np.float32)
+        self.check("add", F.add, [a, b], 13)
+        # 与标量相加，补齐的通道得到标量值后重新写0
+        scalar = createTensorFromNumpy(np.array([1.5], dtype=np.float32))
+        self.check("add scalar", lambda t: F.add(t, scalar), [a], 13)
+
+    def test_concat(self):
+        a = np.random.uniform(-1, 1, (2, 5, 6, 6)).astype(np.float32)
+        b = np.random.uniform(-1, 1, (2, 6, 6, 6)).astype(np.float32)
+        c = np.random.uniform(-1, 1, (2, 8, 6, 6)).astype(np.float32)
+        # 通道不对齐时逐通道拷贝
+        self.check("concat unaligned", lambda x, y: F.concat([x, y], 1),
+                   [a, b], 11)
+        # 通道按块对齐时按存储形状拼接
+        self.check("concat aligned", lambda x, y: F.concat([x, y], 1),
+                   [c, c], 16)
+        self.check("concat axis=2", lambda x, y: F.concat([x, y], 2),
+                   [a, a], 5)
+
+
+if __name__ == "__main__":
+    unittest.main()
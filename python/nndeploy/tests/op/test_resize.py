@@ -0,0 +1,180 @@
+import math
+import unittest
+import numpy as np
+import nndeploy
+from nndeploy.op import functional as F
+
+from nndeploy.test_utils import (
+    createTensorFromNumpy,
+    createNumpyFromTensor,
+)
+
+
+def origin_coord(coord_mode, x, scale, input_size, output_size):
+    """
+    与kernel一致按float计算，避免取整的边界处结果不同
+    """
+    f32 = np.float32
+    x = f32(x)
+    if coord_mode == "half_pixel":
+        return (x + f32(0.5)) / scale - f32(0.5)
+    if coord_mode == "half_pixel_symmetric":
+        adjustment = f32(output_size) / (scale * f32(input_size))
+        offset = f32(input_size) / f32(2.0) * (f32(1.0) - adjustment)
+        return offset + (x + f32(0.5)) / scale - f32(0.5)
+    if coord_mode == "pytorch_half_pixel":
+        if output_size > 1:
+            return (x + f32(0.5)) / scale - f32(0.5)
+        return f32(0.0)
+    if coord_mode == "align_corners":
+        if output_size == 1:
+            return f32(0.0)
+        return x * f32(input_size - 1) / f32(output_size - 1)
+    if coord_mode == "asymmetric":
+        return x / scale
+    raise ValueError(coord_mode)
+
+
+def nearest_index(nearest_mode, x):
+    if nearest_mode == "floor":
+        return math.floor(x)
+    if nearest_mode == "ceil":
+        return math.ceil(x)
+    if x == math.floor(x) + 0.5:
+        return math.floor(x) + (1 if nearest_mode == "round_prefer_ceil" else 0)
+    return int(round(x))
+
+
+def cubic_coeffs(ratio, a):
+    x = [1.0 + ratio, ratio, 1.0 - ratio, 2.0 - ratio]
+    return [
+        ((a * x[0] - 5 * a) * x[0] + 8 * a) * x[0] - 4 * a,
+        ((a + 2) * x[1] - (a + 3)) * x[1] * x[1] + 1,
+        ((a + 2) * x[2] - (a + 3)) * x[2] * x[2] + 1,
+        ((a * x[3] - 5 * a) * x[3] + 8 * a) * x[3] - 4 * a,
+    ]
+
+
+def axis_matrix(input_size, output_size, scale, mode, coord_mode, nearest_mode,
+                cubic_coeff_a, exclude_outside):
+    """
+    ONNX Resize单个轴的插值矩阵[output_size, input_size]，越界的下标取边界值
+    """
+    matrix = np.zeros([output_size, input_size], dtype=np.float64)
+    for j in range(output_size):
+        x = origin_coord(coord_mode, j, scale, input_size, output_size)
+        if mode == "nearest":
+            i = min(max(nearest_index(nearest_mode, x), 0), input_size - 1)
+            matrix[j, i] = 1.0
+            continue
+        x0 = math.floor(x)
+        ratio = float(x) - x0
+        if mode == "linear":
+            index = [x0, x0 + 1]
+            weight = [1.0 - ratio, ratio]
+        else:
+            index = [x0 - 1, x0, x0 + 1, x0 + 2]
+            weight = cubic_coeffs(ratio, cubic_coeff_a)
+        if exclude_outside:
+            weight = [
+                w if 0 <= i < input_size else 0.0 for i, w in zip(index, weight)
+            ]
+            total = sum(weight)
+            weight = [w / total for w in weight]
+        for i, w in zip(index, weight):
+            matrix[j, min(max(i, 0), input_size - 1)] += w
+    return matrix
+
+
+def resize_reference(x, scales, mode="nearest", coord_mode="half_pixel",
+                     nearest_mode="round_prefer_floor", cubic_coeff_a=-0.75,
+                     exclude_outside=0):
+    result = x.astype(np.float64)
+    for axis, scale in enumerate(scales):
+        input_size = result.shape[axis]
+        output_size = int(math.floor(np.float32(input_size) * np.float32(scale)))
+        if scale == 1.0:
+            continue
+        matrix = axis_matrix(input_size, output_size, np.float32(scale), mode,
+                             coord_mode, nearest_mode, cubic_coeff_a,
+                             exclude_outside)
+        result = np.moveaxis(
+            np.tensordot(matrix, np.moveaxis(result, axis, 0), axes=1), 0, axis
+        )
+    return result
+
+
+COORD_MODES = [
+    "half_pixel",
+    "pytorch_half_pixel",
+    "align_corners",
+    "asymmetric",
+    "half_pixel_symmetric",
+]
+
+
+class TestResize(unittest.TestCase):
+
+    def check(self, np_input, scales, **kwargs):
+        expect = resize_reference(np_input, scales, **kwargs)
+        coord_mode = kwargs.pop("coord_mode", "half_pixel")
+        nndeploy_result = F.resize(
+            createTensorFromNumpy(np_input),
+            createTensorFromNumpy(np.array(scales, dtype=np.float32)),
+            coordinate_transformation_mode=coord_mode,
+            **kwargs
+        )
+        result = createNumpyFromTensor(nndeploy_result)
+        self.assertEqual(list(result.shape), list(expect.shape))
+        self.assertTrue(
+            np.allclose(expect, result, rtol=1e-04, atol=1e-05),
+            "scales=%s coord_mode=%s %s" % (scales, coord_mode, kwargs),
+        )
+
+    def setUp(self):
+        self.np_input = np.random.uniform(-1, 1, [2, 3, 7, 9]).astype(np.float32)
+
+    def test_resize_nearest(self):
+        for coord_mode in COORD_MODES:
+            for nearest_mode in [
+                "round_prefer_floor",
+                "round_prefer_ceil",
+                "floor",
+                "ceil",
+            ]:
+                for scales in [[1, 1, 2, 2], [1, 1, 0.5, 0.6], [1, 1, 1.7, 2.3]]:
+                    self.check(
+                        self.np_input,
+                        scales,
+                        mode="nearest",
+                        coord_mode=coord_mode,
+                        nearest_mode=nearest_mode,
+                    )
+
+    def test_resize_linear(self):
+        for coord_mode in COORD_MODES:
+            for scales in [[1, 1, 2, 2], [1, 1, 0.5, 0.6], [1, 1, 1.7, 2.3]]:
+                self.check(
+                    self.np_input, scales, mode="linear", coord_mode=coord_mode
+                )
+        # 外层轴(inner > 1)的插值
+        self.check(self.np_input, [1, 2, 1.5, 1], mode="linear")
+
+    def test_resize_cubic(self):
+        for coord_mode in COORD_MODES:
+            for scales in [[1, 1, 2, 2], [1, 1, 0.5, 0.6], [1, 1, 1.7, 2.3]]:
+                self.check(
+                    self.np_input, scales, mode="cubic", coord_mode=coord_mode
+                )
+        for exclude_outside in [0, 1]:
+            self.check(
+                self.np_input,
+                [1, 1, 2.5, 1.5],
+                mode="cubic",
+                cubic_coeff_a=-0.5,
+                exclude_outside=exclude_outside,
+            )
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -1,9 +1,18 @@
 import unittest
 import numpy as np
-import torch
 import nndeploy
+from nndeploy.op import functional as F
 
-from nndeploy.test_utils import createTensorFromNumpy, createNumpyFromTensor, device_name_to_code
+from nndeploy.test_utils import (
+    createTensorFromNumpy,
+    createNumpyFromTensor,
+    device_name_to_code,
+)
+
+
+def cuda_available():
+    device_type = nndeploy._C.base.DeviceType(device_name_to_code["cuda"], 0)
+    return nndeploy._C.device.getDevice(device_type) is not None
 
 
 def rsqrt_cpu(x):
@@ -12,16 +21,59 @@ def rsqrt_cpu(x):
 
 def CPU_fused_resid_and_RMSNorm(h_decoder_out, h_scale, eps, hidden_units, num_tokens):
     for b in range(num_tokens):
-        mean = np.mean(
-            h_decoder_out[b * hidden_units:(b + 1) * hidden_units])  # 计算均值
+        row = h_decoder_out[b * hidden_units:(b + 1) * hidden_units]
+        mean = np.mean(row * row)  # 计算平方的均值
         inv_fenmu = rsqrt_cpu(mean + eps)  # 计算逆平方根
         h_decoder_out[b * hidden_units:(b + 1) *
                       hidden_units] *= inv_fenmu * h_scale  # 缩放
 
 
+def rms_norm_reference(x, weight, residual=None, eps=1e-6):
+    h = x.astype(np.float64)
+    if residual is not None:
+        h = h + residual.astype(np.float64)
+    rms = np.sqrt(np.mean(h * h, axis=-1, keepdims=True) + eps)
+    return h / rms * weight.astype(np.float64)
+
+
 class TestRmsNormOp(unittest.TestCase):
 
+    def check(self, shape, with_residual):
+        np_input = np.random.uniform(-3, 5, shape).astype(np.float32)
+        np_weight = np.random.random(shape[-1]).astype(np.float32)
+        np_residual = None
+        residual = None
+        if with_residual:
+            np_residual = np.random.uniform(-1, 1, shape).astype(np.float32)
+            residual = createTensorFromNumpy(np_residual)
+
+        expect = rms_norm_reference(np_input, np_weight, np_residual)
+
+        nndeploy_result = F.rms_norm(
+            createTensorFromNumpy(np_input),
+            createTensorFromNumpy(np_weight),
+            residual,
+        )
+
+        self.assertTrue(
+            np.allclose(
+                expect,
+                createNumpyFromTensor(nndeploy_result),
+                rtol=1e-05,
+                atol=1e-06,
+            ),
+            "shape=%s with_residual=%s" % (shape, with_residual),
+        )
+
     def test_rms_norm(self):
+        self.check((32, 4096), False)
+
+    def test_rms_norm_residual(self):
+        self.check((32, 4096), True)
+
+    @unittest.skipUnless(cuda_available(), "cuda is not available")
+    def test_rms_norm_cuda(self):
+        # cuda kernel的第三个输入为残差的输出buffer，写入归一化之前的输入
         num_tokens = 32
         hidden_units = 4096
 
@@ -39,10 +91,16 @@ class TestRmsNormOp(unittest.TestCase):
         tensor2 = createTensorFromNumpy(np_in2).to(device_name_to_code['cuda'])
         tensor3 = createTensorFromNumpy(np_in3).to(device_name_to_code['cuda'])
 
-        nndeploy_result = nndeploy.op.rms_norm(tensor1, tensor2, tensor3)
+        nndeploy_result = F.rms_norm(tensor1, tensor2, tensor3)
 
         self.assertTrue(np.allclose(np_out, createNumpyFromTensor(nndeploy_result), rtol=1e-05, atol=1e-08))
 
+    def test_rms_norm_tail(self):
+        # 归一化维度不是向量宽度的整数倍
+        for shape in [(2, 7, 77), (5, 1), (3, 1000)]:
+            self.check(shape, False)
+            self.check(shape, True)
+
 
-if __name__ == '__main__':
+if __name__ == "__main__":
     unittest.main()
@@ -0,0 +1,95 @@
+import unittest
+import numpy as np
+import torch
+import nndeploy
+from nndeploy.op import functional as F
+
+from nndeploy.test_utils import (
+    createTensorFromNumpy,
+    createNumpyFromTensor,
+    device_name_to_code,
+)
+
+
+def rotary_cache(max_position, rotary_dim, theta=10000.0):
+    inv_freq = 1.0 / (theta ** (np.arange(0, rotary_dim, 2) / rotary_dim))
+    angle = np.outer(np.arange(max_position), inv_freq)
+    return np.cos(angle).astype(np.float32), np.sin(angle).astype(np.float32)
+
+
+def torch_rotary_embedding(x, cos, sin, interleaved=False):
+    x = torch.tensor(x)
+    cos = torch.tensor(cos)
+    sin = torch.tensor(sin)
+    rotary_dim = cos.shape[-1] * 2
+    x_rot, x_pass = x[..., :rotary_dim], x[..., rotary_dim:]
+    if interleaved:
+        x0, x1 = x_rot[..., 0::2], x_rot[..., 1::2]
+    else:
+        x0, x1 = x_rot.chunk(2, dim=-1)
+    y0 = x0 * cos - x1 * sin
+    y1 = x1 * cos + x0 * sin
+    if interleaved:
+        y = torch.stack((y0, y1), dim=-1).flatten(-2)
+    else:
+        y = torch.cat((y0, y1), dim=-1)
+    return torch.cat((y, x_pass), dim=-1)
+
+
+class TestRotaryEmbeddingOp(unittest.TestCase):
+
+    def test_rotary_embedding(self):
+        np_x = np.random.random((2, 8, 77, 64)).astype(np.float32)
+        np_cos, np_sin = rotary_cache(77, 64)
+
+        torch_result = torch_rotary_embedding(np_x, np_cos, np_sin)
+
+        nndeploy_result = F.rotary_embedding(
+            createTensorFromNumpy(np_x),
+            createTensorFromNumpy(np_cos),
+            createTensorFromNumpy(np_sin),
+        )
+
+        self.assertTrue(
+            np.allclose(
+                torch_result.detach().numpy(),
+                createNumpyFromTensor(nndeploy_result),
+                rtol=1e-03,
+                atol=1e-05,
+            )
+        )
+
+    def test_rotary_embedding_position_ids(self):
+        np_x = np.random.random((2, 5, 4 * 32)).astype(np.float32)
+        np_cos, np_sin = rotary_cache(128, 16)
+        np_position_ids = np.array([[3, 4, 5, 6, 7], [60, 61, 62, 63, 64]], dtype=np.int64)
+
+        # [batch, seq, 1, rotary_dim / 2]，按头广播
+        cos = np_cos[np_position_ids][:, :, None, :]
+        sin = np_sin[np_position_ids][:, :, None, :]
+        torch_result = torch_rotary_embedding(
+            np_x.reshape(2, 5, 4, 32), cos, sin, interleaved=True
+        ).reshape(2, 5, 128)
+
+        nndeploy_result = F.rotary_embedding(
+            createTensorFromNumpy(np_x),
+            createTensorFromNumpy(np_cos),
+            createTensorFromNumpy(np_sin),
+            createTensorFromNumpy(np_position_ids),
+            interleaved=True,
+            rotary_embedding_dim=16,
+            num_heads=4,
+        )
+
+        self.assertTrue(
+            np.allclose(
+                torch_result.detach().numpy(),
+                createNumpyFromTensor(nndeploy_result),
+                rtol=1e-03,
+                atol=1e-05,
+            )
+        )
+
+
+if __name__ == "__main__":
+    unittest.main()
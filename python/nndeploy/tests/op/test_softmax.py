@@ -0,0 +1,81 @@
+import unittest
+import numpy as np
+import torch
+import nndeploy
+from nndeploy.op import functional as F
+
+from nndeploy.test_utils import (
+    createTensorFromNumpy,
+    createNumpyFromTensor,
+)
+
+
+class TestSoftmax(unittest.TestCase):
+
+    def check(self, np_input, axis):
+        torch_result = torch.nn.functional.softmax(
+            torch.tensor(np_input.astype(np.float64)), dim=axis
+        )
+
+        nndeploy_result = F.softmax(createTensorFromNumpy(np_input), axis)
+
+        self.assertTrue(
+            np.allclose(
+                torch_result.numpy(),
+                createNumpyFromTensor(nndeploy_result),
+                rtol=1e-05,
+                atol=1e-06,
+                equal_nan=True,
+            )
+        )
+
+    def test_softmax_last_axis(self):
+        # 超过一个块(2048)且有尾部
+        np_input = np.random.uniform(-5, 5, [3, 5000]).astype(np.float32)
+        self.check(np_input, -1)
+        self.check(np_input, 1)
+
+    def test_softmax_non_last_axis(self):
+        # inner方向超过一个分块(256)，axis方向超过一个行块(32)，都有尾部
+        np_input = np.random.uniform(-5, 5, [2, 70, 300]).astype(np.float32)
+        self.check(np_input, 1)
+        self.check(np_input, 0)
+        self.check(np_input, -2)
+
+        np_input = np.random.uniform(-5, 5, [3, 4, 5, 6]).astype(np.float32)
+        for axis in range(-4, 4):
+            self.check(np_input, axis)
+
+    def test_softmax_large_input(self):
+        np_input = np.random.uniform(-1e4, 1e4, [4, 3000]).astype(np.float32)
+        self.check(np_input, -1)
+        self.check(np_input, 0)
+
+        np_input = np.random.uniform(-1e4, 1e4, [2, 40, 300]).astype(np.float32)
+        self.check(np_input, 1)
+
+    def test_softmax_negative_input(self):
+        np_input = np.random.uniform(-1e30, -1e29, [4, 3000]).astype(np.float32)
+        self.check(np_input, -1)
+
+        np_input = np.random.uniform(-90, -80, [2, 40, 300]).astype(np.float32)
+        self.check(np_input, 1)
+
+    def test_softmax_inf(self):
+        # 被mask的前缀超过一个块，整行为-inf时输出nan
+        np_input = np.random.uniform(-3, 3, [3, 5000]).astype(np.float32)
+        np_input[0, :3000] = -np.inf
+        np_input[1, ::2] = -np.inf
+        np_input[2, :] = -np.inf
+        self.check(np_input, -1)
+
+        # 非最内层axis，前面的行块整列为-inf
+        np_input = np.random.uniform(-3, 3, [2, 40, 300]).astype(np.float32)
+        np_input[0, :35, :] = -np.inf
+        np_input[0, 35:, ::2] = -np.inf
+        np_input[1, :, 7] = -np.inf
+        self.check(np_input, 1)
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,54 @@
+import unittest
+import numpy as np
+import torch
+import nndeploy
+from nndeploy.op import functional as F
+
+from nndeploy.test_utils import (
+    createTensorFromNumpy,
+    createNumpyFromTensor,
+    device_name_to_code,
+)
+
+
+class TestSwiGLUOp(unittest.TestCase):
+
+    def test_swiglu(self):
+        np_gate = np.random.uniform(-4, 4, (2, 77, 1000)).astype(np.float32)
+        np_up = np.random.random((2, 77, 1000)).astype(np.float32)
+
+        torch_result = torch.nn.functional.silu(torch.tensor(np_gate)) * torch.tensor(np_up)
+
+        nndeploy_result = F.swiglu(
+            createTensorFromNumpy(np_gate), createTensorFromNumpy(np_up)
+        )
+
+        self.assertTrue(
+            np.allclose(
+                torch_result.detach().numpy(),
+                createNumpyFromTensor(nndeploy_result),
+                rtol=1e-03,
+                atol=1e-05,
+            )
+        )
+
+    def test_swiglu_fused_gate_up(self):
+        np_input = np.random.uniform(-4, 4, (3, 17, 2 * 688)).astype(np.float32)
+
+        gate, up = torch.tensor(np_input).chunk(2, dim=-1)
+        torch_result = torch.nn.functional.silu(gate) * up
+
+        nndeploy_result = F.swiglu(createTensorFromNumpy(np_input))
+
+        self.assertTrue(
+            np.allclose(
+                torch_result.detach().numpy(),
+                createNumpyFromTensor(nndeploy_result),
+                rtol=1e-03,
+                atol=1e-05,
+            )
+        )
+
+
+if __name__ == "__main__":
+    unittest.main()
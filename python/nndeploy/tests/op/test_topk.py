@@ -0,0 +1,109 @@
+import unittest
+import numpy as np
+import nndeploy
+from nndeploy.op import functional as F
+
+from nndeploy.test_utils import createTensorFromNumpy, createNumpyFromTensor
+
+
+def np_topk(x, k, axis, largest):
+    """
+    全排序得到的参考结果，稳定排序保证值相同时下标小的在前
+    """
+    key = -x if largest else x
+    indices = np.argsort(key, axis=axis, kind="stable")
+    indices = np.take(indices, np.arange(k), axis=axis)
+    return np.take_along_axis(x, indices, axis=axis), indices
+
+
+def random_input(shape, ties):
+    x = np.random.uniform(-3, 3, shape).astype(np.float32)
+    # 取整后每行有大量相同的值
+    return np.floor(x * 1.5) if ties else x
+
+
+class TestTopK(unittest.TestCase):
+
+    def check(self, shape, k, axis=-1, largest=1, sorted=1, ties=False):
+        np_input = random_input(shape, ties)
+        expect_values, expect_indices = np_topk(np_input, k, axis, largest)
+        values, indices = F.topk(createTensorFromNumpy(np_input), k, axis,
+                                 largest, sorted)
+        values = createNumpyFromTensor(values)
+        indices = createNumpyFromTensor(indices)
+        message = "shape=%s k=%d axis=%d largest=%d sorted=%d ties=%s" % (
+            shape, k, axis, largest, sorted, ties)
+        self.assertEqual(indices.dtype, np.int64, message)
+        self.assertEqual(list(expect_indices.shape), list(indices.shape),
+                         message)
+        # values与indices对应
+        self.assertTrue(
+            np.array_equal(np.take_along_axis(np_input, indices, axis=axis),
+                           values), message)
+        if not sorted:
+            # 不排序时只比较选出的集合
+            expect_indices = np.sort(expect_indices, axis=axis)
+            indices = np.sort(indices, axis=axis)
+        self.assertTrue(np.array_equal(expect_indices, indices), message)
+
+    def test_topk(self):
+        for k in [1, 5, 37]:
+            # 行长超过候选初值，走阈值预筛选
+            self.check((3, 1000), k)
+            self.check((2, 40), k)
+        # k等于行长
+        self.check((4, 40), 40, axis=1)
+
+    def test_topk_ties(self):
+        for largest in [1, 0]:
+            for k in [1, 5, 37]:
+                self.check((3, 1000), k, largest=largest, ties=True)
+                self.check((2, 300, 4), k, 1, largest, ties=True)
+
+    def test_topk_smallest(self):
+        for k in [1, 5, 37]:
+            self.check((3, 1000), k, largest=0)
+            self.check((2, 300, 4), k, 1, largest=0)
+
+    def test_topk_inner(self):
+        # axis不是最后一维，inner不为1
+        for largest in [1, 0]:
+            self.check((2, 300, 4), 5, 1, largest)
+            self.check((2, 5, 3, 7), 3, 1, largest)
+            self.check((5, 2, 9), 2, 0, largest)
+            self.check((5, 2, 9), 2, -3, largest)
+
+    def test_topk_unsorted(self):
+        for largest in [1, 0]:
+            for ties in [False, True]:
+                self.check((3, 1000), 37, -1, largest, 0, ties)
+                self.check((2, 300, 4), 5, 1, largest, 0, ties)
+
+
+class TestSoftmaxTopK(unittest.TestCase):
+
+    def check(self, shape, k, axis=-1):
+        np_input = np.random.uniform(-8, 8, shape).astype(np.float32)
+        # 先softmax再topk
+        prob = F.softmax(createTensorFromNumpy(np_input), axis)
+        expect_values, expect_indices = F.topk(prob, k, axis)
+        values, indices = F.softmax_topk(createTensorFromNumpy(np_input), k,
+                                         axis)
+        message = "shape=%s k=%d axis=%d" % (shape, k, axis)
+        self.assertTrue(
+            np.array_equal(createNumpyFromTensor(expect_indices),
+                           createNumpyFromTensor(indices)), message)
+        self.assertTrue(
+            np.allclose(createNumpyFromTensor(expect_values),
+                        createNumpyFromTensor(values), rtol=1e-05, atol=1e-06),
+            message)
+
+    def test_softmax_topk(self):
+        self.check((4, 1000), 5)
+        self.check((2, 10, 6), 3, 1)
+        # k等于类别数时得到整行的概率
+        self.check((3, 17), 17, 1)
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,93 @@
+import itertools
+import unittest
+import numpy as np
+import nndeploy
+from nndeploy.op import functional as F
+
+from nndeploy.test_utils import (
+    createTensorFromNumpy,
+    createNumpyFromTensor,
+)
+
+_C = nndeploy._C
+
+# 元素大小为1/2/4/8字节
+DATA_TYPES = [np.int8, np.float16, np.float32, np.int64]
+
+
+class TestTranspose(unittest.TestCase):
+
+    def setUp(self):
+        self.hardware = _C.base.getHardwareCpuIsa()
+
+    def tearDown(self):
+        _C.base.setCpuIsa(self.hardware)
+
+    def check(self, np_input, perm):
+        expect = np.transpose(np_input, perm)
+        nndeploy_result = F.transpose(createTensorFromNumpy(np_input), perm)
+        result = createNumpyFromTensor(nndeploy_result)
+        self.assertEqual(list(result.shape), list(expect.shape))
+        self.assertTrue(
+            np.array_equal(expect, result),
+            "shape=%s perm=%s dtype=%s" % (np_input.shape, perm, np_input.dtype),
+        )
+
+    def random_input(self, shape, data_type):
+        return (np.random.random(shape) * 100).astype(data_type)
+
+    def test_transpose_all_perms(self):
+        # rank 1~4的所有排列，包含大小为1的维度
+        for shape in [[7], [5, 9], [3, 1, 6], [2, 3, 4, 5], [2, 1, 5, 3]]:
+            for data_type in DATA_TYPES:
+                np_input = self.random_input(shape, data_type)
+                for perm in itertools.permutations(range(len(shape))):
+                    self.check(np_input, list(perm))
+
+    def test_transpose_high_rank(self):
+        np.random.seed(0)
+        for shape in [[2, 3, 4, 5, 6], [2, 3, 2, 3, 2, 3]]:
+            for data_type in DATA_TYPES:
+                np_input = self.random_input(shape, data_type)
+                for _ in range(10):
+                    self.check(np_input, list(np.random.permutation(len(shape))))
+
+    def test_transpose_default_perm(self):
+        np_input = self.random_input([2, 3, 4, 5], np.float32)
+        nndeploy_result = F.transpose(createTensorFromNumpy(np_input))
+        self.assertTrue(
+            np.array_equal(np_input.T, createNumpyFromTensor(nndeploy_result))
+        )
+
+    def test_transpose_tile_tails(self):
+        # 2D转置的8x8/4x4寄存器分块与64x64 cache块都有不完整的尾部
+        shapes = [[67, 131], [3, 64, 72], [2, 129, 9], [5, 8, 4, 17]]
+        if self.hardware == _C.base.CpuIsa.kCpuIsaNeon:
+            isa_list = [_C.base.CpuIsa.kCpuIsaScalar, self.hardware]
+        else:
+            isa_list = [
+                isa
+                for isa in [
+                    _C.base.CpuIsa.kCpuIsaScalar,
+                    _C.base.CpuIsa.kCpuIsaSse4,
+                    _C.base.CpuIsa.kCpuIsaAvx2,
+                ]
+                if _C.base.isCpuIsaSupported(isa)
+            ]
+        for isa in isa_list:
+            _C.base.setCpuIsa(isa)
+            for shape in shapes:
+                for data_type in DATA_TYPES:
+                    np_input = self.random_input(shape, data_type)
+                    rank = len(shape)
+                    # 最内层维度改变(2D转置)与不变(行拷贝)的排列
+                    self.check(np_input, list(range(rank))[::-1])
+                    self.check(np_input, [rank - 1] + list(range(rank - 1)))
+                    if rank > 2:
+                        self.check(
+                            np_input, [1, 0] + list(range(2, rank))
+                        )
+
+
+if __name__ == "__main__":
+    unittest.main()
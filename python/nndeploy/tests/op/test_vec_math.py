@@ -0,0 +1,113 @@
+import math
+import unittest
+import numpy as np
+import nndeploy
+from nndeploy.op import functional as F
+
+from nndeploy.test_utils import (
+    createTensorFromNumpy,
+    createNumpyFromTensor,
+)
+
+_C = nndeploy._C
+
+X86_ISA = [
+    _C.base.CpuIsa.kCpuIsaScalar,
+    _C.base.CpuIsa.kCpuIsaSse4,
+    _C.base.CpuIsa.kCpuIsaAvx2,
+    _C.base.CpuIsa.kCpuIsaAvx512,
+    _C.base.CpuIsa.kCpuIsaAvx512Vnni,
+]
+
+_erf = np.vectorize(math.erf, otypes=[np.float64])
+
+
+def ref_sigmoid(x):
+    return 1.0 / (1.0 + np.exp(-x))
+
+
+def ref_gelu(x):
+    return 0.5 * x * (1.0 + _erf(x / math.sqrt(2.0)))
+
+
+# 名称: (函数, 双精度参考, 检查的输入范围, vec_math.h中给出的ulp上界)
+CASES = {
+    "exp": (F.exp, np.exp, (-87.0, 88.7), 2),
+    "sigmoid": (F.sigmoid, ref_sigmoid, (-87.0, 100.0), 3),
+    "silu": (F.silu, lambda x: x * ref_sigmoid(x), (-87.0, 100.0), 4),
+    "tanh": (F.tanh, np.tanh, (-100.0, 100.0), 2),
+    "erf": (F.erf, _erf, (-100.0, 100.0), 3),
+    "gelu": (F.gelu, ref_gelu, (-1.0, 100.0), 5),
+}
+
+
+def max_ulp(result, x, ref, lo, hi):
+    mask = (x >= lo) & (x <= hi)
+    expect = ref(x[mask].astype(np.float64))
+    got = result[mask].astype(np.float64)
+    # 结果为非规格化数时只保证绝对误差
+    normal = np.abs(expect) >= np.finfo(np.float32).tiny
+    ulp = np.spacing(np.abs(expect[normal]).astype(np.float32)).astype(np.float64)
+    return np.max(np.abs(got[normal] - expect[normal]) / ulp)
+
+
+class TestVecMath(unittest.TestCase):
+
+    def setUp(self):
+        self.hardware = _C.base.getHardwareCpuIsa()
+        # 覆盖多项式各区间、向量主体与尾部
+        self.np_input = np.concatenate(
+            [
+                np.linspace(-100, 100, 200003),
+                np.linspace(-1, 1, 100003),
+                np.random.uniform(-10, 10, 50001),
+            ]
+        ).astype(np.float32)
+
+    def tearDown(self):
+        _C.base.setCpuIsa(self.hardware)
+
+    def supported_levels(self):
+        if self.hardware in X86_ISA:
+            return X86_ISA[: X86_ISA.index(self.hardware) + 1]
+        return [_C.base.CpuIsa.kCpuIsaScalar, self.hardware]
+
+    def test_ulp_bound(self):
+        for isa in self.supported_levels():
+            _C.base.setCpuIsa(isa)
+            for name, (func, ref, (lo, hi), bound) in CASES.items():
+                nndeploy_result = createNumpyFromTensor(
+                    func(createTensorFromNumpy(self.np_input))
+                )
+                ulp = max_ulp(nndeploy_result, self.np_input, ref, lo, hi)
+                self.assertLessEqual(ulp, bound, "%s isa=%s" % (name, isa))
+
+    def test_special_values(self):
+        np_input = np.array(
+            [np.nan, np.inf, -np.inf, 0.0, -0.0, 200.0, -200.0], dtype=np.float32
+        )
+        expect = {
+            "exp": [np.nan, np.inf, 0.0, 1.0, 1.0, np.inf, 0.0],
+            "sigmoid": [np.nan, 1.0, 0.0, 0.5, 0.5, 1.0, 0.0],
+            "tanh": [np.nan, 1.0, -1.0, 0.0, 0.0, 1.0, -1.0],
+            "erf": [np.nan, 1.0, -1.0, 0.0, 0.0, 1.0, -1.0],
+        }
+        for isa in self.supported_levels():
+            _C.base.setCpuIsa(isa)
+            for name, values in expect.items():
+                func = CASES[name][0]
+                nndeploy_result = createNumpyFromTensor(
+                    func(createTensorFromNumpy(np_input))
+                )
+                self.assertTrue(
+                    np.array_equal(
+                        nndeploy_result,
+                        np.array(values, dtype=np.float32),
+                        equal_nan=True,
+                    ),
+                    "%s isa=%s" % (name, isa),
+                )
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -19,14 +19,18 @@ def generate_permutations(shapes, data_types, devices):
 class TestNumpy(unittest.TestCase):
 
     def test_from_to_np(self):
-        shape_list = [[32], [32, 32], [8, 16, 16], [4, 8, 8, 8]]
-        data_types = ['float32', 'float16']
+        shape_list = [[32], [32, 32], [8, 16, 16], [4, 8, 8, 8],
+                      [2, 3, 4, 5, 6], [2, 2, 3, 2, 3, 2]]
+        data_types = list(str_to_np_data_types.keys())
         devices = ['cpu']
 
         for shape, data_type, device in generate_permutations(shape_list, data_types, devices):
-            np_array = np.random.random(shape).astype(
+            np_array = (np.random.random(shape) * 100).astype(
                 str_to_np_data_types[data_type])
             tensor = createTensorFromNumpy(np_array)
+            # 数值类型与数据都保持不变
+            self.assertEqual(np_array.dtype, np.array(tensor).dtype,
+                             msg=f"Data type changed in case: shape={shape}, data_type={data_type}, device={device}")
             self.assertTrue(np.allclose(np_array, np.array(tensor), rtol=1e-05, atol=1e-08),
                             msg=f"Arrays are not close enough in case: shape={shape}, data_type={data_type}, device={device}")
 
@@ -1,5 +1,6 @@
 
 #include "nndeploy/base/common.h"
+#include "nndeploy/base/cpu_isa.h"
 #include "nndeploy/base/status.h"
 #include "nndeploy_api_registry.h"
 
@@ -12,7 +13,9 @@ NNDEPLOY_API_PYBIND11_MODULE("base", m) {
       .value("kDataTypeCodeUint", base::DataTypeCode::kDataTypeCodeUint)
       .value("kDataTypeCodeInt", base::DataTypeCode::kDataTypeCodeInt)
       .value("kDataTypeCodeFp", base::DataTypeCode::kDataTypeCodeFp)
-      .value("kDataTypeCodeBFp", base::DataTypeCode::kDataTypeCodeOpaqueHandle)
+      .value("kDataTypeCodeBFp", base::DataTypeCode::kDataTypeCodeBFp)
+      .value("kDataTypeCodeOpaqueHandle",
+             base::DataTypeCode::kDataTypeCodeOpaqueHandle)
       .value("kDataTypeCodeNotSupport",
              base::DataTypeCode::kDataTypeCodeNotSupport)
       .export_values();
@@ -25,6 +28,32 @@ NNDEPLOY_API_PYBIND11_MODULE("base", m) {
       .def_readwrite("bits_", &base::DataType::bits_)
       .def_readwrite("lanes_", &base::DataType::lanes_);
 
+  // nndeploy::base::DataFormat 导出为 base.DataFormat
+  py::enum_<base::DataFormat>(m, "DataFormat")
+      .value("kDataFormatN", base::DataFormat::kDataFormatN)
+      .value("kDataFormatNC", base::DataFormat::kDataFormatNC)
+      .value("kDataFormatNCL", base::DataFormat::kDataFormatNCL)
+      .value("kDataFormatNCHW", base::DataFormat::kDataFormatNCHW)
+      .value("kDataFormatNHWC", base::DataFormat::kDataFormatNHWC)
+      .value("kDataFormatOIHW", base::DataFormat::kDataFormatOIHW)
+      .value("kDataFormatNC4HW", base::DataFormat::kDataFormatNC4HW)
+      .value("kDataFormatNC8HW", base::DataFormat::kDataFormatNC8HW)
+      .value("kDataFormatNCDHW", base::DataFormat::kDataFormatNCDHW)
+      .value("kDataFormatNDHWC", base::DataFormat::kDataFormatNDHWC)
+      .value("kDataFormatAuto", base::DataFormat::kDataFormatAuto)
+      .value("kDataFormatNotSupport", base::DataFormat::kDataFormatNotSupport)
+      .export_values();
+
+  // nndeploy::base::PrecisionType 导出为 base.PrecisionType
+  py::enum_<base::PrecisionType>(m, "PrecisionType")
+      .value("kPrecisionTypeBFp16", base::PrecisionType::kPrecisionTypeBFp16)
+      .value("kPrecisionTypeFp16", base::PrecisionType::kPrecisionTypeFp16)
+      .value("kPrecisionTypeFp32", base::PrecisionType::kPrecisionTypeFp32)
+      .value("kPrecisionTypeFp64", base::PrecisionType::kPrecisionTypeFp64)
+      .value("kPrecisionTypeNotSupport",
+             base::PrecisionType::kPrecisionTypeNotSupport)
+      .export_values();
+
   // nndeploy::base::DeviceTypeCode 导出为base.DeviceTypeCode
   py::enum_<base::DeviceTypeCode>(m, "DeviceTypeCode")
       .value("cpu", base::DeviceTypeCode::kDeviceTypeCodeCpu)
@@ -125,6 +154,30 @@ NNDEPLOY_API_PYBIND11_MODULE("base", m) {
       .value("kParallelTypeTask", ParallelType::kParallelTypeTask)
       .value("kParallelTypePipeline", ParallelType::kParallelTypePipeline)
       .export_values();
+
+  // 导出CpuIsa
+  py::enum_<CpuIsa>(m, "CpuIsa")
+      .value("kCpuIsaScalar", CpuIsa::kCpuIsaScalar)
+      .value("kCpuIsaSse4", CpuIsa::kCpuIsaSse4)
+      .value("kCpuIsaAvx2", CpuIsa::kCpuIsaAvx2)
+      .value("kCpuIsaAvx512", CpuIsa::kCpuIsaAvx512)
+      .value("kCpuIsaAvx512Vnni", CpuIsa::kCpuIsaAvx512Vnni)
+      .value("kCpuIsaNeon", CpuIsa::kCpuIsaNeon)
+      .value("kCpuIsaNotSupport", CpuIsa::kCpuIsaNotSupport)
+      .export_values();
+
+  m.def("getHardwareCpuIsa", &getHardwareCpuIsa);
+  m.def("getCpuIsa", &getCpuIsa);
+  m.def("setCpuIsa", [](CpuIsa isa) {
+    base::Status status = setCpuIsa(isa);
+    if (status != base::kStatusCodeOk) {
+      std::stringstream ss;
+      ss << "nndeploy::base::setCpuIsa failed: error code "
+         << base::statusCodeToString(status.getStatusCode());
+      pybind11::pybind11_fail(ss.str());
+    }
+  });
+  m.def("isCpuIsaSupported", &isCpuIsaSupported);
 }
 
 }  // namespace base
@@ -6,9 +6,15 @@
 namespace nndeploy {
 
 NNDEPLOY_API_PYBIND11_MODULE("device", m) {
-  // 导出 Device获取相关函数
+  // Device由Architecture持有，python侧只引用不释放
+  py::class_<device::Device, std::unique_ptr<device::Device, py::nodelete>>(
+      m, "Device")
+      .def("getDeviceType", &device::Device::getDeviceType);
+
+  // 导出 Device获取相关函数，设备未注册时返回None
   m.def("getDevice", device::getDevice,
-        "A function which gets a device by type", py::arg("device_type"));
+        "A function which gets a device by type", py::arg("device_type"),
+        py::return_value_policy::reference);
 }
 
 }  // namespace nndeploy
\ No newline at end of file
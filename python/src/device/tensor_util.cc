@@ -1,8 +1,40 @@
 #include "device/tensor_util.h"
 
+#include "nndeploy/base/shape.h"
+
 std::string getTensorFormat(device::Tensor* tensor) {
   std::string format;
-  auto elemsize = tensor->getDataType().bits_ / 8;
+  base::DataType data_type = tensor->getDataType();
+  auto elemsize = data_type.bits_ / 8;
+  if (data_type.code_ == base::kDataTypeCodeInt) {
+    switch (elemsize) {
+      case 8:
+        return pybind11::format_descriptor<int64_t>::format();
+      case 4:
+        return pybind11::format_descriptor<int32_t>::format();
+      case 2:
+        return pybind11::format_descriptor<int16_t>::format();
+      default:
+        return pybind11::format_descriptor<int8_t>::format();
+    }
+  }
+  // bf16在numpy中没有对应的类型，按uint16返回原始数据
+  if (data_type.code_ == base::kDataTypeCodeUint ||
+      data_type.code_ == base::kDataTypeCodeBFp) {
+    switch (elemsize) {
+      case 8:
+        return pybind11::format_descriptor<uint64_t>::format();
+      case 4:
+        return pybind11::format_descriptor<uint32_t>::format();
+      case 2:
+        return pybind11::format_descriptor<uint16_t>::format();
+      default:
+        return pybind11::format_descriptor<uint8_t>::format();
+    }
+  }
+  if (elemsize == 8) {
+    format = pybind11::format_descriptor<double>::format();
+  }
   if (elemsize == 4) {
     format = pybind11::format_descriptor<float>::format();
   }
@@ -16,6 +48,46 @@ std::string getTensorFormat(device::Tensor* tensor) {
   return format;
 }
 
+// numpy的struct格式字符对应的数据类型，未知时code_为kDataTypeCodeNotSupport
+static base::DataType formatToDataType(const std::string& format,
+                                       py::ssize_t itemsize) {
+  base::DataType data_type;
+  data_type.bits_ = (uint8_t)(itemsize * 8);
+  data_type.lanes_ = 1;
+  // 忽略字节序前缀，如"<f"
+  size_t pos = format.find_first_not_of("<=@");
+  if (pos == std::string::npos || pos + 1 != format.size()) {
+    data_type.code_ = base::kDataTypeCodeNotSupport;
+    return data_type;
+  }
+  switch (format[pos]) {
+    case 'e':
+    case 'f':
+    case 'd':
+      data_type.code_ = base::kDataTypeCodeFp;
+      break;
+    case 'b':
+    case 'h':
+    case 'i':
+    case 'l':
+    case 'q':
+      data_type.code_ = base::kDataTypeCodeInt;
+      break;
+    case 'B':
+    case 'H':
+    case 'I':
+    case 'L':
+    case 'Q':
+    case '?':
+      data_type.code_ = base::kDataTypeCodeUint;
+      break;
+    default:
+      data_type.code_ = base::kDataTypeCodeNotSupport;
+      break;
+  }
+  return data_type;
+}
+
 std::vector<long> calculateStridesBaseShape(const base::IntVector& shape) {
   std::vector<long> strides(shape.size());
   long total_size = 1;
@@ -52,9 +124,15 @@ py::buffer_info tensorToBufferInfo(device::Tensor* tensor) {
   }
   auto elemsize = tensor->getDataType().bits_ / 8;
   auto format = getTensorFormat(tensor);
-  auto dims = tensor->getShape().size();
+  // 通道分块格式按实际存储形状[N, ceil(C / block), H, W, block]导出
+  base::IntVector shape = tensor->getShape();
+  int block = base::getChannelBlock(tensor->getDataFormat());
+  if (block > 1) {
+    shape = base::shapeNchw2Blocked(shape, block);
+  }
+  auto dims = shape.size();
   auto strides = calculateStridesBaseShape(
-      tensor->getShape());  // nndeploy中的strides可能为空，根据shape重新计算
+      shape);  // nndeploy中的strides可能为空，根据shape重新计算
   for (int i = 0; i < strides.size(); i++) {
     strides[i] = strides[i] * elemsize;
   }
@@ -64,7 +142,7 @@ py::buffer_info tensorToBufferInfo(device::Tensor* tensor) {
                          elemsize, /* Size of one scalar */
                          format,   /* Python struct-style format descriptor */
                          dims,     /* Number of dimensions */
-                         tensor->getShape(), /* Buffer dimensions */
+                         shape,    /* Buffer dimensions */
                          strides /* Strides (in bytes) for each index */
 
   );
@@ -75,35 +153,16 @@ device::Tensor* bufferInfoToTensor(py::buffer const b,
   device::Tensor* tensor = nullptr;
 
   py::buffer_info info = b.request();
-  if (info.ndim > 4) {
-    std::stringstream ss;
-    ss << "convert numpy.ndarray to nndeploy Tensor only dims <=4 support now, "
-          "but given "
-       << info.ndim;
-    pybind11::pybind11_fail(ss.str());
-  }
 
   device::TensorDesc desc;
 
-  // 根据numpy中元素的空间大小，赋值一个默认数值类型
-  switch (info.itemsize) {
-    case 4:
-      desc.data_type_ = base::dataTypeOf<float>();
-      break;
-    case 2:
-      desc.data_type_ = base::dataTypeOf<int16_t>();
-      break;
-    case 1:
-      desc.data_type_ = base::dataTypeOf<int8_t>();
-      break;
-    default:
-      std::stringstream ss;
-      ss << "convert numpy.ndarray to nndeploy Tensor only support itemsize = "
-            "4, 2, 1 "
-            "now, "
-            "but given "
-         << info.itemsize;
-      pybind11::pybind11_fail(ss.str());
+  // 根据numpy中元素的数值类型，赋值对应的数据类型
+  desc.data_type_ = formatToDataType(info.format, info.itemsize);
+  if (desc.data_type_.code_ == base::kDataTypeCodeNotSupport) {
+    std::stringstream ss;
+    ss << "convert numpy.ndarray to nndeploy Tensor not support format "
+       << info.format;
+    pybind11::pybind11_fail(ss.str());
   }
 
   // 根据numpy中维度的大小，赋值一个默认格式
@@ -120,8 +179,11 @@ device::Tensor* bufferInfoToTensor(py::buffer const b,
     case 4:
       desc.data_format_ = base::kDataFormatNCHW;
       break;
+    case 5:
+      desc.data_format_ = base::kDataFormatNCDHW;
+      break;
     default:
-      desc.data_format_ = base::kDataFormatNotSupport;
+      desc.data_format_ = base::kDataFormatAuto;
       break;
   }
 
@@ -11,7 +11,7 @@
 using namespace nndeploy;
 namespace py = pybind11;
 
-// 获取tensor的数值类型 根据元素的bit位宽决定
+// 获取tensor的数值类型 根据数据类型与元素的bit位宽决定
 std::string getTensorFormat(device::Tensor* tensor);
 
 // 从tensor的shape推断stride，numpy要求的内存是紧凑的
@@ -39,6 +39,19 @@ NNDEPLOY_API_PYBIND11_MODULE("ir", m) {
       .def_readwrite("pads_", &ConvParam::pads_)
       .def_readwrite("strides_", &ConvParam::strides_);
 
+  // 导出 AveragePoolParam 类
+  py::class_<AveragePoolParam, OpParam, std::shared_ptr<AveragePoolParam>>(
+      m, "AveragePoolParam")
+      .def(py::init<>())
+      .def_readwrite("auto_pad_", &AveragePoolParam::auto_pad_)
+      .def_readwrite("ceil_mode_", &AveragePoolParam::ceil_mode_)
+      .def_readwrite("count_include_pad_",
+                     &AveragePoolParam::count_include_pad_)
+      .def_readwrite("dilations_", &AveragePoolParam::dilations_)
+      .def_readwrite("kernel_shape_", &AveragePoolParam::kernel_shape_)
+      .def_readwrite("pads_", &AveragePoolParam::pads_)
+      .def_readwrite("strides_", &AveragePoolParam::strides_);
+
   // 导出 MaxPoolParam 类
   py::class_<MaxPoolParam, OpParam, std::shared_ptr<MaxPoolParam>>(
       m, "MaxPoolParam")
@@ -98,6 +111,64 @@ NNDEPLOY_API_PYBIND11_MODULE("ir", m) {
       .def_readwrite("eps_", &RMSNormParam::eps_)
       .def_readwrite("is_last_", &RMSNormParam::is_last_);
 
+  // 导出 AttentionParam 类
+  py::class_<AttentionParam, OpParam, std::shared_ptr<AttentionParam>>(
+      m, "AttentionParam")
+      .def(py::init<>())
+      .def_readwrite("is_causal_", &AttentionParam::is_causal_)
+      .def_readwrite("causal_bottom_right_",
+                     &AttentionParam::causal_bottom_right_)
+      .def_readwrite("q_num_heads_", &AttentionParam::q_num_heads_)
+      .def_readwrite("kv_num_heads_", &AttentionParam::kv_num_heads_)
+      .def_readwrite("scale_", &AttentionParam::scale_);
+
+  // 导出 PagedAttentionParam 类
+  py::class_<PagedAttentionParam, OpParam,
+             std::shared_ptr<PagedAttentionParam>>(m, "PagedAttentionParam")
+      .def(py::init<>())
+      .def_readwrite("is_causal_", &PagedAttentionParam::is_causal_)
+      .def_readwrite("q_num_heads_", &PagedAttentionParam::q_num_heads_)
+      .def_readwrite("scale_", &PagedAttentionParam::scale_)
+      .def_readwrite("layer_", &PagedAttentionParam::layer_);
+
+  // 导出 RotaryEmbeddingParam 类
+  py::class_<RotaryEmbeddingParam, OpParam,
+             std::shared_ptr<RotaryEmbeddingParam>>(m, "RotaryEmbeddingParam")
+      .def(py::init<>())
+      .def_readwrite("interleaved_", &RotaryEmbeddingParam::interleaved_)
+      .def_readwrite("rotary_embedding_dim_",
+                     &RotaryEmbeddingParam::rotary_embedding_dim_)
+      .def_readwrite("num_heads_", &RotaryEmbeddingParam::num_heads_);
+
+  // 导出 SwiGLUParam 类
+  py::class_<SwiGLUParam, OpParam, std::shared_ptr<SwiGLUParam>>(
+      m, "SwiGLUParam")
+      .def(py::init<>())
+      .def_readwrite("axis_", &SwiGLUParam::axis_);
+
+  // 导出 LayerNormalizationParam 类
+  py::class_<LayerNormalizationParam, OpParam,
+             std::shared_ptr<LayerNormalizationParam>>(
+      m, "LayerNormalizationParam")
+      .def(py::init<>())
+      .def_readwrite("axis_", &LayerNormalizationParam::axis_)
+      .def_readwrite("epsilon_", &LayerNormalizationParam::epsilon_);
+
+  // 导出 InstanceNormalizationParam 类
+  py::class_<InstanceNormalizationParam, OpParam,
+             std::shared_ptr<InstanceNormalizationParam>>(
+      m, "InstanceNormalizationParam")
+      .def(py::init<>())
+      .def_readwrite("epsilon_", &InstanceNormalizationParam::epsilon_);
+
+  // 导出 GroupNormalizationParam 类
+  py::class_<GroupNormalizationParam, OpParam,
+             std::shared_ptr<GroupNormalizationParam>>(
+      m, "GroupNormalizationParam")
+      .def(py::init<>())
+      .def_readwrite("num_groups_", &GroupNormalizationParam::num_groups_)
+      .def_readwrite("epsilon_", &GroupNormalizationParam::epsilon_);
+
   py::class_<FlattenParam, OpParam, std::shared_ptr<FlattenParam>>(
       m, "FlattenParam")
       .def(py::init<>())
@@ -108,7 +179,40 @@ NNDEPLOY_API_PYBIND11_MODULE("ir", m) {
       .def_readwrite("alpha_", &GemmParam::alpha_)
       .def_readwrite("beta_", &GemmParam::beta_)
       .def_readwrite("trans_a_", &GemmParam::trans_a_)
-      .def_readwrite("trans_b_", &GemmParam::trans_b_);
+      .def_readwrite("trans_b_", &GemmParam::trans_b_)
+      .def_readwrite("has_b_zero_point_", &GemmParam::has_b_zero_point_);
+
+  // 导出 ReduceParam 类，Reduce系列算子共用
+  py::class_<ReduceParam, OpParam, std::shared_ptr<ReduceParam>>(
+      m, "ReduceParam")
+      .def(py::init<>())
+      .def_readwrite("axes_", &ReduceParam::axes_)
+      .def_readwrite("keepdims_", &ReduceParam::keepdims_)
+      .def_readwrite("noop_with_empty_axes_",
+                     &ReduceParam::noop_with_empty_axes_);
+
+  // 导出 TopKParam 类
+  py::class_<TopKParam, OpParam, std::shared_ptr<TopKParam>>(m, "TopKParam")
+      .def(py::init<>())
+      .def_readwrite("axis_", &TopKParam::axis_)
+      .def_readwrite("largest_", &TopKParam::largest_)
+      .def_readwrite("sorted_", &TopKParam::sorted_)
+      .def_readwrite("k_", &TopKParam::k_)
+      .def_readwrite("softmax_", &TopKParam::softmax_);
+
+  // 导出 QuantizeLinearParam 类
+  py::class_<QuantizeLinearParam, OpParam,
+             std::shared_ptr<QuantizeLinearParam>>(m, "QuantizeLinearParam")
+      .def(py::init<>())
+      .def_readwrite("axis_", &QuantizeLinearParam::axis_)
+      .def_readwrite("saturate_", &QuantizeLinearParam::saturate_);
+
+  // 导出 DequantizeLinearParam 类
+  py::class_<DequantizeLinearParam, OpParam,
+             std::shared_ptr<DequantizeLinearParam>>(m,
+                                                     "DequantizeLinearParam")
+      .def(py::init<>())
+      .def_readwrite("axis_", &DequantizeLinearParam::axis_);
 }
 }  // namespace ir
 }  // namespace nndeploy
\ No newline at end of file
@@ -14,7 +14,16 @@ NNDEPLOY_API_PYBIND11_MODULE("net", m) {
       .def(py::init<>())
       .def("setModelDesc", &Net::setModelDesc)
       .def("setDeviceType", &Net::setDeviceType)
+      .def("setThreadNum", &Net::setThreadNum, py::arg("num_thread"))
+      .def("getThreadNum", &Net::getThreadNum)
+      .def("setPrecisionType", &Net::setPrecisionType,
+           py::arg("precision_type"))
+      .def("getPrecisionType", &Net::getPrecisionType)
+      .def("setDynamicShape", &Net::setDynamicShape,
+           py::arg("is_dynamic_shape"), py::arg("min_shape"),
+           py::arg("opt_shape"), py::arg("max_shape"))
       .def("init", &Net::init)
+      .def("reshape", &Net::reshape, py::arg("shape_map"))
       .def(
           "dump",
           [](Net& self, const std::string& file_path) {
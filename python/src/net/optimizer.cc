@@ -11,10 +11,19 @@ NNDEPLOY_API_PYBIND11_MODULE("net", m) {
       .value("kOptPassTypeFuseConvBatchNorm",
              OptPassType::kOptPassTypeFuseConvBatchNorm)
       .value("kOptPassTypeFuseConvRelu", OptPassType::kOptPassTypeFuseConvRelu)
+      .value("kOptPassTypeFuseQdqConv", OptPassType::kOptPassTypeFuseQdqConv)
+      .value("kOptPassTypeFuseLayerNorm",
+             OptPassType::kOptPassTypeFuseLayerNorm)
+      .value("kOptPassTypeFuseElementwise",
+             OptPassType::kOptPassTypeFuseElementwise)
       .value("kOptPassTypeEliminateCommonSubexpression",
              OptPassType::kOptPassTypeEliminateCommonSubexpression)
       .value("kOptPassTypeEliminateDeadOp",
              OptPassType::kOptPassTypeEliminateDeadOp)
+      .value("kOptPassTypePropagateLayout",
+             OptPassType::kOptPassTypePropagateLayout)
+      .value("kOptPassTypeConvertPrecision",
+             OptPassType::kOptPassTypeConvertPrecision)
       .export_values();  // 这一步是可选的，它会导出枚举值到Python的命名空间中
 }
 
@@ -44,6 +44,10 @@ NNDEPLOY_API_PYBIND11_MODULE("op", m) {
         py::arg("op_name") = "", py::arg("output_name") = "",
         py::return_value_policy::reference);
 
+  m.def("makeSigmoid", &makeSigmoid, py::arg("model_desc"), py::arg("input"),
+        py::arg("op_name") = "", py::arg("output_name") = "",
+        py::return_value_policy::reference);
+
   m.def("makeSoftMax", &makeSoftMax, py::arg("model_desc"), py::arg("input"),
         py::arg("param"), py::arg("op_name") = "", py::arg("output_name") = "",
         py::return_value_policy::reference);
@@ -70,9 +74,102 @@ NNDEPLOY_API_PYBIND11_MODULE("op", m) {
         py::arg("param"), py::arg("op_name") = "", py::arg("output_name") = "",
         py::return_value_policy::reference);
 
+  m.def("makeAveragePool", &makeAveragePool, py::arg("model_desc"),
+        py::arg("input"), py::arg("param"), py::arg("op_name") = "",
+        py::arg("output_name") = "", py::return_value_policy::reference);
+
   m.def("makeGlobalAveragePool", &makeGlobalAveragePool, py::arg("model_desc"),
         py::arg("input"), py::arg("op_name") = "", py::arg("output_name") = "",
         py::return_value_policy::reference);
+
+  m.def("makeRMSNorm", &makeRMSNorm, py::arg("model_desc"), py::arg("input"),
+        py::arg("param"), py::arg("weight"), py::arg("residual") = nullptr,
+        py::arg("op_name") = "", py::arg("output_name") = "",
+        py::return_value_policy::reference);
+
+  m.def("makeAttention", &makeAttention, py::arg("model_desc"), py::arg("q"),
+        py::arg("k"), py::arg("v"), py::arg("param"),
+        py::arg("attn_mask") = nullptr, py::arg("op_name") = "",
+        py::arg("output_name") = "", py::return_value_policy::reference);
+
+  m.def("makeRotaryEmbedding", &makeRotaryEmbedding, py::arg("model_desc"),
+        py::arg("input"), py::arg("param"), py::arg("cos_cache"),
+        py::arg("sin_cache"), py::arg("position_ids") = nullptr,
+        py::arg("op_name") = "", py::arg("output_name") = "",
+        py::return_value_policy::reference);
+
+  m.def("makeSwiGLU", &makeSwiGLU, py::arg("model_desc"), py::arg("gate"),
+        py::arg("up") = nullptr, py::arg("param") = nullptr,
+        py::arg("op_name") = "", py::arg("output_name") = "",
+        py::return_value_policy::reference);
+
+  m.def("makeSplit", &makeSplit, py::arg("model_desc"), py::arg("input"),
+        py::arg("param"), py::arg("split") = "", py::arg("op_name") = "",
+        py::arg("output_name") = "", py::return_value_policy::reference);
+
+  m.def("makeConcat", &makeConcat, py::arg("model_desc"), py::arg("inputs"),
+        py::arg("param"), py::arg("op_name") = "", py::arg("output_name") = "",
+        py::return_value_policy::reference);
+
+  m.def("makeQuantizeLinear", &makeQuantizeLinear, py::arg("model_desc"),
+        py::arg("input"), py::arg("param"), py::arg("scale"),
+        py::arg("zero_point") = "", py::arg("op_name") = "",
+        py::arg("output_name") = "", py::return_value_policy::reference);
+
+  m.def("makeDequantizeLinear", &makeDequantizeLinear, py::arg("model_desc"),
+        py::arg("input"), py::arg("param"), py::arg("scale"),
+        py::arg("zero_point") = "", py::arg("op_name") = "",
+        py::arg("output_name") = "", py::return_value_policy::reference);
+
+  m.def("makeReduceL1", &makeReduceL1, py::arg("model_desc"),
+        py::arg("input"), py::arg("param"), py::arg("axes") = "",
+        py::arg("op_name") = "", py::arg("output_name") = "",
+        py::return_value_policy::reference);
+
+  m.def("makeReduceL2", &makeReduceL2, py::arg("model_desc"),
+        py::arg("input"), py::arg("param"), py::arg("axes") = "",
+        py::arg("op_name") = "", py::arg("output_name") = "",
+        py::return_value_policy::reference);
+
+  m.def("makeReduceLogSum", &makeReduceLogSum, py::arg("model_desc"),
+        py::arg("input"), py::arg("param"), py::arg("axes") = "",
+        py::arg("op_name") = "", py::arg("output_name") = "",
+        py::return_value_policy::reference);
+
+  m.def("makeReduceLogSumExp", &makeReduceLogSumExp, py::arg("model_desc"),
+        py::arg("input"), py::arg("param"), py::arg("axes") = "",
+        py::arg("op_name") = "", py::arg("output_name") = "",
+        py::return_value_policy::reference);
+
+  m.def("makeReduceMax", &makeReduceMax, py::arg("model_desc"),
+        py::arg("input"), py::arg("param"), py::arg("axes") = "",
+        py::arg("op_name") = "", py::arg("output_name") = "",
+        py::return_value_policy::reference);
+
+  m.def("makeReduceMean", &makeReduceMean, py::arg("model_desc"),
+        py::arg("input"), py::arg("param"), py::arg("axes") = "",
+        py::arg("op_name") = "", py::arg("output_name") = "",
+        py::return_value_policy::reference);
+
+  m.def("makeReduceMin", &makeReduceMin, py::arg("model_desc"),
+        py::arg("input"), py::arg("param"), py::arg("axes") = "",
+        py::arg("op_name") = "", py::arg("output_name") = "",
+        py::return_value_policy::reference);
+
+  m.def("makeReduceProd", &makeReduceProd, py::arg("model_desc"),
+        py::arg("input"), py::arg("param"), py::arg("axes") = "",
+        py::arg("op_name") = "", py::arg("output_name") = "",
+        py::return_value_policy::reference);
+
+  m.def("makeReduceSum", &makeReduceSum, py::arg("model_desc"),
+        py::arg("input"), py::arg("param"), py::arg("axes") = "",
+        py::arg("op_name") = "", py::arg("output_name") = "",
+        py::return_value_policy::reference);
+
+  m.def("makeReduceSumSquare", &makeReduceSumSquare, py::arg("model_desc"),
+        py::arg("input"), py::arg("param"), py::arg("axes") = "",
+        py::arg("op_name") = "", py::arg("output_name") = "",
+        py::return_value_policy::reference);
 }
 }  // namespace op
 }  // namespace nndeploy
\ No newline at end of file
@@ -2,16 +2,121 @@
 #include "op/op_func.h"
 
 namespace nndeploy {
+
+static void checkKVCacheStatus(base::Status status, const char* func) {
+  if (status != base::kStatusCodeOk) {
+    std::stringstream ss;
+    ss << "nndeploy::op::KVCache::" << func << " failed: error code "
+       << base::statusCodeToString(status.getStatusCode());
+    pybind11::pybind11_fail(ss.str());
+  }
+}
+
 NNDEPLOY_API_PYBIND11_MODULE("op", m) {
   m.def("rms_norm", &rmsNormFunc);
   m.def("batch_norm", &batchNormFunc);
   m.def("relu", &reluFunc);
+  m.def("sigmoid", &sigmoidFunc);
+  m.def("exp", &expFunc);
+  m.def("tanh", &tanhFunc);
+  m.def("erf", &erfFunc);
+  m.def("gelu", &geluFunc);
+  m.def("silu", &siluFunc);
   m.def("conv", &convFunc);
+  m.def("softmax", &softmaxFunc);
   m.def("add", &addFunc);
   m.def("flatten", &flattenFunc);
+  m.def("transpose", &transposeFunc);
   m.def("gemm", &gemmFunc);
+  m.def("quant_gemm", &quantGemmFunc);
+  m.def("quant_matmul", &quantMatMulFunc);
+  m.def("quantize_linear", &quantizeLinearFunc);
+  m.def("dequantize_linear", &dequantizeLinearFunc);
+  m.def("qlinear_conv", &qlinearConvFunc);
+  m.def("qlinear_matmul", &qlinearMatMulFunc);
+  m.def("reduce_l1", &reduceL1Func);
+  m.def("reduce_l2", &reduceL2Func);
+  m.def("reduce_log_sum", &reduceLogSumFunc);
+  m.def("reduce_log_sum_exp", &reduceLogSumExpFunc);
+  m.def("reduce_max", &reduceMaxFunc);
+  m.def("reduce_mean", &reduceMeanFunc);
+  m.def("reduce_min", &reduceMinFunc);
+  m.def("reduce_prod", &reduceProdFunc);
+  m.def("reduce_sum", &reduceSumFunc);
+  m.def("reduce_sum_square", &reduceSumSquareFunc);
+  m.def("topk", &topKFunc);
+  m.def("softmax_topk", &softmaxTopKFunc);
   m.def("global_averagepool", &globalAveragepoolFunc);
   m.def("maxpool", &maxPoolFunc);
+  m.def("averagepool", &averagePoolFunc);
+  m.def("resize", &resizeFunc);
+  m.def("attention", &attentionFunc);
+  m.def("paged_attention", &pagedAttentionFunc);
+  m.def("rotary_embedding", &rotaryEmbeddingFunc);
+  m.def("swiglu", &swigluFunc);
+  m.def("layer_norm", &layerNormFunc);
+  m.def("group_norm", &groupNormFunc);
+  m.def("instance_norm", &instanceNormFunc);
+  m.def("concat", &concatFunc);
+  m.def("reorder", &reorderFunc);
+  m.def("cast", &castFunc);
+
+  // 分页KV cache，供paged_attention使用
+  py::class_<op::KVCacheParam>(m, "KVCacheParam")
+      .def(py::init<>())
+      .def_readwrite("num_layers_", &op::KVCacheParam::num_layers_)
+      .def_readwrite("num_kv_heads_", &op::KVCacheParam::num_kv_heads_)
+      .def_readwrite("head_size_", &op::KVCacheParam::head_size_)
+      .def_readwrite("block_tokens_", &op::KVCacheParam::block_tokens_)
+      .def_readwrite("blocks_per_chunk_",
+                     &op::KVCacheParam::blocks_per_chunk_)
+      .def_readwrite("data_type_", &op::KVCacheParam::data_type_);
+
+  py::class_<op::KVCache>(m, "KVCache")
+      .def(py::init([](base::DeviceType device_type,
+                       const op::KVCacheParam& param) {
+             return new op::KVCache(device::getDevice(device_type), param);
+           }),
+           py::arg("device_type"), py::arg("param"))
+      .def(
+          "init",
+          [](op::KVCache& self, int num_tokens) {
+            checkKVCacheStatus(self.init(num_tokens), "init");
+          },
+          py::arg("num_tokens") = 0)
+      .def("deinit",
+           [](op::KVCache& self) {
+             checkKVCacheStatus(self.deinit(), "deinit");
+           })
+      .def("createSequence", &op::KVCache::createSequence)
+      .def("forkSequence", &op::KVCache::forkSequence)
+      .def("freeSequence",
+           [](op::KVCache& self, int seq_id) {
+             checkKVCacheStatus(self.freeSequence(seq_id), "freeSequence");
+           })
+      .def("appendSlots",
+           [](op::KVCache& self, int seq_id, int num_tokens) {
+             checkKVCacheStatus(self.appendSlots(seq_id, num_tokens),
+                                "appendSlots");
+           })
+      .def("writeKV",
+           [](op::KVCache& self, int seq_id, int layer, device::Tensor* k,
+              device::Tensor* v) {
+             checkKVCacheStatus(self.writeKV(seq_id, layer, k, v),
+                                "writeKV");
+           })
+      .def("hasSequence", &op::KVCache::hasSequence)
+      .def("getSequenceLength", &op::KVCache::getSequenceLength)
+      .def("getBlockNum", &op::KVCache::getBlockNum)
+      .def("getFreeBlockNum", &op::KVCache::getFreeBlockNum);
+
+  // 按op类型名(如"kOpTypeAdd")查询当前会选中的CPU kernel的指令集级别
+  m.def("get_op_kernel_isa",
+        [](const std::string& op_type, base::DataType data_type) {
+          base::CpuIsa isa = base::kCpuIsaNotSupport;
+          op::selectOpKernel(ir::stringToOpType(op_type), data_type, &isa);
+          return isa;
+        });
 }
 
 }  // namespace nndeploy
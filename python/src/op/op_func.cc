@@ -65,6 +65,105 @@ device::Tensor* reluFunc(device::Tensor* input) {
   return output;
 }
 
+device::Tensor* sigmoidFunc(device::Tensor* input) {
+  std::stringstream ss;
+
+  device::Tensor* output = new device::Tensor("sigmoid.output");
+  base::Status status = op::sigmoid(input, output);
+  if (status != base::kStatusCodeOk) {
+    ss << "nndeploy::op::sigmoid failed: error code "
+       << base::statusCodeToString(status.getStatusCode());
+    pybind11::pybind11_fail(ss.str());
+  }
+
+  return output;
+}
+
+device::Tensor* expFunc(device::Tensor* input) {
+  std::stringstream ss;
+
+  device::Tensor* output = new device::Tensor("exp.output");
+  base::Status status = op::exp(input, output);
+  if (status != base::kStatusCodeOk) {
+    ss << "nndeploy::op::exp failed: error code "
+       << base::statusCodeToString(status.getStatusCode());
+    pybind11::pybind11_fail(ss.str());
+  }
+
+  return output;
+}
+
+device::Tensor* tanhFunc(device::Tensor* input) {
+  std::stringstream ss;
+
+  device::Tensor* output = new device::Tensor("tanh.output");
+  base::Status status = op::tanh(input, output);
+  if (status != base::kStatusCodeOk) {
+    ss << "nndeploy::op::tanh failed: error code "
+       << base::statusCodeToString(status.getStatusCode());
+    pybind11::pybind11_fail(ss.str());
+  }
+
+  return output;
+}
+
+device::Tensor* erfFunc(device::Tensor* input) {
+  std::stringstream ss;
+
+  device::Tensor* output = new device::Tensor("erf.output");
+  base::Status status = op::erf(input, output);
+  if (status != base::kStatusCodeOk) {
+    ss << "nndeploy::op::erf failed: error code "
+       << base::statusCodeToString(status.getStatusCode());
+    pybind11::pybind11_fail(ss.str());
+  }
+
+  return output;
+}
+
+device::Tensor* geluFunc(device::Tensor* input) {
+  std::stringstream ss;
+
+  device::Tensor* output = new device::Tensor("gelu.output");
+  base::Status status = op::gelu(input, output);
+  if (status != base::kStatusCodeOk) {
+    ss << "nndeploy::op::gelu failed: error code "
+       << base::statusCodeToString(status.getStatusCode());
+    pybind11::pybind11_fail(ss.str());
+  }
+
+  return output;
+}
+
+device::Tensor* siluFunc(device::Tensor* input) {
+  std::stringstream ss;
+
+  device::Tensor* output = new device::Tensor("silu.output");
+  base::Status status = op::silu(input, output);
+  if (status != base::kStatusCodeOk) {
+    ss << "nndeploy::op::silu failed: error code "
+       << base::statusCodeToString(status.getStatusCode());
+    pybind11::pybind11_fail(ss.str());
+  }
+
+  return output;
+}
+
+device::Tensor* softmaxFunc(device::Tensor* input,
+                            std::shared_ptr<ir::SoftmaxParam> param) {
+  std::stringstream ss;
+
+  device::Tensor* output = new device::Tensor("softmax.output");
+  base::Status status = op::softmax(input, param, output);
+  if (status != base::kStatusCodeOk) {
+    ss << "nndeploy::op::softmax failed: error code "
+       << base::statusCodeToString(status.getStatusCode());
+    pybind11::pybind11_fail(ss.str());
+  }
+
+  return output;
+}
+
 device::Tensor* addFunc(device::Tensor* input1, device::Tensor* input2) {
   std::stringstream ss;
   device::Tensor* result = new device::Tensor("add.output");
@@ -90,6 +189,21 @@ device::Tensor* flattenFunc(device::Tensor* input,
   return result;
 }
 
+device::Tensor* transposeFunc(device::Tensor* input,
+                              std::shared_ptr<ir::TransposeParam> param) {
+  std::stringstream ss;
+
+  device::Tensor* output = new device::Tensor("transpose.output");
+  base::Status status = op::transpose(input, param, output);
+  if (status != base::kStatusCodeOk) {
+    ss << "nndeploy::op::transpose failed: error code "
+       << base::statusCodeToString(status.getStatusCode());
+    pybind11::pybind11_fail(ss.str());
+  }
+
+  return output;
+}
+
 device::Tensor* gemmFunc(device::Tensor* inputs_a, device::Tensor* inputs_b,
                          device::Tensor* inputs_c,
                          std::shared_ptr<ir::GemmParam> param) {
@@ -104,6 +218,200 @@ device::Tensor* gemmFunc(device::Tensor* inputs_a, device::Tensor* inputs_b,
   return result;
 }
 
+device::Tensor* quantGemmFunc(device::Tensor* inputs_a,
+                              device::Tensor* inputs_b,
+                              device::Tensor* b_scale,
+                              device::Tensor* b_zero_point,
+                              device::Tensor* inputs_c,
+                              std::shared_ptr<ir::GemmParam> param) {
+  std::stringstream ss;
+  device::Tensor* result = new device::Tensor("quant_gemm.output");
+  base::Status status = op::gemm(inputs_a, inputs_b, b_scale, b_zero_point,
+                                 inputs_c, param, result);
+  if (status != base::kStatusCodeOk) {
+    ss << "nndeploy::op::gemm failed: error code "
+       << base::statusCodeToString(status.getStatusCode());
+    pybind11::pybind11_fail(ss.str());
+  }
+  return result;
+}
+
+device::Tensor* quantMatMulFunc(device::Tensor* inputs_a,
+                                device::Tensor* inputs_b,
+                                device::Tensor* b_scale,
+                                device::Tensor* b_zero_point) {
+  std::stringstream ss;
+  device::Tensor* result = new device::Tensor("quant_matmul.output");
+  base::Status status =
+      op::matmul(inputs_a, inputs_b, b_scale, b_zero_point, result);
+  if (status != base::kStatusCodeOk) {
+    ss << "nndeploy::op::matmul failed: error code "
+       << base::statusCodeToString(status.getStatusCode());
+    pybind11::pybind11_fail(ss.str());
+  }
+  return result;
+}
+
+device::Tensor* quantizeLinearFunc(
+    device::Tensor* input, device::Tensor* scale, device::Tensor* zero_point,
+    std::shared_ptr<ir::QuantizeLinearParam> param) {
+  std::stringstream ss;
+  device::Tensor* result = new device::Tensor("quantize_linear.output");
+  base::Status status =
+      op::quantizeLinear(input, scale, zero_point, param, result);
+  if (status != base::kStatusCodeOk) {
+    ss << "nndeploy::op::quantize_linear failed: error code "
+       << base::statusCodeToString(status.getStatusCode());
+    pybind11::pybind11_fail(ss.str());
+  }
+  return result;
+}
+
+device::Tensor* dequantizeLinearFunc(
+    device::Tensor* input, device::Tensor* scale, device::Tensor* zero_point,
+    std::shared_ptr<ir::DequantizeLinearParam> param) {
+  std::stringstream ss;
+  device::Tensor* result = new device::Tensor("dequantize_linear.output");
+  base::Status status =
+      op::dequantizeLinear(input, scale, zero_point, param, result);
+  if (status != base::kStatusCodeOk) {
+    ss << "nndeploy::op::dequantize_linear failed: error code "
+       << base::statusCodeToString(status.getStatusCode());
+    pybind11::pybind11_fail(ss.str());
+  }
+  return result;
+}
+
+device::Tensor* qlinearConvFunc(
+    device::Tensor* x, device::Tensor* x_scale, device::Tensor* x_zero_point,
+    device::Tensor* w, device::Tensor* w_scale, device::Tensor* w_zero_point,
+    device::Tensor* y_scale, device::Tensor* y_zero_point, device::Tensor* b,
+    std::shared_ptr<ir::ConvParam> param) {
+  std::stringstream ss;
+  device::Tensor* result = new device::Tensor("qlinear_conv.output");
+  base::Status status =
+      op::qlinearConv(x, x_scale, x_zero_point, w, w_scale, w_zero_point,
+                      y_scale, y_zero_point, b, param, result);
+  if (status != base::kStatusCodeOk) {
+    ss << "nndeploy::op::qlinear_conv failed: error code "
+       << base::statusCodeToString(status.getStatusCode());
+    pybind11::pybind11_fail(ss.str());
+  }
+  return result;
+}
+
+device::Tensor* qlinearMatMulFunc(
+    device::Tensor* a, device::Tensor* a_scale, device::Tensor* a_zero_point,
+    device::Tensor* b, device::Tensor* b_scale, device::Tensor* b_zero_point,
+    device::Tensor* y_scale, device::Tensor* y_zero_point) {
+  std::stringstream ss;
+  device::Tensor* result = new device::Tensor("qlinear_matmul.output");
+  base::Status status =
+      op::qlinearMatmul(a, a_scale, a_zero_point, b, b_scale, b_zero_point,
+                        y_scale, y_zero_point, result);
+  if (status != base::kStatusCodeOk) {
+    ss << "nndeploy::op::qlinear_matmul failed: error code "
+       << base::statusCodeToString(status.getStatusCode());
+    pybind11::pybind11_fail(ss.str());
+  }
+  return result;
+}
+
+// Reduce系列共用
+static device::Tensor* reduceFunc(ir::OpType op_type, const std::string& name,
+                                  device::Tensor* input,
+                                  std::shared_ptr<ir::ReduceParam> param) {
+  std::stringstream ss;
+  device::Tensor* result = new device::Tensor(name + ".output");
+  base::Status status = op::reduce(op_type, input, param, result);
+  if (status != base::kStatusCodeOk) {
+    ss << "nndeploy::op::" << name << " failed: error code "
+       << base::statusCodeToString(status.getStatusCode());
+    pybind11::pybind11_fail(ss.str());
+  }
+  return result;
+}
+
+device::Tensor* reduceL1Func(device::Tensor* input,
+                             std::shared_ptr<ir::ReduceParam> param) {
+  return reduceFunc(ir::kOpTypeReduceL1, "reduce_l1", input, param);
+}
+
+device::Tensor* reduceL2Func(device::Tensor* input,
+                             std::shared_ptr<ir::ReduceParam> param) {
+  return reduceFunc(ir::kOpTypeReduceL2, "reduce_l2", input, param);
+}
+
+device::Tensor* reduceLogSumFunc(device::Tensor* input,
+                                 std::shared_ptr<ir::ReduceParam> param) {
+  return reduceFunc(ir::kOpTypeReduceLogSum, "reduce_log_sum", input, param);
+}
+
+device::Tensor* reduceLogSumExpFunc(device::Tensor* input,
+                                    std::shared_ptr<ir::ReduceParam> param) {
+  return reduceFunc(ir::kOpTypeReduceLogSumExp, "reduce_log_sum_exp", input,
+                    param);
+}
+
+device::Tensor* reduceMaxFunc(device::Tensor* input,
+                              std::shared_ptr<ir::ReduceParam> param) {
+  return reduceFunc(ir::kOpTypeReduceMax, "reduce_max", input, param);
+}
+
+device::Tensor* reduceMeanFunc(device::Tensor* input,
+                               std::shared_ptr<ir::ReduceParam> param) {
+  return reduceFunc(ir::kOpTypeReduceMean, "reduce_mean", input, param);
+}
+
+device::Tensor* reduceMinFunc(device::Tensor* input,
+                              std::shared_ptr<ir::ReduceParam> param) {
+  return reduceFunc(ir::kOpTypeReduceMin, "reduce_min", input, param);
+}
+
+device::Tensor* reduceProdFunc(device::Tensor* input,
+                               std::shared_ptr<ir::ReduceParam> param) {
+  return reduceFunc(ir::kOpTypeReduceProd, "reduce_prod", input, param);
+}
+
+device::Tensor* reduceSumFunc(device::Tensor* input,
+                              std::shared_ptr<ir::ReduceParam> param) {
+  return reduceFunc(ir::kOpTypeReduceSum, "reduce_sum", input, param);
+}
+
+device::Tensor* reduceSumSquareFunc(device::Tensor* input,
+                                    std::shared_ptr<ir::ReduceParam> param) {
+  return reduceFunc(ir::kOpTypeReduceSumSquare, "reduce_sum_square", input,
+                    param);
+}
+
+std::vector<device::Tensor*> topKFunc(device::Tensor* input,
+                                     std::shared_ptr<ir::TopKParam> param) {
+  std::stringstream ss;
+  device::Tensor* values = new device::Tensor("topk.values");
+  device::Tensor* indices = new device::Tensor("topk.indices");
+  base::Status status = op::topK(input, param, values, indices);
+  if (status != base::kStatusCodeOk) {
+    ss << "nndeploy::op::topk failed: error code "
+       << base::statusCodeToString(status.getStatusCode());
+    pybind11::pybind11_fail(ss.str());
+  }
+  return {values, indices};
+}
+
+std::vector<device::Tensor*> softmaxTopKFunc(
+    device::Tensor* input, std::shared_ptr<ir::TopKParam> param) {
+  std::stringstream ss;
+  device::Tensor* values = new device::Tensor("softmax_topk.values");
+  device::Tensor* indices = new device::Tensor("softmax_topk.indices");
+  base::Status status = op::softmaxTopK(input, param, values, indices);
+  if (status != base::kStatusCodeOk) {
+    ss << "nndeploy::op::softmax_topk failed: error code "
+       << base::statusCodeToString(status.getStatusCode());
+    pybind11::pybind11_fail(ss.str());
+  }
+  return {values, indices};
+}
+
 device::Tensor* globalAveragepoolFunc(device::Tensor* input) {
   std::stringstream ss;
   device::Tensor* result = new device::Tensor("global_averagepool.output");
@@ -129,4 +437,170 @@ device::Tensor* maxPoolFunc(device::Tensor* input,
   return result;
 }
 
+device::Tensor* averagePoolFunc(device::Tensor* input,
+                                std::shared_ptr<ir::AveragePoolParam> param) {
+  std::stringstream ss;
+  device::Tensor* result = new device::Tensor("averagepool.output");
+  base::Status status = op::averagePool(input, param, result);
+  if (status != base::kStatusCodeOk) {
+    ss << "nndeploy::op::averagePool failed: error code "
+       << base::statusCodeToString(status.getStatusCode());
+    pybind11::pybind11_fail(ss.str());
+  }
+  return result;
+}
+
+device::Tensor* resizeFunc(device::Tensor* input, device::Tensor* roi,
+                           device::Tensor* scales, device::Tensor* sizes,
+                           std::shared_ptr<ir::ResizeParam> param) {
+  std::stringstream ss;
+
+  device::Tensor* output = new device::Tensor("resize.output");
+  base::Status status = op::resize(input, roi, scales, sizes, param, output);
+  if (status != base::kStatusCodeOk) {
+    ss << "nndeploy::op::resize failed: error code "
+       << base::statusCodeToString(status.getStatusCode());
+    pybind11::pybind11_fail(ss.str());
+  }
+
+  return output;
+}
+
+device::Tensor* attentionFunc(device::Tensor* q, device::Tensor* k,
+                              device::Tensor* v, device::Tensor* attn_mask,
+                              std::shared_ptr<ir::AttentionParam> param) {
+  std::stringstream ss;
+  device::Tensor* result = new device::Tensor("attention.output");
+  base::Status status = op::attention(q, k, v, attn_mask, param, result);
+  if (status != base::kStatusCodeOk) {
+    ss << "nndeploy::op::attention failed: error code "
+       << base::statusCodeToString(status.getStatusCode());
+    pybind11::pybind11_fail(ss.str());
+  }
+  return result;
+}
+
+device::Tensor* pagedAttentionFunc(
+    device::Tensor* q, op::KVCache* kv_cache, const std::vector<int>& seq_ids,
+    std::shared_ptr<ir::PagedAttentionParam> param) {
+  std::stringstream ss;
+  device::Tensor* result = new device::Tensor("paged_attention.output");
+  base::Status status =
+      op::pagedAttention(q, kv_cache, seq_ids, param, result);
+  if (status != base::kStatusCodeOk) {
+    ss << "nndeploy::op::paged_attention failed: error code "
+       << base::statusCodeToString(status.getStatusCode());
+    pybind11::pybind11_fail(ss.str());
+  }
+  return result;
+}
+
+device::Tensor* rotaryEmbeddingFunc(
+    device::Tensor* input, device::Tensor* cos_cache, device::Tensor* sin_cache,
+    device::Tensor* position_ids,
+    std::shared_ptr<ir::RotaryEmbeddingParam> param) {
+  std::stringstream ss;
+  device::Tensor* result = new device::Tensor("rotary_embedding.output");
+  base::Status status = op::rotaryEmbedding(input, cos_cache, sin_cache,
+                                            position_ids, param, result);
+  if (status != base::kStatusCodeOk) {
+    ss << "nndeploy::op::rotary_embedding failed: error code "
+       << base::statusCodeToString(status.getStatusCode());
+    pybind11::pybind11_fail(ss.str());
+  }
+  return result;
+}
+
+device::Tensor* swigluFunc(device::Tensor* gate, device::Tensor* up) {
+  std::stringstream ss;
+  device::Tensor* result = new device::Tensor("swiglu.output");
+  base::Status status = op::swiglu(gate, up, result);
+  if (status != base::kStatusCodeOk) {
+    ss << "nndeploy::op::swiglu failed: error code "
+       << base::statusCodeToString(status.getStatusCode());
+    pybind11::pybind11_fail(ss.str());
+  }
+  return result;
+}
+
+device::Tensor* layerNormFunc(
+    device::Tensor* input, device::Tensor* scale, device::Tensor* bias,
+    std::shared_ptr<ir::LayerNormalizationParam> param) {
+  std::stringstream ss;
+  device::Tensor* result = new device::Tensor("layer_norm.output");
+  base::Status status = op::layerNorm(input, scale, bias, param, result);
+  if (status != base::kStatusCodeOk) {
+    ss << "nndeploy::op::layer_norm failed: error code "
+       << base::statusCodeToString(status.getStatusCode());
+    pybind11::pybind11_fail(ss.str());
+  }
+  return result;
+}
+
+device::Tensor* groupNormFunc(
+    device::Tensor* input, device::Tensor* scale, device::Tensor* bias,
+    std::shared_ptr<ir::GroupNormalizationParam> param) {
+  std::stringstream ss;
+  device::Tensor* result = new device::Tensor("group_norm.output");
+  base::Status status = op::groupNorm(input, scale, bias, param, result);
+  if (status != base::kStatusCodeOk) {
+    ss << "nndeploy::op::group_norm failed: error code "
+       << base::statusCodeToString(status.getStatusCode());
+    pybind11::pybind11_fail(ss.str());
+  }
+  return result;
+}
+
+device::Tensor* instanceNormFunc(
+    device::Tensor* input, device::Tensor* scale, device::Tensor* bias,
+    std::shared_ptr<ir::InstanceNormalizationParam> param) {
+  std::stringstream ss;
+  device::Tensor* result = new device::Tensor("instance_norm.output");
+  base::Status status = op::instanceNorm(input, scale, bias, param, result);
+  if (status != base::kStatusCodeOk) {
+    ss << "nndeploy::op::instance_norm failed: error code "
+       << base::statusCodeToString(status.getStatusCode());
+    pybind11::pybind11_fail(ss.str());
+  }
+  return result;
+}
+
+device::Tensor* concatFunc(std::vector<device::Tensor*> inputs,
+                           std::shared_ptr<ir::ConcatParam> param) {
+  std::stringstream ss;
+  device::Tensor* result = new device::Tensor("concat.output");
+  base::Status status = op::concat(inputs, param, result);
+  if (status != base::kStatusCodeOk) {
+    ss << "nndeploy::op::concat failed: error code "
+       << base::statusCodeToString(status.getStatusCode());
+    pybind11::pybind11_fail(ss.str());
+  }
+  return result;
+}
+
+device::Tensor* reorderFunc(device::Tensor* input,
+                            base::DataFormat data_format) {
+  std::stringstream ss;
+  device::Tensor* result = new device::Tensor("reorder.output");
+  base::Status status = op::reorder(input, data_format, result);
+  if (status != base::kStatusCodeOk) {
+    ss << "nndeploy::op::reorder failed: error code "
+       << base::statusCodeToString(status.getStatusCode());
+    pybind11::pybind11_fail(ss.str());
+  }
+  return result;
+}
+
+device::Tensor* castFunc(device::Tensor* input, base::DataType data_type) {
+  std::stringstream ss;
+  device::Tensor* result = new device::Tensor("cast.output");
+  base::Status status = op::cast(input, data_type, result);
+  if (status != base::kStatusCodeOk) {
+    ss << "nndeploy::op::cast failed: error code "
+       << base::statusCodeToString(status.getStatusCode());
+    pybind11::pybind11_fail(ss.str());
+  }
+  return result;
+}
+
 }  // namespace nndeploy
\ No newline at end of file
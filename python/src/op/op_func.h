@@ -6,14 +6,39 @@
 
 #include "nndeploy/ir/op_param.h"
 #include "nndeploy/op/op_add.h"
+#include "nndeploy/op/op_attention.h"
 #include "nndeploy/op/op_batchnorm.h"
+#include "nndeploy/op/op_cast.h"
+#include "nndeploy/op/op_concat.h"
 #include "nndeploy/op/op_conv.h"
+#include "nndeploy/op/op_dequantize_linear.h"
+#include "nndeploy/op/op_erf.h"
+#include "nndeploy/op/op_exp.h"
 #include "nndeploy/op/op_flatten.h"
+#include "nndeploy/op/op_gelu.h"
 #include "nndeploy/op/op_gemm.h"
+#include "nndeploy/op/op_averagepool.h"
 #include "nndeploy/op/op_global_averagepool.h"
+#include "nndeploy/op/op_group_norm.h"
+#include "nndeploy/op/op_layer_norm.h"
+#include "nndeploy/op/op_mat_mul.h"
 #include "nndeploy/op/op_maxpool.h"
+#include "nndeploy/op/op_qlinear_conv.h"
+#include "nndeploy/op/op_qlinear_mat_mul.h"
+#include "nndeploy/op/op_quantize_linear.h"
+#include "nndeploy/op/op_reduce.h"
 #include "nndeploy/op/op_relu.h"
+#include "nndeploy/op/op_reorder.h"
+#include "nndeploy/op/op_resize.h"
 #include "nndeploy/op/op_rmsnorm.h"
+#include "nndeploy/op/op_rotary_embedding.h"
+#include "nndeploy/op/op_sigmoid.h"
+#include "nndeploy/op/op_silu.h"
+#include "nndeploy/op/op_softmax.h"
+#include "nndeploy/op/op_swiglu.h"
+#include "nndeploy/op/op_tanh.h"
+#include "nndeploy/op/op_topk.h"
+#include "nndeploy/op/op_transpose.h"
 
 /**
  * @brief Op的func层，在该层进行Op的输入检查、输出Tensor构造、调用Op计算;
@@ -36,20 +61,148 @@ device::Tensor* batchNormFunc(
 
 device::Tensor* reluFunc(device::Tensor* input);
 
+device::Tensor* sigmoidFunc(device::Tensor* input);
+
+device::Tensor* expFunc(device::Tensor* input);
+
+device::Tensor* tanhFunc(device::Tensor* input);
+
+device::Tensor* erfFunc(device::Tensor* input);
+
+device::Tensor* geluFunc(device::Tensor* input);
+
+device::Tensor* siluFunc(device::Tensor* input);
+
+device::Tensor* softmaxFunc(device::Tensor* input,
+                            std::shared_ptr<ir::SoftmaxParam> param);
+
 device::Tensor* addFunc(device::Tensor* input1, device::Tensor* input2);
 
 device::Tensor* flattenFunc(device::Tensor* input,
                             std::shared_ptr<ir::FlattenParam> param);
 
+device::Tensor* transposeFunc(device::Tensor* input,
+                              std::shared_ptr<ir::TransposeParam> param);
+
 device::Tensor* gemmFunc(device::Tensor* inputs_a, device::Tensor* inputs_b,
                          device::Tensor* inputs_c,
                          std::shared_ptr<ir::GemmParam> param);
 
+device::Tensor* quantGemmFunc(device::Tensor* inputs_a,
+                              device::Tensor* inputs_b,
+                              device::Tensor* b_scale,
+                              device::Tensor* b_zero_point,
+                              device::Tensor* inputs_c,
+                              std::shared_ptr<ir::GemmParam> param);
+
+device::Tensor* quantMatMulFunc(device::Tensor* inputs_a,
+                                device::Tensor* inputs_b,
+                                device::Tensor* b_scale,
+                                device::Tensor* b_zero_point);
+
+device::Tensor* quantizeLinearFunc(
+    device::Tensor* input, device::Tensor* scale, device::Tensor* zero_point,
+    std::shared_ptr<ir::QuantizeLinearParam> param);
+
+device::Tensor* dequantizeLinearFunc(
+    device::Tensor* input, device::Tensor* scale, device::Tensor* zero_point,
+    std::shared_ptr<ir::DequantizeLinearParam> param);
+
+device::Tensor* qlinearConvFunc(
+    device::Tensor* x, device::Tensor* x_scale, device::Tensor* x_zero_point,
+    device::Tensor* w, device::Tensor* w_scale, device::Tensor* w_zero_point,
+    device::Tensor* y_scale, device::Tensor* y_zero_point, device::Tensor* b,
+    std::shared_ptr<ir::ConvParam> param);
+
+device::Tensor* qlinearMatMulFunc(
+    device::Tensor* a, device::Tensor* a_scale, device::Tensor* a_zero_point,
+    device::Tensor* b, device::Tensor* b_scale, device::Tensor* b_zero_point,
+    device::Tensor* y_scale, device::Tensor* y_zero_point);
+
+device::Tensor* reduceL1Func(device::Tensor* input,
+                             std::shared_ptr<ir::ReduceParam> param);
+
+device::Tensor* reduceL2Func(device::Tensor* input,
+                             std::shared_ptr<ir::ReduceParam> param);
+
+device::Tensor* reduceLogSumFunc(device::Tensor* input,
+                                 std::shared_ptr<ir::ReduceParam> param);
+
+device::Tensor* reduceLogSumExpFunc(device::Tensor* input,
+                                    std::shared_ptr<ir::ReduceParam> param);
+
+device::Tensor* reduceMaxFunc(device::Tensor* input,
+                              std::shared_ptr<ir::ReduceParam> param);
+
+device::Tensor* reduceMeanFunc(device::Tensor* input,
+                               std::shared_ptr<ir::ReduceParam> param);
+
+device::Tensor* reduceMinFunc(device::Tensor* input,
+                              std::shared_ptr<ir::ReduceParam> param);
+
+device::Tensor* reduceProdFunc(device::Tensor* input,
+                               std::shared_ptr<ir::ReduceParam> param);
+
+device::Tensor* reduceSumFunc(device::Tensor* input,
+                              std::shared_ptr<ir::ReduceParam> param);
+
+device::Tensor* reduceSumSquareFunc(device::Tensor* input,
+                                    std::shared_ptr<ir::ReduceParam> param);
+
+// 返回[values, indices]
+std::vector<device::Tensor*> topKFunc(device::Tensor* input,
+                                     std::shared_ptr<ir::TopKParam> param);
+
+std::vector<device::Tensor*> softmaxTopKFunc(
+    device::Tensor* input, std::shared_ptr<ir::TopKParam> param);
+
 device::Tensor* globalAveragepoolFunc(device::Tensor* input);
 
 device::Tensor* maxPoolFunc(device::Tensor* input,
                             std::shared_ptr<ir::MaxPoolParam> param);
 
+device::Tensor* averagePoolFunc(device::Tensor* input,
+                                std::shared_ptr<ir::AveragePoolParam> param);
+
+device::Tensor* resizeFunc(device::Tensor* input, device::Tensor* roi,
+                           device::Tensor* scales, device::Tensor* sizes,
+                           std::shared_ptr<ir::ResizeParam> param);
+
+device::Tensor* attentionFunc(device::Tensor* q, device::Tensor* k,
+                              device::Tensor* v, device::Tensor* attn_mask,
+                              std::shared_ptr<ir::AttentionParam> param);
+
+device::Tensor* pagedAttentionFunc(
+    device::Tensor* q, op::KVCache* kv_cache, const std::vector<int>& seq_ids,
+    std::shared_ptr<ir::PagedAttentionParam> param);
+
+device::Tensor* rotaryEmbeddingFunc(
+    device::Tensor* input, device::Tensor* cos_cache, device::Tensor* sin_cache,
+    device::Tensor* position_ids,
+    std::shared_ptr<ir::RotaryEmbeddingParam> param);
+
+device::Tensor* swigluFunc(device::Tensor* gate, device::Tensor* up);
+
+device::Tensor* layerNormFunc(
+    device::Tensor* input, device::Tensor* scale, device::Tensor* bias,
+    std::shared_ptr<ir::LayerNormalizationParam> param);
+
+device::Tensor* groupNormFunc(
+    device::Tensor* input, device::Tensor* scale, device::Tensor* bias,
+    std::shared_ptr<ir::GroupNormalizationParam> param);
+
+device::Tensor* instanceNormFunc(
+    device::Tensor* input, device::Tensor* scale, device::Tensor* bias,
+    std::shared_ptr<ir::InstanceNormalizationParam> param);
+
+device::Tensor* concatFunc(std::vector<device::Tensor*> inputs,
+                           std::shared_ptr<ir::ConcatParam> param);
+
+device::Tensor* reorderFunc(device::Tensor* input,
+                            base::DataFormat data_format);
+
+device::Tensor* castFunc(device::Tensor* input, base::DataType data_type);
+
 }  // namespace nndeploy
 
 #endif
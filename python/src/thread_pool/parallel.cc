@@ -0,0 +1,17 @@
+#include "nndeploy/thread_pool/parallel.h"
+
+#include "nndeploy_api_registry.h"
+
+namespace nndeploy {
+namespace thread_pool {
+
+NNDEPLOY_API_PYBIND11_MODULE("thread_pool", m) {
+  // op内并行计算所用的全局线程池
+  m.def("setThreadNum", &setThreadNum, py::arg("num"));
+  m.def("getThreadNum", &getThreadNum);
+  // 当前线程发起的并行计算可用的线程数
+  m.def("getThreadBudget", &getThreadBudget);
+}
+
+}  // namespace thread_pool
+}  // namespace nndeploy